@@ -0,0 +1,513 @@
+/*!
+ * \file bench.c
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Read, write and round trip throughput benchmarks.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "generator.h"
+
+#include <time.h>
+#include <sys/stat.h>
+
+
+/*!
+ * \brief Benchmark options, set from the command line.
+ */
+typedef struct
+bench_options_struct
+{
+        long number_of_entities;
+                /*!< Number of entities in the generated drawing. */
+        unsigned long seed;
+                /*!< Seed of the generator. */
+        int repeat;
+                /*!< Number of timed runs of every benchmark. */
+        int acad_version_number;
+                /*!< AutoCAD version of the generated drawing. */
+        int number_of_threads;
+                /*!< Number of threads for the parallel writer. */
+        const char *directory;
+                /*!< Directory for the temporary DXF files. */
+        const char *output;
+                /*!< File receiving the results, \c NULL for stdout. */
+        BenchMix mix;
+                /*!< Entity mix of the generated drawing. */
+} BenchOptions;
+
+
+/*!
+ * \brief Timings of one benchmark.
+ */
+typedef struct
+bench_result_struct
+{
+        const char *name;
+                /*!< Name of the benchmark. */
+        long bytes;
+                /*!< Size of the DXF data processed in a run. */
+        long entities;
+                /*!< Number of entities processed in a run. */
+        double *seconds;
+                /*!< Duration of every run. */
+} BenchResult;
+
+
+typedef int (*BenchFunction) (const BenchOptions *options, const char *path);
+
+
+static double
+bench_now (void)
+{
+        struct timespec now;
+
+        clock_gettime (CLOCK_MONOTONIC, &now);
+        return ((double) now.tv_sec + (double) now.tv_nsec * 1e-9);
+}
+
+
+static int
+bench_compare_double
+(
+        const void *a,
+        const void *b
+)
+{
+        double x = *(const double *) a;
+        double y = *(const double *) b;
+
+        return ((x > y) - (x < y));
+}
+
+
+static long
+bench_file_size
+(
+        const char *path
+)
+{
+        struct stat st;
+
+        if (stat (path, &st) != 0)
+        {
+                return (-1);
+        }
+        return ((long) st.st_size);
+}
+
+
+/*!
+ * \brief Write \c drawing to \c path, with the parallel writer when
+ * \c number_of_threads is not 0.
+ */
+static int
+bench_write_drawing
+(
+        DxfDrawing *drawing,
+        const char *path,
+        int acad_version_number,
+        int number_of_threads
+)
+{
+        DxfFile file;
+        int result;
+
+        memset (&file, 0, sizeof (DxfFile));
+        file.fp = fopen (path, "wb");
+        if (file.fp == NULL)
+        {
+                fprintf (stderr, "Could not open %s for writing.\n", path);
+                return (EXIT_FAILURE);
+        }
+        file.filename = (char *) path;
+        file.acad_version_number = acad_version_number;
+        if (number_of_threads != 0)
+        {
+                result = dxf_drawing_write_parallel (drawing, &file,
+                  number_of_threads);
+        }
+        else
+        {
+                result = dxf_file_write (&file, drawing);
+        }
+        if (fclose (file.fp) != 0)
+        {
+                result = EXIT_FAILURE;
+        }
+        return (result);
+}
+
+
+static int
+bench_run_generate
+(
+        const BenchOptions *options,
+        const char *path
+)
+{
+        long counts[BENCH_NUMBER_OF_ENTITY_TYPES];
+        DxfDrawing *drawing = NULL;
+
+        (void) path;
+        drawing = bench_generate (&options->mix, options->number_of_entities,
+          options->seed, options->acad_version_number, counts);
+        if (drawing == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        bench_free (drawing);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Generated drawing shared by the write benchmarks, so they time
+ * the serialisation only.
+ */
+static DxfDrawing *bench_drawing = NULL;
+
+
+static int
+bench_run_write
+(
+        const BenchOptions *options,
+        const char *path
+)
+{
+        return (bench_write_drawing (bench_drawing, path,
+          options->acad_version_number, 0));
+}
+
+
+static int
+bench_run_write_parallel
+(
+        const BenchOptions *options,
+        const char *path
+)
+{
+        return (bench_write_drawing (bench_drawing, path,
+          options->acad_version_number, options->number_of_threads));
+}
+
+
+static int
+bench_run_read
+(
+        const BenchOptions *options,
+        const char *path
+)
+{
+        DxfDrawing *drawing = NULL;
+        int result;
+
+        (void) options;
+        drawing = dxf_drawing_new ();
+        result = dxf_file_read_drawing ((char *) path, drawing);
+        dxf_drawing_free (drawing);
+        return (result);
+}
+
+
+static int
+bench_run_round_trip
+(
+        const BenchOptions *options,
+        const char *path
+)
+{
+        DxfDrawing *drawing = NULL;
+        char copy[4096];
+        int result;
+
+        snprintf (copy, sizeof (copy), "%s.copy.dxf", path);
+        drawing = dxf_drawing_new ();
+        result = dxf_file_read_drawing ((char *) path, drawing);
+        if (result == EXIT_SUCCESS)
+        {
+                result = bench_write_drawing (drawing, copy,
+                  options->acad_version_number, 0);
+        }
+        dxf_drawing_free (drawing);
+        return (result);
+}
+
+
+/*!
+ * \brief Time \c repeat runs of \c function.
+ */
+static int
+bench_time
+(
+        const BenchOptions *options,
+        BenchFunction function,
+        const char *path,
+        BenchResult *result
+)
+{
+        double start;
+        int i;
+
+        for (i = 0; i < options->repeat; i++)
+        {
+                start = bench_now ();
+                if (function (options, path) != EXIT_SUCCESS)
+                {
+                        fprintf (stderr, "Benchmark %s failed.\n", result->name);
+                        return (EXIT_FAILURE);
+                }
+                result->seconds[i] = bench_now () - start;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Print a result as one line of JSON.
+ */
+static void
+bench_report
+(
+        FILE *out,
+        const BenchOptions *options,
+        BenchResult *result
+)
+{
+        char mix[512];
+        double minimum;
+        double median;
+
+        qsort (result->seconds, (size_t) options->repeat, sizeof (double),
+          bench_compare_double);
+        minimum = result->seconds[0];
+        median = result->seconds[options->repeat / 2];
+        if (minimum <= 0.0)
+        {
+                minimum = 1e-9;
+        }
+        bench_mix_to_string (&options->mix, mix, sizeof (mix));
+        fprintf (out,
+          "{\"benchmark\":\"%s\",\"version\":%d,\"entities\":%ld,"
+          "\"bytes\":%ld,\"repeat\":%d,\"seed\":%lu,\"threads\":%d,"
+          "\"mix\":\"%s\",\"seconds_min\":%.6f,\"seconds_median\":%.6f,"
+          "\"mb_per_s\":%.3f,\"entities_per_s\":%.1f}\n",
+          result->name, options->acad_version_number, result->entities,
+          result->bytes, options->repeat, options->seed,
+          options->number_of_threads, mix, minimum, median,
+          (double) result->bytes / minimum / 1e6,
+          (double) result->entities / minimum);
+        fflush (out);
+}
+
+
+static void
+bench_usage
+(
+        const char *program
+)
+{
+        int i;
+
+        fprintf (stderr,
+          "Usage: %s [options]\n"
+          "  --entities N    number of generated entities (default 100000)\n"
+          "  --mix SPEC      entity mix, e.g. LINE=40,LWPOLYLINE=20,HATCH=5\n"
+          "  --seed N        seed of the generator (default 1)\n"
+          "  --repeat N      timed runs of every benchmark (default 5)\n"
+          "  --version N     AutoCAD version number (default %d)\n"
+          "  --threads N     threads for write_parallel (default 0, one per CPU)\n"
+          "  --dir PATH      directory for temporary files (default /tmp)\n"
+          "  --output FILE   append JSON lines results to FILE (default stdout)\n"
+          "Entity types:",
+          program, AutoCAD_2000);
+        for (i = 0; i < BENCH_NUMBER_OF_ENTITY_TYPES; i++)
+        {
+                fprintf (stderr, " %s", bench_entity_type_names[i]);
+        }
+        fprintf (stderr, "\n");
+}
+
+
+static int
+bench_parse_options
+(
+        int argc,
+        char *argv[],
+        BenchOptions *options
+)
+{
+        int i;
+
+        memset (options, 0, sizeof (BenchOptions));
+        options->number_of_entities = 100000;
+        options->seed = 1;
+        options->repeat = 5;
+        options->acad_version_number = AutoCAD_2000;
+        options->directory = "/tmp";
+        bench_mix_default (&options->mix);
+        for (i = 1; i < argc; i++)
+        {
+                if ((i + 1 >= argc) || (strncmp (argv[i], "--", 2) != 0))
+                {
+                        bench_usage (argv[0]);
+                        return (EXIT_FAILURE);
+                }
+                if (strcmp (argv[i], "--entities") == 0)
+                {
+                        options->number_of_entities = atol (argv[++i]);
+                }
+                else if (strcmp (argv[i], "--mix") == 0)
+                {
+                        if (bench_mix_parse (&options->mix, argv[++i]) != EXIT_SUCCESS)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                }
+                else if (strcmp (argv[i], "--seed") == 0)
+                {
+                        options->seed = strtoul (argv[++i], NULL, 10);
+                }
+                else if (strcmp (argv[i], "--repeat") == 0)
+                {
+                        options->repeat = atoi (argv[++i]);
+                }
+                else if (strcmp (argv[i], "--version") == 0)
+                {
+                        options->acad_version_number = atoi (argv[++i]);
+                }
+                else if (strcmp (argv[i], "--threads") == 0)
+                {
+                        options->number_of_threads = atoi (argv[++i]);
+                }
+                else if (strcmp (argv[i], "--dir") == 0)
+                {
+                        options->directory = argv[++i];
+                }
+                else if (strcmp (argv[i], "--output") == 0)
+                {
+                        options->output = argv[++i];
+                }
+                else
+                {
+                        bench_usage (argv[0]);
+                        return (EXIT_FAILURE);
+                }
+        }
+        if ((options->number_of_entities <= 0) || (options->repeat <= 0))
+        {
+                bench_usage (argv[0]);
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+int
+main
+(
+        int argc,
+        char *argv[]
+)
+{
+        static const struct
+        {
+                const char *name;
+                BenchFunction function;
+        } benchmarks[] =
+        {
+                {"generate", bench_run_generate},
+                {"write", bench_run_write},
+                {"write_parallel", bench_run_write_parallel},
+                {"read", bench_run_read},
+                {"round_trip", bench_run_round_trip}
+        };
+        long counts[BENCH_NUMBER_OF_ENTITY_TYPES];
+        BenchOptions options;
+        BenchResult result;
+        FILE *out = stdout;
+        char path[4096];
+        char copy[4096];
+        long bytes;
+        size_t i;
+        int status = EXIT_SUCCESS;
+
+        if (bench_parse_options (argc, argv, &options) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((options.output != NULL)
+          && ((out = fopen (options.output, "a")) == NULL))
+        {
+                fprintf (stderr, "Could not open %s.\n", options.output);
+                return (EXIT_FAILURE);
+        }
+        snprintf (path, sizeof (path), "%s/libdxf_bench_%ld.dxf",
+          options.directory, (long) getpid ());
+        snprintf (copy, sizeof (copy), "%s.copy.dxf", path);
+        /* The written file is the input of the read benchmarks. */
+        bench_drawing = bench_generate (&options.mix, options.number_of_entities,
+          options.seed, options.acad_version_number, counts);
+        if ((bench_drawing == NULL)
+          || (bench_write_drawing (bench_drawing, path,
+          options.acad_version_number, 0) != EXIT_SUCCESS))
+        {
+                fprintf (stderr, "Could not generate %s.\n", path);
+                return (EXIT_FAILURE);
+        }
+        bytes = bench_file_size (path);
+        result.seconds = malloc ((size_t) options.repeat * sizeof (double));
+        for (i = 0; i < sizeof (benchmarks) / sizeof (benchmarks[0]); i++)
+        {
+                result.name = benchmarks[i].name;
+                /* Generating does not produce DXF data. */
+                result.bytes = (benchmarks[i].function == bench_run_generate)
+                  ? 0 : bytes;
+                result.entities = options.number_of_entities;
+                if (bench_time (&options, benchmarks[i].function, path,
+                  &result) != EXIT_SUCCESS)
+                {
+                        status = EXIT_FAILURE;
+                        continue;
+                }
+                bench_report (out, &options, &result);
+        }
+        free (result.seconds);
+        bench_free (bench_drawing);
+        remove (path);
+        remove (copy);
+        if (out != stdout)
+        {
+                fclose (out);
+        }
+        return (status);
+}
+
+
+/* EOF */
@@ -0,0 +1,690 @@
+/*!
+ * \file generator.c
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Deterministic generator of synthetic DXF drawings for the benchmarks.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "generator.h"
+
+
+/*!
+ * \brief Names of the entity types, as used in a mix specification.
+ */
+const char *bench_entity_type_names[BENCH_NUMBER_OF_ENTITY_TYPES] =
+{
+        "LINE",
+        "CIRCLE",
+        "ARC",
+        "ELLIPSE",
+        "POINT",
+        "LWPOLYLINE",
+        "TEXT",
+        "MTEXT",
+        "INSERT",
+        "SPLINE",
+        "HATCH"
+};
+
+
+/*!
+ * \brief Size of the square the generated geometry is placed in.
+ */
+#define BENCH_EXTENT 1000.0
+
+
+/*!
+ * \brief Next value of a xorshift64* pseudo random number generator.
+ *
+ * The generator is part of the benchmark, so the generated drawings are
+ * the same on every platform for the same seed.
+ */
+static uint64_t
+bench_random
+(
+        uint64_t *state
+)
+{
+        *state ^= *state >> 12;
+        *state ^= *state << 25;
+        *state ^= *state >> 27;
+        return (*state * UINT64_C(2685821657736338717));
+}
+
+
+/*!
+ * \brief Pseudo random double in the range [\c low, \c high).
+ */
+static double
+bench_random_double
+(
+        uint64_t *state,
+        double low,
+        double high
+)
+{
+        return (low + (high - low)
+          * ((double) (bench_random (state) >> 11) / 9007199254740992.0));
+}
+
+
+/*!
+ * \brief Set the default entity mix.
+ */
+void
+bench_mix_default
+(
+        BenchMix *mix
+)
+{
+        mix->weights[BENCH_LINE] = 30;
+        mix->weights[BENCH_CIRCLE] = 10;
+        mix->weights[BENCH_ARC] = 10;
+        mix->weights[BENCH_ELLIPSE] = 5;
+        mix->weights[BENCH_POINT] = 5;
+        mix->weights[BENCH_LWPOLYLINE] = 15;
+        mix->weights[BENCH_TEXT] = 5;
+        mix->weights[BENCH_MTEXT] = 5;
+        mix->weights[BENCH_INSERT] = 5;
+        mix->weights[BENCH_SPLINE] = 5;
+        mix->weights[BENCH_HATCH] = 5;
+}
+
+
+/*!
+ * \brief Parse a mix specification like "LINE=40,LWPOLYLINE=20,HATCH=5".
+ *
+ * Entity types not in the specification get a weight of 0.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE for an invalid
+ * specification.
+ */
+int
+bench_mix_parse
+(
+        BenchMix *mix,
+        const char *spec
+)
+{
+        char name[32];
+        int weight;
+        int length;
+        int total = 0;
+        int i;
+
+        memset (mix, 0, sizeof (BenchMix));
+        while (*spec != '\0')
+        {
+                if (sscanf (spec, "%31[A-Za-z0-9]=%d%n", name, &weight, &length) != 2)
+                {
+                        fprintf (stderr, "Invalid mix specification: %s\n", spec);
+                        return (EXIT_FAILURE);
+                }
+                for (i = 0; i < BENCH_NUMBER_OF_ENTITY_TYPES; i++)
+                {
+                        if (strcasecmp (name, bench_entity_type_names[i]) == 0)
+                        {
+                                break;
+                        }
+                }
+                if ((i == BENCH_NUMBER_OF_ENTITY_TYPES) || (weight < 0))
+                {
+                        fprintf (stderr, "Invalid entity type or weight in mix: %s=%d\n",
+                          name, weight);
+                        return (EXIT_FAILURE);
+                }
+                mix->weights[i] = weight;
+                total += weight;
+                spec += length;
+                if (*spec == ',')
+                {
+                        spec++;
+                }
+        }
+        if (total == 0)
+        {
+                fprintf (stderr, "Empty mix specification.\n");
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Print a mix as a specification string.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the buffer
+ * is too small.
+ */
+int
+bench_mix_to_string
+(
+        const BenchMix *mix,
+        char *buffer,
+        size_t size
+)
+{
+        size_t used = 0;
+        int length;
+        int i;
+
+        buffer[0] = '\0';
+        for (i = 0; i < BENCH_NUMBER_OF_ENTITY_TYPES; i++)
+        {
+                if (mix->weights[i] == 0)
+                {
+                        continue;
+                }
+                length = snprintf (buffer + used, size - used, "%s%s=%d",
+                  (used > 0) ? "," : "", bench_entity_type_names[i],
+                  mix->weights[i]);
+                if ((length < 0) || ((size_t) length >= size - used))
+                {
+                        return (EXIT_FAILURE);
+                }
+                used += (size_t) length;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+static void
+bench_generate_line
+(
+        DxfEntities *entities,
+        uint64_t *state
+)
+{
+        DxfLine *line = dxf_line_init (dxf_line_new ());
+
+        line->p0->x0 = bench_random_double (state, 0.0, BENCH_EXTENT);
+        line->p0->y0 = bench_random_double (state, 0.0, BENCH_EXTENT);
+        line->p1->x0 = line->p0->x0 + bench_random_double (state, 1.0, 50.0);
+        line->p1->y0 = line->p0->y0 + bench_random_double (state, -50.0, 50.0);
+        line->next = (struct DxfLine *) entities->line_list;
+        entities->line_list = (struct DxfLine *) line;
+}
+
+
+static void
+bench_generate_circle
+(
+        DxfEntities *entities,
+        uint64_t *state
+)
+{
+        DxfCircle *circle = dxf_circle_init (dxf_circle_new ());
+
+        circle->p0->x0 = bench_random_double (state, 0.0, BENCH_EXTENT);
+        circle->p0->y0 = bench_random_double (state, 0.0, BENCH_EXTENT);
+        circle->radius = bench_random_double (state, 1.0, 25.0);
+        circle->next = (struct DxfCircle *) entities->circle_list;
+        entities->circle_list = (struct DxfCircle *) circle;
+}
+
+
+static void
+bench_generate_arc
+(
+        DxfEntities *entities,
+        uint64_t *state
+)
+{
+        DxfArc *arc = dxf_arc_init (dxf_arc_new ());
+
+        arc->p0->x0 = bench_random_double (state, 0.0, BENCH_EXTENT);
+        arc->p0->y0 = bench_random_double (state, 0.0, BENCH_EXTENT);
+        arc->radius = bench_random_double (state, 1.0, 25.0);
+        arc->start_angle = bench_random_double (state, 0.0, 180.0);
+        arc->end_angle = arc->start_angle + bench_random_double (state, 10.0, 180.0);
+        arc->next = (struct DxfArc *) entities->arc_list;
+        entities->arc_list = (struct DxfArc *) arc;
+}
+
+
+static void
+bench_generate_ellipse
+(
+        DxfEntities *entities,
+        uint64_t *state
+)
+{
+        DxfEllipse *ellipse = dxf_ellipse_init (dxf_ellipse_new ());
+
+        ellipse->p0 = dxf_point_init (dxf_point_new ());
+        ellipse->p1 = dxf_point_init (dxf_point_new ());
+        ellipse->p0->x0 = bench_random_double (state, 0.0, BENCH_EXTENT);
+        ellipse->p0->y0 = bench_random_double (state, 0.0, BENCH_EXTENT);
+        ellipse->p1->x0 = bench_random_double (state, 5.0, 25.0);
+        ellipse->p1->y0 = 0.0;
+        ellipse->ratio = bench_random_double (state, 0.2, 1.0);
+        ellipse->start_angle = 0.0;
+        ellipse->end_angle = 2.0 * M_PI;
+        ellipse->next = (struct DxfEllipse *) entities->ellipse_list;
+        entities->ellipse_list = (struct DxfEllipse *) ellipse;
+}
+
+
+static void
+bench_generate_point
+(
+        DxfEntities *entities,
+        uint64_t *state
+)
+{
+        DxfPoint *point = dxf_point_init (dxf_point_new ());
+
+        point->x0 = bench_random_double (state, 0.0, BENCH_EXTENT);
+        point->y0 = bench_random_double (state, 0.0, BENCH_EXTENT);
+        point->next = (struct DxfPoint *) entities->point_list;
+        entities->point_list = (struct DxfPoint *) point;
+}
+
+
+static void
+bench_generate_lwpolyline
+(
+        DxfEntities *entities,
+        uint64_t *state
+)
+{
+        DxfLWPolyline *lwpolyline = dxf_lwpolyline_init (dxf_lwpolyline_new ());
+        DxfVertex *vertex = NULL;
+        double x;
+        double y;
+        int i;
+
+        x = bench_random_double (state, 0.0, BENCH_EXTENT);
+        y = bench_random_double (state, 0.0, BENCH_EXTENT);
+        /* Replace the empty vertex dxf_lwpolyline_init () starts with. */
+        dxf_vertex_free_list ((DxfVertex *) lwpolyline->vertices);
+        lwpolyline->vertices = NULL;
+        lwpolyline->number_vertices = 4 + (int) (bench_random (state) % 13);
+        for (i = 0; i < lwpolyline->number_vertices; i++)
+        {
+                vertex = dxf_vertex_init (dxf_vertex_new ());
+                vertex->p0->x0 = x + bench_random_double (state, -20.0, 20.0);
+                vertex->p0->y0 = y + bench_random_double (state, -20.0, 20.0);
+                vertex->next = (struct DxfVertex *) lwpolyline->vertices;
+                lwpolyline->vertices = (struct DxfVertex *) vertex;
+        }
+        lwpolyline->flag = (int) (bench_random (state) & 1);
+        lwpolyline->next = (struct DxfLWPolyline *) entities->lw_polyline_list;
+        entities->lw_polyline_list = (struct DxfLWPolyline *) lwpolyline;
+}
+
+
+static void
+bench_generate_text
+(
+        DxfEntities *entities,
+        uint64_t *state,
+        long number
+)
+{
+        DxfText *text = dxf_text_init (dxf_text_new ());
+        char value[64];
+
+        snprintf (value, sizeof (value), "Text %ld", number);
+        dxf_free (text->text_value);
+        text->text_value = dxf_strdup (value);
+        text->p0->x0 = bench_random_double (state, 0.0, BENCH_EXTENT);
+        text->p0->y0 = bench_random_double (state, 0.0, BENCH_EXTENT);
+        text->height = bench_random_double (state, 1.0, 5.0);
+        text->rel_x_scale = 1.0;
+        dxf_free (text->text_style);
+        text->text_style = dxf_strdup ("STANDARD");
+        text->next = (struct DxfText *) entities->text_list;
+        entities->text_list = (struct DxfText *) text;
+}
+
+
+static void
+bench_generate_mtext
+(
+        DxfEntities *entities,
+        uint64_t *state,
+        long number
+)
+{
+        DxfMtext *mtext = dxf_mtext_init (dxf_mtext_new ());
+        char value[128];
+
+        snprintf (value, sizeof (value),
+          "Multiline text %ld\\Pwith a second line", number);
+        dxf_free (mtext->text_value);
+        mtext->text_value = dxf_strdup (value);
+        dxf_free (mtext->text_style);
+        mtext->text_style = dxf_strdup ("STANDARD");
+        mtext->p0->x0 = bench_random_double (state, 0.0, BENCH_EXTENT);
+        mtext->p0->y0 = bench_random_double (state, 0.0, BENCH_EXTENT);
+        mtext->height = bench_random_double (state, 1.0, 5.0);
+        mtext->rectangle_width = 50.0;
+        mtext->attachment_point = 1;
+        mtext->drawing_direction = 1;
+        mtext->next = (struct DxfMtext *) entities->mtext_list;
+        entities->mtext_list = (struct DxfMtext *) mtext;
+}
+
+
+static void
+bench_generate_insert
+(
+        DxfEntities *entities,
+        uint64_t *state
+)
+{
+        DxfInsert *insert = dxf_insert_init (dxf_insert_new ());
+
+        insert->p0 = dxf_point_init (dxf_point_new ());
+        dxf_free (insert->block_name);
+        insert->block_name = dxf_strdup (BENCH_BLOCK_NAME);
+        insert->p0->x0 = bench_random_double (state, 0.0, BENCH_EXTENT);
+        insert->p0->y0 = bench_random_double (state, 0.0, BENCH_EXTENT);
+        insert->rel_x_scale = bench_random_double (state, 0.5, 2.0);
+        insert->rel_y_scale = insert->rel_x_scale;
+        insert->rel_z_scale = 1.0;
+        insert->rot_angle = bench_random_double (state, 0.0, 360.0);
+        insert->next = (struct DxfInsert *) entities->insert_list;
+        entities->insert_list = (struct DxfInsert *) insert;
+}
+
+
+static void
+bench_generate_spline
+(
+        DxfEntities *entities,
+        uint64_t *state
+)
+{
+        DxfSpline *spline = dxf_spline_init (dxf_spline_new ());
+        DxfPoint *point = NULL;
+        DxfDouble *knot = NULL;
+        double x;
+        double y;
+        int i;
+
+        /* A clamped cubic B-spline with uniform inner knots. */
+        dxf_point_free_list (spline->p0);
+        dxf_point_free_list (spline->p1);
+        dxf_double_free_list (spline->knot_value);
+        dxf_double_free_list (spline->weight_value);
+        spline->p0 = NULL;
+        spline->p1 = NULL;
+        spline->knot_value = NULL;
+        spline->weight_value = NULL;
+        spline->flag = 8;
+        spline->degree = 3;
+        spline->number_of_control_points = 4 + (int16_t) (bench_random (state) % 9);
+        spline->number_of_knots = spline->number_of_control_points + 4;
+        spline->number_of_fit_points = 0;
+        x = bench_random_double (state, 0.0, BENCH_EXTENT);
+        y = bench_random_double (state, 0.0, BENCH_EXTENT);
+        for (i = spline->number_of_control_points - 1; i >= 0; i--)
+        {
+                point = dxf_point_init (dxf_point_new ());
+                point->x0 = x + 5.0 * i;
+                point->y0 = y + bench_random_double (state, -10.0, 10.0);
+                point->next = (struct DxfPoint *) spline->p0;
+                spline->p0 = point;
+        }
+        for (i = spline->number_of_knots - 1; i >= 0; i--)
+        {
+                knot = dxf_double_init (dxf_double_new ());
+                if (i < 4)
+                {
+                        knot->value = 0.0;
+                }
+                else if (i >= spline->number_of_control_points)
+                {
+                        knot->value = 1.0;
+                }
+                else
+                {
+                        knot->value = (double) (i - 3)
+                          / (double) (spline->number_of_control_points - 3);
+                }
+                knot->next = (struct DxfDouble *) spline->knot_value;
+                spline->knot_value = knot;
+        }
+        spline->next = (struct DxfSpline *) entities->spline_list;
+        entities->spline_list = (struct DxfSpline *) spline;
+}
+
+
+static void
+bench_generate_hatch
+(
+        DxfEntities *entities,
+        uint64_t *state
+)
+{
+        DxfHatch *hatch = dxf_hatch_init (dxf_hatch_new ());
+        DxfHatchBoundaryPath *path = NULL;
+        DxfHatchBoundaryPathPolyline *polyline = NULL;
+        DxfHatchBoundaryPathPolylineVertex *vertex = NULL;
+        double x;
+        double y;
+        double size;
+        int i;
+
+        x = bench_random_double (state, 0.0, BENCH_EXTENT);
+        y = bench_random_double (state, 0.0, BENCH_EXTENT);
+        size = bench_random_double (state, 2.0, 20.0);
+        hatch->p0 = dxf_point_init (dxf_point_new ());
+        dxf_free (hatch->pattern_name);
+        hatch->pattern_name = dxf_strdup ("SOLID");
+        hatch->solid_fill = 1;
+        hatch->hatch_pattern_type = 1;
+        path = dxf_hatch_boundary_path_init (dxf_hatch_boundary_path_new ());
+        polyline = dxf_hatch_boundary_path_polyline_init
+          (dxf_hatch_boundary_path_polyline_new ());
+        polyline->is_closed = 1;
+        polyline->number_of_vertices = 4;
+        for (i = 3; i >= 0; i--)
+        {
+                vertex = dxf_hatch_boundary_path_polyline_vertex_init
+                  (dxf_hatch_boundary_path_polyline_vertex_new ());
+                vertex->x0 = x + (((i == 1) || (i == 2)) ? size : 0.0);
+                vertex->y0 = y + ((i >= 2) ? size : 0.0);
+                vertex->next = (struct DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+                polyline->vertices = (struct DxfHatchBoundaryPathPolylineVertex *) vertex;
+        }
+        path->polylines = (struct DxfHatchBoundaryPathPolyline *) polyline;
+        hatch->paths = (struct DxfHatchBoundaryPath *) path;
+        hatch->number_of_boundary_paths = 1;
+        hatch->next = (struct DxfHatch *) entities->hatch_list;
+        entities->hatch_list = (struct DxfHatch *) hatch;
+}
+
+
+/*!
+ * \brief Create the block definition referenced by the generated
+ * \c INSERT entities: a square with its diagonals.
+ */
+static DxfBlock *
+bench_generate_block (void)
+{
+        DxfBlock *block = dxf_block_init (dxf_block_new ());
+        DxfEntities *entities = dxf_entities_new ();
+        DxfLine *line = NULL;
+        static const double corners[6][4] =
+        {
+                {0.0, 0.0, 10.0, 0.0},
+                {10.0, 0.0, 10.0, 10.0},
+                {10.0, 10.0, 0.0, 10.0},
+                {0.0, 10.0, 0.0, 0.0},
+                {0.0, 0.0, 10.0, 10.0},
+                {10.0, 0.0, 0.0, 10.0}
+        };
+        int i;
+
+        dxf_free (block->block_name);
+        block->block_name = dxf_strdup (BENCH_BLOCK_NAME);
+        for (i = 5; i >= 0; i--)
+        {
+                line = dxf_line_init (dxf_line_new ());
+                line->p0->x0 = corners[i][0];
+                line->p0->y0 = corners[i][1];
+                line->p1->x0 = corners[i][2];
+                line->p1->y0 = corners[i][3];
+                line->next = (struct DxfLine *) entities->line_list;
+                entities->line_list = (struct DxfLine *) line;
+        }
+        block->entities = (struct DxfEntities *) entities;
+        return (block);
+}
+
+
+/*!
+ * \brief Generate a drawing with \c number_of_entities entities in the
+ * \c ENTITIES section.
+ *
+ * The type of every entity is drawn from \c mix with a pseudo random
+ * generator seeded with \c seed, the same arguments give the same
+ * drawing.
+ *
+ * \return a pointer to the drawing, or \c NULL when an error occurred.
+ */
+DxfDrawing *
+bench_generate
+(
+        const BenchMix *mix,
+        long number_of_entities,
+        unsigned long seed,
+        int acad_version_number,
+        long counts[BENCH_NUMBER_OF_ENTITY_TYPES]
+)
+{
+        DxfDrawing *drawing = NULL;
+        DxfEntities *entities = NULL;
+        uint64_t state;
+        uint64_t pick;
+        int total = 0;
+        long n;
+        int i;
+
+        for (i = 0; i < BENCH_NUMBER_OF_ENTITY_TYPES; i++)
+        {
+                total += mix->weights[i];
+                counts[i] = 0;
+        }
+        if (total <= 0)
+        {
+                return (NULL);
+        }
+        drawing = dxf_drawing_init (dxf_drawing_new (), acad_version_number);
+        /* dxf_entities_init () seeds every list with a default entity,
+         * start from empty lists instead. */
+        entities = dxf_entities_new ();
+        if ((drawing == NULL) || (entities == NULL))
+        {
+                return (NULL);
+        }
+        drawing->header = (struct DxfHeader *) dxf_header_init (dxf_header_new (),
+          acad_version_number);
+        drawing->entities_list = (struct DxfEntities *) entities;
+        if (mix->weights[BENCH_INSERT] > 0)
+        {
+                drawing->block_list = (struct DxfBlock *) bench_generate_block ();
+        }
+        /* xorshift does not work with a zero state. */
+        state = (uint64_t) seed * UINT64_C(0x9E3779B97F4A7C15) + 1;
+        for (n = 0; n < number_of_entities; n++)
+        {
+                pick = bench_random (&state) % (uint64_t) total;
+                for (i = 0; pick >= (uint64_t) mix->weights[i]; i++)
+                {
+                        pick -= (uint64_t) mix->weights[i];
+                }
+                counts[i]++;
+                switch (i)
+                {
+                        case BENCH_LINE:
+                                bench_generate_line (entities, &state);
+                                break;
+                        case BENCH_CIRCLE:
+                                bench_generate_circle (entities, &state);
+                                break;
+                        case BENCH_ARC:
+                                bench_generate_arc (entities, &state);
+                                break;
+                        case BENCH_ELLIPSE:
+                                bench_generate_ellipse (entities, &state);
+                                break;
+                        case BENCH_POINT:
+                                bench_generate_point (entities, &state);
+                                break;
+                        case BENCH_LWPOLYLINE:
+                                bench_generate_lwpolyline (entities, &state);
+                                break;
+                        case BENCH_TEXT:
+                                bench_generate_text (entities, &state, n);
+                                break;
+                        case BENCH_MTEXT:
+                                bench_generate_mtext (entities, &state, n);
+                                break;
+                        case BENCH_INSERT:
+                                bench_generate_insert (entities, &state);
+                                break;
+                        case BENCH_SPLINE:
+                                bench_generate_spline (entities, &state);
+                                break;
+                        case BENCH_HATCH:
+                                bench_generate_hatch (entities, &state);
+                                break;
+                }
+        }
+        return (drawing);
+}
+
+
+/*!
+ * \brief Free a generated drawing.
+ *
+ * dxf_drawing_free () frees the entity lists node by node, clearing the
+ * next member of every node first, the node destructors refuse linked
+ * nodes.
+ */
+void
+bench_free
+(
+        DxfDrawing *drawing
+)
+{
+        if (drawing == NULL)
+        {
+                return;
+        }
+        dxf_drawing_free (drawing);
+}
+
+
+/* EOF */
@@ -0,0 +1,94 @@
+/*!
+ * \file generator.h
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Prototypes for a deterministic generator of synthetic DXF drawings.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_BENCH_GENERATOR_H
+#define LIBDXF_BENCH_GENERATOR_H
+
+
+#include "src/dxf.h"
+
+
+#define BENCH_BLOCK_NAME "BENCH_BLOCK"
+        /*!< \brief Name of the block definition referenced by the
+         * generated \c INSERT entities. */
+
+
+/*!
+ * \brief Entity types the generator can emit.
+ */
+typedef enum
+bench_entity_type
+{
+        BENCH_LINE,
+        BENCH_CIRCLE,
+        BENCH_ARC,
+        BENCH_ELLIPSE,
+        BENCH_POINT,
+        BENCH_LWPOLYLINE,
+        BENCH_TEXT,
+        BENCH_MTEXT,
+        BENCH_INSERT,
+        BENCH_SPLINE,
+        BENCH_HATCH,
+        BENCH_NUMBER_OF_ENTITY_TYPES
+} BenchEntityType;
+
+
+/*!
+ * \brief Definition of an entity mix, the relative weight of every
+ * entity type.
+ */
+typedef struct
+bench_mix_struct
+{
+        int weights[BENCH_NUMBER_OF_ENTITY_TYPES];
+                /*!< Relative weight of every entity type, 0 to leave
+                 * a type out. */
+} BenchMix;
+
+
+extern const char *bench_entity_type_names[BENCH_NUMBER_OF_ENTITY_TYPES];
+
+
+void bench_mix_default (BenchMix *mix);
+int bench_mix_parse (BenchMix *mix, const char *spec);
+int bench_mix_to_string (const BenchMix *mix, char *buffer, size_t size);
+DxfDrawing *bench_generate (const BenchMix *mix, long number_of_entities, unsigned long seed, int acad_version_number, long counts[BENCH_NUMBER_OF_ENTITY_TYPES]);
+void bench_free (DxfDrawing *drawing);
+
+
+#endif /* LIBDXF_BENCH_GENERATOR_H */
+
+
+/* EOF */
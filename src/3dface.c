@@ -56,7 +56,7 @@
 Dxf3dface *
 dxf_3dface_new ()
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         Dxf3dface *face = NULL;
@@ -65,7 +65,7 @@ dxf_3dface_new ()
         size = sizeof (Dxf3dface);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((face = malloc (size)) == NULL)
+        if ((face = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -76,7 +76,7 @@ dxf_3dface_new ()
         {
                 memset (face, 0, size);
         }
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_END
 #endif
         return (face);
@@ -100,28 +100,28 @@ dxf_3dface_init
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 face = dxf_3dface_new ();
         }
         if (face == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         /* Assign initial values to members. */
         face->id_code = 0;
-        face->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        face->layer = strdup (DXF_DEFAULT_LAYER);
+        face->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        face->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         face->elevation = 0.0;
         face->thickness = 0.0;
         face->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -130,14 +130,14 @@ dxf_3dface_init
         face->paperspace = DXF_MODELSPACE;
         face->graphics_data_size = 0;
         face->shadow_mode = 0;
-        face->dictionary_owner_soft = strdup ("");
-        face->object_owner_soft = strdup ("");
-        face->material = strdup ("");
-        face->dictionary_owner_hard = strdup ("");
+        face->dictionary_owner_soft = dxf_strdup ("");
+        face->object_owner_soft = dxf_strdup ("");
+        face->material = dxf_strdup ("");
+        face->dictionary_owner_hard = dxf_strdup ("");
         face->lineweight = 0;
-        face->plot_style_name = strdup ("");
+        face->plot_style_name = dxf_strdup ("");
         face->color_value = 0;
-        face->color_name = strdup ("");
+        face->color_name = dxf_strdup ("");
         face->transparency = 0;
         face->flag = 0;
         /* Initialize new structs for the following members later,
@@ -148,7 +148,7 @@ dxf_3dface_init
         face->p2 = NULL;
         face->p3 = NULL;
         face->next = NULL;
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_END
 #endif
         return (face);
@@ -178,41 +178,40 @@ dxf_3dface_read
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
         int iter330;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (face == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 face = dxf_3dface_init (face);
         }
         if (face->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfBinaryData struct.\n")));
                 face->binary_graphics_data = dxf_binary_data_init (face->binary_graphics_data);
                 if (face->binary_graphics_data == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -220,15 +219,15 @@ dxf_3dface_read
         }
         if (face->p0 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 face->p0 = dxf_point_init (face->p0);
                 if (face->p0 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -236,15 +235,15 @@ dxf_3dface_read
         }
         if (face->p1 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 face->p1 = dxf_point_init (face->p1);
                 if (face->p1 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -252,15 +251,15 @@ dxf_3dface_read
         }
         if (face->p2 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 face->p2 = dxf_point_init (face->p2);
                 if (face->p2 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -268,21 +267,20 @@ dxf_3dface_read
         }
         if (face->p3 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 face->p3 = dxf_point_init (face->p3);
                 if (face->p3 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
                 }
         }
-        iter310 = (DxfBinaryData *) face->binary_graphics_data;
         iter330 = 0;
         (fp->line_number)++;
         fscanf (fp->fp, "%[^\n]", temp_string);
@@ -290,11 +288,11 @@ dxf_3dface_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -467,7 +465,7 @@ dxf_3dface_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && (strcmp (temp_string, "AcDbFace") != 0))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -491,9 +489,8 @@ dxf_3dface_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_data_append_hex ((DxfBinaryData *) face->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -570,22 +567,23 @@ dxf_3dface_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (face->linetype, "") == 0)
         {
-                face->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                face->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (face->layer, "") == 0)
         {
-                face->layer = strdup (DXF_DEFAULT_LAYER);
+                face->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -608,49 +606,49 @@ dxf_3dface_write
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("3DFACE");
+        char *dxf_entity_name = dxf_strdup ("3DFACE");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (face == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((strcmp (face->layer, "") == 0) || (face->layer == NULL))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () invalid layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, face->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                face->layer = strdup (DXF_DEFAULT_LAYER);
+                face->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (face->linetype == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () invalid linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, face->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s linetype is set to %s\n")),
                   dxf_entity_name, DXF_DEFAULT_LINETYPE);
-                face->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                face->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -740,16 +738,7 @@ dxf_3dface_write
 #else
                 fprintf (fp->fp, " 92\n%" PRIi32 "\n", face->graphics_data_size);
 #endif
-                if (face->binary_graphics_data != NULL)
-                {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) face->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
-                }
+                dxf_binary_data_write (fp, (DxfBinaryData *) face->binary_graphics_data);
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
@@ -792,8 +781,8 @@ dxf_3dface_write
         }
         fprintf (fp->fp, " 70\n%hd\n", face->flag);
         /* Clean up. */
-        free (dxf_entity_name);
-#ifdef DEBUG
+        dxf_free (dxf_entity_name);
+#if DEBUG
         DXF_DEBUG_END
 #endif
         return (EXIT_SUCCESS);
@@ -818,39 +807,39 @@ dxf_3dface_free
                  * \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (face == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (face->next != NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next was not NULL.\n")),
                 __FUNCTION__);
               return (face);
         }
-        free (face->linetype);
-        free (face->layer);
+        dxf_free (face->linetype);
+        dxf_free (face->layer);
         dxf_binary_data_free_list (face->binary_graphics_data);
-        free (face->dictionary_owner_soft);
-        free (face->object_owner_soft);
-        free (face->material);
-        free (face->dictionary_owner_hard);
-        free (face->plot_style_name);
-        free (face->color_name);
+        dxf_free (face->dictionary_owner_soft);
+        dxf_free (face->object_owner_soft);
+        dxf_free (face->material);
+        dxf_free (face->dictionary_owner_hard);
+        dxf_free (face->plot_style_name);
+        dxf_free (face->color_name);
         dxf_point_free_list (face->p0);
         dxf_point_free_list (face->p1);
         dxf_point_free_list (face->p2);
         dxf_point_free_list (face->p3);
-        free (face);
+        dxf_free (face);
         face = NULL;
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_END
 #endif
         return (face);
@@ -872,18 +861,19 @@ dxf_3dface_free_list
                  * \c 3DFACE entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (faces == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (faces != NULL)
         {
                 Dxf3dface *iter = (Dxf3dface *) faces->next;
+                faces->next = NULL;
                 dxf_3dface_free (faces);
                 faces = (Dxf3dface *) iter;
         }
@@ -1014,7 +1004,7 @@ dxf_3dface_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (face->linetype));
+        return (dxf_strdup (face->linetype));
 }
 
 
@@ -1057,7 +1047,7 @@ dxf_3dface_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        face->linetype = strdup (linetype);
+        face->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1102,7 +1092,7 @@ dxf_3dface_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (face->layer));
+        return (dxf_strdup (face->layer));
 }
 
 
@@ -1144,7 +1134,7 @@ dxf_3dface_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        face->layer = strdup (layer);
+        face->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1974,7 +1964,7 @@ dxf_3dface_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (face->dictionary_owner_soft));
+        return (dxf_strdup (face->dictionary_owner_soft));
 }
 
 
@@ -2013,7 +2003,7 @@ dxf_3dface_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        face->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        face->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2060,7 +2050,7 @@ dxf_3dface_get_object_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (face->object_owner_soft));
+        return (dxf_strdup (face->object_owner_soft));
 }
 
 
@@ -2099,7 +2089,7 @@ dxf_3dface_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        face->object_owner_soft = strdup (object_owner_soft);
+        face->object_owner_soft = dxf_strdup (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2146,7 +2136,7 @@ dxf_3dface_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (face->material));
+        return (dxf_strdup (face->material));
 }
 
 
@@ -2187,7 +2177,7 @@ dxf_3dface_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        face->material = strdup (material);
+        face->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2234,7 +2224,7 @@ dxf_3dface_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (face->dictionary_owner_hard));
+        return (dxf_strdup (face->dictionary_owner_hard));
 }
 
 
@@ -2276,7 +2266,7 @@ dxf_3dface_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        face->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        face->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2392,7 +2382,7 @@ dxf_3dface_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (face->plot_style_name));
+        return (dxf_strdup (face->plot_style_name));
 }
 
 
@@ -2433,7 +2423,7 @@ dxf_3dface_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        face->plot_style_name = strdup (plot_style_name);
+        face->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2549,7 +2539,7 @@ dxf_3dface_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (face->color_name));
+        return (dxf_strdup (face->color_name));
 }
 
 
@@ -2590,7 +2580,7 @@ dxf_3dface_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        face->color_name = strdup (color_name);
+        face->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2684,7 +2674,7 @@ dxf_3dface_get_p0
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2727,7 +2717,7 @@ dxf_3dface_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2769,7 +2759,7 @@ dxf_3dface_get_x0
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2815,7 +2805,7 @@ dxf_3dface_set_x0
                  * \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2866,7 +2856,7 @@ dxf_3dface_get_y0
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2912,7 +2902,7 @@ dxf_3dface_set_y0
                  * \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2963,7 +2953,7 @@ dxf_3dface_get_z0
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3009,7 +2999,7 @@ dxf_3dface_set_z0
                  * \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3059,7 +3049,7 @@ dxf_3dface_get_p1
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3102,7 +3092,7 @@ dxf_3dface_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3144,7 +3134,7 @@ dxf_3dface_get_x1
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3190,7 +3180,7 @@ dxf_3dface_set_x1
                  * DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3241,7 +3231,7 @@ dxf_3dface_get_y1
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3287,7 +3277,7 @@ dxf_3dface_set_y1
                  * DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3338,7 +3328,7 @@ dxf_3dface_get_z1
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3384,7 +3374,7 @@ dxf_3dface_set_z1
                  * DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3434,7 +3424,7 @@ dxf_3dface_get_p2
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3477,7 +3467,7 @@ dxf_3dface_set_p2
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3519,7 +3509,7 @@ dxf_3dface_get_x2
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3565,7 +3555,7 @@ dxf_3dface_set_x2
                  * a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3616,7 +3606,7 @@ dxf_3dface_get_y2
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3662,7 +3652,7 @@ dxf_3dface_set_y2
                  * a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3713,7 +3703,7 @@ dxf_3dface_get_z2
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3759,7 +3749,7 @@ dxf_3dface_set_z2
                  * a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3809,7 +3799,7 @@ dxf_3dface_get_p3
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3852,7 +3842,7 @@ dxf_3dface_set_p3
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3894,7 +3884,7 @@ dxf_3dface_get_x3
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3940,7 +3930,7 @@ dxf_3dface_set_x3
                  * DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3991,7 +3981,7 @@ dxf_3dface_get_y3
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4037,7 +4027,7 @@ dxf_3dface_set_y3
                  * DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4088,7 +4078,7 @@ dxf_3dface_get_z3
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4134,7 +4124,7 @@ dxf_3dface_set_z3
                  * DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4434,7 +4424,7 @@ dxf_3dface_create_from_points
                  */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         Dxf3dface *face = NULL;
@@ -4535,7 +4525,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->linetype = strdup (p0->linetype);
+                                face->linetype = dxf_strdup (p0->linetype);
                         }
                         if (p0->layer == NULL)
                         {
@@ -4545,7 +4535,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->layer = strdup (p0->layer);
+                                face->layer = dxf_strdup (p0->layer);
                         }
                         face->elevation = p0->elevation;
                         face->thickness = p0->thickness;
@@ -4564,7 +4554,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->dictionary_owner_soft = strdup (p0->dictionary_owner_soft);
+                                face->dictionary_owner_soft = dxf_strdup (p0->dictionary_owner_soft);
                         }
                         if (p0->object_owner_soft == NULL)
                         {
@@ -4574,7 +4564,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->object_owner_soft = strdup (p0->object_owner_soft);
+                                face->object_owner_soft = dxf_strdup (p0->object_owner_soft);
                         }
                         if (p0->material == NULL)
                         {
@@ -4584,7 +4574,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->material = strdup (p0->material);
+                                face->material = dxf_strdup (p0->material);
                         }
                         if (p0->dictionary_owner_hard == NULL)
                         {
@@ -4594,7 +4584,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->dictionary_owner_hard = strdup (p0->dictionary_owner_hard);
+                                face->dictionary_owner_hard = dxf_strdup (p0->dictionary_owner_hard);
                         }
                         face->lineweight = p0->lineweight;
                         if (p0->plot_style_name == NULL)
@@ -4605,7 +4595,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->plot_style_name = strdup (p0->plot_style_name);
+                                face->plot_style_name = dxf_strdup (p0->plot_style_name);
                         }
                         face->color_value = p0->color_value;
                         if (p0->color_name == NULL)
@@ -4616,7 +4606,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->color_name = strdup (p0->color_name);
+                                face->color_name = dxf_strdup (p0->color_name);
                         }
                         face->transparency = p0->transparency;
                         break;
@@ -4636,7 +4626,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->linetype = strdup (p1->linetype);
+                                face->linetype = dxf_strdup (p1->linetype);
                         }
                         if (p1->layer == NULL)
                         {
@@ -4646,7 +4636,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->layer = strdup (p1->layer);
+                                face->layer = dxf_strdup (p1->layer);
                         }
                         face->elevation = p1->elevation;
                         face->thickness = p1->thickness;
@@ -4665,7 +4655,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->dictionary_owner_soft = strdup (p1->dictionary_owner_soft);
+                                face->dictionary_owner_soft = dxf_strdup (p1->dictionary_owner_soft);
                         }
                         if (p1->object_owner_soft == NULL)
                         {
@@ -4675,7 +4665,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->object_owner_soft = strdup (p1->object_owner_soft);
+                                face->object_owner_soft = dxf_strdup (p1->object_owner_soft);
                         }
                         if (p1->material == NULL)
                         {
@@ -4685,7 +4675,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->material = strdup (p1->material);
+                                face->material = dxf_strdup (p1->material);
                         }
                         if (p1->dictionary_owner_hard == NULL)
                         {
@@ -4695,7 +4685,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->dictionary_owner_hard = strdup (p1->dictionary_owner_hard);
+                                face->dictionary_owner_hard = dxf_strdup (p1->dictionary_owner_hard);
                         }
                         face->lineweight = p1->lineweight;
                         if (p1->plot_style_name == NULL)
@@ -4706,7 +4696,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->plot_style_name = strdup (p1->plot_style_name);
+                                face->plot_style_name = dxf_strdup (p1->plot_style_name);
                         }
                         face->color_value = p1->color_value;
                         if (p1->color_name == NULL)
@@ -4717,7 +4707,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->color_name = strdup (p1->color_name);
+                                face->color_name = dxf_strdup (p1->color_name);
                         }
                         face->transparency = p1->transparency;
                         break;
@@ -4737,7 +4727,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->linetype = strdup (p2->linetype);
+                                face->linetype = dxf_strdup (p2->linetype);
                         }
                         if (p2->layer == NULL)
                         {
@@ -4747,7 +4737,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->layer = strdup (p2->layer);
+                                face->layer = dxf_strdup (p2->layer);
                         }
                         face->elevation = p2->elevation;
                         face->thickness = p2->thickness;
@@ -4766,7 +4756,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->dictionary_owner_soft = strdup (p2->dictionary_owner_soft);
+                                face->dictionary_owner_soft = dxf_strdup (p2->dictionary_owner_soft);
                         }
                         if (p2->object_owner_soft == NULL)
                         {
@@ -4776,7 +4766,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->object_owner_soft = strdup (p2->object_owner_soft);
+                                face->object_owner_soft = dxf_strdup (p2->object_owner_soft);
                         }
                         if (p2->material == NULL)
                         {
@@ -4786,7 +4776,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->material = strdup (p2->material);
+                                face->material = dxf_strdup (p2->material);
                         }
                         if (p2->dictionary_owner_hard == NULL)
                         {
@@ -4796,7 +4786,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->dictionary_owner_hard = strdup (p2->dictionary_owner_hard);
+                                face->dictionary_owner_hard = dxf_strdup (p2->dictionary_owner_hard);
                         }
                         face->lineweight = p2->lineweight;
                         if (p2->plot_style_name == NULL)
@@ -4807,7 +4797,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->plot_style_name = strdup (p2->plot_style_name);
+                                face->plot_style_name = dxf_strdup (p2->plot_style_name);
                         }
                         face->color_value = p2->color_value;
                         if (p2->color_name == NULL)
@@ -4818,7 +4808,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->color_name = strdup (p2->color_name);
+                                face->color_name = dxf_strdup (p2->color_name);
                         }
                         face->transparency = p2->transparency;
                         break;
@@ -4838,7 +4828,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->linetype = strdup (p3->linetype);
+                                face->linetype = dxf_strdup (p3->linetype);
                         }
                         if (p3->layer == NULL)
                         {
@@ -4848,7 +4838,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->layer = strdup (p3->layer);
+                                face->layer = dxf_strdup (p3->layer);
                         }
                         face->elevation = p3->elevation;
                         face->thickness = p3->thickness;
@@ -4867,7 +4857,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->dictionary_owner_soft = strdup (p3->dictionary_owner_soft);
+                                face->dictionary_owner_soft = dxf_strdup (p3->dictionary_owner_soft);
                         }
                         if (p3->object_owner_soft == NULL)
                         {
@@ -4877,7 +4867,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->object_owner_soft = strdup (p3->object_owner_soft);
+                                face->object_owner_soft = dxf_strdup (p3->object_owner_soft);
                         }
                         if (p3->material == NULL)
                         {
@@ -4887,7 +4877,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->material = strdup (p3->material);
+                                face->material = dxf_strdup (p3->material);
                         }
                         if (p3->dictionary_owner_hard == NULL)
                         {
@@ -4897,7 +4887,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->dictionary_owner_hard = strdup (p3->dictionary_owner_hard);
+                                face->dictionary_owner_hard = dxf_strdup (p3->dictionary_owner_hard);
                         }
                         face->lineweight = p3->lineweight;
                         if (p3->plot_style_name == NULL)
@@ -4908,7 +4898,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->plot_style_name = strdup (p3->plot_style_name);
+                                face->plot_style_name = dxf_strdup (p3->plot_style_name);
                         }
                         face->color_value = p3->color_value;
                         if (p3->color_name == NULL)
@@ -4919,7 +4909,7 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->color_name = strdup (p3->color_name);
+                                face->color_name = dxf_strdup (p3->color_name);
                         }
                         face->transparency = p3->transparency;
                         break;
@@ -68,7 +68,7 @@ dxf_3dline_new ()
         size = sizeof (Dxf3dline);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((line = malloc (size)) == NULL)
+        if ((line = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -109,22 +109,22 @@ dxf_3dline_init
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 line = dxf_3dline_new ();
         }
         if (line == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         /* Assign initial values to members. */
         line->id_code = 0;
-        line->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        line->layer = strdup (DXF_DEFAULT_LAYER);
+        line->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        line->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         line->elevation = 0.0;
         line->thickness = 0.0;
         line->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -133,14 +133,14 @@ dxf_3dline_init
         line->paperspace = DXF_MODELSPACE;
         line->graphics_data_size = 0;
         line->shadow_mode = 0;
-        line->dictionary_owner_soft = strdup ("");
-        line->object_owner_soft = strdup ("");
-        line->material = strdup ("");
-        line->dictionary_owner_hard = strdup ("");
+        line->dictionary_owner_soft = dxf_strdup ("");
+        line->object_owner_soft = dxf_strdup ("");
+        line->material = dxf_strdup ("");
+        line->dictionary_owner_hard = dxf_strdup ("");
         line->lineweight = 0;
-        line->plot_style_name = strdup ("");
+        line->plot_style_name = dxf_strdup ("");
         line->color_value = 0;
-        line->color_name = strdup ("");
+        line->color_name = dxf_strdup ("");
         line->transparency = 0;
         line->extr_x0 = 0.0;
         line->extr_y0 = 0.0;
@@ -185,37 +185,36 @@ dxf_3dline_read
         DXF_DEBUG_BEGIN
 #endif
         char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
         int iter330;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (line == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 line = dxf_3dline_init (line);
         }
         if (line->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfBinaryData struct.\n")));
                 line->binary_graphics_data = dxf_binary_data_init (line->binary_graphics_data);
                 if (line->binary_graphics_data == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -223,15 +222,15 @@ dxf_3dline_read
         }
         if (line->p0 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 line->p0 = dxf_point_init (line->p0);
                 if (line->p0 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -239,21 +238,20 @@ dxf_3dline_read
         }
         if (line->p1 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 line->p1 = dxf_point_init (line->p1);
                 if (line->p1 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
                 }
         }
-        iter310 = (DxfBinaryData *) line->binary_graphics_data;
         iter330 = 0;
         (fp->line_number)++;
         fscanf (fp->fp, "%[^\n]", temp_string);
@@ -261,12 +259,12 @@ dxf_3dline_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -389,7 +387,7 @@ dxf_3dline_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbLine") != 0)))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -434,9 +432,8 @@ dxf_3dline_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_data_append_hex ((DxfBinaryData *) line->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -513,22 +510,23 @@ dxf_3dline_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (line->linetype, "") == 0)
         {
-                line->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                line->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (line->layer, "") == 0)
         {
-                line->layer = strdup (DXF_DEFAULT_LAYER);
+                line->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -558,62 +556,62 @@ dxf_3dline_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("3DLINE");
+        char *dxf_entity_name = dxf_strdup ("3DLINE");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (line == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((line->p0->x0 == line->p1->x0)
                 && (line->p0->y0 == line->p1->y0)
                 && (line->p0->z0 == line->p1->z0))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () start point and end point are identical for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, line->id_code);
                 dxf_entity_skip (dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((strcmp (line->layer, "") == 0) || (line->layer == NULL))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () invalid layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, line->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                line->layer = strdup (DXF_DEFAULT_LAYER);
+                line->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (line->linetype == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () invalid linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, line->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s linetype is set to %s\n")),
                   dxf_entity_name, DXF_DEFAULT_LINETYPE);
-                line->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                line->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (fp->acad_version_number > AutoCAD_11)
         {
-                dxf_entity_name = strdup ("LINE");
+                dxf_entity_name = dxf_strdup ("LINE");
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -700,16 +698,7 @@ dxf_3dline_write
 #else
                 fprintf (fp->fp, " 92\n%" PRIi32 "\n", line->graphics_data_size);
 #endif
-                if (line->binary_graphics_data != NULL)
-                {
-                        DxfBinaryData *iter310;
-                        iter310 = (DxfBinaryData *) line->binary_graphics_data;
-                        while (iter310 != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter310->data_line);
-                                iter310 = (DxfBinaryData *) iter310->next;
-                        }
-                }
+                dxf_binary_data_write (fp, (DxfBinaryData *) line->binary_graphics_data);
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
@@ -746,7 +735,7 @@ dxf_3dline_write
                 fprintf (fp->fp, "230\n%f\n", dxf_3dline_get_extr_z0 (line));
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -777,30 +766,30 @@ dxf_3dline_free
 #endif
         if (line == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
         if (line->next != NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (line->linetype);
-        free (line->layer);
+        dxf_free (line->linetype);
+        dxf_free (line->layer);
         dxf_binary_data_free_list (line->binary_graphics_data);
-        free (line->dictionary_owner_soft);
-        free (line->object_owner_soft);
-        free (line->material);
-        free (line->dictionary_owner_hard);
-        free (line->plot_style_name);
-        free (line->color_name);
+        dxf_free (line->dictionary_owner_soft);
+        dxf_free (line->object_owner_soft);
+        dxf_free (line->material);
+        dxf_free (line->dictionary_owner_hard);
+        dxf_free (line->plot_style_name);
+        dxf_free (line->color_name);
         dxf_point_free_list (line->p0);
         dxf_point_free_list (line->p1);
-        free (line);
+        dxf_free (line);
         line = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -824,18 +813,19 @@ dxf_3dline_free_list
                  * \c 3DLINE entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (lines == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (lines != NULL)
         {
                 Dxf3dline *iter = (Dxf3dline *) lines->next;
+                lines->next = NULL;
                 dxf_3dline_free (lines);
                 lines = (Dxf3dline *) iter;
         }
@@ -959,7 +949,7 @@ dxf_3dline_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->linetype));
+        return (dxf_strdup (line->linetype));
 }
 
 
@@ -993,7 +983,7 @@ dxf_3dline_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        line->linetype = strdup (linetype);
+        line->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1037,7 +1027,7 @@ dxf_3dline_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->layer));
+        return (dxf_strdup (line->layer));
 }
 
 
@@ -1071,7 +1061,7 @@ dxf_3dline_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        line->layer = strdup (layer);
+        line->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1860,7 +1850,7 @@ dxf_3dline_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->dictionary_owner_soft));
+        return (dxf_strdup (line->dictionary_owner_soft));
 }
 
 
@@ -1896,7 +1886,7 @@ dxf_3dline_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        line->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        line->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1943,7 +1933,7 @@ dxf_3dline_get_object_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->object_owner_soft));
+        return (dxf_strdup (line->object_owner_soft));
 }
 
 
@@ -1979,7 +1969,7 @@ dxf_3dline_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        line->object_owner_soft = strdup (object_owner_soft);
+        line->object_owner_soft = dxf_strdup (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2026,7 +2016,7 @@ dxf_3dline_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->material));
+        return (dxf_strdup (line->material));
 }
 
 
@@ -2064,7 +2054,7 @@ dxf_3dline_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        line->material = strdup (material);
+        line->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2111,7 +2101,7 @@ dxf_3dline_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->dictionary_owner_hard));
+        return (dxf_strdup (line->dictionary_owner_hard));
 }
 
 
@@ -2147,7 +2137,7 @@ dxf_3dline_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        line->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        line->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2257,7 +2247,7 @@ dxf_3dline_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->plot_style_name));
+        return (dxf_strdup (line->plot_style_name));
 }
 
 
@@ -2295,7 +2285,7 @@ dxf_3dline_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        line->plot_style_name = strdup (plot_style_name);
+        line->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2408,7 +2398,7 @@ dxf_3dline_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->color_name));
+        return (dxf_strdup (line->color_name));
 }
 
 
@@ -2446,7 +2436,7 @@ dxf_3dline_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        line->color_name = strdup (color_name);
+        line->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2534,7 +2524,7 @@ dxf_3dline_get_p0
                 /*!< a pointer to a DXF \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2573,7 +2563,7 @@ dxf_3dline_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2614,7 +2604,7 @@ dxf_3dline_get_x0
                 /*!< a pointer to a DXF \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2655,7 +2645,7 @@ dxf_3dline_set_x0
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2705,7 +2695,7 @@ dxf_3dline_get_y0
                 /*!< a pointer to a DXF \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2746,7 +2736,7 @@ dxf_3dline_set_y0
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2796,7 +2786,7 @@ dxf_3dline_get_z0
                 /*!< a pointer to a DXF \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2837,7 +2827,7 @@ dxf_3dline_set_z0
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2887,7 +2877,7 @@ dxf_3dline_get_p1
                 /*!< a pointer to a DXF \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2934,7 +2924,7 @@ dxf_3dline_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2975,7 +2965,7 @@ dxf_3dline_get_x1
                 /*!< a pointer to a DXF \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3016,7 +3006,7 @@ dxf_3dline_set_x1
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3066,7 +3056,7 @@ dxf_3dline_get_y1
                 /*!< a pointer to a DXF \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3107,7 +3097,7 @@ dxf_3dline_set_y1
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3157,7 +3147,7 @@ dxf_3dline_get_z1
                 /*!< a pointer to a DXF \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3198,7 +3188,7 @@ dxf_3dline_set_z1
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3246,7 +3236,7 @@ dxf_3dline_get_extr_x0
                 /*!< a pointer to a DXF \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3282,7 +3272,7 @@ dxf_3dline_set_extr_x0
                  * \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3314,7 +3304,7 @@ dxf_3dline_get_extr_y0
                 /*!< a pointer to a DXF \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3350,7 +3340,7 @@ dxf_3dline_set_extr_y0
                  * \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3382,7 +3372,7 @@ dxf_3dline_get_extr_z0
                 /*!< a pointer to a DXF \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3418,7 +3408,7 @@ dxf_3dline_set_extr_z0
                  * \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3452,7 +3442,7 @@ dxf_3dline_get_extrusion_vector_as_point
                 /*!< a pointer to a DXF \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *point = NULL;
@@ -3594,7 +3584,7 @@ dxf_3dline_get_mid_point
                  */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *point = NULL;
@@ -3642,11 +3632,11 @@ dxf_3dline_get_mid_point
                 case 1:
                         if (line->linetype != NULL)
                         {
-                                point->linetype = strdup (line->linetype);
+                                point->linetype = dxf_strdup (line->linetype);
                         }
                         if (line->layer != NULL)
                         {
-                                point->layer = strdup (line->layer);
+                                point->layer = dxf_strdup (line->layer);
                         }
                         point->elevation = line->elevation;
                         point->thickness = line->thickness;
@@ -3659,29 +3649,29 @@ dxf_3dline_get_mid_point
                         /*! \todo Add binary_graphics_data. */
                         if (line->dictionary_owner_soft != NULL)
                         {
-                                point->dictionary_owner_soft = strdup (line->dictionary_owner_soft);
+                                point->dictionary_owner_soft = dxf_strdup (line->dictionary_owner_soft);
                         }
                         if (line->object_owner_soft != NULL)
                         {
-                                point->object_owner_soft = strdup (line->object_owner_soft);
+                                point->object_owner_soft = dxf_strdup (line->object_owner_soft);
                         }
                         if (line->material != NULL)
                         {
-                                point->material = strdup (line->material);
+                                point->material = dxf_strdup (line->material);
                         }
                         if (line->dictionary_owner_hard != NULL)
                         {
-                                point->dictionary_owner_hard = strdup (line->dictionary_owner_hard);
+                                point->dictionary_owner_hard = dxf_strdup (line->dictionary_owner_hard);
                         }
                         point->lineweight = line->lineweight;
                         if (line->plot_style_name != NULL)
                         {
-                                point->plot_style_name = strdup (line->plot_style_name);
+                                point->plot_style_name = dxf_strdup (line->plot_style_name);
                         }
                         point->color_value = line->color_value;
                         if (line->color_name != NULL)
                         {
-                                point->color_name = strdup (line->color_name);
+                                point->color_name = dxf_strdup (line->color_name);
                         }
                         point->transparency = line->transparency;
                         break;
@@ -3713,7 +3703,7 @@ dxf_3dline_get_length
                 /*!< a pointer to a DXF \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3865,7 +3855,7 @@ dxf_3dline_create_from_points
                         }
                         else
                         {
-                                line->dictionary_owner_soft = strdup (p0->dictionary_owner_soft);
+                                line->dictionary_owner_soft = dxf_strdup (p0->dictionary_owner_soft);
                         }
                         if (p0->object_owner_soft == NULL)
                         {
@@ -3875,7 +3865,7 @@ dxf_3dline_create_from_points
                         }
                         else
                         {
-                                line->object_owner_soft = strdup (p0->object_owner_soft);
+                                line->object_owner_soft = dxf_strdup (p0->object_owner_soft);
                         }
                         if (p0->material == NULL)
                         {
@@ -3885,7 +3875,7 @@ dxf_3dline_create_from_points
                         }
                         else
                         {
-                                line->material = strdup (p0->material);
+                                line->material = dxf_strdup (p0->material);
                         }
                         if (p0->dictionary_owner_hard == NULL)
                         {
@@ -3895,7 +3885,7 @@ dxf_3dline_create_from_points
                         }
                         else
                         {
-                                line->dictionary_owner_hard = strdup (p0->dictionary_owner_hard);
+                                line->dictionary_owner_hard = dxf_strdup (p0->dictionary_owner_hard);
                         }
                         line->lineweight = p0->lineweight;
                         if (p0->plot_style_name == NULL)
@@ -3906,7 +3896,7 @@ dxf_3dline_create_from_points
                         }
                         else
                         {
-                                line->plot_style_name = strdup (p0->plot_style_name);
+                                line->plot_style_name = dxf_strdup (p0->plot_style_name);
                         }
                         line->color_value = p0->color_value;
                         if (p0->color_name == NULL)
@@ -3917,7 +3907,7 @@ dxf_3dline_create_from_points
                         }
                         else
                         {
-                                line->color_name = strdup (p0->color_name);
+                                line->color_name = dxf_strdup (p0->color_name);
                         }
                         line->transparency = p0->transparency;
                         break;
@@ -3959,7 +3949,7 @@ dxf_3dline_create_from_points
                         }
                         else
                         {
-                                line->dictionary_owner_soft = strdup (p1->dictionary_owner_soft);
+                                line->dictionary_owner_soft = dxf_strdup (p1->dictionary_owner_soft);
                         }
                         if (p1->object_owner_soft == NULL)
                         {
@@ -3969,7 +3959,7 @@ dxf_3dline_create_from_points
                         }
                         else
                         {
-                                line->object_owner_soft = strdup (p1->object_owner_soft);
+                                line->object_owner_soft = dxf_strdup (p1->object_owner_soft);
                         }
                         if (p1->material == NULL)
                         {
@@ -3979,7 +3969,7 @@ dxf_3dline_create_from_points
                         }
                         else
                         {
-                                line->material = strdup (p1->material);
+                                line->material = dxf_strdup (p1->material);
                         }
                         if (p1->dictionary_owner_hard == NULL)
                         {
@@ -3989,7 +3979,7 @@ dxf_3dline_create_from_points
                         }
                         else
                         {
-                                line->dictionary_owner_hard = strdup (p1->dictionary_owner_hard);
+                                line->dictionary_owner_hard = dxf_strdup (p1->dictionary_owner_hard);
                         }
                         line->lineweight = p1->lineweight;
                         if (p1->plot_style_name == NULL)
@@ -4000,7 +3990,7 @@ dxf_3dline_create_from_points
                         }
                         else
                         {
-                                line->plot_style_name = strdup (p1->plot_style_name);
+                                line->plot_style_name = dxf_strdup (p1->plot_style_name);
                         }
                         line->color_value = p1->color_value;
                         if (p1->color_name == NULL)
@@ -4011,7 +4001,7 @@ dxf_3dline_create_from_points
                         }
                         else
                         {
-                                line->color_name = strdup (p1->color_name);
+                                line->color_name = dxf_strdup (p1->color_name);
                         }
                         line->transparency = p1->transparency;
                         break;
@@ -49,6 +49,7 @@
 
 
 #include "3dsolid.h"
+#include "util.h"
 
 
 /*!
@@ -68,7 +69,7 @@ dxf_3dsolid_new ()
         size = sizeof (Dxf3dsolid);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((solid = malloc (size)) == NULL)
+        if ((solid = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -106,22 +107,22 @@ dxf_3dsolid_init
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 solid = dxf_3dsolid_new ();
         }
         if (solid == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         /* Assign initial values to members. */
         solid->id_code = 0;
-        solid->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        solid->layer = strdup (DXF_DEFAULT_LAYER);
+        solid->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        solid->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         solid->elevation = 0.0;
         solid->thickness = 0.0;
         solid->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -130,22 +131,23 @@ dxf_3dsolid_init
         solid->paperspace = DXF_MODELSPACE;
         solid->graphics_data_size = 0;
         solid->shadow_mode = 0;
-        solid->dictionary_owner_soft = strdup ("");
-        solid->object_owner_soft = strdup ("");
-        solid->material = strdup ("");
-        solid->dictionary_owner_hard = strdup ("");
+        solid->dictionary_owner_soft = dxf_strdup ("");
+        solid->object_owner_soft = dxf_strdup ("");
+        solid->material = dxf_strdup ("");
+        solid->dictionary_owner_hard = dxf_strdup ("");
         solid->lineweight = 0;
-        solid->plot_style_name = strdup ("");
+        solid->plot_style_name = dxf_strdup ("");
         solid->color_value = 0;
-        solid->color_name = strdup ("");
+        solid->color_name = dxf_strdup ("");
         solid->transparency = 0;
         solid->modeler_format_version_number = 1;
-        solid->history = strdup ("");
+        solid->history = dxf_strdup ("");
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         solid->binary_graphics_data = NULL;
         solid->proprietary_data = NULL;
         solid->additional_proprietary_data = NULL;
+        solid->acis = NULL;
         solid->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -177,77 +179,71 @@ dxf_3dsolid_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int iter330;
 
-        int i;
-
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (solid == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 solid = dxf_3dsolid_init (solid);
         }
-        iter310 = (DxfBinaryData *) solid->binary_graphics_data;
-        i = 1;
-        solid->proprietary_data->order = 0;
-        solid->additional_proprietary_data->order = 0;
+        if (solid->binary_graphics_data == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
+                  (_("Initializing a DxfBinaryData struct.\n")));
+                solid->binary_graphics_data = dxf_binary_data_init (solid->binary_graphics_data);
+                if (solid->binary_graphics_data == NULL)
+                {
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        memset (temp_string, 0, sizeof (temp_string));
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
-                else if (strcmp (temp_string, "  1") == 0)
+                else if ((strcmp (temp_string, "1") == 0)
+                  || (strcmp (temp_string, "3") == 0))
                 {
                         /* Now follows a string containing proprietary
-                         * data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->proprietary_data->data_line);
-                        solid->proprietary_data->order = i;
-                        i++;
-                        dxf_binary_data_init ((DxfBinaryData *) solid->proprietary_data->next);
-                        solid->proprietary_data = (DxfBinaryData *) solid->proprietary_data->next;
-                }
-                else if (strcmp (temp_string, "  3") == 0)
-                {
-                        /* Now follows a string containing additional
-                         * proprietary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->additional_proprietary_data->data_line);
-                        solid->additional_proprietary_data->order = i;
-                        i++;
-                        dxf_binary_data_init ((DxfBinaryData *) solid->additional_proprietary_data->next);
-                        solid->additional_proprietary_data = (DxfBinaryData *) solid->additional_proprietary_data->next;
+                         * data, or additional proprietary data. */
+                        if (solid->acis == NULL)
+                        {
+                                solid->acis = dxf_acis_init (dxf_acis_new ());
+                        }
+                        dxf_acis_read (fp, solid->acis, atoi (temp_string), temp_string);
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -259,13 +255,17 @@ dxf_3dsolid_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->linetype);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (solid->linetype);
+                        solid->linetype = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->layer);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (solid->layer);
+                        solid->layer = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "38") == 0)
                 {
@@ -329,10 +329,11 @@ dxf_3dsolid_read
                          * subclass marker value. */
                         (fp->line_number)++;
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbModelerGeometry") != 0)
-                          || (strcmp (temp_string, "AcDb3dSolid") != 0))
+                        if ((strcmp (temp_string, "AcDbEntity") != 0)
+                          && (strcmp (temp_string, "AcDbModelerGeometry") != 0)
+                          && (strcmp (temp_string, "AcDb3dSolid") != 0))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -356,9 +357,8 @@ dxf_3dsolid_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_data_append_hex ((DxfBinaryData *) solid->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -367,14 +367,18 @@ dxf_3dsolid_read
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
                                 (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->dictionary_owner_soft);
+                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                                dxf_free (solid->dictionary_owner_soft);
+                                solid->dictionary_owner_soft = dxf_strdup (temp_string);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
                                 (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->object_owner_soft);
+                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                                dxf_free (solid->object_owner_soft);
+                                solid->object_owner_soft = dxf_strdup (temp_string);
                         }
                         iter330++;
                 }
@@ -383,21 +387,27 @@ dxf_3dsolid_read
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->material);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (solid->material);
+                        solid->material = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "350") == 0)
                 {
                         /* Now follows a string containing a handle to a
                          * history object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->history);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (solid->history);
+                        solid->history = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->dictionary_owner_hard);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (solid->dictionary_owner_hard);
+                        solid->dictionary_owner_hard = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -411,7 +421,9 @@ dxf_3dsolid_read
                         /* Now follows a string containing a plot style
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->plot_style_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (solid->plot_style_name);
+                        solid->plot_style_name = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -424,7 +436,9 @@ dxf_3dsolid_read
                         /* Now follows a string containing a color
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->color_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (solid->color_name);
+                        solid->color_name = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -442,22 +456,23 @@ dxf_3dsolid_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
+                        dxf_read_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (solid->linetype, "") == 0)
         {
-                solid->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                solid->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (solid->layer, "") == 0)
         {
-                solid->layer = strdup (DXF_DEFAULT_LAYER);
+                solid->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -483,7 +498,7 @@ dxf_3dsolid_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("3DSOLID");
+        char *dxf_entity_name = dxf_strdup ("3DSOLID");
         DxfBinaryData *iter = NULL;
         DxfBinaryData *additional_iter = NULL;
         int i;
@@ -491,47 +506,47 @@ dxf_3dsolid_write
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (solid == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, solid->id_code);
         }
         if (strcmp (solid->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, solid->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                solid->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                solid->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (solid->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, solid->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                solid->layer = strdup (DXF_DEFAULT_LAYER);
+                solid->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         i = 1;
@@ -620,16 +635,7 @@ dxf_3dsolid_write
 #else
                 fprintf (fp->fp, " 92\n%" PRIi32 "\n", solid->graphics_data_size);
 #endif
-                if (solid->binary_graphics_data != NULL)
-                {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) solid->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
-                }
+                dxf_binary_data_write (fp, (DxfBinaryData *) solid->binary_graphics_data);
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
@@ -654,7 +660,11 @@ dxf_3dsolid_write
         {
                 fprintf (fp->fp, " 70\n%hd\n", solid->modeler_format_version_number);
         }
-        if ((solid->proprietary_data != NULL) || (solid->additional_proprietary_data != NULL))
+        if (solid->acis != NULL)
+        {
+                dxf_acis_write (fp, solid->acis);
+        }
+        else if ((solid->proprietary_data != NULL) || (solid->additional_proprietary_data != NULL))
         {
                 iter = (DxfBinaryData *) solid->proprietary_data;
                 additional_iter = (DxfBinaryData *) solid->additional_proprietary_data;
@@ -676,7 +686,7 @@ dxf_3dsolid_write
         }
         else
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () no proprietary data found in the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, solid->id_code);
         }
@@ -685,7 +695,7 @@ dxf_3dsolid_write
                 fprintf (fp->fp, "350\n%s\n", solid->history);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -714,31 +724,35 @@ dxf_3dsolid_free
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (solid->next != NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (solid->linetype);
-        free (solid->layer);
+        dxf_free (solid->linetype);
+        dxf_free (solid->layer);
         dxf_binary_data_free_list (solid->binary_graphics_data);
-        free (solid->dictionary_owner_soft);
-        free (solid->object_owner_soft);
-        free (solid->material);
-        free (solid->dictionary_owner_hard);
-        free (solid->plot_style_name);
-        free (solid->color_name);
+        dxf_free (solid->dictionary_owner_soft);
+        dxf_free (solid->object_owner_soft);
+        dxf_free (solid->material);
+        dxf_free (solid->dictionary_owner_hard);
+        dxf_free (solid->plot_style_name);
+        dxf_free (solid->color_name);
         dxf_binary_data_free_list (solid->proprietary_data);
         dxf_binary_data_free_list (solid->additional_proprietary_data);
-        free (solid->history);
-        free (solid);
+        if (solid->acis != NULL)
+        {
+                dxf_acis_free (solid->acis);
+        }
+        dxf_free (solid->history);
+        dxf_free (solid);
         solid = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -759,18 +773,19 @@ dxf_3dsolid_free_list
                  * \c 3DSOLID entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (solids == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (solids != NULL)
         {
                 Dxf3dsolid *iter = (Dxf3dsolid *) solids->next;
+                solids->next = NULL;
                 dxf_3dsolid_free (solids);
                 solids = (Dxf3dsolid *) iter;
         }
@@ -888,7 +903,7 @@ dxf_3dsolid_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->linetype));
+        return (dxf_strdup (solid->linetype));
 }
 
 
@@ -922,7 +937,7 @@ dxf_3dsolid_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->linetype = strdup (linetype);
+        solid->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -963,7 +978,7 @@ dxf_3dsolid_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->layer));
+        return (dxf_strdup (solid->layer));
 }
 
 
@@ -997,7 +1012,7 @@ dxf_3dsolid_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->layer = strdup (layer);
+        solid->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1753,7 +1768,7 @@ dxf_3dsolid_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->dictionary_owner_soft));
+        return (dxf_strdup (solid->dictionary_owner_soft));
 }
 
 
@@ -1789,7 +1804,7 @@ dxf_3dsolid_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        solid->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1833,7 +1848,7 @@ dxf_3dsolid_get_object_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->object_owner_soft));
+        return (dxf_strdup (solid->object_owner_soft));
 }
 
 
@@ -1869,7 +1884,7 @@ dxf_3dsolid_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->object_owner_soft = strdup (object_owner_soft);
+        solid->object_owner_soft = dxf_strdup (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1914,7 +1929,7 @@ dxf_3dsolid_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->material));
+        return (dxf_strdup (solid->material));
 }
 
 
@@ -1952,7 +1967,7 @@ dxf_3dsolid_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->material = strdup (material);
+        solid->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1996,7 +2011,7 @@ dxf_3dsolid_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->dictionary_owner_hard));
+        return (dxf_strdup (solid->dictionary_owner_hard));
 }
 
 
@@ -2032,7 +2047,7 @@ dxf_3dsolid_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        solid->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2139,7 +2154,7 @@ dxf_3dsolid_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->plot_style_name));
+        return (dxf_strdup (solid->plot_style_name));
 }
 
 
@@ -2177,7 +2192,7 @@ dxf_3dsolid_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->plot_style_name = strdup (plot_style_name);
+        solid->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2284,7 +2299,7 @@ dxf_3dsolid_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->color_name));
+        return (dxf_strdup (solid->color_name));
 }
 
 
@@ -2322,7 +2337,7 @@ dxf_3dsolid_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->color_name = strdup (color_name);
+        solid->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2584,6 +2599,78 @@ dxf_3dsolid_set_additional_proprietary_data
 }
 
 
+/*!
+ * \brief Get the ACIS proprietary data from a DXF \c 3DSOLID entity.
+ *
+ * \return a pointer to the ACIS proprietary data, or \c NULL when the
+ * entity holds none or when an error occurred.
+ */
+DxfAcis *
+dxf_3dsolid_get_acis
+(
+        Dxf3dsolid *solid
+                /*!< a pointer to a DXF \c 3DSOLID entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (solid == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (solid->acis);
+}
+
+
+/*!
+ * \brief Set the ACIS proprietary data for a DXF \c 3DSOLID entity.
+ *
+ * The entity takes ownership of \c acis, ACIS proprietary data held
+ * before is freed.
+ *
+ * \return a pointer to \c solid, or \c NULL when an error occurred.
+ */
+Dxf3dsolid *
+dxf_3dsolid_set_acis
+(
+        Dxf3dsolid *solid,
+                /*!< a pointer to a DXF \c 3DSOLID entity. */
+        DxfAcis *acis
+                /*!< a pointer to the ACIS proprietary data, or
+                 * \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (solid == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((solid->acis != NULL) && (solid->acis != acis))
+        {
+                dxf_acis_free (solid->acis);
+        }
+        solid->acis = acis;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (solid);
+}
+
+
 /*!
  * \brief Get the modeler format version number from a DXF \c 3DSOLID
  * entity.
@@ -2707,7 +2794,7 @@ dxf_3dsolid_get_history
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->history));
+        return (dxf_strdup (solid->history));
 }
 
 
@@ -2741,7 +2828,7 @@ dxf_3dsolid_set_history
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->history = strdup (history);
+        solid->history = dxf_strdup (history);
 #if DEBUG
         DXF_DEBUG_END
 #endif
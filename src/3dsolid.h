@@ -46,6 +46,7 @@
 
 
 #include "global.h"
+#include "acis.h"
 #include "binary_data.h"
 
 
@@ -198,6 +199,12 @@ dxf_3dsolid_struct
                  * group 1 string is greater than 255 characters
                  * (optional).\n
                  * Group code = 3. */
+        DxfAcis *acis;
+                /*!< Proprietary data (group codes 1 and 3) as read with
+                 * the ACIS mode of the DXF file, see
+                 * dxf_file_set_acis_mode ().\n
+                 * Written instead of \c proprietary_data and
+                 * \c additional_proprietary_data when not \c NULL. */
         int16_t modeler_format_version_number;
                 /*!< Modeler format version number (currently = 1).\n
                  * Group code = 70. */
@@ -263,6 +270,8 @@ DxfBinaryData *dxf_3dsolid_get_proprietary_data (Dxf3dsolid *solid);
 Dxf3dsolid *dxf_3dsolid_set_proprietary_data (Dxf3dsolid *solid, DxfBinaryData *proprietary_data);
 DxfBinaryData *dxf_3dsolid_get_additional_proprietary_data (Dxf3dsolid *solid);
 Dxf3dsolid *dxf_3dsolid_set_additional_proprietary_data (Dxf3dsolid *solid, DxfBinaryData *additional_proprietary_data);
+DxfAcis *dxf_3dsolid_get_acis (Dxf3dsolid *solid);
+Dxf3dsolid *dxf_3dsolid_set_acis (Dxf3dsolid *solid, DxfAcis *acis);
 int16_t dxf_3dsolid_get_modeler_format_version_number (Dxf3dsolid *solid);
 Dxf3dsolid *dxf_3dsolid_set_modeler_format_version_number (Dxf3dsolid *solid, int16_t modeler_format_version_number);
 char *dxf_3dsolid_get_history (Dxf3dsolid *solid);
@@ -75,7 +75,7 @@ dxf_acad_proxy_entity_new ()
         size = sizeof (DxfAcadProxyEntity);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((acad_proxy_entity = malloc (size)) == NULL)
+        if ((acad_proxy_entity = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -113,22 +113,22 @@ dxf_acad_proxy_entity_init
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 acad_proxy_entity = dxf_acad_proxy_entity_new ();
         }
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         /* Assign initial values to members. */
         acad_proxy_entity->id_code = 0;
-        acad_proxy_entity->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        acad_proxy_entity->layer = strdup (DXF_DEFAULT_LAYER);
+        acad_proxy_entity->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        acad_proxy_entity->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         acad_proxy_entity->elevation = 0.0;
         acad_proxy_entity->thickness = 0.0;
         acad_proxy_entity->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -136,14 +136,14 @@ dxf_acad_proxy_entity_init
         acad_proxy_entity->color = DXF_COLOR_BYLAYER;
         acad_proxy_entity->paperspace = DXF_PAPERSPACE;
         acad_proxy_entity->shadow_mode = 0;
-        acad_proxy_entity->dictionary_owner_soft = strdup ("");
-        acad_proxy_entity->object_owner_soft = strdup ("");
-        acad_proxy_entity->material = strdup ("");
-        acad_proxy_entity->dictionary_owner_hard = strdup ("");
+        acad_proxy_entity->dictionary_owner_soft = dxf_strdup ("");
+        acad_proxy_entity->object_owner_soft = dxf_strdup ("");
+        acad_proxy_entity->material = dxf_strdup ("");
+        acad_proxy_entity->dictionary_owner_hard = dxf_strdup ("");
         acad_proxy_entity->lineweight = 0;
-        acad_proxy_entity->plot_style_name = strdup ("");
+        acad_proxy_entity->plot_style_name = dxf_strdup ("");
         acad_proxy_entity->color_value = 0;
-        acad_proxy_entity->color_name = strdup ("");
+        acad_proxy_entity->color_name = dxf_strdup ("");
         acad_proxy_entity->transparency = 0;
         acad_proxy_entity->original_custom_object_data_format = 1;
         acad_proxy_entity->proxy_entity_class_id = DXF_DEFAULT_PROXY_ENTITY_ID;
@@ -152,7 +152,7 @@ dxf_acad_proxy_entity_init
         acad_proxy_entity->entity_data_size = 0;
         acad_proxy_entity->object_drawing_format = 0;
         acad_proxy_entity->object_id->group_code = 0;
-        acad_proxy_entity->object_id->data = strdup ("");
+        acad_proxy_entity->object_id->data = dxf_strdup ("");
         acad_proxy_entity->object_id->length = 0;
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
@@ -192,7 +192,6 @@ dxf_acad_proxy_entity_read
         DXF_DEBUG_BEGIN
 #endif
         char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
         int iter330;
         int i; /* flags whether group code 330, 340, 350 or 360 has been
                 * parsed for a first time. */
@@ -200,37 +199,37 @@ dxf_acad_proxy_entity_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (!acad_proxy_entity)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 acad_proxy_entity = dxf_acad_proxy_entity_init (acad_proxy_entity);
         }
         if (acad_proxy_entity->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfBinaryData struct.\n")));
                 acad_proxy_entity->binary_graphics_data = dxf_binary_data_init (acad_proxy_entity->binary_graphics_data);
                 if (acad_proxy_entity->binary_graphics_data == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -238,21 +237,20 @@ dxf_acad_proxy_entity_read
         }
         if (acad_proxy_entity->binary_entity_data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfBinaryData struct.\n")));
                 acad_proxy_entity->binary_entity_data = dxf_binary_data_init (acad_proxy_entity->binary_entity_data);
                 if (acad_proxy_entity->binary_entity_data == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
                 }
         }
-        iter310 = (DxfBinaryData *) acad_proxy_entity->binary_graphics_data;
         iter330 = 0;
         i = 0;
         (fp->line_number)++;
@@ -261,11 +259,11 @@ dxf_acad_proxy_entity_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -337,7 +335,7 @@ dxf_acad_proxy_entity_read
                         fscanf (fp->fp, "%hd\n", &acad_proxy_entity->original_custom_object_data_format);
                         if (acad_proxy_entity->original_custom_object_data_format != 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () found a bad original custom object data format value in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -350,7 +348,7 @@ dxf_acad_proxy_entity_read
                         fscanf (fp->fp, "%" PRIi32 "\n", &acad_proxy_entity->proxy_entity_class_id);
                         if (acad_proxy_entity->proxy_entity_class_id != DXF_DEFAULT_PROXY_ENTITY_ID)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad proxy entity class ID in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -363,7 +361,7 @@ dxf_acad_proxy_entity_read
                         fscanf (fp->fp, "%" PRIi32 "\n", &acad_proxy_entity->application_entity_class_id);
                         if (acad_proxy_entity->application_entity_class_id < 500)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad value in application entity class ID in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -401,7 +399,7 @@ dxf_acad_proxy_entity_read
                           && ((strcmp (temp_string, "AcDbZombieEntity") != 0))
                           && ((strcmp (temp_string, "AcDbProxyEntity") != 0)))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -418,9 +416,8 @@ dxf_acad_proxy_entity_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_data_append_hex ((DxfBinaryData *) acad_proxy_entity->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -520,15 +517,16 @@ dxf_acad_proxy_entity_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
-        fprintf (stderr,
+        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
           (_("Information from %s() read %d object_id's from %s.\n")),
           __FUNCTION__, i, fp->filename);
         DXF_DEBUG_END
@@ -560,69 +558,69 @@ dxf_acad_proxy_entity_write
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
                 if (fp->follow_strict_version_rules)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () illegal DXF version for this entity.\n")),
                           __FUNCTION__);
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                           (_("\t entity %s with ID code %d is omitted from output.\n")),
                           dxf_entity_name, acad_proxy_entity->id_code);
                         return (EXIT_FAILURE);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () illegal DXF version for this entity.\n")),
                           __FUNCTION__);
                 }
         }
         if (fp->acad_version_number <= AutoCAD_13)
         {
-                dxf_entity_name = strdup ("ACAD_ZOMBIE_ENTITY");
+                dxf_entity_name = dxf_strdup ("ACAD_ZOMBIE_ENTITY");
         }
         else if (fp->acad_version_number >= AutoCAD_14)
         {
-                dxf_entity_name = strdup ("ACAD_PROXY_ENTITY");
+                dxf_entity_name = dxf_strdup ("ACAD_PROXY_ENTITY");
         }
         if ((strcmp (acad_proxy_entity->layer, "") == 0)
           || (acad_proxy_entity->layer == NULL))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () invalid layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, acad_proxy_entity->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                acad_proxy_entity->layer = strdup (DXF_DEFAULT_LAYER);
+                acad_proxy_entity->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (acad_proxy_entity->linetype == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () invalid linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, acad_proxy_entity->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s linetype is set to %s\n")),
                   dxf_entity_name, DXF_DEFAULT_LINETYPE);
-                acad_proxy_entity->linetype = strdup(DXF_DEFAULT_LINETYPE);
+                acad_proxy_entity->linetype = dxf_strdup(DXF_DEFAULT_LINETYPE);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -730,27 +728,9 @@ dxf_acad_proxy_entity_write
 #else
                 fprintf (fp->fp, " 92\n%" PRIi32 "\n", acad_proxy_entity->graphics_data_size);
 #endif
-                if (acad_proxy_entity->binary_graphics_data != NULL)
-                {
-                        DxfBinaryData *iter310a;
-                        iter310a = (DxfBinaryData *) acad_proxy_entity->binary_graphics_data;
-                        while (iter310a != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter310a->data_line);
-                                iter310a = (DxfBinaryData *) iter310a->next;
-                        }
-                }
+                dxf_binary_data_write (fp, (DxfBinaryData *) acad_proxy_entity->binary_graphics_data);
                 fprintf (fp->fp, " 93\n%" PRIi32 "\n", acad_proxy_entity->entity_data_size);
-                if (acad_proxy_entity->binary_entity_data != NULL)
-                {
-                        DxfBinaryData *iter310b;
-                        iter310b = (DxfBinaryData *) acad_proxy_entity->binary_entity_data;
-                        while (iter310b != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter310b->data_line);
-                                iter310b = (DxfBinaryData *) iter310b->next;
-                        }
-                }
+                dxf_binary_data_write (fp, (DxfBinaryData *) acad_proxy_entity->binary_entity_data);
         }
         DxfObjectId *iter330;
         iter330 = (DxfObjectId *) acad_proxy_entity->object_id;
@@ -769,7 +749,7 @@ dxf_acad_proxy_entity_write
                 fprintf (fp->fp, " 70\n%hd\n", acad_proxy_entity->original_custom_object_data_format);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -797,30 +777,30 @@ dxf_acad_proxy_entity_free
 #endif
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (acad_proxy_entity->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (acad_proxy_entity->linetype);
-        free (acad_proxy_entity->layer);
-        free (acad_proxy_entity->dictionary_owner_soft);
-        free (acad_proxy_entity->object_owner_soft);
-        free (acad_proxy_entity->material);
-        free (acad_proxy_entity->dictionary_owner_hard);
-        free (acad_proxy_entity->plot_style_name);
-        free (acad_proxy_entity->color_name);
+        dxf_free (acad_proxy_entity->linetype);
+        dxf_free (acad_proxy_entity->layer);
+        dxf_free (acad_proxy_entity->dictionary_owner_soft);
+        dxf_free (acad_proxy_entity->object_owner_soft);
+        dxf_free (acad_proxy_entity->material);
+        dxf_free (acad_proxy_entity->dictionary_owner_hard);
+        dxf_free (acad_proxy_entity->plot_style_name);
+        dxf_free (acad_proxy_entity->color_name);
         dxf_binary_data_free_list (acad_proxy_entity->binary_graphics_data);
         dxf_binary_data_free_list (acad_proxy_entity->binary_entity_data);
         dxf_object_id_free_list (acad_proxy_entity->object_id);
-        free (acad_proxy_entity);
+        dxf_free (acad_proxy_entity);
         acad_proxy_entity = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -841,18 +821,19 @@ dxf_acad_proxy_entity_free_list
                  * \c ACAD_PROXY_ENTITY entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (acad_proxy_entities == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (acad_proxy_entities != NULL)
         {
                 DxfAcadProxyEntity *iter = (DxfAcadProxyEntity *) acad_proxy_entities->next;
+                acad_proxy_entities->next = NULL;
                 dxf_acad_proxy_entity_free (acad_proxy_entities);
                 acad_proxy_entities = (DxfAcadProxyEntity *) iter;
         }
@@ -970,7 +951,7 @@ dxf_acad_proxy_entity_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->linetype));
+        return (dxf_strdup (acad_proxy_entity->linetype));
 }
 
 
@@ -1004,7 +985,7 @@ dxf_acad_proxy_entity_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->linetype = strdup (linetype);
+        acad_proxy_entity->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1045,7 +1026,7 @@ dxf_acad_proxy_entity_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->layer));
+        return (dxf_strdup (acad_proxy_entity->layer));
 }
 
 
@@ -1079,7 +1060,7 @@ dxf_acad_proxy_entity_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->layer = strdup (layer);
+        acad_proxy_entity->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1671,7 +1652,7 @@ dxf_acad_proxy_entity_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->dictionary_owner_soft));
+        return (dxf_strdup (acad_proxy_entity->dictionary_owner_soft));
 }
 
 
@@ -1707,7 +1688,7 @@ dxf_acad_proxy_entity_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        acad_proxy_entity->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1751,7 +1732,7 @@ dxf_acad_proxy_entity_get_object_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->object_owner_soft));
+        return (dxf_strdup (acad_proxy_entity->object_owner_soft));
 }
 
 
@@ -1787,7 +1768,7 @@ dxf_acad_proxy_entity_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->object_owner_soft = strdup (object_owner_soft);
+        acad_proxy_entity->object_owner_soft = dxf_strdup (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1831,7 +1812,7 @@ dxf_acad_proxy_entity_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->material));
+        return (dxf_strdup (acad_proxy_entity->material));
 }
 
 
@@ -1870,7 +1851,7 @@ dxf_acad_proxy_entity_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->material = strdup (material);
+        acad_proxy_entity->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1914,7 +1895,7 @@ dxf_acad_proxy_entity_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->dictionary_owner_hard));
+        return (dxf_strdup (acad_proxy_entity->dictionary_owner_hard));
 }
 
 
@@ -1950,7 +1931,7 @@ dxf_acad_proxy_entity_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        acad_proxy_entity->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2058,7 +2039,7 @@ dxf_acad_proxy_entity_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->plot_style_name));
+        return (dxf_strdup (acad_proxy_entity->plot_style_name));
 }
 
 
@@ -2096,7 +2077,7 @@ dxf_acad_proxy_entity_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->plot_style_name = strdup (plot_style_name);
+        acad_proxy_entity->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2203,7 +2184,7 @@ dxf_acad_proxy_entity_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->color_name));
+        return (dxf_strdup (acad_proxy_entity->color_name));
 }
 
 
@@ -2241,7 +2222,7 @@ dxf_acad_proxy_entity_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->color_name = strdup (color_name);
+        acad_proxy_entity->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
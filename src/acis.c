@@ -0,0 +1,798 @@
+/*!
+ * \file acis.c
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for the ACIS proprietary data of DXF modeler
+ * geometry entities.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "acis.h"
+#include "util.h"
+
+
+/*!
+ * \brief Maximum number of characters in a group code 1 or 3 line of
+ * proprietary data.
+ */
+#define DXF_ACIS_LINE_LENGTH 255
+
+
+/*!
+ * \brief Decrypt \c length characters of \c text to \c sat.
+ *
+ * Every character \c c other than a space is stored as \c 159 - \c c,
+ * a resulting \c ^ is escaped as \c "^ ".\n
+ * \c sat may be equal to \c text, the decrypted text is never longer
+ * than the encrypted text.
+ *
+ * \return the number of decrypted characters.
+ */
+static size_t
+dxf_acis_decrypt_text
+(
+        const char *text,
+        size_t length,
+        char *sat
+)
+{
+        size_t i;
+        size_t n;
+
+        for (i = 0, n = 0; i < length; i++, n++)
+        {
+                unsigned char c = (unsigned char) text[i];
+
+                if ((c == ' ') || (c == '\n'))
+                {
+                        sat[n] = (char) c;
+                }
+                else
+                {
+                        sat[n] = (char) (159 - c);
+                        if ((c == '^') && (i + 1 < length) && (text[i + 1] == ' '))
+                        {
+                                /* An escaped "^ " holds a single 'A'. */
+                                i++;
+                        }
+                }
+        }
+        return (n);
+}
+
+
+/*!
+ * \brief Encrypt \c length characters of \c sat to \c text.
+ *
+ * \c text must hold up to 2 * \c length characters.
+ *
+ * \return the number of encrypted characters.
+ */
+static size_t
+dxf_acis_encrypt_text
+(
+        const char *sat,
+        size_t length,
+        char *text
+)
+{
+        size_t i;
+        size_t n;
+
+        for (i = 0, n = 0; i < length; i++)
+        {
+                unsigned char c = (unsigned char) sat[i];
+
+                if ((c == ' ') || (c == '\n'))
+                {
+                        text[n++] = (char) c;
+                }
+                else
+                {
+                        text[n++] = (char) (159 - c);
+                        if (text[n - 1] == '^')
+                        {
+                                text[n++] = ' ';
+                        }
+                }
+        }
+        return (n);
+}
+
+
+/*!
+ * \brief Make room for \c length more characters and a terminating nul
+ * in the SAT buffer of \c acis.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_acis_reserve
+(
+        DxfAcis *acis,
+        size_t length
+)
+{
+        size_t needed = acis->size + length + 1;
+        size_t new_capacity;
+        char *sat;
+
+        if (needed <= acis->capacity)
+        {
+                return (EXIT_SUCCESS);
+        }
+        new_capacity = (acis->capacity > 0) ? acis->capacity : 1024;
+        while (new_capacity < needed)
+        {
+                new_capacity *= 2;
+        }
+        sat = dxf_realloc (acis->sat, new_capacity);
+        if (sat == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        acis->sat = sat;
+        acis->capacity = new_capacity;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a group code 1 or 3 line of proprietary data to the SAT
+ * buffer of \c acis.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_acis_append
+(
+        DxfAcis *acis,
+        int group_code,
+        const char *text
+)
+{
+        size_t length = strlen (text);
+
+        if (dxf_acis_reserve (acis, length + 1) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((group_code == 1) && (acis->number_of_lines > 0))
+        {
+                acis->sat[acis->size++] = '\n';
+        }
+        if (acis->decrypted)
+        {
+                acis->size += dxf_acis_decrypt_text (text, length,
+                  acis->sat + acis->size);
+        }
+        else
+        {
+                memcpy (acis->sat + acis->size, text, length);
+                acis->size += length;
+        }
+        acis->sat[acis->size] = '\0';
+        acis->number_of_lines++;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Skip the rest of the current line of \c fp, and the white
+ * space leading the next line, without storing it.
+ */
+static void
+dxf_acis_skip_line
+(
+        DxfFile *fp
+)
+{
+        int c;
+
+        while (((c = getc (fp->fp)) != EOF) && (c != '\n'))
+        {
+        }
+        fp->line_number++;
+        fscanf (fp->fp, "\n");
+}
+
+
+/*!
+ * \brief Allocate memory for a \c DxfAcis.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfAcis *
+dxf_acis_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfAcis *acis = NULL;
+        size_t size;
+
+        size = sizeof (DxfAcis);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((acis = dxf_malloc (size)) == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                acis = NULL;
+        }
+        else
+        {
+                memset (acis, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (acis);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a \c DxfAcis.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfAcis *
+dxf_acis_init
+(
+        DxfAcis *acis
+                /*!< a pointer to the ACIS proprietary data. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (acis == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                acis = dxf_acis_new ();
+        }
+        if (acis == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        acis->sat = NULL;
+        acis->size = 0;
+        acis->capacity = 0;
+        acis->decrypted = FALSE;
+        acis->filename = NULL;
+        acis->offset = 0;
+        acis->end = 0;
+        acis->group_code = 0;
+        acis->number_of_lines = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (acis);
+}
+
+
+/*!
+ * \brief Read a group code 1 or 3 line of proprietary data into
+ * \c acis.
+ *
+ * The group code has been read, the line following it is consumed as
+ * set with dxf_file_set_acis_mode () for \c fp.\n
+ * With \c DXF_ACIS_DEFER the line is skipped and the byte range of the
+ * proprietary data is extended to the end of the line, when \c fp has
+ * no file name the line is loaded instead.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_acis_read
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfAcis *acis,
+                /*!< a pointer to the ACIS proprietary data. */
+        int group_code,
+                /*!< group code of the line, 1 or 3. */
+        char *temp_string
+                /*!< a buffer of \c DXF_MAX_STRING_LENGTH characters
+                 * for the line. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((acis == NULL) || (temp_string == NULL))
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (fp->acis_mode == DXF_ACIS_SKIP)
+        {
+                dxf_acis_skip_line (fp);
+                acis->number_of_lines++;
+                return (EXIT_SUCCESS);
+        }
+        if ((fp->acis_mode == DXF_ACIS_DEFER)
+          && (fp->filename != NULL)
+          && ((acis->filename != NULL) || (acis->number_of_lines == 0)))
+        {
+                if (acis->filename == NULL)
+                {
+                        acis->filename = dxf_strdup (fp->filename);
+                        acis->offset = ftell (fp->fp);
+                        acis->group_code = group_code;
+                }
+                dxf_acis_skip_line (fp);
+                acis->end = ftell (fp->fp);
+                acis->number_of_lines++;
+                return (EXIT_SUCCESS);
+        }
+        if (acis->number_of_lines == 0)
+        {
+                acis->decrypted = (fp->acis_mode == DXF_ACIS_DECRYPT);
+        }
+        dxf_read_line (temp_string, fp);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_acis_append (acis, group_code, temp_string));
+}
+
+
+/*!
+ * \brief Load deferred proprietary data into the SAT buffer of
+ * \c acis.
+ *
+ * The file holding the data is opened and closed again, when nothing
+ * is deferred nothing is done.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_acis_load
+(
+        DxfAcis *acis
+                /*!< a pointer to the ACIS proprietary data. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        DxfFile *fp = NULL;
+        int group_code;
+        int number_of_lines;
+        int result;
+
+        /* Do some basic checks. */
+        if (acis == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (acis->filename == NULL)
+        {
+                return (EXIT_SUCCESS);
+        }
+        fp = dxf_read_init (acis->filename);
+        if (fp == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not open: %s.\n")),
+                  __FUNCTION__, acis->filename);
+                return (EXIT_FAILURE);
+        }
+        if (fseek (fp->fp, acis->offset, SEEK_SET) != 0)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not seek in: %s.\n")),
+                  __FUNCTION__, acis->filename);
+                dxf_read_close (fp);
+                return (EXIT_FAILURE);
+        }
+        /* The lines are counted again while appending. */
+        number_of_lines = acis->number_of_lines;
+        acis->number_of_lines = 0;
+        acis->size = 0;
+        result = EXIT_SUCCESS;
+        memset (temp_string, 0, sizeof (temp_string));
+        dxf_read_line (temp_string, fp);
+        group_code = acis->group_code;
+        while (result == EXIT_SUCCESS)
+        {
+                if ((group_code == 1) || (group_code == 3))
+                {
+                        result = dxf_acis_append (acis, group_code, temp_string);
+                }
+                if ((ftell (fp->fp) >= acis->end) || feof (fp->fp))
+                {
+                        break;
+                }
+                dxf_read_line (temp_string, fp);
+                group_code = atoi (temp_string);
+                dxf_read_line (temp_string, fp);
+        }
+        dxf_read_close (fp);
+        if ((result == EXIT_SUCCESS) && (acis->number_of_lines != number_of_lines))
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
+                  (_("Warning in %s () %d lines of proprietary data were expected, %d lines were found in: %s.\n")),
+                  __FUNCTION__, number_of_lines, acis->number_of_lines,
+                  acis->filename);
+        }
+        if (result == EXIT_SUCCESS)
+        {
+                dxf_free (acis->filename);
+                acis->filename = NULL;
+        }
+        if (acis->sat == NULL)
+        {
+                result = dxf_acis_reserve (acis, 0);
+                if (result == EXIT_SUCCESS)
+                {
+                        acis->sat[0] = '\0';
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Write DXF output to a file for ACIS proprietary data.
+ *
+ * Every line of the SAT buffer is written as a group code 1 line,
+ * continued in group code 3 lines when it holds more than 255
+ * characters.\n
+ * Decrypted text is encrypted again, deferred data is loaded first.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_acis_write
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfAcis *acis
+                /*!< a pointer to the ACIS proprietary data. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char *text = NULL;
+        size_t text_size = 0;
+        const char *line;
+        const char *line_end;
+        size_t length;
+        size_t offset;
+        size_t chunk;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (acis == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_acis_load (acis) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        if (acis->size == 0)
+        {
+                return (EXIT_SUCCESS);
+        }
+        for (line = acis->sat; line != NULL; line = (*line_end == '\n') ? line_end + 1 : NULL)
+        {
+                line_end = strchr (line, '\n');
+                if (line_end == NULL)
+                {
+                        line_end = line + strlen (line);
+                }
+                length = (size_t) (line_end - line);
+                if (acis->decrypted)
+                {
+                        if (2 * length + 1 > text_size)
+                        {
+                                char *buffer = dxf_realloc (text, 2 * length + 1);
+
+                                if (buffer == NULL)
+                                {
+                                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                                          (_("Error in %s () could not allocate memory.\n")),
+                                          __FUNCTION__);
+                                        dxf_free (text);
+                                        return (EXIT_FAILURE);
+                                }
+                                text = buffer;
+                                text_size = 2 * length + 1;
+                        }
+                        length = dxf_acis_encrypt_text (line, length, text);
+                        line = text;
+                }
+                offset = 0;
+                do
+                {
+                        chunk = length - offset;
+                        if (chunk > DXF_ACIS_LINE_LENGTH)
+                        {
+                                chunk = DXF_ACIS_LINE_LENGTH;
+                                /* Keep an escaped "^ " together. */
+                                if (line[offset + chunk - 1] == '^')
+                                {
+                                        chunk--;
+                                }
+                        }
+                        fprintf (fp->fp, "%3d\n%.*s\n", (offset == 0) ? 1 : 3,
+                          (int) chunk, line + offset);
+                        offset += chunk;
+                }
+                while (offset < length);
+        }
+        dxf_free (text);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfAcis and all it's data
+ * fields.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_acis_free
+(
+        DxfAcis *acis
+                /*!< a pointer to the memory occupied by the ACIS
+                 * proprietary data. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (acis == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_free (acis->sat);
+        dxf_free (acis->filename);
+        dxf_free (acis);
+        acis = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the contiguous SAT buffer of \c acis.
+ *
+ * Deferred data is loaded first.\n
+ * The buffer remains owned by \c acis.
+ *
+ * \return a pointer to the nul terminated SAT buffer, or \c NULL when
+ * an error occurred.
+ */
+char *
+dxf_acis_get_sat
+(
+        DxfAcis *acis,
+                /*!< a pointer to the ACIS proprietary data. */
+        size_t *size
+                /*!< a pointer receiving the number of characters in
+                 * the buffer, may be \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (acis == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (dxf_acis_load (acis) != EXIT_SUCCESS)
+        {
+                return (NULL);
+        }
+        if ((acis->sat == NULL) && (dxf_acis_reserve (acis, 0) == EXIT_SUCCESS))
+        {
+                acis->sat[0] = '\0';
+        }
+        if (size != NULL)
+        {
+                *size = acis->size;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (acis->sat);
+}
+
+
+/*!
+ * \brief Test if the proprietary data of \c acis is deferred.
+ *
+ * \return \c TRUE when the data is not loaded yet, \c FALSE otherwise.
+ */
+int
+dxf_acis_is_deferred
+(
+        DxfAcis *acis
+                /*!< a pointer to the ACIS proprietary data. */
+)
+{
+        if (acis == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (FALSE);
+        }
+        return (acis->filename != NULL);
+}
+
+
+/*!
+ * \brief Decrypt the SAT buffer of \c acis in place.
+ *
+ * Deferred data is loaded first, decrypted data is left as is.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_acis_decrypt
+(
+        DxfAcis *acis
+                /*!< a pointer to the ACIS proprietary data. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (dxf_acis_get_sat (acis, NULL) == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        if (!acis->decrypted)
+        {
+                acis->size = dxf_acis_decrypt_text (acis->sat, acis->size,
+                  acis->sat);
+                acis->sat[acis->size] = '\0';
+                acis->decrypted = TRUE;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Encrypt the SAT buffer of \c acis in place.
+ *
+ * Deferred data is loaded first, encrypted data is left as is.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_acis_encrypt
+(
+        DxfAcis *acis
+                /*!< a pointer to the ACIS proprietary data. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char *text = NULL;
+
+        if (dxf_acis_get_sat (acis, NULL) == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        if (acis->decrypted)
+        {
+                text = dxf_malloc (2 * acis->size + 1);
+                if (text == NULL)
+                {
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                acis->size = dxf_acis_encrypt_text (acis->sat, acis->size,
+                  text);
+                text[acis->size] = '\0';
+                dxf_free (acis->sat);
+                acis->sat = text;
+                acis->capacity = 2 * acis->size + 1;
+                acis->decrypted = FALSE;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/* EOF */
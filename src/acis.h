@@ -0,0 +1,106 @@
+/*!
+ * \file acis.h
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for the ACIS proprietary data of DXF modeler geometry entities.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_ACIS_H
+#define LIBDXF_SRC_ACIS_H
+
+
+#include "global.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief DXF definition of the ACIS proprietary data of a \c 3DSOLID,
+ * \c BODY, \c REGION or \c SURFACE entity.
+ *
+ * The group code 1 and 3 lines are kept as one contiguous buffer of SAT
+ * text, a group code 1 line starts a new line of the buffer, a group
+ * code 3 line continues the previous line.\n
+ * With \c DXF_ACIS_DEFER only the byte range of the lines in the file is
+ * recorded and the buffer is loaded on demand by dxf_acis_get_sat ().
+ */
+typedef struct
+dxf_acis_struct
+{
+        char *sat;
+                /*!< Contiguous SAT text, the lines are separated by a
+                 * line feed, \c NULL when not loaded. */
+        size_t size;
+                /*!< Number of characters in \c sat. */
+        size_t capacity;
+                /*!< Allocated size of \c sat. */
+        int decrypted;
+                /*!< \c TRUE when \c sat holds decrypted text, \c FALSE
+                 * when it holds the text as found in the file. */
+        char *filename;
+                /*!< Name of the file holding the deferred data, \c NULL
+                 * when nothing is deferred. */
+        long offset;
+                /*!< Offset of the first proprietary data line in
+                 * \c filename. */
+        long end;
+                /*!< Offset following the last proprietary data line in
+                 * \c filename. */
+        int group_code;
+                /*!< Group code of the first proprietary data line. */
+        int number_of_lines;
+                /*!< Number of group code 1 and 3 lines read. */
+} DxfAcis;
+
+
+DxfAcis *dxf_acis_new ();
+DxfAcis *dxf_acis_init (DxfAcis *acis);
+int dxf_acis_read (DxfFile *fp, DxfAcis *acis, int group_code, char *temp_string);
+int dxf_acis_load (DxfAcis *acis);
+int dxf_acis_write (DxfFile *fp, DxfAcis *acis);
+int dxf_acis_free (DxfAcis *acis);
+char *dxf_acis_get_sat (DxfAcis *acis, size_t *size);
+int dxf_acis_is_deferred (DxfAcis *acis);
+int dxf_acis_decrypt (DxfAcis *acis);
+int dxf_acis_encrypt (DxfAcis *acis);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_ACIS_H */
+
+
+/* EOF */
@@ -0,0 +1,232 @@
+/*!
+ * \file allocator.c
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for the memory allocator used by libDXF.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "global.h"
+
+
+/*!
+ * \brief The allocator used for all allocations by libDXF.
+ *
+ * All members are \c NULL for the C library allocator.
+ */
+static struct
+{
+        DxfAllocFunction alloc;
+        DxfReallocFunction realloc;
+        DxfFreeFunction free;
+        void *user;
+} dxf_allocator = {NULL, NULL, NULL, NULL};
+
+
+/*!
+ * \brief Set the allocator used for all allocations by libDXF.
+ *
+ * Every allocation of libDXF, entities, lists and strings alike, is
+ * made with \c alloc or \c realloc and released with \c free, \c user
+ * is passed to every call.\n
+ * Pass \c NULL for all three functions to return to the C library
+ * allocator.\n
+ * The allocator is global and has to be set before any libDXF data is
+ * allocated, memory is always released with the allocator it was
+ * allocated with.\n
+ * Strings handed over to libDXF, for instance to the \c dxf_*_set_*
+ * functions, have to be allocated with dxf_strdup () or dxf_malloc ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_set_allocator
+(
+        DxfAllocFunction alloc,
+                /*!< function to allocate memory. */
+        DxfReallocFunction realloc,
+                /*!< function to resize memory. */
+        DxfFreeFunction free,
+                /*!< function to release memory. */
+        void *user
+                /*!< user data passed to the functions. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (((alloc == NULL) || (realloc == NULL) || (free == NULL))
+          && ((alloc != NULL) || (realloc != NULL) || (free != NULL)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_allocator.alloc = alloc;
+        dxf_allocator.realloc = realloc;
+        dxf_allocator.free = free;
+        dxf_allocator.user = user;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate memory with the libDXF allocator.
+ *
+ * \return a pointer to the allocated memory, or \c NULL when out of
+ * memory.
+ */
+void *
+dxf_malloc
+(
+        size_t size
+                /*!< number of bytes. */
+)
+{
+        if (dxf_allocator.alloc == NULL)
+        {
+                return (malloc (size));
+        }
+        return (dxf_allocator.alloc (size, dxf_allocator.user));
+}
+
+
+/*!
+ * \brief Allocate memory filled with zeros with the libDXF allocator.
+ *
+ * \return a pointer to the allocated memory, or \c NULL when out of
+ * memory.
+ */
+void *
+dxf_calloc
+(
+        size_t number_of_members,
+                /*!< number of members. */
+        size_t size
+                /*!< number of bytes of a member. */
+)
+{
+        void *pointer = NULL;
+
+        if (dxf_allocator.alloc == NULL)
+        {
+                return (calloc (number_of_members, size));
+        }
+        if ((size != 0) && (number_of_members > SIZE_MAX / size))
+        {
+                return (NULL);
+        }
+        pointer = dxf_allocator.alloc (number_of_members * size,
+          dxf_allocator.user);
+        if (pointer != NULL)
+        {
+                memset (pointer, 0, number_of_members * size);
+        }
+        return (pointer);
+}
+
+
+/*!
+ * \brief Resize memory with the libDXF allocator.
+ *
+ * \return a pointer to the resized memory, or \c NULL when out of
+ * memory, the memory at \c pointer is left alone then.
+ */
+void *
+dxf_realloc
+(
+        void *pointer,
+                /*!< memory to resize, \c NULL for new memory. */
+        size_t size
+                /*!< number of bytes. */
+)
+{
+        if (dxf_allocator.realloc == NULL)
+        {
+                return (realloc (pointer, size));
+        }
+        return (dxf_allocator.realloc (pointer, size, dxf_allocator.user));
+}
+
+
+/*!
+ * \brief Duplicate a string with the libDXF allocator.
+ *
+ * \return a pointer to the copy, or \c NULL when out of memory.
+ */
+char *
+dxf_strdup
+(
+        const char *string
+                /*!< string to copy. */
+)
+{
+        char *copy = NULL;
+        size_t size;
+
+        size = strlen (string) + 1;
+        copy = dxf_malloc (size);
+        if (copy != NULL)
+        {
+                memcpy (copy, string, size);
+        }
+        return (copy);
+}
+
+
+/*!
+ * \brief Release memory allocated with the libDXF allocator.
+ */
+void
+dxf_free
+(
+        void *pointer
+                /*!< memory to release, \c NULL is allowed. */
+)
+{
+        if (pointer == NULL)
+        {
+                return;
+        }
+        if (dxf_allocator.free == NULL)
+        {
+                free (pointer);
+                return;
+        }
+        dxf_allocator.free (pointer, dxf_allocator.user);
+}
+
+
+/* EOF */
@@ -0,0 +1,73 @@
+/*!
+ * \file allocator.h
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Definition of the memory allocator used by libDXF.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_ALLOCATOR_H
+#define LIBDXF_SRC_ALLOCATOR_H
+
+
+#include <stddef.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+typedef void *(*DxfAllocFunction) (size_t size, void *user);
+        /*!< \brief Allocate \c size bytes, returns \c NULL when out of
+         * memory. */
+typedef void *(*DxfReallocFunction) (void *pointer, size_t size, void *user);
+        /*!< \brief Resize the memory at \c pointer (\c NULL for new
+         * memory) to \c size bytes, returns \c NULL when out of memory. */
+typedef void (*DxfFreeFunction) (void *pointer, void *user);
+        /*!< \brief Free the memory at \c pointer, never \c NULL. */
+
+
+int dxf_set_allocator (DxfAllocFunction alloc, DxfReallocFunction realloc, DxfFreeFunction free, void *user);
+void *dxf_malloc (size_t size);
+void *dxf_calloc (size_t number_of_members, size_t size);
+void *dxf_realloc (void *pointer, size_t size);
+char *dxf_strdup (const char *string);
+void dxf_free (void *pointer);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_ALLOCATOR_H */
+
+
+/* EOF */
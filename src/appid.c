@@ -76,7 +76,7 @@ dxf_appid_new ()
         size = sizeof (DxfAppid);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((appid = malloc (size)) == NULL)
+        if ((appid = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -114,24 +114,24 @@ dxf_appid_init
         /* Do some basic checks. */
         if (appid == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 appid = dxf_appid_new ();
         }
         if (appid == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         appid->id_code = 0;
-        appid->application_name = strdup ("");
+        appid->application_name = dxf_strdup ("");
         appid->flag = 0;
-        appid->dictionary_owner_soft = strdup ("");
-        appid->object_owner_soft = strdup ("");
-        appid->dictionary_owner_hard = strdup ("");
+        appid->dictionary_owner_soft = dxf_strdup ("");
+        appid->object_owner_soft = dxf_strdup ("");
+        appid->dictionary_owner_hard = dxf_strdup ("");
         appid->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -170,16 +170,16 @@ dxf_appid_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (appid == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 appid = dxf_appid_init (appid);
@@ -191,12 +191,12 @@ dxf_appid_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -254,13 +254,14 @@ dxf_appid_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -284,43 +285,43 @@ dxf_appid_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("APPID");
+        char *dxf_entity_name = dxf_strdup ("APPID");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (appid == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((appid->application_name == NULL)
           || (strcmp (appid->application_name, "") == 0))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s empty block name string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, appid->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is discarded from output.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_12)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
@@ -367,7 +368,7 @@ dxf_appid_write
         fprintf (fp->fp, "  2\n%s\n", appid->application_name);
         fprintf (fp->fp, " 70\n%hd\n", appid->flag);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -394,23 +395,23 @@ dxf_appid_free
 #endif
         if (appid == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (appid->next != NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (appid->application_name);
-        free (appid->dictionary_owner_soft);
-        free (appid->object_owner_soft);
-        free (appid->dictionary_owner_hard);
-        free (appid);
+        dxf_free (appid->application_name);
+        dxf_free (appid->dictionary_owner_soft);
+        dxf_free (appid->object_owner_soft);
+        dxf_free (appid->dictionary_owner_hard);
+        dxf_free (appid);
         appid = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -431,18 +432,19 @@ dxf_appid_free_list
                  * \c APPID symbol table entries. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (appids == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (appids != NULL)
         {
                 DxfAppid *iter = (DxfAppid *) appids->next;
+                appids->next = NULL;
                 dxf_appid_free (appids);
                 appids = (DxfAppid *) iter;
         }
@@ -561,7 +563,7 @@ dxf_appid_get_application_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (appid->application_name));
+        return (dxf_strdup (appid->application_name));
 }
 
 
@@ -605,7 +607,7 @@ dxf_appid_set_application_name
                   __FUNCTION__);
                 return (NULL);
         }
-        appid->application_name = strdup (name);
+        appid->application_name = dxf_strdup (name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -863,7 +865,7 @@ dxf_appid_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (appid->dictionary_owner_soft));
+        return (dxf_strdup (appid->dictionary_owner_soft));
 }
 
 
@@ -899,7 +901,7 @@ dxf_appid_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        appid->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        appid->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -943,7 +945,7 @@ dxf_appid_get_object_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (appid->object_owner_soft));
+        return (dxf_strdup (appid->object_owner_soft));
 }
 
 
@@ -979,7 +981,7 @@ dxf_appid_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        appid->object_owner_soft = strdup (object_owner_soft);
+        appid->object_owner_soft = dxf_strdup (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1023,7 +1025,7 @@ dxf_appid_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (appid->dictionary_owner_hard));
+        return (dxf_strdup (appid->dictionary_owner_hard));
 }
 
 
@@ -1059,7 +1061,7 @@ dxf_appid_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        appid->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        appid->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
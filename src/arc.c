@@ -40,6 +40,7 @@
 
 
 #include "arc.h"
+#include "util.h"
 
 
 /*!
@@ -65,7 +66,7 @@ dxf_arc_new ()
         size = sizeof (DxfArc);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((arc = malloc (size)) == NULL)
+        if ((arc = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -106,22 +107,22 @@ dxf_arc_init
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 arc = dxf_arc_new ();
         }
         if (arc == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         /* Assign initial values to members. */
         arc->id_code = 0;
-        arc->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        arc->layer = strdup (DXF_DEFAULT_LAYER);
+        arc->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        arc->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         arc->elevation = 0.0;
         arc->thickness = 0.0;
         arc->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -130,18 +131,23 @@ dxf_arc_init
         arc->paperspace = DXF_MODELSPACE;
         arc->graphics_data_size = 0;
         arc->shadow_mode = 0;
-        arc->dictionary_owner_soft = strdup ("");
-        arc->object_owner_soft = strdup ("");
-        arc->material = strdup ("");
-        arc->dictionary_owner_hard = strdup ("");
+        arc->dictionary_owner_soft = dxf_strdup ("");
+        arc->object_owner_soft = dxf_strdup ("");
+        arc->material = dxf_strdup ("");
+        arc->dictionary_owner_hard = dxf_strdup ("");
         arc->lineweight = 0;
-        arc->plot_style_name = strdup ("");
+        arc->plot_style_name = dxf_strdup ("");
         arc->color_value = 0;
-        arc->color_name = strdup ("");
+        arc->color_name = dxf_strdup ("");
         arc->transparency = 0;
-        arc->p0->x0 = 0.0;
-        arc->p0->y0 = 0.0;
-        arc->p0->z0 = 0.0;
+        arc->p0 = dxf_point_init (dxf_point_new ());
+        if (arc->p0 == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         arc->radius = 0.0;
         arc->start_angle = 0.0;
         arc->end_angle = 0.0;
@@ -151,7 +157,6 @@ dxf_arc_init
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         arc->binary_graphics_data = NULL;
-        arc->p0 = NULL;
         arc->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -186,38 +191,35 @@ dxf_arc_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int iter330;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (arc == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 arc = dxf_arc_init (arc);
         }
         if (arc->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfBinaryData struct.\n")));
                 arc->binary_graphics_data = dxf_binary_data_init (arc->binary_graphics_data);
                 if (arc->binary_graphics_data == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -225,34 +227,31 @@ dxf_arc_read
         }
         if (arc->p0 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 arc->p0 = dxf_point_init (arc->p0);
                 if (arc->p0 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
                 }
         }
-        iter310 = (DxfBinaryData *) arc->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        memset (temp_string, 0, sizeof (temp_string));
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -267,13 +266,17 @@ dxf_arc_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->linetype);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (arc->linetype);
+                        arc->linetype = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->layer);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (arc->layer);
+                        arc->layer = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -375,9 +378,10 @@ dxf_arc_read
                         (fp->line_number)++;
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbCircle") != 0)))
+                        && (strcmp (temp_string, "AcDbCircle") != 0)
+                        && (strcmp (temp_string, "AcDbArc") != 0))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -422,9 +426,8 @@ dxf_arc_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_data_append_hex ((DxfBinaryData *) arc->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -433,14 +436,18 @@ dxf_arc_read
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
                                 (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->dictionary_owner_soft);
+                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                                dxf_free (arc->dictionary_owner_soft);
+                                arc->dictionary_owner_soft = dxf_strdup (temp_string);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
                                 (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->object_owner_soft);
+                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                                dxf_free (arc->object_owner_soft);
+                                arc->object_owner_soft = dxf_strdup (temp_string);
                         }
                         iter330++;
                 }
@@ -449,14 +456,18 @@ dxf_arc_read
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->material);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (arc->material);
+                        arc->material = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->dictionary_owner_hard);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (arc->dictionary_owner_hard);
+                        arc->dictionary_owner_hard = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -470,7 +481,9 @@ dxf_arc_read
                         /* Now follows a string containing a plot style
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->plot_style_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (arc->plot_style_name);
+                        arc->plot_style_name = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -483,7 +496,9 @@ dxf_arc_read
                         /* Now follows a string containing a color
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->color_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (arc->color_name);
+                        arc->color_name = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -501,22 +516,25 @@ dxf_arc_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
+                        dxf_read_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (arc->linetype, "") == 0)
         {
-                arc->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_free (arc->linetype);
+                arc->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (arc->layer, "") == 0)
         {
-                arc->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_free (arc->layer);
+                arc->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -545,104 +563,104 @@ dxf_arc_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("ARC");
+        char *dxf_entity_name = dxf_strdup ("ARC");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (arc == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (arc->start_angle == arc->end_angle)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () start angle and end angle are identical for the %s entity with id-code: %x.\n")),
                     __FUNCTION__, dxf_entity_name, arc->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\tskipping %s entity.\n")), dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (arc->start_angle > 360.0)
         {
-                fprintf (stderr, "Error in %s () start angle is greater than 360 degrees for the %s entity with id-code: %x.\n",
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR, "Error in %s () start angle is greater than 360 degrees for the %s entity with id-code: %x.\n",
                         __FUNCTION__, dxf_entity_name, arc->id_code);
-                fprintf (stderr, "\tskipping %s entity.\n",
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE, "\tskipping %s entity.\n",
                         dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (arc->start_angle < 0.0)
         {
-                fprintf (stderr, "Error in %s () start angle is lesser than 0 degrees for the %s entity with id-code: %x.\n",
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR, "Error in %s () start angle is lesser than 0 degrees for the %s entity with id-code: %x.\n",
                         __FUNCTION__, dxf_entity_name, arc->id_code);
-                fprintf (stderr, "\tskipping %s entity.\n",
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE, "\tskipping %s entity.\n",
                         dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (arc->end_angle > 360.0)
         {
-                fprintf (stderr, "Error in %s () end angle is greater than 360 degrees for the %s entity with id-code: %x.\n",
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR, "Error in %s () end angle is greater than 360 degrees for the %s entity with id-code: %x.\n",
                         __FUNCTION__, dxf_entity_name, arc->id_code);
-                fprintf (stderr, "\tskipping %s entity.\n",
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE, "\tskipping %s entity.\n",
                         dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (arc->end_angle < 0.0)
         {
-                fprintf (stderr, "Error in %s () end angle is lesser than 0 degrees for the %s entity with id-code: %x.\n",
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR, "Error in %s () end angle is lesser than 0 degrees for the %s entity with id-code: %x.\n",
                         __FUNCTION__, dxf_entity_name, arc->id_code);
-                fprintf (stderr, "\tskipping %s entity.\n",
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE, "\tskipping %s entity.\n",
                         dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (arc->radius == 0.0)
         {
-                fprintf (stderr, "Error in %s () radius value equals 0.0 for the %s entity with id-code: %x.\n",
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR, "Error in %s () radius value equals 0.0 for the %s entity with id-code: %x.\n",
                         __FUNCTION__, dxf_entity_name, arc->id_code);
-                fprintf (stderr, "\tskipping %s entity.\n",
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE, "\tskipping %s entity.\n",
                         dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (arc->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, arc->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                arc->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                arc->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (arc->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, arc->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
                 arc->layer = DXF_DEFAULT_LAYER;
@@ -729,16 +747,7 @@ dxf_arc_write
 #else
                 fprintf (fp->fp, " 92\n%" PRIi32 "\n", arc->graphics_data_size);
 #endif
-                if (arc->binary_graphics_data != NULL)
-                {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) arc->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
-                }
+                dxf_binary_data_write (fp, (DxfBinaryData *) arc->binary_graphics_data);
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
@@ -779,7 +788,7 @@ dxf_arc_write
                 fprintf (fp->fp, "230\n%f\n", arc->extr_z0);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -811,29 +820,29 @@ dxf_arc_free
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (arc->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (arc->linetype);
-        free (arc->layer);
+        dxf_free (arc->linetype);
+        dxf_free (arc->layer);
         dxf_binary_data_free (arc->binary_graphics_data);
-        free (arc->dictionary_owner_soft);
-        free (arc->object_owner_soft);
-        free (arc->material);
-        free (arc->dictionary_owner_hard);
-        free (arc->plot_style_name);
-        free (arc->color_name);
+        dxf_free (arc->dictionary_owner_soft);
+        dxf_free (arc->object_owner_soft);
+        dxf_free (arc->material);
+        dxf_free (arc->dictionary_owner_hard);
+        dxf_free (arc->plot_style_name);
+        dxf_free (arc->color_name);
         dxf_point_free (arc->p0);
-        free (arc);
+        dxf_free (arc);
         arc = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -857,18 +866,19 @@ dxf_arc_free_list
                  * \c ARC entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (arcs == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (arcs != NULL)
         {
                 DxfArc *iter = (DxfArc *) arcs->next;
+                arcs->next = NULL;
                 dxf_arc_free (arcs);
                 arcs = (DxfArc *) iter;
         }
@@ -998,7 +1008,7 @@ dxf_arc_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->linetype));
+        return (dxf_strdup (arc->linetype));
 }
 
 
@@ -1041,7 +1051,7 @@ dxf_arc_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->linetype = strdup (linetype);
+        arc->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1085,7 +1095,7 @@ dxf_arc_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->layer));
+        return (dxf_strdup (arc->layer));
 }
 
 
@@ -1126,7 +1136,7 @@ dxf_arc_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->layer = strdup (layer);
+        arc->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1982,7 +1992,7 @@ dxf_arc_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->dictionary_owner_soft));
+        return (dxf_strdup (arc->dictionary_owner_soft));
 }
 
 
@@ -2024,7 +2034,7 @@ dxf_arc_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        arc->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2071,7 +2081,7 @@ dxf_arc_get_object_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->object_owner_soft));
+        return (dxf_strdup (arc->object_owner_soft));
 }
 
 
@@ -2110,7 +2120,7 @@ dxf_arc_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->object_owner_soft = strdup (object_owner_soft);
+        arc->object_owner_soft = dxf_strdup (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2157,7 +2167,7 @@ dxf_arc_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->material));
+        return (dxf_strdup (arc->material));
 }
 
 
@@ -2198,7 +2208,7 @@ dxf_arc_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->material = strdup (material);
+        arc->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2245,7 +2255,7 @@ dxf_arc_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->dictionary_owner_hard));
+        return (dxf_strdup (arc->dictionary_owner_hard));
 }
 
 
@@ -2287,7 +2297,7 @@ dxf_arc_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        arc->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2403,7 +2413,7 @@ dxf_arc_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->plot_style_name));
+        return (dxf_strdup (arc->plot_style_name));
 }
 
 
@@ -2444,7 +2454,7 @@ dxf_arc_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->plot_style_name = strdup (plot_style_name);
+        arc->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2560,7 +2570,7 @@ dxf_arc_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->color_name));
+        return (dxf_strdup (arc->color_name));
 }
 
 
@@ -2601,7 +2611,7 @@ dxf_arc_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->color_name = strdup (color_name);
+        arc->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2695,7 +2705,7 @@ dxf_arc_get_p0
                 /*!< a pointer to a DXF \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2738,7 +2748,7 @@ dxf_arc_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2780,7 +2790,7 @@ dxf_arc_get_x0
                 /*!< a pointer to a DXF \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2826,7 +2836,7 @@ dxf_arc_set_x0
                  * \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2877,7 +2887,7 @@ dxf_arc_get_y0
                 /*!< a pointer to a DXF \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2923,7 +2933,7 @@ dxf_arc_set_y0
                  * \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2974,7 +2984,7 @@ dxf_arc_get_z0
                 /*!< a pointer to a DXF \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3020,7 +3030,7 @@ dxf_arc_set_z0
                  * \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3304,7 +3314,7 @@ dxf_arc_get_length
                 /*!< a pointer to a DXF \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3353,7 +3363,7 @@ dxf_arc_get_extrusion_vector_as_point
                 /*!< a pointer to a DXF \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *point = NULL;
@@ -3400,7 +3410,7 @@ dxf_arc_get_extr_x0
                 /*!< a pointer to a DXF \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3439,7 +3449,7 @@ dxf_arc_set_extr_x0
                  * DXF \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3474,7 +3484,7 @@ dxf_arc_get_extr_y0
                 /*!< a pointer to a DXF \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3513,7 +3523,7 @@ dxf_arc_set_extr_y0
                  * DXF \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3548,7 +3558,7 @@ dxf_arc_get_extr_z0
                 /*!< a pointer to a DXF \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3587,7 +3597,7 @@ dxf_arc_set_extr_z0
                  * DXF \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
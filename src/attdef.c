@@ -59,7 +59,7 @@ dxf_attdef_new ()
         size = sizeof (DxfAttdef);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((attdef = malloc (size)) == NULL)
+        if ((attdef = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -96,22 +96,22 @@ dxf_attdef_init
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 attdef = dxf_attdef_new ();
         }
         if (attdef == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         /* Assign initial values to members. */
         attdef->id_code = 0;
-        attdef->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        attdef->layer = strdup (DXF_DEFAULT_LAYER);
+        attdef->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        attdef->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         attdef->elevation = 0.0;
         attdef->thickness = 0.0;
         attdef->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -120,19 +120,19 @@ dxf_attdef_init
         attdef->paperspace = DXF_MODELSPACE;
         attdef->graphics_data_size = 0;
         attdef->shadow_mode = 0;
-        attdef->dictionary_owner_soft = strdup ("");
-        attdef->object_owner_soft = strdup ("");
-        attdef->material = strdup ("");
-        attdef->dictionary_owner_hard = strdup ("");
+        attdef->dictionary_owner_soft = dxf_strdup ("");
+        attdef->object_owner_soft = dxf_strdup ("");
+        attdef->material = dxf_strdup ("");
+        attdef->dictionary_owner_hard = dxf_strdup ("");
         attdef->lineweight = 0.0;
-        attdef->plot_style_name = strdup ("");
+        attdef->plot_style_name = dxf_strdup ("");
         attdef->color_value = 0;
-        attdef->color_name = strdup ("");
+        attdef->color_name = dxf_strdup ("");
         attdef->transparency = 0;
-        attdef->default_value = strdup ("");
-        attdef->tag_value = strdup ("");
-        attdef->prompt_value = strdup ("");
-        attdef->text_style = strdup (DXF_DEFAULT_TEXTSTYLE);
+        attdef->default_value = dxf_strdup ("");
+        attdef->tag_value = dxf_strdup ("");
+        attdef->prompt_value = dxf_strdup ("");
+        attdef->text_style = dxf_strdup (DXF_DEFAULT_TEXTSTYLE);
         attdef->height = 0.0;
         attdef->rel_x_scale = 0.0;
         attdef->rot_angle = 0.0;
@@ -182,28 +182,27 @@ dxf_attdef_read
         DXF_DEBUG_BEGIN
 #endif
         char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
         int iter330;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 attdef = dxf_attdef_init (attdef);
                 if (attdef == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -211,15 +210,15 @@ dxf_attdef_read
         }
         if (attdef->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfBinaryData struct.\n")));
                 attdef->binary_graphics_data = dxf_binary_data_init (attdef->binary_graphics_data);
                 if (attdef->binary_graphics_data == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -227,15 +226,15 @@ dxf_attdef_read
         }
         if (attdef->p0 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 attdef->p0 = dxf_point_init (attdef->p0);
                 if (attdef->p0 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -243,21 +242,20 @@ dxf_attdef_read
         }
         if (attdef->p1 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 attdef->p1 = dxf_point_init (attdef->p1);
                 if (attdef->p1 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
                 }
         }
-        iter310 = (DxfBinaryData *) attdef->binary_graphics_data;
         iter330 = 0;
         (fp->line_number)++;
         fscanf (fp->fp, "%[^\n]", temp_string);
@@ -265,12 +263,12 @@ dxf_attdef_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
@@ -492,7 +490,7 @@ dxf_attdef_read
                         && (strcmp (temp_string, "AcDbText") != 0)
                         && (strcmp (temp_string, "AcDbAttributeDefinition") != 0))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -537,9 +535,8 @@ dxf_attdef_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_data_append_hex ((DxfBinaryData *) attdef->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -616,22 +613,23 @@ dxf_attdef_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (attdef->linetype, "") == 0)
         {
-                attdef->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                attdef->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (attdef->layer, "") == 0)
         {
-                attdef->layer = strdup (DXF_DEFAULT_LAYER);
+                attdef->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -654,82 +652,82 @@ dxf_attdef_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("ATTDEF");
+        char *dxf_entity_name = dxf_strdup ("ATTDEF");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (attdef->tag_value, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () default tag value string is empty for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, attdef->id_code);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (attdef->text_style, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () text style string is empty for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, attdef->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\tdefault text style STANDARD applied to %s entity.\n")),
                   dxf_entity_name);
-                attdef->text_style = strdup (DXF_DEFAULT_TEXTSTYLE);
+                attdef->text_style = dxf_strdup (DXF_DEFAULT_TEXTSTYLE);
         }
         if (strcmp (attdef->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, attdef->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                attdef->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                attdef->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (attdef->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, attdef->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                attdef->layer = strdup (DXF_DEFAULT_LAYER);
+                attdef->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (attdef->height == 0.0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () height has a value of 0.0 for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, attdef->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\tdefault height of 1.0 applied to %s entity.\n")),
                   dxf_entity_name);
                 attdef->height = 1.0;
         }
         if (attdef->rel_x_scale == 0.0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, attdef->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\tdefault relative X-scale of 1.0 applied to %s entity.\n")),
                   dxf_entity_name);
                 attdef->rel_x_scale = 1.0;
@@ -814,16 +812,7 @@ dxf_attdef_write
 #else
                 fprintf (fp->fp, " 92\n%" PRIi32 "\n", attdef->graphics_data_size);
 #endif
-                if (attdef->binary_graphics_data != NULL)
-                {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) attdef->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
-                }
+                dxf_binary_data_write (fp, (DxfBinaryData *) attdef->binary_graphics_data);
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
@@ -890,10 +879,10 @@ dxf_attdef_write
                         && (attdef->p0->y0 == attdef->p1->y0)
                         && (attdef->p0->z0 == attdef->p1->z0))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () insertion point and alignment point are identical for the %s entity with id-code: %x.\n")),
                           __FUNCTION__, dxf_entity_name, attdef->id_code);
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                           (_("\tdefault justification applied to %s entity.\n")),
                           dxf_entity_name);
                         attdef->hor_align = 0;
@@ -913,7 +902,7 @@ dxf_attdef_write
                 fprintf (fp->fp, "230\n%f\n", attdef->extr_z0);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -940,34 +929,34 @@ dxf_attdef_free
 #endif
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attdef->next != NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (attdef->linetype);
-        free (attdef->layer);
+        dxf_free (attdef->linetype);
+        dxf_free (attdef->layer);
         dxf_binary_data_free_list (attdef->binary_graphics_data);
-        free (attdef->dictionary_owner_soft);
-        free (attdef->object_owner_soft);
-        free (attdef->material);
-        free (attdef->dictionary_owner_hard);
-        free (attdef->plot_style_name);
-        free (attdef->color_name);
-        free (attdef->default_value);
-        free (attdef->tag_value);
-        free (attdef->prompt_value);
-        free (attdef->text_style);
+        dxf_free (attdef->dictionary_owner_soft);
+        dxf_free (attdef->object_owner_soft);
+        dxf_free (attdef->material);
+        dxf_free (attdef->dictionary_owner_hard);
+        dxf_free (attdef->plot_style_name);
+        dxf_free (attdef->color_name);
+        dxf_free (attdef->default_value);
+        dxf_free (attdef->tag_value);
+        dxf_free (attdef->prompt_value);
+        dxf_free (attdef->text_style);
         dxf_point_free_list (attdef->p0);
         dxf_point_free_list (attdef->p1);
-        free (attdef);
+        dxf_free (attdef);
         attdef = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -988,18 +977,19 @@ dxf_attdef_free_list
                  * entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (attdefs == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (attdefs != NULL)
         {
                 DxfAttdef *iter = (DxfAttdef *) attdefs->next;
+                attdefs->next = NULL;
                 dxf_attdef_free (attdefs);
                 attdefs = (DxfAttdef *) iter;
         }
@@ -1117,7 +1107,7 @@ dxf_attdef_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->linetype));
+        return (dxf_strdup (attdef->linetype));
 }
 
 
@@ -1151,7 +1141,7 @@ dxf_attdef_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->linetype = strdup (linetype);
+        attdef->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1192,7 +1182,7 @@ dxf_attdef_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->layer));
+        return (dxf_strdup (attdef->layer));
 }
 
 
@@ -1226,7 +1216,7 @@ dxf_attdef_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->layer = strdup (layer);
+        attdef->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1981,7 +1971,7 @@ dxf_attdef_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->dictionary_owner_soft));
+        return (dxf_strdup (attdef->dictionary_owner_soft));
 }
 
 
@@ -2017,7 +2007,7 @@ dxf_attdef_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        attdef->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2061,7 +2051,7 @@ dxf_attdef_get_object_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->object_owner_soft));
+        return (dxf_strdup (attdef->object_owner_soft));
 }
 
 
@@ -2097,7 +2087,7 @@ dxf_attdef_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->object_owner_soft = strdup (object_owner_soft);
+        attdef->object_owner_soft = dxf_strdup (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2141,7 +2131,7 @@ dxf_attdef_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->material));
+        return (dxf_strdup (attdef->material));
 }
 
 
@@ -2179,7 +2169,7 @@ dxf_attdef_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->material = strdup (material);
+        attdef->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2223,7 +2213,7 @@ dxf_attdef_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->dictionary_owner_hard));
+        return (dxf_strdup (attdef->dictionary_owner_hard));
 }
 
 
@@ -2259,7 +2249,7 @@ dxf_attdef_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        attdef->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2366,7 +2356,7 @@ dxf_attdef_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->plot_style_name));
+        return (dxf_strdup (attdef->plot_style_name));
 }
 
 
@@ -2404,7 +2394,7 @@ dxf_attdef_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->plot_style_name = strdup (plot_style_name);
+        attdef->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2511,7 +2501,7 @@ dxf_attdef_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->color_name));
+        return (dxf_strdup (attdef->color_name));
 }
 
 
@@ -2549,7 +2539,7 @@ dxf_attdef_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->color_name = strdup (color_name);
+        attdef->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2657,7 +2647,7 @@ dxf_attdef_get_default_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->default_value));
+        return (dxf_strdup (attdef->default_value));
 }
 
 
@@ -2692,7 +2682,7 @@ dxf_attdef_set_default_value
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->default_value = strdup (default_value);
+        attdef->default_value = dxf_strdup (default_value);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2735,7 +2725,7 @@ dxf_attdef_get_tag_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->tag_value));
+        return (dxf_strdup (attdef->tag_value));
 }
 
 
@@ -2770,7 +2760,7 @@ dxf_attdef_set_tag_value
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->tag_value = strdup (tag_value);
+        attdef->tag_value = dxf_strdup (tag_value);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2813,7 +2803,7 @@ dxf_attdef_get_prompt_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->prompt_value));
+        return (dxf_strdup (attdef->prompt_value));
 }
 
 
@@ -2848,7 +2838,7 @@ dxf_attdef_set_prompt_value
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->prompt_value = strdup (prompt_value);
+        attdef->prompt_value = dxf_strdup (prompt_value);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2891,7 +2881,7 @@ dxf_attdef_get_text_style
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->text_style));
+        return (dxf_strdup (attdef->text_style));
 }
 
 
@@ -2926,7 +2916,7 @@ dxf_attdef_set_text_style
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->text_style = strdup (text_style);
+        attdef->text_style = dxf_strdup (text_style);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2946,7 +2936,7 @@ dxf_attdef_get_p0
                 /*!< a pointer to a DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2986,7 +2976,7 @@ dxf_attdef_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3025,7 +3015,7 @@ dxf_attdef_get_x0
                 /*!< a pointer to a DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3068,7 +3058,7 @@ dxf_attdef_set_x0
                  * DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3116,7 +3106,7 @@ dxf_attdef_get_y0
                 /*!< a pointer to a DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3159,7 +3149,7 @@ dxf_attdef_set_y0
                  * DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3207,7 +3197,7 @@ dxf_attdef_get_z0
                 /*!< a pointer to a DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3250,7 +3240,7 @@ dxf_attdef_set_z0
                  * DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3297,7 +3287,7 @@ dxf_attdef_get_p1
                 /*!< a pointer to a DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3337,7 +3327,7 @@ dxf_attdef_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3376,7 +3366,7 @@ dxf_attdef_get_x1
                 /*!< a pointer to a DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3419,7 +3409,7 @@ dxf_attdef_set_x1
                  * a DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3467,7 +3457,7 @@ dxf_attdef_get_y1
                 /*!< a pointer to a DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3510,7 +3500,7 @@ dxf_attdef_set_y1
                  * \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3558,7 +3548,7 @@ dxf_attdef_get_z1
                 /*!< a pointer to a DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3601,7 +3591,7 @@ dxf_attdef_set_z1
                  * a DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4464,7 +4454,7 @@ dxf_attdef_get_extr_x0
                 /*!< a pointer to a DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4499,7 +4489,7 @@ dxf_attdef_set_extr_x0
                 /*!< the X-value of the extrusion vector of the entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4531,7 +4521,7 @@ dxf_attdef_get_extr_y0
                 /*!< a pointer to a DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4567,7 +4557,7 @@ dxf_attdef_set_extr_y0
                  * \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4599,7 +4589,7 @@ dxf_attdef_get_extr_z0
                 /*!< a pointer to a DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4635,7 +4625,7 @@ dxf_attdef_set_extr_z0
                  * \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4669,7 +4659,7 @@ dxf_attdef_get_extrusion_vector_as_point
                 /*!< a pointer to a DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *point = NULL;
@@ -59,7 +59,7 @@ dxf_attrib_new ()
         size = sizeof (DxfAttrib);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((attrib = malloc (size)) == NULL)
+        if ((attrib = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -97,23 +97,23 @@ dxf_attrib_init
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 attrib = dxf_attrib_new ();
         }
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         /* Assign initial values to members. */
         attrib->id_code = 0;
-        attrib->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        attrib->text_style = strdup (DXF_DEFAULT_TEXTSTYLE);
-        attrib->layer = strdup (DXF_DEFAULT_LAYER);
+        attrib->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        attrib->text_style = dxf_strdup (DXF_DEFAULT_TEXTSTYLE);
+        attrib->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         attrib->elevation = 0.0;
         attrib->thickness = 0.0;
         attrib->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -122,17 +122,17 @@ dxf_attrib_init
         attrib->paperspace = DXF_MODELSPACE;
         attrib->graphics_data_size = 0;
         attrib->shadow_mode = 0;
-        attrib->dictionary_owner_soft = strdup("");
-        attrib->object_owner_soft = strdup("");
-        attrib->material = strdup("");
-        attrib->dictionary_owner_hard = strdup("");
+        attrib->dictionary_owner_soft = dxf_strdup("");
+        attrib->object_owner_soft = dxf_strdup("");
+        attrib->material = dxf_strdup("");
+        attrib->dictionary_owner_hard = dxf_strdup("");
         attrib->lineweight = 0;
-        attrib->plot_style_name = strdup ("");
+        attrib->plot_style_name = dxf_strdup ("");
         attrib->color_value = 0;
-        attrib->color_name = strdup ("");
+        attrib->color_name = dxf_strdup ("");
         attrib->transparency = 0;
-        attrib->default_value = strdup ("");
-        attrib->tag_value = strdup ("");
+        attrib->default_value = dxf_strdup ("");
+        attrib->tag_value = dxf_strdup ("");
         attrib->height = 0.0;
         attrib->rel_x_scale = 0.0;
         attrib->rot_angle = 0.0;
@@ -182,28 +182,27 @@ dxf_attrib_read
         DXF_DEBUG_BEGIN
 #endif
         char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
         int iter330;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 attrib = dxf_attrib_init (attrib);
                 if (attrib == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -211,15 +210,15 @@ dxf_attrib_read
         }
         if (attrib->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfBinaryData struct.\n")));
                 attrib->binary_graphics_data = dxf_binary_data_init (attrib->binary_graphics_data);
                 if (attrib->binary_graphics_data == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -227,15 +226,15 @@ dxf_attrib_read
         }
         if (attrib->p0 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 attrib->p0 = dxf_point_init (attrib->p0);
                 if (attrib->p0 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -243,21 +242,20 @@ dxf_attrib_read
         }
         if (attrib->p1 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 attrib->p1 = dxf_point_init (attrib->p1);
                 if (attrib->p1 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
                 }
         }
-        iter310 = (DxfBinaryData *) attrib->binary_graphics_data;
         iter330 = 0;
         (fp->line_number)++;
         fscanf (fp->fp, "%[^\n]", temp_string);
@@ -265,12 +263,12 @@ dxf_attrib_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
@@ -485,7 +483,7 @@ dxf_attrib_read
                         && (strcmp (temp_string, "AcDbText") != 0)
                         && (strcmp (temp_string, "AcDbAttribute") != 0))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -530,9 +528,8 @@ dxf_attrib_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_data_append_hex ((DxfBinaryData *) attrib->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -609,22 +606,23 @@ dxf_attrib_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (attrib->linetype, "") == 0)
         {
-                attrib->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                attrib->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (attrib->layer, "") == 0)
         {
-                attrib->layer = strdup (DXF_DEFAULT_LAYER);
+                attrib->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -647,91 +645,91 @@ dxf_attrib_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("ATTRIB");
+        char *dxf_entity_name = dxf_strdup ("ATTRIB");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (attrib->default_value, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () default value string is empty for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, attrib->id_code);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (attrib->tag_value, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () tag value string is empty for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, attrib->id_code);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (attrib->text_style, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () text style string is empty for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, attrib->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\tdefault text style STANDARD applied to %s entity.\n")),
                   dxf_entity_name);
-                attrib->text_style = strdup (DXF_DEFAULT_TEXTSTYLE);
+                attrib->text_style = dxf_strdup (DXF_DEFAULT_TEXTSTYLE);
         }
         if (strcmp (attrib->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, attrib->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                attrib->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                attrib->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (attrib->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, attrib->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to the default layer.\n")),
                   dxf_entity_name);
-                attrib->layer = strdup (DXF_DEFAULT_LAYER);
+                attrib->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (attrib->height == 0.0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () height has a value of 0.0 for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, attrib->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\tdefault height of 1.0 applied to %s entity.\n")),
                   dxf_entity_name);
                 attrib->height = 1.0;
         }
         if (attrib->rel_x_scale == 0.0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, attrib->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\tdefault relative X-scale of 1.0 applied to %s entity.\n")),
                   dxf_entity_name);
                 attrib->rel_x_scale = 1.0;
@@ -822,16 +820,7 @@ dxf_attrib_write
 #else
                 fprintf (fp->fp, " 92\n%" PRIi32 "\n", attrib->graphics_data_size);
 #endif
-                if (attrib->binary_graphics_data != NULL)
-                {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) attrib->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
-                }
+                dxf_binary_data_write (fp, (DxfBinaryData *) attrib->binary_graphics_data);
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
@@ -897,10 +886,10 @@ dxf_attrib_write
                         && (attrib->p0->y0 == attrib->p1->y0)
                         && (attrib->p0->z0 == attrib->p1->z0))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () insertion point and alignment point are identical for the %s entity with id-code: %x.\n")),
                           __FUNCTION__, dxf_entity_name, attrib->id_code);
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                           (_("    default justification applied to %s entity\n")),
                           dxf_entity_name);
                         attrib->hor_align = 0;
@@ -923,7 +912,7 @@ dxf_attrib_write
                 fprintf (fp->fp, "230\n%f\n", attrib->extr_z0);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -950,33 +939,33 @@ dxf_attrib_free
 #endif
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attrib->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (attrib->linetype);
-        free (attrib->layer);
+        dxf_free (attrib->linetype);
+        dxf_free (attrib->layer);
         dxf_binary_data_free_list (attrib->binary_graphics_data);
-        free (attrib->dictionary_owner_soft);
-        free (attrib->object_owner_soft);
-        free (attrib->material);
-        free (attrib->dictionary_owner_hard);
-        free (attrib->plot_style_name);
-        free (attrib->color_name);
-        free (attrib->default_value);
-        free (attrib->tag_value);
-        free (attrib->text_style);
+        dxf_free (attrib->dictionary_owner_soft);
+        dxf_free (attrib->object_owner_soft);
+        dxf_free (attrib->material);
+        dxf_free (attrib->dictionary_owner_hard);
+        dxf_free (attrib->plot_style_name);
+        dxf_free (attrib->color_name);
+        dxf_free (attrib->default_value);
+        dxf_free (attrib->tag_value);
+        dxf_free (attrib->text_style);
         dxf_point_free (attrib->p0);
         dxf_point_free (attrib->p1);
-        free (attrib);
+        dxf_free (attrib);
         attrib = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -997,18 +986,19 @@ dxf_attrib_free_list
                  * entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (attribs == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (attribs != NULL)
         {
                 DxfAttrib *iter = (DxfAttrib *) attribs->next;
+                attribs->next = NULL;
                 dxf_attrib_free (attribs);
                 attribs = (DxfAttrib *) iter;
         }
@@ -1126,7 +1116,7 @@ dxf_attrib_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->linetype));
+        return (dxf_strdup (attrib->linetype));
 }
 
 
@@ -1160,7 +1150,7 @@ dxf_attrib_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->linetype = strdup (linetype);
+        attrib->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1201,7 +1191,7 @@ dxf_attrib_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->layer));
+        return (dxf_strdup (attrib->layer));
 }
 
 
@@ -1235,7 +1225,7 @@ dxf_attrib_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->layer = strdup (layer);
+        attrib->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1992,7 +1982,7 @@ dxf_attrib_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->dictionary_owner_soft));
+        return (dxf_strdup (attrib->dictionary_owner_soft));
 }
 
 
@@ -2028,7 +2018,7 @@ dxf_attrib_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        attrib->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2072,7 +2062,7 @@ dxf_attrib_get_object_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->object_owner_soft));
+        return (dxf_strdup (attrib->object_owner_soft));
 }
 
 
@@ -2108,7 +2098,7 @@ dxf_attrib_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->object_owner_soft = strdup (object_owner_soft);
+        attrib->object_owner_soft = dxf_strdup (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2152,7 +2142,7 @@ dxf_attrib_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->material));
+        return (dxf_strdup (attrib->material));
 }
 
 
@@ -2190,7 +2180,7 @@ dxf_attrib_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->material = strdup (material);
+        attrib->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2234,7 +2224,7 @@ dxf_attrib_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->dictionary_owner_hard));
+        return (dxf_strdup (attrib->dictionary_owner_hard));
 }
 
 
@@ -2270,7 +2260,7 @@ dxf_attrib_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        attrib->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2377,7 +2367,7 @@ dxf_attrib_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->plot_style_name));
+        return (dxf_strdup (attrib->plot_style_name));
 }
 
 
@@ -2415,7 +2405,7 @@ dxf_attrib_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->plot_style_name = strdup (plot_style_name);
+        attrib->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2522,7 +2512,7 @@ dxf_attrib_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->color_name));
+        return (dxf_strdup (attrib->color_name));
 }
 
 
@@ -2560,7 +2550,7 @@ dxf_attrib_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->color_name = strdup (color_name);
+        attrib->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2668,7 +2658,7 @@ dxf_attrib_get_default_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->default_value));
+        return (dxf_strdup (attrib->default_value));
 }
 
 
@@ -2703,7 +2693,7 @@ dxf_attrib_set_default_value
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->default_value = strdup (default_value);
+        attrib->default_value = dxf_strdup (default_value);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2746,7 +2736,7 @@ dxf_attrib_get_tag_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->tag_value));
+        return (dxf_strdup (attrib->tag_value));
 }
 
 
@@ -2781,7 +2771,7 @@ dxf_attrib_set_tag_value
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->tag_value = strdup (tag_value);
+        attrib->tag_value = dxf_strdup (tag_value);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2824,7 +2814,7 @@ dxf_attrib_get_text_style
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->text_style));
+        return (dxf_strdup (attrib->text_style));
 }
 
 
@@ -2859,7 +2849,7 @@ dxf_attrib_set_text_style
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->text_style = strdup (text_style);
+        attrib->text_style = dxf_strdup (text_style);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2879,7 +2869,7 @@ dxf_attrib_get_p0
                 /*!< a pointer to a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2918,7 +2908,7 @@ dxf_attrib_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2957,7 +2947,7 @@ dxf_attrib_get_x0
                 /*!< a pointer to a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3000,7 +2990,7 @@ dxf_attrib_set_x0
                  * \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3048,7 +3038,7 @@ dxf_attrib_get_y0
                 /*!< a pointer to a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3091,7 +3081,7 @@ dxf_attrib_set_y0
                  * \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3139,7 +3129,7 @@ dxf_attrib_get_z0
                 /*!< a pointer to a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3182,7 +3172,7 @@ dxf_attrib_set_z0
                  * \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3229,7 +3219,7 @@ dxf_attrib_get_p1
                 /*!< a pointer to a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3268,7 +3258,7 @@ dxf_attrib_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3307,7 +3297,7 @@ dxf_attrib_get_x1
                 /*!< a pointer to a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3349,7 +3339,7 @@ dxf_attrib_set_x1
                 /*!< the X-value \c x1 of a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3397,7 +3387,7 @@ dxf_attrib_get_y1
                 /*!< a pointer to a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3439,7 +3429,7 @@ dxf_attrib_set_y1
                 /*!< the Y-value \c y1 of a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3487,7 +3477,7 @@ dxf_attrib_get_z1
                 /*!< a pointer to a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3529,7 +3519,7 @@ dxf_attrib_set_z1
                 /*!< the Z-value \c z1 of a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4384,7 +4374,7 @@ dxf_attrib_get_extr_x0
                 /*!< a pointer to a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4420,7 +4410,7 @@ dxf_attrib_set_extr_x0
                  * \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4452,7 +4442,7 @@ dxf_attrib_get_extr_y0
                 /*!< a pointer to a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4488,7 +4478,7 @@ dxf_attrib_set_extr_y0
                  * \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4520,7 +4510,7 @@ dxf_attrib_get_extr_z0
                 /*!< a pointer to a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4556,7 +4546,7 @@ dxf_attrib_set_extr_z0
                  * \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4590,7 +4580,7 @@ dxf_attrib_get_extrusion_vector_as_point
                 /*!< a pointer to a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *point = NULL;
@@ -34,6 +34,7 @@
 
 
 #include "binary_data.h"
+#include "hex.h"
 
 
 /*!
@@ -53,7 +54,7 @@ dxf_binary_data_new ()
         size = sizeof (DxfBinaryData);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((data = malloc (size)) == NULL)
+        if ((data = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -91,21 +92,24 @@ dxf_binary_data_init
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 data = dxf_binary_data_new ();
         }
         if (data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         data->order = 0;
-        data->data_line = strdup ("");
+        data->data_line = dxf_strdup ("");
         data->length = 0;
+        data->bytes = NULL;
+        data->size = 0;
+        data->capacity = 0;
         data->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -115,7 +119,11 @@ dxf_binary_data_init
 
 
 /*!
- * \brief Write DXF output to fp for a binary data object.
+ * \brief Write DXF output to fp for a list of binary data objects.
+ *
+ * The decoded \c bytes are written as lines of up to 254 hexadecimal
+ * characters, followed by the \c data_line members which are not
+ * empty.
  *
  * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
  * occurred.
@@ -126,7 +134,8 @@ dxf_binary_data_write
         DxfFile *fp,
                 /*!< file pointer to output file (or device). */
         DxfBinaryData *data
-                /*!< a pointer to the binary data object. */
+                /*!< a pointer to the first binary data object of a
+                 * list. */
 )
 {
 #if DEBUG
@@ -135,13 +144,24 @@ dxf_binary_data_write
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "310\n%s\n", data->data_line);
+        while (data != NULL)
+        {
+                if (dxf_hex_write (fp, 310, data->bytes, data->size) != EXIT_SUCCESS)
+                {
+                        return (EXIT_FAILURE);
+                }
+                if ((data->data_line != NULL) && (data->data_line[0] != '\0'))
+                {
+                        fprintf (fp->fp, "310\n%s\n", data->data_line);
+                }
+                data = (DxfBinaryData *) data->next;
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -170,20 +190,21 @@ dxf_binary_data_free
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (data->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (data->data_line);
-        free (data);
+        dxf_free (data->data_line);
+        dxf_free (data->bytes);
+        dxf_free (data);
         data = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -204,19 +225,20 @@ dxf_binary_data_free_list
                  * data objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (data != NULL)
         {
                 DxfBinaryData *iter = (DxfBinaryData *) data->next;
+                data->next = NULL;
                 dxf_binary_data_free (data);
                 data = (DxfBinaryData *) iter;
         }
@@ -335,7 +357,7 @@ dxf_binary_data_get_data_line
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (data->data_line));
+        return (dxf_strdup (data->data_line));
 }
 
 
@@ -370,7 +392,7 @@ dxf_binary_data_set_data_line
                   __FUNCTION__);
                 return (NULL);
         }
-        data->data_line = strdup (data_line);
+        data->data_line = dxf_strdup (data_line);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -454,6 +476,107 @@ dxf_binary_data_set_length
 }
 
 
+/*!
+ * \brief Decode a line of hexadecimal characters (group code 310) and
+ * append the bytes to the \c bytes of a binary data object.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_binary_data_append_hex
+(
+        DxfBinaryData *data,
+                /*!< a pointer to the first binary data object of a
+                 * list. */
+        const char *hex
+                /*!< a line of hexadecimal characters. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((data == NULL) || (hex == NULL))
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_hex_append (&data->bytes, &data->size, &data->capacity, hex) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the decoded \c bytes from a binary data object.
+ *
+ * \return \c bytes, \c NULL when no data was decoded.
+ *
+ * \warning No copy is made, the returned bytes are owned by \c data.
+ */
+unsigned char *
+dxf_binary_data_get_bytes
+(
+        DxfBinaryData *data
+                /*!< a pointer to a binary data object. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (data == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (data->bytes);
+}
+
+
+/*!
+ * \brief Get the number of decoded bytes from a binary data object.
+ *
+ * \return \c size.
+ */
+size_t
+dxf_binary_data_get_size
+(
+        DxfBinaryData *data
+                /*!< a pointer to a binary data object. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (data == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (data->size);
+}
+
+
 /*!
  * \brief Get the pointer to the next binary data object from a
  * binary data object.
@@ -61,6 +61,14 @@ dxf_binary_data_struct
                  * Group code = 310. */
         int length;
                 /*!< Length of the \c data_line member. */
+        unsigned char *bytes;
+                /*!< Decoded binary data of all the 310 lines,
+                 * stored contiguously in the first DxfBinaryData of a
+                 * list. */
+        size_t size;
+                /*!< Number of bytes in the \c bytes member. */
+        size_t capacity;
+                /*!< Allocated size of the \c bytes member. */
         struct DxfBinaryData *next;
                 /*!< Pointer to the next DxfBinaryData.\n
                  * \c NULL if the last DxfBinaryData. */
@@ -78,6 +86,9 @@ char *dxf_binary_data_get_data_line (DxfBinaryData *data);
 DxfBinaryData *dxf_binary_data_set_data_line (DxfBinaryData *data, char *data_line);
 int dxf_binary_data_get_length (DxfBinaryData *data);
 DxfBinaryData *dxf_binary_data_set_length (DxfBinaryData *data, int length);
+int dxf_binary_data_append_hex (DxfBinaryData *data, const char *hex);
+unsigned char *dxf_binary_data_get_bytes (DxfBinaryData *data);
+size_t dxf_binary_data_get_size (DxfBinaryData *data);
 DxfBinaryData *dxf_binary_data_get_next (DxfBinaryData *data);
 DxfBinaryData *dxf_binary_data_set_next (DxfBinaryData *data, DxfBinaryData *next);
 DxfBinaryData *dxf_binary_data_get_last (DxfBinaryData *data);
@@ -53,7 +53,7 @@ dxf_binary_entity_data_new ()
         size = sizeof (DxfBinaryEntityData);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((data = malloc (size)) == NULL)
+        if ((data = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -91,19 +91,19 @@ dxf_binary_entity_data_init
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 data = dxf_binary_entity_data_new ();
         }
         if (data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        data->data_line = strdup ("");
+        data->data_line = dxf_strdup ("");
         data->length = 0;
         data->next = NULL;
 #if DEBUG
@@ -134,7 +134,7 @@ dxf_binary_entity_data_write
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -169,20 +169,20 @@ dxf_binary_entity_data_free
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (data->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (data->data_line);
-        free (data);
+        dxf_free (data->data_line);
+        dxf_free (data);
         data = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -203,19 +203,20 @@ dxf_binary_entity_data_free_list
                  * entity data objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (data != NULL)
         {
                 DxfBinaryEntityData *iter = (DxfBinaryEntityData *) data->next;
+                data->next = NULL;
                 dxf_binary_entity_data_free (data);
                 data = (DxfBinaryEntityData *) iter;
         }
@@ -258,7 +259,7 @@ dxf_binary_entity_data_get_data_line
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (data->data_line));
+        return (dxf_strdup (data->data_line));
 }
 
 
@@ -292,7 +293,7 @@ dxf_binary_entity_data_set_data_line
                   __FUNCTION__);
                 return (NULL);
         }
-        data->data_line = strdup (data_line);
+        data->data_line = dxf_strdup (data_line);
 #if DEBUG
         DXF_DEBUG_END
 #endif
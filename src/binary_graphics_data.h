@@ -57,6 +57,14 @@ dxf_binary_graphics_data_struct
                  * Group code = 310. */
         int length;
                 /*!< Length of the data_line member. */
+        unsigned char *bytes;
+                /*!< Decoded binary data of all the 310 lines,
+                 * stored contiguously in the first DxfBinaryGraphicsData of a
+                 * list. */
+        size_t size;
+                /*!< Number of bytes in the \c bytes member. */
+        size_t capacity;
+                /*!< Allocated size of the \c bytes member. */
         struct DxfBinaryGraphicsData *next;
                 /*!< Pointer to the next DxfBinaryGraphicsData.\n
                  * \c NULL if the last DxfBinaryGraphicsData. */
@@ -108,6 +116,22 @@ dxf_binary_graphics_data_set_length
         DxfBinaryGraphicsData *data,
         int length
 );
+int
+dxf_binary_graphics_data_append_hex
+(
+        DxfBinaryGraphicsData *data,
+        const char *hex
+);
+unsigned char *
+dxf_binary_graphics_data_get_bytes
+(
+        DxfBinaryGraphicsData *data
+);
+size_t
+dxf_binary_graphics_data_get_size
+(
+        DxfBinaryGraphicsData *data
+);
 DxfBinaryGraphicsData *
 dxf_binary_graphics_data_get_next
 (
@@ -42,6 +42,7 @@
 
 
 #include "block.h"
+#include "entities.h"
 
 
 /*!
@@ -62,7 +63,7 @@ dxf_block_new ()
         size = sizeof (DxfBlock);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((block = malloc (size)) == NULL)
+        if ((block = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -100,25 +101,26 @@ dxf_block_init
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 block = dxf_block_new ();
         }
         if (block == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         /* Assign initial values to members. */
-        block->xref_name = strdup ("");
-        block->block_name = strdup ("");
-        block->block_name_additional = strdup ("");
-        block->description = strdup ("");
+        block->xref_name = dxf_strdup ("");
+        block->block_name = dxf_strdup ("");
+        block->block_name_additional = dxf_strdup ("");
+        block->description = dxf_strdup ("");
         block->id_code = 0;
-        block->layer = strdup (DXF_DEFAULT_LAYER);
+        block->layer = dxf_strdup (DXF_DEFAULT_LAYER);
+        block->p0 = dxf_point_init (NULL);
         block->p0->x0 = 0.0;
         block->p0->y0 = 0.0;
         block->p0->z0 = 0.0;
@@ -126,11 +128,11 @@ dxf_block_init
         block->extr_x0 = 0.0;
         block->extr_y0 = 0.0;
         block->extr_z0 = 0.0;
-        block->object_owner_soft = strdup ("");
-        block->endblk = (struct DxfEndblk *) dxf_endblk_new ();
+        block->object_owner_soft = dxf_strdup ("");
+        block->endblk = (struct DxfEndblk *) dxf_endblk_init (dxf_endblk_new ());
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
-        block->p0 = NULL;
+        block->entities = NULL;
         block->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -173,31 +175,31 @@ dxf_block_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (block == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 block = dxf_block_init (block);
         }
         if (block->p0 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 block->p0 = dxf_point_init (block->p0);
                 if (block->p0 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -205,15 +207,15 @@ dxf_block_read
         }
         if (block->endblk == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfEndblk.\n")));
                 block->endblk = (DxfEndblk *) dxf_endblk_init ((DxfEndblk *) block->endblk);
                 if (block->endblk == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -224,12 +226,12 @@ dxf_block_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
@@ -308,7 +310,7 @@ dxf_block_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbBlockBegin") != 0)))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -345,9 +347,10 @@ dxf_block_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle omitted members and/or illegal values. */
@@ -361,19 +364,19 @@ dxf_block_read
         }
         if (strcmp (block->layer, "") == 0)
         {
-                block->layer = strdup (DXF_DEFAULT_LAYER);
+                block->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (block->block_type == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal block type value found while reading from: %s in line: %d.\n")),
                   __FUNCTION__, fp->filename, fp->line_number);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\tblock type value is reset to 1.\n")));
                 block->block_type = 1;
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -384,6 +387,9 @@ dxf_block_read
 /*!
  * \brief Write DXF output for a DXF \c BLOCK entity.
  *
+ * The \c BLOCK entity is followed by the entities of the block
+ * definition and the \c ENDBLK entity.
+ *
  * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
  * occurred.
  */
@@ -399,8 +405,50 @@ dxf_block_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("BLOCK");
-        DxfEndblk *endblk = NULL;
+        int result;
+
+        if (dxf_block_write_begin (fp, block) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        result = EXIT_SUCCESS;
+        if (block->entities != NULL)
+        {
+                result = dxf_entities_write_entities (fp,
+                  (DxfEntities *) block->entities);
+        }
+        if (dxf_block_write_end (fp, block) != EXIT_SUCCESS)
+        {
+                result = EXIT_FAILURE;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Write DXF output for the begin of a DXF \c BLOCK entity, the
+ * \c BLOCK entity itself without the entities of the block definition
+ * and without the \c ENDBLK entity.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_block_write_begin
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfBlock *block
+                /*!< DXF block entity */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char *dxf_entity_name = dxf_strdup ("BLOCK");
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -409,7 +457,7 @@ dxf_block_write
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (block == NULL)
@@ -418,7 +466,7 @@ dxf_block_write
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (block->block_name == NULL)
@@ -430,7 +478,7 @@ dxf_block_write
                   (_("\t%s entity is discarded from output.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (block->endblk == NULL)
@@ -442,13 +490,13 @@ dxf_block_write
                   (_("\t%s entity is discarded from output.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (((block->xref_name == NULL)
           || (strcmp (block->xref_name, "") == 0))
-          && ((block->block_type != 4)
-          || (block->block_type != 32)))
+          && ((block->block_type & 4)
+          || (block->block_type & 32)))
         {
                 fprintf (stderr,
                   (_("Error in %s () empty xref path name string for the %s entity with id-code: %x\n")),
@@ -457,7 +505,7 @@ dxf_block_write
                   (_("\t%s entity is discarded from output.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (block->description == NULL)
@@ -465,7 +513,7 @@ dxf_block_write
                 fprintf (stderr,
                   (_("Warning in %s () NULL pointer to description string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, block->id_code);
-                block->description = strdup ("");
+                block->description = dxf_strdup ("");
         }
         if (strcmp (block->layer, "") == 0)
         {
@@ -475,14 +523,14 @@ dxf_block_write
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0.\n")),
                   dxf_entity_name);
-                block->layer = strdup (DXF_DEFAULT_LAYER);
+                block->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (block->object_owner_soft == NULL)
         {
                 fprintf (stderr,
                   (_("Warning in %s () NULL pointer to soft owner object string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, block->id_code);
-                block->object_owner_soft = strdup ("");
+                block->object_owner_soft = dxf_strdup ("");
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -535,10 +583,8 @@ dxf_block_write
         {
                 fprintf (fp->fp, "  4\n%s\n", block->description);
         }
-        endblk = (DxfEndblk *) block->endblk;
-        dxf_endblk_write (fp, endblk);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -546,6 +592,43 @@ dxf_block_write
 }
 
 
+/*!
+ * \brief Write DXF output for the end of a DXF \c BLOCK entity, the
+ * \c ENDBLK entity.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_block_write_end
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfBlock *block
+                /*!< DXF block entity */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int result;
+
+        /* Do some basic checks. */
+        if ((fp == NULL) || (block == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        result = dxf_endblk_write (fp, (DxfEndblk *) block->endblk);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
 /*!
  * \brief Write DXF output to a file for a list of block definitions.
  *
@@ -563,6 +646,9 @@ dxf_block_write_table
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        DxfBlock *iter = NULL;
+        int result;
+
         /* Do some basic checks. */
         if (fp == NULL)
         {
@@ -571,12 +657,20 @@ dxf_block_write_table
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-
-        /*! \todo Add code here. */
+        dxf_section_write (fp, "BLOCKS");
+        result = EXIT_SUCCESS;
+        for (iter = blocks_list; iter != NULL; iter = (DxfBlock *) iter->next)
+        {
+                if (dxf_block_write (fp, iter) != EXIT_SUCCESS)
+                {
+                        result = EXIT_FAILURE;
+                }
+        }
+        dxf_endsec_write (fp);
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (EXIT_SUCCESS);
+        return (result);
 }
 
 
@@ -600,25 +694,29 @@ dxf_block_free
 #endif
         if (block == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (block->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (block->xref_name);
-        free (block->block_name);
-        free (block->block_name_additional);
-        free (block->description);
-        free (block->layer);
-        free (block->object_owner_soft);
-        free (block);
+        dxf_free (block->xref_name);
+        dxf_free (block->block_name);
+        dxf_free (block->block_name_additional);
+        dxf_free (block->description);
+        dxf_free (block->layer);
+        dxf_free (block->object_owner_soft);
+        if (block->entities != NULL)
+        {
+                dxf_entities_free ((DxfEntities *) block->entities);
+        }
+        dxf_free (block);
         block = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -639,18 +737,19 @@ dxf_block_free_list
                  * entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (blocks == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (blocks != NULL)
         {
                 DxfBlock *iter = (DxfBlock *) blocks->next;
+                blocks->next = NULL;
                 dxf_block_free (blocks);
                 blocks = (DxfBlock *) iter;
         }
@@ -695,7 +794,7 @@ dxf_block_get_xref_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block->xref_name));
+        return (dxf_strdup (block->xref_name));
 }
 
 
@@ -730,7 +829,7 @@ dxf_block_set_xref_name
                   __FUNCTION__);
                 return (NULL);
         }
-        block->xref_name = strdup (xref_name);
+        block->xref_name = dxf_strdup (xref_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -773,12 +872,16 @@ dxf_block_get_block_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block->block_name));
+        return (dxf_strdup (block->block_name));
 }
 
 
 /*!
  * \brief Set the block name for a DXF \c BLOCK entity.
+ *
+ * Rename a block definition of a drawing with
+ * dxf_drawing_rename_block (), which updates the name index of the
+ * drawing.
  */
 DxfBlock *
 dxf_block_set_block_name
@@ -808,7 +911,7 @@ dxf_block_set_block_name
                   __FUNCTION__);
                 return (NULL);
         }
-        block->block_name = strdup (block_name);
+        block->block_name = dxf_strdup (block_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -851,7 +954,7 @@ dxf_block_get_block_name_additional
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block->block_name_additional));
+        return (dxf_strdup (block->block_name_additional));
 }
 
 
@@ -886,7 +989,7 @@ dxf_block_set_block_name_additional
                   __FUNCTION__);
                 return (NULL);
         }
-        block->block_name_additional = strdup (block_name_additional);
+        block->block_name_additional = dxf_strdup (block_name_additional);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -929,7 +1032,7 @@ dxf_block_get_description
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block->description));
+        return (dxf_strdup (block->description));
 }
 
 
@@ -964,7 +1067,7 @@ dxf_block_set_description
                   __FUNCTION__);
                 return (NULL);
         }
-        block->description = strdup (description);
+        block->description = dxf_strdup (description);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1080,7 +1183,7 @@ dxf_block_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block->layer));
+        return (dxf_strdup (block->layer));
 }
 
 
@@ -1114,7 +1217,7 @@ dxf_block_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        block->layer = strdup (layer);
+        block->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1134,7 +1237,7 @@ dxf_block_get_p0
                 /*!< a pointer to a DXF \c BLOCK entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1173,7 +1276,7 @@ dxf_block_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1212,7 +1315,7 @@ dxf_block_get_x0
                 /*!< a pointer to a DXF \c BLOCK entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1255,7 +1358,7 @@ dxf_block_set_x0
                  * \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1303,7 +1406,7 @@ dxf_block_get_y0
                 /*!< a pointer to a DXF \c BLOCK entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1346,7 +1449,7 @@ dxf_block_set_y0
                  * \c BLOCK entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1394,7 +1497,7 @@ dxf_block_get_z0
                 /*!< a pointer to a DXF \c BLOCK entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1437,7 +1540,7 @@ dxf_block_set_z0
                  * \c BLOCK entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1745,7 +1848,7 @@ dxf_block_get_extr_x0
                 /*!< a pointer to a DXF \c BLOCK entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1781,7 +1884,7 @@ dxf_block_set_extr_x0
                  * DXF \c BLOCK entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1813,7 +1916,7 @@ dxf_block_get_extr_y0
                 /*!< a pointer to a DXF \c BLOCK entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1849,7 +1952,7 @@ dxf_block_set_extr_y0
                  * DXF \c BLOCK entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1881,7 +1984,7 @@ dxf_block_get_extr_z0
                 /*!< a pointer to a DXF \c BLOCK entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1917,7 +2020,7 @@ dxf_block_set_extr_z0
                  * DXF \c BLOCK entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1951,7 +2054,7 @@ dxf_block_get_extrusion_vector_as_point
                 /*!< a pointer to a DXF \c BLOCK entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *point = NULL;
@@ -2055,7 +2158,7 @@ dxf_block_get_object_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block->object_owner_soft));
+        return (dxf_strdup (block->object_owner_soft));
 }
 
 
@@ -2091,7 +2194,7 @@ dxf_block_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        block->object_owner_soft = strdup (object_owner_soft);
+        block->object_owner_soft = dxf_strdup (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2195,6 +2298,76 @@ dxf_block_set_endblk
 }
 
 
+/*!
+ * \brief Get the pointer to the entities contained in a DXF \c BLOCK
+ * entity.
+ *
+ * \return pointer to the entities, or \c NULL when the block definition
+ * has no entities.
+ *
+ * \warning No checks are performed on the returned pointer.
+ */
+struct DxfEntities *
+dxf_block_get_entities
+(
+        DxfBlock *block
+                /*!< a pointer to a DXF \c BLOCK entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (block == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((struct DxfEntities *) block->entities);
+}
+
+
+/*!
+ * \brief Set the pointer to the entities contained in a DXF \c BLOCK
+ * entity.
+ *
+ * The block takes ownership of the entities, they are freed by
+ * \c dxf_block_free().
+ */
+DxfBlock *
+dxf_block_set_entities
+(
+        DxfBlock *block,
+                /*!< a pointer to a DXF \c BLOCK entity. */
+        struct DxfEntities *entities
+                /*!< a pointer to the entities contained in the block
+                 * definition. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (block == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        block->entities = (struct DxfEntities *) entities;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (block);
+}
+
+
 /*!
  * \brief Get the pointer to the next DXF \c BLOCK entity from a DXF 
  * \c BLOCK entity.
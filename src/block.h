@@ -135,6 +135,10 @@ dxf_block_struct
                  * Group code = 330. */
         struct DxfEndblk *endblk;
                 /*!< pointer to the end of block marker. */
+        struct DxfEntities *entities;
+                /*!< pointer to the entities contained in the block
+                 * definition.\n
+                 * \c NULL if the block definition has no entities. */
         struct DxfBlock *next;
                 /*!< pointer to the next DxfBlock.\n
                  * \c NULL in the last DxfBlock. */
@@ -146,6 +150,8 @@ DxfBlock *dxf_block_new ();
 DxfBlock *dxf_block_init (DxfBlock *block);
 DxfBlock *dxf_block_read (DxfFile *fp, DxfBlock *block);
 int dxf_block_write (DxfFile *fp, DxfBlock *block);
+int dxf_block_write_begin (DxfFile *fp, DxfBlock *block);
+int dxf_block_write_end (DxfFile *fp, DxfBlock *block);
 int dxf_block_write_endblk (DxfFile *fp);
 int dxf_block_write_table (DxfFile *fp, DxfBlock *blocks_list);
 int dxf_block_free (DxfBlock *block);
@@ -190,6 +196,8 @@ char *dxf_block_get_object_owner_soft (DxfBlock *block);
 DxfBlock *dxf_block_set_object_owner_soft (DxfBlock *block, char *object_owner_soft);
 struct DxfEndblk *dxf_block_get_endblk (DxfBlock *block);
 DxfBlock *dxf_block_set_endblk (DxfBlock *block, struct DxfEndblk *endblk);
+struct DxfEntities *dxf_block_get_entities (DxfBlock *block);
+DxfBlock *dxf_block_set_entities (DxfBlock *block, struct DxfEntities *entities);
 DxfBlock *dxf_block_get_next (DxfBlock *block);
 DxfBlock *dxf_block_set_next (DxfBlock *block, DxfBlock *next);
 DxfBlock *dxf_block_get_last (DxfBlock *block);
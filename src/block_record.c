@@ -62,7 +62,7 @@ dxf_block_record_new ()
         size = sizeof (DxfBlockRecord);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((block_record = malloc (size)) == NULL)
+        if ((block_record = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -100,30 +100,30 @@ dxf_block_record_init
         /* Do some basic checks. */
         if (block_record == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 block_record = dxf_block_record_new ();
         }
         if (block_record == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         /* Assign initial values to members. */
         block_record->id_code = 0;
-        block_record->block_name = strdup ("");
+        block_record->block_name = dxf_strdup ("");
         block_record->flag = 0;
         block_record->insert_units = 0;
         block_record->explodability = 0;
         block_record->scalability = 0;
-        block_record->dictionary_owner_soft = strdup ("");
-        block_record->object_owner_soft = strdup ("");
-        block_record->dictionary_owner_hard = strdup ("");
-        block_record->xdata_string_data = strdup ("DesignCenter Data");
-        block_record->xdata_application_name = strdup ("ACAD");
+        block_record->dictionary_owner_soft = dxf_strdup ("");
+        block_record->object_owner_soft = dxf_strdup ("");
+        block_record->dictionary_owner_hard = dxf_strdup ("");
+        block_record->xdata_string_data = dxf_strdup ("DesignCenter Data");
+        block_record->xdata_application_name = dxf_strdup ("ACAD");
         block_record->design_center_version_number = 0;
         block_record->insert_units = 0;
         /* Initialize new structs for the following members later,
@@ -162,43 +162,41 @@ dxf_block_record_read
         DXF_DEBUG_BEGIN
 #endif
         char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
         int iter330;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (block_record == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 block_record = dxf_block_record_init (block_record);
         }
         if (block_record->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfBinaryData struct.\n")));
                 block_record->binary_graphics_data = dxf_binary_data_init (block_record->binary_graphics_data);
                 if (block_record->binary_graphics_data == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
                 }
         }
-        iter310 = (DxfBinaryData *) block_record->binary_graphics_data;
         iter330 = 0;
         (fp->line_number)++;
         fscanf (fp->fp, "%[^\n]", temp_string);
@@ -206,12 +204,12 @@ dxf_block_record_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -255,9 +253,8 @@ dxf_block_record_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_data_append_hex ((DxfBinaryData *) block_record->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -306,7 +303,7 @@ dxf_block_record_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block_record->xdata_string_data);
                         if (strcmp (block_record->xdata_string_data, "DesignCenter Data") != 0)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () unfamiliar string found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -319,7 +316,7 @@ dxf_block_record_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block_record->xdata_application_name);
                         if (strcmp (block_record->xdata_application_name, "ACAD") != 0)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () unfamiliar string found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -327,13 +324,14 @@ dxf_block_record_read
 /*! \todo Implement Group Code = 1070 in a proper way. */
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -357,47 +355,47 @@ dxf_block_record_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("BLOCK_RECORD");
+        char *dxf_entity_name = dxf_strdup ("BLOCK_RECORD");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (block_record == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((block_record->block_name == NULL)
           || (strcmp (block_record->block_name, "") == 0))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s empty block name string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, block_record->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is discarded from output.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
@@ -453,16 +451,7 @@ dxf_block_record_write
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
-                if (block_record->binary_graphics_data != NULL)
-                {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) block_record->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
-                }
+                dxf_binary_data_write (fp, (DxfBinaryData *) block_record->binary_graphics_data);
                 if (block_record->xdata_application_name != NULL)
                 {
                         fprintf (fp->fp, "1001\n%s\n", block_record->xdata_application_name);
@@ -477,7 +466,7 @@ dxf_block_record_write
                 }
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -504,23 +493,23 @@ dxf_block_record_free
 #endif
         if (block_record == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (block_record->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (block_record->block_name);
+        dxf_free (block_record->block_name);
         dxf_binary_data_free_list (block_record->binary_graphics_data);
-        free (block_record->dictionary_owner_soft);
-        free (block_record->dictionary_owner_hard);
-        free (block_record);
+        dxf_free (block_record->dictionary_owner_soft);
+        dxf_free (block_record->dictionary_owner_hard);
+        dxf_free (block_record);
         block_record = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -541,18 +530,19 @@ dxf_block_record_free_list
                  * \c BLOCK_RECORD entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (block_records == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (block_records != NULL)
         {
                 DxfBlockRecord *iter= (DxfBlockRecord *) block_records->next;
+                block_records->next = NULL;
                 dxf_block_record_free (block_records);
                 block_records = (DxfBlockRecord *) iter;
         }
@@ -674,7 +664,7 @@ dxf_block_record_get_block_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block_record->block_name));
+        return (dxf_strdup (block_record->block_name));
 }
 
 
@@ -711,7 +701,7 @@ dxf_block_record_set_block_name
                   __FUNCTION__);
                 return (NULL);
         }
-        block_record->block_name= strdup (block_name);
+        block_record->block_name= dxf_strdup (block_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1301,7 +1291,7 @@ dxf_block_record_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block_record->dictionary_owner_soft));
+        return (dxf_strdup (block_record->dictionary_owner_soft));
 }
 
 
@@ -1338,7 +1328,7 @@ dxf_block_record_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        block_record->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        block_record->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1383,7 +1373,7 @@ dxf_block_record_get_object_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block_record->object_owner_soft));
+        return (dxf_strdup (block_record->object_owner_soft));
 }
 
 
@@ -1420,7 +1410,7 @@ dxf_block_record_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        block_record->object_owner_soft = strdup (object_owner_soft);
+        block_record->object_owner_soft = dxf_strdup (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1465,7 +1455,7 @@ dxf_block_record_get_associated_layout_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block_record->associated_layout_hard));
+        return (dxf_strdup (block_record->associated_layout_hard));
 }
 
 
@@ -1506,7 +1496,7 @@ dxf_block_record_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block_record->dictionary_owner_hard));
+        return (dxf_strdup (block_record->dictionary_owner_hard));
 }
 
 
@@ -1543,7 +1533,7 @@ dxf_block_record_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        block_record->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        block_record->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1588,7 +1578,7 @@ dxf_block_record_get_xdata_string_data
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block_record->xdata_string_data));
+        return (dxf_strdup (block_record->xdata_string_data));
 }
 
 
@@ -1625,7 +1615,7 @@ dxf_block_record_set_xdata_string_data
                   __FUNCTION__);
                 return (NULL);
         }
-        block_record->xdata_string_data = strdup (xdata_string_data);
+        block_record->xdata_string_data = dxf_strdup (xdata_string_data);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1670,7 +1660,7 @@ dxf_block_record_get_xdata_application_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block_record->xdata_application_name));
+        return (dxf_strdup (block_record->xdata_application_name));
 }
 
 
@@ -1707,7 +1697,7 @@ dxf_block_record_set_xdata_application_name
                   __FUNCTION__);
                 return (NULL);
         }
-        block_record->xdata_application_name = strdup (xdata_application_name);
+        block_record->xdata_application_name = dxf_strdup (xdata_application_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
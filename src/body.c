@@ -42,6 +42,7 @@
 
 
 #include "body.h"
+#include "util.h"
 
 
 /*!
@@ -61,7 +62,7 @@ dxf_body_new ()
         size = sizeof (DxfBody);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((body = malloc (size)) == NULL)
+        if ((body = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -99,22 +100,22 @@ dxf_body_init
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 body = dxf_body_new ();
         }
         if (body == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         /* Assign initial values to members. */
         body->id_code = 0;
-        body->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        body->layer = strdup (DXF_DEFAULT_LAYER);
+        body->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        body->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         body->elevation = 0.0;
         body->thickness = 0.0;
         body->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -123,19 +124,20 @@ dxf_body_init
         body->paperspace = DXF_MODELSPACE;
         body->graphics_data_size = 0;
         body->shadow_mode = 0;
-        body->dictionary_owner_soft = strdup ("");
-        body->object_owner_soft = strdup ("");
-        body->material = strdup ("");
-        body->dictionary_owner_hard = strdup ("");
-        body->plot_style_name = strdup ("");
+        body->dictionary_owner_soft = dxf_strdup ("");
+        body->object_owner_soft = dxf_strdup ("");
+        body->material = dxf_strdup ("");
+        body->dictionary_owner_hard = dxf_strdup ("");
+        body->plot_style_name = dxf_strdup ("");
         body->color_value = 0;
-        body->color_name = strdup ("");
+        body->color_name = dxf_strdup ("");
         body->transparency = 0;
         body->modeler_format_version_number = 1;
         /* Initialize new structs for members. */
         body->binary_graphics_data = NULL;
         body->proprietary_data = NULL;
         body->additional_proprietary_data = NULL;
+        body->acis = NULL;
         body->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -167,71 +169,35 @@ dxf_body_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        int i;
-        DxfBinaryData *iter310 = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int iter330;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (body == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 body = dxf_body_init (body);
         }
         if (body->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfBinaryData struct.\n")));
                 body->binary_graphics_data = dxf_binary_data_init (body->binary_graphics_data);
                 if (body->binary_graphics_data == NULL)
                 {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        if (body->proprietary_data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                body->proprietary_data = dxf_binary_data_init (body->proprietary_data);
-                if (body->proprietary_data == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        if (body->additional_proprietary_data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                body->additional_proprietary_data = dxf_binary_data_init (body->additional_proprietary_data);
-                if (body->additional_proprietary_data == NULL)
-                {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -239,50 +205,35 @@ dxf_body_read
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
-        i = 0;
-        iter310 = (DxfBinaryData *) body->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        memset (temp_string, 0, sizeof (temp_string));
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                else if (strcmp (temp_string, "  1") == 0)
+                else if ((strcmp (temp_string, "1") == 0)
+                  || (strcmp (temp_string, "3") == 0))
                 {
                         /* Now follows a string containing proprietary
-                         * data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->proprietary_data->data_line);
-                        body->proprietary_data->order = i;
-                        i++;
-                        dxf_binary_data_init ((DxfBinaryData *) body->proprietary_data->next);
-                        body->proprietary_data = (DxfBinaryData *) body->proprietary_data->next;
-                }
-                else if (strcmp (temp_string, "  3") == 0)
-                {
-                        /* Now follows a string containing additional
-                         * proprietary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->additional_proprietary_data->data_line);
-                        body->additional_proprietary_data->order = i;
-                        i++;
-                        dxf_binary_data_init ((DxfBinaryData *) body->additional_proprietary_data->next);
-                        body->additional_proprietary_data = (DxfBinaryData *) body->additional_proprietary_data->next;
+                         * data, or additional proprietary data. */
+                        if (body->acis == NULL)
+                        {
+                                body->acis = dxf_acis_init (dxf_acis_new ());
+                        }
+                        dxf_acis_read (fp, body->acis, atoi (temp_string), temp_string);
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -294,13 +245,17 @@ dxf_body_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->linetype);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (body->linetype);
+                        body->linetype = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->layer);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (body->layer);
+                        body->layer = dxf_strdup (temp_string);
                 }
                 else if ((fp->acad_version_number <= AutoCAD_11)
                   && DXF_FLATLAND
@@ -361,9 +316,10 @@ dxf_body_read
                          * subclass marker value. */
                         (fp->line_number)++;
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "AcDbModelerGeometry") != 0)
+                        if ((strcmp (temp_string, "AcDbEntity") != 0)
+                          && (strcmp (temp_string, "AcDbModelerGeometry") != 0))
                         {
-                                fprintf (stderr, "Warning in dxf_body_read () found a bad subclass marker in: %s in line: %d.\n",
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING, "Warning in dxf_body_read () found a bad subclass marker in: %s in line: %d.\n",
                                         fp->filename, fp->line_number);
                         }
                 }
@@ -386,9 +342,8 @@ dxf_body_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_data_append_hex ((DxfBinaryData *) body->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -397,14 +352,18 @@ dxf_body_read
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
                                 (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->dictionary_owner_soft);
+                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                                dxf_free (body->dictionary_owner_soft);
+                                body->dictionary_owner_soft = dxf_strdup (temp_string);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
                                 (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->object_owner_soft);
+                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                                dxf_free (body->object_owner_soft);
+                                body->object_owner_soft = dxf_strdup (temp_string);
                         }
                         iter330++;
                 }
@@ -413,14 +372,18 @@ dxf_body_read
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->material);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (body->material);
+                        body->material = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->dictionary_owner_hard);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (body->dictionary_owner_hard);
+                        body->dictionary_owner_hard = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -434,7 +397,9 @@ dxf_body_read
                         /* Now follows a string containing a plot style
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->plot_style_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (body->plot_style_name);
+                        body->plot_style_name = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -447,7 +412,9 @@ dxf_body_read
                         /* Now follows a string containing a color
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->color_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (body->color_name);
+                        body->color_name = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -465,31 +432,32 @@ dxf_body_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
+                        dxf_read_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (body->linetype, "") == 0)
         {
-                body->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                body->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (body->layer, "") == 0)
         {
-                body->layer = strdup (DXF_DEFAULT_LAYER);
+                body->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (body->modeler_format_version_number == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning: in %s () illegal modeler format version number found while reading from: %s in line: %d.\n")),
                   __FUNCTION__, fp->filename, fp->line_number);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\tmodeler format version number is reset to 1.\n")));
                 body->modeler_format_version_number = 1;
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -515,7 +483,7 @@ dxf_body_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("BODY");
+        char *dxf_entity_name = dxf_strdup ("BODY");
         DxfProprietaryData *iter = NULL;
         DxfProprietaryData *additional_iter = NULL;
         int i;
@@ -523,47 +491,47 @@ dxf_body_write
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (body == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, body->id_code);
         }
         if (strcmp (body->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, body->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                body->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                body->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (body->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, body->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                body->layer = strdup (DXF_DEFAULT_LAYER);
+                body->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         i = 1;
@@ -648,16 +616,7 @@ dxf_body_write
 #else
                 fprintf (fp->fp, " 92\n%" PRIi32 "\n", body->graphics_data_size);
 #endif
-                if (body->binary_graphics_data != NULL)
-                {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) body->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
-                }
+                dxf_binary_data_write (fp, (DxfBinaryData *) body->binary_graphics_data);
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
@@ -678,25 +637,32 @@ dxf_body_write
         {
                 fprintf (fp->fp, " 70\n%hd\n", body->modeler_format_version_number);
         }
-        iter = (DxfProprietaryData *) body->proprietary_data;
-        additional_iter = (DxfProprietaryData *) body->additional_proprietary_data;
-        while ((iter != NULL) || (additional_iter != NULL))
+        if (body->acis != NULL)
         {
-                if (iter->order == i)
-                {
-                        fprintf (fp->fp, "  1\n%s\n", iter->line);
-                        iter = (DxfProprietaryData *) iter->next;
-                        i++;
-                }
-                if (additional_iter->order == i)
+                dxf_acis_write (fp, body->acis);
+        }
+        else
+        {
+                iter = (DxfProprietaryData *) body->proprietary_data;
+                additional_iter = (DxfProprietaryData *) body->additional_proprietary_data;
+                while ((iter != NULL) || (additional_iter != NULL))
                 {
-                        fprintf (fp->fp, "  3\n%s\n", additional_iter->line);
-                        additional_iter = (DxfProprietaryData *) additional_iter->next;
-                        i++;
+                        if (iter->order == i)
+                        {
+                                fprintf (fp->fp, "  1\n%s\n", iter->line);
+                                iter = (DxfProprietaryData *) iter->next;
+                                i++;
+                        }
+                        if (additional_iter->order == i)
+                        {
+                                fprintf (fp->fp, "  3\n%s\n", additional_iter->line);
+                                additional_iter = (DxfProprietaryData *) additional_iter->next;
+                                i++;
+                        }
                 }
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -725,30 +691,34 @@ dxf_body_free
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (body->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (body->linetype);
-        free (body->layer);
+        dxf_free (body->linetype);
+        dxf_free (body->layer);
         dxf_binary_data_free_list (body->binary_graphics_data);
-        free (body->dictionary_owner_soft);
-        free (body->object_owner_soft);
-        free (body->material);
-        free (body->dictionary_owner_hard);
-        free (body->plot_style_name);
-        free (body->color_name);
+        dxf_free (body->dictionary_owner_soft);
+        dxf_free (body->object_owner_soft);
+        dxf_free (body->material);
+        dxf_free (body->dictionary_owner_hard);
+        dxf_free (body->plot_style_name);
+        dxf_free (body->color_name);
         dxf_binary_data_free_list (body->proprietary_data);
         dxf_binary_data_free_list (body->additional_proprietary_data);
-        free (body);
+        if (body->acis != NULL)
+        {
+                dxf_acis_free (body->acis);
+        }
+        dxf_free (body);
         body = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -769,18 +739,19 @@ dxf_body_free_list
                  * entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (bodies == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (bodies != NULL)
         {
                 DxfBody *iter = (DxfBody *) bodies->next;
+                bodies->next = NULL;
                 dxf_body_free (bodies);
                 bodies = (DxfBody *) iter;
         }
@@ -900,7 +871,7 @@ dxf_body_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->linetype));
+        return (dxf_strdup (body->linetype));
 }
 
 
@@ -934,7 +905,7 @@ dxf_body_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        body->linetype = strdup (linetype);
+        body->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -975,7 +946,7 @@ dxf_body_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->layer));
+        return (dxf_strdup (body->layer));
 }
 
 
@@ -1009,7 +980,7 @@ dxf_body_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        body->layer = strdup (layer);
+        body->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1783,7 +1754,7 @@ dxf_body_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->dictionary_owner_soft));
+        return (dxf_strdup (body->dictionary_owner_soft));
 }
 
 
@@ -1819,7 +1790,7 @@ dxf_body_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        body->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        body->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1863,7 +1834,7 @@ dxf_body_get_object_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->object_owner_soft));
+        return (dxf_strdup (body->object_owner_soft));
 }
 
 
@@ -1899,7 +1870,7 @@ dxf_body_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        body->object_owner_soft = strdup (object_owner_soft);
+        body->object_owner_soft = dxf_strdup (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1944,7 +1915,7 @@ dxf_body_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->material));
+        return (dxf_strdup (body->material));
 }
 
 
@@ -1982,7 +1953,7 @@ dxf_body_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        body->material = strdup (material);
+        body->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2026,7 +1997,7 @@ dxf_body_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->dictionary_owner_hard));
+        return (dxf_strdup (body->dictionary_owner_hard));
 }
 
 
@@ -2062,7 +2033,7 @@ dxf_body_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        body->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        body->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2169,7 +2140,7 @@ dxf_body_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->plot_style_name));
+        return (dxf_strdup (body->plot_style_name));
 }
 
 
@@ -2207,7 +2178,7 @@ dxf_body_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        body->plot_style_name = strdup (plot_style_name);
+        body->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2314,7 +2285,7 @@ dxf_body_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->color_name));
+        return (dxf_strdup (body->color_name));
 }
 
 
@@ -2352,7 +2323,7 @@ dxf_body_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        body->color_name = strdup (color_name);
+        body->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2615,6 +2586,78 @@ dxf_body_set_additional_proprietary_data
 }
 
 
+/*!
+ * \brief Get the ACIS proprietary data from a DXF \c BODY entity.
+ *
+ * \return a pointer to the ACIS proprietary data, or \c NULL when the
+ * entity holds none or when an error occurred.
+ */
+DxfAcis *
+dxf_body_get_acis
+(
+        DxfBody *body
+                /*!< a pointer to a DXF \c BODY entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (body == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (body->acis);
+}
+
+
+/*!
+ * \brief Set the ACIS proprietary data for a DXF \c BODY entity.
+ *
+ * The entity takes ownership of \c acis, ACIS proprietary data held
+ * before is freed.
+ *
+ * \return a pointer to \c body, or \c NULL when an error occurred.
+ */
+DxfBody *
+dxf_body_set_acis
+(
+        DxfBody *body,
+                /*!< a pointer to a DXF \c BODY entity. */
+        DxfAcis *acis
+                /*!< a pointer to the ACIS proprietary data, or
+                 * \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (body == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((body->acis != NULL) && (body->acis != acis))
+        {
+                dxf_acis_free (body->acis);
+        }
+        body->acis = acis;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (body);
+}
+
+
 /*!
  * \brief Get the modeler format version number from a DXF \c BODY entity.
  *
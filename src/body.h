@@ -44,6 +44,7 @@
 
 
 #include "global.h"
+#include "acis.h"
 #include "binary_data.h"
 #include "proprietary_data.h"
 
@@ -199,6 +200,12 @@ dxf_body_struct
                  * Additional lines of proprietary data if previous
                  * group 1 string is greater than 255 characters
                  * (optional).*/
+        DxfAcis *acis;
+                /*!< Proprietary data (group codes 1 and 3) as read with
+                 * the ACIS mode of the DXF file, see
+                 * dxf_file_set_acis_mode ().\n
+                 * Written instead of \c proprietary_data and
+                 * \c additional_proprietary_data when not \c NULL. */
         int16_t modeler_format_version_number;
                 /*!< group code = 70\n
                  * Modeler format version number (currently = 1).\n */
@@ -260,6 +267,8 @@ DxfBinaryData *dxf_body_get_proprietary_data (DxfBody *body);
 DxfBody *dxf_body_set_proprietary_data (DxfBody *body, DxfBinaryData *proprietary_data);
 DxfBinaryData *dxf_body_get_additional_proprietary_data (DxfBody *body);
 DxfBody *dxf_body_set_additional_proprietary_data (DxfBody *body, DxfBinaryData *additional_proprietary_data);
+DxfAcis *dxf_body_get_acis (DxfBody *body);
+DxfBody *dxf_body_set_acis (DxfBody *body, DxfAcis *acis);
 int16_t dxf_body_get_modeler_format_version_number (DxfBody *body);
 DxfBody *dxf_body_set_modeler_format_version_number (DxfBody *body, int16_t modeler_format_version_number);
 DxfBody *dxf_body_get_next (DxfBody *body);
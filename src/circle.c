@@ -42,6 +42,7 @@
 
 
 #include "circle.h"
+#include "util.h"
 
 
 /*!
@@ -64,7 +65,7 @@ dxf_circle_new ()
         size = sizeof (DxfCircle);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((circle = malloc (size)) == NULL)
+        if ((circle = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -105,22 +106,22 @@ dxf_circle_init
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 circle = dxf_circle_new ();
         }
         if (circle == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         /* Assign initial values to members. */
         circle->id_code = 0;
-        circle->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        circle->layer = strdup (DXF_DEFAULT_LAYER);
+        circle->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        circle->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         circle->elevation = 0.0;
         circle->thickness = 0.0;
         circle->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -129,18 +130,23 @@ dxf_circle_init
         circle->paperspace = DXF_MODELSPACE;
         circle->graphics_data_size = 0;
         circle->shadow_mode = 0;
-        circle->dictionary_owner_soft = strdup ("");
-        circle->object_owner_soft = strdup ("");
-        circle->material = strdup ("");
-        circle->dictionary_owner_hard = strdup ("");
+        circle->dictionary_owner_soft = dxf_strdup ("");
+        circle->object_owner_soft = dxf_strdup ("");
+        circle->material = dxf_strdup ("");
+        circle->dictionary_owner_hard = dxf_strdup ("");
         circle->lineweight = 0;
-        circle->plot_style_name = strdup ("");
+        circle->plot_style_name = dxf_strdup ("");
         circle->color_value = 0;
-        circle->color_name = strdup ("");
+        circle->color_name = dxf_strdup ("");
         circle->transparency = 0;
-        circle->p0->x0 = 0.0;
-        circle->p0->y0 = 0.0;
-        circle->p0->z0 = 0.0;
+        circle->p0 = dxf_point_init (dxf_point_new ());
+        if (circle->p0 == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         circle->radius = 0.0;
         circle->extr_x0 = 0.0;
         circle->extr_y0 = 0.0;
@@ -148,7 +154,6 @@ dxf_circle_init
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         circle->binary_graphics_data = NULL;
-        circle->p0 = NULL;
         circle->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -183,38 +188,35 @@ dxf_circle_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int iter330;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (circle == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 circle = dxf_circle_init (circle);
         }
         if (circle->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfBinaryData struct.\n")));
                 circle->binary_graphics_data = dxf_binary_data_init (circle->binary_graphics_data);
                 if (circle->binary_graphics_data == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -222,34 +224,31 @@ dxf_circle_read
         }
         if (circle->p0 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 circle->p0 = dxf_point_init (circle->p0);
                 if (circle->p0 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
                 }
         }
-        iter310 = (DxfBinaryData *) circle->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        memset (temp_string, 0, sizeof (temp_string));
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -264,13 +263,17 @@ dxf_circle_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->linetype);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (circle->linetype);
+                        circle->linetype = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->layer);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (circle->layer);
+                        circle->layer = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -361,7 +364,7 @@ dxf_circle_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && (strcmp (temp_string, "AcDbCircle") != 0))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -406,9 +409,8 @@ dxf_circle_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_data_append_hex ((DxfBinaryData *) circle->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -417,14 +419,18 @@ dxf_circle_read
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
                                 (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->dictionary_owner_soft);
+                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                                dxf_free (circle->dictionary_owner_soft);
+                                circle->dictionary_owner_soft = dxf_strdup (temp_string);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
                                 (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->object_owner_soft);
+                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                                dxf_free (circle->object_owner_soft);
+                                circle->object_owner_soft = dxf_strdup (temp_string);
                         }
                         iter330++;
                 }
@@ -433,14 +439,18 @@ dxf_circle_read
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->material);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (circle->material);
+                        circle->material = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->dictionary_owner_hard);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (circle->dictionary_owner_hard);
+                        circle->dictionary_owner_hard = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -454,7 +464,9 @@ dxf_circle_read
                         /* Now follows a string containing a plot style
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->plot_style_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (circle->plot_style_name);
+                        circle->plot_style_name = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -467,7 +479,9 @@ dxf_circle_read
                         /* Now follows a string containing a color
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->color_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (circle->color_name);
+                        circle->color_name = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -485,22 +499,25 @@ dxf_circle_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
+                        dxf_read_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (circle->linetype, "") == 0)
         {
-                circle->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_free (circle->linetype);
+                circle->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (circle->layer, "") == 0)
         {
-                circle->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_free (circle->layer);
+                circle->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -526,50 +543,50 @@ dxf_circle_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("CIRCLE");
+        char *dxf_entity_name = dxf_strdup ("CIRCLE");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (circle == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (circle->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, circle->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                circle->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                circle->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (circle->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, circle->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name );
-                circle->layer = strdup (DXF_DEFAULT_LAYER);
+                circle->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (circle->radius == 0.0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () radius value equals 0.0 for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, circle->id_code);
         }
@@ -649,16 +666,7 @@ dxf_circle_write
 #else
                 fprintf (fp->fp, " 92\n%" PRIi32 "\n", circle->graphics_data_size);
 #endif
-                if (circle->binary_graphics_data != NULL)
-                {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) circle->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
-                }
+                dxf_binary_data_write (fp, (DxfBinaryData *) circle->binary_graphics_data);
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
@@ -699,7 +707,7 @@ dxf_circle_write
                 fprintf (fp->fp, "230\n%f\n", circle->extr_z0);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -730,24 +738,24 @@ dxf_circle_free
 #endif
         if (circle == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (circle->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("ERROR in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (circle->linetype);
-        free (circle->layer);
+        dxf_free (circle->linetype);
+        dxf_free (circle->layer);
         dxf_binary_data_free (circle->binary_graphics_data);
-        free (circle->dictionary_owner_soft);
-        free (circle->dictionary_owner_hard);
-        free (circle);
+        dxf_free (circle->dictionary_owner_soft);
+        dxf_free (circle->dictionary_owner_hard);
+        dxf_free (circle);
         circle = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -771,18 +779,19 @@ dxf_circle_free_list
                  * entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (circles == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (circles != NULL)
         {
                 DxfCircle *iter = (DxfCircle *) circles->next;
+                circles->next = NULL;
                 dxf_circle_free (circles);
                 circles = (DxfCircle *) iter;
         }
@@ -909,7 +918,7 @@ dxf_circle_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->linetype));
+        return (dxf_strdup (circle->linetype));
 }
 
 
@@ -946,7 +955,7 @@ dxf_circle_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->linetype = strdup (linetype);
+        circle->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -990,7 +999,7 @@ dxf_circle_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->layer));
+        return (dxf_strdup (circle->layer));
 }
 
 
@@ -1027,7 +1036,7 @@ dxf_circle_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->layer = strdup (layer);
+        circle->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1845,7 +1854,7 @@ dxf_circle_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->dictionary_owner_soft));
+        return (dxf_strdup (circle->dictionary_owner_soft));
 }
 
 
@@ -1884,7 +1893,7 @@ dxf_circle_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        circle->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1931,7 +1940,7 @@ dxf_circle_get_object_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->object_owner_soft));
+        return (dxf_strdup (circle->object_owner_soft));
 }
 
 
@@ -1970,7 +1979,7 @@ dxf_circle_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->object_owner_soft = strdup (object_owner_soft);
+        circle->object_owner_soft = dxf_strdup (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2018,7 +2027,7 @@ dxf_circle_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->material));
+        return (dxf_strdup (circle->material));
 }
 
 
@@ -2059,7 +2068,7 @@ dxf_circle_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->material = strdup (material);
+        circle->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2106,7 +2115,7 @@ dxf_circle_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->dictionary_owner_hard));
+        return (dxf_strdup (circle->dictionary_owner_hard));
 }
 
 
@@ -2145,7 +2154,7 @@ dxf_circle_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        circle->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2261,7 +2270,7 @@ dxf_circle_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->plot_style_name));
+        return (dxf_strdup (circle->plot_style_name));
 }
 
 
@@ -2302,7 +2311,7 @@ dxf_circle_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->plot_style_name = strdup (plot_style_name);
+        circle->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2418,7 +2427,7 @@ dxf_circle_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->color_name));
+        return (dxf_strdup (circle->color_name));
 }
 
 
@@ -2459,7 +2468,7 @@ dxf_circle_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->color_name = strdup (color_name);
+        circle->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2553,7 +2562,7 @@ dxf_circle_get_p0
                 /*!< a pointer to a DXF \c CIRCLE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2595,7 +2604,7 @@ dxf_circle_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2637,7 +2646,7 @@ dxf_circle_get_x0
                 /*!< a pointer to a DXF \c CIRCLE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2683,7 +2692,7 @@ dxf_circle_set_x0
                  * \c CIRCLE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2734,7 +2743,7 @@ dxf_circle_get_y0
                 /*!< a pointer to a DXF \c CIRCLE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2780,7 +2789,7 @@ dxf_circle_set_y0
                  * \c CIRCLE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2831,7 +2840,7 @@ dxf_circle_get_z0
                 /*!< a pointer to a DXF \c CIRCLE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2877,7 +2886,7 @@ dxf_circle_set_z0
                  * \c CIRCLE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3021,7 +3030,7 @@ dxf_circle_get_extrusion_vector_as_point
                 /*!< a pointer to a DXF \c CIRCLE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *point = NULL;
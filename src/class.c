@@ -63,7 +63,7 @@ dxf_class_new ()
         size = sizeof (DxfClass);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((class = malloc (size)) == NULL)
+        if ((class = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfClass struct.\n")),
@@ -101,22 +101,22 @@ dxf_class_init
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 class = dxf_class_new ();
         }
         if (class == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfClass struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        class->record_type = strdup ("");
-        class->record_name = strdup ("");
-        class->class_name = strdup ("");
-        class->app_name = strdup ("");
+        class->record_type = dxf_strdup ("");
+        class->record_name = dxf_strdup ("");
+        class->class_name = dxf_strdup ("");
+        class->app_name = dxf_strdup ("");
         class->proxy_cap_flag = 0;
         class->was_a_proxy_flag = 0;
         class->is_an_entity_flag = 0;
@@ -156,16 +156,16 @@ dxf_class_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (class == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 class = dxf_class_init (class);
@@ -176,12 +176,12 @@ dxf_class_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "0") == 0)
@@ -247,15 +247,16 @@ dxf_class_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (class->record_type, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty record type string after reading from: %s before line: %d.\n")),
                   __FUNCTION__, fp->filename, fp->line_number);
                 return (NULL);
@@ -263,20 +264,20 @@ dxf_class_read
         }
         if (strcmp (class->record_name, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty record name string after reading from: %s before line: %d.\n")),
                   __FUNCTION__, fp->filename, fp->line_number);
                 return (NULL);
         }
         if (strcmp (class->class_name, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty class name string after reading from: %s before line: %d.\n")),
                   __FUNCTION__, fp->filename, fp->line_number);
                 return (NULL);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -302,66 +303,66 @@ dxf_class_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("CLASS");
+        char *dxf_entity_name = dxf_strdup ("CLASS");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (class == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((!class->record_type)
                 || (strcmp (class->record_type, "") == 0))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty record type string for the %s entity\n")),
                   __FUNCTION__, dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((!class->class_name)
                 || (strcmp (class->class_name, "") == 0))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty class name string for the %s entity\n")),
                   __FUNCTION__, dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (!class->record_name)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty record name string for the %s entity\n")),
                   __FUNCTION__, dxf_entity_name);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\trecord_name of %s entity is reset to \"\"")),
                   dxf_entity_name );
-                class->record_name = strdup ("");
+                class->record_name = dxf_strdup ("");
         }
         if (!class->app_name)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty app name string for the %s entity\n")),
                   __FUNCTION__, dxf_entity_name);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\tapp_name of %s entity is reset to \"\"")),
                   dxf_entity_name );
-                class->app_name = strdup ("");
+                class->app_name = dxf_strdup ("");
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -375,7 +376,7 @@ dxf_class_write
         fprintf (fp->fp, "280\n%hd\n", class->was_a_proxy_flag);
         fprintf (fp->fp, "281\n%hd\n", class->is_an_entity_flag);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -436,23 +437,23 @@ dxf_class_free
 #endif
         if (class == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (class->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (class->record_type);
-        free (class->record_name);
-        free (class->class_name);
-        free (class->app_name);
-        free (class);
+        dxf_free (class->record_type);
+        dxf_free (class->record_name);
+        dxf_free (class->class_name);
+        dxf_free (class->app_name);
+        dxf_free (class);
         class = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -473,18 +474,19 @@ dxf_class_free_list
                  * classes. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (classes == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (classes != NULL)
         {
                 DxfClass *iter = (DxfClass *) classes->next;
+                classes->next = NULL;
                 dxf_class_free (classes);
                 classes = (DxfClass *) iter;
         }
@@ -526,7 +528,7 @@ dxf_class_get_record_type
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (class->record_type);
+        result = dxf_strdup (class->record_type);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -564,7 +566,7 @@ dxf_class_set_record_type
                   __FUNCTION__);
                 return (NULL);
         }
-        class->record_type = strdup (record_type);
+        class->record_type = dxf_strdup (record_type);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -604,7 +606,7 @@ dxf_class_get_record_name
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (class->record_name);
+        result = dxf_strdup (class->record_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -642,7 +644,7 @@ dxf_class_set_record_name
                   __FUNCTION__);
                 return (NULL);
         }
-        class->record_name = strdup (record_name);
+        class->record_name = dxf_strdup (record_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -682,7 +684,7 @@ dxf_class_get_class_name
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (class->class_name);
+        result = dxf_strdup (class->class_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -720,7 +722,7 @@ dxf_class_set_class_name
                   __FUNCTION__);
                 return (NULL);
         }
-        class->class_name = strdup (class_name);
+        class->class_name = dxf_strdup (class_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -760,7 +762,7 @@ dxf_class_get_app_name
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (class->app_name);
+        result = dxf_strdup (class->app_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -799,7 +801,7 @@ dxf_class_set_app_name
                   __FUNCTION__);
                 return (NULL);
         }
-        class->app_name = strdup (app_name);
+        class->app_name = dxf_strdup (app_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -55,6 +55,26 @@ extern "C" {
 #endif
 
 
+#define DXF_COLOR_NEAREST_GRID_SIZE 8
+        /*!< \brief Number of levels per channel in a cell of the
+         * nearest ACI lookup grid, a divisor of 256. */
+#define DXF_COLOR_NEAREST_GRID_CELLS (256 / DXF_COLOR_NEAREST_GRID_SIZE)
+        /*!< \brief Number of cells per channel of the nearest ACI
+         * lookup grid. */
+
+
+/*!
+ * \brief Definition of a named color.
+ */
+typedef struct
+{
+        int triplet;
+                /*!< Hexadecimal triplet of the color (0xRRGGBB). */
+        const char *name;
+                /*!< Name of the color. */
+} DxfRGBColorName;
+
+
 /*!
  * \brief Definition of a color.
  */
@@ -76,10 +96,13 @@ typedef struct
 } DxfRGBColor;
 
 
-char *dxf_RGB_color_get_name (int RGB_color_hex_triplet);
+const char *dxf_RGB_color_get_name (int RGB_color_hex_triplet);
+int dxf_RGB_color_get_triplet (const char *name);
 DxfRGBColor *dxf_RGB_color_new ();
 DxfRGBColor *dxf_RGB_color_set (int red, int green, int blue);
 int dxf_ACI_init (DxfRGBColor *ACI[DXF_COLOR_INDEX_MAX_NUMBER_OF_COLORS]);
+int dxf_aci_to_rgb (int color);
+int dxf_rgb_to_nearest_aci (int RGB_color_hex_triplet);
 int dxf_RGB_to_triplet (int red, int green, int blue);
 int dxf_RGB_color_free (DxfRGBColor *RGB_color);
 void dxf_RGB_color_free_list (DxfRGBColor *colors);
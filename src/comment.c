@@ -50,7 +50,7 @@
 DxfComment *
 dxf_comment_new ()
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfComment *comment = NULL;
@@ -59,7 +59,7 @@ dxf_comment_new ()
         size = sizeof (DxfComment);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((comment = malloc (size)) == NULL)
+        if ((comment = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfComment struct.\n")),
@@ -70,7 +70,7 @@ dxf_comment_new ()
         {
                 memset (comment, 0, size);
         }
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_END
 #endif
         return (comment);
@@ -91,28 +91,28 @@ dxf_comment_init
                 /*!< a pointer to the DXF \c COMMENT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (comment == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 comment = dxf_comment_new ();
         }
         if (comment == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfComment struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         dxf_comment_set_id_code (comment, 0);
-        dxf_comment_set_value (comment, strdup (""));
+        dxf_comment_set_value (comment, dxf_strdup (""));
         dxf_comment_set_next (comment, NULL);
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_END
 #endif
         return (comment);
@@ -150,7 +150,7 @@ dxf_comment_write
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -184,27 +184,27 @@ dxf_comment_free
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (comment == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (comment->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (dxf_comment_get_value (comment));
-        free (comment);
+        dxf_free (dxf_comment_get_value (comment));
+        dxf_free (comment);
         comment = NULL;
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_END
 #endif
         return (EXIT_SUCCESS);
@@ -223,18 +223,19 @@ dxf_comment_free_list
                  * \c COMMENT entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (comments == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (comments != NULL)
         {
                 DxfComment *iter = (DxfComment *) comments->next;
+                comments->next = NULL;
                 dxf_comment_free (comments);
                 comments = (DxfComment *) iter;
         }
@@ -331,7 +332,7 @@ dxf_comment_get_value
                 /*!< a pointer to the DXF \c COMMENT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (comment == NULL)
@@ -367,7 +368,7 @@ dxf_comment_set_value
                 /*!< the comment value (string) to be set.*/
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (comment == NULL)
@@ -384,7 +385,7 @@ dxf_comment_set_value
                 __FUNCTION__);
               return (NULL);
         }
-        comment->value = strdup (value);
+        comment->value = dxf_strdup (value);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -0,0 +1,1058 @@
+/*!
+ * \file compress.c
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for compressed DXF input and output streams.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+        /* fopencookie () */
+#endif
+
+#include "compress.h"
+
+#if defined (DXF_HAVE_ZLIB)
+#include <zlib.h>
+#endif
+#if defined (DXF_HAVE_ZSTD)
+#define ZSTD_STATIC_LINKING_ONLY
+        /* ZSTD_customMem and the _advanced constructors. */
+#include <zstd.h>
+#endif
+#if !defined (_WIN32)
+#include <unistd.h>
+#endif
+#if defined (__APPLE__) || defined (__FreeBSD__) || defined (__NetBSD__) || defined (__OpenBSD__)
+#define DXF_COMPRESS_FUNOPEN 1
+#elif defined (__GLIBC__) || defined (__CYGWIN__)
+#define DXF_COMPRESS_FOPENCOOKIE 1
+#endif
+
+
+#if defined (DXF_HAVE_ZLIB) || defined (DXF_HAVE_ZSTD)
+/*!
+ * \brief State of a compressed stream.
+ *
+ * The compressed data is read from, or written to, \c fp, the
+ * decompressed data is exchanged with the stdio buffer of the stream
+ * returned to the caller.
+ */
+typedef struct
+dxf_compress_stream_struct
+{
+        FILE *fp;
+                /*!< File holding the compressed data. */
+        DxfCompression compression;
+                /*!< Compression format. */
+        int writing;
+                /*!< \c TRUE for an output stream. */
+        unsigned char *buffer;
+                /*!< Buffer of compressed data. */
+        size_t offset;
+                /*!< Offset of the first unused byte in \c buffer. */
+        size_t length;
+                /*!< Number of bytes in \c buffer. */
+        long position;
+                /*!< Offset in the decompressed data. */
+        int eof;
+                /*!< \c TRUE when all of \c fp has been read. */
+        int complete;
+                /*!< \c TRUE when the decompressor stands at the end of
+                 * a gzip member or zstd frame. */
+        int failed;
+                /*!< \c TRUE when an error has been reported. */
+#if defined (DXF_HAVE_ZLIB)
+        z_stream zlib;
+                /*!< zlib state. */
+#endif
+#if defined (DXF_HAVE_ZSTD)
+        ZSTD_DCtx *zstd_in;
+                /*!< zstd decompression state. */
+        ZSTD_CCtx *zstd_out;
+                /*!< zstd compression state. */
+#endif
+} DxfCompressStream;
+
+
+#if defined (DXF_HAVE_ZLIB)
+/*!
+ * \brief zlib allocation function, zlib allocates through the libDXF
+ * allocator hooks.
+ */
+static voidpf
+dxf_compress_zalloc
+(
+        voidpf opaque,
+        uInt items,
+        uInt size
+)
+{
+        (void) opaque;
+        return (dxf_calloc ((size_t) items, (size_t) size));
+}
+
+
+/*!
+ * \brief zlib free function.
+ */
+static void
+dxf_compress_zfree
+(
+        voidpf opaque,
+        voidpf address
+)
+{
+        (void) opaque;
+        dxf_free (address);
+}
+#endif
+
+
+#if defined (DXF_HAVE_ZSTD)
+/*!
+ * \brief zstd allocation function, zstd allocates through the libDXF
+ * allocator hooks.
+ */
+static void *
+dxf_compress_zstd_alloc
+(
+        void *opaque,
+        size_t size
+)
+{
+        (void) opaque;
+        return (dxf_malloc (size));
+}
+
+
+/*!
+ * \brief zstd free function.
+ */
+static void
+dxf_compress_zstd_free
+(
+        void *opaque,
+        void *address
+)
+{
+        (void) opaque;
+        dxf_free (address);
+}
+
+
+/*!
+ * \brief Allocation functions passed to the zstd (de)compression
+ * contexts.
+ */
+static const ZSTD_customMem dxf_compress_zstd_mem =
+{
+        dxf_compress_zstd_alloc,
+        dxf_compress_zstd_free,
+        NULL
+};
+#endif
+
+
+/*!
+ * \brief Free a compressed stream, \c fp is not closed.
+ */
+static void
+dxf_compress_stream_free
+(
+        DxfCompressStream *stream
+)
+{
+        switch (stream->compression)
+        {
+#if defined (DXF_HAVE_ZLIB)
+                case DXF_COMPRESSION_GZIP:
+                        if (stream->writing)
+                        {
+                                deflateEnd (&stream->zlib);
+                        }
+                        else
+                        {
+                                inflateEnd (&stream->zlib);
+                        }
+                        break;
+#endif
+#if defined (DXF_HAVE_ZSTD)
+                case DXF_COMPRESSION_ZSTD:
+                        ZSTD_freeDCtx (stream->zstd_in);
+                        ZSTD_freeCCtx (stream->zstd_out);
+                        break;
+#endif
+                default:
+                        break;
+        }
+        dxf_free (stream->buffer);
+        dxf_free (stream);
+}
+
+
+/*!
+ * \brief Allocate a compressed stream for \c fp and initialize the
+ * (de)compressor.
+ *
+ * \return a pointer to the stream, or \c NULL when an error occurred.
+ */
+static DxfCompressStream *
+dxf_compress_stream_new
+(
+        FILE *fp,
+        DxfCompression compression,
+        int writing,
+        int level
+)
+{
+        DxfCompressStream *stream = NULL;
+        int result = EXIT_FAILURE;
+#if defined (DXF_HAVE_ZSTD) && !defined (_WIN32)
+        long number_of_workers;
+#endif
+
+        stream = dxf_malloc (sizeof (DxfCompressStream));
+        if (stream == NULL)
+        {
+                return (NULL);
+        }
+        memset (stream, 0, sizeof (DxfCompressStream));
+        stream->fp = fp;
+        stream->compression = compression;
+        stream->writing = writing;
+        stream->buffer = dxf_malloc (DXF_COMPRESS_BUFFER_SIZE);
+        if (stream->buffer == NULL)
+        {
+                dxf_free (stream);
+                return (NULL);
+        }
+        switch (compression)
+        {
+#if defined (DXF_HAVE_ZLIB)
+                case DXF_COMPRESSION_GZIP:
+                        stream->zlib.zalloc = dxf_compress_zalloc;
+                        stream->zlib.zfree = dxf_compress_zfree;
+                        stream->zlib.opaque = Z_NULL;
+                        if (writing)
+                        {
+                                /* 16 + MAX_WBITS writes a gzip wrapper. */
+                                result = (deflateInit2 (&stream->zlib,
+                                  (level > 0) ? level : Z_DEFAULT_COMPRESSION,
+                                  Z_DEFLATED, 16 + MAX_WBITS, 8,
+                                  Z_DEFAULT_STRATEGY) == Z_OK)
+                                  ? EXIT_SUCCESS : EXIT_FAILURE;
+                        }
+                        else
+                        {
+                                /* 32 + MAX_WBITS detects a gzip or zlib
+                                 * wrapper. */
+                                result = (inflateInit2 (&stream->zlib,
+                                  32 + MAX_WBITS) == Z_OK)
+                                  ? EXIT_SUCCESS : EXIT_FAILURE;
+                        }
+                        break;
+#endif
+#if defined (DXF_HAVE_ZSTD)
+                case DXF_COMPRESSION_ZSTD:
+                        if (writing)
+                        {
+                                stream->zstd_out = ZSTD_createCCtx_advanced (dxf_compress_zstd_mem);
+                                if (stream->zstd_out != NULL)
+                                {
+                                        ZSTD_CCtx_setParameter (stream->zstd_out,
+                                          ZSTD_c_compressionLevel, level);
+#if !defined (_WIN32)
+                                        /* Compress on all processors,
+                                         * libzstd builds without thread
+                                         * support ignore this. */
+                                        number_of_workers = sysconf (_SC_NPROCESSORS_ONLN);
+                                        if (number_of_workers > 1)
+                                        {
+                                                ZSTD_CCtx_setParameter (stream->zstd_out,
+                                                  ZSTD_c_nbWorkers, (int) number_of_workers);
+                                        }
+#endif
+                                        result = EXIT_SUCCESS;
+                                }
+                        }
+                        else
+                        {
+                                stream->zstd_in = ZSTD_createDCtx_advanced (dxf_compress_zstd_mem);
+                                result = (stream->zstd_in != NULL)
+                                  ? EXIT_SUCCESS : EXIT_FAILURE;
+                        }
+                        break;
+#endif
+                default:
+                        break;
+        }
+        if (result != EXIT_SUCCESS)
+        {
+                stream->compression = DXF_COMPRESSION_NONE;
+                dxf_compress_stream_free (stream);
+                return (NULL);
+        }
+        return (stream);
+}
+
+
+/*!
+ * \brief Decompress up to \c size bytes from \c stream to \c data.
+ *
+ * Compressed data ending inside a gzip member or zstd frame is
+ * truncated and reported as an error.\n
+ * An error is reported once, later reads return the end of the data,
+ * so loops testing feof () terminate.
+ *
+ * \return the number of bytes decompressed, 0 at the end of the
+ * compressed data, or -1 when an error occurred.
+ */
+static long
+dxf_compress_stream_read
+(
+        DxfCompressStream *stream,
+        char *data,
+        size_t size
+)
+{
+        size_t produced = 0;
+#if defined (DXF_HAVE_ZLIB)
+        int status;
+#endif
+#if defined (DXF_HAVE_ZSTD)
+        ZSTD_inBuffer in;
+        ZSTD_outBuffer out;
+        size_t hint;
+#endif
+
+        if (stream->failed)
+        {
+                return (0);
+        }
+        while ((produced == 0) && (size > 0))
+        {
+                if ((stream->offset == stream->length) && !stream->eof)
+                {
+                        stream->offset = 0;
+                        stream->length = fread (stream->buffer, 1,
+                          DXF_COMPRESS_BUFFER_SIZE, stream->fp);
+                        if (stream->length == 0)
+                        {
+                                if (ferror (stream->fp))
+                                {
+                                        stream->failed = TRUE;
+                                        return (-1);
+                                }
+                                stream->eof = TRUE;
+                        }
+                }
+                if (stream->eof && stream->complete)
+                {
+                        break;
+                }
+                /* At the end of the file the decompressor is still
+                 * called to flush its pending output. */
+                switch (stream->compression)
+                {
+#if defined (DXF_HAVE_ZLIB)
+                        case DXF_COMPRESSION_GZIP:
+                                stream->zlib.next_in = stream->buffer + stream->offset;
+                                stream->zlib.avail_in = (uInt) (stream->length - stream->offset);
+                                stream->zlib.next_out = (Bytef *) data;
+                                stream->zlib.avail_out = (uInt) size;
+                                status = inflate (&stream->zlib, Z_NO_FLUSH);
+                                stream->offset = stream->length - stream->zlib.avail_in;
+                                produced = size - stream->zlib.avail_out;
+                                stream->complete = (status == Z_STREAM_END);
+                                if (status == Z_STREAM_END)
+                                {
+                                        /* Concatenated gzip members
+                                         * form a single stream. */
+                                        inflateReset (&stream->zlib);
+                                }
+                                else if ((status != Z_OK) && (status != Z_BUF_ERROR))
+                                {
+                                        stream->failed = TRUE;
+                                        return (-1);
+                                }
+                                break;
+#endif
+#if defined (DXF_HAVE_ZSTD)
+                        case DXF_COMPRESSION_ZSTD:
+                                in.src = stream->buffer;
+                                in.size = stream->length;
+                                in.pos = stream->offset;
+                                out.dst = data;
+                                out.size = size;
+                                out.pos = 0;
+                                hint = ZSTD_decompressStream (stream->zstd_in, &out, &in);
+                                if (ZSTD_isError (hint))
+                                {
+                                        stream->failed = TRUE;
+                                        return (-1);
+                                }
+                                stream->offset = in.pos;
+                                produced = out.pos;
+                                stream->complete = (hint == 0);
+                                break;
+#endif
+                        default:
+                                stream->failed = TRUE;
+                                return (-1);
+                }
+                if (stream->eof && (produced == 0))
+                {
+                        /* Nothing left to flush and no more input,
+                         * the compressed data is truncated. */
+                        stream->failed = TRUE;
+                        return (-1);
+                }
+        }
+        stream->position += (long) produced;
+        return ((long) produced);
+}
+
+
+/*!
+ * \brief Compress \c size bytes of \c data to \c stream, or finish the
+ * compressed data when \c finish is \c TRUE.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_compress_stream_write
+(
+        DxfCompressStream *stream,
+        const char *data,
+        size_t size,
+        int finish
+)
+{
+        size_t length;
+#if defined (DXF_HAVE_ZLIB)
+        int status;
+#endif
+#if defined (DXF_HAVE_ZSTD)
+        ZSTD_inBuffer in;
+        ZSTD_outBuffer out;
+        size_t remaining;
+#endif
+
+        switch (stream->compression)
+        {
+#if defined (DXF_HAVE_ZLIB)
+                case DXF_COMPRESSION_GZIP:
+                        stream->zlib.next_in = (Bytef *) data;
+                        stream->zlib.avail_in = (uInt) size;
+                        do
+                        {
+                                stream->zlib.next_out = stream->buffer;
+                                stream->zlib.avail_out = DXF_COMPRESS_BUFFER_SIZE;
+                                status = deflate (&stream->zlib, finish ? Z_FINISH : Z_NO_FLUSH);
+                                if (status == Z_STREAM_ERROR)
+                                {
+                                        return (EXIT_FAILURE);
+                                }
+                                length = DXF_COMPRESS_BUFFER_SIZE - stream->zlib.avail_out;
+                                if (fwrite (stream->buffer, 1, length, stream->fp) != length)
+                                {
+                                        return (EXIT_FAILURE);
+                                }
+                        }
+                        while ((stream->zlib.avail_in > 0)
+                          || (stream->zlib.avail_out == 0)
+                          || (finish && (status != Z_STREAM_END)));
+                        break;
+#endif
+#if defined (DXF_HAVE_ZSTD)
+                case DXF_COMPRESSION_ZSTD:
+                        in.src = data;
+                        in.size = size;
+                        in.pos = 0;
+                        do
+                        {
+                                out.dst = stream->buffer;
+                                out.size = DXF_COMPRESS_BUFFER_SIZE;
+                                out.pos = 0;
+                                remaining = ZSTD_compressStream2 (stream->zstd_out,
+                                  &out, &in, finish ? ZSTD_e_end : ZSTD_e_continue);
+                                if (ZSTD_isError (remaining))
+                                {
+                                        return (EXIT_FAILURE);
+                                }
+                                if (fwrite (stream->buffer, 1, out.pos, stream->fp) != out.pos)
+                                {
+                                        return (EXIT_FAILURE);
+                                }
+                        }
+                        while ((in.pos < in.size) || (finish && (remaining > 0)));
+                        break;
+#endif
+                default:
+                        return (EXIT_FAILURE);
+        }
+        stream->position += (long) size;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Move the decompressed offset of \c stream to \c position.
+ *
+ * Compressed data can only be read forward, a position before the
+ * current position restarts the decompression at the begin of the
+ * file, the data up to \c position is decompressed and discarded.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred or \c position is beyond the end of the data.
+ */
+static int
+dxf_compress_stream_seek
+(
+        DxfCompressStream *stream,
+        long position
+)
+{
+        char scratch[4096];
+        long count;
+        size_t size;
+
+        if (stream->writing)
+        {
+                return ((position == stream->position) ? EXIT_SUCCESS : EXIT_FAILURE);
+        }
+        if (position < stream->position)
+        {
+                if (fseek (stream->fp, 0, SEEK_SET) != 0)
+                {
+                        return (EXIT_FAILURE);
+                }
+                switch (stream->compression)
+                {
+#if defined (DXF_HAVE_ZLIB)
+                        case DXF_COMPRESSION_GZIP:
+                                inflateReset (&stream->zlib);
+                                break;
+#endif
+#if defined (DXF_HAVE_ZSTD)
+                        case DXF_COMPRESSION_ZSTD:
+                                ZSTD_DCtx_reset (stream->zstd_in, ZSTD_reset_session_only);
+                                break;
+#endif
+                        default:
+                                break;
+                }
+                stream->offset = 0;
+                stream->length = 0;
+                stream->position = 0;
+                stream->eof = FALSE;
+                stream->complete = FALSE;
+                stream->failed = FALSE;
+        }
+        while (stream->position < position)
+        {
+                size = sizeof (scratch);
+                if ((long) size > position - stream->position)
+                {
+                        size = (size_t) (position - stream->position);
+                }
+                count = dxf_compress_stream_read (stream, scratch, size);
+                if (count <= 0)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Finish an output stream and free the stream, \c fp is
+ * closed.
+ *
+ * \return 0 when done, or \c EOF when an error occurred.
+ */
+static int
+dxf_compress_stream_close
+(
+        DxfCompressStream *stream
+)
+{
+        int result = 0;
+
+        if (stream->writing
+          && (dxf_compress_stream_write (stream, NULL, 0, TRUE) != EXIT_SUCCESS))
+        {
+                result = EOF;
+        }
+        if (fclose (stream->fp) != 0)
+        {
+                result = EOF;
+        }
+        dxf_compress_stream_free (stream);
+        return (result);
+}
+
+
+#if defined (DXF_COMPRESS_FOPENCOOKIE)
+static ssize_t
+dxf_compress_cookie_read
+(
+        void *cookie,
+        char *data,
+        size_t size
+)
+{
+        return ((ssize_t) dxf_compress_stream_read ((DxfCompressStream *) cookie,
+          data, size));
+}
+
+
+static ssize_t
+dxf_compress_cookie_write
+(
+        void *cookie,
+        const char *data,
+        size_t size
+)
+{
+        if (dxf_compress_stream_write ((DxfCompressStream *) cookie, data,
+          size, FALSE) != EXIT_SUCCESS)
+        {
+                return (0);
+        }
+        return ((ssize_t) size);
+}
+
+
+static int
+dxf_compress_cookie_seek
+(
+        void *cookie,
+        off64_t *offset,
+        int whence
+)
+{
+        DxfCompressStream *stream = (DxfCompressStream *) cookie;
+        long position;
+
+        switch (whence)
+        {
+                case SEEK_SET:
+                        position = (long) *offset;
+                        break;
+                case SEEK_CUR:
+                        position = stream->position + (long) *offset;
+                        break;
+                default:
+                        return (-1);
+        }
+        if (dxf_compress_stream_seek (stream, position) != EXIT_SUCCESS)
+        {
+                return (-1);
+        }
+        *offset = (off64_t) stream->position;
+        return (0);
+}
+
+
+static int
+dxf_compress_cookie_close
+(
+        void *cookie
+)
+{
+        return (dxf_compress_stream_close ((DxfCompressStream *) cookie));
+}
+#elif defined (DXF_COMPRESS_FUNOPEN)
+static int
+dxf_compress_funopen_read
+(
+        void *cookie,
+        char *data,
+        int size
+)
+{
+        return ((int) dxf_compress_stream_read ((DxfCompressStream *) cookie,
+          data, (size_t) size));
+}
+
+
+static int
+dxf_compress_funopen_write
+(
+        void *cookie,
+        const char *data,
+        int size
+)
+{
+        if (dxf_compress_stream_write ((DxfCompressStream *) cookie, data,
+          (size_t) size, FALSE) != EXIT_SUCCESS)
+        {
+                return (-1);
+        }
+        return (size);
+}
+
+
+static fpos_t
+dxf_compress_funopen_seek
+(
+        void *cookie,
+        fpos_t offset,
+        int whence
+)
+{
+        DxfCompressStream *stream = (DxfCompressStream *) cookie;
+        long position;
+
+        switch (whence)
+        {
+                case SEEK_SET:
+                        position = (long) offset;
+                        break;
+                case SEEK_CUR:
+                        position = stream->position + (long) offset;
+                        break;
+                default:
+                        return (-1);
+        }
+        if (dxf_compress_stream_seek (stream, position) != EXIT_SUCCESS)
+        {
+                return (-1);
+        }
+        return ((fpos_t) stream->position);
+}
+
+
+static int
+dxf_compress_funopen_close
+(
+        void *cookie
+)
+{
+        return (dxf_compress_stream_close ((DxfCompressStream *) cookie));
+}
+#endif
+
+
+/*!
+ * \brief Wrap \c stream in a stdio stream.
+ *
+ * Without custom stdio streams (Windows) an input stream is
+ * decompressed into a temporary file, output is not supported.
+ *
+ * \return the stdio stream, or \c NULL when an error occurred, \c stream
+ * is freed then and its \c fp is left open for the caller to close.
+ */
+static FILE *
+dxf_compress_stream_open
+(
+        DxfCompressStream *stream
+)
+{
+        FILE *fp = NULL;
+#if defined (DXF_COMPRESS_FOPENCOOKIE)
+        cookie_io_functions_t functions;
+
+        memset (&functions, 0, sizeof (functions));
+        functions.read = stream->writing ? NULL : dxf_compress_cookie_read;
+        functions.write = stream->writing ? dxf_compress_cookie_write : NULL;
+        functions.seek = dxf_compress_cookie_seek;
+        functions.close = dxf_compress_cookie_close;
+        fp = fopencookie (stream, stream->writing ? "w" : "r", functions);
+#elif defined (DXF_COMPRESS_FUNOPEN)
+        fp = funopen (stream,
+          stream->writing ? NULL : dxf_compress_funopen_read,
+          stream->writing ? dxf_compress_funopen_write : NULL,
+          dxf_compress_funopen_seek, dxf_compress_funopen_close);
+#else
+        char data[4096];
+        long count;
+
+        if (!stream->writing)
+        {
+                fp = tmpfile ();
+                while ((fp != NULL)
+                  && ((count = dxf_compress_stream_read (stream, data, sizeof (data))) > 0))
+                {
+                        fwrite (data, 1, (size_t) count, fp);
+                }
+                if ((fp != NULL) && ((count < 0) || ferror (fp)))
+                {
+                        fclose (fp);
+                        fp = NULL;
+                }
+        }
+        if (fp == NULL)
+        {
+                dxf_compress_stream_free (stream);
+                return (NULL);
+        }
+        /* The temporary file replaces the compressed file. */
+        rewind (fp);
+        dxf_compress_stream_close (stream);
+        return (fp);
+#endif
+        if (fp == NULL)
+        {
+                dxf_compress_stream_free (stream);
+                return (NULL);
+        }
+        setvbuf (fp, NULL, _IOFBF, DXF_COMPRESS_BUFFER_SIZE);
+        return (fp);
+}
+#endif
+
+
+/*!
+ * \brief Detect the compression format of the file \c fp from its
+ * magic bytes.
+ *
+ * \c fp is rewound to the begin of the file.
+ *
+ * \return the compression format, \c DXF_COMPRESSION_NONE for a plain
+ * file.
+ */
+DxfCompression
+dxf_compress_detect
+(
+        FILE *fp
+                /*!< a file opened for reading, positioned at the
+                 * begin. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        unsigned char magic[4];
+        size_t size;
+        DxfCompression compression = DXF_COMPRESSION_NONE;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (DXF_COMPRESSION_NONE);
+        }
+        size = fread (magic, 1, sizeof (magic), fp);
+        if ((size >= 2) && (magic[0] == 0x1f) && (magic[1] == 0x8b))
+        {
+                compression = DXF_COMPRESSION_GZIP;
+        }
+        else if ((size == 4) && (magic[0] == 0x28) && (magic[1] == 0xb5)
+          && (magic[2] == 0x2f) && (magic[3] == 0xfd))
+        {
+                compression = DXF_COMPRESSION_ZSTD;
+        }
+        rewind (fp);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (compression);
+}
+
+
+/*!
+ * \brief Test if libDXF was built with support for \c compression.
+ *
+ * \return \c TRUE when supported, \c FALSE otherwise.
+ */
+int
+dxf_compress_is_supported
+(
+        DxfCompression compression
+                /*!< compression format. */
+)
+{
+        switch (compression)
+        {
+                case DXF_COMPRESSION_NONE:
+                        return (TRUE);
+#if defined (DXF_HAVE_ZLIB)
+                case DXF_COMPRESSION_GZIP:
+                        return (TRUE);
+#endif
+#if defined (DXF_HAVE_ZSTD)
+                case DXF_COMPRESSION_ZSTD:
+                        return (TRUE);
+#endif
+                default:
+                        return (FALSE);
+        }
+}
+
+
+/*!
+ * \brief Open a stream decompressing the file \c fp.
+ *
+ * The data is decompressed in blocks of \c DXF_COMPRESS_BUFFER_SIZE
+ * bytes while it is read from the returned stream, which owns \c fp
+ * and closes it with fclose ().\n
+ * ftell () returns offsets in the decompressed data, fseek () moves
+ * forward by decompressing, backward by restarting at the begin of
+ * the file.
+ *
+ * \return the decompressed stream, or \c NULL when an error occurred,
+ * \c fp is not closed then.
+ */
+FILE *
+dxf_compress_open_read
+(
+        FILE *fp,
+                /*!< a file holding compressed data, positioned at the
+                 * begin. */
+        DxfCompression compression
+                /*!< compression format of \c fp. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((compression == DXF_COMPRESSION_NONE)
+          || !dxf_compress_is_supported (compression))
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () compression format %d is not supported.\n")),
+                  __FUNCTION__, (int) compression);
+                return (NULL);
+        }
+#if defined (DXF_HAVE_ZLIB) || defined (DXF_HAVE_ZSTD)
+        {
+                DxfCompressStream *stream;
+                FILE *result;
+
+                stream = dxf_compress_stream_new (fp, compression, FALSE, 0);
+                if (stream == NULL)
+                {
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+                result = dxf_compress_stream_open (stream);
+#if DEBUG
+                DXF_DEBUG_END
+#endif
+                return (result);
+        }
+#else
+        return (NULL);
+#endif
+}
+
+
+/*!
+ * \brief Open a stream compressing to the file \c fp.
+ *
+ * The data written to the returned stream is compressed in blocks of
+ * \c DXF_COMPRESS_BUFFER_SIZE bytes, zstd compression runs on all
+ * processors when libzstd supports threads.\n
+ * The returned stream owns \c fp, fclose () finishes the compressed
+ * data and closes \c fp.\n
+ * The stream is not seekable.
+ *
+ * \return the compressing stream, or \c NULL when an error occurred,
+ * \c fp is not closed then.
+ */
+FILE *
+dxf_compress_open_write
+(
+        FILE *fp,
+                /*!< a file opened for writing in binary mode. */
+        DxfCompression compression,
+                /*!< compression format. */
+        int level
+                /*!< compression level, 0 for the default level of the
+                 * format. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((compression == DXF_COMPRESSION_NONE)
+          || !dxf_compress_is_supported (compression))
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () compression format %d is not supported.\n")),
+                  __FUNCTION__, (int) compression);
+                return (NULL);
+        }
+#if (defined (DXF_HAVE_ZLIB) || defined (DXF_HAVE_ZSTD)) \
+  && (defined (DXF_COMPRESS_FOPENCOOKIE) || defined (DXF_COMPRESS_FUNOPEN))
+        {
+                DxfCompressStream *stream;
+                FILE *result;
+
+                stream = dxf_compress_stream_new (fp, compression, TRUE, level);
+                if (stream == NULL)
+                {
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+                result = dxf_compress_stream_open (stream);
+#if DEBUG
+                DXF_DEBUG_END
+#endif
+                return (result);
+        }
+#else
+        (void) level;
+        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+          (_("Error in %s () compressed output is not supported on this platform.\n")),
+          __FUNCTION__);
+        return (NULL);
+#endif
+}
+
+
+/* EOF */
@@ -0,0 +1,85 @@
+/*!
+ * \file compress.h
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for compressed DXF input and output streams.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_COMPRESS_H
+#define LIBDXF_SRC_COMPRESS_H
+
+
+#include "global.h"
+
+
+#define DXF_COMPRESS_BUFFER_SIZE 65536
+        /*!< \brief Size of the buffers of compressed data and of the
+         * decompressed stream. */
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief Compression formats of DXF files.
+ *
+ * gzip streams are supported when libDXF is built with zlib
+ * (\c DXF_HAVE_ZLIB), zstd streams when libDXF is built with libzstd
+ * (\c DXF_HAVE_ZSTD).
+ */
+typedef enum
+dxf_compression
+{
+        DXF_COMPRESSION_NONE,
+                /*!< Plain DXF file. */
+        DXF_COMPRESSION_GZIP,
+                /*!< gzip stream (RFC 1952). */
+        DXF_COMPRESSION_ZSTD
+                /*!< Zstandard stream (RFC 8878). */
+} DxfCompression;
+
+
+DxfCompression dxf_compress_detect (FILE *fp);
+int dxf_compress_is_supported (DxfCompression compression);
+FILE *dxf_compress_open_read (FILE *fp, DxfCompression compression);
+FILE *dxf_compress_open_write (FILE *fp, DxfCompression compression, int level);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_COMPRESS_H */
+
+
+/* EOF */
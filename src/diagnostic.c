@@ -0,0 +1,159 @@
+/*!
+ * \file diagnostic.c
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for the diagnostics of libDXF.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "global.h"
+#include "stats.h"
+
+
+#define DXF_DIAGNOSTIC_MAX_LENGTH 1024
+        /*!< \brief Maximum length of a diagnostic message. */
+
+
+/*!
+ * \brief The receiver of the diagnostic messages.
+ *
+ * Messages are printed on \c stderr without a callback.
+ */
+static struct
+{
+        DxfDiagnosticCallback callback;
+        void *user;
+} dxf_diagnostic_receiver = {NULL, NULL};
+
+
+/*!
+ * \brief Set the callback receiving the diagnostic messages of libDXF.
+ *
+ * Pass \c NULL to print the messages on \c stderr again.\n
+ * The callback is global and can be invoked from any thread reading or
+ * writing a file.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_set_diagnostic_callback
+(
+        DxfDiagnosticCallback callback,
+                /*!< the callback, or \c NULL. */
+        void *user
+                /*!< user data passed to the callback. */
+)
+{
+        dxf_diagnostic_receiver.callback = callback;
+        dxf_diagnostic_receiver.user = user;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Deliver a formatted message.
+ */
+static void
+dxf_diagnostic_deliver
+(
+        DxfDiagnosticLevel level,
+        const char *function,
+        const char *message
+)
+{
+        if (dxf_diagnostic_receiver.callback == NULL)
+        {
+                fputs (message, stderr);
+                return;
+        }
+        dxf_diagnostic_receiver.callback (level, function, message,
+          dxf_diagnostic_receiver.user);
+}
+
+
+/*!
+ * \brief Report a diagnostic message, use the DXF_DIAGNOSTIC macro.
+ *
+ * At most \c DXF_DIAGNOSTIC_RATE messages per second are delivered from
+ * a call site, the number of suppressed messages is reported with the
+ * first message of the next second.\n
+ * Suppressed messages are not formatted.
+ */
+void
+dxf_diagnostic_report
+(
+        DxfDiagnosticSite *site,
+                /*!< rate limit state of the call site. */
+        DxfDiagnosticLevel level,
+                /*!< level of the message. */
+        const char *function,
+                /*!< function reporting the message. */
+        const char *format,
+                /*!< \c printf style format of the message. */
+        ...
+)
+{
+        char message[DXF_DIAGNOSTIC_MAX_LENGTH];
+        va_list arguments;
+        int64_t now;
+        int64_t window_start;
+        int suppressed;
+
+        now = dxf_stats_now ();
+        window_start = __atomic_load_n (&site->window_start, __ATOMIC_RELAXED);
+        if ((now - window_start >= 1000000000)
+          && __atomic_compare_exchange_n (&site->window_start, &window_start,
+          now, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        {
+                __atomic_store_n (&site->count, 0, __ATOMIC_RELAXED);
+                suppressed = __atomic_exchange_n (&site->suppressed, 0,
+                  __ATOMIC_RELAXED);
+                if (suppressed > 0)
+                {
+                        snprintf (message, sizeof (message),
+                          (_("Note: %d similar messages of %s () were suppressed.\n")),
+                          suppressed, function);
+                        dxf_diagnostic_deliver (DXF_DIAGNOSTIC_NOTE,
+                          function, message);
+                }
+        }
+        if (__atomic_add_fetch (&site->count, 1, __ATOMIC_RELAXED) > DXF_DIAGNOSTIC_RATE)
+        {
+                __atomic_add_fetch (&site->suppressed, 1, __ATOMIC_RELAXED);
+                return;
+        }
+        va_start (arguments, format);
+        vsnprintf (message, sizeof (message), format, arguments);
+        va_end (arguments);
+        dxf_diagnostic_deliver (level, function, message);
+}
+
+
+/* EOF */
@@ -0,0 +1,107 @@
+/*!
+ * \file diagnostic.h
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Definition of the diagnostics of libDXF.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_DIAGNOSTIC_H
+#define LIBDXF_SRC_DIAGNOSTIC_H
+
+
+#include <stdint.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_DIAGNOSTIC_RATE 10
+        /*!< \brief Maximum number of messages per second from a single
+         * call site, further messages are counted and suppressed. */
+
+
+/*!
+ * \brief Levels of diagnostic messages.
+ */
+typedef enum
+dxf_diagnostic_level
+{
+        DXF_DIAGNOSTIC_ERROR,
+        DXF_DIAGNOSTIC_WARNING,
+        DXF_DIAGNOSTIC_NOTE
+} DxfDiagnosticLevel;
+
+
+typedef void (*DxfDiagnosticCallback) (DxfDiagnosticLevel level, const char *function, const char *message, void *user);
+        /*!< \brief Receive a diagnostic \c message of \c function. */
+
+
+/*!
+ * \brief The rate limit state of a call site, see DXF_DIAGNOSTIC.
+ */
+typedef struct
+dxf_diagnostic_site_struct
+{
+        int64_t window_start;
+                /*!< start of the current second in nanoseconds. */
+        int count;
+                /*!< number of messages in the current second. */
+        int suppressed;
+                /*!< number of messages suppressed in the current
+                 * second. */
+} DxfDiagnosticSite;
+
+
+#define DXF_DIAGNOSTIC(level, ...) \
+        do \
+        { \
+                static DxfDiagnosticSite dxf_diagnostic_site; \
+                dxf_diagnostic_report (&dxf_diagnostic_site, (level), \
+                  __FUNCTION__, __VA_ARGS__); \
+        } while (0)
+        /*!< \brief Report a diagnostic message with a \c printf style
+         * format and arguments, rate limited per call site. */
+
+
+int dxf_set_diagnostic_callback (DxfDiagnosticCallback callback, void *user);
+void dxf_diagnostic_report (DxfDiagnosticSite *site, DxfDiagnosticLevel level, const char *function, const char *format, ...);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_DIAGNOSTIC_H */
+
+
+/* EOF */
@@ -52,7 +52,7 @@
 DxfDictionary *
 dxf_dictionary_new ()
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfDictionary *dictionary = NULL;
@@ -61,7 +61,7 @@ dxf_dictionary_new ()
         size = sizeof (DxfDictionary);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((dictionary = malloc (size)) == NULL)
+        if ((dictionary = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfDictionary struct.\n")),
@@ -72,7 +72,7 @@ dxf_dictionary_new ()
         {
                 memset (dictionary, 0, size);
         }
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_END
 #endif
         return (dictionary);
@@ -99,23 +99,23 @@ dxf_dictionary_init
         /* Do some basic checks. */
         if (dictionary == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 dictionary = dxf_dictionary_new ();
         }
         if (dictionary == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         dictionary->id_code = 0;
-        dictionary->dictionary_owner_soft = strdup ("");
-        dictionary->dictionary_owner_hard = strdup ("");
-        dictionary->entry_name = strdup ("");
-        dictionary->entry_object_handle = strdup ("");
+        dictionary->dictionary_owner_soft = dxf_strdup ("");
+        dictionary->dictionary_owner_hard = dxf_strdup ("");
+        dictionary->entry_name = dxf_strdup ("");
+        dictionary->entry_object_handle = dxf_strdup ("");
         dictionary->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -151,22 +151,22 @@ dxf_dictionary_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (dictionary == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 dictionary = dxf_dictionary_init (dictionary);
@@ -177,11 +177,11 @@ dxf_dictionary_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -208,7 +208,7 @@ dxf_dictionary_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "AcDbDictionary") != 0)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -243,13 +243,14 @@ dxf_dictionary_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -275,39 +276,39 @@ dxf_dictionary_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("DICTIONARY");
+        char *dxf_entity_name = dxf_strdup ("DICTIONARY");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dictionary == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (dictionary->entry_name, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty entry name string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dictionary->id_code);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, dictionary->id_code);
         }
@@ -348,7 +349,7 @@ dxf_dictionary_write
         fprintf (fp->fp, "  3\n%s\n", dictionary->entry_name);
         fprintf (fp->fp, "350\n%s\n", dictionary->entry_object_handle);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -377,23 +378,23 @@ dxf_dictionary_free
         /* Do some basic checks. */
         if (dictionary == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dictionary->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (dictionary->dictionary_owner_soft);
-        free (dictionary->dictionary_owner_hard);
-        free (dictionary->entry_name);
-        free (dictionary->entry_object_handle);
-        free (dictionary);
+        dxf_free (dictionary->dictionary_owner_soft);
+        dxf_free (dictionary->dictionary_owner_hard);
+        dxf_free (dictionary->entry_name);
+        dxf_free (dictionary->entry_object_handle);
+        dxf_free (dictionary);
         dictionary = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -414,18 +415,19 @@ dxf_dictionary_free_list
                  * \c DICTIONARY objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (dictionaries == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (dictionaries != NULL)
         {
                 DxfDictionary *iter = (DxfDictionary *) dictionaries->next;
+                dictionaries->next = NULL;
                 dxf_dictionary_free (dictionaries);
                 dictionaries = (DxfDictionary *) iter;
         }
@@ -546,7 +548,7 @@ dxf_dictionary_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dictionary->dictionary_owner_soft));
+        return (dxf_strdup (dictionary->dictionary_owner_soft));
 }
 
 
@@ -582,7 +584,7 @@ dxf_dictionary_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        dictionary->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        dictionary->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -626,7 +628,7 @@ dxf_dictionary_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dictionary->dictionary_owner_hard));
+        return (dxf_strdup (dictionary->dictionary_owner_hard));
 }
 
 
@@ -662,7 +664,7 @@ dxf_dictionary_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        dictionary->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        dictionary->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -703,7 +705,7 @@ dxf_dictionary_get_entry_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dictionary->entry_name));
+        return (dxf_strdup (dictionary->entry_name));
 }
 
 
@@ -737,7 +739,7 @@ dxf_dictionary_set_entry_name
                   __FUNCTION__);
                 return (NULL);
         }
-        dictionary->entry_name = strdup (entry_name);
+        dictionary->entry_name = dxf_strdup (entry_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -778,7 +780,7 @@ dxf_dictionary_get_entry_object_handle
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dictionary->entry_object_handle));
+        return (dxf_strdup (dictionary->entry_object_handle));
 }
 
 
@@ -813,7 +815,7 @@ dxf_dictionary_set_entry_object_handle
                   __FUNCTION__);
                 return (NULL);
         }
-        dictionary->entry_object_handle = strdup (entry_object_handle);
+        dictionary->entry_object_handle = dxf_strdup (entry_object_handle);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -52,7 +52,7 @@
 DxfDictionaryVar *
 dxf_dictionaryvar_new ()
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfDictionaryVar *dictionaryvar = NULL;
@@ -61,7 +61,7 @@ dxf_dictionaryvar_new ()
         size = sizeof (DxfDictionaryVar);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((dictionaryvar = malloc (size)) == NULL)
+        if ((dictionaryvar = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -72,7 +72,7 @@ dxf_dictionaryvar_new ()
         {
                 memset (dictionaryvar, 0, size);
         }
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_END
 #endif
         return (dictionaryvar);
@@ -99,23 +99,23 @@ dxf_dictionaryvar_init
         /* Do some basic checks. */
         if (dictionaryvar == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 dictionaryvar = dxf_dictionaryvar_new ();
         }
         if (dictionaryvar == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         dxf_dictionaryvar_set_id_code (dictionaryvar, 0);
-        dxf_dictionaryvar_set_value (dictionaryvar, strdup (""));
-        dxf_dictionaryvar_set_object_schema_number (dictionaryvar, strdup (""));
-        dxf_dictionaryvar_set_dictionary_owner_soft (dictionaryvar, strdup (""));
-        dxf_dictionaryvar_set_dictionary_owner_hard (dictionaryvar, strdup (""));
+        dxf_dictionaryvar_set_value (dictionaryvar, dxf_strdup (""));
+        dxf_dictionaryvar_set_object_schema_number (dictionaryvar, dxf_strdup (""));
+        dxf_dictionaryvar_set_dictionary_owner_soft (dictionaryvar, dxf_strdup (""));
+        dxf_dictionaryvar_set_dictionary_owner_hard (dictionaryvar, dxf_strdup (""));
         dxf_dictionaryvar_set_next (dictionaryvar, NULL);
 #if DEBUG
         DXF_DEBUG_END
@@ -151,22 +151,22 @@ dxf_dictionaryvar_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (dictionaryvar == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 dictionaryvar = dxf_dictionaryvar_init (dictionaryvar);
@@ -177,11 +177,11 @@ dxf_dictionaryvar_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -208,7 +208,7 @@ dxf_dictionaryvar_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "DictionaryVariables") != 0)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -243,13 +243,14 @@ dxf_dictionaryvar_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -275,42 +276,42 @@ dxf_dictionaryvar_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("DICTIONARYVAR");
+        char *dxf_entity_name = dxf_strdup ("DICTIONARYVAR");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dictionaryvar == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (dxf_dictionaryvar_get_value (dictionaryvar), "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty value string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_dictionaryvar_get_id_code (dictionaryvar));
         }
         if (strcmp (dxf_dictionaryvar_get_object_schema_number (dictionaryvar), "0") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty object schema number string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_dictionaryvar_get_id_code (dictionaryvar));
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, dxf_dictionaryvar_get_id_code (dictionaryvar));
         }
@@ -351,7 +352,7 @@ dxf_dictionaryvar_write
         fprintf (fp->fp, "280\n%s\n", dxf_dictionaryvar_get_object_schema_number (dictionaryvar));
         fprintf (fp->fp, "  1\n%s\n", dxf_dictionaryvar_get_value (dictionaryvar));
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -380,23 +381,23 @@ dxf_dictionaryvar_free
         /* Do some basic checks. */
         if (dictionaryvar == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dxf_dictionaryvar_get_next (dictionaryvar) != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (dxf_dictionaryvar_get_dictionary_owner_soft (dictionaryvar));
-        free (dxf_dictionaryvar_get_dictionary_owner_hard (dictionaryvar));
-        free (dxf_dictionaryvar_get_value (dictionaryvar));
-        free (dxf_dictionaryvar_get_object_schema_number (dictionaryvar));
-        free (dictionaryvar);
+        dxf_free (dxf_dictionaryvar_get_dictionary_owner_soft (dictionaryvar));
+        dxf_free (dxf_dictionaryvar_get_dictionary_owner_hard (dictionaryvar));
+        dxf_free (dxf_dictionaryvar_get_value (dictionaryvar));
+        dxf_free (dxf_dictionaryvar_get_object_schema_number (dictionaryvar));
+        dxf_free (dictionaryvar);
         dictionaryvar = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -417,18 +418,19 @@ dxf_dictionaryvar_free_list
                  * \c DICTIONARYVAR objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (dictionaryvars == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (dictionaryvars != NULL)
         {
                 DxfDictionaryVar *iter = (DxfDictionaryVar *) dictionaryvars->next;
+                dictionaryvars->next = NULL;
                 dxf_dictionaryvar_free (dictionaryvars);
                 dictionaryvars = (DxfDictionaryVar *) iter;
         }
@@ -549,7 +551,7 @@ dxf_dictionaryvar_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dictionaryvar->dictionary_owner_soft));
+        return (dxf_strdup (dictionaryvar->dictionary_owner_soft));
 }
 
 
@@ -585,7 +587,7 @@ dxf_dictionaryvar_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        dictionaryvar->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        dictionaryvar->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -629,7 +631,7 @@ dxf_dictionaryvar_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dictionaryvar->dictionary_owner_hard));
+        return (dxf_strdup (dictionaryvar->dictionary_owner_hard));
 }
 
 
@@ -665,7 +667,7 @@ dxf_dictionaryvar_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        dictionaryvar->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        dictionaryvar->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -706,7 +708,7 @@ dxf_dictionaryvar_get_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dictionaryvar->value));
+        return (dxf_strdup (dictionaryvar->value));
 }
 
 
@@ -740,7 +742,7 @@ dxf_dictionaryvar_set_value
                   __FUNCTION__);
                 return (NULL);
         }
-        dictionaryvar->value = strdup (value);
+        dictionaryvar->value = dxf_strdup (value);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -783,7 +785,7 @@ dxf_dictionaryvar_get_object_schema_number
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dictionaryvar->object_schema_number));
+        return (dxf_strdup (dictionaryvar->object_schema_number));
 }
 
 
@@ -818,7 +820,7 @@ dxf_dictionaryvar_set_object_schema_number
                   __FUNCTION__);
                 return (NULL);
         }
-        dictionaryvar->object_schema_number = strdup (object_schema_number);
+        dictionaryvar->object_schema_number = dxf_strdup (object_schema_number);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -63,7 +63,7 @@ dxf_dimension_new ()
         size = sizeof (DxfDimension);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((dimension = malloc (size)) == NULL)
+        if ((dimension = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -102,22 +102,22 @@ dxf_dimension_init
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 dimension = dxf_dimension_new ();
         }
         if (dimension == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         /* Assign initial values to members. */
         dimension->id_code = 0;
-        dimension->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        dimension->layer = strdup (DXF_DEFAULT_LAYER);
+        dimension->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        dimension->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         dimension->elevation = 0.0;
         dimension->thickness = 0.0;
         dimension->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -126,18 +126,18 @@ dxf_dimension_init
         dimension->paperspace = DXF_PAPERSPACE;
         dimension->graphics_data_size = 0;
         dimension->shadow_mode = 0;
-        dimension->dictionary_owner_soft = strdup ("");
-        dimension->object_owner_soft = strdup ("");
-        dimension->material = strdup ("");
-        dimension->dictionary_owner_hard = strdup ("");
+        dimension->dictionary_owner_soft = dxf_strdup ("");
+        dimension->object_owner_soft = dxf_strdup ("");
+        dimension->material = dxf_strdup ("");
+        dimension->dictionary_owner_hard = dxf_strdup ("");
         dimension->lineweight = 0;
-        dimension->plot_style_name = strdup ("");
+        dimension->plot_style_name = dxf_strdup ("");
         dimension->color_value = 0;
-        dimension->color_name = strdup ("");
+        dimension->color_name = dxf_strdup ("");
         dimension->transparency = 0;
-        dimension->dim_text = strdup ("");
-        dimension->dimblock_name = strdup ("");
-        dimension->dimstyle_name = strdup ("");
+        dimension->dim_text = dxf_strdup ("");
+        dimension->dimblock_name = dxf_strdup ("");
+        dimension->dimstyle_name = dxf_strdup ("");
         dimension->p0->x0 = 0.0;
         dimension->p0->y0 = 0.0;
         dimension->p0->z0 = 0.0;
@@ -215,37 +215,36 @@ dxf_dimension_read
         DXF_DEBUG_BEGIN
 #endif
         char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
         int iter330;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 dimension = dxf_dimension_init (dimension);
         }
         if (dimension->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfBinaryData struct.\n")));
                 dimension->binary_graphics_data = dxf_binary_data_init (dimension->binary_graphics_data);
                 if (dimension->binary_graphics_data == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -253,15 +252,15 @@ dxf_dimension_read
         }
         if (dimension->p0 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 dimension->p0 = dxf_point_init (dimension->p0);
                 if (dimension->p0 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -269,15 +268,15 @@ dxf_dimension_read
         }
         if (dimension->p1 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 dimension->p1 = dxf_point_init (dimension->p1);
                 if (dimension->p1 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -285,15 +284,15 @@ dxf_dimension_read
         }
         if (dimension->p2 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 dimension->p2 = dxf_point_init (dimension->p2);
                 if (dimension->p2 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -301,15 +300,15 @@ dxf_dimension_read
         }
         if (dimension->p3 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 dimension->p3 = dxf_point_init (dimension->p3);
                 if (dimension->p3 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -317,15 +316,15 @@ dxf_dimension_read
         }
         if (dimension->p4 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 dimension->p4 = dxf_point_init (dimension->p4);
                 if (dimension->p4 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -333,15 +332,15 @@ dxf_dimension_read
         }
         if (dimension->p5 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 dimension->p5 = dxf_point_init (dimension->p5);
                 if (dimension->p5 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -349,21 +348,20 @@ dxf_dimension_read
         }
         if (dimension->p6 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 dimension->p6 = dxf_point_init (dimension->p6);
                 if (dimension->p6 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
                 }
         }
-        iter310 = (DxfBinaryData *) dimension->binary_graphics_data;
         iter330 = 0;
         (fp->line_number)++;
         fscanf (fp->fp, "%[^\n]", temp_string);
@@ -371,12 +369,12 @@ dxf_dimension_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
@@ -721,7 +719,7 @@ dxf_dimension_read
                           && (strcmp (temp_string, "AcDbRadialDimension") != 0)
                           && (strcmp (temp_string, "AcDbOrdinateDimension") != 0))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -773,9 +771,8 @@ dxf_dimension_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_data_append_hex ((DxfBinaryData *) dimension->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -852,22 +849,23 @@ dxf_dimension_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (dxf_dimension_get_linetype (dimension), "") == 0)
         {
-                dxf_dimension_set_linetype (dimension, strdup (DXF_DEFAULT_LINETYPE));
+                dxf_dimension_set_linetype (dimension, dxf_strdup (DXF_DEFAULT_LINETYPE));
         }
         if (strcmp (dxf_dimension_get_layer (dimension), "") == 0)
         {
-                dxf_dimension_set_layer (dimension, strdup (DXF_DEFAULT_LAYER));
+                dxf_dimension_set_layer (dimension, dxf_strdup (DXF_DEFAULT_LAYER));
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -894,45 +892,45 @@ dxf_dimension_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("DIMENSION");
+        char *dxf_entity_name = dxf_strdup ("DIMENSION");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((dimension->flag > 6)
           || (dimension->flag < 0))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
         }
         if (strcmp (dimension->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dimension->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                dimension->layer = strdup (DXF_DEFAULT_LAYER);
+                dimension->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -1010,16 +1008,7 @@ dxf_dimension_write
 #else
                 fprintf (fp->fp, " 92\n%" PRIi32 "\n", dimension->graphics_data_size);
 #endif
-                if (dimension->binary_graphics_data != NULL)
-                {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) dimension->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
-                }
+                dxf_binary_data_write (fp, (DxfBinaryData *) dimension->binary_graphics_data);
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
@@ -1186,7 +1175,7 @@ dxf_dimension_write
                 fprintf (fp->fp, " 39\n%f\n", dimension->thickness);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1215,31 +1204,31 @@ dxf_dimension_free
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (dimension->linetype);
-        free (dimension->layer);
+        dxf_free (dimension->linetype);
+        dxf_free (dimension->layer);
         dxf_binary_data_free_list (dimension->binary_graphics_data);
-        free (dimension->dim_text);
-        free (dimension->dimblock_name);
-        free (dimension->dimstyle_name);
-        free (dimension->dictionary_owner_soft);
-        free (dimension->object_owner_soft);
-        free (dimension->material);
-        free (dimension->dictionary_owner_hard);
-        free (dimension->plot_style_name);
-        free (dimension->color_name);
-        free (dimension);
+        dxf_free (dimension->dim_text);
+        dxf_free (dimension->dimblock_name);
+        dxf_free (dimension->dimstyle_name);
+        dxf_free (dimension->dictionary_owner_soft);
+        dxf_free (dimension->object_owner_soft);
+        dxf_free (dimension->material);
+        dxf_free (dimension->dictionary_owner_hard);
+        dxf_free (dimension->plot_style_name);
+        dxf_free (dimension->color_name);
+        dxf_free (dimension);
         dimension = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -1260,19 +1249,20 @@ dxf_dimension_free_list
                  * \c DIMENSION entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (dimensions == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return;
         }
         while (dimensions != NULL)
         {
-                DxfDimension *iter = (DxfDimension *) dxf_dimension_get_next (dimensions);
+                DxfDimension *iter = (DxfDimension *) dimensions->next;
+                dimensions->next = NULL;
                 dxf_dimension_free (dimensions);
                 dimensions = (DxfDimension *) iter;
         }
@@ -1393,7 +1383,7 @@ dxf_dimension_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->linetype));
+        return (dxf_strdup (dimension->linetype));
 }
 
 
@@ -1430,7 +1420,7 @@ dxf_dimension_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->linetype = strdup (linetype);
+        dimension->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1471,7 +1461,7 @@ dxf_dimension_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->layer));
+        return (dxf_strdup (dimension->layer));
 }
 
 
@@ -1508,7 +1498,7 @@ dxf_dimension_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->layer = strdup (layer);
+        dimension->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2288,7 +2278,7 @@ dxf_dimension_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->dictionary_owner_soft));
+        return (dxf_strdup (dimension->dictionary_owner_soft));
 }
 
 
@@ -2327,7 +2317,7 @@ dxf_dimension_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        dimension->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2371,7 +2361,7 @@ dxf_dimension_get_object_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->object_owner_soft));
+        return (dxf_strdup (dimension->object_owner_soft));
 }
 
 
@@ -2407,7 +2397,7 @@ dxf_dimension_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->object_owner_soft = strdup (object_owner_soft);
+        dimension->object_owner_soft = dxf_strdup (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2451,7 +2441,7 @@ dxf_dimension_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->material));
+        return (dxf_strdup (dimension->material));
 }
 
 
@@ -2490,7 +2480,7 @@ dxf_dimension_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->material = strdup (material);
+        dimension->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2535,7 +2525,7 @@ dxf_dimension_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->dictionary_owner_hard));
+        return (dxf_strdup (dimension->dictionary_owner_hard));
 }
 
 
@@ -2574,7 +2564,7 @@ dxf_dimension_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        dimension->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2681,7 +2671,7 @@ dxf_dimension_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->plot_style_name));
+        return (dxf_strdup (dimension->plot_style_name));
 }
 
 
@@ -2719,7 +2709,7 @@ dxf_dimension_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->plot_style_name = strdup (plot_style_name);
+        dimension->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2826,7 +2816,7 @@ dxf_dimension_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->color_name));
+        return (dxf_strdup (dimension->color_name));
 }
 
 
@@ -2864,7 +2854,7 @@ dxf_dimension_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->color_name = strdup (color_name);
+        dimension->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2971,7 +2961,7 @@ dxf_dimension_get_dim_text
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->dim_text));
+        return (dxf_strdup (dimension->dim_text));
 }
 
 
@@ -3008,7 +2998,7 @@ dxf_dimension_set_dim_text
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->dim_text = strdup (dim_text);
+        dimension->dim_text = dxf_strdup (dim_text);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3050,7 +3040,7 @@ dxf_dimension_get_dimblock_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->dimblock_name));
+        return (dxf_strdup (dimension->dimblock_name));
 }
 
 
@@ -3087,7 +3077,7 @@ dxf_dimension_set_dimblock_name
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->dimblock_name = strdup (dimblock_name);
+        dimension->dimblock_name = dxf_strdup (dimblock_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3129,7 +3119,7 @@ dxf_dimension_get_dimstyle_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->dimstyle_name));
+        return (dxf_strdup (dimension->dimstyle_name));
 }
 
 
@@ -3166,7 +3156,7 @@ dxf_dimension_set_dimstyle_name
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->dimblock_name = strdup (dimstyle_name);
+        dimension->dimblock_name = dxf_strdup (dimstyle_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3188,7 +3178,7 @@ dxf_dimension_get_p0
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3229,7 +3219,7 @@ dxf_dimension_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3269,7 +3259,7 @@ dxf_dimension_get_x0
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3310,7 +3300,7 @@ dxf_dimension_set_x0
                 /*!< the X-value \c x0 of the definition point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3359,7 +3349,7 @@ dxf_dimension_get_y0
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3400,7 +3390,7 @@ dxf_dimension_set_y0
                 /*!< the Y-value \c y0 of the definition point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3449,7 +3439,7 @@ dxf_dimension_get_z0
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3490,7 +3480,7 @@ dxf_dimension_set_z0
                 /*!< the Z-value \c z0 of the definition point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3539,7 +3529,7 @@ dxf_dimension_get_p1
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3580,7 +3570,7 @@ dxf_dimension_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3620,7 +3610,7 @@ dxf_dimension_get_x1
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3661,7 +3651,7 @@ dxf_dimension_set_x1
                 /*!< the X-value \c x1 of the middle point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3710,7 +3700,7 @@ dxf_dimension_get_y1
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3751,7 +3741,7 @@ dxf_dimension_set_y1
                 /*!< the Y-value \c y1 of the middle point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3801,7 +3791,7 @@ dxf_dimension_get_z1
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3842,7 +3832,7 @@ dxf_dimension_set_z1
                 /*!< the Z-coordinate value \c z1 of the middle point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3891,7 +3881,7 @@ dxf_dimension_get_p2
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3932,7 +3922,7 @@ dxf_dimension_set_p2
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3972,7 +3962,7 @@ dxf_dimension_get_x2
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4013,7 +4003,7 @@ dxf_dimension_set_x2
                 /*!< the X-value \c x2 of the definition point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4062,7 +4052,7 @@ dxf_dimension_get_y2
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4104,7 +4094,7 @@ dxf_dimension_set_y2
                  * point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4153,7 +4143,7 @@ dxf_dimension_get_z2
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4194,7 +4184,7 @@ dxf_dimension_set_z2
                 /*!< the Z-value \c z2 of the definition point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4243,7 +4233,7 @@ dxf_dimension_get_p3
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4284,7 +4274,7 @@ dxf_dimension_set_p3
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4324,7 +4314,7 @@ dxf_dimension_get_x3
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4366,7 +4356,7 @@ dxf_dimension_set_x3
                  * point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4415,7 +4405,7 @@ dxf_dimension_get_y3
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4457,7 +4447,7 @@ dxf_dimension_set_y3
                  * point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4506,7 +4496,7 @@ dxf_dimension_get_z3
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4548,7 +4538,7 @@ dxf_dimension_set_z3
                  * point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4597,7 +4587,7 @@ dxf_dimension_get_p4
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4638,7 +4628,7 @@ dxf_dimension_set_p4
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4678,7 +4668,7 @@ dxf_dimension_get_x4
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4719,7 +4709,7 @@ dxf_dimension_set_x4
                 /*!< the X-value \c x4 of the definition point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4768,7 +4758,7 @@ dxf_dimension_get_y4
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4809,7 +4799,7 @@ dxf_dimension_set_y4
                 /*!< the Y-value \c y4 of the definition point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4858,7 +4848,7 @@ dxf_dimension_get_z4
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4899,7 +4889,7 @@ dxf_dimension_set_z4
                 /*!< the Z-value \c z4 of the definition point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4948,7 +4938,7 @@ dxf_dimension_get_p5
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4989,7 +4979,7 @@ dxf_dimension_set_p5
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5029,7 +5019,7 @@ dxf_dimension_get_x5
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5070,7 +5060,7 @@ dxf_dimension_set_x5
                 /*!< the X-value \c x5 of the definition point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5119,7 +5109,7 @@ dxf_dimension_get_y5
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5160,7 +5150,7 @@ dxf_dimension_set_y5
                 /*!< the Y-value \c y5 of the definition point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5209,7 +5199,7 @@ dxf_dimension_get_z5
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5250,7 +5240,7 @@ dxf_dimension_set_z5
                 /*!< the Z-value \c z5 of the definition point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5299,7 +5289,7 @@ dxf_dimension_get_p6
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5340,7 +5330,7 @@ dxf_dimension_set_p6
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5380,7 +5370,7 @@ dxf_dimension_get_x6
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5421,7 +5411,7 @@ dxf_dimension_set_x6
                 /*!< the X-value \c x6 of the definition point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5470,7 +5460,7 @@ dxf_dimension_get_y6
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5511,7 +5501,7 @@ dxf_dimension_set_y6
                 /*!< the Y-value \c y6 of the definition point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5560,7 +5550,7 @@ dxf_dimension_get_z6
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5601,7 +5591,7 @@ dxf_dimension_set_z6
                 /*!< the Z-value \c z6 of the definition point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6360,7 +6350,7 @@ dxf_dimension_get_extr_x0
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6394,7 +6384,7 @@ dxf_dimension_set_extr_x0
                 /*!< the X-value \c extr_x0 of the extrusion vector. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6427,7 +6417,7 @@ dxf_dimension_get_extr_y0
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6461,7 +6451,7 @@ dxf_dimension_set_extr_y0
                 /*!< the Y-value \c extr_y0 of the extrusion vector. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6494,7 +6484,7 @@ dxf_dimension_get_extr_z0
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6528,7 +6518,7 @@ dxf_dimension_set_extr_z0
                 /*!< the Z-value \c extr_z0 of the extrusion vector. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6563,7 +6553,7 @@ dxf_dimension_get_extrusion_vector_as_point
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *point = NULL;
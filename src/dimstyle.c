@@ -62,7 +62,7 @@ dxf_dimstyle_new ()
         size = sizeof (DxfDimStyle);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((dimstyle = malloc (size)) == NULL)
+        if ((dimstyle = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -101,24 +101,24 @@ dxf_dimstyle_init
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 dimstyle = dxf_dimstyle_new ();
         }
         if (dimstyle == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        dimstyle->dimstyle_name = strdup ("");
-        dimstyle->dimpost = strdup ("");
-        dimstyle->dimapost = strdup ("");
-        dimstyle->dimblk = strdup ("");
-        dimstyle->dimblk1 = strdup ("");
-        dimstyle->dimblk2 = strdup ("");
+        dimstyle->dimstyle_name = dxf_strdup ("");
+        dimstyle->dimpost = dxf_strdup ("");
+        dimstyle->dimapost = dxf_strdup ("");
+        dimstyle->dimblk = dxf_strdup ("");
+        dimstyle->dimblk1 = dxf_strdup ("");
+        dimstyle->dimblk2 = dxf_strdup ("");
         dimstyle->dimscale = 0.0;
         dimstyle->dimasz = 0.0;
         dimstyle->dimexo = 0.0;
@@ -154,9 +154,9 @@ dxf_dimstyle_init
         dimstyle->dimclrd = DXF_COLOR_BYLAYER;
         dimstyle->dimclre = DXF_COLOR_BYLAYER;
         dimstyle->dimclrt = DXF_COLOR_BYLAYER;
-        dimstyle->dictionary_owner_soft = strdup ("");
-        dimstyle->object_owner_soft = strdup ("");
-        dimstyle->dictionary_owner_hard = strdup ("");
+        dimstyle->dictionary_owner_soft = dxf_strdup ("");
+        dimstyle->object_owner_soft = dxf_strdup ("");
+        dimstyle->dictionary_owner_hard = dxf_strdup ("");
         dimstyle->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -194,16 +194,16 @@ dxf_dimstyle_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 dimstyle = dxf_dimstyle_init (dimstyle);
@@ -215,11 +215,11 @@ dxf_dimstyle_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -432,7 +432,7 @@ dxf_dimstyle_read
                         if ((strcmp (temp_string, "AcDbSymbolTableRecord") != 0)
                         && (strcmp (temp_string, "AcDbDimStyleTableRecord") != 0))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -711,15 +711,15 @@ dxf_dimstyle_read
         /* Handle omitted members and/or illegal values. */
         if (strcmp (dimstyle->dimstyle_name, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () dimstyle_name value is empty.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -746,76 +746,76 @@ dxf_dimstyle_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("DIMSTYLE");
+        char *dxf_entity_name = dxf_strdup ("DIMSTYLE");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (dimstyle->dimstyle_name, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () dimstyle_name value is empty for the %s entity.\n")),
                   __FUNCTION__, dxf_entity_name);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\tskipping %s table.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (!dimstyle->dimstyle_name)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () dimstyle_name value is NULL for the %s entity.\n")),
                   __FUNCTION__, dxf_entity_name);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\tskipping %s table.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, dimstyle->id_code);
         }
         if (!dimstyle->dimpost)
         {
-                dimstyle->dimpost = strdup ("");
+                dimstyle->dimpost = dxf_strdup ("");
         }
         if (!dimstyle->dimapost)
         {
-                dimstyle->dimapost = strdup ("");
+                dimstyle->dimapost = dxf_strdup ("");
         }
         if (!dimstyle->dimblk)
         {
-                dimstyle->dimblk = strdup ("");
+                dimstyle->dimblk = dxf_strdup ("");
         }
         if (!dimstyle->dimblk1)
         {
-                dimstyle->dimblk1 = strdup ("");
+                dimstyle->dimblk1 = dxf_strdup ("");
         }
         if (!dimstyle->dimblk2)
         {
-                dimstyle->dimblk2 = strdup ("");
+                dimstyle->dimblk2 = dxf_strdup ("");
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -932,7 +932,7 @@ dxf_dimstyle_write
                 fprintf (fp->fp, "  0\nENDTAB\n");
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -961,28 +961,28 @@ dxf_dimstyle_free
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimstyle->next != NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (dimstyle->dimstyle_name);
-        free (dimstyle->dimpost);
-        free (dimstyle->dimapost);
-        free (dimstyle->dimblk);
-        free (dimstyle->dimblk1);
-        free (dimstyle->dimblk2);
-        free (dimstyle->dictionary_owner_soft);
-        free (dimstyle->object_owner_soft);
-        free (dimstyle->dictionary_owner_hard);
-        free (dimstyle);
+        dxf_free (dimstyle->dimstyle_name);
+        dxf_free (dimstyle->dimpost);
+        dxf_free (dimstyle->dimapost);
+        dxf_free (dimstyle->dimblk);
+        dxf_free (dimstyle->dimblk1);
+        dxf_free (dimstyle->dimblk2);
+        dxf_free (dimstyle->dictionary_owner_soft);
+        dxf_free (dimstyle->object_owner_soft);
+        dxf_free (dimstyle->dictionary_owner_hard);
+        dxf_free (dimstyle);
         dimstyle = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -1003,18 +1003,19 @@ dxf_dimstyle_free_list
                  * \c DIMSTYLE symbol tables. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (dimstyles == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (dimstyles != NULL)
         {
                 DxfDimStyle *iter = (DxfDimStyle *) dimstyles->next;
+                dimstyles->next = NULL;
                 dxf_dimstyle_free (dimstyles);
                 dimstyles = (DxfDimStyle *) iter;
         }
@@ -1059,7 +1060,7 @@ dxf_dimstyle_get_dimstyle_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->dimstyle_name));
+        return (dxf_strdup (dimstyle->dimstyle_name));
 }
 
 
@@ -1105,7 +1106,7 @@ dxf_dimstyle_set_dimstyle_name
                   __FUNCTION__);
                 return (NULL);
         }
-        dimstyle->dimstyle_name = strdup (dimstyle_name);
+        dimstyle->dimstyle_name = dxf_strdup (dimstyle_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1148,7 +1149,7 @@ dxf_dimstyle_get_dimpost
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->dimpost));
+        return (dxf_strdup (dimstyle->dimpost));
 }
 
 
@@ -1194,7 +1195,7 @@ dxf_dimstyle_set_dimpost
                   __FUNCTION__);
                 return (NULL);
         }
-        dimstyle->dimpost = strdup (dimpost);
+        dimstyle->dimpost = dxf_strdup (dimpost);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1237,7 +1238,7 @@ dxf_dimstyle_get_dimapost
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->dimapost));
+        return (dxf_strdup (dimstyle->dimapost));
 }
 
 
@@ -1283,7 +1284,7 @@ dxf_dimstyle_set_dimapost
                   __FUNCTION__);
                 return (NULL);
         }
-        dimstyle->dimapost = strdup (dimapost);
+        dimstyle->dimapost = dxf_strdup (dimapost);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1326,7 +1327,7 @@ dxf_dimstyle_get_dimblk
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->dimblk));
+        return (dxf_strdup (dimstyle->dimblk));
 }
 
 
@@ -1371,7 +1372,7 @@ dxf_dimstyle_set_dimblk
                   __FUNCTION__);
                 return (NULL);
         }
-        dimstyle->dimblk = strdup (dimblk);
+        dimstyle->dimblk = dxf_strdup (dimblk);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1414,7 +1415,7 @@ dxf_dimstyle_get_dimblk1
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->dimblk1));
+        return (dxf_strdup (dimstyle->dimblk1));
 }
 
 
@@ -1460,7 +1461,7 @@ dxf_dimstyle_set_dimblk1
                   __FUNCTION__);
                 return (NULL);
         }
-        dimstyle->dimblk1 = strdup (dimblk1);
+        dimstyle->dimblk1 = dxf_strdup (dimblk1);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1503,7 +1504,7 @@ dxf_dimstyle_get_dimblk2
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->dimblk2));
+        return (dxf_strdup (dimstyle->dimblk2));
 }
 
 
@@ -1549,7 +1550,7 @@ dxf_dimstyle_set_dimblk2
                   __FUNCTION__);
                 return (NULL);
         }
-        dimstyle->dimblk2 = strdup (dimblk2);
+        dimstyle->dimblk2 = dxf_strdup (dimblk2);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5433,7 +5434,7 @@ dxf_dimstyle_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->dictionary_owner_soft));
+        return (dxf_strdup (dimstyle->dictionary_owner_soft));
 }
 
 
@@ -5472,7 +5473,7 @@ dxf_dimstyle_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        dimstyle->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        dimstyle->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5516,7 +5517,7 @@ dxf_dimstyle_get_object_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->object_owner_soft));
+        return (dxf_strdup (dimstyle->object_owner_soft));
 }
 
 
@@ -5555,7 +5556,7 @@ dxf_dimstyle_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        dimstyle->object_owner_soft = strdup (object_owner_soft);
+        dimstyle->object_owner_soft = dxf_strdup (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5599,7 +5600,7 @@ dxf_dimstyle_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->dictionary_owner_hard));
+        return (dxf_strdup (dimstyle->dictionary_owner_hard));
 }
 
 
@@ -5638,7 +5639,7 @@ dxf_dimstyle_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        dimstyle->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        dimstyle->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5681,7 +5682,7 @@ dxf_dimstyle_get_dimtxsty
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->dimtxsty));
+        return (dxf_strdup (dimstyle->dimtxsty));
 }
 
 
@@ -5721,7 +5722,7 @@ dxf_dimstyle_set_dimtxsty
                   __FUNCTION__);
                 return (NULL);
         }
-        dimstyle->dimtxsty = strdup (dimtxsty);
+        dimstyle->dimtxsty = dxf_strdup (dimtxsty);
 #if DEBUG
         DXF_DEBUG_END
 #endif
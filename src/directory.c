@@ -0,0 +1,967 @@
+/*!
+ * \file directory.c
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for the section directory of a DXF file.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "directory.h"
+#include "compress.h"
+#include "util.h"
+
+
+/*!
+ * \brief State of a scan for a section directory.
+ */
+typedef struct
+dxf_directory_scanner_struct
+{
+        DxfDirectory *directory;
+                /*!< The directory receiving the entries. */
+        int code_line;
+                /*!< \c TRUE when the next line holds a group code. */
+        int group_code;
+                /*!< The last group code. */
+        long pair_offset;
+                /*!< Byte offset of the last group code line. */
+        int pair_line_number;
+                /*!< Number of lines in front of the last group code
+                 * line. */
+        int line_number;
+                /*!< Number of lines scanned. */
+        long section;
+                /*!< Index of the open section, or -1. */
+        long table;
+                /*!< Index of the open table, or -1. */
+        long block;
+                /*!< Index of the open block definition, or -1. */
+        long pending;
+                /*!< Index of the entry waiting for its name, or -1. */
+        long closing[3];
+                /*!< Indexes of the entries waiting for the next group
+                 * code \c 0 as their end. */
+        int number_of_closing;
+                /*!< Number of indexes in \c closing. */
+} DxfDirectoryScanner;
+
+
+/*!
+ * \brief Get the size and the modification time of the file
+ * \c filename.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_directory_stat
+(
+        const char *filename,
+        long *size,
+        long *time
+)
+{
+        struct stat buffer;
+
+        if (stat (filename, &buffer) != 0)
+        {
+                return (EXIT_FAILURE);
+        }
+        *size = (long) buffer.st_size;
+        *time = (long) buffer.st_mtime;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append an entry to \c directory.
+ *
+ * \return the index of the entry, or -1 when an error occurred.
+ */
+static long
+dxf_directory_add
+(
+        DxfDirectory *directory,
+        DxfDirectoryKind kind,
+        const char *name,
+        long offset,
+        long end,
+        int line_number
+)
+{
+        DxfDirectoryEntry *entries;
+        DxfDirectoryEntry *entry;
+        size_t capacity;
+
+        if (directory->number_of_entries == directory->capacity)
+        {
+                capacity = (directory->capacity > 0) ? 2 * directory->capacity : 32;
+                entries = dxf_realloc (directory->entries,
+                  capacity * sizeof (DxfDirectoryEntry));
+                if (entries == NULL)
+                {
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (-1);
+                }
+                directory->entries = entries;
+                directory->capacity = capacity;
+        }
+        entry = &directory->entries[directory->number_of_entries];
+        entry->kind = kind;
+        entry->name = dxf_strdup ((name != NULL) ? name : "");
+        entry->offset = offset;
+        entry->end = end;
+        entry->line_number = line_number;
+        if (entry->name == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        return ((long) directory->number_of_entries++);
+}
+
+
+/*!
+ * \brief Start a new entry at the last group code of \c scanner.
+ *
+ * \return the index of the entry, or -1 when an error occurred.
+ */
+static long
+dxf_directory_scanner_open
+(
+        DxfDirectoryScanner *scanner,
+        DxfDirectoryKind kind
+)
+{
+        scanner->pending = dxf_directory_add (scanner->directory, kind,
+          NULL, scanner->pair_offset, -1, scanner->pair_line_number);
+        return (scanner->pending);
+}
+
+
+/*!
+ * \brief End the entry with index \c *index at the next group code
+ * \c 0, and clear \c *index.
+ */
+static void
+dxf_directory_scanner_close
+(
+        DxfDirectoryScanner *scanner,
+        long *index
+)
+{
+        if ((*index >= 0) && (scanner->number_of_closing < 3))
+        {
+                scanner->closing[scanner->number_of_closing++] = *index;
+        }
+        *index = -1;
+}
+
+
+/*!
+ * \brief Handle a group code and value pair of a scan.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_directory_scanner_pair
+(
+        DxfDirectoryScanner *scanner,
+        const char *value
+)
+{
+        DxfDirectoryEntry *entries = scanner->directory->entries;
+        int i;
+
+        if (scanner->group_code == 2)
+        {
+                if (scanner->pending >= 0)
+                {
+                        i = (int) scanner->pending;
+                        scanner->pending = -1;
+                        dxf_free (entries[i].name);
+                        entries[i].name = dxf_strdup (value);
+                        if (entries[i].name == NULL)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                }
+                return (EXIT_SUCCESS);
+        }
+        if (scanner->group_code != 0)
+        {
+                return (EXIT_SUCCESS);
+        }
+        for (i = 0; i < scanner->number_of_closing; i++)
+        {
+                entries[scanner->closing[i]].end = scanner->pair_offset;
+        }
+        scanner->number_of_closing = 0;
+        scanner->pending = -1;
+        if (strcmp (value, "SECTION") == 0)
+        {
+                dxf_directory_scanner_close (scanner, &scanner->section);
+                scanner->section = dxf_directory_scanner_open (scanner, DXF_DIRECTORY_SECTION);
+                return ((scanner->section < 0) ? EXIT_FAILURE : EXIT_SUCCESS);
+        }
+        if (strcmp (value, "ENDSEC") == 0)
+        {
+                dxf_directory_scanner_close (scanner, &scanner->table);
+                dxf_directory_scanner_close (scanner, &scanner->block);
+                dxf_directory_scanner_close (scanner, &scanner->section);
+                return (EXIT_SUCCESS);
+        }
+        if (scanner->section < 0)
+        {
+                return (EXIT_SUCCESS);
+        }
+        if ((strcmp (value, "TABLE") == 0)
+          && (strcmp (entries[scanner->section].name, "TABLES") == 0))
+        {
+                dxf_directory_scanner_close (scanner, &scanner->table);
+                scanner->table = dxf_directory_scanner_open (scanner, DXF_DIRECTORY_TABLE);
+                return ((scanner->table < 0) ? EXIT_FAILURE : EXIT_SUCCESS);
+        }
+        if (strcmp (value, "ENDTAB") == 0)
+        {
+                dxf_directory_scanner_close (scanner, &scanner->table);
+        }
+        else if ((strcmp (value, "BLOCK") == 0)
+          && (strcmp (entries[scanner->section].name, "BLOCKS") == 0))
+        {
+                dxf_directory_scanner_close (scanner, &scanner->block);
+                scanner->block = dxf_directory_scanner_open (scanner, DXF_DIRECTORY_BLOCK);
+                return ((scanner->block < 0) ? EXIT_FAILURE : EXIT_SUCCESS);
+        }
+        else if (strcmp (value, "ENDBLK") == 0)
+        {
+                /* The end is the group code 0 following the
+                 * groups of the ENDBLK entity. */
+                dxf_directory_scanner_close (scanner, &scanner->block);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Scan the lines of \c fp for a section directory.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_directory_scanner_run
+(
+        DxfDirectoryScanner *scanner,
+        FILE *fp
+)
+{
+        char value[DXF_MAX_STRING_LENGTH];
+        char *buffer = NULL;
+        char *newline;
+        size_t buffer_size = DXF_DIRECTORY_BLOCK_SIZE;
+        size_t length = 0;
+        size_t start;
+        size_t end;
+        size_t first;
+        size_t last;
+        size_t n;
+        long base = 0;
+        int eof = FALSE;
+        int i;
+
+        buffer = dxf_malloc (buffer_size);
+        if (buffer == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        while (!eof)
+        {
+                if (length == buffer_size)
+                {
+                        /* A line longer than the buffer. */
+                        newline = dxf_realloc (buffer, 2 * buffer_size);
+                        if (newline == NULL)
+                        {
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                                  (_("Error in %s () could not allocate memory.\n")),
+                                  __FUNCTION__);
+                                dxf_free (buffer);
+                                return (EXIT_FAILURE);
+                        }
+                        buffer = newline;
+                        buffer_size *= 2;
+                }
+                n = fread (buffer + length, 1, buffer_size - length, fp);
+                length += n;
+                eof = (n == 0);
+                start = 0;
+                while (start < length)
+                {
+                        newline = memchr (buffer + start, '\n', length - start);
+                        if (newline != NULL)
+                        {
+                                end = (size_t) (newline - buffer) + 1;
+                        }
+                        else if (eof)
+                        {
+                                end = length;
+                        }
+                        else
+                        {
+                                break;
+                        }
+                        if (scanner->code_line)
+                        {
+                                scanner->pair_offset = base + (long) start;
+                                scanner->pair_line_number = scanner->line_number;
+                        }
+                        scanner->line_number++;
+                        first = start;
+                        start = end;
+                        /* Only the values of group codes 0 and 2 are
+                         * of interest. */
+                        if (!scanner->code_line
+                          && (scanner->group_code != 0)
+                          && ((scanner->group_code != 2) || (scanner->pending < 0)))
+                        {
+                                scanner->code_line = TRUE;
+                                continue;
+                        }
+                        while ((first < end) && isspace ((unsigned char) buffer[first]))
+                        {
+                                first++;
+                        }
+                        last = end;
+                        while ((last > first) && isspace ((unsigned char) buffer[last - 1]))
+                        {
+                                last--;
+                        }
+                        n = last - first;
+                        if (n > DXF_MAX_STRING_LENGTH - 1)
+                        {
+                                n = DXF_MAX_STRING_LENGTH - 1;
+                        }
+                        memcpy (value, buffer + first, n);
+                        value[n] = '\0';
+                        if (scanner->code_line)
+                        {
+                                scanner->group_code = atoi (value);
+                                scanner->code_line = FALSE;
+                        }
+                        else
+                        {
+                                scanner->code_line = TRUE;
+                                if (dxf_directory_scanner_pair (scanner, value) != EXIT_SUCCESS)
+                                {
+                                        dxf_free (buffer);
+                                        return (EXIT_FAILURE);
+                                }
+                        }
+                }
+                memmove (buffer, buffer + start, length - start);
+                length -= start;
+                base += (long) start;
+        }
+        dxf_free (buffer);
+        if (ferror (fp))
+        {
+                return (EXIT_FAILURE);
+        }
+        /* Entries open at the end of the file end there. */
+        for (i = 0; i < scanner->number_of_closing; i++)
+        {
+                scanner->directory->entries[scanner->closing[i]].end = base;
+        }
+        for (n = 0; n < scanner->directory->number_of_entries; n++)
+        {
+                if (scanner->directory->entries[n].end < 0)
+                {
+                        scanner->directory->entries[n].end = base;
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate memory for a section directory.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfDirectory *
+dxf_directory_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDirectory *directory = NULL;
+        size_t size;
+
+        size = sizeof (DxfDirectory);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((directory = dxf_malloc (size)) == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                directory = NULL;
+        }
+        else
+        {
+                memset (directory, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (directory);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a section
+ * directory.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfDirectory *
+dxf_directory_init
+(
+        DxfDirectory *directory
+                /*!< a pointer to the section directory. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (directory == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                directory = dxf_directory_new ();
+        }
+        if (directory == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        directory->entries = NULL;
+        directory->number_of_entries = 0;
+        directory->capacity = 0;
+        directory->file_size = -1;
+        directory->file_time = -1;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (directory);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a section directory and all
+ * its entries.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_directory_free
+(
+        DxfDirectory *directory
+                /*!< a pointer to the section directory. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        size_t i;
+
+        /* Do some basic checks. */
+        if (directory == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < directory->number_of_entries; i++)
+        {
+                dxf_free (directory->entries[i].name);
+        }
+        dxf_free (directory->entries);
+        dxf_free (directory);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Build the section directory of the DXF file \c filename.
+ *
+ * The file is read once in blocks of \c DXF_DIRECTORY_BLOCK_SIZE
+ * bytes, only the values of group codes \c 0 and \c 2 are looked at.\n
+ * A gzip or zstd compressed file is decompressed while it is scanned,
+ * the offsets are offsets in the decompressed data then.
+ *
+ * \return a pointer to the section directory, or \c NULL when an error
+ * occurred.
+ */
+DxfDirectory *
+dxf_directory_scan
+(
+        const char *filename
+                /*!< the name of the DXF file. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDirectory *directory = NULL;
+        DxfDirectoryScanner scanner;
+        DxfCompression compression;
+        FILE *fp = NULL;
+        FILE *compressed_fp = NULL;
+        int result;
+
+        /* Do some basic checks. */
+        if (filename == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        fp = fopen (filename, "rb");
+        if (fp == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not open file: %s for reading.\n")),
+                  __FUNCTION__, filename);
+                return (NULL);
+        }
+        compression = dxf_compress_detect (fp);
+        if (compression != DXF_COMPRESSION_NONE)
+        {
+                compressed_fp = dxf_compress_open_read (fp, compression);
+                if (compressed_fp == NULL)
+                {
+                        fclose (fp);
+                        return (NULL);
+                }
+                fp = compressed_fp;
+        }
+        directory = dxf_directory_init (dxf_directory_new ());
+        if (directory == NULL)
+        {
+                fclose (fp);
+                return (NULL);
+        }
+        dxf_directory_stat (filename, &directory->file_size, &directory->file_time);
+        memset (&scanner, 0, sizeof (DxfDirectoryScanner));
+        scanner.directory = directory;
+        scanner.code_line = TRUE;
+        scanner.section = -1;
+        scanner.table = -1;
+        scanner.block = -1;
+        scanner.pending = -1;
+        result = dxf_directory_scanner_run (&scanner, fp);
+        fclose (fp);
+        if (result != EXIT_SUCCESS)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () while scanning: %s.\n")),
+                  __FUNCTION__, filename);
+                dxf_directory_free (directory);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (directory);
+}
+
+
+/*!
+ * \brief Read a section directory from the sidecar file
+ * \c sidecar_filename.
+ *
+ * When \c filename is not \c NULL the directory is only returned when
+ * the size and the modification time of the DXF file \c filename
+ * still match the ones recorded in the sidecar file.
+ *
+ * \return a pointer to the section directory, or \c NULL when the
+ * sidecar file could not be read, or is out of date.
+ */
+DxfDirectory *
+dxf_directory_read
+(
+        const char *filename,
+                /*!< the name of the DXF file, or \c NULL. */
+        const char *sidecar_filename
+                /*!< the name of the sidecar file. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDirectory *directory = NULL;
+        FILE *fp = NULL;
+        char name[DXF_MAX_STRING_LENGTH];
+        char kind;
+        int version = 0;
+        long number_of_entries = 0;
+        long file_size;
+        long file_time;
+        long offset;
+        long end;
+        int line_number;
+        long i;
+        size_t length;
+        int result = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if (sidecar_filename == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        fp = fopen (sidecar_filename, "rb");
+        if (fp == NULL)
+        {
+                return (NULL);
+        }
+        directory = dxf_directory_init (dxf_directory_new ());
+        if ((directory == NULL)
+          || (fscanf (fp, "DXFIDX %d\n", &version) != 1)
+          || (version != 1)
+          || (fscanf (fp, "%ld %ld %ld\n", &directory->file_size,
+          &directory->file_time, &number_of_entries) != 3)
+          || (number_of_entries < 0))
+        {
+                result = EXIT_FAILURE;
+        }
+        else if ((filename != NULL)
+          && ((dxf_directory_stat (filename, &file_size, &file_time) != EXIT_SUCCESS)
+          || (file_size != directory->file_size)
+          || (file_time != directory->file_time)))
+        {
+                /* The sidecar file is out of date. */
+                result = EXIT_FAILURE;
+        }
+        for (i = 0; (i < number_of_entries) && (result == EXIT_SUCCESS); i++)
+        {
+                if ((fscanf (fp, "%c %ld %ld %d", &kind, &offset, &end, &line_number) != 4)
+                  || (fgetc (fp) != ' ')
+                  || (fgets (name, sizeof (name), fp) == NULL))
+                {
+                        result = EXIT_FAILURE;
+                        break;
+                }
+                length = strcspn (name, "\r\n");
+                name[length] = '\0';
+                if (dxf_directory_add (directory,
+                  (kind == 'B') ? DXF_DIRECTORY_BLOCK
+                  : (kind == 'T') ? DXF_DIRECTORY_TABLE : DXF_DIRECTORY_SECTION,
+                  name, offset, end, line_number) < 0)
+                {
+                        result = EXIT_FAILURE;
+                }
+        }
+        fclose (fp);
+        if ((result != EXIT_SUCCESS) && (directory != NULL))
+        {
+                dxf_directory_free (directory);
+                directory = NULL;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (directory);
+}
+
+
+/*!
+ * \brief Write a section directory to the sidecar file
+ * \c sidecar_filename.
+ *
+ * The sidecar file is a text file, the first line holds the format
+ * version, the second line the size and the modification time of the
+ * DXF file and the number of entries, followed by one line per entry
+ * with the kind (\c S, \c T or \c B), the offset, the end, the line
+ * number and the name.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_directory_write
+(
+        DxfDirectory *directory,
+                /*!< a pointer to the section directory. */
+        const char *sidecar_filename
+                /*!< the name of the sidecar file. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        static const char kinds[] = {'S', 'T', 'B'};
+        DxfDirectoryEntry *entry;
+        FILE *fp = NULL;
+        size_t i;
+        int result = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if ((directory == NULL) || (sidecar_filename == NULL))
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        fp = fopen (sidecar_filename, "wb");
+        if (fp == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not open file: %s for writing.\n")),
+                  __FUNCTION__, sidecar_filename);
+                return (EXIT_FAILURE);
+        }
+        fprintf (fp, "DXFIDX 1\n%ld %ld %lu\n", directory->file_size,
+          directory->file_time, (unsigned long) directory->number_of_entries);
+        for (i = 0; i < directory->number_of_entries; i++)
+        {
+                entry = &directory->entries[i];
+                fprintf (fp, "%c %ld %ld %d %s\n", kinds[entry->kind],
+                  entry->offset, entry->end, entry->line_number, entry->name);
+        }
+        if (ferror (fp))
+        {
+                result = EXIT_FAILURE;
+        }
+        if (fclose (fp) != 0)
+        {
+                result = EXIT_FAILURE;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Get the section directory of the DXF file \c filename, from
+ * its sidecar file when that is up to date.
+ *
+ * The sidecar file is named after the DXF file with
+ * \c DXF_DIRECTORY_SIDECAR_SUFFIX appended.\n
+ * When the sidecar file is missing or out of date the DXF file is
+ * scanned with dxf_directory_scan () and the sidecar file is
+ * (re)written.
+ *
+ * \return a pointer to the section directory, or \c NULL when an error
+ * occurred.
+ */
+DxfDirectory *
+dxf_directory_open
+(
+        const char *filename
+                /*!< the name of the DXF file. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDirectory *directory = NULL;
+        char *sidecar_filename = NULL;
+
+        /* Do some basic checks. */
+        if (filename == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        sidecar_filename = dxf_malloc (strlen (filename)
+          + strlen (DXF_DIRECTORY_SIDECAR_SUFFIX) + 1);
+        if (sidecar_filename == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        strcpy (sidecar_filename, filename);
+        strcat (sidecar_filename, DXF_DIRECTORY_SIDECAR_SUFFIX);
+        directory = dxf_directory_read (filename, sidecar_filename);
+        if (directory == NULL)
+        {
+                directory = dxf_directory_scan (filename);
+                if ((directory != NULL)
+                  && (dxf_directory_write (directory, sidecar_filename) != EXIT_SUCCESS))
+                {
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
+                          (_("Note in %s () could not write the sidecar file: %s.\n")),
+                          __FUNCTION__, sidecar_filename);
+                }
+        }
+        dxf_free (sidecar_filename);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (directory);
+}
+
+
+/*!
+ * \brief Find an entry of a section directory by kind and name.
+ *
+ * Names are compared case insensitive, the first matching entry is
+ * returned.
+ *
+ * \return a pointer to the entry, or \c NULL when no entry was found.
+ */
+DxfDirectoryEntry *
+dxf_directory_find
+(
+        DxfDirectory *directory,
+                /*!< a pointer to the section directory. */
+        DxfDirectoryKind kind,
+                /*!< kind of the entry. */
+        const char *name
+                /*!< name of the section, table type or block. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        size_t i;
+
+        /* Do some basic checks. */
+        if ((directory == NULL) || (name == NULL))
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        for (i = 0; i < directory->number_of_entries; i++)
+        {
+                if ((directory->entries[i].kind == kind)
+                  && (strcasecmp (directory->entries[i].name, name) == 0))
+                {
+#if DEBUG
+                        DXF_DEBUG_END
+#endif
+                        return (&directory->entries[i]);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (NULL);
+}
+
+
+/*!
+ * \brief Position a DXF file handle at an entry of its section
+ * directory.
+ *
+ * The \c SECTION, \c TABLE or \c BLOCK marker of the entry is read, as
+ * a sequential read would have done before invoking the reader of the
+ * section, table or block, e.g. dxf_section_read () or
+ * dxf_block_read ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_directory_seek
+(
+        DxfFile *fp,
+                /*!< DXF file handle of the DXF file the directory was
+                 * built for, as returned by dxf_read_init (). */
+        DxfDirectoryEntry *entry
+                /*!< a pointer to the directory entry. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char temp_string[DXF_MAX_STRING_LENGTH];
+
+        /* Do some basic checks. */
+        if ((fp == NULL) || (entry == NULL))
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (fseek (fp->fp, entry->offset, SEEK_SET) != 0)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not seek to offset %ld in: %s.\n")),
+                  __FUNCTION__, entry->offset, fp->filename);
+                return (EXIT_FAILURE);
+        }
+        clearerr (fp->fp);
+        fp->line_number = entry->line_number;
+        memset (temp_string, 0, sizeof (temp_string));
+        /* The group code 0 and the marker. */
+        dxf_read_line (temp_string, fp);
+        dxf_read_line (temp_string, fp);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/* EOF */
@@ -0,0 +1,142 @@
+/*!
+ * \file directory.h
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for the section directory of a DXF file.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_DIRECTORY_H
+#define LIBDXF_SRC_DIRECTORY_H
+
+
+#include "global.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_DIRECTORY_BLOCK_SIZE 1048576
+        /*!< \brief Number of bytes read at once while scanning a DXF
+         * file. */
+
+
+#define DXF_DIRECTORY_SIDECAR_SUFFIX ".dxfidx"
+        /*!< \brief Suffix appended to the name of a DXF file for the
+         * name of its sidecar file. */
+
+
+/*!
+ * \brief Kinds of entries of a section directory.
+ */
+typedef enum
+dxf_directory_kind
+{
+        DXF_DIRECTORY_SECTION,
+                /*!< A section, the name is the section name. */
+        DXF_DIRECTORY_TABLE,
+                /*!< A table of the \c TABLES section, the name is the
+                 * table type, like \c LAYER. */
+        DXF_DIRECTORY_BLOCK
+                /*!< A block definition of the \c BLOCKS section, the
+                 * name is the block name. */
+} DxfDirectoryKind;
+
+
+/*!
+ * \brief Definition of a section directory entry.
+ */
+typedef struct
+dxf_directory_entry_struct
+{
+        DxfDirectoryKind kind;
+                /*!< Kind of the entry. */
+        char *name;
+                /*!< Name of the section, table type or block. */
+        long offset;
+                /*!< Byte offset of the group code \c 0 line of the
+                 * \c SECTION, \c TABLE or \c BLOCK marker. */
+        long end;
+                /*!< Byte offset of the group code \c 0 line following
+                 * the \c ENDSEC, \c ENDTAB or \c ENDBLK marker, or the
+                 * size of the file. */
+        int line_number;
+                /*!< Number of lines in front of \c offset. */
+} DxfDirectoryEntry;
+
+
+/*!
+ * \brief Definition of a section directory.
+ *
+ * A section directory holds the byte offsets of the sections, the
+ * tables and the block definitions of a DXF file, in file order.\n
+ * It is built with one scan over the file, which only splits lines
+ * and looks at the group code \c 0 and \c 2 values, and can be kept in
+ * a sidecar file next to the DXF file for the next time the file is
+ * opened.
+ */
+typedef struct
+dxf_directory_struct
+{
+        DxfDirectoryEntry *entries;
+                /*!< Entries of the directory. */
+        size_t number_of_entries;
+                /*!< Number of entries in \c entries. */
+        size_t capacity;
+                /*!< Allocated number of entries in \c entries. */
+        long file_size;
+                /*!< Size of the DXF file when it was scanned. */
+        long file_time;
+                /*!< Modification time of the DXF file when it was
+                 * scanned. */
+} DxfDirectory;
+
+
+DxfDirectory *dxf_directory_new ();
+DxfDirectory *dxf_directory_init (DxfDirectory *directory);
+int dxf_directory_free (DxfDirectory *directory);
+DxfDirectory *dxf_directory_scan (const char *filename);
+DxfDirectory *dxf_directory_read (const char *filename, const char *sidecar_filename);
+int dxf_directory_write (DxfDirectory *directory, const char *sidecar_filename);
+DxfDirectory *dxf_directory_open (const char *filename);
+DxfDirectoryEntry *dxf_directory_find (DxfDirectory *directory, DxfDirectoryKind kind, const char *name);
+int dxf_directory_seek (DxfFile *fp, DxfDirectoryEntry *entry);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_DIRECTORY_H */
+
+
+/* EOF */
@@ -68,7 +68,7 @@ dxf_donut_new ()
         size = sizeof (DxfDonut);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((donut = malloc (size)) == NULL)
+        if ((donut = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -106,14 +106,14 @@ dxf_donut_init
         /* Do some basic checks. */
         if (donut == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 donut = dxf_donut_new ();
         }
         if (donut == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -121,8 +121,8 @@ dxf_donut_init
         /* Assign initial values to members. */
         /* Members common for all DXF drawable entities. */
         donut->id_code = 0;
-        donut->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        donut->layer = strdup (DXF_DEFAULT_LAYER);
+        donut->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        donut->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         donut->elevation = 0.0;
         donut->thickness = 0.0;
         donut->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -131,13 +131,13 @@ dxf_donut_init
         donut->paperspace = DXF_MODELSPACE;
         donut->graphics_data_size = 0;
         donut->shadow_mode = 0;
-        donut->dictionary_owner_soft = strdup ("");
-        donut->material = strdup ("");
-        donut->dictionary_owner_hard = strdup ("");
+        donut->dictionary_owner_soft = dxf_strdup ("");
+        donut->material = dxf_strdup ("");
+        donut->dictionary_owner_hard = dxf_strdup ("");
         donut->lineweight = 0;
-        donut->plot_style_name = strdup ("");
+        donut->plot_style_name = dxf_strdup ("");
         donut->color_value = 0;
-        donut->color_name = strdup ("");
+        donut->color_name = dxf_strdup ("");
         donut->transparency = 0;
         /* Specific members for a libDXF donut. */
         donut->p0->x0 = 0.0;
@@ -181,7 +181,7 @@ dxf_donut_write
         DxfVertex *vertex_1 = NULL;
         DxfVertex *vertex_2 = NULL;
         DxfSeqend *seqend = NULL;
-        char *dxf_entity_name = strdup ("POLYLINE");
+        char *dxf_entity_name = dxf_strdup ("POLYLINE");
         double start_width;
         double end_width;
         int id_code = -1;
@@ -189,52 +189,52 @@ dxf_donut_write
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (donut == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dxf_donut_get_outside_diameter (donut) > dxf_donut_get_inside_diameter (donut))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () outside diameter is smaller than the inside diameter for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, id_code);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         start_width = 0.5 * (dxf_donut_get_outside_diameter (donut) - dxf_donut_get_inside_diameter (donut));
         end_width = 0.5 * (dxf_donut_get_outside_diameter (donut) - dxf_donut_get_inside_diameter (donut));
         if (strcmp (dxf_donut_get_linetype (donut), "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_donut_get_id_code (donut));
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                dxf_donut_set_linetype (donut, strdup (DXF_DEFAULT_LINETYPE));
+                dxf_donut_set_linetype (donut, dxf_strdup (DXF_DEFAULT_LINETYPE));
         }
         if (strcmp (dxf_donut_get_layer (donut), "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                dxf_donut_set_layer (donut, strdup (DXF_DEFAULT_LAYER));
+                dxf_donut_set_layer (donut, dxf_strdup (DXF_DEFAULT_LAYER));
         }
         /* Create and write a polyline primitive. */
         dxf_polyline_new (polyline);
@@ -314,7 +314,7 @@ dxf_donut_write
         dxf_seqend_write (fp, seqend);
         /*! \todo Hook up this seqend to the list of seqends. */
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -343,23 +343,23 @@ dxf_donut_free
         /* Do some basic checks. */
         if (donut == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (donut->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (donut->linetype);
-        free (donut->layer);
-        free (donut->dictionary_owner_soft);
-        free (donut->dictionary_owner_hard);
-        free (donut);
+        dxf_free (donut->linetype);
+        dxf_free (donut->layer);
+        dxf_free (donut->dictionary_owner_soft);
+        dxf_free (donut->dictionary_owner_hard);
+        dxf_free (donut);
         donut = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -380,18 +380,19 @@ dxf_donut_free_list
                  * entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (donuts == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (donuts != NULL)
         {
                 DxfDonut *iter = (DxfDonut *) donuts->next;
+                donuts->next = NULL;
                 dxf_donut_free (donuts);
                 donuts = (DxfDonut *) iter;
         }
@@ -513,7 +514,7 @@ dxf_donut_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (donut->linetype));
+        return (dxf_strdup (donut->linetype));
 }
 
 
@@ -553,7 +554,7 @@ dxf_donut_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        donut->linetype = strdup (linetype);
+        donut->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -595,7 +596,7 @@ dxf_donut_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (donut->layer));
+        return (dxf_strdup (donut->layer));
 }
 
 
@@ -634,7 +635,7 @@ dxf_donut_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        donut->layer = strdup (layer);
+        donut->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1409,7 +1410,7 @@ dxf_donut_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (donut->dictionary_owner_soft));
+        return (dxf_strdup (donut->dictionary_owner_soft));
 }
 
 
@@ -1445,7 +1446,7 @@ dxf_donut_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        donut->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        donut->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1490,7 +1491,7 @@ dxf_donut_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (donut->material));
+        return (dxf_strdup (donut->material));
 }
 
 
@@ -1529,7 +1530,7 @@ dxf_donut_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        donut->material = strdup (material);
+        donut->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1573,7 +1574,7 @@ dxf_donut_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (donut->dictionary_owner_hard));
+        return (dxf_strdup (donut->dictionary_owner_hard));
 }
 
 
@@ -1612,7 +1613,7 @@ dxf_donut_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        donut->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        donut->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1719,7 +1720,7 @@ dxf_donut_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (donut->plot_style_name));
+        return (dxf_strdup (donut->plot_style_name));
 }
 
 
@@ -1757,7 +1758,7 @@ dxf_donut_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        donut->plot_style_name = strdup (plot_style_name);
+        donut->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1864,7 +1865,7 @@ dxf_donut_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (donut->color_name));
+        return (dxf_strdup (donut->color_name));
 }
 
 
@@ -1902,7 +1903,7 @@ dxf_donut_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        donut->color_name = strdup (color_name);
+        donut->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1987,7 +1988,7 @@ dxf_donut_get_p0
                 /*!< a pointer to a libDXF \c donut entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2027,7 +2028,7 @@ dxf_donut_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2066,7 +2067,7 @@ dxf_donut_get_x0
                 /*!< a pointer to a libDXF \c donut entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2109,7 +2110,7 @@ dxf_donut_set_x0
                  * libDXF \c donut entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2148,7 +2149,7 @@ dxf_donut_get_y0
                 /*!< a pointer to a libDXF \c donut entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2191,7 +2192,7 @@ dxf_donut_set_y0
                  * libDXF \c donut entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2230,7 +2231,7 @@ dxf_donut_get_z0
                 /*!< a pointer to a libDXF \c donut entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2273,7 +2274,7 @@ dxf_donut_set_z0
                  * \c donut entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2311,7 +2312,7 @@ dxf_donut_get_outside_diameter
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2346,7 +2347,7 @@ dxf_donut_set_outside_diameter
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2377,7 +2378,7 @@ dxf_donut_get_inside_diameter
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2412,7 +2413,7 @@ dxf_donut_set_inside_diameter
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
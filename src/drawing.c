@@ -33,7 +33,208 @@
  */
 
 
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+        /* fopencookie () */
+#endif
+
+#include <pthread.h>
+#include <unistd.h>
+
 #include "drawing.h"
+#include "extents.h"
+#include "spline.h"
+#include "file.h"
+
+#if defined (__APPLE__) || defined (__FreeBSD__) || defined (__NetBSD__) || defined (__OpenBSD__)
+#define DXF_DRAWING_FUNOPEN 1
+#elif defined (__GLIBC__) || defined (__CYGWIN__)
+#define DXF_DRAWING_FOPENCOOKIE 1
+#endif
+
+
+/*!
+ * \brief A chunk of entities of one type for the extents reduction.
+ */
+typedef struct
+dxf_drawing_extents_job_struct
+{
+        DxfEntityType type;
+                /*!< type of the entities. */
+        void *first;
+                /*!< first entity of the chunk. */
+        size_t count;
+                /*!< number of entities in the chunk. */
+} DxfDrawingExtentsJob;
+
+
+/*!
+ * \brief Shared state and per thread results of the extents reduction.
+ */
+typedef struct
+dxf_drawing_extents_worker_struct
+{
+        DxfDrawingExtentsJob *jobs;
+                /*!< all chunks (shared). */
+        size_t number_of_jobs;
+                /*!< number of chunks (shared). */
+        size_t *next_job;
+                /*!< index of the next chunk to process (shared). */
+        pthread_mutex_t *mutex;
+                /*!< mutex protecting \c next_job (shared). */
+        DxfDrawing *drawing;
+                /*!< drawing with the block definitions (shared, read
+                 * only). */
+        DxfTables *tables;
+                /*!< symbol tables with the text styles (shared, read
+                 * only). */
+        DxfExtents model;
+                /*!< model space extents of this thread. */
+        DxfExtents paper;
+                /*!< paper space extents of this thread. */
+} DxfDrawingExtentsWorker;
+
+
+/*!
+ * \brief A chunk of splines for the spline tessellation.
+ */
+typedef struct
+dxf_drawing_tessellate_job_struct
+{
+        DxfSpline *first;
+                /*!< first spline of the chunk. */
+        size_t count;
+                /*!< number of splines in the chunk. */
+        DxfTessellation *tessellation;
+                /*!< tessellation of the splines in the chunk. */
+        int result;
+                /*!< \c EXIT_SUCCESS or \c EXIT_FAILURE. */
+} DxfDrawingTessellateJob;
+
+
+/*!
+ * \brief Shared state of the spline tessellation.
+ */
+typedef struct
+dxf_drawing_tessellate_worker_struct
+{
+        DxfDrawingTessellateJob *jobs;
+                /*!< all chunks. */
+        size_t number_of_jobs;
+                /*!< number of chunks. */
+        size_t *next_job;
+                /*!< index of the next chunk to process. */
+        pthread_mutex_t *mutex;
+                /*!< mutex protecting \c next_job. */
+        double tolerance;
+                /*!< chord tolerance. */
+} DxfDrawingTessellateWorker;
+
+
+/*!
+ * \brief Kinds of chunks of the parallel writer.
+ */
+enum dxf_drawing_write_kind
+{
+        DXF_DRAWING_WRITE_ENTITIES,
+                /*!< a chunk of entities. */
+        DXF_DRAWING_WRITE_BLOCK_BEGIN,
+                /*!< the \c BLOCK entity of a block definition. */
+        DXF_DRAWING_WRITE_BLOCK_END
+                /*!< the \c ENDBLK entity of a block definition. */
+};
+
+
+/*!
+ * \brief An entity in the output order of the parallel writer, used
+ * for \c DXF_DRAWING_WRITE_ORDER_HANDLE.
+ */
+typedef struct
+dxf_drawing_write_entry_struct
+{
+        DxfEntityType type;
+                /*!< type of the entity. */
+        void *entity;
+                /*!< the entity. */
+        int id_code;
+                /*!< handle of the entity, the sort key. */
+        size_t sequence;
+                /*!< position in the lists of the entities, keeps the
+                 * sort stable. */
+} DxfDrawingWriteEntry;
+
+
+/*!
+ * \brief A chunk of output for the parallel writer.
+ */
+typedef struct
+dxf_drawing_write_job_struct
+{
+        int kind;
+                /*!< kind of the chunk, a \c dxf_drawing_write_kind. */
+        DxfBlock *block;
+                /*!< block definition of a \c BLOCK or \c ENDBLK chunk. */
+        DxfEntityType type;
+                /*!< type of the entities, when \c entries is \c NULL. */
+        void *first;
+                /*!< first entity of the chunk, when \c entries is
+                 * \c NULL. */
+        DxfDrawingWriteEntry *entries;
+                /*!< entities of the chunk in output order, or \c NULL
+                 * for a chunk of \c count entities of one type starting
+                 * at \c first. */
+        size_t count;
+                /*!< number of entities in the chunk. */
+        char *buffer;
+                /*!< serialized output of the chunk, allocated with
+                 * dxf_realloc (). */
+        size_t size;
+                /*!< number of bytes in \c buffer. */
+        size_t capacity;
+                /*!< number of bytes allocated for \c buffer. */
+        int done;
+                /*!< \c TRUE when the chunk is serialized. */
+        int result;
+                /*!< \c EXIT_SUCCESS or \c EXIT_FAILURE. */
+} DxfDrawingWriteJob;
+
+
+/*!
+ * \brief Shared state of the parallel writer.
+ *
+ * The threads of the pool serialize chunks in order, at most
+ * \c window chunks ahead of the chunk the calling thread is to write.
+ */
+typedef struct
+dxf_drawing_write_worker_struct
+{
+        DxfDrawingWriteJob *jobs;
+                /*!< all chunks. */
+        size_t number_of_jobs;
+                /*!< number of chunks. */
+        size_t next_job;
+                /*!< index of the next chunk to serialize. */
+        size_t next_write;
+                /*!< index of the next chunk to write. */
+        size_t window;
+                /*!< maximum number of serialized chunks held in
+                 * memory. */
+        pthread_mutex_t mutex;
+                /*!< mutex protecting the members above and the
+                 * \c done member of the chunks. */
+        pthread_cond_t serialized;
+                /*!< signalled when a chunk is serialized. */
+        pthread_cond_t written;
+                /*!< signalled when a chunk is written. */
+        DxfFile *fp;
+                /*!< output file, the template for the memory streams
+                 * (read only). */
+} DxfDrawingWriteWorker;
+
+
+static void *dxf_drawing_update_extents_worker (void *data);
+static void *dxf_drawing_tessellate_splines_worker (void *data);
+static void *dxf_drawing_write_parallel_worker (void *data);
 
 
 /*!
@@ -56,7 +257,7 @@ dxf_drawing_new ()
         size = sizeof (DxfDrawing);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((drawing = malloc (size)) == NULL)
+        if ((drawing = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -95,13 +296,13 @@ dxf_drawing_init
         /* Do some basic checks. */
         if (drawing == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 drawing = dxf_drawing_new ();
                 if (drawing == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -115,6 +316,7 @@ dxf_drawing_init
         drawing->entities_list = NULL;
         drawing->object_list = NULL;
         drawing->thumbnail = NULL;
+        drawing->block_index = NULL;
         drawing->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -144,25 +346,51 @@ dxf_drawing_free
         /* Do some basic checks. */
         if (drawing == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (drawing->next != NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        dxf_header_free ((DxfHeader *) drawing->header);
-        dxf_class_free_list ((DxfClass *) drawing->class_list);
-        dxf_block_free_list ((DxfBlock *) drawing->block_list);
-        //dxf_entities_free_list ((DxfEntities *) drawing->entities_list);
-        dxf_object_free_list ((DxfObject *) drawing->object_list);
-        dxf_thumbnail_free ((DxfThumbnail *) drawing->thumbnail);
-        free (drawing);
+        if (drawing->header != NULL)
+        {
+                dxf_header_free ((DxfHeader *) drawing->header);
+        }
+        if (drawing->class_list != NULL)
+        {
+                dxf_class_free_list ((DxfClass *) drawing->class_list);
+        }
+        if (drawing->block_list != NULL)
+        {
+                dxf_block_free_list ((DxfBlock *) drawing->block_list);
+        }
+        if (drawing->tables_list != NULL)
+        {
+                dxf_tables_free ((DxfTables *) drawing->tables_list);
+        }
+        if (drawing->entities_list != NULL)
+        {
+                dxf_entities_free ((DxfEntities *) drawing->entities_list);
+        }
+        if (drawing->object_list != NULL)
+        {
+                dxf_object_free_list ((DxfObject *) drawing->object_list);
+        }
+        if (drawing->thumbnail != NULL)
+        {
+                dxf_thumbnail_free ((DxfThumbnail *) drawing->thumbnail);
+        }
+        if (drawing->block_index != NULL)
+        {
+                dxf_symbol_index_free ((DxfSymbolIndex *) drawing->block_index);
+        }
+        dxf_free (drawing);
         drawing = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -491,6 +719,7 @@ dxf_drawing_set_block_list
                   __FUNCTION__);
                 return (NULL);
         }
+        dxf_drawing_clear_block_index (drawing);
         drawing->block_list = (struct DxfBlock *) block_list;
 #if DEBUG
         DXF_DEBUG_END
@@ -873,4 +1102,2007 @@ dxf_drawing_get_last
 }
 
 
-/* EOF*/
+/*!
+ * \brief Get the name index of the block definitions of a libDXF
+ * drawing, build it when not built yet.
+ *
+ * \return a pointer to the name index, or \c NULL when an error
+ * occurred.
+ */
+static DxfSymbolIndex *
+dxf_drawing_get_block_index
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+        DxfSymbolIndex *index = NULL;
+        DxfBlock *iter = NULL;
+
+        if (drawing->block_index != NULL)
+        {
+                return ((DxfSymbolIndex *) drawing->block_index);
+        }
+        index = dxf_symbol_index_init (dxf_symbol_index_new ());
+        if (index == NULL)
+        {
+                return (NULL);
+        }
+        for (iter = (DxfBlock *) drawing->block_list;
+          iter != NULL;
+          iter = (DxfBlock *) iter->next)
+        {
+                if ((iter->block_name != NULL)
+                  && (dxf_symbol_index_insert (index,
+                  iter->block_name, iter) != EXIT_SUCCESS))
+                {
+                        dxf_symbol_index_free (index);
+                        return (NULL);
+                }
+        }
+        drawing->block_index = (struct DxfSymbolIndex *) index;
+        return (index);
+}
+
+
+/*!
+ * \brief Build the name index of the block definitions of a libDXF
+ * drawing.
+ *
+ * The index is built on the first lookup anyway, which modifies
+ * \c drawing: build it in advance when lookups are to be done from
+ * multiple threads.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_drawing_build_block_index
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_drawing_get_block_index (drawing) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Find a block definition by name (case insensitive) in a
+ * libDXF drawing.
+ *
+ * The name index of the block definitions is built on the first call,
+ * after that lookups do not modify the drawing and may be done from
+ * several threads at once, see dxf_drawing_build_block_index ().
+ *
+ * \return a pointer to the first block definition with the name, or
+ * \c NULL when no block definition with the name was found.
+ */
+DxfBlock *
+dxf_drawing_find_block
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing. */
+        const char *block_name
+                /*!< name of the block. */
+)
+{
+        DxfSymbolIndex *index = NULL;
+
+        /* Do some basic checks. */
+        if ((drawing == NULL) || (block_name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        index = dxf_drawing_get_block_index (drawing);
+        if (index == NULL)
+        {
+                return (NULL);
+        }
+        return ((DxfBlock *) dxf_symbol_index_find (index, block_name));
+}
+
+
+/*!
+ * \brief Append a block definition to the Block list of a libDXF
+ * drawing.
+ *
+ * The block definition becomes the last entry of the list and is added
+ * to the name index.
+ *
+ * \return a pointer to the libDXF drawing when OK, \c NULL when an
+ * error occurred.
+ */
+DxfDrawing *
+dxf_drawing_add_block
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing. */
+        DxfBlock *block
+                /*!< a pointer to the block definition. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBlock *iter = NULL;
+
+        /* Do some basic checks. */
+        if ((drawing == NULL) || (block == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        block->next = NULL;
+        if (drawing->block_list == NULL)
+        {
+                drawing->block_list = (struct DxfBlock *) block;
+        }
+        else
+        {
+                iter = (DxfBlock *) drawing->block_list;
+                while (iter->next != NULL)
+                {
+                        iter = (DxfBlock *) iter->next;
+                }
+                iter->next = (struct DxfBlock *) block;
+        }
+        if ((drawing->block_index != NULL) && (block->block_name != NULL)
+          && (dxf_symbol_index_insert ((DxfSymbolIndex *) drawing->block_index,
+          block->block_name, block) != EXIT_SUCCESS))
+        {
+                dxf_drawing_clear_block_index (drawing);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (drawing);
+}
+
+
+/*!
+ * \brief Remove a block definition from the Block list of a libDXF
+ * drawing.
+ *
+ * The block definition is unlinked from the list and the name index, it
+ * is not freed.
+ *
+ * \return a pointer to the libDXF drawing when OK, \c NULL when the
+ * block definition is not in the list.
+ */
+DxfDrawing *
+dxf_drawing_remove_block
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing. */
+        DxfBlock *block
+                /*!< a pointer to the block definition. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBlock **address = NULL;
+
+        /* Do some basic checks. */
+        if ((drawing == NULL) || (block == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        for (address = (DxfBlock **) &drawing->block_list;
+          (*address != NULL) && (*address != block);
+          address = (DxfBlock **) &(*address)->next)
+        {
+        }
+        if (*address == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the block was not found.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        *address = (DxfBlock *) block->next;
+        block->next = NULL;
+        /* A following block with the same name takes the place of the
+         * removed block, rebuild the index on the next lookup. */
+        dxf_drawing_clear_block_index (drawing);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (drawing);
+}
+
+
+/*!
+ * \brief Rename a block definition of a libDXF drawing.
+ *
+ * The name index is updated right away, so lookups find the block
+ * definition by its new name.\n
+ * \c block has to be in the Block list of \c drawing.
+ *
+ * \return a pointer to the libDXF drawing when OK, \c NULL when an
+ * error occurred.
+ */
+DxfDrawing *
+dxf_drawing_rename_block
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing. */
+        DxfBlock *block,
+                /*!< a pointer to the block definition. */
+        const char *block_name
+                /*!< the new name of the block. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfSymbolIndex *index = NULL;
+        DxfBlock *iter = NULL;
+        DxfBlock *first = NULL;
+        char *new_name = NULL;
+
+        /* Do some basic checks. */
+        if ((drawing == NULL) || (block == NULL) || (block_name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        new_name = dxf_strdup (block_name);
+        if (new_name == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        index = (DxfSymbolIndex *) drawing->block_index;
+        if ((index != NULL) && (block->block_name != NULL)
+          && (dxf_symbol_index_find (index, block->block_name) == block))
+        {
+                dxf_symbol_index_remove (index, block->block_name, block);
+                /* A following block with the old name takes the place
+                 * of the renamed block. */
+                for (iter = (DxfBlock *) block->next;
+                  iter != NULL;
+                  iter = (DxfBlock *) iter->next)
+                {
+                        if ((iter->block_name != NULL)
+                          && (strcasecmp (iter->block_name, block->block_name) == 0))
+                        {
+                                break;
+                        }
+                }
+                if ((iter != NULL)
+                  && (dxf_symbol_index_insert (index, iter->block_name, iter) != EXIT_SUCCESS))
+                {
+                        index = NULL;
+                }
+        }
+        dxf_free (block->block_name);
+        block->block_name = new_name;
+        if (index != NULL)
+        {
+                first = (DxfBlock *) dxf_symbol_index_find (index, new_name);
+                if (((first == NULL)
+                  && (dxf_symbol_index_insert (index, new_name, block) != EXIT_SUCCESS))
+                  || ((first != NULL) && (first != block)))
+                {
+                        /* Another block has the name, the first of both
+                         * in the list is found. */
+                        index = NULL;
+                }
+        }
+        if ((drawing->block_index != NULL) && (index == NULL))
+        {
+                dxf_drawing_clear_block_index (drawing);
+                if (dxf_drawing_get_block_index (drawing) == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (drawing);
+}
+
+
+/*!
+ * \brief Discard the name index of the block definitions of a libDXF
+ * drawing.
+ *
+ * Call this function after changing the Block list directly, or after
+ * renaming block definitions with dxf_block_set_block_name () instead
+ * of dxf_drawing_rename_block (), the index is rebuilt on the next
+ * lookup.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_drawing_clear_block_index
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (drawing->block_index != NULL)
+        {
+                dxf_symbol_index_free ((DxfSymbolIndex *) drawing->block_index);
+        }
+        drawing->block_index = NULL;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Process chunks of entities until no chunks are left.
+ */
+static void *
+dxf_drawing_update_extents_worker
+(
+        void *data
+                /*!< a pointer to a \c DxfDrawingExtentsWorker. */
+)
+{
+        DxfDrawingExtentsWorker *worker = NULL;
+        DxfDrawingExtentsJob *job = NULL;
+        void *entity = NULL;
+        size_t index;
+        size_t i;
+
+        worker = (DxfDrawingExtentsWorker *) data;
+        for (;;)
+        {
+                pthread_mutex_lock (worker->mutex);
+                index = (*worker->next_job)++;
+                pthread_mutex_unlock (worker->mutex);
+                if (index >= worker->number_of_jobs)
+                {
+                        break;
+                }
+                job = &worker->jobs[index];
+                for (i = 0, entity = job->first;
+                  (i < job->count) && (entity != NULL);
+                  i++, entity = dxf_extents_entity_get_next (job->type, entity))
+                {
+                        dxf_extents_add_entity (
+                          (dxf_extents_entity_get_paperspace (job->type, entity) == DXF_PAPERSPACE)
+                          ? &worker->paper : &worker->model,
+                          job->type, entity, worker->drawing, worker->tables,
+                          DXF_EXTENTS_SPLINE_TIGHT, NULL);
+                }
+        }
+        return (NULL);
+}
+
+
+/*!
+ * \brief Recompute the model space ($EXTMIN, $EXTMAX) and paper space
+ * ($PEXTMIN, $PEXTMAX) extents in the header of a libDXF \c DRAWING.
+ *
+ * The entity lists are split into chunks of
+ * \c DXF_DRAWING_EXTENTS_CHUNK_SIZE entities which are bounded by a
+ * pool of threads, every thread accumulates its own model space and
+ * paper space extents which are merged when all threads are done.\n
+ * When a space holds no entities its extents are set to the values
+ * AutoCAD uses for an empty drawing (1.0E+20 and -1.0E+20).
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_drawing_update_extents
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF \c DRAWING. */
+        int number_of_threads
+                /*!< number of threads to use, 0 or less to use one
+                 * thread for every online processor. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHeader *header = NULL;
+        DxfEntities *entities = NULL;
+        DxfMline *mline = NULL;
+        DxfDrawingExtentsJob *jobs = NULL;
+        DxfDrawingExtentsWorker *workers = NULL;
+        DxfExtents model;
+        DxfExtents paper;
+        DxfTables *tables = NULL;
+        pthread_t *threads = NULL;
+        pthread_mutex_t mutex;
+        void *entity = NULL;
+        size_t number_of_jobs;
+        size_t next_job;
+        size_t count;
+        int type;
+        int started;
+        int i;
+
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (drawing->header == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        header = (DxfHeader *) drawing->header;
+        entities = (DxfEntities *) drawing->entities_list;
+        tables = (DxfTables *) drawing->tables_list;
+        dxf_extents_init (&model);
+        dxf_extents_init (&paper);
+        /* Build the block and text style name indexes before the
+         * workers look up block definitions and text styles in them. */
+        if ((dxf_drawing_get_block_index (drawing) == NULL)
+          || ((tables != NULL)
+          && (dxf_tables_build_indexes (tables) != EXIT_SUCCESS)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        /* Split the entity lists into chunks. */
+        number_of_jobs = 0;
+        for (type = UNKNOWN_ENTITY; type <= XLINE; type++)
+        {
+                count = 0;
+                for (entity = dxf_extents_entities_get_list (entities, (DxfEntityType) type);
+                  entity != NULL;
+                  entity = dxf_extents_entity_get_next ((DxfEntityType) type, entity))
+                {
+                        if (count % DXF_DRAWING_EXTENTS_CHUNK_SIZE == 0)
+                        {
+                                number_of_jobs++;
+                        }
+                        count++;
+                }
+        }
+        if (number_of_jobs > 0)
+        {
+                jobs = dxf_malloc (number_of_jobs * sizeof (DxfDrawingExtentsJob));
+                if (jobs == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+        }
+        number_of_jobs = 0;
+        for (type = UNKNOWN_ENTITY; type <= XLINE; type++)
+        {
+                count = 0;
+                for (entity = dxf_extents_entities_get_list (entities, (DxfEntityType) type);
+                  entity != NULL;
+                  entity = dxf_extents_entity_get_next ((DxfEntityType) type, entity))
+                {
+                        if (count % DXF_DRAWING_EXTENTS_CHUNK_SIZE == 0)
+                        {
+                                jobs[number_of_jobs].type = (DxfEntityType) type;
+                                jobs[number_of_jobs].first = entity;
+                                jobs[number_of_jobs].count = 0;
+                                number_of_jobs++;
+                        }
+                        jobs[number_of_jobs - 1].count++;
+                        count++;
+                }
+        }
+        if (number_of_threads <= 0)
+        {
+                number_of_threads = (int) sysconf (_SC_NPROCESSORS_ONLN);
+        }
+        if (number_of_threads < 1)
+        {
+                number_of_threads = 1;
+        }
+        if ((size_t) number_of_threads > number_of_jobs)
+        {
+                number_of_threads = (number_of_jobs > 0) ? (int) number_of_jobs : 1;
+        }
+        workers = dxf_malloc (number_of_threads * sizeof (DxfDrawingExtentsWorker));
+        threads = dxf_malloc (number_of_threads * sizeof (pthread_t));
+        if ((workers == NULL) || (threads == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_free (jobs);
+                dxf_free (workers);
+                dxf_free (threads);
+                return (EXIT_FAILURE);
+        }
+        next_job = 0;
+        pthread_mutex_init (&mutex, NULL);
+        for (i = 0; i < number_of_threads; i++)
+        {
+                workers[i].jobs = jobs;
+                workers[i].number_of_jobs = number_of_jobs;
+                workers[i].next_job = &next_job;
+                workers[i].mutex = &mutex;
+                workers[i].drawing = drawing;
+                workers[i].tables = tables;
+                dxf_extents_init (&workers[i].model);
+                dxf_extents_init (&workers[i].paper);
+        }
+        /* The calling thread takes part as worker 0. */
+        started = 1;
+        for (i = 1; i < number_of_threads; i++)
+        {
+                if (pthread_create (&threads[i], NULL,
+                  dxf_drawing_update_extents_worker, &workers[i]) != 0)
+                {
+                        fprintf (stderr,
+                          (_("Warning in %s () could not create a thread.\n")),
+                          __FUNCTION__);
+                        break;
+                }
+                started++;
+        }
+        dxf_drawing_update_extents_worker (&workers[0]);
+        for (i = 1; i < started; i++)
+        {
+                pthread_join (threads[i], NULL);
+        }
+        pthread_mutex_destroy (&mutex);
+        for (i = 0; i < started; i++)
+        {
+                dxf_extents_merge (&model, &workers[i].model);
+                dxf_extents_merge (&paper, &workers[i].paper);
+        }
+        /* MLINE entities have no entity type of their own. */
+        for (mline = (entities != NULL) ? (DxfMline *) entities->mline_list : NULL;
+          mline != NULL;
+          mline = (DxfMline *) mline->next)
+        {
+                dxf_extents_add_mline ((mline->paperspace == DXF_PAPERSPACE)
+                  ? &paper : &model, mline, NULL);
+        }
+        if (model.empty)
+        {
+                model.x0 = model.y0 = model.z0 = 1.0E+20;
+                model.x1 = model.y1 = model.z1 = -1.0E+20;
+        }
+        if (paper.empty)
+        {
+                paper.x0 = paper.y0 = paper.z0 = 1.0E+20;
+                paper.x1 = paper.y1 = paper.z1 = -1.0E+20;
+        }
+        header->ExtMin.x0 = model.x0;
+        header->ExtMin.y0 = model.y0;
+        header->ExtMin.z0 = model.z0;
+        header->ExtMax.x0 = model.x1;
+        header->ExtMax.y0 = model.y1;
+        header->ExtMax.z0 = model.z1;
+        header->PExtMin.x0 = paper.x0;
+        header->PExtMin.y0 = paper.y0;
+        header->PExtMin.z0 = paper.z0;
+        header->PExtMax.x0 = paper.x1;
+        header->PExtMax.y0 = paper.y1;
+        header->PExtMax.z0 = paper.z1;
+        dxf_free (jobs);
+        dxf_free (workers);
+        dxf_free (threads);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Tessellate chunks of splines until no chunks are left.
+ */
+static void *
+dxf_drawing_tessellate_splines_worker
+(
+        void *data
+                /*!< a pointer to a \c DxfDrawingTessellateWorker. */
+)
+{
+        DxfDrawingTessellateWorker *worker = NULL;
+        DxfDrawingTessellateJob *job = NULL;
+        DxfSpline *spline = NULL;
+        size_t index;
+        size_t i;
+
+        worker = (DxfDrawingTessellateWorker *) data;
+        for (;;)
+        {
+                pthread_mutex_lock (worker->mutex);
+                index = (*worker->next_job)++;
+                pthread_mutex_unlock (worker->mutex);
+                if (index >= worker->number_of_jobs)
+                {
+                        break;
+                }
+                job = &worker->jobs[index];
+                job->result = EXIT_SUCCESS;
+                job->tessellation = dxf_tessellation_init (dxf_tessellation_new ());
+                if (job->tessellation == NULL)
+                {
+                        job->result = EXIT_FAILURE;
+                        continue;
+                }
+                for (i = 0, spline = job->first;
+                  (i < job->count) && (spline != NULL);
+                  i++, spline = (DxfSpline *) spline->next)
+                {
+                        if (dxf_spline_tessellate (spline, worker->tolerance,
+                          job->tessellation) != EXIT_SUCCESS)
+                        {
+                                job->result = EXIT_FAILURE;
+                        }
+                }
+        }
+        return (NULL);
+}
+
+
+/*!
+ * \brief Tessellate all \c SPLINE entities of a libDXF \c DRAWING.
+ *
+ * One curve is added to \c tessellation for every \c SPLINE entity in
+ * the entities section, in the order of the entity list, see
+ * \c dxf_spline_tessellate().\n
+ * The list is split into chunks of
+ * \c DXF_DRAWING_TESSELLATE_CHUNK_SIZE splines which are tessellated
+ * by a pool of threads into buffers of their own, these buffers are
+ * appended to \c tessellation when all threads are done.\n
+ * A spline that can not be tessellated results in an empty (or
+ * partial) curve.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_drawing_tessellate_splines
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF \c DRAWING. */
+        double tolerance,
+                /*!< maximum distance between a spline and its
+                 * polyline (chord tolerance). */
+        int number_of_threads,
+                /*!< number of threads to use, 0 or less to use one
+                 * thread for every online processor. */
+        DxfTessellation *tessellation
+                /*!< a pointer to the \c DxfTessellation receiving the
+                 * curves. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfSpline *spline = NULL;
+        DxfDrawingTessellateJob *jobs = NULL;
+        DxfDrawingTessellateWorker worker;
+        pthread_t *threads = NULL;
+        pthread_mutex_t mutex;
+        size_t number_of_jobs;
+        size_t next_job;
+        size_t count;
+        size_t j;
+        int result;
+        int started;
+        int i;
+
+        /* Do some basic checks. */
+        if ((drawing == NULL) || (tessellation == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (drawing->entities_list == NULL)
+        {
+#if DEBUG
+                DXF_DEBUG_END
+#endif
+                return (EXIT_SUCCESS);
+        }
+        /* Split the spline list into chunks. */
+        count = 0;
+        for (spline = (DxfSpline *) ((DxfEntities *) drawing->entities_list)->spline_list;
+          spline != NULL;
+          spline = (DxfSpline *) spline->next)
+        {
+                count++;
+        }
+        number_of_jobs = (count + DXF_DRAWING_TESSELLATE_CHUNK_SIZE - 1)
+          / DXF_DRAWING_TESSELLATE_CHUNK_SIZE;
+        if (number_of_jobs == 0)
+        {
+#if DEBUG
+                DXF_DEBUG_END
+#endif
+                return (EXIT_SUCCESS);
+        }
+        jobs = dxf_malloc (number_of_jobs * sizeof (DxfDrawingTessellateJob));
+        if (jobs == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        count = 0;
+        number_of_jobs = 0;
+        for (spline = (DxfSpline *) ((DxfEntities *) drawing->entities_list)->spline_list;
+          spline != NULL;
+          spline = (DxfSpline *) spline->next)
+        {
+                if (count % DXF_DRAWING_TESSELLATE_CHUNK_SIZE == 0)
+                {
+                        jobs[number_of_jobs].first = spline;
+                        jobs[number_of_jobs].count = 0;
+                        jobs[number_of_jobs].tessellation = NULL;
+                        jobs[number_of_jobs].result = EXIT_FAILURE;
+                        number_of_jobs++;
+                }
+                jobs[number_of_jobs - 1].count++;
+                count++;
+        }
+        if (number_of_threads <= 0)
+        {
+                number_of_threads = (int) sysconf (_SC_NPROCESSORS_ONLN);
+        }
+        if (number_of_threads < 1)
+        {
+                number_of_threads = 1;
+        }
+        if ((size_t) number_of_threads > number_of_jobs)
+        {
+                number_of_threads = (int) number_of_jobs;
+        }
+        threads = dxf_malloc (number_of_threads * sizeof (pthread_t));
+        if (threads == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_free (jobs);
+                return (EXIT_FAILURE);
+        }
+        next_job = 0;
+        pthread_mutex_init (&mutex, NULL);
+        worker.jobs = jobs;
+        worker.number_of_jobs = number_of_jobs;
+        worker.next_job = &next_job;
+        worker.mutex = &mutex;
+        worker.tolerance = tolerance;
+        /* The calling thread takes part as worker 0. */
+        started = 1;
+        for (i = 1; i < number_of_threads; i++)
+        {
+                if (pthread_create (&threads[i], NULL,
+                  dxf_drawing_tessellate_splines_worker, &worker) != 0)
+                {
+                        fprintf (stderr,
+                          (_("Warning in %s () could not create a thread.\n")),
+                          __FUNCTION__);
+                        break;
+                }
+                started++;
+        }
+        dxf_drawing_tessellate_splines_worker (&worker);
+        for (i = 1; i < started; i++)
+        {
+                pthread_join (threads[i], NULL);
+        }
+        pthread_mutex_destroy (&mutex);
+        result = EXIT_SUCCESS;
+        for (j = 0; j < number_of_jobs; j++)
+        {
+                if (jobs[j].result != EXIT_SUCCESS)
+                {
+                        result = EXIT_FAILURE;
+                }
+                if (jobs[j].tessellation != NULL)
+                {
+                        if (dxf_tessellation_append (tessellation,
+                          jobs[j].tessellation) != EXIT_SUCCESS)
+                        {
+                                result = EXIT_FAILURE;
+                        }
+                        dxf_tessellation_free (jobs[j].tessellation);
+                }
+        }
+        dxf_free (jobs);
+        dxf_free (threads);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Compare two entities by handle, for qsort ().
+ *
+ * Entities without a handle (a negative id-code) follow the entities
+ * with a handle, ties keep the order of the lists.
+ */
+static int
+dxf_drawing_write_compare_entries
+(
+        const void *a,
+        const void *b
+)
+{
+        const DxfDrawingWriteEntry *entry_a = (const DxfDrawingWriteEntry *) a;
+        const DxfDrawingWriteEntry *entry_b = (const DxfDrawingWriteEntry *) b;
+
+        if ((entry_a->id_code < 0) != (entry_b->id_code < 0))
+        {
+                return ((entry_a->id_code < 0) ? 1 : -1);
+        }
+        if ((entry_a->id_code >= 0) && (entry_a->id_code != entry_b->id_code))
+        {
+                return ((entry_a->id_code < entry_b->id_code) ? -1 : 1);
+        }
+        if (entry_a->sequence != entry_b->sequence)
+        {
+                return ((entry_a->sequence < entry_b->sequence) ? -1 : 1);
+        }
+        return (0);
+}
+
+
+/*!
+ * \brief Add the chunks of an entities list to the parallel writer.
+ *
+ * Only counts the chunks, and the entities in \c number_of_entries,
+ * when \c jobs is \c NULL.\n
+ * For \c DXF_DRAWING_WRITE_ORDER_TYPE a chunk holds entities of one
+ * type, for \c DXF_DRAWING_WRITE_ORDER_HANDLE the entities are sorted
+ * by handle into \c *entries, which is advanced past them.
+ *
+ * \return the number of chunks.
+ */
+static size_t
+dxf_drawing_write_add_entities
+(
+        DxfDrawingWriteJob *jobs,
+        DxfEntities *entities,
+        DxfDrawingWriteOrder order,
+        DxfDrawingWriteEntry **entries,
+        size_t *number_of_entries
+)
+{
+        DxfDrawingWriteEntry *first_entry = NULL;
+        void *entity = NULL;
+        size_t number_of_jobs;
+        size_t count;
+        size_t i;
+        int type;
+
+        number_of_jobs = 0;
+        if (entities == NULL)
+        {
+                return (0);
+        }
+        if (order == DXF_DRAWING_WRITE_ORDER_HANDLE)
+        {
+                count = 0;
+                first_entry = (jobs != NULL) ? *entries : NULL;
+                for (type = UNKNOWN_ENTITY; type <= XLINE; type++)
+                {
+                        for (entity = dxf_extents_entities_get_list (entities, (DxfEntityType) type);
+                          entity != NULL;
+                          entity = dxf_extents_entity_get_next ((DxfEntityType) type, entity))
+                        {
+                                if (first_entry != NULL)
+                                {
+                                        first_entry[count].type = (DxfEntityType) type;
+                                        first_entry[count].entity = entity;
+                                        first_entry[count].id_code =
+                                          dxf_entities_entity_get_id_code ((DxfEntityType) type, entity);
+                                        first_entry[count].sequence = count;
+                                }
+                                count++;
+                        }
+                }
+                if (jobs == NULL)
+                {
+                        *number_of_entries += count;
+                        return ((count + DXF_DRAWING_WRITE_CHUNK_SIZE - 1)
+                          / DXF_DRAWING_WRITE_CHUNK_SIZE);
+                }
+                qsort (first_entry, count, sizeof (DxfDrawingWriteEntry),
+                  dxf_drawing_write_compare_entries);
+                for (i = 0; i < count; i += DXF_DRAWING_WRITE_CHUNK_SIZE)
+                {
+                        memset (&jobs[number_of_jobs], 0, sizeof (DxfDrawingWriteJob));
+                        jobs[number_of_jobs].kind = DXF_DRAWING_WRITE_ENTITIES;
+                        jobs[number_of_jobs].entries = first_entry + i;
+                        jobs[number_of_jobs].count = (count - i < DXF_DRAWING_WRITE_CHUNK_SIZE)
+                          ? count - i : DXF_DRAWING_WRITE_CHUNK_SIZE;
+                        number_of_jobs++;
+                }
+                *entries += count;
+                return (number_of_jobs);
+        }
+        for (type = UNKNOWN_ENTITY; type <= XLINE; type++)
+        {
+                count = 0;
+                for (entity = dxf_extents_entities_get_list (entities, (DxfEntityType) type);
+                  entity != NULL;
+                  entity = dxf_extents_entity_get_next ((DxfEntityType) type, entity))
+                {
+                        if (count % DXF_DRAWING_WRITE_CHUNK_SIZE == 0)
+                        {
+                                if (jobs != NULL)
+                                {
+                                        memset (&jobs[number_of_jobs], 0, sizeof (DxfDrawingWriteJob));
+                                        jobs[number_of_jobs].kind = DXF_DRAWING_WRITE_ENTITIES;
+                                        jobs[number_of_jobs].type = (DxfEntityType) type;
+                                        jobs[number_of_jobs].first = entity;
+                                }
+                                number_of_jobs++;
+                        }
+                        if (jobs != NULL)
+                        {
+                                jobs[number_of_jobs - 1].count++;
+                        }
+                        count++;
+                }
+        }
+        return (number_of_jobs);
+}
+
+
+/*!
+ * \brief Add the chunks of the Block list to the parallel writer.
+ *
+ * Only counts the chunks, and the entities in \c number_of_entries,
+ * when \c jobs is \c NULL.
+ *
+ * \return the number of chunks.
+ */
+static size_t
+dxf_drawing_write_add_blocks
+(
+        DxfDrawingWriteJob *jobs,
+        DxfBlock *blocks,
+        DxfDrawingWriteOrder order,
+        DxfDrawingWriteEntry **entries,
+        size_t *number_of_entries
+)
+{
+        DxfBlock *block = NULL;
+        size_t number_of_jobs;
+
+        number_of_jobs = 0;
+        for (block = blocks; block != NULL; block = (DxfBlock *) block->next)
+        {
+                if (jobs != NULL)
+                {
+                        memset (&jobs[number_of_jobs], 0, sizeof (DxfDrawingWriteJob));
+                        jobs[number_of_jobs].kind = DXF_DRAWING_WRITE_BLOCK_BEGIN;
+                        jobs[number_of_jobs].block = block;
+                }
+                number_of_jobs++;
+                number_of_jobs += dxf_drawing_write_add_entities
+                  ((jobs != NULL) ? &jobs[number_of_jobs] : NULL,
+                  (DxfEntities *) block->entities, order, entries,
+                  number_of_entries);
+                if (jobs != NULL)
+                {
+                        memset (&jobs[number_of_jobs], 0, sizeof (DxfDrawingWriteJob));
+                        jobs[number_of_jobs].kind = DXF_DRAWING_WRITE_BLOCK_END;
+                        jobs[number_of_jobs].block = block;
+                }
+                number_of_jobs++;
+        }
+        return (number_of_jobs);
+}
+
+
+#if defined (DXF_DRAWING_FUNOPEN) || defined (DXF_DRAWING_FOPENCOOKIE)
+/*!
+ * \brief Append output to the memory buffer of a chunk.
+ *
+ * \return the number of bytes written, or -1 when no memory could be
+ * allocated.
+ */
+static long
+dxf_drawing_write_buffer_append
+(
+        DxfDrawingWriteJob *job,
+        const char *data,
+        size_t size
+)
+{
+        char *buffer = NULL;
+        size_t capacity;
+
+        if (job->size + size > job->capacity)
+        {
+                capacity = (job->capacity > 0) ? job->capacity : 65536;
+                while (capacity < job->size + size)
+                {
+                        capacity *= 2;
+                }
+                buffer = dxf_realloc (job->buffer, capacity);
+                if (buffer == NULL)
+                {
+                        return (-1);
+                }
+                job->buffer = buffer;
+                job->capacity = capacity;
+        }
+        memcpy (job->buffer + job->size, data, size);
+        job->size += size;
+        return ((long) size);
+}
+
+
+#if defined (DXF_DRAWING_FOPENCOOKIE)
+static ssize_t
+dxf_drawing_write_buffer_write
+(
+        void *cookie,
+        const char *data,
+        size_t size
+)
+{
+        return ((ssize_t) dxf_drawing_write_buffer_append
+          ((DxfDrawingWriteJob *) cookie, data, size));
+}
+#else
+static int
+dxf_drawing_write_buffer_write
+(
+        void *cookie,
+        const char *data,
+        int size
+)
+{
+        return ((int) dxf_drawing_write_buffer_append
+          ((DxfDrawingWriteJob *) cookie, data, (size_t) size));
+}
+#endif
+#endif
+
+
+/*!
+ * \brief Open a stream writing into the memory buffer of a chunk.
+ *
+ * The buffer is allocated with dxf_realloc (), on platforms without
+ * custom streams the output is staged in a temporary file and copied
+ * into the buffer by dxf_drawing_write_buffer_close ().
+ *
+ * \return the stream, or \c NULL when an error occurred.
+ */
+static FILE *
+dxf_drawing_write_buffer_open
+(
+        DxfDrawingWriteJob *job
+)
+{
+#if defined (DXF_DRAWING_FOPENCOOKIE)
+        cookie_io_functions_t functions;
+
+        memset (&functions, 0, sizeof (functions));
+        functions.write = dxf_drawing_write_buffer_write;
+        return (fopencookie (job, "w", functions));
+#elif defined (DXF_DRAWING_FUNOPEN)
+        return (funopen (job, NULL, dxf_drawing_write_buffer_write, NULL, NULL));
+#else
+        (void) job;
+        return (tmpfile ());
+#endif
+}
+
+
+/*!
+ * \brief Close a stream opened by dxf_drawing_write_buffer_open ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_drawing_write_buffer_close
+(
+        DxfDrawingWriteJob *job,
+        FILE *stream
+)
+{
+#if defined (DXF_DRAWING_FUNOPEN) || defined (DXF_DRAWING_FOPENCOOKIE)
+        (void) job;
+        return ((fclose (stream) == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+#else
+        long size;
+        int result = EXIT_SUCCESS;
+
+        size = ftell (stream);
+        if (size > 0)
+        {
+                job->buffer = dxf_malloc ((size_t) size);
+                if (job->buffer == NULL)
+                {
+                        result = EXIT_FAILURE;
+                }
+                else
+                {
+                        rewind (stream);
+                        job->size = fread (job->buffer, 1, (size_t) size, stream);
+                        job->capacity = (size_t) size;
+                }
+        }
+        fclose (stream);
+        return (result);
+#endif
+}
+
+
+/*!
+ * \brief Serialize a chunk into its memory buffer.
+ */
+static void
+dxf_drawing_write_serialize
+(
+        DxfDrawingWriteWorker *worker,
+        DxfDrawingWriteJob *job
+)
+{
+        DxfFile file;
+        void *entity = NULL;
+        size_t i;
+
+        job->result = EXIT_SUCCESS;
+        job->buffer = NULL;
+        job->size = 0;
+        job->capacity = 0;
+        file = *worker->fp;
+        /* Statistics are not shared between threads, the calling
+         * thread accounts the written entities. */
+        file.stats = NULL;
+        file.fp = dxf_drawing_write_buffer_open (job);
+        if (file.fp == NULL)
+        {
+                job->result = EXIT_FAILURE;
+                return;
+        }
+        switch (job->kind)
+        {
+                case DXF_DRAWING_WRITE_BLOCK_BEGIN:
+                        job->result = dxf_block_write_begin (&file, job->block);
+                        break;
+                case DXF_DRAWING_WRITE_BLOCK_END:
+                        job->result = dxf_block_write_end (&file, job->block);
+                        break;
+                default:
+                        if (job->entries != NULL)
+                        {
+                                for (i = 0; i < job->count; i++)
+                                {
+                                        if (dxf_entities_write_entity (&file,
+                                          job->entries[i].type,
+                                          job->entries[i].entity) != EXIT_SUCCESS)
+                                        {
+                                                job->result = EXIT_FAILURE;
+                                        }
+                                }
+                                break;
+                        }
+                        for (i = 0, entity = job->first;
+                          (i < job->count) && (entity != NULL);
+                          i++, entity = dxf_extents_entity_get_next (job->type, entity))
+                        {
+                                if (dxf_entities_write_entity (&file,
+                                  job->type, entity) != EXIT_SUCCESS)
+                                {
+                                        job->result = EXIT_FAILURE;
+                                }
+                        }
+                        break;
+        }
+        if (dxf_drawing_write_buffer_close (job, file.fp) != EXIT_SUCCESS)
+        {
+                job->result = EXIT_FAILURE;
+        }
+}
+
+
+/*!
+ * \brief Serialize chunks into memory buffers until all chunks are
+ * taken, staying at most \c window chunks ahead of the writer.
+ */
+static void *
+dxf_drawing_write_parallel_worker
+(
+        void *data
+                /*!< a pointer to a \c DxfDrawingWriteWorker. */
+)
+{
+        DxfDrawingWriteWorker *worker = NULL;
+        size_t index;
+
+        worker = (DxfDrawingWriteWorker *) data;
+        for (;;)
+        {
+                pthread_mutex_lock (&worker->mutex);
+                while ((worker->next_job < worker->number_of_jobs)
+                  && (worker->next_job >= worker->next_write + worker->window))
+                {
+                        pthread_cond_wait (&worker->written, &worker->mutex);
+                }
+                if (worker->next_job >= worker->number_of_jobs)
+                {
+                        pthread_mutex_unlock (&worker->mutex);
+                        break;
+                }
+                index = worker->next_job++;
+                pthread_mutex_unlock (&worker->mutex);
+                dxf_drawing_write_serialize (worker, &worker->jobs[index]);
+                pthread_mutex_lock (&worker->mutex);
+                worker->jobs[index].done = TRUE;
+                pthread_cond_broadcast (&worker->serialized);
+                pthread_mutex_unlock (&worker->mutex);
+        }
+        return (NULL);
+}
+
+
+/*!
+ * \brief Write the chunks from \c first up to \c last in order, as they
+ * are serialized by the pool.
+ *
+ * The calling thread serializes a chunk itself when no thread of the
+ * pool has taken it yet.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred for one or more chunks.
+ */
+static int
+dxf_drawing_write_jobs
+(
+        DxfDrawingWriteWorker *worker,
+        size_t first,
+        size_t last
+)
+{
+        DxfDrawingWriteJob *job = NULL;
+        DxfFile *fp = worker->fp;
+        size_t i;
+        size_t j;
+        int result;
+
+        result = EXIT_SUCCESS;
+        for (j = first; j < last; j++)
+        {
+                job = &worker->jobs[j];
+                pthread_mutex_lock (&worker->mutex);
+                while (!job->done)
+                {
+                        if (worker->next_job == j)
+                        {
+                                worker->next_job++;
+                                pthread_mutex_unlock (&worker->mutex);
+                                dxf_drawing_write_serialize (worker, job);
+                                pthread_mutex_lock (&worker->mutex);
+                                job->done = TRUE;
+                        }
+                        else
+                        {
+                                pthread_cond_wait (&worker->serialized, &worker->mutex);
+                        }
+                }
+                pthread_mutex_unlock (&worker->mutex);
+                if (job->result != EXIT_SUCCESS)
+                {
+                        result = EXIT_FAILURE;
+                }
+                if ((fp->stats != NULL)
+                  && (job->kind == DXF_DRAWING_WRITE_ENTITIES))
+                {
+                        for (i = 0; (job->entries != NULL) && (i < job->count); i++)
+                        {
+                                fp->stats->entities_written[job->entries[i].type]++;
+                        }
+                        if (job->entries == NULL)
+                        {
+                                fp->stats->entities_written[job->type] += (int64_t) job->count;
+                        }
+                }
+                if ((job->size > 0)
+                  && (fwrite (job->buffer, 1, job->size, fp->fp) != job->size))
+                {
+                        result = EXIT_FAILURE;
+                }
+                dxf_free (job->buffer);
+                job->buffer = NULL;
+                pthread_mutex_lock (&worker->mutex);
+                worker->next_write = j + 1;
+                pthread_cond_broadcast (&worker->written);
+                pthread_mutex_unlock (&worker->mutex);
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Write a libDXF \c DRAWING to a file, serializing the entities
+ * on a pool of threads.
+ *
+ * Same as dxf_drawing_write_parallel_order () with
+ * \c DXF_DRAWING_WRITE_ORDER_TYPE.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_drawing_write_parallel
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF \c DRAWING. */
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        int number_of_threads
+                /*!< number of threads to use, 0 or less to use one
+                 * thread for every online processor. */
+)
+{
+        return (dxf_drawing_write_parallel_order (drawing, fp,
+          number_of_threads, DXF_DRAWING_WRITE_ORDER_TYPE));
+}
+
+
+/*!
+ * \brief Write a libDXF \c DRAWING to a file, serializing the entities
+ * on a pool of threads, in the given order.
+ *
+ * The \c ENTITIES section, and the entities of every block definition,
+ * are split into chunks of \c DXF_DRAWING_WRITE_CHUNK_SIZE entities.\n
+ * The threads of the pool live for the whole output, they serialize
+ * every chunk into a memory buffer of its own while the calling thread
+ * writes the buffers to \c fp in order.  At most
+ * \c DXF_DRAWING_WRITE_CHUNKS_PER_THREAD chunks per thread are held in
+ * memory.\n
+ * The header, tables, objects and thumbnail are written by the calling
+ * thread.\n
+ * Handles are assigned with dxf_drawing_assign_handles () before the
+ * output starts, the output is the same for any number of threads.\n
+ * A \c DxfEntities keeps one list per entity type, with
+ * \c DXF_DRAWING_WRITE_ORDER_TYPE the entities are written per type
+ * like dxf_file_write () does, and the output is the same as the output
+ * of dxf_file_write ().  With \c DXF_DRAWING_WRITE_ORDER_HANDLE the
+ * entities are written in the order of their handles, the order in
+ * which they were created.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_drawing_write_parallel_order
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF \c DRAWING. */
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        int number_of_threads,
+                /*!< number of threads to use, 0 or less to use one
+                 * thread for every online processor. */
+        DxfDrawingWriteOrder order
+                /*!< order of the entities in the output. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDrawingWriteWorker worker;
+        DxfDrawingWriteEntry *entries = NULL;
+        DxfDrawingWriteEntry *next_entry = NULL;
+        pthread_t *threads = NULL;
+        size_t number_of_block_jobs;
+        size_t number_of_entity_jobs;
+        size_t number_of_entries = 0;
+        int64_t start = 0;
+        long offset = -1;
+        int result;
+        int started;
+        int i;
+
+        /* Do some basic checks. */
+        if ((drawing == NULL) || (fp == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((order != DXF_DRAWING_WRITE_ORDER_TYPE)
+          && (order != DXF_DRAWING_WRITE_ORDER_HANDLE))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an invalid order was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (number_of_threads <= 0)
+        {
+                number_of_threads = (int) sysconf (_SC_NPROCESSORS_ONLN);
+        }
+        if (number_of_threads < 1)
+        {
+                number_of_threads = 1;
+        }
+        dxf_handle_allocator_use (&drawing->handles, fp->last_id_code);
+        if (dxf_drawing_assign_handles (drawing) < 0)
+        {
+                return (EXIT_FAILURE);
+        }
+        fp->last_id_code = dxf_handle_allocator_get_last (&drawing->handles);
+        number_of_block_jobs = dxf_drawing_write_add_blocks (NULL,
+          (DxfBlock *) drawing->block_list, order, NULL, &number_of_entries);
+        number_of_entity_jobs = dxf_drawing_write_add_entities (NULL,
+          (DxfEntities *) drawing->entities_list, order, NULL,
+          &number_of_entries);
+        memset (&worker, 0, sizeof (worker));
+        worker.jobs = dxf_malloc ((number_of_block_jobs + number_of_entity_jobs + 1)
+          * sizeof (DxfDrawingWriteJob));
+        threads = dxf_malloc (number_of_threads * sizeof (pthread_t));
+        if (order == DXF_DRAWING_WRITE_ORDER_HANDLE)
+        {
+                entries = dxf_malloc ((number_of_entries + 1)
+                  * sizeof (DxfDrawingWriteEntry));
+        }
+        if ((worker.jobs == NULL) || (threads == NULL)
+          || ((order == DXF_DRAWING_WRITE_ORDER_HANDLE) && (entries == NULL)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_free (worker.jobs);
+                dxf_free (threads);
+                dxf_free (entries);
+                return (EXIT_FAILURE);
+        }
+        next_entry = entries;
+        dxf_drawing_write_add_blocks (worker.jobs,
+          (DxfBlock *) drawing->block_list, order, &next_entry, NULL);
+        dxf_drawing_write_add_entities (worker.jobs + number_of_block_jobs,
+          (DxfEntities *) drawing->entities_list, order, &next_entry, NULL);
+        worker.number_of_jobs = number_of_block_jobs + number_of_entity_jobs;
+        worker.window = (size_t) number_of_threads * DXF_DRAWING_WRITE_CHUNKS_PER_THREAD;
+        worker.fp = fp;
+        pthread_mutex_init (&worker.mutex, NULL);
+        pthread_cond_init (&worker.serialized, NULL);
+        pthread_cond_init (&worker.written, NULL);
+        result = EXIT_SUCCESS;
+        DXF_TRACE_BEGIN (DXF_TRACING_FILE, "dxf_drawing_write_parallel");
+        if (fp->stats != NULL)
+        {
+                start = dxf_stats_now ();
+                offset = ftell (fp->fp);
+        }
+        /* The calling thread writes, and takes part as worker 0 when
+         * the pool falls behind. */
+        started = 1;
+        for (i = 1; i < number_of_threads; i++)
+        {
+                if (pthread_create (&threads[i], NULL,
+                  dxf_drawing_write_parallel_worker, &worker) != 0)
+                {
+                        break;
+                }
+                started++;
+        }
+        if (drawing->header != NULL)
+        {
+                dxf_header_write (fp, (DxfHeader *) drawing->header);
+        }
+        if (drawing->tables_list != NULL)
+        {
+                dxf_tables_write (fp, (DxfTables *) drawing->tables_list);
+        }
+        dxf_section_write (fp, "BLOCKS");
+        if (dxf_drawing_write_jobs (&worker, 0, number_of_block_jobs) != EXIT_SUCCESS)
+        {
+                result = EXIT_FAILURE;
+        }
+        dxf_endsec_write (fp);
+        dxf_section_write (fp, "ENTITIES");
+        if (dxf_drawing_write_jobs (&worker, number_of_block_jobs,
+          worker.number_of_jobs) != EXIT_SUCCESS)
+        {
+                result = EXIT_FAILURE;
+        }
+        dxf_endsec_write (fp);
+        for (i = 1; i < started; i++)
+        {
+                pthread_join (threads[i], NULL);
+        }
+        dxf_object_write_objects (fp, (DxfObject *) drawing->object_list);
+        if (drawing->thumbnail != NULL)
+        {
+                dxf_thumbnail_write (fp, (DxfThumbnail *) drawing->thumbnail);
+        }
+        dxf_file_write_eof (fp);
+        if (fp->stats != NULL)
+        {
+                fp->stats->write_nanoseconds += dxf_stats_now () - start;
+                if (offset >= 0)
+                {
+                        fp->stats->bytes_written += (int64_t) (ftell (fp->fp) - offset);
+                }
+        }
+        DXF_TRACE_END (DXF_TRACING_FILE, "dxf_drawing_write_parallel");
+        pthread_cond_destroy (&worker.written);
+        pthread_cond_destroy (&worker.serialized);
+        pthread_mutex_destroy (&worker.mutex);
+        dxf_free (worker.jobs);
+        dxf_free (threads);
+        dxf_free (entries);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+enum dxf_drawing_handle_mode
+{
+        DXF_DRAWING_HANDLE_SCAN,
+                /*!< Mark the handles as in use. */
+        DXF_DRAWING_HANDLE_ASSIGN,
+                /*!< Give a new handle to missing and duplicate
+                 * handles. */
+        DXF_DRAWING_HANDLE_REMAP
+                /*!< Give a new handle to every entity. */
+};
+
+
+/*!
+ * \brief Process the handle \c id_code of an entity or block.
+ *
+ * A negative id-code (handle not written) is left alone.
+ *
+ * \return the id-code to be stored.
+ */
+static int
+dxf_drawing_handle
+(
+        DxfDrawing *drawing,
+        DxfHandleSet *set,
+        enum dxf_drawing_handle_mode mode,
+        int id_code,
+        int *number_of_handles
+)
+{
+        if (id_code < 0)
+        {
+                return (id_code);
+        }
+        switch (mode)
+        {
+                case DXF_DRAWING_HANDLE_SCAN:
+                        dxf_handle_allocator_use (&drawing->handles, id_code);
+                        return (id_code);
+                case DXF_DRAWING_HANDLE_ASSIGN:
+                        if ((id_code != 0)
+                          && (dxf_handle_set_insert (set, id_code) == TRUE))
+                        {
+                                return (id_code);
+                        }
+                        break;
+                case DXF_DRAWING_HANDLE_REMAP:
+                        break;
+        }
+        (*number_of_handles)++;
+        return (dxf_handle_allocator_next (&drawing->handles));
+}
+
+
+/*!
+ * \brief Process the handles of all entities in \c entities.
+ */
+static void
+dxf_drawing_handle_entities
+(
+        DxfDrawing *drawing,
+        DxfHandleSet *set,
+        enum dxf_drawing_handle_mode mode,
+        DxfEntities *entities,
+        int *number_of_handles
+)
+{
+        void *entity = NULL;
+        int id_code;
+        int type;
+
+        if (entities == NULL)
+        {
+                return;
+        }
+        for (type = UNKNOWN_ENTITY; type <= XLINE; type++)
+        {
+                for (entity = dxf_extents_entities_get_list (entities, (DxfEntityType) type);
+                  entity != NULL;
+                  entity = dxf_extents_entity_get_next ((DxfEntityType) type, entity))
+                {
+                        id_code = dxf_entities_entity_get_id_code ((DxfEntityType) type, entity);
+                        if (id_code < 0)
+                        {
+                                continue;
+                        }
+                        dxf_entities_entity_set_id_code ((DxfEntityType) type,
+                          entity, dxf_drawing_handle (drawing, set, mode,
+                          id_code, number_of_handles));
+                }
+        }
+}
+
+
+/*!
+ * \brief Get the \c $HANDSEED header variable of \c drawing.
+ *
+ * \return the handle seed, or 0 when there is no header or no valid
+ * handle seed.
+ */
+static int
+dxf_drawing_get_handseed
+(
+        DxfDrawing *drawing
+)
+{
+        DxfHeader *header = (DxfHeader *) drawing->header;
+        long hand_seed;
+
+        if ((header == NULL) || (header->HandSeed == NULL))
+        {
+                return (0);
+        }
+        hand_seed = strtol (header->HandSeed, NULL, 16);
+        if ((hand_seed <= 0) || (hand_seed > INT_MAX))
+        {
+                return (0);
+        }
+        return ((int) hand_seed);
+}
+
+
+/*!
+ * \brief Process the handles of all symbol table entries, block
+ * definitions, entities and objects of \c drawing, in the order of the
+ * output.
+ *
+ * When scanning, the handles below the \c $HANDSEED header variable
+ * are marked as in use as well: they may be used by sections that are
+ * not kept in memory.
+ */
+static void
+dxf_drawing_handle_drawing
+(
+        DxfDrawing *drawing,
+        DxfHandleSet *set,
+        enum dxf_drawing_handle_mode mode,
+        int *number_of_handles
+)
+{
+        DxfTables *tables = NULL;
+        DxfBlock *block = NULL;
+        DxfEndblk *endblk = NULL;
+        DxfObject *object = NULL;
+        void *entry = NULL;
+        int table;
+
+        if ((mode == DXF_DRAWING_HANDLE_SCAN)
+          && (dxf_drawing_get_handseed (drawing) > 1))
+        {
+                dxf_handle_allocator_use (&drawing->handles,
+                  dxf_drawing_get_handseed (drawing) - 1);
+        }
+        tables = (DxfTables *) drawing->tables_list;
+        for (table = 0;
+          (tables != NULL) && (table < DXF_TABLES_NUMBER_OF_SYMBOL_TABLES);
+          table++)
+        {
+                for (entry = dxf_tables_get_first_entry (tables, table);
+                  entry != NULL;
+                  entry = dxf_tables_get_next_entry (table, entry))
+                {
+                        dxf_tables_set_entry_id_code (table, entry,
+                          dxf_drawing_handle (drawing, set, mode,
+                          dxf_tables_get_entry_id_code (table, entry),
+                          number_of_handles));
+                }
+        }
+        for (block = (DxfBlock *) drawing->block_list;
+          block != NULL;
+          block = (DxfBlock *) block->next)
+        {
+                block->id_code = dxf_drawing_handle (drawing, set, mode,
+                  block->id_code, number_of_handles);
+                dxf_drawing_handle_entities (drawing, set, mode,
+                  (DxfEntities *) block->entities, number_of_handles);
+                endblk = (DxfEndblk *) block->endblk;
+                if (endblk != NULL)
+                {
+                        endblk->id_code = dxf_drawing_handle (drawing, set,
+                          mode, endblk->id_code, number_of_handles);
+                }
+        }
+        dxf_drawing_handle_entities (drawing, set, mode,
+          (DxfEntities *) drawing->entities_list, number_of_handles);
+        for (object = (DxfObject *) drawing->object_list;
+          object != NULL;
+          object = (DxfObject *) object->next)
+        {
+                object->id_code = dxf_drawing_handle (drawing, set, mode,
+                  object->id_code, number_of_handles);
+        }
+}
+
+
+/*!
+ * \brief Allocate a new handle from the handle allocator of a libDXF
+ * drawing.
+ *
+ * Can be called concurrently from multiple threads.
+ *
+ * \return the new handle, or -1 when an error occurred.
+ */
+int
+dxf_drawing_new_handle
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF \c DRAWING. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int handle;
+
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        handle = dxf_handle_allocator_next (&drawing->handles);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (handle);
+}
+
+
+/*!
+ * \brief Mark the handles of all symbol table entries, block
+ * definitions, entities and objects of a libDXF drawing as in use.
+ *
+ * Called after a drawing was read, so the following handles from the
+ * allocator do not collide with the handles read from file.\n
+ * The handles below the \c $HANDSEED header variable are marked as in
+ * use as well.
+ *
+ * \return the largest handle in use, or -1 when an error occurred.
+ */
+int
+dxf_drawing_scan_handles
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF \c DRAWING. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int number_of_handles = 0;
+
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        dxf_drawing_handle_drawing (drawing, NULL,
+          DXF_DRAWING_HANDLE_SCAN, &number_of_handles);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_handle_allocator_get_last (&drawing->handles));
+}
+
+
+/*!
+ * \brief Give every symbol table entry, block definition, entity and
+ * object of a libDXF drawing without a handle, or with a duplicate
+ * handle, a new handle.
+ *
+ * The first occurrence of a handle in the order of the output keeps its
+ * handle, new handles are allocated following the largest handle in
+ * use, in the order of the output.\n
+ * The \c $HANDSEED header variable is updated.
+ *
+ * \return the number of new handles, or -1 when an error occurred.
+ */
+int
+dxf_drawing_assign_handles
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF \c DRAWING. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHandleSet *set = NULL;
+        int number_of_handles = 0;
+
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        set = dxf_handle_set_init (dxf_handle_set_new ());
+        if (set == NULL)
+        {
+                return (-1);
+        }
+        dxf_drawing_handle_drawing (drawing, NULL,
+          DXF_DRAWING_HANDLE_SCAN, &number_of_handles);
+        dxf_drawing_handle_drawing (drawing, set,
+          DXF_DRAWING_HANDLE_ASSIGN, &number_of_handles);
+        dxf_handle_set_free (set);
+        dxf_drawing_update_handseed (drawing);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (number_of_handles);
+}
+
+
+/*!
+ * \brief Give every entity in \c entities a new handle from the
+ * handle allocator of a libDXF drawing.
+ *
+ * Used to import entities from another drawing: remap the handles
+ * before the entities are added to \c drawing.
+ *
+ * \return the number of new handles, or -1 when an error occurred.
+ */
+int
+dxf_drawing_remap_handles
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF \c DRAWING. */
+        DxfEntities *entities
+                /*!< a pointer to the entities to be imported. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int number_of_handles = 0;
+
+        /* Do some basic checks. */
+        if ((drawing == NULL) || (entities == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        dxf_drawing_handle_entities (drawing, NULL,
+          DXF_DRAWING_HANDLE_REMAP, entities, &number_of_handles);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (number_of_handles);
+}
+
+
+/*!
+ * \brief Set the \c $HANDSEED header variable of a libDXF drawing to
+ * the next handle of the handle allocator.
+ *
+ * The handle seed is never lowered.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_drawing_update_handseed
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF \c DRAWING. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHeader *header = NULL;
+        char hand_seed[DXF_MAX_STRING_LENGTH];
+        int next_handle;
+
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        header = (DxfHeader *) drawing->header;
+        if (header == NULL)
+        {
+                return (EXIT_SUCCESS);
+        }
+        next_handle = dxf_handle_allocator_get_last (&drawing->handles) + 1;
+        if (dxf_drawing_get_handseed (drawing) >= next_handle)
+        {
+                return (EXIT_SUCCESS);
+        }
+        snprintf (hand_seed, sizeof (hand_seed), "%X",
+          (unsigned int) next_handle);
+        dxf_free (header->HandSeed);
+        header->HandSeed = dxf_strdup (hand_seed);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/* EOF*/
\ No newline at end of file
@@ -46,6 +46,9 @@
 #include "entities.h"
 #include "object.h"
 #include "thumbnail.h"
+#include "tessellation.h"
+#include "symbol_index.h"
+#include "handle.h"
 
 
 #ifdef __cplusplus
@@ -53,6 +56,39 @@ extern "C" {
 #endif
 
 
+#define DXF_DRAWING_EXTENTS_CHUNK_SIZE 4096
+        /*!< \brief Number of entities handed to a thread at a time by
+         * \c dxf_drawing_update_extents(). */
+
+#define DXF_DRAWING_TESSELLATE_CHUNK_SIZE 256
+        /*!< \brief Number of splines handed to a thread at a time by
+         * \c dxf_drawing_tessellate_splines(). */
+
+#define DXF_DRAWING_WRITE_CHUNK_SIZE 1024
+        /*!< \brief Number of entities serialized by a thread at a time by
+         * \c dxf_drawing_write_parallel(). */
+
+#define DXF_DRAWING_WRITE_CHUNKS_PER_THREAD 4
+        /*!< \brief Number of serialized chunks per thread held in memory
+         * by \c dxf_drawing_write_parallel() before they are written. */
+
+
+/*!
+ * \brief Order of the entities written by
+ * \c dxf_drawing_write_parallel_order().
+ */
+typedef enum
+dxf_drawing_write_order
+{
+        DXF_DRAWING_WRITE_ORDER_TYPE,
+                /*!< per entity type, in the order of the lists, the
+                 * order of \c dxf_file_write(). */
+        DXF_DRAWING_WRITE_ORDER_HANDLE
+                /*!< in the order of the handles (the order of
+                 * creation), entities without a handle last. */
+} DxfDrawingWriteOrder;
+
+
 /*!
  * \brief Definition of a DXF drawing.
  */
@@ -73,6 +109,13 @@ dxf_drawing_struct
         /*!< Objects section data (single linked list).*/
     struct DxfThumbnail *thumbnail;
         /*!< Thumbnail data.*/
+    struct DxfSymbolIndex *block_index;
+        /*!< Name index of the Blocks section data, built on the first
+         * lookup and maintained by the add, remove and rename
+         * functions.*/
+    DxfHandleAllocator handles;
+        /*!< Handle allocator of the drawing, shared by all threads
+         * adding entities to the drawing. */
     struct DxfDrawing *next;
                 /*!< Pointer to the next DxfDrawing.\n
                  * \c NULL in the last DxfDrawing. */
@@ -99,6 +142,21 @@ DxfDrawing *dxf_drawing_set_thumbnail (DxfDrawing *drawing, DxfThumbnail *thumbn
 DxfDrawing *dxf_drawing_get_next (DxfDrawing *drawing);
 DxfDrawing *dxf_drawing_set_next (DxfDrawing *drawing, DxfDrawing *next);
 DxfDrawing *dxf_drawing_get_last (DxfDrawing *drawing);
+DxfBlock *dxf_drawing_find_block (DxfDrawing *drawing, const char *block_name);
+DxfDrawing *dxf_drawing_add_block (DxfDrawing *drawing, DxfBlock *block);
+DxfDrawing *dxf_drawing_remove_block (DxfDrawing *drawing, DxfBlock *block);
+DxfDrawing *dxf_drawing_rename_block (DxfDrawing *drawing, DxfBlock *block, const char *block_name);
+int dxf_drawing_build_block_index (DxfDrawing *drawing);
+int dxf_drawing_clear_block_index (DxfDrawing *drawing);
+int dxf_drawing_update_extents (DxfDrawing *drawing, int number_of_threads);
+int dxf_drawing_tessellate_splines (DxfDrawing *drawing, double tolerance, int number_of_threads, DxfTessellation *tessellation);
+int dxf_drawing_write_parallel (DxfDrawing *drawing, DxfFile *fp, int number_of_threads);
+int dxf_drawing_write_parallel_order (DxfDrawing *drawing, DxfFile *fp, int number_of_threads, DxfDrawingWriteOrder order);
+int dxf_drawing_new_handle (DxfDrawing *drawing);
+int dxf_drawing_scan_handles (DxfDrawing *drawing);
+int dxf_drawing_assign_handles (DxfDrawing *drawing);
+int dxf_drawing_remap_handles (DxfDrawing *drawing, DxfEntities *entities);
+int dxf_drawing_update_handseed (DxfDrawing *drawing);
 
 
 #ifdef __cplusplus
@@ -41,6 +41,8 @@
 #include "3dline.h"
 #include "3dsolid.h"
 #include "acad_proxy_entity.h"
+#include "acis.h"
+#include "allocator.h"
 #include "appid.h"
 #include "arc.h"
 #include "attdef.h"
@@ -54,11 +56,14 @@
 #include "class.h"
 #include "color.h"
 #include "comment.h"
+#include "compress.h"
 #include "dbg.h"
+#include "diagnostic.h"
 #include "dictionary.h"
 #include "dictionaryvar.h"
 #include "dimension.h"
 #include "dimstyle.h"
+#include "directory.h"
 #include "donut.h"
 #include "drawing.h"
 #include "ellipse.h"
@@ -67,12 +72,18 @@
 #include "endtab.h"
 #include "entities.h"
 #include "entity.h"
+#include "explode.h"
+#include "extents.h"
 #include "file.h"
+#include "flatten.h"
+#include "geom_batch.h"
 #include "global.h"
 #include "group.h"
+#include "handle.h"
 #include "hatch.h"
 #include "header.h"
 #include "helix.h"
+#include "hex.h"
 #include "idbuffer.h"
 #include "image.h"
 #include "imagedef.h"
@@ -92,17 +103,20 @@
 #include "mline.h"
 #include "mlinestyle.h"
 #include "mtext.h"
+#include "nurbs.h"
 #include "object.h"
 #include "object_id.h"
 #include "object_ptr.h"
 #include "oleframe.h"
 #include "ole2frame.h"
 #include "param.h"
+#include "parser.h"
 #include "point.h"
 #include "polyline.h"
 #include "proprietary_data.h"
 #include "rastervariables.h"
 #include "ray.h"
+#include "readahead.h"
 #include "region.h"
 #include "rtext.h"
 #include "section.h"
@@ -113,20 +127,26 @@
 #include "spatial_filter.h"
 #include "spatial_index.h"
 #include "spline.h"
+#include "stats.h"
 #include "style.h"
 #include "sun.h"
+#include "symbol_index.h"
 #include "table.h"
 #include "tables.h"
+#include "tessellation.h"
 #include "text.h"
 #include "thumbnail.h"
 #include "tolerance.h"
 #include "trace.h"
+#include "tracing.h"
+#include "transform.h"
 #include "ucs.h"
 #include "util.h"
 #include "vertex.h"
 #include "view.h"
 #include "viewport.h"
 #include "vport.h"
+#include "writer.h"
 #include "xline.h"
 #include "xrecord.h"
 
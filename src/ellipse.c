@@ -42,6 +42,7 @@
 
 
 #include "ellipse.h"
+#include "util.h"
 
 
 /*!
@@ -64,7 +65,7 @@ dxf_ellipse_new ()
         size = sizeof (DxfEllipse);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((ellipse = malloc (size)) == NULL)
+        if ((ellipse = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -102,22 +103,22 @@ dxf_ellipse_init
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 ellipse = dxf_ellipse_new ();
         }
         if (ellipse == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         /* Assign initial values to members. */
         ellipse->id_code = 0;
-        ellipse->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        ellipse->layer = strdup (DXF_DEFAULT_LAYER);
+        ellipse->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        ellipse->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         ellipse->elevation = 0.0;
         ellipse->thickness = 0.0;
         ellipse->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -126,14 +127,14 @@ dxf_ellipse_init
         ellipse->paperspace = DXF_MODELSPACE;
         ellipse->graphics_data_size = 0;
         ellipse->shadow_mode = 0;
-        ellipse->dictionary_owner_soft = strdup ("");
-        ellipse->object_owner_soft = strdup ("");
-        ellipse->material = strdup ("");
-        ellipse->dictionary_owner_hard = strdup ("");
+        ellipse->dictionary_owner_soft = dxf_strdup ("");
+        ellipse->object_owner_soft = dxf_strdup ("");
+        ellipse->material = dxf_strdup ("");
+        ellipse->dictionary_owner_hard = dxf_strdup ("");
         ellipse->lineweight = 0;
-        ellipse->plot_style_name = strdup ("");
+        ellipse->plot_style_name = dxf_strdup ("");
         ellipse->color_value = 0;
-        ellipse->color_name = strdup ("");
+        ellipse->color_name = dxf_strdup ("");
         ellipse->transparency = 0;
         ellipse->extr_x0 = 0.0;
         ellipse->extr_y0 = 0.0;
@@ -177,38 +178,35 @@ dxf_ellipse_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int iter330;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 ellipse = dxf_ellipse_init (ellipse);
         }
         if (ellipse->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfBinaryData struct.\n")));
                 ellipse->binary_graphics_data = dxf_binary_data_init (ellipse->binary_graphics_data);
                 if (ellipse->binary_graphics_data == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -216,15 +214,15 @@ dxf_ellipse_read
         }
         if (ellipse->p0 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 ellipse->p0 = dxf_point_init (ellipse->p0);
                 if (ellipse->p0 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -232,34 +230,31 @@ dxf_ellipse_read
         }
         if (ellipse->p1 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 ellipse->p1 = dxf_point_init (ellipse->p1);
                 if (ellipse->p1 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
                 }
         }
-        iter310 = (DxfBinaryData *) ellipse->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        memset (temp_string, 0, sizeof (temp_string));
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -274,13 +269,17 @@ dxf_ellipse_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->linetype);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (ellipse->linetype);
+                        ellipse->linetype = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->layer);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (ellipse->layer);
+                        ellipse->layer = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -412,7 +411,7 @@ dxf_ellipse_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbEllipse") != 0)))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -457,9 +456,8 @@ dxf_ellipse_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_data_append_hex ((DxfBinaryData *) ellipse->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -468,14 +466,18 @@ dxf_ellipse_read
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
                                 (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->dictionary_owner_soft);
+                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                                dxf_free (ellipse->dictionary_owner_soft);
+                                ellipse->dictionary_owner_soft = dxf_strdup (temp_string);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
                                 (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->object_owner_soft);
+                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                                dxf_free (ellipse->object_owner_soft);
+                                ellipse->object_owner_soft = dxf_strdup (temp_string);
                         }
                         iter330++;
                 }
@@ -484,14 +486,18 @@ dxf_ellipse_read
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->material);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (ellipse->material);
+                        ellipse->material = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->dictionary_owner_hard);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (ellipse->dictionary_owner_hard);
+                        ellipse->dictionary_owner_hard = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -505,7 +511,9 @@ dxf_ellipse_read
                         /* Now follows a string containing a plot style
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->plot_style_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (ellipse->plot_style_name);
+                        ellipse->plot_style_name = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -518,7 +526,9 @@ dxf_ellipse_read
                         /* Now follows a string containing a color
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->color_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (ellipse->color_name);
+                        ellipse->color_name = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -536,22 +546,25 @@ dxf_ellipse_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
+                        dxf_read_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (ellipse->linetype, "") == 0)
         {
-                ellipse->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_free (ellipse->linetype);
+                ellipse->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (ellipse->layer, "") == 0)
         {
-                ellipse->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_free (ellipse->layer);
+                ellipse->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -580,77 +593,77 @@ dxf_ellipse_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("ELLIPSE");
+        char *dxf_entity_name = dxf_strdup ("ELLIPSE");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (ellipse->p0 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (ellipse->p1 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (ellipse->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, ellipse->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                ellipse->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                ellipse->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (ellipse->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, ellipse->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                ellipse->layer = strdup (DXF_DEFAULT_LAYER);
+                ellipse->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (ellipse->ratio == 0.0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () ratio value equals 0.0 for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, ellipse->id_code);
         }
@@ -732,16 +745,7 @@ dxf_ellipse_write
 #else
                 fprintf (fp->fp, " 92\n%" PRIi32 "\n", ellipse->graphics_data_size);
 #endif
-                if (ellipse->binary_graphics_data != NULL)
-                {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) ellipse->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
-                }
+                dxf_binary_data_write (fp, (DxfBinaryData *) ellipse->binary_graphics_data);
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
@@ -771,7 +775,7 @@ dxf_ellipse_write
         fprintf (fp->fp, " 41\n%f\n", ellipse->start_angle);
         fprintf (fp->fp, " 42\n%f\n", ellipse->end_angle);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -800,30 +804,30 @@ dxf_ellipse_free
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ellipse->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (ellipse->linetype);
-        free (ellipse->layer);
+        dxf_free (ellipse->linetype);
+        dxf_free (ellipse->layer);
         dxf_binary_data_free_list (ellipse->binary_graphics_data);
-        free (ellipse->dictionary_owner_soft);
-        free (ellipse->object_owner_soft);
-        free (ellipse->material);
-        free (ellipse->dictionary_owner_hard);
-        free (ellipse->plot_style_name);
-        free (ellipse->color_name);
+        dxf_free (ellipse->dictionary_owner_soft);
+        dxf_free (ellipse->object_owner_soft);
+        dxf_free (ellipse->material);
+        dxf_free (ellipse->dictionary_owner_hard);
+        dxf_free (ellipse->plot_style_name);
+        dxf_free (ellipse->color_name);
         dxf_point_free_list (ellipse->p0);
         dxf_point_free_list (ellipse->p1);
-        free (ellipse);
+        dxf_free (ellipse);
         ellipse = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -844,18 +848,19 @@ dxf_ellipse_free_list
                  * \c ELLIPSE entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (ellipses == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (ellipses != NULL)
         {
                 DxfEllipse *iter = (DxfEllipse *) ellipses->next;
+                ellipses->next = NULL;
                 dxf_ellipse_free (ellipses);
                 ellipses = (DxfEllipse *) iter;
         }
@@ -973,7 +978,7 @@ dxf_ellipse_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->linetype));
+        return (dxf_strdup (ellipse->linetype));
 }
 
 
@@ -1007,7 +1012,7 @@ dxf_ellipse_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->linetype = strdup (linetype);
+        ellipse->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1048,7 +1053,7 @@ dxf_ellipse_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->layer));
+        return (dxf_strdup (ellipse->layer));
 }
 
 
@@ -1082,7 +1087,7 @@ dxf_ellipse_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->layer = strdup (layer);
+        ellipse->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1840,7 +1845,7 @@ dxf_ellipse_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->dictionary_owner_soft));
+        return (dxf_strdup (ellipse->dictionary_owner_soft));
 }
 
 
@@ -1876,7 +1881,7 @@ dxf_ellipse_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        ellipse->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1920,7 +1925,7 @@ dxf_ellipse_get_object_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->object_owner_soft));
+        return (dxf_strdup (ellipse->object_owner_soft));
 }
 
 
@@ -1956,7 +1961,7 @@ dxf_ellipse_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->object_owner_soft = strdup (object_owner_soft);
+        ellipse->object_owner_soft = dxf_strdup (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2000,7 +2005,7 @@ dxf_ellipse_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->material));
+        return (dxf_strdup (ellipse->material));
 }
 
 
@@ -2038,7 +2043,7 @@ dxf_ellipse_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->material = strdup (material);
+        ellipse->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2082,7 +2087,7 @@ dxf_ellipse_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->dictionary_owner_hard));
+        return (dxf_strdup (ellipse->dictionary_owner_hard));
 }
 
 
@@ -2118,7 +2123,7 @@ dxf_ellipse_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        ellipse->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2225,7 +2230,7 @@ dxf_ellipse_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->plot_style_name));
+        return (dxf_strdup (ellipse->plot_style_name));
 }
 
 
@@ -2263,7 +2268,7 @@ dxf_ellipse_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->plot_style_name = strdup (plot_style_name);
+        ellipse->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2370,7 +2375,7 @@ dxf_ellipse_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->color_name));
+        return (dxf_strdup (ellipse->color_name));
 }
 
 
@@ -2408,7 +2413,7 @@ dxf_ellipse_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->color_name = strdup (color_name);
+        ellipse->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2493,7 +2498,7 @@ dxf_ellipse_get_p0
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2532,7 +2537,7 @@ dxf_ellipse_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2571,7 +2576,7 @@ dxf_ellipse_get_x0
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2614,7 +2619,7 @@ dxf_ellipse_set_x0
                  * \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2662,7 +2667,7 @@ dxf_ellipse_get_y0
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2705,7 +2710,7 @@ dxf_ellipse_set_y0
                  * \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2753,7 +2758,7 @@ dxf_ellipse_get_z0
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2796,7 +2801,7 @@ dxf_ellipse_set_z0
                  * \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2844,7 +2849,7 @@ dxf_ellipse_get_p1
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2877,7 +2882,7 @@ dxf_ellipse_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2916,7 +2921,7 @@ dxf_ellipse_get_x1
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2958,7 +2963,7 @@ dxf_ellipse_set_x1
                 /*!< the X-value \c x1 of a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3006,7 +3011,7 @@ dxf_ellipse_get_y1
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3048,7 +3053,7 @@ dxf_ellipse_set_y1
                 /*!< the Y-value \c y1 of a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3096,7 +3101,7 @@ dxf_ellipse_get_z1
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3138,7 +3143,7 @@ dxf_ellipse_set_z1
                 /*!< the Z-value \c z1 of a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3231,7 +3236,7 @@ dxf_ellipse_set_ratio
                 /*!< the \c ratio of a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3445,7 +3450,7 @@ dxf_ellipse_get_extr_x0
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3481,7 +3486,7 @@ dxf_ellipse_set_extr_x0
                  * \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3513,7 +3518,7 @@ dxf_ellipse_get_extr_y0
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3549,7 +3554,7 @@ dxf_ellipse_set_extr_y0
                  * \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3581,7 +3586,7 @@ dxf_ellipse_get_extr_z0
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3617,7 +3622,7 @@ dxf_ellipse_set_extr_z0
                  * \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3651,7 +3656,7 @@ dxf_ellipse_get_extrusion_vector_as_point
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *point = NULL;
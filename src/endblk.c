@@ -61,7 +61,7 @@ dxf_endblk_new ()
         size = sizeof (DxfEndblk);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((endblk = malloc (size)) == NULL)
+        if ((endblk = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -99,21 +99,21 @@ dxf_endblk_init
         /* Do some basic checks. */
         if (endblk == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 endblk = dxf_endblk_new ();
         }
         if (endblk == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         endblk->id_code = 0;
-        endblk->layer = strdup (DXF_DEFAULT_LAYER);
-        endblk->object_owner_soft = strdup ("");
+        endblk->layer = dxf_strdup (DXF_DEFAULT_LAYER);
+        endblk->object_owner_soft = dxf_strdup ("");
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -154,16 +154,16 @@ dxf_endblk_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (endblk == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 endblk = dxf_endblk_init (endblk);
@@ -173,12 +173,12 @@ dxf_endblk_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 else if (strcmp (temp_string, "5") == 0)
@@ -206,18 +206,19 @@ dxf_endblk_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle ommitted members and/or illegal values. */
         if (strcmp (endblk->layer, "") == 0)
         {
-                endblk->layer = strdup (DXF_DEFAULT_LAYER);
+                endblk->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -246,14 +247,14 @@ dxf_endblk_write
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (endblk == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -312,14 +313,14 @@ dxf_endblk_free
         /* Do some basic checks. */
         if (endblk == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (endblk->layer);
-        free (endblk->object_owner_soft);
-        free (endblk);
+        dxf_free (endblk->layer);
+        dxf_free (endblk->object_owner_soft);
+        dxf_free (endblk);
         endblk = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -438,7 +439,7 @@ dxf_endblk_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (endblk->layer);
+        result = dxf_strdup (endblk->layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -476,7 +477,7 @@ dxf_endblk_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        endblk->layer = strdup (layer);
+        endblk->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -519,7 +520,7 @@ dxf_endblk_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (endblk->object_owner_soft);
+        result = dxf_strdup (endblk->object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -559,7 +560,7 @@ dxf_endblk_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        endblk->object_owner_soft = strdup (object_owner_soft);
+        endblk->object_owner_soft = dxf_strdup (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -53,6 +53,11 @@
 
 
 #include "entities.h"
+#include "extents.h"
+#include "helix.h"
+#include "seqend.h"
+#include "spline.h"
+#include "stats.h"
 
 
 /*!
@@ -72,7 +77,7 @@ dxf_entities_new ()
         size = sizeof (DxfEntities);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((entities = malloc (size)) == NULL)
+        if ((entities = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -110,302 +115,337 @@ dxf_entities_init
         /* Do some basic checks. */
         if (entities == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 entities = dxf_entities_new ();
         }
         if (entities == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         /* Initialize new structs for members. */
-        entities->dface_list = dxf_3dface_init (entities->dface_list);
+        entities->dface_list = (struct Dxf3dface *) dxf_3dface_init
+          ((Dxf3dface *) entities->dface_list);
         if (entities->dface_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        entities->dsolid_list = dxf_3dsolid_init (entities->dsolid_list);
+        entities->dsolid_list = (struct Dxf3dsolid *) dxf_3dsolid_init
+          ((Dxf3dsolid *) entities->dsolid_list);
         if (entities->dsolid_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        entities->acad_proxy_entity_list = dxf_acad_proxy_entity_init (entities->acad_proxy_entity_list);
+        entities->acad_proxy_entity_list = (struct DxfAcadProxyEntity *) dxf_acad_proxy_entity_init
+          ((DxfAcadProxyEntity *) entities->acad_proxy_entity_list);
         if (entities->acad_proxy_entity_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        entities->arc_list = dxf_arc_init (entities->arc_list);
+        entities->arc_list = (struct DxfArc *) dxf_arc_init
+          ((DxfArc *) entities->arc_list);
         if (entities->arc_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        entities->attdef_list = dxf_attdef_init (entities->attdef_list);
+        entities->attdef_list = (struct DxfAttdef *) dxf_attdef_init
+          ((DxfAttdef *) entities->attdef_list);
         if (entities->attdef_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        entities->attrib_list = dxf_attrib_init (entities->attrib_list);
+        entities->attrib_list = (struct DxfAttrib *) dxf_attrib_init
+          ((DxfAttrib *) entities->attrib_list);
         if (entities->attrib_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        entities->body_list = dxf_body_init (entities->body_list);
+        entities->body_list = (struct DxfBody *) dxf_body_init
+          ((DxfBody *) entities->body_list);
         if (entities->body_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        entities->circle_list = dxf_circle_init (entities->circle_list);
+        entities->circle_list = (struct DxfCircle *) dxf_circle_init
+          ((DxfCircle *) entities->circle_list);
         if (entities->circle_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        entities->dimension_list = dxf_dimension_init (entities->dimension_list);
+        entities->dimension_list = (struct DxfDimension *) dxf_dimension_init
+          ((DxfDimension *) entities->dimension_list);
         if (entities->dimension_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        entities->ellipse_list = dxf_ellipse_init (entities->ellipse_list);
+        entities->ellipse_list = (struct DxfEllipse *) dxf_ellipse_init
+          ((DxfEllipse *) entities->ellipse_list);
         if (entities->ellipse_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        entities->hatch_list = dxf_hatch_init (entities->hatch_list);
+        entities->hatch_list = (struct DxfHatch *) dxf_hatch_init
+          ((DxfHatch *) entities->hatch_list);
         if (entities->hatch_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        entities->helix_list = dxf_helix_init (entities->helix_list);
+        entities->helix_list = (struct DxfHelix *) dxf_helix_init
+          ((DxfHelix *) entities->helix_list);
         if (entities->helix_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        entities->image_list = dxf_image_init (entities->image_list);
+        entities->image_list = (struct DxfImage *) dxf_image_init
+          ((DxfImage *) entities->image_list);
         if (entities->image_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        entities->insert_list = dxf_insert_init (entities->insert_list);
+        entities->insert_list = (struct DxfInsert *) dxf_insert_init
+          ((DxfInsert *) entities->insert_list);
         if (entities->insert_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        entities->leader_list = dxf_leader_init (entities->leader_list);
+        entities->leader_list = (struct DxfLeader *) dxf_leader_init
+          ((DxfLeader *) entities->leader_list);
         if (entities->leader_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        entities->light_list = dxf_light_init (entities->light_list);
+        entities->light_list = (struct DxfLight *) dxf_light_init
+          ((DxfLight *) entities->light_list);
         if (entities->light_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        entities->line_list = dxf_line_init (entities->line_list);
+        entities->line_list = (struct DxfLine *) dxf_line_init
+          ((DxfLine *) entities->line_list);
         if (entities->line_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        entities->lw_polyline_list = dxf_lwpolyline_init (entities->lw_polyline_list);
+        entities->lw_polyline_list = (struct DxfLWPolyline *) dxf_lwpolyline_init
+          ((DxfLWPolyline *) entities->lw_polyline_list);
         if (entities->lw_polyline_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         //entities->mesh_list = NULL;
-        entities->mline_list = dxf_mline_init (entities->mline_list);
+        entities->mline_list = (struct DxfMline *) dxf_mline_init
+          ((DxfMline *) entities->mline_list);
         if (entities->mline_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         //entities->mleader_list = NULL;
         //entities->mleaderstyle_list = NULL;
-        entities->mtext_list = dxf_mtext_init (entities->mtext_list);
+        entities->mtext_list = (struct DxfMtext *) dxf_mtext_init
+          ((DxfMtext *) entities->mtext_list);
         if (entities->mtext_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        entities->oleframe_list = dxf_oleframe_init (entities->oleframe_list);
+        entities->oleframe_list = (struct DxfOleFrame *) dxf_oleframe_init
+          ((DxfOleFrame *) entities->oleframe_list);
         if (entities->oleframe_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        entities->ole2frame_list = dxf_ole2frame_init (entities->ole2frame_list);
+        entities->ole2frame_list = (struct DxfOle2Frame *) dxf_ole2frame_init
+          ((DxfOle2Frame *) entities->ole2frame_list);
         if (entities->ole2frame_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        entities->point_list = dxf_point_init (entities->point_list);
+        entities->point_list = (struct DxfPoint *) dxf_point_init
+          ((DxfPoint *) entities->point_list);
         if (entities->point_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        entities->polyline_list = dxf_polyline_init (entities->polyline_list);
+        entities->polyline_list = (struct DxfPolyline *) dxf_polyline_init
+          ((DxfPolyline *) entities->polyline_list);
         if (entities->polyline_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        entities->ray_list = dxf_ray_init (entities->ray_list);
+        entities->ray_list = (struct DxfRay *) dxf_ray_init
+          ((DxfRay *) entities->ray_list);
         if (entities->ray_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        entities->region_list = dxf_region_init (entities->region_list);
+        entities->region_list = (struct DxfRegion *) dxf_region_init
+          ((DxfRegion *) entities->region_list);
         if (entities->region_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         //entities->section_list = NULL;
-        entities->shape_list = dxf_shape_init (entities->shape_list);
+        entities->shape_list = (struct DxfShape *) dxf_shape_init
+          ((DxfShape *) entities->shape_list);
         if (entities->shape_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        entities->solid_list = dxf_solid_init (entities->solid_list);
+        entities->solid_list = (struct DxfSolid *) dxf_solid_init
+          ((DxfSolid *) entities->solid_list);
         if (entities->solid_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        entities->spline_list = dxf_spline_init (entities->spline_list);
+        entities->spline_list = (struct DxfSpline *) dxf_spline_init
+          ((DxfSpline *) entities->spline_list);
         if (entities->spline_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         //entities->sun_list = NULL;
         //entities->surface_list = NULL;
-        entities->table_list = dxf_table_init (entities->table_list);
+        entities->table_list = (struct DxfTable *) dxf_table_init
+          ((DxfTable *) entities->table_list);
         if (entities->table_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        entities->text_list = dxf_text_init (entities->text_list);
+        entities->text_list = (struct DxfText *) dxf_text_init
+          ((DxfText *) entities->text_list);
         if (entities->text_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        entities->tolerance_list = dxf_tolerance_init (entities->tolerance_list);
+        entities->tolerance_list = (struct DxfTolerance *) dxf_tolerance_init
+          ((DxfTolerance *) entities->tolerance_list);
         if (entities->tolerance_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        entities->trace_list = dxf_trace_init (entities->trace_list);
+        entities->trace_list = (struct DxfTrace *) dxf_trace_init
+          ((DxfTrace *) entities->trace_list);
         if (entities->trace_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         //entities->underlay_list = NULL;
-        entities->vertex_list = dxf_vertex_init (entities->vertex_list);
+        entities->vertex_list = (struct DxfVertex *) dxf_vertex_init
+          ((DxfVertex *) entities->vertex_list);
         if (entities->vertex_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        entities->viewport_list = dxf_viewport_init (entities->viewport_list);
+        entities->viewport_list = (struct DxfViewport *) dxf_viewport_init
+          ((DxfViewport *) entities->viewport_list);
         if (entities->viewport_list == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
@@ -419,28 +459,408 @@ dxf_entities_init
 }
 
 
+/*!
+ * \brief Read one entity of a type libDXF can parse.
+ *
+ * The name of the entity has been read, the group code \c 0 following
+ * the entity is consumed.
+ *
+ * \return a pointer to the entity, or \c NULL for other entity types
+ * or when an error occurred.
+ */
+static void *
+dxf_entities_read_entity
+(
+        DxfFile *fp,
+        DxfEntityType type
+)
+{
+        switch (type)
+        {
+                case DSOLID:
+                        return ((void *) dxf_3dsolid_read (fp, dxf_3dsolid_init (dxf_3dsolid_new ())));
+                case ARC:
+                        return ((void *) dxf_arc_read (fp, dxf_arc_init (dxf_arc_new ())));
+                case BODY:
+                        return ((void *) dxf_body_read (fp, dxf_body_init (dxf_body_new ())));
+                case CIRCLE:
+                        return ((void *) dxf_circle_read (fp, dxf_circle_init (dxf_circle_new ())));
+                case ELLIPSE:
+                        return ((void *) dxf_ellipse_read (fp, dxf_ellipse_init (dxf_ellipse_new ())));
+                case HELIX:
+                        return ((void *) dxf_helix_read (fp, dxf_helix_init (dxf_helix_new ())));
+                case LINE:
+                        return ((void *) dxf_line_read (fp, dxf_line_init (dxf_line_new ())));
+                case LWPOLYLINE:
+                        return ((void *) dxf_lwpolyline_read (fp, dxf_lwpolyline_init (dxf_lwpolyline_new ())));
+                case POINT:
+                        return ((void *) dxf_point_read (fp, dxf_point_init (dxf_point_new ())));
+                case POLYLINE:
+                        return ((void *) dxf_polyline_read (fp, dxf_polyline_init (dxf_polyline_new ())));
+                case REGION:
+                        return ((void *) dxf_region_read (fp, dxf_region_init (dxf_region_new ())));
+                case SPLINE:
+                        return ((void *) dxf_spline_read (fp, dxf_spline_init (dxf_spline_new ())));
+                default:
+                        return (NULL);
+        }
+}
+
+
+/*!
+ * \brief Append an entity to the list of its type.
+ *
+ * \c last holds the last entity of every list, indexed by type.
+ */
+static void
+dxf_entities_append
+(
+        DxfEntities *entities,
+        void **last,
+        DxfEntityType type,
+        void *entity
+)
+{
+        switch (type)
+        {
+                case DSOLID:
+                        if (last[type] == NULL)
+                        {
+                                entities->dsolid_list = (struct Dxf3dsolid *) entity;
+                        }
+                        else
+                        {
+                                ((Dxf3dsolid *) last[type])->next = (struct Dxf3dsolid *) entity;
+                        }
+                        break;
+                case ARC:
+                        if (last[type] == NULL)
+                        {
+                                entities->arc_list = (struct DxfArc *) entity;
+                        }
+                        else
+                        {
+                                ((DxfArc *) last[type])->next = (struct DxfArc *) entity;
+                        }
+                        break;
+                case BODY:
+                        if (last[type] == NULL)
+                        {
+                                entities->body_list = (struct DxfBody *) entity;
+                        }
+                        else
+                        {
+                                ((DxfBody *) last[type])->next = (struct DxfBody *) entity;
+                        }
+                        break;
+                case CIRCLE:
+                        if (last[type] == NULL)
+                        {
+                                entities->circle_list = (struct DxfCircle *) entity;
+                        }
+                        else
+                        {
+                                ((DxfCircle *) last[type])->next = (struct DxfCircle *) entity;
+                        }
+                        break;
+                case ELLIPSE:
+                        if (last[type] == NULL)
+                        {
+                                entities->ellipse_list = (struct DxfEllipse *) entity;
+                        }
+                        else
+                        {
+                                ((DxfEllipse *) last[type])->next = (struct DxfEllipse *) entity;
+                        }
+                        break;
+                case HELIX:
+                        if (last[type] == NULL)
+                        {
+                                entities->helix_list = (struct DxfHelix *) entity;
+                        }
+                        else
+                        {
+                                ((DxfHelix *) last[type])->next = (struct DxfHelix *) entity;
+                        }
+                        break;
+                case LINE:
+                        if (last[type] == NULL)
+                        {
+                                entities->line_list = (struct DxfLine *) entity;
+                        }
+                        else
+                        {
+                                ((DxfLine *) last[type])->next = (struct DxfLine *) entity;
+                        }
+                        break;
+                case LWPOLYLINE:
+                        if (last[type] == NULL)
+                        {
+                                entities->lw_polyline_list = (struct DxfLWPolyline *) entity;
+                        }
+                        else
+                        {
+                                ((DxfLWPolyline *) last[type])->next = (struct DxfLWPolyline *) entity;
+                        }
+                        break;
+                case POINT:
+                        if (last[type] == NULL)
+                        {
+                                entities->point_list = (struct DxfPoint *) entity;
+                        }
+                        else
+                        {
+                                ((DxfPoint *) last[type])->next = (struct DxfPoint *) entity;
+                        }
+                        break;
+                case POLYLINE:
+                        if (last[type] == NULL)
+                        {
+                                entities->polyline_list = (struct DxfPolyline *) entity;
+                        }
+                        else
+                        {
+                                ((DxfPolyline *) last[type])->next = (struct DxfPolyline *) entity;
+                        }
+                        break;
+                case REGION:
+                        if (last[type] == NULL)
+                        {
+                                entities->region_list = (struct DxfRegion *) entity;
+                        }
+                        else
+                        {
+                                ((DxfRegion *) last[type])->next = (struct DxfRegion *) entity;
+                        }
+                        break;
+                case SPLINE:
+                        if (last[type] == NULL)
+                        {
+                                entities->spline_list = (struct DxfSpline *) entity;
+                        }
+                        else
+                        {
+                                ((DxfSpline *) last[type])->next = (struct DxfSpline *) entity;
+                        }
+                        break;
+                default:
+                        return;
+        }
+        last[type] = entity;
+}
+
+
+/*!
+ * \brief Read the \c VERTEX and \c SEQEND entities following a
+ * \c POLYLINE entity.
+ *
+ * \c temp_string holds the name of the entity following the
+ * \c POLYLINE entity, on return it holds the name of the entity
+ * following the \c SEQEND entity.
+ */
+static void
+dxf_entities_read_vertices
+(
+        DxfFile *fp,
+        DxfPolyline *polyline,
+        char *temp_string
+)
+{
+        DxfVertex *vertex = NULL;
+        DxfVertex *last = NULL;
+
+        /* Drop the vertex allocated by dxf_polyline_init (). */
+        dxf_vertex_free_list (polyline->vertices);
+        polyline->vertices = NULL;
+        while ((strcmp (temp_string, "VERTEX") == 0) && (!feof (fp->fp)))
+        {
+                vertex = dxf_vertex_read (fp, dxf_vertex_init (dxf_vertex_new ()));
+                if (vertex == NULL)
+                {
+                        break;
+                }
+                DXF_STATS_ADD (fp, allocations, 1);
+                if (last == NULL)
+                {
+                        polyline->vertices = vertex;
+                }
+                else
+                {
+                        last->next = (struct DxfVertex *) vertex;
+                }
+                last = vertex;
+                dxf_read_line (temp_string, fp);
+        }
+        if (strcmp (temp_string, "SEQEND") == 0)
+        {
+                dxf_seqend_free (dxf_seqend_read (fp, dxf_seqend_init (dxf_seqend_new ())));
+                dxf_read_line (temp_string, fp);
+        }
+}
+
+
+/*!
+ * \brief Find the last entity of every list in \c entities.
+ *
+ * \c last receives \c DXF_STATS_NUMBER_OF_ENTITY_TYPES pointers,
+ * indexed by type, as needed by dxf_entities_read_next ().
+ */
+void
+dxf_entities_find_last
+(
+        DxfEntities *entities,
+                /*!< pointer to the \c ENTITIES section. */
+        void **last
+                /*!< array receiving the last entity of every list. */
+)
+{
+        int i;
+
+        for (i = 0; i < DXF_STATS_NUMBER_OF_ENTITY_TYPES; i++)
+        {
+                last[i] = dxf_extents_entities_get_list (entities, (DxfEntityType) i);
+                while ((last[i] != NULL)
+                  && (dxf_extents_entity_get_next ((DxfEntityType) i, last[i]) != NULL))
+                {
+                        last[i] = dxf_extents_entity_get_next ((DxfEntityType) i, last[i]);
+                }
+        }
+}
+
+
+/*!
+ * \brief Read one entity from a DXF file.
+ *
+ * \c temp_string holds the name of the entity, on return it holds the
+ * name of the entity following it.\n
+ * The entity is passed to the entity callback of \c fp, if any, and is
+ * appended to the list of its type in \c entities unless the callback
+ * takes it over.\n
+ * The \c VERTEX and \c SEQEND entities following a \c POLYLINE entity
+ * are read with it, entities of a type libDXF can not parse yet are
+ * skipped.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_entities_read_next
+(
+        DxfFile *fp,
+                /*!< DXF file handle of input file (or device). */
+        DxfEntities *entities,
+                /*!< pointer to the \c ENTITIES section receiving the
+                 * entity. */
+        void **last,
+                /*!< last entity of every list, as found by
+                 * dxf_entities_find_last (). */
+        char *temp_string
+                /*!< name of the entity, a buffer of
+                 * \c DXF_MAX_STRING_LENGTH characters. */
+)
+{
+        void *entity = NULL;
+        DxfEntityType type;
+        int64_t start = 0;
+
+        type = dxf_entity_get_type (temp_string);
+        DXF_TRACE_BEGIN (DXF_TRACING_ENTITY, dxf_entity_get_name (type));
+        if (fp->stats != NULL)
+        {
+                start = dxf_stats_now ();
+        }
+        entity = dxf_entities_read_entity (fp, type);
+        if (entity == NULL)
+        {
+                /* Skip the group codes up to the next entity. */
+                DXF_STATS_ADD (fp, entities_skipped, 1);
+                while (!feof (fp->fp))
+                {
+                        dxf_read_line (temp_string, fp);
+                        if (strcmp (temp_string, "0") == 0)
+                        {
+                                break;
+                        }
+                        dxf_read_line (temp_string, fp);
+                        DXF_STATS_ADD (fp, skipped_group_codes, 1);
+                }
+                dxf_read_line (temp_string, fp);
+                DXF_TRACE_END (DXF_TRACING_ENTITY, dxf_entity_get_name (type));
+                return (EXIT_SUCCESS);
+        }
+        dxf_read_line (temp_string, fp);
+        if (type == POLYLINE)
+        {
+                dxf_entities_read_vertices (fp, (DxfPolyline *) entity, temp_string);
+        }
+        if (fp->stats != NULL)
+        {
+                fp->stats->entities_read[type]++;
+                fp->stats->entity_nanoseconds[type] += dxf_stats_now () - start;
+                fp->stats->allocations++;
+        }
+        if ((fp->entity_callback == NULL)
+          || !fp->entity_callback (type, entity, fp->entity_callback_data))
+        {
+                dxf_entities_append (entities, last, type, entity);
+        }
+        DXF_TRACE_END (DXF_TRACING_ENTITY, dxf_entity_get_name (type));
+        return (EXIT_SUCCESS);
+}
+
+
 /*!
  * \brief Read and parse the \c ENTITIES table from a DXF file.
+ *
+ * The \c ENTITIES marker has been read, the entities up to and
+ * including the \c ENDSEC marker are consumed.\n
+ * Entities are appended to the lists of their type in \c entities.\n
+ * Entities of a type libDXF can not parse yet are skipped.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
  */
 int
 dxf_entities_read_table
 (
-        char *filename,
-                /*!< filename of input file (or device). */
-        FILE *fp,
-                /*!< filepointer to the input file (or device). */
-        int line_number,
-                /*!< current line number in the input file (or device). */
-        char *dxf_entities_list,
-                /*!< pointer to a list of entities. */
-        int acad_version_number
-                /*!< AutoCAD DXF version number. */
+        DxfFile *fp,
+                /*!< DXF file handle of input file (or device), holds
+                 * the file name, line number and AutoCAD version
+                 * number. */
+        DxfEntities *entities
+                /*!< pointer to the \c ENTITIES section receiving the
+                 * entities. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        /*! \todo Add code here. */
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        void *last[DXF_STATS_NUMBER_OF_ENTITY_TYPES];
+
+        /* Do some basic checks. */
+        if ((fp == NULL) || (entities == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_entities_find_last (entities, last);
+        memset (temp_string, 0, sizeof (temp_string));
+        dxf_read_line (temp_string, fp);
+        if (strcmp (temp_string + strspn (temp_string, " "), "0") != 0)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () unexpected string encountered while reading line %d from: %s.\n")),
+                  __FUNCTION__, fp->line_number, fp->filename);
+                return (EXIT_FAILURE);
+        }
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "ENDSEC") != 0) && (!feof (fp->fp)))
+        {
+                dxf_entities_read_next (fp, entities, last, temp_string);
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -454,19 +874,271 @@ dxf_entities_read_table
 int
 dxf_entities_write_table
 (
-        char *dxf_entities_list,
-                /*!< pointer to a list of entities. */
-        int acad_version_number
-                /*!< AutoCAD DXF version number. */
+        DxfFile *fp,
+                /*!< DXF file handle of output file (or device), holds
+                 * the AutoCAD version number. */
+        DxfEntities *entities
+                /*!< pointer to the \c ENTITIES section. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        /*! \todo Add code here. */
+        int result;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_section_write (fp, "ENTITIES");
+        result = EXIT_SUCCESS;
+        if (entities != NULL)
+        {
+                result = dxf_entities_write_entities (fp, entities);
+        }
+        dxf_endsec_write (fp);
 #if DEBUG
         DXF_DEBUG_END
 #endif
+        return (result);
+}
+
+
+/*!
+ * \brief Write DXF output to a file for all entities of a DXF
+ * \c ENTITIES section (or block definition).
+ *
+ * The entities are written per type, in the order of the
+ * \c DxfEntityType enumeration and of the lists, without section
+ * markers.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred for one or more entities.
+ */
+int
+dxf_entities_write_entities
+(
+        DxfFile *fp,
+                /*!< DXF file handle of output file (or device). */
+        DxfEntities *entities
+                /*!< pointer to the entities. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        void *entity = NULL;
+        int result;
+        int type;
+
+        /* Do some basic checks. */
+        if ((fp == NULL) || (entities == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        result = EXIT_SUCCESS;
+        for (type = UNKNOWN_ENTITY; type <= XLINE; type++)
+        {
+                for (entity = dxf_extents_entities_get_list (entities, (DxfEntityType) type);
+                  entity != NULL;
+                  entity = dxf_extents_entity_get_next ((DxfEntityType) type, entity))
+                {
+                        if (dxf_entities_write_entity (fp, (DxfEntityType) type,
+                          entity) != EXIT_SUCCESS)
+                        {
+                                result = EXIT_FAILURE;
+                        }
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Write DXF output to a file for a single entity of any type.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred or when no output function exists for \c type.
+ */
+int
+dxf_entities_write_entity
+(
+        DxfFile *fp,
+                /*!< DXF file handle of output file (or device). */
+        DxfEntityType type,
+                /*!< type of the entity. */
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+        /* Do some basic checks. */
+        if ((fp == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((fp->stats != NULL) && (type >= UNKNOWN_ENTITY) && (type <= XLINE))
+        {
+                fp->stats->entities_written[type]++;
+        }
+        switch (type)
+        {
+                case DFACE: return (dxf_3dface_write (fp, (Dxf3dface *) entity));
+                case DSOLID: return (dxf_3dsolid_write (fp, (Dxf3dsolid *) entity));
+                case ARC: return (dxf_arc_write (fp, (DxfArc *) entity));
+                case ATTDEF: return (dxf_attdef_write (fp, (DxfAttdef *) entity));
+                case ATTRIB: return (dxf_attrib_write (fp, (DxfAttrib *) entity));
+                case BODY: return (dxf_body_write (fp, (DxfBody *) entity));
+                case CIRCLE: return (dxf_circle_write (fp, (DxfCircle *) entity));
+                case DIMENSION: return (dxf_dimension_write (fp, (DxfDimension *) entity));
+                case ELLIPSE: return (dxf_ellipse_write (fp, (DxfEllipse *) entity));
+                case HATCH: return (dxf_hatch_write (fp, (DxfHatch *) entity));
+                case HELIX: return (dxf_helix_write (fp, (DxfHelix *) entity));
+                case IMAGE: return (dxf_image_write (fp, (DxfImage *) entity));
+                case INSERT: return (dxf_insert_write (fp, (DxfInsert *) entity));
+                case LEADER: return (dxf_leader_write (fp, (DxfLeader *) entity));
+                case LINE: return (dxf_line_write (fp, (DxfLine *) entity));
+                case LWPOLYLINE: return (dxf_lwpolyline_write (fp, (DxfLWPolyline *) entity));
+                case MTEXT: return (dxf_mtext_write (fp, (DxfMtext *) entity));
+                case POINT: return (dxf_point_write (fp, (DxfPoint *) entity));
+                case POLYLINE: return (dxf_polyline_write (fp, (DxfPolyline *) entity));
+                case REGION: return (dxf_region_write (fp, (DxfRegion *) entity));
+                case SHAPE: return (dxf_shape_write (fp, (DxfShape *) entity));
+                case SOLID: return (dxf_solid_write (fp, (DxfSolid *) entity));
+                case SPLINE: return (dxf_spline_write (fp, (DxfSpline *) entity));
+                case TEXT: return (dxf_text_write (fp, (DxfText *) entity));
+                case TOLERANCE: return (dxf_tolerance_write (fp, (DxfTolerance *) entity));
+                case TRACE: return (dxf_trace_write (fp, (DxfTrace *) entity));
+                case VIEWPORT: return (dxf_viewport_write (fp, (DxfViewport *) entity));
+                default: return (EXIT_FAILURE);
+        }
+}
+
+
+/*!
+ * \brief Get the id-code (handle) of a single entity of any type.
+ *
+ * \return the id-code, or -1 for an unsupported type.
+ */
+int
+dxf_entities_entity_get_id_code
+(
+        DxfEntityType type,
+                /*!< type of the entity. */
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+        /* Do some basic checks. */
+        if (entity == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        switch (type)
+        {
+                case DFACE: return (((Dxf3dface *) entity)->id_code);
+                case DSOLID: return (((Dxf3dsolid *) entity)->id_code);
+                case ARC: return (((DxfArc *) entity)->id_code);
+                case ATTDEF: return (((DxfAttdef *) entity)->id_code);
+                case ATTRIB: return (((DxfAttrib *) entity)->id_code);
+                case BODY: return (((DxfBody *) entity)->id_code);
+                case CIRCLE: return (((DxfCircle *) entity)->id_code);
+                case DIMENSION: return (((DxfDimension *) entity)->id_code);
+                case ELLIPSE: return (((DxfEllipse *) entity)->id_code);
+                case HATCH: return (((DxfHatch *) entity)->id_code);
+                case HELIX: return (((DxfHelix *) entity)->id_code);
+                case IMAGE: return (((DxfImage *) entity)->id_code);
+                case INSERT: return (((DxfInsert *) entity)->id_code);
+                case LEADER: return (((DxfLeader *) entity)->id_code);
+                case LINE: return (((DxfLine *) entity)->id_code);
+                case LWPOLYLINE: return (((DxfLWPolyline *) entity)->id_code);
+                case MTEXT: return (((DxfMtext *) entity)->id_code);
+                case POINT: return (((DxfPoint *) entity)->id_code);
+                case POLYLINE: return (((DxfPolyline *) entity)->id_code);
+                case REGION: return (((DxfRegion *) entity)->id_code);
+                case SHAPE: return (((DxfShape *) entity)->id_code);
+                case SOLID: return (((DxfSolid *) entity)->id_code);
+                case SPLINE: return (((DxfSpline *) entity)->id_code);
+                case TEXT: return (((DxfText *) entity)->id_code);
+                case TOLERANCE: return (((DxfTolerance *) entity)->id_code);
+                case TRACE: return (((DxfTrace *) entity)->id_code);
+                case VIEWPORT: return (((DxfViewport *) entity)->id_code);
+                default: return (-1);
+        }
+}
+
+
+/*!
+ * \brief Set the id-code (handle) of a single entity of any type.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE for an
+ * unsupported type.
+ */
+int
+dxf_entities_entity_set_id_code
+(
+        DxfEntityType type,
+                /*!< type of the entity. */
+        void *entity,
+                /*!< a pointer to the entity. */
+        int id_code
+                /*!< the id-code (handle) to be set. */
+)
+{
+        /* Do some basic checks. */
+        if (entity == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        switch (type)
+        {
+                case DFACE: ((Dxf3dface *) entity)->id_code = id_code; break;
+                case DSOLID: ((Dxf3dsolid *) entity)->id_code = id_code; break;
+                case ARC: ((DxfArc *) entity)->id_code = id_code; break;
+                case ATTDEF: ((DxfAttdef *) entity)->id_code = id_code; break;
+                case ATTRIB: ((DxfAttrib *) entity)->id_code = id_code; break;
+                case BODY: ((DxfBody *) entity)->id_code = id_code; break;
+                case CIRCLE: ((DxfCircle *) entity)->id_code = id_code; break;
+                case DIMENSION: ((DxfDimension *) entity)->id_code = id_code; break;
+                case ELLIPSE: ((DxfEllipse *) entity)->id_code = id_code; break;
+                case HATCH: ((DxfHatch *) entity)->id_code = id_code; break;
+                case HELIX: ((DxfHelix *) entity)->id_code = id_code; break;
+                case IMAGE: ((DxfImage *) entity)->id_code = id_code; break;
+                case INSERT: ((DxfInsert *) entity)->id_code = id_code; break;
+                case LEADER: ((DxfLeader *) entity)->id_code = id_code; break;
+                case LINE: ((DxfLine *) entity)->id_code = id_code; break;
+                case LWPOLYLINE: ((DxfLWPolyline *) entity)->id_code = id_code; break;
+                case MTEXT: ((DxfMtext *) entity)->id_code = id_code; break;
+                case POINT: ((DxfPoint *) entity)->id_code = id_code; break;
+                case POLYLINE: ((DxfPolyline *) entity)->id_code = id_code; break;
+                case REGION: ((DxfRegion *) entity)->id_code = id_code; break;
+                case SHAPE: ((DxfShape *) entity)->id_code = id_code; break;
+                case SOLID: ((DxfSolid *) entity)->id_code = id_code; break;
+                case SPLINE: ((DxfSpline *) entity)->id_code = id_code; break;
+                case TEXT: ((DxfText *) entity)->id_code = id_code; break;
+                case TOLERANCE: ((DxfTolerance *) entity)->id_code = id_code; break;
+                case TRACE: ((DxfTrace *) entity)->id_code = id_code; break;
+                case VIEWPORT: ((DxfViewport *) entity)->id_code = id_code; break;
+                default: return (EXIT_FAILURE);
+        }
         return (EXIT_SUCCESS);
 }
 
@@ -491,56 +1163,160 @@ dxf_entities_free
 #endif
         if (entities == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        dxf_3dface_free_list ((Dxf3dface *) entities->dface_list);
-        dxf_3dsolid_free_list ((Dxf3dsolid *) entities->dsolid_list);
-        dxf_acad_proxy_entity_free_list ((DxfAcadProxyEntity *) entities->acad_proxy_entity_list);
-        dxf_arc_free_list ((DxfArc *) entities->arc_list);
-        dxf_attdef_free_list ((DxfAttdef *) entities->attdef_list);
-        dxf_attrib_free_list ((DxfAttrib *) entities->attrib_list);
-        dxf_body_free_list ((DxfBody *) entities->body_list);
-        dxf_circle_free_list ((DxfCircle *) entities->circle_list);
-        dxf_dimension_free_list ((DxfDimension *) entities->dimension_list);
-        dxf_ellipse_free_list ((DxfEllipse *) entities->ellipse_list);
-        dxf_hatch_free_list ((DxfHatch *) entities->hatch_list);
-        //dxf_helix_free_list ((DxfHelix *) entities->helix_list);
-        dxf_image_free_list ((DxfImage *) entities->image_list);
-        dxf_insert_free_list ((DxfInsert *) entities->insert_list);
-        dxf_leader_free_list ((DxfLeader *) entities->leader_list);
-        dxf_light_free_list ((DxfLight *) entities->light_list);
-        dxf_line_free_list ((DxfLine *) entities->line_list);
-        dxf_lwpolyline_free_list ((DxfLWPolyline *) entities->lw_polyline_list);
-        //dxf_light_free_list ((DxfLight *) entities->light_list);
-        dxf_mline_free_list ((DxfMline *) entities->mline_list);
+        if (entities->dface_list != NULL)
+        {
+                dxf_3dface_free_list ((Dxf3dface *) entities->dface_list);
+        }
+        if (entities->dsolid_list != NULL)
+        {
+                dxf_3dsolid_free_list ((Dxf3dsolid *) entities->dsolid_list);
+        }
+        if (entities->acad_proxy_entity_list != NULL)
+        {
+                dxf_acad_proxy_entity_free_list ((DxfAcadProxyEntity *) entities->acad_proxy_entity_list);
+        }
+        if (entities->arc_list != NULL)
+        {
+                dxf_arc_free_list ((DxfArc *) entities->arc_list);
+        }
+        if (entities->attdef_list != NULL)
+        {
+                dxf_attdef_free_list ((DxfAttdef *) entities->attdef_list);
+        }
+        if (entities->attrib_list != NULL)
+        {
+                dxf_attrib_free_list ((DxfAttrib *) entities->attrib_list);
+        }
+        if (entities->body_list != NULL)
+        {
+                dxf_body_free_list ((DxfBody *) entities->body_list);
+        }
+        if (entities->circle_list != NULL)
+        {
+                dxf_circle_free_list ((DxfCircle *) entities->circle_list);
+        }
+        if (entities->dimension_list != NULL)
+        {
+                dxf_dimension_free_list ((DxfDimension *) entities->dimension_list);
+        }
+        if (entities->ellipse_list != NULL)
+        {
+                dxf_ellipse_free_list ((DxfEllipse *) entities->ellipse_list);
+        }
+        if (entities->hatch_list != NULL)
+        {
+                dxf_hatch_free_list ((DxfHatch *) entities->hatch_list);
+        }
+        if (entities->helix_list != NULL)
+        {
+                dxf_helix_free_list ((DxfHelix *) entities->helix_list);
+        }
+        if (entities->image_list != NULL)
+        {
+                dxf_image_free_list ((DxfImage *) entities->image_list);
+        }
+        if (entities->insert_list != NULL)
+        {
+                dxf_insert_free_list ((DxfInsert *) entities->insert_list);
+        }
+        if (entities->leader_list != NULL)
+        {
+                dxf_leader_free_list ((DxfLeader *) entities->leader_list);
+        }
+        if (entities->light_list != NULL)
+        {
+                dxf_light_free_list ((DxfLight *) entities->light_list);
+        }
+        if (entities->line_list != NULL)
+        {
+                dxf_line_free_list ((DxfLine *) entities->line_list);
+        }
+        if (entities->lw_polyline_list != NULL)
+        {
+                dxf_lwpolyline_free_list ((DxfLWPolyline *) entities->lw_polyline_list);
+        }
+        if (entities->mline_list != NULL)
+        {
+                dxf_mline_free_list ((DxfMline *) entities->mline_list);
+        }
         //dxf_mleader_free_list ((DxfMLeader *) entities->mleader_list);
         //dxf_mleaderstyle_free_list ((DxfMLeaderStyle *) entities->mleaderstyle_list);
-        dxf_mtext_free_list ((DxfMtext *) entities->mtext_list);
-        dxf_oleframe_free_list ((DxfOleFrame *) entities->oleframe_list);
-        dxf_ole2frame_free_list ((DxfOle2Frame *) entities->ole2frame_list);
-        dxf_point_free_list ((DxfPoint *) entities->point_list);
-        dxf_polyline_free_list ((DxfPolyline *) entities->polyline_list);
-        dxf_ray_free_list ((DxfRay *) entities->ray_list);
-        dxf_region_free_list ((DxfRegion *) entities->region_list);
+        if (entities->mtext_list != NULL)
+        {
+                dxf_mtext_free_list ((DxfMtext *) entities->mtext_list);
+        }
+        if (entities->oleframe_list != NULL)
+        {
+                dxf_oleframe_free_list ((DxfOleFrame *) entities->oleframe_list);
+        }
+        if (entities->ole2frame_list != NULL)
+        {
+                dxf_ole2frame_free_list ((DxfOle2Frame *) entities->ole2frame_list);
+        }
+        if (entities->point_list != NULL)
+        {
+                dxf_point_free_list ((DxfPoint *) entities->point_list);
+        }
+        if (entities->polyline_list != NULL)
+        {
+                dxf_polyline_free_list ((DxfPolyline *) entities->polyline_list);
+        }
+        if (entities->ray_list != NULL)
+        {
+                dxf_ray_free_list ((DxfRay *) entities->ray_list);
+        }
+        if (entities->region_list != NULL)
+        {
+                dxf_region_free_list ((DxfRegion *) entities->region_list);
+        }
         //dxf_section_free_list ((DxfSection *) entities->section_list);
-        dxf_shape_free_list ((DxfShape *) entities->shape_list);
-        dxf_solid_free_list ((DxfSolid *) entities->solid_list);
-        //dxf_spline_free_list (DxfSpline *) entities->spline_list);
+        if (entities->shape_list != NULL)
+        {
+                dxf_shape_free_list ((DxfShape *) entities->shape_list);
+        }
+        if (entities->solid_list != NULL)
+        {
+                dxf_solid_free_list ((DxfSolid *) entities->solid_list);
+        }
+        if (entities->spline_list != NULL)
+        {
+                dxf_spline_free_list ((DxfSpline *) entities->spline_list);
+        }
         //dxf_sun_free_list (DxfSun *) entities->sun_list);
         //dxf_surface_free_list (DxfSurface *) entities->surface_list);
-        dxf_table_free_list ((DxfTable *) entities->table_list);
-        dxf_text_free_list ((DxfText *) entities->text_list);
-        dxf_tolerance_free_list ((DxfTolerance *) entities->tolerance_list);
-        dxf_trace_free_list ((DxfTrace *) entities->trace_list);
+        if (entities->table_list != NULL)
+        {
+                dxf_table_free_list ((DxfTable *) entities->table_list);
+        }
+        if (entities->text_list != NULL)
+        {
+                dxf_text_free_list ((DxfText *) entities->text_list);
+        }
+        if (entities->tolerance_list != NULL)
+        {
+                dxf_tolerance_free_list ((DxfTolerance *) entities->tolerance_list);
+        }
+        if (entities->trace_list != NULL)
+        {
+                dxf_trace_free_list ((DxfTrace *) entities->trace_list);
+        }
         //dxf_underlay_free_list (DxfUnderlay *) entities->underlay_list);
-        dxf_vertex_free_list ((DxfVertex *) entities->vertex_list);
-        dxf_viewport_free_list ((DxfViewport *) entities->viewport_list);
+        if (entities->vertex_list != NULL)
+        {
+                dxf_vertex_free_list ((DxfVertex *) entities->vertex_list);
+        }
+        if (entities->viewport_list != NULL)
+        {
+                dxf_viewport_free_list ((DxfViewport *) entities->viewport_list);
+        }
         //dxf_wipeout_free_list (DxfWipeout *) entities->wipeout_list);
         //dxf_xline_free_list (DxfXLine *) entities->xline_list);
-        free (entities);
+        dxf_free (entities);
         entities = NULL;
 #if DEBUG
         DXF_DEBUG_END
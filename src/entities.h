@@ -162,8 +162,14 @@ dxf_entities_struct
 
 DxfEntities *dxf_entities_new ();
 DxfEntities *dxf_entities_init (DxfEntities *entities);
-int dxf_entities_read_table (char *filename, FILE *fp, int line_number, char *dxf_entities_list, int acad_version_number);
-int dxf_entities_write_table (char *dxf_entities_list, int acad_version_number);
+void dxf_entities_find_last (DxfEntities *entities, void **last);
+int dxf_entities_read_next (DxfFile *fp, DxfEntities *entities, void **last, char *temp_string);
+int dxf_entities_read_table (DxfFile *fp, DxfEntities *entities);
+int dxf_entities_write_table (DxfFile *fp, DxfEntities *entities);
+int dxf_entities_write_entities (DxfFile *fp, DxfEntities *entities);
+int dxf_entities_write_entity (DxfFile *fp, DxfEntityType type, void *entity);
+int dxf_entities_entity_get_id_code (DxfEntityType type, void *entity);
+int dxf_entities_entity_set_id_code (DxfEntityType type, void *entity, int id_code);
 int dxf_entities_free (DxfEntities *entities);
 
 
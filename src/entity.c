@@ -38,6 +38,59 @@
 #include "global.h"
 
 
+/*!
+ * \brief Names of the DXF entity types, in the order of the
+ * \c DxfEntityType enumeration.
+ */
+static const char *dxf_entity_names[] =
+{
+        "UNKNOWN",
+        "3DFACE",
+        "3DSOLID",
+        "ACAD_PROXY_ENTITY",
+        "ARC",
+        "ATTDEF",
+        "ATTRIB",
+        "BODY",
+        "CIRCLE",
+        "DIMENSION",
+        "ELLIPSE",
+        "HATCH",
+        "HELIX",
+        "IMAGE",
+        "INSERT",
+        "LEADER",
+        "LIGHT",
+        "LINE",
+        "LWPOLYLINE",
+        "MESH",
+        "MLEADER",
+        "MLEADERSTYLE",
+        "MTEXT",
+        "OLEFRAME",
+        "OLE2FRAME",
+        "POINT",
+        "POLYLINE",
+        "RAY",
+        "REGION",
+        "SECTION",
+        "SHAPE",
+        "SOLID",
+        "SPLINE",
+        "SUN",
+        "SURFACE",
+        "TABLE",
+        "TEXT",
+        "TOLERANCE",
+        "TRACE",
+        "UNDERLAY",
+        "VERTEX",
+        "VIEWPORT",
+        "WIPEOUT",
+        "XLINE"
+};
+
+
 /*!
  * \brief Prints warning on stderr and asks for confirmation (if interactive)
  * on skipping output for an entity to a file (or device).
@@ -57,18 +110,18 @@ dxf_entity_skip
         {
                 char answer;
 
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("    skip %s entity ? [Y/N]:\n")), dxf_entity_name);
                 answer = getchar ();
                 if ((answer == 'Y') || (answer == 'y'))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                           (_("    OK, done.\n")));
                 }
         }
         else
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("    skipping %s entity.\n")), dxf_entity_name);
         }
 #if DEBUG
@@ -78,4 +131,54 @@ dxf_entity_skip
 }
 
 
+/*!
+ * \brief Get the name of a DXF entity type as used in a DXF file.
+ *
+ * \return the name, \c "UNKNOWN" for an unknown entity type.
+ */
+const char *
+dxf_entity_get_name
+(
+        DxfEntityType type
+                /*!< the type of the entity. */
+)
+{
+        if ((type < UNKNOWN_ENTITY) || (type > XLINE))
+        {
+                return (dxf_entity_names[UNKNOWN_ENTITY]);
+        }
+        return (dxf_entity_names[type]);
+}
+
+
+/*!
+ * \brief Get the DXF entity type of an entity name as used in a DXF
+ * file.
+ *
+ * \return the entity type, \c UNKNOWN_ENTITY for an unknown name.
+ */
+DxfEntityType
+dxf_entity_get_type
+(
+        const char *dxf_entity_name
+                /*!< the name of the entity. */
+)
+{
+        int type;
+
+        if (dxf_entity_name == NULL)
+        {
+                return (UNKNOWN_ENTITY);
+        }
+        for (type = UNKNOWN_ENTITY + 1; type <= XLINE; type++)
+        {
+                if (strcmp (dxf_entity_name, dxf_entity_names[type]) == 0)
+                {
+                        return ((DxfEntityType) type);
+                }
+        }
+        return (UNKNOWN_ENTITY);
+}
+
+
 /* EOF */
@@ -98,6 +98,8 @@ dxf_entity_type
 
 
 int dxf_entity_skip (char *dxf_entity_name);
+const char *dxf_entity_get_name (DxfEntityType type);
+DxfEntityType dxf_entity_get_type (const char *dxf_entity_name);
 
 
 #ifdef __cplusplus
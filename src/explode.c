@@ -0,0 +1,1026 @@
+/*!
+ * \file explode.c
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for libDXF block reference expansion (explode).
+ *
+ * Block references (\c INSERT entities, including multiple inserts) are
+ * expanded into polylines in world coordinates.
+ * Curves are flattened with the functions of flatten.c and
+ * \c dxf_spline_tessellate(), straight entities are copied.
+ * The supported entities are \c 3DFACE, \c ARC, \c CIRCLE, \c ELLIPSE,
+ * \c HELIX, \c INSERT, \c LINE, \c LWPOLYLINE, \c POINT, \c POLYLINE
+ * (not meshes), \c SOLID, \c SPLINE and \c TRACE, other entities are
+ * skipped.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "explode.h"
+#include "extents.h"
+#include "flatten.h"
+
+
+static DxfTessellation *dxf_explode_build_block (DxfExplode *explode, DxfExplodeBlock *entry, int depth);
+static int dxf_explode_add_entity (DxfExplode *explode, DxfEntityType type, void *entity, DxfTransform *transform, DxfTessellation *tessellation, int depth);
+static int dxf_explode_add_insert (DxfExplode *explode, DxfInsert *insert, DxfTransform *transform, DxfTessellation *tessellation, int depth);
+static int dxf_explode_add_entities (DxfExplode *explode, DxfEntities *entities, DxfTransform *transform, DxfTessellation *tessellation, int depth);
+
+
+/*!
+ * \brief Compare two cached block definitions by the address of the
+ * block definition, for \c qsort() and \c bsearch().
+ */
+static int
+dxf_explode_compare_blocks
+(
+        const void *a,
+        const void *b
+)
+{
+        const DxfExplodeBlock *block_a = (const DxfExplodeBlock *) a;
+        const DxfExplodeBlock *block_b = (const DxfExplodeBlock *) b;
+
+        if ((uintptr_t) block_a->block < (uintptr_t) block_b->block)
+        {
+                return (-1);
+        }
+        if ((uintptr_t) block_a->block > (uintptr_t) block_b->block)
+        {
+                return (1);
+        }
+        return (0);
+}
+
+
+/*!
+ * \brief Find a cached block definition by block name (case
+ * insensitive).
+ *
+ * The block definition is looked up in the name index of the drawing,
+ * its cache entry by the address of the block definition.
+ */
+static DxfExplodeBlock *
+dxf_explode_find_block
+(
+        DxfExplode *explode,
+        char *block_name
+)
+{
+        DxfExplodeBlock key;
+
+        if ((block_name == NULL) || (explode->number_of_blocks == 0))
+        {
+                return (NULL);
+        }
+        key.block = dxf_drawing_find_block (explode->drawing, block_name);
+        if (key.block == NULL)
+        {
+                return (NULL);
+        }
+        return ((DxfExplodeBlock *) bsearch (&key, explode->cache,
+          explode->number_of_blocks, sizeof (DxfExplodeBlock),
+          dxf_explode_compare_blocks));
+}
+
+
+/*!
+ * \brief Append a transformed copy of \c geometry to \c tessellation.
+ */
+static int
+dxf_explode_instance
+(
+        DxfTessellation *tessellation,
+        DxfTessellation *geometry,
+        DxfTransform *transform
+)
+{
+        size_t first;
+
+        first = tessellation->number_of_points;
+        if (dxf_tessellation_append (tessellation, geometry) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((transform != NULL) && !dxf_transform_is_identity (transform))
+        {
+                dxf_transform_apply_points (transform,
+                  tessellation->points + 3 * first,
+                  geometry->number_of_points);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Write the corners of a quadrilateral as a closed polyline.
+ *
+ * \return the number of points (0 or 5).
+ */
+static size_t
+dxf_explode_quad
+(
+        DxfPoint *p0,
+        DxfPoint *p1,
+        DxfPoint *p2,
+        DxfPoint *p3,
+        double *points
+)
+{
+        DxfPoint *corners[5];
+        int i;
+
+        corners[0] = p0;
+        corners[1] = p1;
+        corners[2] = p2;
+        corners[3] = p3;
+        corners[4] = p0;
+        for (i = 0; i < 4; i++)
+        {
+                if (corners[i] == NULL)
+                {
+                        return (0);
+                }
+        }
+        if (points != NULL)
+        {
+                for (i = 0; i < 5; i++)
+                {
+                        points[3 * i] = corners[i]->x0;
+                        points[3 * i + 1] = corners[i]->y0;
+                        points[3 * i + 2] = corners[i]->z0;
+                }
+        }
+        return (5);
+}
+
+
+/*!
+ * \brief Flatten an entity into a caller provided buffer.
+ *
+ * \c SPLINE and \c INSERT entities are handled by the caller,
+ * unsupported entities yield no points.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_explode_flatten
+(
+        DxfEntityType type,
+        void *entity,
+        double tolerance,
+        double *points,
+        size_t max_number_of_points,
+        size_t *number_of_points
+)
+{
+        DxfTransform ocs;
+        DxfLine *line = NULL;
+        DxfPoint *point = NULL;
+        DxfSolid *solid = NULL;
+        DxfTrace *trace = NULL;
+        Dxf3dface *face = NULL;
+
+        *number_of_points = 0;
+        switch (type)
+        {
+                case ARC:
+                        return (dxf_flatten_arc ((DxfArc *) entity,
+                          tolerance, points, max_number_of_points,
+                          number_of_points));
+                case CIRCLE:
+                        return (dxf_flatten_circle ((DxfCircle *) entity,
+                          tolerance, points, max_number_of_points,
+                          number_of_points));
+                case ELLIPSE:
+                        return (dxf_flatten_ellipse ((DxfEllipse *) entity,
+                          tolerance, points, max_number_of_points,
+                          number_of_points));
+                case HELIX:
+                        return (dxf_flatten_helix ((DxfHelix *) entity,
+                          tolerance, points, max_number_of_points,
+                          number_of_points));
+                case LWPOLYLINE:
+                        return (dxf_flatten_lwpolyline ((DxfLWPolyline *) entity,
+                          tolerance, points, max_number_of_points,
+                          number_of_points));
+                case POLYLINE:
+                        if (((DxfPolyline *) entity)->flag & (16 | 64))
+                        {
+                                /* Meshes are not curves. */
+                                return (EXIT_SUCCESS);
+                        }
+                        return (dxf_flatten_polyline ((DxfPolyline *) entity,
+                          tolerance, points, max_number_of_points,
+                          number_of_points));
+                case LINE:
+                        line = (DxfLine *) entity;
+                        if ((line->p0 == NULL) || (line->p1 == NULL))
+                        {
+                                return (EXIT_SUCCESS);
+                        }
+                        *number_of_points = 2;
+                        if (points != NULL)
+                        {
+                                points[0] = line->p0->x0;
+                                points[1] = line->p0->y0;
+                                points[2] = line->p0->z0;
+                                points[3] = line->p1->x0;
+                                points[4] = line->p1->y0;
+                                points[5] = line->p1->z0;
+                        }
+                        return (EXIT_SUCCESS);
+                case POINT:
+                        point = (DxfPoint *) entity;
+                        *number_of_points = 1;
+                        if (points != NULL)
+                        {
+                                points[0] = point->x0;
+                                points[1] = point->y0;
+                                points[2] = point->z0;
+                        }
+                        return (EXIT_SUCCESS);
+                case DFACE:
+                        face = (Dxf3dface *) entity;
+                        *number_of_points = dxf_explode_quad (face->p0,
+                          face->p1, face->p2, face->p3, points);
+                        return (EXIT_SUCCESS);
+                case SOLID:
+                        /* The third and fourth corner are in "Z"
+                         * order. */
+                        solid = (DxfSolid *) entity;
+                        *number_of_points = dxf_explode_quad (solid->p0,
+                          solid->p1, solid->p3, solid->p2, points);
+                        if ((points != NULL) && (*number_of_points > 0))
+                        {
+                                dxf_transform_init (&ocs);
+                                dxf_transform_ocs (&ocs, solid->extr_x0,
+                                  solid->extr_y0, solid->extr_z0);
+                                dxf_transform_apply_points (&ocs, points,
+                                  *number_of_points);
+                        }
+                        return (EXIT_SUCCESS);
+                case TRACE:
+                        trace = (DxfTrace *) entity;
+                        *number_of_points = dxf_explode_quad (trace->p0,
+                          trace->p1, trace->p3, trace->p2, points);
+                        if ((points != NULL) && (*number_of_points > 0))
+                        {
+                                dxf_transform_init (&ocs);
+                                dxf_transform_ocs (&ocs, trace->extr_x0,
+                                  trace->extr_y0, trace->extr_z0);
+                                dxf_transform_apply_points (&ocs, points,
+                                  *number_of_points);
+                        }
+                        return (EXIT_SUCCESS);
+                default:
+                        return (EXIT_SUCCESS);
+        }
+}
+
+
+/*!
+ * \brief Flatten the content of a block definition (once).
+ *
+ * \return a pointer to the cached geometry, or \c NULL when the block
+ * references itself (directly or indirectly) or when an error occurred.
+ */
+static DxfTessellation *
+dxf_explode_build_block
+(
+        DxfExplode *explode,
+        DxfExplodeBlock *entry,
+        int depth
+)
+{
+        if (entry->state == 2)
+        {
+                return (entry->geometry);
+        }
+        if ((entry->state == 1) || (depth > DXF_EXPLODE_MAX_BLOCK_DEPTH))
+        {
+                /* Recursive block reference. */
+                return (NULL);
+        }
+        entry->state = 1;
+        entry->geometry = dxf_tessellation_init (dxf_tessellation_new ());
+        if (entry->geometry == NULL)
+        {
+                entry->state = 0;
+                return (NULL);
+        }
+        if (entry->block->entities != NULL)
+        {
+                dxf_explode_add_entities (explode,
+                  (DxfEntities *) entry->block->entities, NULL,
+                  entry->geometry, depth);
+        }
+        entry->state = 2;
+        return (entry->geometry);
+}
+
+
+/*!
+ * \brief Add an entity to a tessellation.
+ */
+static int
+dxf_explode_add_entity
+(
+        DxfExplode *explode,
+        DxfEntityType type,
+        void *entity,
+        DxfTransform *transform,
+        DxfTessellation *tessellation,
+        int depth
+)
+{
+        size_t first;
+        size_t n;
+        int result;
+
+        if (type == INSERT)
+        {
+                return (dxf_explode_add_insert (explode, (DxfInsert *) entity,
+                  transform, tessellation, depth));
+        }
+        first = tessellation->number_of_points;
+        if (type == SPLINE)
+        {
+                result = dxf_spline_tessellate ((DxfSpline *) entity,
+                  explode->tolerance, tessellation);
+        }
+        else
+        {
+                result = dxf_explode_flatten (type, entity,
+                  explode->tolerance, NULL, 0, &n);
+                if ((result != EXIT_SUCCESS) || (n == 0))
+                {
+                        return (result);
+                }
+                if ((dxf_tessellation_begin_curve (tessellation) != EXIT_SUCCESS)
+                  || (dxf_tessellation_reserve (tessellation, n) != EXIT_SUCCESS))
+                {
+                        return (EXIT_FAILURE);
+                }
+                result = dxf_explode_flatten (type, entity, explode->tolerance,
+                  tessellation->points + 3 * tessellation->number_of_points,
+                  n, &n);
+                if (result == EXIT_SUCCESS)
+                {
+                        tessellation->number_of_points += n;
+                }
+        }
+        if ((transform != NULL) && !dxf_transform_is_identity (transform))
+        {
+                dxf_transform_apply_points (transform,
+                  tessellation->points + 3 * first,
+                  tessellation->number_of_points - first);
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Add a block reference to a tessellation.
+ */
+static int
+dxf_explode_add_insert
+(
+        DxfExplode *explode,
+        DxfInsert *insert,
+        DxfTransform *transform,
+        DxfTessellation *tessellation,
+        int depth
+)
+{
+        DxfExplodeBlock *entry = NULL;
+        DxfTessellation *geometry = NULL;
+        DxfTransform local;
+        DxfTransform cell;
+        int columns;
+        int rows;
+        int i;
+        int j;
+
+        if (insert->p0 == NULL)
+        {
+                return (EXIT_SUCCESS);
+        }
+        entry = dxf_explode_find_block (explode, insert->block_name);
+        if (entry == NULL)
+        {
+                return (EXIT_SUCCESS);
+        }
+        geometry = dxf_explode_build_block (explode, entry, depth + 1);
+        if ((geometry == NULL) || (geometry->number_of_points == 0))
+        {
+                return (EXIT_SUCCESS);
+        }
+        /* Parent * OCS * T(insertion point) * Rz(rotation)
+         * * T(cell offset) * S(scale) * T(-base point). */
+        dxf_transform_init (&local);
+        if (transform != NULL)
+        {
+                dxf_transform_copy (&local, transform);
+        }
+        dxf_transform_ocs (&local, insert->extr_x0, insert->extr_y0, insert->extr_z0);
+        dxf_transform_translate (&local, insert->p0->x0, insert->p0->y0, insert->p0->z0);
+        dxf_transform_rotate_z (&local, insert->rot_angle);
+        columns = (insert->columns > 1) ? insert->columns : 1;
+        rows = (insert->rows > 1) ? insert->rows : 1;
+        for (j = 0; j < rows; j++)
+        {
+                for (i = 0; i < columns; i++)
+                {
+                        dxf_transform_copy (&cell, &local);
+                        if ((i > 0) || (j > 0))
+                        {
+                                dxf_transform_translate (&cell,
+                                  i * insert->column_spacing,
+                                  j * insert->row_spacing, 0.0);
+                        }
+                        dxf_transform_scale (&cell, insert->rel_x_scale,
+                          insert->rel_y_scale, insert->rel_z_scale);
+                        if (entry->block->p0 != NULL)
+                        {
+                                dxf_transform_translate (&cell,
+                                  -entry->block->p0->x0,
+                                  -entry->block->p0->y0,
+                                  -entry->block->p0->z0);
+                        }
+                        if (dxf_explode_instance (tessellation, geometry,
+                          &cell) != EXIT_SUCCESS)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add all entities of an entities list to a tessellation.
+ */
+static int
+dxf_explode_add_entities
+(
+        DxfExplode *explode,
+        DxfEntities *entities,
+        DxfTransform *transform,
+        DxfTessellation *tessellation,
+        int depth
+)
+{
+        void *entity = NULL;
+        int result;
+        int type;
+
+        result = EXIT_SUCCESS;
+        for (type = UNKNOWN_ENTITY; type <= XLINE; type++)
+        {
+                for (entity = dxf_extents_entities_get_list (entities, (DxfEntityType) type);
+                  entity != NULL;
+                  entity = dxf_extents_entity_get_next ((DxfEntityType) type, entity))
+                {
+                        if (dxf_explode_add_entity (explode, (DxfEntityType) type,
+                          entity, transform, tessellation, depth) != EXIT_SUCCESS)
+                        {
+                                result = EXIT_FAILURE;
+                        }
+                }
+        }
+        return (result);
+}
+
+
+/* dxf_explode functions. */
+
+/*!
+ * \brief Allocate memory for a \c DxfExplode.
+ *
+ * Fill the memory contents with zeros.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfExplode *
+dxf_explode_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfExplode *explode = NULL;
+        size_t size;
+
+        size = sizeof (DxfExplode);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((explode = dxf_malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                explode = NULL;
+        }
+        else
+        {
+                memset (explode, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (explode);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a
+ * \c DxfExplode.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfExplode *
+dxf_explode_init
+(
+        DxfExplode *explode
+                /*!< a pointer to a \c DxfExplode. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (explode == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                explode = dxf_explode_new ();
+        }
+        if (explode == NULL)
+        {
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                (_("Error in %s () could not allocate memory.\n")),
+                __FUNCTION__);
+              return (NULL);
+        }
+        explode->drawing = NULL;
+        explode->tolerance = DXF_EXPLODE_DEFAULT_TOLERANCE;
+        explode->cache = NULL;
+        explode->number_of_blocks = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (explode);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfExplode and its cache.
+ *
+ * The block definitions are not freed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_explode_free
+(
+        DxfExplode *explode
+                /*!< a pointer to the memory occupied by the
+                 * \c DxfExplode. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (explode == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_explode_clear_cache (explode);
+        dxf_free (explode->cache);
+        dxf_free (explode);
+        explode = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Set the drawing with the block definitions of a \c DxfExplode.
+ *
+ * The cache is rebuilt (empty) for the block definitions of the
+ * drawing.
+ *
+ * \return a pointer to \c explode when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfExplode *
+dxf_explode_set_drawing
+(
+        DxfExplode *explode,
+                /*!< a pointer to a \c DxfExplode. */
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing, or \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBlock *blocks = NULL;
+        DxfBlock *iter = NULL;
+        size_t number_of_blocks;
+
+        /* Do some basic checks. */
+        if (explode == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        dxf_explode_clear_cache (explode);
+        dxf_free (explode->cache);
+        explode->cache = NULL;
+        explode->number_of_blocks = 0;
+        explode->drawing = drawing;
+        if (drawing != NULL)
+        {
+                blocks = (DxfBlock *) drawing->block_list;
+        }
+        number_of_blocks = 0;
+        for (iter = blocks; iter != NULL; iter = (DxfBlock *) iter->next)
+        {
+                number_of_blocks++;
+        }
+        if (number_of_blocks == 0)
+        {
+                return (explode);
+        }
+        explode->cache = dxf_malloc (number_of_blocks * sizeof (DxfExplodeBlock));
+        if (explode->cache == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        for (iter = blocks; iter != NULL; iter = (DxfBlock *) iter->next)
+        {
+                explode->cache[explode->number_of_blocks].block = iter;
+                explode->cache[explode->number_of_blocks].geometry = NULL;
+                explode->cache[explode->number_of_blocks].state = 0;
+                explode->number_of_blocks++;
+        }
+        qsort (explode->cache, explode->number_of_blocks,
+          sizeof (DxfExplodeBlock), dxf_explode_compare_blocks);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (explode);
+}
+
+
+/*!
+ * \brief Get the drawing with the block definitions of a
+ * \c DxfExplode.
+ *
+ * \return a pointer to the libDXF drawing.
+ */
+DxfDrawing *
+dxf_explode_get_drawing
+(
+        DxfExplode *explode
+                /*!< a pointer to a \c DxfExplode. */
+)
+{
+        /* Do some basic checks. */
+        if (explode == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        return (explode->drawing);
+}
+
+
+/*!
+ * \brief Set the chord tolerance of a \c DxfExplode.
+ *
+ * The cache is cleared, block definitions are flattened again with the
+ * new tolerance on their next reference.
+ *
+ * \return a pointer to \c explode when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfExplode *
+dxf_explode_set_tolerance
+(
+        DxfExplode *explode,
+                /*!< a pointer to a \c DxfExplode. */
+        double tolerance
+                /*!< chord tolerance, larger than 0.0. */
+)
+{
+        /* Do some basic checks. */
+        if (explode == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (!(tolerance > 0.0))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a tolerance of zero or less was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        dxf_explode_clear_cache (explode);
+        explode->tolerance = tolerance;
+        return (explode);
+}
+
+
+/*!
+ * \brief Get the chord tolerance of a \c DxfExplode.
+ *
+ * \return the chord tolerance.
+ */
+double
+dxf_explode_get_tolerance
+(
+        DxfExplode *explode
+                /*!< a pointer to a \c DxfExplode. */
+)
+{
+        /* Do some basic checks. */
+        if (explode == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0.0);
+        }
+        return (explode->tolerance);
+}
+
+
+/*!
+ * \brief Clear the cache of a \c DxfExplode.
+ *
+ * Call this function after changing the content of a block definition.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_explode_clear_cache
+(
+        DxfExplode *explode
+                /*!< a pointer to a \c DxfExplode. */
+)
+{
+        size_t i;
+
+        /* Do some basic checks. */
+        if (explode == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < explode->number_of_blocks; i++)
+        {
+                if (explode->cache[i].geometry != NULL)
+                {
+                        dxf_tessellation_free (explode->cache[i].geometry);
+                }
+                explode->cache[i].geometry = NULL;
+                explode->cache[i].state = 0;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the flattened content of a block definition.
+ *
+ * The content (including nested block references) is flattened on the
+ * first call and cached, the points are in block coordinates (the base
+ * point is not subtracted).
+ *
+ * \return a pointer to the cached geometry (owned by \c explode), or
+ * \c NULL when the block does not exist or references itself.
+ */
+DxfTessellation *
+dxf_explode_get_block_geometry
+(
+        DxfExplode *explode,
+                /*!< a pointer to a \c DxfExplode. */
+        char *block_name
+                /*!< name of the block (case insensitive). */
+)
+{
+        DxfExplodeBlock *entry = NULL;
+
+        /* Do some basic checks. */
+        if ((explode == NULL) || (block_name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        entry = dxf_explode_find_block (explode, block_name);
+        if (entry == NULL)
+        {
+                return (NULL);
+        }
+        return (dxf_explode_build_block (explode, entry, 0));
+}
+
+
+/*!
+ * \brief Expand an entity into polylines in world coordinates.
+ *
+ * Every curve or straight entity adds one polyline to
+ * \c tessellation, a block reference adds the polylines of its block
+ * definition for every cell.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_explode_entity
+(
+        DxfExplode *explode,
+                /*!< a pointer to a \c DxfExplode. */
+        DxfEntityType type,
+                /*!< type of the entity. */
+        void *entity,
+                /*!< a pointer to the entity. */
+        DxfTransform *transform,
+                /*!< a pointer to a transformation applied to the
+                 * result, \c NULL for the identity transformation. */
+        DxfTessellation *tessellation
+                /*!< a pointer to the \c DxfTessellation receiving the
+                 * polylines. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int result;
+
+        /* Do some basic checks. */
+        if ((explode == NULL) || (entity == NULL) || (tessellation == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        result = dxf_explode_add_entity (explode, type, entity, transform,
+          tessellation, 0);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Expand a DXF \c INSERT entity into polylines in world
+ * coordinates.
+ *
+ * The cached content of the referenced block is transformed by the
+ * insertion point, scale factors, rotation angle and extrusion of the
+ * block reference.\n
+ * For a multiple insert (MINSERT) a copy is added for every cell of the
+ * lattice of columns and rows.\n
+ * References to unknown blocks are skipped.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_explode_insert
+(
+        DxfExplode *explode,
+                /*!< a pointer to a \c DxfExplode. */
+        DxfInsert *insert,
+                /*!< a pointer to a DXF \c INSERT entity. */
+        DxfTransform *transform,
+                /*!< a pointer to a transformation applied to the
+                 * result, \c NULL for the identity transformation. */
+        DxfTessellation *tessellation
+                /*!< a pointer to the \c DxfTessellation receiving the
+                 * polylines. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int result;
+
+        /* Do some basic checks. */
+        if ((explode == NULL) || (insert == NULL) || (tessellation == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        result = dxf_explode_add_insert (explode, insert, transform,
+          tessellation, 0);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Expand all entities of a DXF \c ENTITIES section (or block
+ * definition) into polylines in world coordinates.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_explode_entities
+(
+        DxfExplode *explode,
+                /*!< a pointer to a \c DxfExplode. */
+        DxfEntities *entities,
+                /*!< a pointer to the entities. */
+        DxfTransform *transform,
+                /*!< a pointer to a transformation applied to the
+                 * result, \c NULL for the identity transformation. */
+        DxfTessellation *tessellation
+                /*!< a pointer to the \c DxfTessellation receiving the
+                 * polylines. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int result;
+
+        /* Do some basic checks. */
+        if ((explode == NULL) || (entities == NULL) || (tessellation == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        result = dxf_explode_add_entities (explode, entities, transform,
+          tessellation, 0);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/* EOF */
@@ -0,0 +1,125 @@
+/*!
+ * \file explode.h
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for libDXF block reference expansion (explode).
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_EXPLODE_H
+#define LIBDXF_SRC_EXPLODE_H
+
+
+#include "global.h"
+#include "entity.h"
+#include "entities.h"
+#include "block.h"
+#include "drawing.h"
+#include "tessellation.h"
+#include "transform.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_EXPLODE_DEFAULT_TOLERANCE 0.01
+        /*!< \brief Default chord tolerance for flattening curves, in
+         * block (drawing) units. */
+
+#define DXF_EXPLODE_MAX_BLOCK_DEPTH 16
+        /*!< \brief Maximum nesting depth of block references. */
+
+
+/*!
+ * \brief Definition of a cached block definition.
+ */
+typedef struct
+dxf_explode_block_struct
+{
+        DxfBlock *block;
+                /*!< The block definition. */
+        DxfTessellation *geometry;
+                /*!< Flattened content of the block, including nested
+                 * block references, in block coordinates.\n
+                 * \c NULL until the block is first referenced. */
+        int state;
+                /*!< 0 = not flattened, 1 = being flattened, 2 =
+                 * flattened. */
+} DxfExplodeBlock;
+
+
+/*!
+ * \brief Definition of a block reference expansion engine.
+ *
+ * The content of every block definition is flattened into polylines
+ * once, on its first reference, and kept in a cache.\n
+ * Every block reference (\c INSERT) then only copies the cached
+ * polylines and transforms them to world coordinates.
+ */
+typedef struct
+dxf_explode_struct
+{
+        DxfDrawing *drawing;
+                /*!< The drawing with the block definitions. */
+        double tolerance;
+                /*!< Chord tolerance for flattening curves, in block
+                 * coordinates. */
+        DxfExplodeBlock *cache;
+                /*!< Cached block definitions, sorted by the address
+                 * of the block definition. */
+        size_t number_of_blocks;
+                /*!< Number of cached block definitions. */
+} DxfExplode;
+
+
+DxfExplode *dxf_explode_new ();
+DxfExplode *dxf_explode_init (DxfExplode *explode);
+int dxf_explode_free (DxfExplode *explode);
+DxfExplode *dxf_explode_set_drawing (DxfExplode *explode, DxfDrawing *drawing);
+DxfDrawing *dxf_explode_get_drawing (DxfExplode *explode);
+DxfExplode *dxf_explode_set_tolerance (DxfExplode *explode, double tolerance);
+double dxf_explode_get_tolerance (DxfExplode *explode);
+int dxf_explode_clear_cache (DxfExplode *explode);
+DxfTessellation *dxf_explode_get_block_geometry (DxfExplode *explode, char *block_name);
+int dxf_explode_entity (DxfExplode *explode, DxfEntityType type, void *entity, DxfTransform *transform, DxfTessellation *tessellation);
+int dxf_explode_insert (DxfExplode *explode, DxfInsert *insert, DxfTransform *transform, DxfTessellation *tessellation);
+int dxf_explode_entities (DxfExplode *explode, DxfEntities *entities, DxfTransform *transform, DxfTessellation *tessellation);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_EXPLODE_H */
+
+
+/* EOF */
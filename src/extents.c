@@ -0,0 +1,3207 @@
+/*!
+ * \file extents.c
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for libDXF extents (axis aligned bounding box) calculations.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "extents.h"
+
+
+static void dxf_extents_normalize (double v[3]);
+static int dxf_extents_add_conic (DxfExtents *extents, DxfTransform *transform, double c[3], double u[3], double v[3], double start_angle, double end_angle);
+static int dxf_extents_add_bulge (DxfExtents *extents, DxfTransform *transform, double xs, double ys, double xe, double ye, double z, double bulge);
+static int dxf_extents_add_vertices (DxfExtents *extents, DxfTransform *transform, DxfVertex *vertices, int closed, double z);
+static int dxf_extents_add_nurbs (DxfExtents *extents, DxfTransform *transform, int degree, int number_of_control_points, double *cpw, int number_of_knots, double *knots, int spline_mode);
+static int dxf_extents_add_quad (DxfExtents *extents, DxfTransform *transform, DxfPoint *p0, DxfPoint *p1, DxfPoint *p2, DxfPoint *p3, double thickness, double extr_x0, double extr_y0, double extr_z0);
+static int dxf_extents_add_text_box (DxfExtents *extents, DxfTransform *transform, char *text_value, char *text_style, DxfTables *tables, DxfPoint *p0, DxfPoint *p1, double height, double rel_x_scale, double rot_angle, double obl_angle, int text_flags, int hor_align, int vert_align, double extr_x0, double extr_y0, double extr_z0);
+static DxfBlock *dxf_extents_find_block (DxfDrawing *drawing, char *block_name);
+static int dxf_extents_add_block (DxfExtents *extents, DxfBlock *block, DxfDrawing *drawing, DxfTables *tables, int spline_mode, DxfTransform *transform, int depth);
+static int dxf_extents_add_insert_internal (DxfExtents *extents, DxfInsert *insert, DxfDrawing *drawing, DxfTables *tables, int spline_mode, DxfTransform *transform, int depth);
+static int dxf_extents_add_dimension_internal (DxfExtents *extents, DxfDimension *dimension, DxfDrawing *drawing, DxfTables *tables, int spline_mode, DxfTransform *transform, int depth);
+static int dxf_extents_add_entity_internal (DxfExtents *extents, DxfEntityType type, void *entity, DxfDrawing *drawing, DxfTables *tables, int spline_mode, DxfTransform *transform, int depth);
+static int dxf_extents_add_entities_internal (DxfExtents *extents, DxfEntities *entities, DxfDrawing *drawing, DxfTables *tables, int spline_mode, DxfTransform *transform, int depth);
+
+
+/*!
+ * \brief Allocate memory for a \c DxfExtents.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfExtents *
+dxf_extents_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfExtents *extents = NULL;
+        size_t size;
+
+        size = sizeof (DxfExtents);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((extents = dxf_malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                extents = NULL;
+        }
+        else
+        {
+                memset (extents, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (extents);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize an empty \c DxfExtents.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfExtents *
+dxf_extents_init
+(
+        DxfExtents *extents
+                /*!< a pointer to a \c DxfExtents. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (extents == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                extents = dxf_extents_new ();
+        }
+        if (extents == NULL)
+        {
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                (_("Error in %s () could not allocate memory.\n")),
+                __FUNCTION__);
+              return (NULL);
+        }
+        extents->x0 = 0.0;
+        extents->y0 = 0.0;
+        extents->z0 = 0.0;
+        extents->x1 = 0.0;
+        extents->y1 = 0.0;
+        extents->z1 = 0.0;
+        extents->empty = TRUE;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (extents);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfExtents.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_free
+(
+        DxfExtents *extents
+                /*!< a pointer to the memory occupied by the
+                 * \c DxfExtents. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (extents == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_free (extents);
+        extents = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Test if a \c DxfExtents is empty (contains no points).
+ *
+ * \return \c TRUE when empty (or \c NULL), \c FALSE otherwise.
+ */
+int
+dxf_extents_is_empty
+(
+        DxfExtents *extents
+                /*!< a pointer to a \c DxfExtents. */
+)
+{
+        if (extents == NULL)
+        {
+                return (TRUE);
+        }
+        return (extents->empty);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a (transformed) point.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_add_point
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfTransform *transform,
+                /*!< a pointer to the transformation to apply to the
+                 * point, \c NULL for the identity transformation. */
+        double x,
+                /*!< X-coordinate of the point. */
+        double y,
+                /*!< Y-coordinate of the point. */
+        double z
+                /*!< Z-coordinate of the point. */
+)
+{
+        /* Do some basic checks. */
+        if (extents == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (transform != NULL)
+        {
+                dxf_transform_apply_point (transform, &x, &y, &z);
+        }
+        if (extents->empty)
+        {
+                extents->x0 = extents->x1 = x;
+                extents->y0 = extents->y1 = y;
+                extents->z0 = extents->z1 = z;
+                extents->empty = FALSE;
+                return (EXIT_SUCCESS);
+        }
+        if (x < extents->x0) extents->x0 = x;
+        if (x > extents->x1) extents->x1 = x;
+        if (y < extents->y0) extents->y0 = y;
+        if (y > extents->y1) extents->y1 = y;
+        if (z < extents->z0) extents->z0 = z;
+        if (z > extents->z1) extents->z1 = z;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with another \c DxfExtents.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_merge
+(
+        DxfExtents *extents,
+                /*!< a pointer to the \c DxfExtents to extend. */
+        DxfExtents *other
+                /*!< a pointer to the \c DxfExtents to merge. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((extents == NULL) || (other == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (!other->empty)
+        {
+                dxf_extents_add_point (extents, NULL, other->x0, other->y0, other->z0);
+                dxf_extents_add_point (extents, NULL, other->x1, other->y1, other->z1);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Normalize a vector, a zero length vector is left untouched.
+ */
+static void
+dxf_extents_normalize
+(
+        double v[3]
+                /*!< the vector. */
+)
+{
+        double length;
+
+        length = sqrt (v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+        if (length > 0.0)
+        {
+                v[0] /= length;
+                v[1] /= length;
+                v[2] /= length;
+        }
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with the exact bounds of an elliptical
+ * arc \f$ P(t) = c + u \cos t + v \sin t \f$ for \f$ t \f$ running
+ * counter clockwise from \c start_angle to \c end_angle.
+ *
+ * The center and the axes are transformed first, the arc remains an
+ * elliptical arc under an affine transformation.\n
+ * Per coordinate the extremes are found at the angles where the
+ * derivative vanishes: \f$ t = atan2 (v_i, u_i) \f$ and
+ * \f$ t + \pi \f$, these are added when they lie within the angle
+ * range, together with both end points.\n
+ * Equal start and end angles denote a full ellipse.
+ */
+static int
+dxf_extents_add_conic
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfTransform *transform,
+                /*!< a pointer to a transformation, or \c NULL. */
+        double c[3],
+                /*!< the center. */
+        double u[3],
+                /*!< the vector to the point at \f$ t = 0 \f$. */
+        double v[3],
+                /*!< the vector to the point at \f$ t = \pi / 2 \f$. */
+        double start_angle,
+                /*!< start angle in radians. */
+        double end_angle
+                /*!< end angle in radians. */
+)
+{
+        double wc[3];
+        double wu[3];
+        double wv[3];
+        double span;
+        double angle;
+        double offset;
+        int full;
+        int i;
+        int j;
+
+        memcpy (wc, c, sizeof (wc));
+        memcpy (wu, u, sizeof (wu));
+        memcpy (wv, v, sizeof (wv));
+        if (transform != NULL)
+        {
+                dxf_transform_apply_point (transform, &wc[0], &wc[1], &wc[2]);
+                dxf_transform_apply_vector (transform, &wu[0], &wu[1], &wu[2]);
+                dxf_transform_apply_vector (transform, &wv[0], &wv[1], &wv[2]);
+        }
+        span = fmod (end_angle - start_angle, 2.0 * M_PI);
+        if (span < 0.0)
+        {
+                span += 2.0 * M_PI;
+        }
+        full = (span == 0.0);
+        if (!full)
+        {
+                for (j = 0; j < 2; j++)
+                {
+                        angle = (j == 0) ? start_angle : end_angle;
+                        dxf_extents_add_point (extents, NULL,
+                          wc[0] + wu[0] * cos (angle) + wv[0] * sin (angle),
+                          wc[1] + wu[1] * cos (angle) + wv[1] * sin (angle),
+                          wc[2] + wu[2] * cos (angle) + wv[2] * sin (angle));
+                }
+        }
+        for (i = 0; i < 3; i++)
+        {
+                if ((wu[i] == 0.0) && (wv[i] == 0.0))
+                {
+                        /* This coordinate is constant along the arc. */
+                        if (full)
+                        {
+                                dxf_extents_add_point (extents, NULL,
+                                  wc[0] + wu[0], wc[1] + wu[1], wc[2] + wu[2]);
+                        }
+                        continue;
+                }
+                angle = atan2 (wv[i], wu[i]);
+                for (j = 0; j < 2; j++, angle += M_PI)
+                {
+                        if (!full)
+                        {
+                                offset = fmod (angle - start_angle, 2.0 * M_PI);
+                                if (offset < 0.0)
+                                {
+                                        offset += 2.0 * M_PI;
+                                }
+                                if (offset > span)
+                                {
+                                        continue;
+                                }
+                        }
+                        dxf_extents_add_point (extents, NULL,
+                          wc[0] + wu[0] * cos (angle) + wv[0] * sin (angle),
+                          wc[1] + wu[1] * cos (angle) + wv[1] * sin (angle),
+                          wc[2] + wu[2] * cos (angle) + wv[2] * sin (angle));
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a (bulged) polyline segment.
+ *
+ * The bulge is the tangent of 1/4 of the included angle of the arc
+ * segment, negative if the arc goes clockwise from the start point to
+ * the end point, a bulge of 0.0 denotes a straight segment.
+ */
+static int
+dxf_extents_add_bulge
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfTransform *transform,
+                /*!< a pointer to a transformation, or \c NULL. */
+        double xs,
+                /*!< X-coordinate of the start point. */
+        double ys,
+                /*!< Y-coordinate of the start point. */
+        double xe,
+                /*!< X-coordinate of the end point. */
+        double ye,
+                /*!< Y-coordinate of the end point. */
+        double z,
+                /*!< Z-coordinate (elevation) of the segment. */
+        double bulge
+                /*!< bulge of the segment. */
+)
+{
+        double c[3];
+        double u[3];
+        double v[3];
+        double dx;
+        double dy;
+        double d;
+        double h;
+        double r;
+        double theta;
+        double start;
+
+        dx = xe - xs;
+        dy = ye - ys;
+        d = sqrt (dx * dx + dy * dy);
+        if ((bulge == 0.0) || (d == 0.0))
+        {
+                dxf_extents_add_point (extents, transform, xs, ys, z);
+                dxf_extents_add_point (extents, transform, xe, ye, z);
+                return (EXIT_SUCCESS);
+        }
+        theta = 4.0 * atan (bulge);
+        /* Signed distance from the chord mid point to the center, along
+         * the left hand normal of the chord. */
+        h = d * (1.0 - bulge * bulge) / (4.0 * bulge);
+        r = d * (1.0 + bulge * bulge) / (4.0 * fabs (bulge));
+        c[0] = (xs + xe) / 2.0 - dy / d * h;
+        c[1] = (ys + ye) / 2.0 + dx / d * h;
+        c[2] = z;
+        if (bulge > 0.0)
+        {
+                start = atan2 (ys - c[1], xs - c[0]);
+        }
+        else
+        {
+                start = atan2 (ye - c[1], xe - c[0]);
+                theta = -theta;
+        }
+        u[0] = r;
+        u[1] = 0.0;
+        u[2] = 0.0;
+        v[0] = 0.0;
+        v[1] = r;
+        v[2] = 0.0;
+        dxf_extents_add_conic (extents, transform, c, u, v, start, start + theta);
+        /* Add the end points explicitly, a full turn is impossible for
+         * a bulge but rounding may suggest one. */
+        dxf_extents_add_point (extents, transform, xs, ys, z);
+        dxf_extents_add_point (extents, transform, xe, ye, z);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a (rational) B-spline curve.
+ *
+ * A B-spline curve with positive weights lies within the convex hull
+ * of its control points, so the box of the control points always
+ * bounds the curve (\c DXF_EXTENTS_SPLINE_CONTROL_HULL).\n
+ * With \c DXF_EXTENTS_SPLINE_TIGHT the control polygon is refined by
+ * inserting knots halfway all non-zero knot spans (Boehm's algorithm,
+ * in homogeneous coordinates), the refined control polygon converges
+ * to the curve while still bounding it.\n
+ * When the knot vector or the weights are inconsistent the control
+ * hull is used.
+ */
+static int
+dxf_extents_add_nurbs
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfTransform *transform,
+                /*!< a pointer to a transformation, or \c NULL. */
+        int degree,
+                /*!< degree of the curve. */
+        int number_of_control_points,
+                /*!< number of control points. */
+        double *cpw,
+                /*!< control points, 4 values (X, Y, Z and weight) for
+                 * each control point. */
+        int number_of_knots,
+                /*!< number of knots. */
+        double *knots,
+                /*!< the knot vector. */
+        int spline_mode
+                /*!< \c DXF_EXTENTS_SPLINE_CONTROL_HULL or
+                 * \c DXF_EXTENTS_SPLINE_TIGHT. */
+)
+{
+        double *pw = NULL;
+        double *u = NULL;
+        double *mid = NULL;
+        double alpha;
+        int capacity;
+        int n;
+        int p;
+        int m;
+        int i;
+        int j;
+        int k;
+        int pass;
+        int valid;
+
+        n = number_of_control_points;
+        p = degree;
+        valid = ((spline_mode == DXF_EXTENTS_SPLINE_TIGHT)
+          && (p >= 1)
+          && (n > p)
+          && (knots != NULL)
+          && (number_of_knots == n + p + 1));
+        for (i = 0; valid && (i < n); i++)
+        {
+                if (cpw[4 * i + 3] <= 0.0)
+                {
+                        valid = FALSE;
+                }
+        }
+        for (i = 1; valid && (i < number_of_knots); i++)
+        {
+                if (knots[i] < knots[i - 1])
+                {
+                        valid = FALSE;
+                }
+        }
+        if (valid && !(knots[p] < knots[n]))
+        {
+                valid = FALSE;
+        }
+        if (valid)
+        {
+                capacity = n;
+                for (pass = 0; pass < DXF_EXTENTS_SPLINE_REFINEMENT_PASSES; pass++)
+                {
+                        capacity *= 2;
+                }
+                pw = dxf_malloc (4 * capacity * sizeof (double));
+                u = dxf_malloc ((capacity + p + 1) * sizeof (double));
+                mid = dxf_malloc (capacity * sizeof (double));
+                if ((pw == NULL) || (u == NULL) || (mid == NULL))
+                {
+                        valid = FALSE;
+                }
+        }
+        if (!valid)
+        {
+                dxf_free (pw);
+                dxf_free (u);
+                dxf_free (mid);
+                for (i = 0; i < n; i++)
+                {
+                        dxf_extents_add_point (extents, transform,
+                          cpw[4 * i], cpw[4 * i + 1], cpw[4 * i + 2]);
+                }
+                return (EXIT_SUCCESS);
+        }
+        /* Convert to homogeneous coordinates. */
+        for (i = 0; i < n; i++)
+        {
+                pw[4 * i] = cpw[4 * i] * cpw[4 * i + 3];
+                pw[4 * i + 1] = cpw[4 * i + 1] * cpw[4 * i + 3];
+                pw[4 * i + 2] = cpw[4 * i + 2] * cpw[4 * i + 3];
+                pw[4 * i + 3] = cpw[4 * i + 3];
+        }
+        memcpy (u, knots, number_of_knots * sizeof (double));
+        for (pass = 0; pass < DXF_EXTENTS_SPLINE_REFINEMENT_PASSES; pass++)
+        {
+                m = 0;
+                for (i = p; i < n; i++)
+                {
+                        if (u[i + 1] > u[i])
+                        {
+                                mid[m++] = (u[i] + u[i + 1]) / 2.0;
+                        }
+                }
+                if (n + m > capacity)
+                {
+                        break;
+                }
+                for (j = 0; j < m; j++)
+                {
+                        /* Find the knot span containing the new knot. */
+                        for (k = n - 1; (k > p) && (u[k] > mid[j]); k--);
+                        /* Shift the unaffected control points. */
+                        for (i = n; i > k; i--)
+                        {
+                                memcpy (&pw[4 * i], &pw[4 * (i - 1)], 4 * sizeof (double));
+                        }
+                        /* Blend the affected control points, descending so
+                         * P[i - 1] is still the original point. */
+                        for (i = k; i > k - p; i--)
+                        {
+                                alpha = (mid[j] - u[i]) / (u[i + p] - u[i]);
+                                pw[4 * i] = alpha * pw[4 * i] + (1.0 - alpha) * pw[4 * (i - 1)];
+                                pw[4 * i + 1] = alpha * pw[4 * i + 1] + (1.0 - alpha) * pw[4 * (i - 1) + 1];
+                                pw[4 * i + 2] = alpha * pw[4 * i + 2] + (1.0 - alpha) * pw[4 * (i - 1) + 2];
+                                pw[4 * i + 3] = alpha * pw[4 * i + 3] + (1.0 - alpha) * pw[4 * (i - 1) + 3];
+                        }
+                        /* Insert the new knot. */
+                        for (i = n + p; i > k; i--)
+                        {
+                                u[i + 1] = u[i];
+                        }
+                        u[k + 1] = mid[j];
+                        n++;
+                }
+        }
+        for (i = 0; i < n; i++)
+        {
+                dxf_extents_add_point (extents, transform,
+                  pw[4 * i] / pw[4 * i + 3],
+                  pw[4 * i + 1] / pw[4 * i + 3],
+                  pw[4 * i + 2] / pw[4 * i + 3]);
+        }
+        dxf_free (pw);
+        dxf_free (u);
+        dxf_free (mid);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with up to four corner points in the
+ * Object Coordinate System (OCS), optionally extruded by a thickness.
+ */
+static int
+dxf_extents_add_quad
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfTransform *transform,
+                /*!< a pointer to a transformation, or \c NULL. */
+        DxfPoint *p0,
+                /*!< first corner, or \c NULL. */
+        DxfPoint *p1,
+                /*!< second corner, or \c NULL. */
+        DxfPoint *p2,
+                /*!< third corner, or \c NULL. */
+        DxfPoint *p3,
+                /*!< fourth corner, or \c NULL. */
+        double thickness,
+                /*!< thickness along the extrusion direction. */
+        double extr_x0,
+                /*!< X-value of the extrusion vector. */
+        double extr_y0,
+                /*!< Y-value of the extrusion vector. */
+        double extr_z0
+                /*!< Z-value of the extrusion vector. */
+)
+{
+        DxfTransform ocs;
+        DxfPoint *corners[4];
+        int i;
+
+        corners[0] = p0;
+        corners[1] = p1;
+        corners[2] = p2;
+        corners[3] = p3;
+        dxf_transform_init (&ocs);
+        if (transform != NULL)
+        {
+                dxf_transform_copy (&ocs, transform);
+        }
+        dxf_transform_ocs (&ocs, extr_x0, extr_y0, extr_z0);
+        for (i = 0; i < 4; i++)
+        {
+                if (corners[i] == NULL)
+                {
+                        continue;
+                }
+                dxf_extents_add_point (extents, &ocs,
+                  corners[i]->x0, corners[i]->y0, corners[i]->z0);
+                if (thickness != 0.0)
+                {
+                        dxf_extents_add_point (extents, &ocs,
+                          corners[i]->x0, corners[i]->y0,
+                          corners[i]->z0 + thickness);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Find a block definition by name (case insensitive) in the
+ * name index of the block definitions of a drawing.
+ */
+static DxfBlock *
+dxf_extents_find_block
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing, or \c NULL. */
+        char *block_name
+                /*!< name of the block. */
+)
+{
+        if ((drawing == NULL) || (block_name == NULL))
+        {
+                return (NULL);
+        }
+        return (dxf_drawing_find_block (drawing, block_name));
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with the estimated box of a single
+ * line of text.
+ *
+ * No font metrics are available, every character is estimated to be
+ * \c DXF_EXTENTS_TEXT_CHARACTER_WIDTH times the text height wide
+ * (scaled by the width factor) with a descent of
+ * \c DXF_EXTENTS_TEXT_DESCENT times the text height.\n
+ * Missing height, width factor and oblique angle are taken from the
+ * text style.
+ */
+static int
+dxf_extents_add_text_box
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfTransform *transform,
+                /*!< a pointer to a transformation, or \c NULL. */
+        char *text_value,
+                /*!< the text string. */
+        char *text_style,
+                /*!< the name of the text style. */
+        DxfTables *tables,
+                /*!< a pointer to the symbol tables holding the text
+                 * tables, or \c NULL. */
+        DxfPoint *p0,
+                /*!< first alignment point (insertion point). */
+        DxfPoint *p1,
+                /*!< second alignment point, or \c NULL. */
+        double height,
+                /*!< text height. */
+        double rel_x_scale,
+                /*!< relative X scale factor (width factor). */
+        double rot_angle,
+                /*!< rotation angle in degrees. */
+        double obl_angle,
+                /*!< oblique angle in degrees. */
+        int text_flags,
+                /*!< text generation flags (2 = backward,
+                 * 4 = upside down). */
+        int hor_align,
+                /*!< horizontal text justification type. */
+        int vert_align,
+                /*!< vertical text justification type. */
+        double extr_x0,
+                /*!< X-value of the extrusion vector. */
+        double extr_y0,
+                /*!< Y-value of the extrusion vector. */
+        double extr_z0
+                /*!< Z-value of the extrusion vector. */
+)
+{
+        DxfStyle *style = NULL;
+        DxfTransform local;
+        DxfPoint *anchor = NULL;
+        double width;
+        double descent;
+        double bx[2];
+        double by[2];
+        double x;
+        double y;
+        size_t length;
+        size_t i;
+        int j;
+
+        if (p0 == NULL)
+        {
+                return (EXIT_SUCCESS);
+        }
+        if ((text_style == NULL) || (strcmp (text_style, "") == 0))
+        {
+                text_style = "STANDARD";
+        }
+        if (tables != NULL)
+        {
+                style = dxf_tables_find_style (tables, text_style);
+        }
+        if ((height <= 0.0) && (style != NULL))
+        {
+                height = style->height;
+                if (height <= 0.0)
+                {
+                        height = style->last_height;
+                }
+        }
+        if ((rel_x_scale <= 0.0) && (style != NULL))
+        {
+                rel_x_scale = style->width;
+        }
+        if (rel_x_scale <= 0.0)
+        {
+                rel_x_scale = 1.0;
+        }
+        if ((obl_angle == 0.0) && (style != NULL))
+        {
+                obl_angle = style->oblique_angle;
+        }
+        /* Count characters, not UTF-8 continuation bytes. */
+        length = 0;
+        if (text_value != NULL)
+        {
+                for (i = 0; text_value[i] != '\0'; i++)
+                {
+                        if ((text_value[i] & 0xC0) != 0x80)
+                        {
+                                length++;
+                        }
+                }
+        }
+        width = length * height * rel_x_scale * DXF_EXTENTS_TEXT_CHARACTER_WIDTH;
+        descent = height * DXF_EXTENTS_TEXT_DESCENT;
+        anchor = p0;
+        if (((hor_align == 3) || (hor_align == 5)) && (p1 != NULL))
+        {
+                /* Aligned or fit: the text runs from p0 to p1. */
+                width = sqrt ((p1->x0 - p0->x0) * (p1->x0 - p0->x0)
+                  + (p1->y0 - p0->y0) * (p1->y0 - p0->y0));
+                rot_angle = atan2 (p1->y0 - p0->y0, p1->x0 - p0->x0) * 180.0 / M_PI;
+        }
+        else if (((hor_align != 0) || (vert_align != 0)) && (p1 != NULL))
+        {
+                anchor = p1;
+        }
+        switch (hor_align)
+        {
+                case 1: /* center */
+                case 4: /* middle */
+                        bx[0] = -width / 2.0;
+                        bx[1] = width / 2.0;
+                        break;
+                case 2: /* right */
+                        bx[0] = -width;
+                        bx[1] = 0.0;
+                        break;
+                default: /* left, aligned and fit */
+                        bx[0] = 0.0;
+                        bx[1] = width;
+                        break;
+        }
+        if (hor_align == 4)
+        {
+                vert_align = 2;
+        }
+        switch (vert_align)
+        {
+                case 1: /* bottom */
+                        by[0] = 0.0;
+                        by[1] = height + descent;
+                        break;
+                case 2: /* middle */
+                        by[0] = -height / 2.0 - descent;
+                        by[1] = height / 2.0;
+                        break;
+                case 3: /* top */
+                        by[0] = -height - descent;
+                        by[1] = 0.0;
+                        break;
+                default: /* baseline */
+                        by[0] = -descent;
+                        by[1] = height;
+                        break;
+        }
+        dxf_transform_init (&local);
+        if (transform != NULL)
+        {
+                dxf_transform_copy (&local, transform);
+        }
+        dxf_transform_ocs (&local, extr_x0, extr_y0, extr_z0);
+        dxf_transform_translate (&local, anchor->x0, anchor->y0, anchor->z0);
+        dxf_transform_rotate_z (&local, rot_angle);
+        dxf_transform_scale (&local,
+          (text_flags & 2) ? -1.0 : 1.0,
+          (text_flags & 4) ? -1.0 : 1.0,
+          1.0);
+        for (j = 0; j < 4; j++)
+        {
+                y = by[j / 2];
+                x = bx[j % 2] + y * tan (obl_angle * M_PI / 180.0);
+                dxf_extents_add_point (extents, &local, x, y, 0.0);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a DXF \c 3DFACE entity.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_add_3dface
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        Dxf3dface *face,
+                /*!< a pointer to a DXF \c 3DFACE entity. */
+        DxfTransform *transform
+                /*!< a pointer to a transformation, \c NULL for the
+                 * identity transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((extents == NULL) || (face == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_extents_add_quad (extents, transform, face->p0, face->p1,
+          face->p2, face->p3, 0.0, 0.0, 0.0, 1.0);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a DXF \c ARC entity.
+ *
+ * The bounds are exact for the angle range of the arc, the thickness
+ * (if any) extrudes the arc along the extrusion vector.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_add_arc
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfArc *arc,
+                /*!< a pointer to a DXF \c ARC entity. */
+        DxfTransform *transform
+                /*!< a pointer to a transformation, \c NULL for the
+                 * identity transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTransform ocs;
+        double c[3];
+        double u[3];
+        double v[3];
+
+        /* Do some basic checks. */
+        if ((extents == NULL) || (arc == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (arc->p0 == NULL)
+        {
+                return (EXIT_SUCCESS);
+        }
+        dxf_transform_init (&ocs);
+        if (transform != NULL)
+        {
+                dxf_transform_copy (&ocs, transform);
+        }
+        dxf_transform_ocs (&ocs, arc->extr_x0, arc->extr_y0, arc->extr_z0);
+        c[0] = arc->p0->x0;
+        c[1] = arc->p0->y0;
+        c[2] = arc->p0->z0;
+        u[0] = arc->radius;
+        u[1] = 0.0;
+        u[2] = 0.0;
+        v[0] = 0.0;
+        v[1] = arc->radius;
+        v[2] = 0.0;
+        if (arc->start_angle == arc->end_angle)
+        {
+                /* Avoid a degenerate arc being taken for a full circle. */
+                dxf_extents_add_point (extents, &ocs,
+                  c[0] + arc->radius * cos (arc->start_angle * M_PI / 180.0),
+                  c[1] + arc->radius * sin (arc->start_angle * M_PI / 180.0),
+                  c[2]);
+        }
+        else
+        {
+                dxf_extents_add_conic (extents, &ocs, c, u, v,
+                  arc->start_angle * M_PI / 180.0,
+                  arc->end_angle * M_PI / 180.0);
+        }
+        if (arc->thickness != 0.0)
+        {
+                c[2] += arc->thickness;
+                dxf_extents_add_conic (extents, &ocs, c, u, v,
+                  arc->start_angle * M_PI / 180.0,
+                  arc->end_angle * M_PI / 180.0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a DXF \c ATTDEF entity.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_add_attdef
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfAttdef *attdef,
+                /*!< a pointer to a DXF \c ATTDEF entity. */
+        DxfTables *tables,
+                /*!< a pointer to the symbol tables holding the text
+                 * tables, or \c NULL. */
+        DxfTransform *transform
+                /*!< a pointer to a transformation, \c NULL for the
+                 * identity transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((extents == NULL) || (attdef == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_extents_add_text_box (extents, transform, attdef->default_value,
+          attdef->text_style, tables, attdef->p0, attdef->p1,
+          attdef->height, attdef->rel_x_scale, attdef->rot_angle,
+          attdef->obl_angle, attdef->text_flags, attdef->hor_align,
+          attdef->vert_align, attdef->extr_x0, attdef->extr_y0,
+          attdef->extr_z0);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a DXF \c ATTRIB entity.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_add_attrib
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfAttrib *attrib,
+                /*!< a pointer to a DXF \c ATTRIB entity. */
+        DxfTables *tables,
+                /*!< a pointer to the symbol tables holding the text
+                 * tables, or \c NULL. */
+        DxfTransform *transform
+                /*!< a pointer to a transformation, \c NULL for the
+                 * identity transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((extents == NULL) || (attrib == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_extents_add_text_box (extents, transform, attrib->default_value,
+          attrib->text_style, tables, attrib->p0, attrib->p1,
+          attrib->height, attrib->rel_x_scale, attrib->rot_angle,
+          attrib->obl_angle, attrib->text_flags, attrib->hor_align,
+          attrib->vert_align, attrib->extr_x0, attrib->extr_y0,
+          attrib->extr_z0);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a DXF \c CIRCLE entity.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_add_circle
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfCircle *circle,
+                /*!< a pointer to a DXF \c CIRCLE entity. */
+        DxfTransform *transform
+                /*!< a pointer to a transformation, \c NULL for the
+                 * identity transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTransform ocs;
+        double c[3];
+        double u[3];
+        double v[3];
+
+        /* Do some basic checks. */
+        if ((extents == NULL) || (circle == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (circle->p0 == NULL)
+        {
+                return (EXIT_SUCCESS);
+        }
+        dxf_transform_init (&ocs);
+        if (transform != NULL)
+        {
+                dxf_transform_copy (&ocs, transform);
+        }
+        dxf_transform_ocs (&ocs, circle->extr_x0, circle->extr_y0, circle->extr_z0);
+        c[0] = circle->p0->x0;
+        c[1] = circle->p0->y0;
+        c[2] = circle->p0->z0;
+        u[0] = circle->radius;
+        u[1] = 0.0;
+        u[2] = 0.0;
+        v[0] = 0.0;
+        v[1] = circle->radius;
+        v[2] = 0.0;
+        dxf_extents_add_conic (extents, &ocs, c, u, v, 0.0, 0.0);
+        if (circle->thickness != 0.0)
+        {
+                c[2] += circle->thickness;
+                dxf_extents_add_conic (extents, &ocs, c, u, v, 0.0, 0.0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a block definition.
+ */
+static int
+dxf_extents_add_block
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfBlock *block,
+                /*!< a pointer to the block definition. */
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing with the block
+                 * definitions, or \c NULL. */
+        DxfTables *tables,
+                /*!< a pointer to the symbol tables holding the text
+                 * styles. */
+        int spline_mode,
+                /*!< spline bounding mode. */
+        DxfTransform *transform,
+                /*!< a pointer to a transformation, or \c NULL. */
+        int depth
+                /*!< nesting depth of the block reference. */
+)
+{
+        if ((block == NULL) || (block->entities == NULL))
+        {
+                return (EXIT_SUCCESS);
+        }
+        if (depth >= DXF_EXTENTS_MAX_BLOCK_DEPTH)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () block nesting too deep for block: %s.\n")),
+                  __FUNCTION__, block->block_name);
+                return (EXIT_FAILURE);
+        }
+        return (dxf_extents_add_entities_internal (extents,
+          (DxfEntities *) block->entities, drawing, tables, spline_mode,
+          transform, depth + 1));
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a dimension, the dimension block
+ * or else the definition points.
+ */
+static int
+dxf_extents_add_dimension_internal
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfDimension *dimension,
+                /*!< a pointer to a DXF \c DIMENSION entity. */
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing with the block
+                 * definitions, or \c NULL. */
+        DxfTables *tables,
+                /*!< a pointer to the symbol tables holding the text
+                 * styles. */
+        int spline_mode,
+                /*!< spline bounding mode. */
+        DxfTransform *transform,
+                /*!< a pointer to a transformation, or \c NULL. */
+        int depth
+                /*!< nesting depth of the block reference. */
+)
+{
+        DxfBlock *block = NULL;
+        DxfPoint *points[7];
+        int i;
+
+        block = dxf_extents_find_block (drawing, dimension->dimblock_name);
+        if ((block != NULL) && (block->entities != NULL))
+        {
+                /* The dimension block is defined in WCS. */
+                return (dxf_extents_add_block (extents, block, drawing,
+                  tables, spline_mode, transform, depth));
+        }
+        points[0] = dimension->p0;
+        points[1] = dimension->p1;
+        points[2] = dimension->p2;
+        points[3] = dimension->p3;
+        points[4] = dimension->p4;
+        points[5] = dimension->p5;
+        points[6] = dimension->p6;
+        for (i = 0; i < 7; i++)
+        {
+                if (points[i] != NULL)
+                {
+                        dxf_extents_add_point (extents, transform,
+                          points[i]->x0, points[i]->y0, points[i]->z0);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a DXF \c DIMENSION entity.
+ *
+ * The entities of the anonymous dimension block are used when the
+ * block is found, otherwise the definition points.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_add_dimension
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfDimension *dimension,
+                /*!< a pointer to a DXF \c DIMENSION entity. */
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing with the block
+                 * definitions, or \c NULL. */
+        DxfTables *tables,
+                /*!< a pointer to the symbol tables holding the text
+                 * tables, or \c NULL. */
+        int spline_mode,
+                /*!< \c DXF_EXTENTS_SPLINE_CONTROL_HULL or
+                 * \c DXF_EXTENTS_SPLINE_TIGHT. */
+        DxfTransform *transform
+                /*!< a pointer to a transformation, \c NULL for the
+                 * identity transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int result;
+
+        /* Do some basic checks. */
+        if ((extents == NULL) || (dimension == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        result = dxf_extents_add_dimension_internal (extents, dimension,
+          drawing, tables, spline_mode, transform, 0);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a DXF \c ELLIPSE entity.
+ *
+ * The bounds are exact for the parameter range of the ellipse.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_add_ellipse
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfEllipse *ellipse,
+                /*!< a pointer to a DXF \c ELLIPSE entity. */
+        DxfTransform *transform
+                /*!< a pointer to a transformation, \c NULL for the
+                 * identity transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double c[3];
+        double u[3];
+        double v[3];
+        double n[3];
+        double length;
+
+        /* Do some basic checks. */
+        if ((extents == NULL) || (ellipse == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((ellipse->p0 == NULL) || (ellipse->p1 == NULL))
+        {
+                return (EXIT_SUCCESS);
+        }
+        c[0] = ellipse->p0->x0;
+        c[1] = ellipse->p0->y0;
+        c[2] = ellipse->p0->z0;
+        /* Endpoint of the major axis, relative to the center. */
+        u[0] = ellipse->p1->x0;
+        u[1] = ellipse->p1->y0;
+        u[2] = ellipse->p1->z0;
+        n[0] = ellipse->extr_x0;
+        n[1] = ellipse->extr_y0;
+        n[2] = ellipse->extr_z0;
+        if ((n[0] == 0.0) && (n[1] == 0.0) && (n[2] == 0.0))
+        {
+                n[2] = 1.0;
+        }
+        /* Minor axis: ratio * |major| * (N x major) / |N x major|. */
+        v[0] = n[1] * u[2] - n[2] * u[1];
+        v[1] = n[2] * u[0] - n[0] * u[2];
+        v[2] = n[0] * u[1] - n[1] * u[0];
+        dxf_extents_normalize (v);
+        length = sqrt (u[0] * u[0] + u[1] * u[1] + u[2] * u[2]) * ellipse->ratio;
+        v[0] *= length;
+        v[1] *= length;
+        v[2] *= length;
+        dxf_extents_add_conic (extents, transform, c, u, v,
+          ellipse->start_angle, ellipse->end_angle);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a DXF \c HATCH entity.
+ *
+ * All boundary paths (polylines and edges) are taken into account.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_add_hatch
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfHatch *hatch,
+                /*!< a pointer to a DXF \c HATCH entity. */
+        int spline_mode,
+                /*!< \c DXF_EXTENTS_SPLINE_CONTROL_HULL or
+                 * \c DXF_EXTENTS_SPLINE_TIGHT. */
+        DxfTransform *transform
+                /*!< a pointer to a transformation, \c NULL for the
+                 * identity transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTransform ocs;
+        DxfHatchBoundaryPath *path = NULL;
+        DxfHatchBoundaryPathPolyline *polyline = NULL;
+        DxfHatchBoundaryPathPolylineVertex *vertex = NULL;
+        DxfHatchBoundaryPathPolylineVertex *next = NULL;
+        DxfHatchBoundaryPathEdge *edge = NULL;
+        DxfHatchBoundaryPathEdgeArc *arc = NULL;
+        DxfHatchBoundaryPathEdgeEllipse *ellipse = NULL;
+        DxfHatchBoundaryPathEdgeLine *line = NULL;
+        DxfHatchBoundaryPathEdgeSpline *spline = NULL;
+        DxfHatchBoundaryPathEdgeSplineCp *cp = NULL;
+        double *cpw = NULL;
+        double c[3];
+        double u[3];
+        double v[3];
+        double start;
+        double end;
+        double z;
+        int number_of_knots;
+        int i;
+
+        /* Do some basic checks. */
+        if ((extents == NULL) || (hatch == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_transform_init (&ocs);
+        if (transform != NULL)
+        {
+                dxf_transform_copy (&ocs, transform);
+        }
+        dxf_transform_ocs (&ocs, hatch->extr_x0, hatch->extr_y0, hatch->extr_z0);
+        z = (hatch->p0 != NULL) ? hatch->p0->z0 : hatch->elevation;
+        for (path = (DxfHatchBoundaryPath *) hatch->paths; path != NULL; path = (DxfHatchBoundaryPath *) path->next)
+        {
+                for (polyline = (DxfHatchBoundaryPathPolyline *) path->polylines;
+                  polyline != NULL;
+                  polyline = (DxfHatchBoundaryPathPolyline *) polyline->next)
+                {
+                        for (vertex = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+                          vertex != NULL;
+                          vertex = next)
+                        {
+                                next = (DxfHatchBoundaryPathPolylineVertex *) vertex->next;
+                                if (next == NULL)
+                                {
+                                        if (!polyline->is_closed)
+                                        {
+                                                dxf_extents_add_point (extents, &ocs, vertex->x0, vertex->y0, z);
+                                                break;
+                                        }
+                                        next = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+                                        dxf_extents_add_bulge (extents, &ocs,
+                                          vertex->x0, vertex->y0, next->x0, next->y0, z,
+                                          vertex->has_bulge ? vertex->bulge : 0.0);
+                                        break;
+                                }
+                                dxf_extents_add_bulge (extents, &ocs,
+                                  vertex->x0, vertex->y0, next->x0, next->y0, z,
+                                  vertex->has_bulge ? vertex->bulge : 0.0);
+                        }
+                }
+                for (edge = (DxfHatchBoundaryPathEdge *) path->edges;
+                  edge != NULL;
+                  edge = (DxfHatchBoundaryPathEdge *) edge->next)
+                {
+                        for (line = (DxfHatchBoundaryPathEdgeLine *) edge->lines;
+                          line != NULL;
+                          line = (DxfHatchBoundaryPathEdgeLine *) line->next)
+                        {
+                                dxf_extents_add_point (extents, &ocs, line->x0, line->y0, z);
+                                dxf_extents_add_point (extents, &ocs, line->x1, line->y1, z);
+                        }
+                        for (arc = (DxfHatchBoundaryPathEdgeArc *) edge->arcs;
+                          arc != NULL;
+                          arc = (DxfHatchBoundaryPathEdgeArc *) arc->next)
+                        {
+                                c[0] = arc->x0;
+                                c[1] = arc->y0;
+                                c[2] = z;
+                                u[0] = arc->radius;
+                                u[1] = 0.0;
+                                u[2] = 0.0;
+                                v[0] = 0.0;
+                                v[1] = arc->radius;
+                                v[2] = 0.0;
+                                /* Clockwise arcs store mirrored angles. */
+                                start = (arc->is_ccw ? arc->start_angle : -arc->end_angle) * M_PI / 180.0;
+                                end = (arc->is_ccw ? arc->end_angle : -arc->start_angle) * M_PI / 180.0;
+                                dxf_extents_add_conic (extents, &ocs, c, u, v, start, end);
+                        }
+                        for (ellipse = (DxfHatchBoundaryPathEdgeEllipse *) edge->ellipses;
+                          ellipse != NULL;
+                          ellipse = (DxfHatchBoundaryPathEdgeEllipse *) ellipse->next)
+                        {
+                                c[0] = ellipse->x0;
+                                c[1] = ellipse->y0;
+                                c[2] = z;
+                                u[0] = ellipse->x1;
+                                u[1] = ellipse->y1;
+                                u[2] = 0.0;
+                                v[0] = -ellipse->y1 * ellipse->ratio;
+                                v[1] = ellipse->x1 * ellipse->ratio;
+                                v[2] = 0.0;
+                                start = (ellipse->is_ccw ? ellipse->start_angle : -ellipse->end_angle) * M_PI / 180.0;
+                                end = (ellipse->is_ccw ? ellipse->end_angle : -ellipse->start_angle) * M_PI / 180.0;
+                                dxf_extents_add_conic (extents, &ocs, c, u, v, start, end);
+                        }
+                        for (spline = (DxfHatchBoundaryPathEdgeSpline *) edge->splines;
+                          spline != NULL;
+                          spline = (DxfHatchBoundaryPathEdgeSpline *) spline->next)
+                        {
+                                i = 0;
+                                for (cp = (DxfHatchBoundaryPathEdgeSplineCp *) spline->control_points;
+                                  cp != NULL;
+                                  cp = (DxfHatchBoundaryPathEdgeSplineCp *) cp->next)
+                                {
+                                        i++;
+                                }
+                                if (i == 0)
+                                {
+                                        continue;
+                                }
+                                cpw = dxf_malloc (4 * i * sizeof (double));
+                                if (cpw == NULL)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () could not allocate memory.\n")),
+                                          __FUNCTION__);
+                                        return (EXIT_FAILURE);
+                                }
+                                i = 0;
+                                for (cp = (DxfHatchBoundaryPathEdgeSplineCp *) spline->control_points;
+                                  cp != NULL;
+                                  cp = (DxfHatchBoundaryPathEdgeSplineCp *) cp->next)
+                                {
+                                        cpw[4 * i] = cp->x0;
+                                        cpw[4 * i + 1] = cp->y0;
+                                        cpw[4 * i + 2] = z;
+                                        cpw[4 * i + 3] = spline->rational ? cp->weight : 1.0;
+                                        i++;
+                                }
+                                number_of_knots = spline->number_of_knots;
+                                if (number_of_knots > DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS)
+                                {
+                                        number_of_knots = DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS;
+                                }
+                                dxf_extents_add_nurbs (extents, &ocs, spline->degree,
+                                  i, cpw, number_of_knots, spline->knots, spline_mode);
+                                dxf_free (cpw);
+                        }
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a DXF \c HELIX entity.
+ *
+ * The helix is bounded by the cylinder around its axis.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_add_helix
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfHelix *helix,
+                /*!< a pointer to a DXF \c HELIX entity. */
+        DxfTransform *transform
+                /*!< a pointer to a transformation, \c NULL for the
+                 * identity transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double ax[3];
+        double ay[3];
+        double az[3];
+        double c[3];
+        double u[3];
+        double v[3];
+        double radius;
+        double height;
+        double d;
+        int i;
+
+        /* Do some basic checks. */
+        if ((extents == NULL) || (helix == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (helix->p0 == NULL)
+        {
+                return (EXIT_SUCCESS);
+        }
+        if (helix->p2 != NULL)
+        {
+                dxf_transform_ocs_axes (helix->p2->x0, helix->p2->y0,
+                  helix->p2->z0, ax, ay, az);
+        }
+        else
+        {
+                dxf_transform_ocs_axes (0.0, 0.0, 1.0, ax, ay, az);
+        }
+        c[0] = helix->p0->x0;
+        c[1] = helix->p0->y0;
+        c[2] = helix->p0->z0;
+        radius = helix->radius;
+        if ((radius <= 0.0) && (helix->p1 != NULL))
+        {
+                /* Distance of the start point to the axis. */
+                u[0] = helix->p1->x0 - c[0];
+                u[1] = helix->p1->y0 - c[1];
+                u[2] = helix->p1->z0 - c[2];
+                d = u[0] * az[0] + u[1] * az[1] + u[2] * az[2];
+                for (i = 0; i < 3; i++)
+                {
+                        u[i] -= d * az[i];
+                }
+                radius = sqrt (u[0] * u[0] + u[1] * u[1] + u[2] * u[2]);
+        }
+        height = helix->number_of_turns * helix->turn_height;
+        for (i = 0; i < 3; i++)
+        {
+                u[i] = ax[i] * radius;
+                v[i] = ay[i] * radius;
+        }
+        dxf_extents_add_conic (extents, transform, c, u, v, 0.0, 0.0);
+        for (i = 0; i < 3; i++)
+        {
+                c[i] += az[i] * height;
+        }
+        dxf_extents_add_conic (extents, transform, c, u, v, 0.0, 0.0);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a DXF \c IMAGE entity.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_add_image
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfImage *image,
+                /*!< a pointer to a DXF \c IMAGE entity. */
+        DxfTransform *transform
+                /*!< a pointer to a transformation, \c NULL for the
+                 * identity transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double su;
+        double sv;
+        int i;
+
+        /* Do some basic checks. */
+        if ((extents == NULL) || (image == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (image->p0 == NULL)
+        {
+                return (EXIT_SUCCESS);
+        }
+        if ((image->p1 == NULL) || (image->p2 == NULL) || (image->p3 == NULL))
+        {
+                dxf_extents_add_point (extents, transform,
+                  image->p0->x0, image->p0->y0, image->p0->z0);
+                return (EXIT_SUCCESS);
+        }
+        for (i = 0; i < 4; i++)
+        {
+                su = (i & 1) ? image->p3->x0 : 0.0;
+                sv = (i & 2) ? image->p3->y0 : 0.0;
+                dxf_extents_add_point (extents, transform,
+                  image->p0->x0 + image->p1->x0 * su + image->p2->x0 * sv,
+                  image->p0->y0 + image->p1->y0 * su + image->p2->y0 * sv,
+                  image->p0->z0 + image->p1->z0 * su + image->p2->z0 * sv);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a block reference.
+ */
+static int
+dxf_extents_add_insert_internal
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfInsert *insert,
+                /*!< a pointer to a DXF \c INSERT entity. */
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing with the block
+                 * definitions, or \c NULL. */
+        DxfTables *tables,
+                /*!< a pointer to the symbol tables holding the text
+                 * styles. */
+        int spline_mode,
+                /*!< spline bounding mode. */
+        DxfTransform *transform,
+                /*!< a pointer to a transformation, or \c NULL. */
+        int depth
+                /*!< nesting depth of the block reference. */
+)
+{
+        DxfBlock *block = NULL;
+        DxfTransform local;
+        DxfTransform rotation;
+        DxfExtents cell;
+        double dx;
+        double dy;
+        double dz;
+        int columns;
+        int rows;
+        int i;
+        int j;
+
+        if (insert->p0 == NULL)
+        {
+                return (EXIT_SUCCESS);
+        }
+        block = dxf_extents_find_block (drawing, insert->block_name);
+        if ((block == NULL) || (block->entities == NULL))
+        {
+                return (EXIT_SUCCESS);
+        }
+        /* Parent * OCS * T(insertion point) * Rz(rotation)
+         * * S(scale) * T(-base point). */
+        dxf_transform_init (&local);
+        if (transform != NULL)
+        {
+                dxf_transform_copy (&local, transform);
+        }
+        dxf_transform_ocs (&local, insert->extr_x0, insert->extr_y0, insert->extr_z0);
+        dxf_transform_translate (&local, insert->p0->x0, insert->p0->y0, insert->p0->z0);
+        dxf_transform_rotate_z (&local, insert->rot_angle);
+        dxf_transform_copy (&rotation, &local);
+        dxf_transform_scale (&local, insert->rel_x_scale,
+          insert->rel_y_scale, insert->rel_z_scale);
+        if (block->p0 != NULL)
+        {
+                dxf_transform_translate (&local, -block->p0->x0,
+                  -block->p0->y0, -block->p0->z0);
+        }
+        dxf_extents_init (&cell);
+        dxf_extents_add_block (&cell, block, drawing, tables,
+          spline_mode, &local, depth);
+        if (cell.empty)
+        {
+                return (EXIT_SUCCESS);
+        }
+        columns = (insert->columns > 1) ? insert->columns : 1;
+        rows = (insert->rows > 1) ? insert->rows : 1;
+        if ((columns == 1) && (rows == 1))
+        {
+                return (dxf_extents_merge (extents, &cell));
+        }
+        /* MINSERT: the cells are translated copies, the extremes are
+         * reached by the corner cells of the lattice. */
+        for (i = 0; i < 2; i++)
+        {
+                for (j = 0; j < 2; j++)
+                {
+                        dx = i * (columns - 1) * insert->column_spacing;
+                        dy = j * (rows - 1) * insert->row_spacing;
+                        dz = 0.0;
+                        dxf_transform_apply_vector (&rotation, &dx, &dy, &dz);
+                        dxf_extents_add_point (extents, NULL,
+                          cell.x0 + dx, cell.y0 + dy, cell.z0 + dz);
+                        dxf_extents_add_point (extents, NULL,
+                          cell.x1 + dx, cell.y1 + dy, cell.z1 + dz);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a DXF \c INSERT entity.
+ *
+ * The entities of the referenced block are transformed by the
+ * insertion point, scale factors, rotation angle and extrusion of the
+ * block reference, nested block references are followed up to
+ * \c DXF_EXTENTS_MAX_BLOCK_DEPTH levels.\n
+ * For a multiple insert (MINSERT) all cells of the lattice of
+ * columns and rows are taken into account.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_add_insert
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfInsert *insert,
+                /*!< a pointer to a DXF \c INSERT entity. */
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing with the block
+                 * definitions, or \c NULL. */
+        DxfTables *tables,
+                /*!< a pointer to the symbol tables holding the text
+                 * tables, or \c NULL. */
+        int spline_mode,
+                /*!< \c DXF_EXTENTS_SPLINE_CONTROL_HULL or
+                 * \c DXF_EXTENTS_SPLINE_TIGHT. */
+        DxfTransform *transform
+                /*!< a pointer to a transformation, \c NULL for the
+                 * identity transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int result;
+
+        /* Do some basic checks. */
+        if ((extents == NULL) || (insert == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        result = dxf_extents_add_insert_internal (extents, insert, drawing,
+          tables, spline_mode, transform, 0);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a DXF \c LEADER entity.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_add_leader
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfLeader *leader,
+                /*!< a pointer to a DXF \c LEADER entity. */
+        DxfTransform *transform
+                /*!< a pointer to a transformation, \c NULL for the
+                 * identity transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPoint *iter = NULL;
+
+        /* Do some basic checks. */
+        if ((extents == NULL) || (leader == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (iter = leader->p0; iter != NULL; iter = (DxfPoint *) iter->next)
+        {
+                dxf_extents_add_point (extents, transform,
+                  iter->x0, iter->y0, iter->z0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a DXF \c LINE entity.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_add_line
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfLine *line,
+                /*!< a pointer to a DXF \c LINE entity. */
+        DxfTransform *transform
+                /*!< a pointer to a transformation, \c NULL for the
+                 * identity transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double n[3];
+
+        /* Do some basic checks. */
+        if ((extents == NULL) || (line == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((line->p0 == NULL) || (line->p1 == NULL))
+        {
+                return (EXIT_SUCCESS);
+        }
+        dxf_extents_add_point (extents, transform, line->p0->x0, line->p0->y0, line->p0->z0);
+        dxf_extents_add_point (extents, transform, line->p1->x0, line->p1->y0, line->p1->z0);
+        if (line->thickness != 0.0)
+        {
+                n[0] = line->extr_x0;
+                n[1] = line->extr_y0;
+                n[2] = line->extr_z0;
+                if ((n[0] == 0.0) && (n[1] == 0.0) && (n[2] == 0.0))
+                {
+                        n[2] = 1.0;
+                }
+                dxf_extents_normalize (n);
+                dxf_extents_add_point (extents, transform,
+                  line->p0->x0 + n[0] * line->thickness,
+                  line->p0->y0 + n[1] * line->thickness,
+                  line->p0->z0 + n[2] * line->thickness);
+                dxf_extents_add_point (extents, transform,
+                  line->p1->x0 + n[0] * line->thickness,
+                  line->p1->y0 + n[1] * line->thickness,
+                  line->p1->z0 + n[2] * line->thickness);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a list of (bulged) 2D vertices in
+ * the Object Coordinate System (OCS).
+ */
+static int
+dxf_extents_add_vertices
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfTransform *transform,
+                /*!< a pointer to a transformation (including the OCS),
+                 * or \c NULL. */
+        DxfVertex *vertices,
+                /*!< a pointer to a single linked list of vertices. */
+        int closed,
+                /*!< \c TRUE if the last vertex connects to the first
+                 * vertex. */
+        double z
+                /*!< Z-coordinate (elevation) of the vertices. */
+)
+{
+        DxfVertex *vertex = NULL;
+        DxfVertex *next = NULL;
+
+        for (vertex = vertices; vertex != NULL; vertex = next)
+        {
+                next = (DxfVertex *) vertex->next;
+                if (vertex->p0 == NULL)
+                {
+                        continue;
+                }
+                while ((next != NULL) && (next->p0 == NULL))
+                {
+                        next = (DxfVertex *) next->next;
+                }
+                if ((next == NULL) && closed && (vertices->p0 != NULL))
+                {
+                        dxf_extents_add_bulge (extents, transform,
+                          vertex->p0->x0, vertex->p0->y0,
+                          vertices->p0->x0, vertices->p0->y0, z,
+                          vertex->bulge);
+                }
+                else if (next == NULL)
+                {
+                        dxf_extents_add_point (extents, transform,
+                          vertex->p0->x0, vertex->p0->y0, z);
+                }
+                else
+                {
+                        dxf_extents_add_bulge (extents, transform,
+                          vertex->p0->x0, vertex->p0->y0,
+                          next->p0->x0, next->p0->y0, z,
+                          vertex->bulge);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a DXF \c LWPOLYLINE entity.
+ *
+ * Arc segments (bulges) are bounded exactly, segment widths are not
+ * taken into account.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_add_lwpolyline
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfLWPolyline *lwpolyline,
+                /*!< a pointer to a DXF \c LWPOLYLINE entity. */
+        DxfTransform *transform
+                /*!< a pointer to a transformation, \c NULL for the
+                 * identity transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTransform ocs;
+
+        /* Do some basic checks. */
+        if ((extents == NULL) || (lwpolyline == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_transform_init (&ocs);
+        if (transform != NULL)
+        {
+                dxf_transform_copy (&ocs, transform);
+        }
+        dxf_transform_ocs (&ocs, lwpolyline->extr_x0, lwpolyline->extr_y0, lwpolyline->extr_z0);
+        dxf_extents_add_vertices (extents, &ocs,
+          (DxfVertex *) lwpolyline->vertices, (lwpolyline->flag & 1),
+          lwpolyline->elevation);
+        if (lwpolyline->thickness != 0.0)
+        {
+                dxf_extents_add_vertices (extents, &ocs,
+                  (DxfVertex *) lwpolyline->vertices, (lwpolyline->flag & 1),
+                  lwpolyline->elevation + lwpolyline->thickness);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a DXF \c MLINE entity.
+ *
+ * The vertices are taken into account, the element offsets of the
+ * multiline style are not.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_add_mline
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfMline *mline,
+                /*!< a pointer to a DXF \c MLINE entity. */
+        DxfTransform *transform
+                /*!< a pointer to a transformation, \c NULL for the
+                 * identity transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPoint *iter = NULL;
+
+        /* Do some basic checks. */
+        if ((extents == NULL) || (mline == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (mline->p0 != NULL)
+        {
+                dxf_extents_add_point (extents, transform,
+                  mline->p0->x0, mline->p0->y0, mline->p0->z0);
+        }
+        for (iter = mline->p1; iter != NULL; iter = (DxfPoint *) iter->next)
+        {
+                dxf_extents_add_point (extents, transform,
+                  iter->x0, iter->y0, iter->z0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a DXF \c MTEXT entity.
+ *
+ * The reference rectangle is used when present, otherwise the box is
+ * estimated from the number of lines and the longest line (see
+ * \c DXF_EXTENTS_TEXT_CHARACTER_WIDTH).
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_add_mtext
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfMtext *mtext,
+                /*!< a pointer to a DXF \c MTEXT entity. */
+        DxfTransform *transform
+                /*!< a pointer to a transformation, \c NULL for the
+                 * identity transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double ax[3];
+        double ay[3];
+        double az[3];
+        double xdir[3];
+        double ydir[3];
+        double width;
+        double height;
+        double spacing;
+        double bx;
+        double by;
+        double x;
+        double y;
+        size_t characters;
+        size_t longest;
+        size_t lines;
+        size_t i;
+        int column;
+        int row;
+        int j;
+        int k;
+
+        /* Do some basic checks. */
+        if ((extents == NULL) || (mtext == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (mtext->p0 == NULL)
+        {
+                return (EXIT_SUCCESS);
+        }
+        dxf_transform_ocs_axes (mtext->extr_x0, mtext->extr_y0,
+          mtext->extr_z0, ax, ay, az);
+        if ((mtext->p1 != NULL)
+          && ((mtext->p1->x0 != 0.0) || (mtext->p1->y0 != 0.0) || (mtext->p1->z0 != 0.0)))
+        {
+                xdir[0] = mtext->p1->x0;
+                xdir[1] = mtext->p1->y0;
+                xdir[2] = mtext->p1->z0;
+                dxf_extents_normalize (xdir);
+        }
+        else
+        {
+                /* The rotation angle is in radians. */
+                for (k = 0; k < 3; k++)
+                {
+                        xdir[k] = ax[k] * cos (mtext->rot_angle)
+                          + ay[k] * sin (mtext->rot_angle);
+                }
+        }
+        ydir[0] = az[1] * xdir[2] - az[2] * xdir[1];
+        ydir[1] = az[2] * xdir[0] - az[0] * xdir[2];
+        ydir[2] = az[0] * xdir[1] - az[1] * xdir[0];
+        dxf_extents_normalize (ydir);
+        /* Count lines ("\P" or new line) and the longest line. */
+        lines = 1;
+        longest = 0;
+        characters = 0;
+        if (mtext->text_value != NULL)
+        {
+                for (i = 0; mtext->text_value[i] != '\0'; i++)
+                {
+                        if (((mtext->text_value[i] == '\\') && (mtext->text_value[i + 1] == 'P'))
+                          || (mtext->text_value[i] == '\n'))
+                        {
+                                if (mtext->text_value[i] == '\\') i++;
+                                lines++;
+                                characters = 0;
+                                continue;
+                        }
+                        if ((mtext->text_value[i] & 0xC0) != 0x80)
+                        {
+                                characters++;
+                                if (characters > longest) longest = characters;
+                        }
+                }
+        }
+        spacing = (mtext->spacing_factor > 0.0) ? mtext->spacing_factor : 1.0;
+        width = mtext->rectangle_width;
+        if (width <= 0.0)
+        {
+                width = longest * mtext->height * DXF_EXTENTS_TEXT_CHARACTER_WIDTH;
+        }
+        height = mtext->rectangle_height;
+        if (height <= 0.0)
+        {
+                height = mtext->height
+                  + (lines - 1) * mtext->height * DXF_EXTENTS_MTEXT_LINE_SPACING * spacing
+                  + mtext->height * DXF_EXTENTS_TEXT_DESCENT;
+        }
+        /* Attachment point: 1..3 top, 4..6 middle, 7..9 bottom and
+         * left, center, right. */
+        column = 0;
+        row = 0;
+        if ((mtext->attachment_point >= 1) && (mtext->attachment_point <= 9))
+        {
+                column = (mtext->attachment_point - 1) % 3;
+                row = (mtext->attachment_point - 1) / 3;
+        }
+        bx = -column * width / 2.0;
+        by = -height + row * height / 2.0;
+        for (j = 0; j < 4; j++)
+        {
+                x = bx + ((j & 1) ? width : 0.0);
+                y = by + ((j & 2) ? height : 0.0);
+                dxf_extents_add_point (extents, transform,
+                  mtext->p0->x0 + x * xdir[0] + y * ydir[0],
+                  mtext->p0->y0 + x * xdir[1] + y * ydir[1],
+                  mtext->p0->z0 + x * xdir[2] + y * ydir[2]);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a DXF \c POINT entity.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_add_point_entity
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfPoint *point,
+                /*!< a pointer to a DXF \c POINT entity. */
+        DxfTransform *transform
+                /*!< a pointer to a transformation, \c NULL for the
+                 * identity transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double n[3];
+
+        /* Do some basic checks. */
+        if ((extents == NULL) || (point == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_extents_add_point (extents, transform, point->x0, point->y0, point->z0);
+        if (point->thickness != 0.0)
+        {
+                n[0] = point->extr_x0;
+                n[1] = point->extr_y0;
+                n[2] = point->extr_z0;
+                if ((n[0] == 0.0) && (n[1] == 0.0) && (n[2] == 0.0))
+                {
+                        n[2] = 1.0;
+                }
+                dxf_extents_normalize (n);
+                dxf_extents_add_point (extents, transform,
+                  point->x0 + n[0] * point->thickness,
+                  point->y0 + n[1] * point->thickness,
+                  point->z0 + n[2] * point->thickness);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a DXF \c POLYLINE entity.
+ *
+ * 2D polylines are bounded in their Object Coordinate System (OCS)
+ * including arc segments (bulges), 3D polylines, polygon meshes and
+ * polyface meshes by their vertices (face records are skipped).
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_add_polyline
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfPolyline *polyline,
+                /*!< a pointer to a DXF \c POLYLINE entity. */
+        DxfTransform *transform
+                /*!< a pointer to a transformation, \c NULL for the
+                 * identity transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTransform ocs;
+        DxfVertex *vertex = NULL;
+        double z;
+
+        /* Do some basic checks. */
+        if ((extents == NULL) || (polyline == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (polyline->flag & (8 | 16 | 64))
+        {
+                for (vertex = polyline->vertices; vertex != NULL; vertex = (DxfVertex *) vertex->next)
+                {
+                        if ((vertex->p0 == NULL)
+                          || ((vertex->flag & 128) && !(vertex->flag & 64)))
+                        {
+                                /* Polyface mesh face records carry no
+                                 * coordinates. */
+                                continue;
+                        }
+                        dxf_extents_add_point (extents, transform,
+                          vertex->p0->x0, vertex->p0->y0, vertex->p0->z0);
+                }
+#if DEBUG
+                DXF_DEBUG_END
+#endif
+                return (EXIT_SUCCESS);
+        }
+        dxf_transform_init (&ocs);
+        if (transform != NULL)
+        {
+                dxf_transform_copy (&ocs, transform);
+        }
+        dxf_transform_ocs (&ocs, polyline->extr_x0, polyline->extr_y0, polyline->extr_z0);
+        z = (polyline->p0 != NULL) ? polyline->p0->z0 : polyline->elevation;
+        dxf_extents_add_vertices (extents, &ocs, polyline->vertices,
+          (polyline->flag & 1), z);
+        if (polyline->thickness != 0.0)
+        {
+                dxf_extents_add_vertices (extents, &ocs, polyline->vertices,
+                  (polyline->flag & 1), z + polyline->thickness);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a DXF \c SHAPE entity.
+ *
+ * No shape definitions are available, the shape is estimated as a
+ * square of the shape size.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_add_shape
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfShape *shape,
+                /*!< a pointer to a DXF \c SHAPE entity. */
+        DxfTransform *transform
+                /*!< a pointer to a transformation, \c NULL for the
+                 * identity transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTransform local;
+        double width;
+        double x;
+        double y;
+        int j;
+
+        /* Do some basic checks. */
+        if ((extents == NULL) || (shape == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (shape->p0 == NULL)
+        {
+                return (EXIT_SUCCESS);
+        }
+        dxf_transform_init (&local);
+        if (transform != NULL)
+        {
+                dxf_transform_copy (&local, transform);
+        }
+        dxf_transform_ocs (&local, shape->extr_x0, shape->extr_y0, shape->extr_z0);
+        dxf_transform_translate (&local, shape->p0->x0, shape->p0->y0, shape->p0->z0);
+        dxf_transform_rotate_z (&local, shape->rot_angle);
+        width = shape->size * ((shape->rel_x_scale > 0.0) ? shape->rel_x_scale : 1.0);
+        for (j = 0; j < 4; j++)
+        {
+                y = (j & 2) ? shape->size : 0.0;
+                x = ((j & 1) ? width : 0.0) + y * tan (shape->obl_angle * M_PI / 180.0);
+                dxf_extents_add_point (extents, &local, x, y, 0.0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a DXF \c SOLID entity.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_add_solid
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfSolid *solid,
+                /*!< a pointer to a DXF \c SOLID entity. */
+        DxfTransform *transform
+                /*!< a pointer to a transformation, \c NULL for the
+                 * identity transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((extents == NULL) || (solid == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_extents_add_quad (extents, transform, solid->p0, solid->p1,
+          solid->p2, solid->p3, solid->thickness, solid->extr_x0,
+          solid->extr_y0, solid->extr_z0);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a DXF \c SPLINE entity.
+ *
+ * Splines without control points are bounded by their fit points.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_add_spline
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfSpline *spline,
+                /*!< a pointer to a DXF \c SPLINE entity. */
+        int spline_mode,
+                /*!< \c DXF_EXTENTS_SPLINE_CONTROL_HULL or
+                 * \c DXF_EXTENTS_SPLINE_TIGHT. */
+        DxfTransform *transform
+                /*!< a pointer to a transformation, \c NULL for the
+                 * identity transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPoint *iter = NULL;
+        DxfDouble *value = NULL;
+        double *cpw = NULL;
+        double *knots = NULL;
+        int number_of_control_points;
+        int number_of_weights;
+        int number_of_knots;
+        int i;
+
+        /* Do some basic checks. */
+        if ((extents == NULL) || (spline == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        number_of_control_points = 0;
+        for (iter = spline->p0; iter != NULL; iter = (DxfPoint *) iter->next)
+        {
+                number_of_control_points++;
+        }
+        if (number_of_control_points == 0)
+        {
+                for (iter = spline->p1; iter != NULL; iter = (DxfPoint *) iter->next)
+                {
+                        dxf_extents_add_point (extents, transform,
+                          iter->x0, iter->y0, iter->z0);
+                }
+#if DEBUG
+                DXF_DEBUG_END
+#endif
+                return (EXIT_SUCCESS);
+        }
+        number_of_weights = 0;
+        for (value = spline->weight_value; value != NULL; value = (DxfDouble *) value->next)
+        {
+                number_of_weights++;
+        }
+        number_of_knots = 0;
+        for (value = spline->knot_value; value != NULL; value = (DxfDouble *) value->next)
+        {
+                number_of_knots++;
+        }
+        cpw = dxf_malloc (4 * number_of_control_points * sizeof (double));
+        knots = dxf_malloc ((number_of_knots + 1) * sizeof (double));
+        if ((cpw == NULL) || (knots == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_free (cpw);
+                dxf_free (knots);
+                return (EXIT_FAILURE);
+        }
+        value = (number_of_weights == number_of_control_points) ? spline->weight_value : NULL;
+        for (iter = spline->p0, i = 0; iter != NULL; iter = (DxfPoint *) iter->next, i++)
+        {
+                cpw[4 * i] = iter->x0;
+                cpw[4 * i + 1] = iter->y0;
+                cpw[4 * i + 2] = iter->z0;
+                cpw[4 * i + 3] = 1.0;
+                if (value != NULL)
+                {
+                        cpw[4 * i + 3] = value->value;
+                        value = (DxfDouble *) value->next;
+                }
+        }
+        for (value = spline->knot_value, i = 0; value != NULL; value = (DxfDouble *) value->next, i++)
+        {
+                knots[i] = value->value;
+        }
+        dxf_extents_add_nurbs (extents, transform, spline->degree,
+          number_of_control_points, cpw, number_of_knots, knots,
+          spline_mode);
+        dxf_free (cpw);
+        dxf_free (knots);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a DXF \c TEXT entity.
+ *
+ * The box is estimated from the number of characters, the text height
+ * and the width factor (see \c DXF_EXTENTS_TEXT_CHARACTER_WIDTH),
+ * missing values are taken from the text style.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_add_text
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfText *text,
+                /*!< a pointer to a DXF \c TEXT entity. */
+        DxfTables *tables,
+                /*!< a pointer to the symbol tables holding the text
+                 * tables, or \c NULL. */
+        DxfTransform *transform
+                /*!< a pointer to a transformation, \c NULL for the
+                 * identity transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((extents == NULL) || (text == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_extents_add_text_box (extents, transform, text->text_value,
+          text->text_style, tables, text->p0, text->p1, text->height,
+          text->rel_x_scale, text->rot_angle, text->obl_angle,
+          text->text_flags, text->hor_align, text->vert_align,
+          text->extr_x0, text->extr_y0, text->extr_z0);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a DXF \c TRACE entity.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_add_trace
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfTrace *trace,
+                /*!< a pointer to a DXF \c TRACE entity. */
+        DxfTransform *transform
+                /*!< a pointer to a transformation, \c NULL for the
+                 * identity transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((extents == NULL) || (trace == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_extents_add_quad (extents, transform, trace->p0, trace->p1,
+          trace->p2, trace->p3, trace->thickness, trace->extr_x0,
+          trace->extr_y0, trace->extr_z0);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a DXF \c VIEWPORT entity.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_add_viewport
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfViewport *viewport,
+                /*!< a pointer to a DXF \c VIEWPORT entity. */
+        DxfTransform *transform
+                /*!< a pointer to a transformation, \c NULL for the
+                 * identity transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((extents == NULL) || (viewport == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (viewport->center == NULL)
+        {
+                return (EXIT_SUCCESS);
+        }
+        dxf_extents_add_point (extents, transform,
+          viewport->center->x0 - viewport->width / 2.0,
+          viewport->center->y0 - viewport->height / 2.0,
+          viewport->center->z0);
+        dxf_extents_add_point (extents, transform,
+          viewport->center->x0 + viewport->width / 2.0,
+          viewport->center->y0 + viewport->height / 2.0,
+          viewport->center->z0);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a single entity of any type.
+ */
+static int
+dxf_extents_add_entity_internal
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfEntityType type,
+                /*!< the type of the entity. */
+        void *entity,
+                /*!< a pointer to the entity. */
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing with the block
+                 * definitions, or \c NULL. */
+        DxfTables *tables,
+                /*!< a pointer to the symbol tables holding the text
+                 * styles. */
+        int spline_mode,
+                /*!< spline bounding mode. */
+        DxfTransform *transform,
+                /*!< a pointer to a transformation, or \c NULL. */
+        int depth
+                /*!< nesting depth of the block reference. */
+)
+{
+        DxfTolerance *tolerance = NULL;
+
+        switch (type)
+        {
+                case DFACE:
+                        return (dxf_extents_add_3dface (extents, (Dxf3dface *) entity, transform));
+                case ARC:
+                        return (dxf_extents_add_arc (extents, (DxfArc *) entity, transform));
+                case ATTDEF:
+                        return (dxf_extents_add_attdef (extents, (DxfAttdef *) entity, tables, transform));
+                case ATTRIB:
+                        return (dxf_extents_add_attrib (extents, (DxfAttrib *) entity, tables, transform));
+                case CIRCLE:
+                        return (dxf_extents_add_circle (extents, (DxfCircle *) entity, transform));
+                case DIMENSION:
+                        return (dxf_extents_add_dimension_internal (extents, (DxfDimension *) entity, drawing, tables, spline_mode, transform, depth));
+                case ELLIPSE:
+                        return (dxf_extents_add_ellipse (extents, (DxfEllipse *) entity, transform));
+                case HATCH:
+                        return (dxf_extents_add_hatch (extents, (DxfHatch *) entity, spline_mode, transform));
+                case HELIX:
+                        return (dxf_extents_add_helix (extents, (DxfHelix *) entity, transform));
+                case IMAGE:
+                        return (dxf_extents_add_image (extents, (DxfImage *) entity, transform));
+                case INSERT:
+                        return (dxf_extents_add_insert_internal (extents, (DxfInsert *) entity, drawing, tables, spline_mode, transform, depth));
+                case LEADER:
+                        return (dxf_extents_add_leader (extents, (DxfLeader *) entity, transform));
+                case LINE:
+                        return (dxf_extents_add_line (extents, (DxfLine *) entity, transform));
+                case LWPOLYLINE:
+                        return (dxf_extents_add_lwpolyline (extents, (DxfLWPolyline *) entity, transform));
+                case MTEXT:
+                        return (dxf_extents_add_mtext (extents, (DxfMtext *) entity, transform));
+                case POINT:
+                        return (dxf_extents_add_point_entity (extents, (DxfPoint *) entity, transform));
+                case POLYLINE:
+                        return (dxf_extents_add_polyline (extents, (DxfPolyline *) entity, transform));
+                case SHAPE:
+                        return (dxf_extents_add_shape (extents, (DxfShape *) entity, transform));
+                case SOLID:
+                        return (dxf_extents_add_solid (extents, (DxfSolid *) entity, transform));
+                case SPLINE:
+                        return (dxf_extents_add_spline (extents, (DxfSpline *) entity, spline_mode, transform));
+                case TEXT:
+                        return (dxf_extents_add_text (extents, (DxfText *) entity, tables, transform));
+                case TOLERANCE:
+                        tolerance = (DxfTolerance *) entity;
+                        if (tolerance->p0 != NULL)
+                        {
+                                dxf_extents_add_point (extents, transform,
+                                  tolerance->p0->x0, tolerance->p0->y0,
+                                  tolerance->p0->z0);
+                        }
+                        return (EXIT_SUCCESS);
+                case TRACE:
+                        return (dxf_extents_add_trace (extents, (DxfTrace *) entity, transform));
+                case VIEWPORT:
+                        return (dxf_extents_add_viewport (extents, (DxfViewport *) entity, transform));
+                default:
+                        /* Infinite (RAY, XLINE), ACIS based and other
+                         * entities do not contribute to the extents. */
+                        return (EXIT_SUCCESS);
+        }
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with a single entity of any type.
+ *
+ * Entity types without a bounded geometry (\c RAY, \c XLINE) or with a
+ * geometry this library can not evaluate (\c 3DSOLID, \c BODY,
+ * \c REGION and other proprietary data) are ignored.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_add_entity
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfEntityType type,
+                /*!< the type of the entity. */
+        void *entity,
+                /*!< a pointer to the entity. */
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing with the block
+                 * definitions, or \c NULL. */
+        DxfTables *tables,
+                /*!< a pointer to the symbol tables holding the text
+                 * tables, or \c NULL. */
+        int spline_mode,
+                /*!< \c DXF_EXTENTS_SPLINE_CONTROL_HULL or
+                 * \c DXF_EXTENTS_SPLINE_TIGHT. */
+        DxfTransform *transform
+                /*!< a pointer to a transformation, \c NULL for the
+                 * identity transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int result;
+
+        /* Do some basic checks. */
+        if ((extents == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        result = dxf_extents_add_entity_internal (extents, type, entity,
+          drawing, tables, spline_mode, transform, 0);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with all entities of a \c DxfEntities.
+ */
+static int
+dxf_extents_add_entities_internal
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfEntities *entities,
+                /*!< a pointer to the entities. */
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing with the block
+                 * definitions, or \c NULL. */
+        DxfTables *tables,
+                /*!< a pointer to the symbol tables holding the text
+                 * styles. */
+        int spline_mode,
+                /*!< spline bounding mode. */
+        DxfTransform *transform,
+                /*!< a pointer to a transformation, or \c NULL. */
+        int depth
+                /*!< nesting depth of the block reference. */
+)
+{
+        DxfMline *mline = NULL;
+        void *entity = NULL;
+        int type;
+
+        for (type = UNKNOWN_ENTITY; type <= XLINE; type++)
+        {
+                for (entity = dxf_extents_entities_get_list (entities, (DxfEntityType) type);
+                  entity != NULL;
+                  entity = dxf_extents_entity_get_next ((DxfEntityType) type, entity))
+                {
+                        dxf_extents_add_entity_internal (extents,
+                          (DxfEntityType) type, entity, drawing, tables,
+                          spline_mode, transform, depth);
+                }
+        }
+        /* MLINE has no entity type of its own. */
+        for (mline = (DxfMline *) entities->mline_list; mline != NULL; mline = (DxfMline *) mline->next)
+        {
+                dxf_extents_add_mline (extents, mline, transform);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend a \c DxfExtents with all entities of a \c DxfEntities.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_add_entities
+(
+        DxfExtents *extents,
+                /*!< a pointer to a \c DxfExtents. */
+        DxfEntities *entities,
+                /*!< a pointer to the entities. */
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing with the block
+                 * definitions, or \c NULL. */
+        DxfTables *tables,
+                /*!< a pointer to the symbol tables holding the text
+                 * tables, or \c NULL. */
+        int spline_mode,
+                /*!< \c DXF_EXTENTS_SPLINE_CONTROL_HULL or
+                 * \c DXF_EXTENTS_SPLINE_TIGHT. */
+        DxfTransform *transform
+                /*!< a pointer to a transformation, \c NULL for the
+                 * identity transformation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int result;
+
+        /* Do some basic checks. */
+        if ((extents == NULL) || (entities == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        result = dxf_extents_add_entities_internal (extents, entities,
+          drawing, tables, spline_mode, transform, 0);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Get the first entity of the list of entities of a given type
+ * from a \c DxfEntities.
+ *
+ * \return a pointer to the first entity, or \c NULL when the list is
+ * empty or entities of this type do not contribute to the extents.
+ */
+void *
+dxf_extents_entities_get_list
+(
+        DxfEntities *entities,
+                /*!< a pointer to the entities. */
+        DxfEntityType type
+                /*!< the type of the entities. */
+)
+{
+        if (entities == NULL)
+        {
+                return (NULL);
+        }
+        switch (type)
+        {
+                case DFACE: return ((void *) entities->dface_list);
+                case DSOLID: return ((void *) entities->dsolid_list);
+                case ARC: return ((void *) entities->arc_list);
+                case ATTDEF: return ((void *) entities->attdef_list);
+                case ATTRIB: return ((void *) entities->attrib_list);
+                case BODY: return ((void *) entities->body_list);
+                case CIRCLE: return ((void *) entities->circle_list);
+                case DIMENSION: return ((void *) entities->dimension_list);
+                case ELLIPSE: return ((void *) entities->ellipse_list);
+                case HATCH: return ((void *) entities->hatch_list);
+                case HELIX: return ((void *) entities->helix_list);
+                case IMAGE: return ((void *) entities->image_list);
+                case INSERT: return ((void *) entities->insert_list);
+                case LEADER: return ((void *) entities->leader_list);
+                case LINE: return ((void *) entities->line_list);
+                case LWPOLYLINE: return ((void *) entities->lw_polyline_list);
+                case MTEXT: return ((void *) entities->mtext_list);
+                case POINT: return ((void *) entities->point_list);
+                case POLYLINE: return ((void *) entities->polyline_list);
+                case REGION: return ((void *) entities->region_list);
+                case SHAPE: return ((void *) entities->shape_list);
+                case SOLID: return ((void *) entities->solid_list);
+                case SPLINE: return ((void *) entities->spline_list);
+                case TEXT: return ((void *) entities->text_list);
+                case TOLERANCE: return ((void *) entities->tolerance_list);
+                case TRACE: return ((void *) entities->trace_list);
+                case VIEWPORT: return ((void *) entities->viewport_list);
+                default: return (NULL);
+        }
+}
+
+
+/*!
+ * \brief Get the next entity of an entity of a given type.
+ *
+ * \return a pointer to the next entity, or \c NULL for the last entity
+ * or entities of a type that do not contribute to the extents.
+ */
+void *
+dxf_extents_entity_get_next
+(
+        DxfEntityType type,
+                /*!< the type of the entity. */
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+        if (entity == NULL)
+        {
+                return (NULL);
+        }
+        switch (type)
+        {
+                case DFACE: return ((void *) ((Dxf3dface *) entity)->next);
+                case DSOLID: return ((void *) ((Dxf3dsolid *) entity)->next);
+                case ARC: return ((void *) ((DxfArc *) entity)->next);
+                case ATTDEF: return ((void *) ((DxfAttdef *) entity)->next);
+                case ATTRIB: return ((void *) ((DxfAttrib *) entity)->next);
+                case BODY: return ((void *) ((DxfBody *) entity)->next);
+                case CIRCLE: return ((void *) ((DxfCircle *) entity)->next);
+                case DIMENSION: return ((void *) ((DxfDimension *) entity)->next);
+                case ELLIPSE: return ((void *) ((DxfEllipse *) entity)->next);
+                case HATCH: return ((void *) ((DxfHatch *) entity)->next);
+                case HELIX: return ((void *) ((DxfHelix *) entity)->next);
+                case IMAGE: return ((void *) ((DxfImage *) entity)->next);
+                case INSERT: return ((void *) ((DxfInsert *) entity)->next);
+                case LEADER: return ((void *) ((DxfLeader *) entity)->next);
+                case LINE: return ((void *) ((DxfLine *) entity)->next);
+                case LWPOLYLINE: return ((void *) ((DxfLWPolyline *) entity)->next);
+                case MTEXT: return ((void *) ((DxfMtext *) entity)->next);
+                case POINT: return ((void *) ((DxfPoint *) entity)->next);
+                case POLYLINE: return ((void *) ((DxfPolyline *) entity)->next);
+                case REGION: return ((void *) ((DxfRegion *) entity)->next);
+                case SHAPE: return ((void *) ((DxfShape *) entity)->next);
+                case SOLID: return ((void *) ((DxfSolid *) entity)->next);
+                case SPLINE: return ((void *) ((DxfSpline *) entity)->next);
+                case TEXT: return ((void *) ((DxfText *) entity)->next);
+                case TOLERANCE: return ((void *) ((DxfTolerance *) entity)->next);
+                case TRACE: return ((void *) ((DxfTrace *) entity)->next);
+                case VIEWPORT: return ((void *) ((DxfViewport *) entity)->next);
+                default: return (NULL);
+        }
+}
+
+
+/*!
+ * \brief Get the paperspace flag of an entity of a given type.
+ *
+ * \return \c DXF_PAPERSPACE when the entity is in paper space, 0
+ * (model space) otherwise.
+ */
+int
+dxf_extents_entity_get_paperspace
+(
+        DxfEntityType type,
+                /*!< the type of the entity. */
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+        if (entity == NULL)
+        {
+                return (0);
+        }
+        switch (type)
+        {
+                case DFACE: return (((Dxf3dface *) entity)->paperspace);
+                case DSOLID: return (((Dxf3dsolid *) entity)->paperspace);
+                case ARC: return (((DxfArc *) entity)->paperspace);
+                case ATTDEF: return (((DxfAttdef *) entity)->paperspace);
+                case ATTRIB: return (((DxfAttrib *) entity)->paperspace);
+                case BODY: return (((DxfBody *) entity)->paperspace);
+                case CIRCLE: return (((DxfCircle *) entity)->paperspace);
+                case DIMENSION: return (((DxfDimension *) entity)->paperspace);
+                case ELLIPSE: return (((DxfEllipse *) entity)->paperspace);
+                case HATCH: return (((DxfHatch *) entity)->paperspace);
+                case HELIX: return (((DxfHelix *) entity)->paperspace);
+                case IMAGE: return (((DxfImage *) entity)->paperspace);
+                case INSERT: return (((DxfInsert *) entity)->paperspace);
+                case LEADER: return (((DxfLeader *) entity)->paperspace);
+                case LINE: return (((DxfLine *) entity)->paperspace);
+                case LWPOLYLINE: return (((DxfLWPolyline *) entity)->paperspace);
+                case MTEXT: return (((DxfMtext *) entity)->paperspace);
+                case POINT: return (((DxfPoint *) entity)->paperspace);
+                case POLYLINE: return (((DxfPolyline *) entity)->paperspace);
+                case REGION: return (((DxfRegion *) entity)->paperspace);
+                case SHAPE: return (((DxfShape *) entity)->paperspace);
+                case SOLID: return (((DxfSolid *) entity)->paperspace);
+                case SPLINE: return (((DxfSpline *) entity)->paperspace);
+                case TEXT: return (((DxfText *) entity)->paperspace);
+                case TOLERANCE: return (((DxfTolerance *) entity)->paperspace);
+                case TRACE: return (((DxfTrace *) entity)->paperspace);
+                case VIEWPORT: return (((DxfViewport *) entity)->paperspace);
+                default: return (0);
+        }
+}
+
+
+/* EOF */
@@ -0,0 +1,149 @@
+/*!
+ * \file extents.h
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for libDXF extents (axis aligned bounding box) functions.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_EXTENTS_H
+#define LIBDXF_SRC_EXTENTS_H
+
+
+#include "global.h"
+#include "transform.h"
+#include "entity.h"
+#include "entities.h"
+#include "block.h"
+#include "style.h"
+#include "spline.h"
+#include "helix.h"
+#include "drawing.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_EXTENTS_SPLINE_CONTROL_HULL 0
+        /*!< \brief Bound splines by the box of their control points. */
+#define DXF_EXTENTS_SPLINE_TIGHT 1
+        /*!< \brief Bound splines by the box of a refined control
+         * polygon (knot insertion), closer to the curve itself. */
+#define DXF_EXTENTS_SPLINE_REFINEMENT_PASSES 4
+        /*!< \brief Number of knot insertion passes for
+         * \c DXF_EXTENTS_SPLINE_TIGHT, every pass halves all non-zero
+         * knot spans. */
+#define DXF_EXTENTS_MAX_BLOCK_DEPTH 16
+        /*!< \brief Maximum nesting depth of block references, guards
+         * against cyclic block definitions. */
+#define DXF_EXTENTS_TEXT_CHARACTER_WIDTH 1.0
+        /*!< \brief Estimated width of a character relative to the text
+         * height (no font metrics are available). */
+#define DXF_EXTENTS_TEXT_DESCENT (1.0 / 3.0)
+        /*!< \brief Estimated descent below the baseline relative to
+         * the text height. */
+#define DXF_EXTENTS_MTEXT_LINE_SPACING (5.0 / 3.0)
+        /*!< \brief Default distance between MTEXT lines relative to
+         * the text height. */
+
+
+/*!
+ * \brief Definition of an axis aligned bounding box (extents).
+ *
+ * An empty box contains no points, the first point added sets both
+ * the minimum and the maximum corner.
+ */
+typedef struct
+dxf_extents_struct
+{
+        double x0;
+                /*!< Minimum X-value. */
+        double y0;
+                /*!< Minimum Y-value. */
+        double z0;
+                /*!< Minimum Z-value. */
+        double x1;
+                /*!< Maximum X-value. */
+        double y1;
+                /*!< Maximum Y-value. */
+        double z1;
+                /*!< Maximum Z-value. */
+        int empty;
+                /*!< \c TRUE as long as no point was added. */
+} DxfExtents;
+
+
+DxfExtents *dxf_extents_new ();
+DxfExtents *dxf_extents_init (DxfExtents *extents);
+int dxf_extents_free (DxfExtents *extents);
+int dxf_extents_is_empty (DxfExtents *extents);
+int dxf_extents_add_point (DxfExtents *extents, DxfTransform *transform, double x, double y, double z);
+int dxf_extents_merge (DxfExtents *extents, DxfExtents *other);
+int dxf_extents_add_3dface (DxfExtents *extents, Dxf3dface *face, DxfTransform *transform);
+int dxf_extents_add_arc (DxfExtents *extents, DxfArc *arc, DxfTransform *transform);
+int dxf_extents_add_attdef (DxfExtents *extents, DxfAttdef *attdef, DxfTables *tables, DxfTransform *transform);
+int dxf_extents_add_attrib (DxfExtents *extents, DxfAttrib *attrib, DxfTables *tables, DxfTransform *transform);
+int dxf_extents_add_circle (DxfExtents *extents, DxfCircle *circle, DxfTransform *transform);
+int dxf_extents_add_dimension (DxfExtents *extents, DxfDimension *dimension, DxfDrawing *drawing, DxfTables *tables, int spline_mode, DxfTransform *transform);
+int dxf_extents_add_ellipse (DxfExtents *extents, DxfEllipse *ellipse, DxfTransform *transform);
+int dxf_extents_add_hatch (DxfExtents *extents, DxfHatch *hatch, int spline_mode, DxfTransform *transform);
+int dxf_extents_add_helix (DxfExtents *extents, DxfHelix *helix, DxfTransform *transform);
+int dxf_extents_add_image (DxfExtents *extents, DxfImage *image, DxfTransform *transform);
+int dxf_extents_add_insert (DxfExtents *extents, DxfInsert *insert, DxfDrawing *drawing, DxfTables *tables, int spline_mode, DxfTransform *transform);
+int dxf_extents_add_leader (DxfExtents *extents, DxfLeader *leader, DxfTransform *transform);
+int dxf_extents_add_line (DxfExtents *extents, DxfLine *line, DxfTransform *transform);
+int dxf_extents_add_lwpolyline (DxfExtents *extents, DxfLWPolyline *lwpolyline, DxfTransform *transform);
+int dxf_extents_add_mline (DxfExtents *extents, DxfMline *mline, DxfTransform *transform);
+int dxf_extents_add_mtext (DxfExtents *extents, DxfMtext *mtext, DxfTransform *transform);
+int dxf_extents_add_point_entity (DxfExtents *extents, DxfPoint *point, DxfTransform *transform);
+int dxf_extents_add_polyline (DxfExtents *extents, DxfPolyline *polyline, DxfTransform *transform);
+int dxf_extents_add_shape (DxfExtents *extents, DxfShape *shape, DxfTransform *transform);
+int dxf_extents_add_solid (DxfExtents *extents, DxfSolid *solid, DxfTransform *transform);
+int dxf_extents_add_spline (DxfExtents *extents, DxfSpline *spline, int spline_mode, DxfTransform *transform);
+int dxf_extents_add_text (DxfExtents *extents, DxfText *text, DxfTables *tables, DxfTransform *transform);
+int dxf_extents_add_trace (DxfExtents *extents, DxfTrace *trace, DxfTransform *transform);
+int dxf_extents_add_viewport (DxfExtents *extents, DxfViewport *viewport, DxfTransform *transform);
+int dxf_extents_add_entity (DxfExtents *extents, DxfEntityType type, void *entity, DxfDrawing *drawing, DxfTables *tables, int spline_mode, DxfTransform *transform);
+int dxf_extents_add_entities (DxfExtents *extents, DxfEntities *entities, DxfDrawing *drawing, DxfTables *tables, int spline_mode, DxfTransform *transform);
+void *dxf_extents_entities_get_list (DxfEntities *entities, DxfEntityType type);
+void *dxf_extents_entity_get_next (DxfEntityType type, void *entity);
+int dxf_extents_entity_get_paperspace (DxfEntityType type, void *entity);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_EXTENTS_H */
+
+
+/* EOF */
@@ -38,37 +38,42 @@
 
 
 #include "file.h"
-
-
-char *dxf_entities_list;
-char *dxf_objects_list;
-char *dxf_blocks_list;
-DxfThumbnail *dxf_thumbnail;
+#include "drawing.h"
+#include "readahead.h"
 
 
 /*!
- * \brief Function opens and reads a DXF file.
- * 
- * After opening the DXF file with the name \c filename the file is read
- * line by line until a line containing the \c SECTION keyword is
- * encountered.\n
+ * \brief Function reads a DXF file from an opened DXF file handle.
+ *
+ * The file is read line by line until a line containing the \c SECTION
+ * keyword is encountered.\n
  * At this point a function which reads the \c SECTION until the
- * \c ENDSEC keyword is encountered and the invoked fuction returns here.
+ * \c ENDSEC keyword is encountered and the invoked fuction returns here.\n
+ * All parsed data is stored in \c drawing, no global state is used,
+ * different files can be read concurrently from multiple threads.\n
+ * When statistics are attached to \c fp with dxf_file_set_stats () they
+ * are updated while reading.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
  */
 int
-dxf_file_read
+dxf_file_read_drawing_from
 (
-        char *filename
-                /*!< filename of input file (or device). */
+        DxfFile *fp,
+                /*!< DXF file handle of input file (or device), as
+                 * returned by dxf_read_init (). */
+        DxfDrawing *drawing
+                /*!< a pointer to the libDXF drawing receiving the
+                 * parsed data. */
 )
 {
         char temp_string[DXF_MAX_STRING_LENGTH];
-        DxfFile *fp;
+        int result;
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        /* open the file */
-        fp = dxf_read_init (filename);
+        /* Do some basic checks. */
         if (fp == NULL)
         {
                 fprintf (stderr,
@@ -76,11 +81,22 @@ dxf_file_read
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        while (fp)
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        DXF_TRACE_BEGIN (DXF_TRACING_FILE, "dxf_file_read_drawing_from");
+        result = EXIT_SUCCESS;
+        /* Group codes are right aligned by most writers, libDXF
+         * included, skip the leading spaces before comparing. */
+        while (!feof (fp->fp))
         {
                 memset(temp_string, 0, sizeof(temp_string));
                 dxf_read_line (temp_string, fp);
-                if (strcmp (temp_string, "999") == 0)
+                if (strcmp (temp_string + strspn (temp_string, " "), "999") == 0)
                 {
                         /* Flush dxf comments to stdout as some apps put meta
                          * data regarding the correct loading of libraries in
@@ -89,7 +105,7 @@ dxf_file_read
                         dxf_read_line (temp_string, fp);
                         fprintf (stdout, "DXF comment: %s\n", temp_string);
                 }
-                else if (strcmp (temp_string, "0") == 0)
+                else if (strcmp (temp_string + strspn (temp_string, " "), "0") == 0)
                 {
                 /* Now follows some meaningfull dxf data. */
                         while (!feof (fp->fp))
@@ -99,7 +115,7 @@ dxf_file_read
                                 {
                                          /* We have found the beginning of a
                                           * SECTION. */
-                                        dxf_section_read (fp);
+                                        dxf_section_read (fp, drawing);
                                 }
                                 else
                                 {
@@ -116,58 +132,204 @@ dxf_file_read
                         fprintf (stderr,
                           (_("Warning: unexpected string encountered while reading line %d from: %s.\n")),
                           fp->line_number , fp->filename);
-                        return (EXIT_FAILURE);
+                        result = EXIT_FAILURE;
+                        break;
                 }
         }
+        if (ferror (fp->fp))
+        {
+                /* A read error, e.g. truncated compressed data, ends
+                 * the loop above as the end of the file. */
+                result = EXIT_FAILURE;
+        }
+        if (fp->stats != NULL)
+        {
+                fp->stats->bytes_read = (int64_t) ftell (fp->fp);
+                fp->stats->lines_read = fp->line_number;
+        }
+        if (result == EXIT_SUCCESS)
+        {
+                dxf_drawing_scan_handles (drawing);
+        }
+        DXF_TRACE_END (DXF_TRACING_FILE, "dxf_file_read_drawing_from");
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Function opens and reads a DXF file.
+ *
+ * After opening the DXF file with the name \c filename the file is read
+ * with dxf_file_read_drawing_from () and closed.\n
+ * All parsed data is stored in \c drawing, no global state is used,
+ * different files can be read concurrently from multiple threads.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_file_read_drawing
+(
+        char *filename,
+                /*!< filename of input file (or device). */
+        DxfDrawing *drawing
+                /*!< a pointer to the libDXF drawing receiving the
+                 * parsed data. */
+)
+{
+        DxfFile *fp;
+        int result;
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        /* open the file */
+        fp = dxf_read_init (filename);
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        result = dxf_file_read_drawing_from (fp, drawing);
         dxf_read_close (fp);
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (EXIT_SUCCESS);
+        return (result);
+}
+
+
+/*!
+ * \brief Function opens and reads a DXF file.
+ *
+ * The file is parsed into a temporary libDXF drawing which is freed
+ * afterwards, use \c dxf_file_read_drawing() to keep the parsed data.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_file_read
+(
+        char *filename
+                /*!< filename of input file (or device). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDrawing *drawing = NULL;
+        int result;
+
+        drawing = dxf_drawing_new ();
+        if (drawing == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        result = dxf_file_read_drawing (filename, drawing);
+        dxf_drawing_free (drawing);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
 }
 
 
 /*!
  * \brief Function generates dxf output to a file for a complete DXF file.
+ *
+ * All data is taken from \c drawing, no global state is used,
+ * different files can be written concurrently from multiple threads.\n
+ * Missing and duplicate handles are replaced with new handles from the
+ * handle allocator of \c drawing and \c $HANDSEED is updated before
+ * the output starts.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
  */
 int
 dxf_file_write
 (
         DxfFile *fp,
                 /*!< file pointer to output file (or device). */
-        DxfHeader dxf_header,
-                /*!< a dxf header. */
-        DxfClass dxf_classes_list,
-                /*!< pointer to a list of CLASSES. */
-        DxfTable dxf_tables_list
-                /*!< pointer to a list of TABLES. */
+        DxfDrawing *drawing
+                /*!< a pointer to the libDXF drawing to be written. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        extern char *dxf_entities_list;
-        extern char *dxf_objects_list;
-//        DxfBlock *dxf_blocks_list;
-        extern DxfThumbnail *dxf_thumbnail;
+        int64_t start = 0;
+        long offset = -1;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-//        dxf_header_init (dxf_header);
-//        dxf_header_write (fp, dxf_header);
-//        dxf_write_classes (fp, dxf_classes_list);
-//        dxf_write_tables (fp, dxf_tables_list);
-//        dxf_block_write_table (fp, dxf_blocks_list);
-//        dxf_entities_write_table (fp, dxf_entities_list);
-//        dxf_object_write_objects (fp, dxf_objects_list);
-//        dxf_thumbnail_write (fp, dxf_thumbnail);
-//        dxf_file_write_eof (fp);
+        if (drawing == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_handle_allocator_use (&drawing->handles, fp->last_id_code);
+        if (dxf_drawing_assign_handles (drawing) < 0)
+        {
+                return (EXIT_FAILURE);
+        }
+        fp->last_id_code = dxf_handle_allocator_get_last (&drawing->handles);
+        DXF_TRACE_BEGIN (DXF_TRACING_FILE, "dxf_file_write");
+        if (fp->stats != NULL)
+        {
+                start = dxf_stats_now ();
+                offset = ftell (fp->fp);
+        }
+        if (drawing->header != NULL)
+        {
+                dxf_header_write (fp, (DxfHeader *) drawing->header);
+        }
+        /*! \todo Write the \c CLASSES section. */
+        if (drawing->tables_list != NULL)
+        {
+                dxf_tables_write (fp, (DxfTables *) drawing->tables_list);
+        }
+        dxf_block_write_table (fp, (DxfBlock *) drawing->block_list);
+        dxf_entities_write_table (fp, (DxfEntities *) drawing->entities_list);
+        dxf_object_write_objects (fp, (DxfObject *) drawing->object_list);
+        if (drawing->thumbnail != NULL)
+        {
+                dxf_thumbnail_write (fp, (DxfThumbnail *) drawing->thumbnail);
+        }
+        dxf_file_write_eof (fp);
+        if (fp->stats != NULL)
+        {
+                fp->stats->write_nanoseconds += dxf_stats_now () - start;
+                if (offset >= 0)
+                {
+                        fp->stats->bytes_written += (int64_t) (ftell (fp->fp) - offset);
+                }
+        }
+        DXF_TRACE_END (DXF_TRACING_FILE, "dxf_file_write");
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -205,4 +367,211 @@ dxf_file_write_eof
 }
 
 
+/*!
+ * \brief Attach statistics to a DXF file handle.
+ *
+ * While statistics are attached the readers and writers using \c fp
+ * update the counters of \c stats, the counters are not reset.\n
+ * The statistics remain owned by the caller, pass \c NULL to stop
+ * collecting statistics.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_file_set_stats
+(
+        DxfFile *fp,
+                /*!< DXF file handle of an input or output file (or
+                 * device). */
+        DxfStats *stats
+                /*!< a pointer to a \c DxfStats, or \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        fp->stats = stats;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the statistics attached to a DXF file handle.
+ *
+ * \return a pointer to the statistics, or \c NULL when no statistics
+ * are collected.
+ */
+DxfStats *
+dxf_file_get_stats
+(
+        DxfFile *fp
+                /*!< DXF file handle of an input or output file (or
+                 * device). */
+)
+{
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        return (fp->stats);
+}
+
+
+/*!
+ * \brief Set the handling of ACIS proprietary data while reading from
+ * a DXF file handle.
+ *
+ * The proprietary data of \c 3DSOLID, \c BODY, \c REGION and
+ * \c SURFACE entities is kept in a \c DxfAcis, see acis.h.\n
+ * With \c DXF_ACIS_DEFER only the byte range of the data is recorded
+ * while reading, the data is loaded from the file when requested with
+ * dxf_acis_get_sat ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_file_set_acis_mode
+(
+        DxfFile *fp,
+                /*!< DXF file handle of an input file (or device). */
+        DxfAcisMode acis_mode
+                /*!< handling of ACIS proprietary data. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((acis_mode < DXF_ACIS_LOAD) || (acis_mode > DXF_ACIS_SKIP))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an invalid ACIS mode was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        fp->acis_mode = acis_mode;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Set the function invoked for every entity read from the
+ * \c ENTITIES section of a DXF file handle.
+ *
+ * The function is invoked after the entity is parsed, with the
+ * \c VERTEX entities of a \c POLYLINE entity attached.\n
+ * When the function returns \c TRUE it takes over the entity and
+ * frees it, otherwise the entity is appended to the drawing.\n
+ * Pass \c NULL as \c callback to remove the function.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_file_set_entity_callback
+(
+        DxfFile *fp,
+                /*!< DXF file handle of an input file (or device). */
+        DxfEntityCallback callback,
+                /*!< function invoked for every entity, or \c NULL. */
+        void *data
+                /*!< data passed to \c callback. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        fp->entity_callback = callback;
+        fp->entity_callback_data = data;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read a DXF file handle through a background I/O thread.
+ *
+ * The stream of \c fp is replaced with a read-ahead stream, see
+ * dxf_readahead_open (), so the next buffers of the file are read
+ * while the current one is parsed.\n
+ * Call this function after dxf_read_init () and before reading,
+ * dxf_read_close () stops the I/O thread.\n
+ * When read-ahead is not available the file is read as before.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred or read-ahead is not available.
+ */
+int
+dxf_file_set_read_ahead
+(
+        DxfFile *fp,
+                /*!< DXF file handle of an input file (or device). */
+        int number_of_buffers,
+                /*!< number of buffers, 0 for the default. */
+        size_t buffer_size
+                /*!< size of every buffer, 0 for the default. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        FILE *stream = NULL;
+
+        /* Do some basic checks. */
+        if ((fp == NULL) || (fp->fp == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        stream = dxf_readahead_open (fp->fp, number_of_buffers, buffer_size);
+        if (stream == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        fp->fp = stream;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /* EOF */
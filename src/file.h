@@ -47,6 +47,7 @@
 #include "header.h"
 #include "object.h"
 #include "section.h"
+#include "stats.h"
 #include "table.h"
 #include "thumbnail.h"
 #include "util.h"
@@ -57,9 +58,20 @@ extern "C" {
 #endif
 
 
+struct dxf_drawing_struct;
+        /*!< \brief Forward declaration of a libDXF drawing (drawing.h). */
+
+
 int dxf_file_read (char *filename);
-int dxf_file_write (DxfFile *fp, DxfHeader dxf_header, DxfClass dxf_classes_list, DxfTable dxf_tables_list);
+int dxf_file_read_drawing_from (DxfFile *fp, struct dxf_drawing_struct *drawing);
+int dxf_file_read_drawing (char *filename, struct dxf_drawing_struct *drawing);
+int dxf_file_write (DxfFile *fp, struct dxf_drawing_struct *drawing);
 int dxf_file_write_eof (DxfFile *fp);
+int dxf_file_set_stats (DxfFile *fp, DxfStats *stats);
+DxfStats *dxf_file_get_stats (DxfFile *fp);
+int dxf_file_set_acis_mode (DxfFile *fp, DxfAcisMode acis_mode);
+int dxf_file_set_entity_callback (DxfFile *fp, DxfEntityCallback callback, void *data);
+int dxf_file_set_read_ahead (DxfFile *fp, int number_of_buffers, size_t buffer_size);
 
 
 #ifdef __cplusplus
@@ -0,0 +1,1275 @@
+/*!
+ * \file flatten.c
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for libDXF curve flattening.
+ *
+ * Curved entities are approximated by polylines which deviate at most a
+ * given tolerance (the sagitta of every segment) from the curve.
+ * The points are written to a buffer provided by the caller (X, Y and Z
+ * for every point), no memory is allocated per curve or per point.
+ * Pass a \c NULL buffer to obtain the number of points needed.
+ *
+ * Arcs are divided in segments with a fixed angular step of 2 pi / N,
+ * where N only depends on the radius and the tolerance.
+ * The sine and cosine values of these steps are kept in tables per N,
+ * so most points are found without evaluating a trigonometric function.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <pthread.h>
+
+#include "flatten.h"
+#include "transform.h"
+
+
+static double *dxf_flatten_tables[DXF_FLATTEN_MAX_TABLE_SEGMENTS / 4 + 1];
+        /*!< Sine and cosine tables, indexed by the number of segments
+         * divided by 4.\n
+         * Allocated from the C library and not with the allocator hooks,
+         * the tables are shared by all callers. */
+
+static pthread_mutex_t dxf_flatten_tables_mutex = PTHREAD_MUTEX_INITIALIZER;
+        /*!< Mutex protecting the creation of tables. */
+
+
+/*!
+ * \brief Get the table of cosine and sine values of the angles
+ * \f$ 2 \pi j / N \f$ for \f$ j = 0 \ldots N \f$.
+ *
+ * Tables are created on first use and shared by all threads.
+ *
+ * \return a pointer to the table (cosine, sine, cosine, ...) or \c NULL
+ * when no table is available for \c number_of_segments.
+ */
+static const double *
+dxf_flatten_get_table
+(
+        int number_of_segments
+)
+{
+        static const double cosines[5] = {1.0, 0.0, -1.0, 0.0, 1.0};
+        double *table = NULL;
+        int quadrant;
+        int index;
+        int j;
+
+        if ((number_of_segments > DXF_FLATTEN_MAX_TABLE_SEGMENTS)
+          || (number_of_segments % 4 != 0))
+        {
+                return (NULL);
+        }
+        index = number_of_segments / 4;
+        table = __atomic_load_n (&dxf_flatten_tables[index], __ATOMIC_ACQUIRE);
+        if (table != NULL)
+        {
+                return (table);
+        }
+        pthread_mutex_lock (&dxf_flatten_tables_mutex);
+        table = dxf_flatten_tables[index];
+        if (table == NULL)
+        {
+                table = malloc (2 * (number_of_segments + 1) * sizeof (double));
+                if (table != NULL)
+                {
+                        for (j = 0; j <= number_of_segments; j++)
+                        {
+                                table[2 * j] = cos (2.0 * M_PI * j / number_of_segments);
+                                table[2 * j + 1] = sin (2.0 * M_PI * j / number_of_segments);
+                        }
+                        /* Exact values at the quadrant points. */
+                        for (quadrant = 0; quadrant <= 4; quadrant++)
+                        {
+                                j = quadrant * number_of_segments / 4;
+                                table[2 * j] = cosines[quadrant];
+                                table[2 * j + 1] = cosines[(quadrant + 3) % 4];
+                        }
+                        __atomic_store_n (&dxf_flatten_tables[index], table, __ATOMIC_RELEASE);
+                }
+        }
+        pthread_mutex_unlock (&dxf_flatten_tables_mutex);
+        return (table);
+}
+
+
+/*!
+ * \brief Flatten a conic section
+ * \f$ P(t) = C + U \cos t + V \sin t \f$ from \c start over \c sweep
+ * radians.
+ *
+ * \return the number of points, the points are only written when
+ * \c points is not \c NULL.
+ */
+static size_t
+dxf_flatten_conic
+(
+        const double *c,
+                /*!< center point. */
+        const double *u,
+                /*!< first axis (at t = 0). */
+        const double *v,
+                /*!< second axis (at t = pi / 2). */
+        double radius,
+                /*!< largest radius of the conic. */
+        double start,
+                /*!< start parameter (radians). */
+        double sweep,
+                /*!< swept parameter range (radians), larger than 0.0. */
+        int direction,
+                /*!< 1 for increasing, -1 for decreasing parameters. */
+        double tolerance,
+                /*!< chord tolerance. */
+        double *points
+                /*!< output buffer, or \c NULL. */
+)
+{
+        const double *table = NULL;
+        double su[3];
+        double sv[3];
+        double cs;
+        double sn;
+        double step;
+        size_t number_of_steps;
+        size_t j;
+        int number_of_segments;
+        int i;
+
+        number_of_segments = dxf_flatten_get_number_of_segments (radius, tolerance);
+        step = 2.0 * M_PI / number_of_segments;
+        number_of_steps = (size_t) ceil (sweep / step - 1.0E-6);
+        if (number_of_steps < 1)
+        {
+                number_of_steps = 1;
+        }
+        if (points == NULL)
+        {
+                return (number_of_steps + 1);
+        }
+        /* Rotate the axes to the start parameter, the points are then
+         * found at multiples of the step. */
+        cs = cos (start);
+        sn = sin (start);
+        for (i = 0; i < 3; i++)
+        {
+                su[i] = u[i] * cs + v[i] * sn;
+                sv[i] = direction * (v[i] * cs - u[i] * sn);
+        }
+        table = dxf_flatten_get_table (number_of_segments);
+        for (j = 0; j <= number_of_steps; j++)
+        {
+                if (j == number_of_steps)
+                {
+                        cs = cos (sweep);
+                        sn = sin (sweep);
+                }
+                else if (table != NULL)
+                {
+                        cs = table[2 * (j % number_of_segments)];
+                        sn = table[2 * (j % number_of_segments) + 1];
+                }
+                else
+                {
+                        cs = cos (j * step);
+                        sn = sin (j * step);
+                }
+                for (i = 0; i < 3; i++)
+                {
+                        points[3 * j + i] = c[i] + su[i] * cs + sv[i] * sn;
+                }
+        }
+        return (number_of_steps + 1);
+}
+
+
+/*!
+ * \brief Flatten a (bulged) polyline segment in the OCS.
+ *
+ * \return the number of points including the start and end point, the
+ * points are only written when \c points is not \c NULL.
+ */
+static size_t
+dxf_flatten_segment
+(
+        double xs,
+        double ys,
+        double xe,
+        double ye,
+        double z,
+        double bulge,
+        double tolerance,
+        double *points
+)
+{
+        double c[3];
+        double u[3];
+        double v[3];
+        double dx;
+        double dy;
+        double d;
+        double h;
+        double r;
+        size_t n;
+
+        dx = xe - xs;
+        dy = ye - ys;
+        d = sqrt (dx * dx + dy * dy);
+        if ((bulge == 0.0) || (d == 0.0))
+        {
+                if (points != NULL)
+                {
+                        points[0] = xs;
+                        points[1] = ys;
+                        points[2] = z;
+                        points[3] = xe;
+                        points[4] = ye;
+                        points[5] = z;
+                }
+                return (2);
+        }
+        /* Signed distance from the chord mid point to the center, along
+         * the left hand normal of the chord. */
+        h = d * (1.0 - bulge * bulge) / (4.0 * bulge);
+        r = d * (1.0 + bulge * bulge) / (4.0 * fabs (bulge));
+        c[0] = (xs + xe) / 2.0 - dy / d * h;
+        c[1] = (ys + ye) / 2.0 + dx / d * h;
+        c[2] = z;
+        u[0] = r;
+        u[1] = 0.0;
+        u[2] = 0.0;
+        v[0] = 0.0;
+        v[1] = r;
+        v[2] = 0.0;
+        n = dxf_flatten_conic (c, u, v, r, atan2 (ys - c[1], xs - c[0]),
+          4.0 * atan (fabs (bulge)), (bulge > 0.0) ? 1 : -1, tolerance,
+          points);
+        if (points != NULL)
+        {
+                /* Exact end points. */
+                points[0] = xs;
+                points[1] = ys;
+                points[3 * n - 3] = xe;
+                points[3 * n - 2] = ye;
+        }
+        return (n);
+}
+
+
+/*!
+ * \brief Flatten a list of (bulged) vertices in the OCS.
+ *
+ * \return the number of points, the points are only written when
+ * \c points is not \c NULL.
+ */
+static size_t
+dxf_flatten_vertices
+(
+        DxfVertex *vertices,
+        int closed,
+        double z,
+        double tolerance,
+        double *points
+)
+{
+        DxfVertex *first = NULL;
+        DxfVertex *vertex = NULL;
+        DxfVertex *next = NULL;
+        size_t total;
+        size_t n;
+
+        first = vertices;
+        while ((first != NULL) && (first->p0 == NULL))
+        {
+                first = (DxfVertex *) first->next;
+        }
+        if (first == NULL)
+        {
+                return (0);
+        }
+        total = 0;
+        for (vertex = first; vertex != NULL; vertex = next)
+        {
+                next = (DxfVertex *) vertex->next;
+                while ((next != NULL) && (next->p0 == NULL))
+                {
+                        next = (DxfVertex *) next->next;
+                }
+                if ((next == NULL) && (!closed || (vertex == first)))
+                {
+                        break;
+                }
+                /* Every segment starts on the end point of the
+                 * previous segment. */
+                n = dxf_flatten_segment (vertex->p0->x0, vertex->p0->y0,
+                  (next != NULL) ? next->p0->x0 : first->p0->x0,
+                  (next != NULL) ? next->p0->y0 : first->p0->y0, z,
+                  vertex->bulge, tolerance,
+                  (points != NULL) ? points + 3 * ((total > 0) ? total - 1 : 0) : NULL);
+                total = (total > 0) ? total + n - 1 : n;
+        }
+        if (total == 0)
+        {
+                /* A single vertex. */
+                if (points != NULL)
+                {
+                        points[0] = first->p0->x0;
+                        points[1] = first->p0->y0;
+                        points[2] = z;
+                }
+                total = 1;
+        }
+        return (total);
+}
+
+
+/*!
+ * \brief Check the output buffer of a flattening function.
+ *
+ * \return \c TRUE when the points are to be written, \c FALSE when the
+ * caller only asked for the number of points.
+ */
+static int
+dxf_flatten_check_buffer
+(
+        const char *function,
+        double *points,
+        size_t max_number_of_points,
+        size_t required,
+        size_t *number_of_points,
+        int *result
+)
+{
+        *number_of_points = required;
+        *result = EXIT_SUCCESS;
+        if (points == NULL)
+        {
+                return (FALSE);
+        }
+        if (max_number_of_points < required)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the buffer is too small.\n")),
+                  function);
+                *result = EXIT_FAILURE;
+                return (FALSE);
+        }
+        return (TRUE);
+}
+
+
+/* dxf_flatten functions. */
+
+/*!
+ * \brief Get the number of segments in which a full circle is divided.
+ *
+ * The number of segments is the smallest multiple of 4 for which the
+ * sagitta of a segment does not exceed \c tolerance, limited to the
+ * range \c DXF_FLATTEN_MIN_SEGMENTS to \c DXF_FLATTEN_MAX_SEGMENTS.
+ *
+ * \return the number of segments.
+ */
+int
+dxf_flatten_get_number_of_segments
+(
+        double radius,
+                /*!< radius of the circle. */
+        double tolerance
+                /*!< chord tolerance. */
+)
+{
+        double n;
+
+        radius = fabs (radius);
+        if (!(tolerance > 0.0) || (tolerance >= radius))
+        {
+                return ((tolerance > 0.0) || (radius == 0.0)
+                  ? DXF_FLATTEN_MIN_SEGMENTS : DXF_FLATTEN_MAX_SEGMENTS);
+        }
+        n = ceil (M_PI / acos (1.0 - tolerance / radius));
+        if (n > DXF_FLATTEN_MAX_SEGMENTS)
+        {
+                return (DXF_FLATTEN_MAX_SEGMENTS);
+        }
+        n = 4.0 * ceil (n / 4.0);
+        return ((n < DXF_FLATTEN_MIN_SEGMENTS) ? DXF_FLATTEN_MIN_SEGMENTS : (int) n);
+}
+
+
+/*!
+ * \brief Free the tables of sine and cosine values.
+ *
+ * Tables are created again when needed.
+ *
+ * \warning Do not call this function while curves are being flattened
+ * in other threads.
+ *
+ * \return \c EXIT_SUCCESS when done.
+ */
+int
+dxf_flatten_free_tables ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        size_t i;
+
+        pthread_mutex_lock (&dxf_flatten_tables_mutex);
+        for (i = 0; i < sizeof (dxf_flatten_tables) / sizeof (dxf_flatten_tables[0]); i++)
+        {
+                free (dxf_flatten_tables[i]);
+                dxf_flatten_tables[i] = NULL;
+        }
+        pthread_mutex_unlock (&dxf_flatten_tables_mutex);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Flatten a (bulged) polyline segment.
+ *
+ * The bulge is the tangent of 1/4 of the included angle of the arc
+ * segment, negative if the arc goes clockwise from the start point to
+ * the end point, a bulge of 0.0 denotes a straight segment.\n
+ * The points (including the start and end point) are in the Object
+ * Coordinate System (OCS) of the polyline.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_flatten_bulge
+(
+        double x0,
+                /*!< X-value of the start point. */
+        double y0,
+                /*!< Y-value of the start point. */
+        double x1,
+                /*!< X-value of the end point. */
+        double y1,
+                /*!< Y-value of the end point. */
+        double bulge,
+                /*!< bulge of the segment. */
+        double z,
+                /*!< Z-value (elevation) of the segment. */
+        double tolerance,
+                /*!< chord tolerance. */
+        double *points,
+                /*!< buffer receiving the points (X, Y and Z for every
+                 * point), or \c NULL to get the number of points. */
+        size_t max_number_of_points,
+                /*!< number of points \c points can hold. */
+        size_t *number_of_points
+                /*!< receives the number of points. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int result;
+
+        /* Do some basic checks. */
+        if (number_of_points == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_flatten_check_buffer (__FUNCTION__, points,
+          max_number_of_points,
+          dxf_flatten_segment (x0, y0, x1, y1, z, bulge, tolerance, NULL),
+          number_of_points, &result))
+        {
+                dxf_flatten_segment (x0, y0, x1, y1, z, bulge, tolerance, points);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Flatten a DXF \c ARC entity.
+ *
+ * The points are in the World Coordinate System (WCS), running counter
+ * clockwise (about the extrusion direction) from the start angle to
+ * the end angle.\n
+ * An arc with equal start and end angles yields a single point.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_flatten_arc
+(
+        DxfArc *arc,
+                /*!< a pointer to a DXF \c ARC entity. */
+        double tolerance,
+                /*!< chord tolerance. */
+        double *points,
+                /*!< buffer receiving the points (X, Y and Z for every
+                 * point), or \c NULL to get the number of points. */
+        size_t max_number_of_points,
+                /*!< number of points \c points can hold. */
+        size_t *number_of_points
+                /*!< receives the number of points. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTransform ocs;
+        double c[3];
+        double u[3];
+        double v[3];
+        double start;
+        double sweep;
+        size_t n;
+        int result;
+
+        /* Do some basic checks. */
+        if ((arc == NULL) || (number_of_points == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (arc->p0 == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        c[0] = arc->p0->x0;
+        c[1] = arc->p0->y0;
+        c[2] = arc->p0->z0;
+        u[0] = arc->radius;
+        u[1] = 0.0;
+        u[2] = 0.0;
+        v[0] = 0.0;
+        v[1] = arc->radius;
+        v[2] = 0.0;
+        start = arc->start_angle * M_PI / 180.0;
+        sweep = fmod (arc->end_angle - arc->start_angle, 360.0);
+        if (sweep < 0.0)
+        {
+                sweep += 360.0;
+        }
+        sweep *= M_PI / 180.0;
+        n = (sweep == 0.0) ? 1
+          : dxf_flatten_conic (c, u, v, arc->radius, start, sweep, 1, tolerance, NULL);
+        if (dxf_flatten_check_buffer (__FUNCTION__, points,
+          max_number_of_points, n, number_of_points, &result))
+        {
+                if (sweep == 0.0)
+                {
+                        points[0] = c[0] + arc->radius * cos (start);
+                        points[1] = c[1] + arc->radius * sin (start);
+                        points[2] = c[2];
+                }
+                else
+                {
+                        dxf_flatten_conic (c, u, v, arc->radius, start,
+                          sweep, 1, tolerance, points);
+                }
+                dxf_transform_init (&ocs);
+                dxf_transform_ocs (&ocs, arc->extr_x0, arc->extr_y0, arc->extr_z0);
+                dxf_transform_apply_points (&ocs, points, n);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Flatten a DXF \c CIRCLE entity.
+ *
+ * The points are in the World Coordinate System (WCS), starting at an
+ * angle of 0.0 and running counter clockwise, the last point repeats
+ * the first point.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_flatten_circle
+(
+        DxfCircle *circle,
+                /*!< a pointer to a DXF \c CIRCLE entity. */
+        double tolerance,
+                /*!< chord tolerance. */
+        double *points,
+                /*!< buffer receiving the points (X, Y and Z for every
+                 * point), or \c NULL to get the number of points. */
+        size_t max_number_of_points,
+                /*!< number of points \c points can hold. */
+        size_t *number_of_points
+                /*!< receives the number of points. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTransform ocs;
+        double c[3];
+        double u[3];
+        double v[3];
+        size_t n;
+        int result;
+
+        /* Do some basic checks. */
+        if ((circle == NULL) || (number_of_points == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (circle->p0 == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        c[0] = circle->p0->x0;
+        c[1] = circle->p0->y0;
+        c[2] = circle->p0->z0;
+        u[0] = circle->radius;
+        u[1] = 0.0;
+        u[2] = 0.0;
+        v[0] = 0.0;
+        v[1] = circle->radius;
+        v[2] = 0.0;
+        n = dxf_flatten_conic (c, u, v, circle->radius, 0.0, 2.0 * M_PI,
+          1, tolerance, NULL);
+        if (dxf_flatten_check_buffer (__FUNCTION__, points,
+          max_number_of_points, n, number_of_points, &result))
+        {
+                dxf_flatten_conic (c, u, v, circle->radius, 0.0,
+                  2.0 * M_PI, 1, tolerance, points);
+                dxf_transform_init (&ocs);
+                dxf_transform_ocs (&ocs, circle->extr_x0, circle->extr_y0, circle->extr_z0);
+                dxf_transform_apply_points (&ocs, points, n);
+                /* Close the polyline exactly. */
+                memcpy (points + 3 * (n - 1), points, 3 * sizeof (double));
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Flatten a DXF \c ELLIPSE entity.
+ *
+ * The points are in the World Coordinate System (WCS), running from the
+ * start parameter to the end parameter.\n
+ * The number of segments is based on the major radius.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_flatten_ellipse
+(
+        DxfEllipse *ellipse,
+                /*!< a pointer to a DXF \c ELLIPSE entity. */
+        double tolerance,
+                /*!< chord tolerance. */
+        double *points,
+                /*!< buffer receiving the points (X, Y and Z for every
+                 * point), or \c NULL to get the number of points. */
+        size_t max_number_of_points,
+                /*!< number of points \c points can hold. */
+        size_t *number_of_points
+                /*!< receives the number of points. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double c[3];
+        double u[3];
+        double v[3];
+        double n[3];
+        double length;
+        double radius;
+        double sweep;
+        size_t count;
+        int result;
+
+        /* Do some basic checks. */
+        if ((ellipse == NULL) || (number_of_points == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((ellipse->p0 == NULL) || (ellipse->p1 == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        c[0] = ellipse->p0->x0;
+        c[1] = ellipse->p0->y0;
+        c[2] = ellipse->p0->z0;
+        /* Endpoint of the major axis, relative to the center. */
+        u[0] = ellipse->p1->x0;
+        u[1] = ellipse->p1->y0;
+        u[2] = ellipse->p1->z0;
+        n[0] = ellipse->extr_x0;
+        n[1] = ellipse->extr_y0;
+        n[2] = ellipse->extr_z0;
+        if ((n[0] == 0.0) && (n[1] == 0.0) && (n[2] == 0.0))
+        {
+                n[2] = 1.0;
+        }
+        /* Minor axis: ratio * |major| * (N x major) / |N x major|. */
+        v[0] = n[1] * u[2] - n[2] * u[1];
+        v[1] = n[2] * u[0] - n[0] * u[2];
+        v[2] = n[0] * u[1] - n[1] * u[0];
+        radius = sqrt (u[0] * u[0] + u[1] * u[1] + u[2] * u[2]);
+        length = sqrt (v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+        length = (length > 0.0) ? radius * ellipse->ratio / length : 0.0;
+        v[0] *= length;
+        v[1] *= length;
+        v[2] *= length;
+        sweep = fmod (ellipse->end_angle - ellipse->start_angle, 2.0 * M_PI);
+        if (sweep <= 0.0)
+        {
+                sweep += 2.0 * M_PI;
+        }
+        count = dxf_flatten_conic (c, u, v, radius, ellipse->start_angle,
+          sweep, 1, tolerance, NULL);
+        if (dxf_flatten_check_buffer (__FUNCTION__, points,
+          max_number_of_points, count, number_of_points, &result))
+        {
+                dxf_flatten_conic (c, u, v, radius, ellipse->start_angle,
+                  sweep, 1, tolerance, points);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Flatten a DXF \c HELIX entity.
+ *
+ * The helix starts at the start point and turns about the axis (from
+ * the axis base point along the axis vector), counter clockwise for a
+ * right handed helix and clockwise for a left handed helix.\n
+ * The radius changes linearly from the distance of the start point to
+ * the axis (the base radius) to the radius of the helix (the top
+ * radius) over the height of \c number_of_turns * \c turn_height.\n
+ * The points are in the World Coordinate System (WCS), the number of
+ * segments per turn is based on the largest radius.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_flatten_helix
+(
+        DxfHelix *helix,
+                /*!< a pointer to a DXF \c HELIX entity. */
+        double tolerance,
+                /*!< chord tolerance. */
+        double *points,
+                /*!< buffer receiving the points (X, Y and Z for every
+                 * point), or \c NULL to get the number of points. */
+        size_t max_number_of_points,
+                /*!< number of points \c points can hold. */
+        size_t *number_of_points
+                /*!< receives the number of points. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const double *table = NULL;
+        double ax[3];
+        double ay[3];
+        double az[3];
+        double s[3];
+        double base_radius;
+        double top_radius;
+        double radius;
+        double height;
+        double total;
+        double step;
+        double phi;
+        double cs;
+        double sn;
+        double d;
+        size_t number_of_steps;
+        size_t j;
+        int number_of_segments;
+        int handedness;
+        int result;
+        int i;
+
+        /* Do some basic checks. */
+        if ((helix == NULL) || (number_of_points == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((helix->p0 == NULL) || (helix->p1 == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (helix->p2 != NULL)
+        {
+                dxf_transform_ocs_axes (helix->p2->x0, helix->p2->y0,
+                  helix->p2->z0, ax, ay, az);
+        }
+        else
+        {
+                dxf_transform_ocs_axes (0.0, 0.0, 1.0, ax, ay, az);
+        }
+        /* The start point, projected onto the base plane, sets the start
+         * direction and the base radius. */
+        s[0] = helix->p1->x0 - helix->p0->x0;
+        s[1] = helix->p1->y0 - helix->p0->y0;
+        s[2] = helix->p1->z0 - helix->p0->z0;
+        d = s[0] * az[0] + s[1] * az[1] + s[2] * az[2];
+        for (i = 0; i < 3; i++)
+        {
+                s[i] -= d * az[i];
+        }
+        base_radius = sqrt (s[0] * s[0] + s[1] * s[1] + s[2] * s[2]);
+        top_radius = (helix->radius > 0.0) ? helix->radius : base_radius;
+        if (base_radius > 0.0)
+        {
+                for (i = 0; i < 3; i++)
+                {
+                        ax[i] = s[i] / base_radius;
+                }
+                ay[0] = az[1] * ax[2] - az[2] * ax[1];
+                ay[1] = az[2] * ax[0] - az[0] * ax[2];
+                ay[2] = az[0] * ax[1] - az[1] * ax[0];
+        }
+        handedness = helix->handedness ? 1 : -1;
+        height = helix->number_of_turns * helix->turn_height;
+        total = 2.0 * M_PI * fabs (helix->number_of_turns);
+        number_of_segments = dxf_flatten_get_number_of_segments (
+          fmax (base_radius, top_radius), tolerance);
+        step = 2.0 * M_PI / number_of_segments;
+        number_of_steps = (total > 0.0)
+          ? (size_t) ceil (total / step - 1.0E-6) : 0;
+        if (dxf_flatten_check_buffer (__FUNCTION__, points,
+          max_number_of_points, number_of_steps + 1, number_of_points,
+          &result))
+        {
+                table = dxf_flatten_get_table (number_of_segments);
+                for (j = 0; j <= number_of_steps; j++)
+                {
+                        phi = (j == number_of_steps) ? total : j * step;
+                        if ((j < number_of_steps) && (table != NULL))
+                        {
+                                cs = table[2 * (j % number_of_segments)];
+                                sn = table[2 * (j % number_of_segments) + 1];
+                        }
+                        else
+                        {
+                                cs = cos (phi);
+                                sn = sin (phi);
+                        }
+                        d = (total > 0.0) ? phi / total : 0.0;
+                        radius = base_radius + (top_radius - base_radius) * d;
+                        for (i = 0; i < 3; i++)
+                        {
+                                points[3 * j + i] = ((i == 0) ? helix->p0->x0
+                                  : ((i == 1) ? helix->p0->y0 : helix->p0->z0))
+                                  + radius * (ax[i] * cs + handedness * ay[i] * sn)
+                                  + az[i] * height * d;
+                        }
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Flatten a DXF \c LWPOLYLINE entity.
+ *
+ * Arc segments (bulges) are flattened, straight segments are kept.\n
+ * The points are in the World Coordinate System (WCS), a closed
+ * polyline ends with its first point.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_flatten_lwpolyline
+(
+        DxfLWPolyline *lwpolyline,
+                /*!< a pointer to a DXF \c LWPOLYLINE entity. */
+        double tolerance,
+                /*!< chord tolerance. */
+        double *points,
+                /*!< buffer receiving the points (X, Y and Z for every
+                 * point), or \c NULL to get the number of points. */
+        size_t max_number_of_points,
+                /*!< number of points \c points can hold. */
+        size_t *number_of_points
+                /*!< receives the number of points. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTransform ocs;
+        size_t n;
+        int result;
+
+        /* Do some basic checks. */
+        if ((lwpolyline == NULL) || (number_of_points == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        n = dxf_flatten_vertices ((DxfVertex *) lwpolyline->vertices,
+          (lwpolyline->flag & 1), lwpolyline->elevation, tolerance, NULL);
+        if (dxf_flatten_check_buffer (__FUNCTION__, points,
+          max_number_of_points, n, number_of_points, &result))
+        {
+                dxf_flatten_vertices ((DxfVertex *) lwpolyline->vertices,
+                  (lwpolyline->flag & 1), lwpolyline->elevation, tolerance,
+                  points);
+                dxf_transform_init (&ocs);
+                dxf_transform_ocs (&ocs, lwpolyline->extr_x0,
+                  lwpolyline->extr_y0, lwpolyline->extr_z0);
+                dxf_transform_apply_points (&ocs, points, n);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Flatten a DXF \c POLYLINE entity.
+ *
+ * Arc segments (bulges) of a 2D polyline are flattened, straight
+ * segments are kept, the vertices of a 3D polyline are copied.\n
+ * The points are in the World Coordinate System (WCS), a closed
+ * polyline ends with its first point.\n
+ * Polygon meshes and polyface meshes can not be flattened.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_flatten_polyline
+(
+        DxfPolyline *polyline,
+                /*!< a pointer to a DXF \c POLYLINE entity. */
+        double tolerance,
+                /*!< chord tolerance. */
+        double *points,
+                /*!< buffer receiving the points (X, Y and Z for every
+                 * point), or \c NULL to get the number of points. */
+        size_t max_number_of_points,
+                /*!< number of points \c points can hold. */
+        size_t *number_of_points
+                /*!< receives the number of points. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTransform ocs;
+        DxfVertex *vertex = NULL;
+        DxfVertex *first = NULL;
+        double z;
+        size_t n;
+        int result;
+
+        /* Do some basic checks. */
+        if ((polyline == NULL) || (number_of_points == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (polyline->flag & (16 | 64))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a mesh can not be flattened.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (polyline->flag & 8)
+        {
+                /* 3D polyline. */
+                n = 0;
+                for (vertex = polyline->vertices; vertex != NULL; vertex = (DxfVertex *) vertex->next)
+                {
+                        if (vertex->p0 != NULL)
+                        {
+                                if (first == NULL)
+                                {
+                                        first = vertex;
+                                }
+                                n++;
+                        }
+                }
+                if ((polyline->flag & 1) && (n > 1))
+                {
+                        n++;
+                }
+                if (dxf_flatten_check_buffer (__FUNCTION__, points,
+                  max_number_of_points, n, number_of_points, &result))
+                {
+                        n = 0;
+                        for (vertex = first; vertex != NULL; vertex = (DxfVertex *) vertex->next)
+                        {
+                                if (vertex->p0 != NULL)
+                                {
+                                        points[3 * n] = vertex->p0->x0;
+                                        points[3 * n + 1] = vertex->p0->y0;
+                                        points[3 * n + 2] = vertex->p0->z0;
+                                        n++;
+                                }
+                        }
+                        if (n < *number_of_points)
+                        {
+                                memcpy (points + 3 * n, points, 3 * sizeof (double));
+                        }
+                }
+#if DEBUG
+                DXF_DEBUG_END
+#endif
+                return (result);
+        }
+        z = (polyline->p0 != NULL) ? polyline->p0->z0 : polyline->elevation;
+        n = dxf_flatten_vertices (polyline->vertices, (polyline->flag & 1),
+          z, tolerance, NULL);
+        if (dxf_flatten_check_buffer (__FUNCTION__, points,
+          max_number_of_points, n, number_of_points, &result))
+        {
+                dxf_flatten_vertices (polyline->vertices,
+                  (polyline->flag & 1), z, tolerance, points);
+                dxf_transform_init (&ocs);
+                dxf_transform_ocs (&ocs, polyline->extr_x0,
+                  polyline->extr_y0, polyline->extr_z0);
+                dxf_transform_apply_points (&ocs, points, n);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Flatten a DXF \c HATCH boundary path edge arc.
+ *
+ * The points are in the Object Coordinate System (OCS) of the hatch with
+ * a Z-value of 0.0, running in the direction of the arc.\n
+ * Clockwise arcs store mirrored (negated) angles.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_flatten_hatch_edge_arc
+(
+        DxfHatchBoundaryPathEdgeArc *arc,
+                /*!< a pointer to a DXF \c HATCH boundary path edge
+                 * arc. */
+        double tolerance,
+                /*!< chord tolerance. */
+        double *points,
+                /*!< buffer receiving the points (X, Y and Z for every
+                 * point), or \c NULL to get the number of points. */
+        size_t max_number_of_points,
+                /*!< number of points \c points can hold. */
+        size_t *number_of_points
+                /*!< receives the number of points. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double c[3];
+        double u[3];
+        double v[3];
+        double sweep;
+        size_t n;
+        int result;
+
+        /* Do some basic checks. */
+        if ((arc == NULL) || (number_of_points == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        c[0] = arc->x0;
+        c[1] = arc->y0;
+        c[2] = 0.0;
+        u[0] = arc->radius;
+        u[1] = 0.0;
+        u[2] = 0.0;
+        v[0] = 0.0;
+        v[1] = arc->radius;
+        v[2] = 0.0;
+        sweep = fmod (arc->end_angle - arc->start_angle, 360.0);
+        if (sweep <= 0.0)
+        {
+                sweep += 360.0;
+        }
+        sweep *= M_PI / 180.0;
+        n = dxf_flatten_conic (c, u, v, arc->radius,
+          (arc->is_ccw ? 1 : -1) * arc->start_angle * M_PI / 180.0, sweep,
+          arc->is_ccw ? 1 : -1, tolerance, NULL);
+        if (dxf_flatten_check_buffer (__FUNCTION__, points,
+          max_number_of_points, n, number_of_points, &result))
+        {
+                dxf_flatten_conic (c, u, v, arc->radius,
+                  (arc->is_ccw ? 1 : -1) * arc->start_angle * M_PI / 180.0,
+                  sweep, arc->is_ccw ? 1 : -1, tolerance, points);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Flatten a DXF \c HATCH boundary path edge ellipse.
+ *
+ * The points are in the Object Coordinate System (OCS) of the hatch with
+ * a Z-value of 0.0, running in the direction of the elliptical arc.\n
+ * Clockwise elliptical arcs store mirrored (negated) angles.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_flatten_hatch_edge_ellipse
+(
+        DxfHatchBoundaryPathEdgeEllipse *ellipse,
+                /*!< a pointer to a DXF \c HATCH boundary path edge
+                 * ellipse. */
+        double tolerance,
+                /*!< chord tolerance. */
+        double *points,
+                /*!< buffer receiving the points (X, Y and Z for every
+                 * point), or \c NULL to get the number of points. */
+        size_t max_number_of_points,
+                /*!< number of points \c points can hold. */
+        size_t *number_of_points
+                /*!< receives the number of points. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double c[3];
+        double u[3];
+        double v[3];
+        double radius;
+        double sweep;
+        size_t n;
+        int result;
+
+        /* Do some basic checks. */
+        if ((ellipse == NULL) || (number_of_points == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        c[0] = ellipse->x0;
+        c[1] = ellipse->y0;
+        c[2] = 0.0;
+        /* Endpoint of the major axis, relative to the center. */
+        u[0] = ellipse->x1;
+        u[1] = ellipse->y1;
+        u[2] = 0.0;
+        v[0] = -ellipse->y1 * ellipse->ratio;
+        v[1] = ellipse->x1 * ellipse->ratio;
+        v[2] = 0.0;
+        radius = sqrt (u[0] * u[0] + u[1] * u[1]);
+        sweep = fmod (ellipse->end_angle - ellipse->start_angle, 360.0);
+        if (sweep <= 0.0)
+        {
+                sweep += 360.0;
+        }
+        sweep *= M_PI / 180.0;
+        n = dxf_flatten_conic (c, u, v, radius,
+          (ellipse->is_ccw ? 1 : -1) * ellipse->start_angle * M_PI / 180.0,
+          sweep, ellipse->is_ccw ? 1 : -1, tolerance, NULL);
+        if (dxf_flatten_check_buffer (__FUNCTION__, points,
+          max_number_of_points, n, number_of_points, &result))
+        {
+                dxf_flatten_conic (c, u, v, radius,
+                  (ellipse->is_ccw ? 1 : -1) * ellipse->start_angle * M_PI / 180.0,
+                  sweep, ellipse->is_ccw ? 1 : -1, tolerance, points);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/* EOF */
@@ -0,0 +1,89 @@
+/*!
+ * \file flatten.h
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for libDXF curve flattening.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_FLATTEN_H
+#define LIBDXF_SRC_FLATTEN_H
+
+
+#include "global.h"
+#include "arc.h"
+#include "circle.h"
+#include "ellipse.h"
+#include "hatch.h"
+#include "helix.h"
+#include "lwpolyline.h"
+#include "polyline.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_FLATTEN_MIN_SEGMENTS 4
+        /*!< \brief Minimum number of segments for a full circle. */
+
+#define DXF_FLATTEN_MAX_SEGMENTS 65536
+        /*!< \brief Maximum number of segments for a full circle. */
+
+#define DXF_FLATTEN_MAX_TABLE_SEGMENTS 1024
+        /*!< \brief Largest number of segments for a full circle with a
+         * precomputed table of sine and cosine values.
+         *
+         * Finer subdivisions evaluate \c sin() and \c cos() for every
+         * point. */
+
+
+int dxf_flatten_get_number_of_segments (double radius, double tolerance);
+int dxf_flatten_free_tables ();
+int dxf_flatten_bulge (double x0, double y0, double x1, double y1, double bulge, double z, double tolerance, double *points, size_t max_number_of_points, size_t *number_of_points);
+int dxf_flatten_arc (DxfArc *arc, double tolerance, double *points, size_t max_number_of_points, size_t *number_of_points);
+int dxf_flatten_circle (DxfCircle *circle, double tolerance, double *points, size_t max_number_of_points, size_t *number_of_points);
+int dxf_flatten_ellipse (DxfEllipse *ellipse, double tolerance, double *points, size_t max_number_of_points, size_t *number_of_points);
+int dxf_flatten_helix (DxfHelix *helix, double tolerance, double *points, size_t max_number_of_points, size_t *number_of_points);
+int dxf_flatten_lwpolyline (DxfLWPolyline *lwpolyline, double tolerance, double *points, size_t max_number_of_points, size_t *number_of_points);
+int dxf_flatten_polyline (DxfPolyline *polyline, double tolerance, double *points, size_t max_number_of_points, size_t *number_of_points);
+int dxf_flatten_hatch_edge_arc (DxfHatchBoundaryPathEdgeArc *arc, double tolerance, double *points, size_t max_number_of_points, size_t *number_of_points);
+int dxf_flatten_hatch_edge_ellipse (DxfHatchBoundaryPathEdgeEllipse *ellipse, double tolerance, double *points, size_t max_number_of_points, size_t *number_of_points);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_FLATTEN_H */
+
+
+/* EOF */
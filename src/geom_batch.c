@@ -0,0 +1,1217 @@
+/*!
+ * \file geom_batch.c
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for libDXF batch geometry predicates.
+ *
+ * These functions test many points (or segments) against a single
+ * circle, arc, line segment or box in one call.
+ * The coordinates are passed as separate contiguous arrays (structure
+ * of arrays), which allows the kernels to use SIMD instructions:
+ * AVX2 when the processor supports it at run time, SSE2 when the
+ * compiler targets it, and plain C otherwise.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "geom_batch.h"
+
+#include <math.h>
+#include <pthread.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#if defined (__GNUC__) && (defined (__x86_64__) || defined (__i386__))
+#include <immintrin.h>
+#define DXF_GEOM_BATCH_HAVE_AVX2 1
+#define DXF_GEOM_BATCH_TARGET_AVX2 __attribute__ ((target ("avx2")))
+#endif
+
+
+#ifdef DXF_GEOM_BATCH_HAVE_AVX2
+/*!
+ * \brief \c TRUE when the processor supports AVX2, set once by
+ * dxf_geom_batch_detect_avx2 ().
+ */
+static int dxf_geom_batch_avx2 = FALSE;
+static pthread_once_t dxf_geom_batch_avx2_once = PTHREAD_ONCE_INIT;
+
+
+/*!
+ * \brief Detect if the processor supports AVX2.
+ */
+static void
+dxf_geom_batch_detect_avx2 (void)
+{
+        __builtin_cpu_init ();
+        dxf_geom_batch_avx2 = __builtin_cpu_supports ("avx2") ? TRUE : FALSE;
+}
+#endif
+
+
+/*!
+ * \brief Test (once) if the processor supports AVX2.
+ *
+ * The test runs with pthread_once (), so concurrent first calls are
+ * safe.
+ */
+static int
+dxf_geom_batch_have_avx2 ()
+{
+#ifdef DXF_GEOM_BATCH_HAVE_AVX2
+        pthread_once (&dxf_geom_batch_avx2_once, dxf_geom_batch_detect_avx2);
+        return (dxf_geom_batch_avx2);
+#else
+        return (FALSE);
+#endif
+}
+
+
+/*!
+ * \brief Classify a squared distance against a squared radius.
+ *
+ * Same semantics as \c dxf_circle_test_point_in_circle().
+ */
+static int
+dxf_geom_batch_classify
+(
+        int less,
+                /*!< \c TRUE when the squared distance is less than the
+                 * squared radius. */
+        int greater
+                /*!< \c TRUE when the squared distance is greater than
+                 * the squared radius. */
+)
+{
+        if (less)
+        {
+                return (INSIDE);
+        }
+        else if (greater)
+        {
+                return (OUTSIDE);
+        }
+        else
+        {
+                return (ON_EDGE);
+        }
+}
+
+
+/* Point in circle kernels. */
+
+#ifdef DXF_GEOM_BATCH_HAVE_AVX2
+/*!
+ * \brief Test if points are inside a circle, four points at a time with
+ * AVX2.
+ *
+ * \return the index of the first of the remaining points, which the
+ * caller processes one at a time.
+ */
+DXF_GEOM_BATCH_TARGET_AVX2
+static size_t
+dxf_geom_batch_points_in_circle_avx2
+(
+        const double *x,
+                /*!< array with the X-values of the points. */
+        const double *y,
+                /*!< array with the Y-values of the points. */
+        size_t i,
+                /*!< index of the first point to process. */
+        size_t n,
+                /*!< number of points in the arrays. */
+        double center_x,
+                /*!< X-value of the center point of the circle. */
+        double center_y,
+                /*!< Y-value of the center point of the circle. */
+        double radius,
+                /*!< radius of the circle. */
+        int *results
+                /*!< array receiving \c INSIDE, \c OUTSIDE or
+                 * \c ON_EDGE for each point. */
+)
+{
+        __m256d cx = _mm256_set1_pd (center_x);
+        __m256d cy = _mm256_set1_pd (center_y);
+        __m256d r2 = _mm256_set1_pd (radius * radius);
+        __m256d dx;
+        __m256d dy;
+        __m256d d2;
+        int lt;
+        int gt;
+        int k;
+
+        for (; i + 4 <= n; i += 4)
+        {
+                dx = _mm256_sub_pd (_mm256_loadu_pd (x + i), cx);
+                dy = _mm256_sub_pd (_mm256_loadu_pd (y + i), cy);
+                d2 = _mm256_add_pd (_mm256_mul_pd (dx, dx), _mm256_mul_pd (dy, dy));
+                lt = _mm256_movemask_pd (_mm256_cmp_pd (d2, r2, _CMP_LT_OQ));
+                gt = _mm256_movemask_pd (_mm256_cmp_pd (d2, r2, _CMP_GT_OQ));
+                for (k = 0; k < 4; k++)
+                {
+                        results[i + k] = dxf_geom_batch_classify
+                          ((lt >> k) & 1, (gt >> k) & 1);
+                }
+        }
+        return (i);
+}
+#endif
+
+
+#ifdef __SSE2__
+/*!
+ * \brief Test if points are inside a circle, two points at a time with
+ * SSE2.
+ *
+ * \return the index of the first of the remaining points, which the
+ * caller processes one at a time.
+ */
+static size_t
+dxf_geom_batch_points_in_circle_sse2
+(
+        const double *x,
+                /*!< array with the X-values of the points. */
+        const double *y,
+                /*!< array with the Y-values of the points. */
+        size_t i,
+                /*!< index of the first point to process. */
+        size_t n,
+                /*!< number of points in the arrays. */
+        double center_x,
+                /*!< X-value of the center point of the circle. */
+        double center_y,
+                /*!< Y-value of the center point of the circle. */
+        double radius,
+                /*!< radius of the circle. */
+        int *results
+                /*!< array receiving \c INSIDE, \c OUTSIDE or
+                 * \c ON_EDGE for each point. */
+)
+{
+        __m128d cx = _mm_set1_pd (center_x);
+        __m128d cy = _mm_set1_pd (center_y);
+        __m128d r2 = _mm_set1_pd (radius * radius);
+        __m128d dx;
+        __m128d dy;
+        __m128d d2;
+        int lt;
+        int gt;
+
+        for (; i + 2 <= n; i += 2)
+        {
+                dx = _mm_sub_pd (_mm_loadu_pd (x + i), cx);
+                dy = _mm_sub_pd (_mm_loadu_pd (y + i), cy);
+                d2 = _mm_add_pd (_mm_mul_pd (dx, dx), _mm_mul_pd (dy, dy));
+                lt = _mm_movemask_pd (_mm_cmplt_pd (d2, r2));
+                gt = _mm_movemask_pd (_mm_cmpgt_pd (d2, r2));
+                results[i] = dxf_geom_batch_classify (lt & 1, gt & 1);
+                results[i + 1] = dxf_geom_batch_classify ((lt >> 1) & 1, (gt >> 1) & 1);
+        }
+        return (i);
+}
+#endif
+
+
+/* Point on arc kernels. */
+
+/*!
+ * \brief Precomputed data for the point on arc kernels.
+ *
+ * A vector \f$ v \f$ from the center lies within the angular range of
+ * the arc when \f$ s \times v \geq 0 \f$ and \f$ v \times e \geq 0 \f$
+ * (arcs up to 180 degrees), or when either of them holds (larger arcs),
+ * with \f$ s \f$ and \f$ e \f$ the unit vectors at the start and end
+ * angle.
+ */
+typedef struct
+dxf_geom_batch_arc_struct
+{
+        double cx;
+                /*!< X-value of the center point. */
+        double cy;
+                /*!< Y-value of the center point. */
+        double radius;
+                /*!< radius. */
+        double tolerance;
+                /*!< maximum distance of a point to the arc. */
+        double sx;
+                /*!< X-value of the unit vector at the start angle. */
+        double sy;
+                /*!< Y-value of the unit vector at the start angle. */
+        double ex;
+                /*!< X-value of the unit vector at the end angle. */
+        double ey;
+                /*!< Y-value of the unit vector at the end angle. */
+        int mode;
+                /*!< 0 = full circle, 1 = up to 180 degrees,
+                 * 2 = more than 180 degrees. */
+} DxfGeomBatchArc;
+
+
+/*!
+ * \brief Test if a single point is on an arc.
+ *
+ * \return \c TRUE when the point is on the arc, \c FALSE otherwise.
+ */
+static int
+dxf_geom_batch_arc_test
+(
+        const DxfGeomBatchArc *arc,
+                /*!< precomputed data of the arc. */
+        double x,
+                /*!< X-value of the point. */
+        double y
+                /*!< Y-value of the point. */
+)
+{
+        double vx = x - arc->cx;
+        double vy = y - arc->cy;
+        int angular;
+        int radial;
+
+        radial = fabs (sqrt (vx * vx + vy * vy) - arc->radius) <= arc->tolerance;
+        if (arc->mode == 0)
+        {
+                angular = TRUE;
+        }
+        else if (arc->mode == 1)
+        {
+                angular = ((arc->sx * vy - arc->sy * vx) >= 0.0)
+                  && ((vx * arc->ey - vy * arc->ex) >= 0.0);
+        }
+        else
+        {
+                angular = ((arc->sx * vy - arc->sy * vx) >= 0.0)
+                  || ((vx * arc->ey - vy * arc->ex) >= 0.0);
+        }
+        return ((radial && angular) ? TRUE : FALSE);
+}
+
+
+#ifdef DXF_GEOM_BATCH_HAVE_AVX2
+/*!
+ * \brief Test if points are on an arc, four points at a time with AVX2.
+ *
+ * \return the index of the first of the remaining points, which the
+ * caller processes one at a time.
+ */
+DXF_GEOM_BATCH_TARGET_AVX2
+static size_t
+dxf_geom_batch_points_on_arc_avx2
+(
+        const double *x,
+                /*!< array with the X-values of the points. */
+        const double *y,
+                /*!< array with the Y-values of the points. */
+        size_t i,
+                /*!< index of the first point to process. */
+        size_t n,
+                /*!< number of points in the arrays. */
+        const DxfGeomBatchArc *arc,
+                /*!< precomputed data of the arc. */
+        int *results
+                /*!< array receiving \c TRUE or \c FALSE for each
+                 * point. */
+)
+{
+        __m256d cx = _mm256_set1_pd (arc->cx);
+        __m256d cy = _mm256_set1_pd (arc->cy);
+        __m256d r = _mm256_set1_pd (arc->radius);
+        __m256d tol = _mm256_set1_pd (arc->tolerance);
+        __m256d sx = _mm256_set1_pd (arc->sx);
+        __m256d sy = _mm256_set1_pd (arc->sy);
+        __m256d ex = _mm256_set1_pd (arc->ex);
+        __m256d ey = _mm256_set1_pd (arc->ey);
+        __m256d zero = _mm256_setzero_pd ();
+        __m256d sign = _mm256_set1_pd (-0.0);
+        __m256d vx;
+        __m256d vy;
+        __m256d d;
+        __m256d cs;
+        __m256d ce;
+        __m256d mask;
+        int bits;
+        int k;
+
+        for (; i + 4 <= n; i += 4)
+        {
+                vx = _mm256_sub_pd (_mm256_loadu_pd (x + i), cx);
+                vy = _mm256_sub_pd (_mm256_loadu_pd (y + i), cy);
+                d = _mm256_sqrt_pd (_mm256_add_pd (_mm256_mul_pd (vx, vx), _mm256_mul_pd (vy, vy)));
+                d = _mm256_andnot_pd (sign, _mm256_sub_pd (d, r));
+                mask = _mm256_cmp_pd (d, tol, _CMP_LE_OQ);
+                if (arc->mode != 0)
+                {
+                        cs = _mm256_sub_pd (_mm256_mul_pd (sx, vy), _mm256_mul_pd (sy, vx));
+                        ce = _mm256_sub_pd (_mm256_mul_pd (vx, ey), _mm256_mul_pd (vy, ex));
+                        cs = _mm256_cmp_pd (cs, zero, _CMP_GE_OQ);
+                        ce = _mm256_cmp_pd (ce, zero, _CMP_GE_OQ);
+                        if (arc->mode == 1)
+                        {
+                                mask = _mm256_and_pd (mask, _mm256_and_pd (cs, ce));
+                        }
+                        else
+                        {
+                                mask = _mm256_and_pd (mask, _mm256_or_pd (cs, ce));
+                        }
+                }
+                bits = _mm256_movemask_pd (mask);
+                for (k = 0; k < 4; k++)
+                {
+                        results[i + k] = (bits >> k) & 1;
+                }
+        }
+        return (i);
+}
+#endif
+
+
+#ifdef __SSE2__
+/*!
+ * \brief Test if points are on an arc, two points at a time with SSE2.
+ *
+ * \return the index of the first of the remaining points, which the
+ * caller processes one at a time.
+ */
+static size_t
+dxf_geom_batch_points_on_arc_sse2
+(
+        const double *x,
+                /*!< array with the X-values of the points. */
+        const double *y,
+                /*!< array with the Y-values of the points. */
+        size_t i,
+                /*!< index of the first point to process. */
+        size_t n,
+                /*!< number of points in the arrays. */
+        const DxfGeomBatchArc *arc,
+                /*!< precomputed data of the arc. */
+        int *results
+                /*!< array receiving \c TRUE or \c FALSE for each
+                 * point. */
+)
+{
+        __m128d cx = _mm_set1_pd (arc->cx);
+        __m128d cy = _mm_set1_pd (arc->cy);
+        __m128d r = _mm_set1_pd (arc->radius);
+        __m128d tol = _mm_set1_pd (arc->tolerance);
+        __m128d sx = _mm_set1_pd (arc->sx);
+        __m128d sy = _mm_set1_pd (arc->sy);
+        __m128d ex = _mm_set1_pd (arc->ex);
+        __m128d ey = _mm_set1_pd (arc->ey);
+        __m128d zero = _mm_setzero_pd ();
+        __m128d sign = _mm_set1_pd (-0.0);
+        __m128d vx;
+        __m128d vy;
+        __m128d d;
+        __m128d cs;
+        __m128d ce;
+        __m128d mask;
+        int bits;
+
+        for (; i + 2 <= n; i += 2)
+        {
+                vx = _mm_sub_pd (_mm_loadu_pd (x + i), cx);
+                vy = _mm_sub_pd (_mm_loadu_pd (y + i), cy);
+                d = _mm_sqrt_pd (_mm_add_pd (_mm_mul_pd (vx, vx), _mm_mul_pd (vy, vy)));
+                d = _mm_andnot_pd (sign, _mm_sub_pd (d, r));
+                mask = _mm_cmple_pd (d, tol);
+                if (arc->mode != 0)
+                {
+                        cs = _mm_sub_pd (_mm_mul_pd (sx, vy), _mm_mul_pd (sy, vx));
+                        ce = _mm_sub_pd (_mm_mul_pd (vx, ey), _mm_mul_pd (vy, ex));
+                        cs = _mm_cmpge_pd (cs, zero);
+                        ce = _mm_cmpge_pd (ce, zero);
+                        if (arc->mode == 1)
+                        {
+                                mask = _mm_and_pd (mask, _mm_and_pd (cs, ce));
+                        }
+                        else
+                        {
+                                mask = _mm_and_pd (mask, _mm_or_pd (cs, ce));
+                        }
+                }
+                bits = _mm_movemask_pd (mask);
+                results[i] = bits & 1;
+                results[i + 1] = (bits >> 1) & 1;
+        }
+        return (i);
+}
+#endif
+
+
+/* Point to segment distance kernels. */
+
+#ifdef DXF_GEOM_BATCH_HAVE_AVX2
+/*!
+ * \brief Compute the distances of points to a line segment, four points
+ * at a time with AVX2.
+ *
+ * \return the index of the first of the remaining points, which the
+ * caller processes one at a time.
+ */
+DXF_GEOM_BATCH_TARGET_AVX2
+static size_t
+dxf_geom_batch_points_segment_distance_avx2
+(
+        const double *x,
+                /*!< array with the X-values of the points. */
+        const double *y,
+                /*!< array with the Y-values of the points. */
+        size_t i,
+                /*!< index of the first point to process. */
+        size_t n,
+                /*!< number of points in the arrays. */
+        double x0,
+                /*!< X-value of the start point of the segment. */
+        double y0,
+                /*!< Y-value of the start point of the segment. */
+        double dx,
+                /*!< X-value of the direction of the segment. */
+        double dy,
+                /*!< Y-value of the direction of the segment. */
+        double inverse_length2,
+                /*!< inverse of the squared length of the segment, 0.0
+                 * for a segment of zero length. */
+        double *distances
+                /*!< array receiving the distance of each point to the
+                 * segment. */
+)
+{
+        __m256d ax = _mm256_set1_pd (x0);
+        __m256d ay = _mm256_set1_pd (y0);
+        __m256d bx = _mm256_set1_pd (dx);
+        __m256d by = _mm256_set1_pd (dy);
+        __m256d il2 = _mm256_set1_pd (inverse_length2);
+        __m256d zero = _mm256_setzero_pd ();
+        __m256d one = _mm256_set1_pd (1.0);
+        __m256d px;
+        __m256d py;
+        __m256d t;
+
+        for (; i + 4 <= n; i += 4)
+        {
+                px = _mm256_sub_pd (_mm256_loadu_pd (x + i), ax);
+                py = _mm256_sub_pd (_mm256_loadu_pd (y + i), ay);
+                t = _mm256_mul_pd (_mm256_add_pd (_mm256_mul_pd (px, bx), _mm256_mul_pd (py, by)), il2);
+                t = _mm256_min_pd (_mm256_max_pd (t, zero), one);
+                px = _mm256_sub_pd (px, _mm256_mul_pd (t, bx));
+                py = _mm256_sub_pd (py, _mm256_mul_pd (t, by));
+                _mm256_storeu_pd (distances + i,
+                  _mm256_sqrt_pd (_mm256_add_pd (_mm256_mul_pd (px, px), _mm256_mul_pd (py, py))));
+        }
+        return (i);
+}
+#endif
+
+
+#ifdef __SSE2__
+/*!
+ * \brief Compute the distances of points to a line segment, two points
+ * at a time with SSE2.
+ *
+ * \return the index of the first of the remaining points, which the
+ * caller processes one at a time.
+ */
+static size_t
+dxf_geom_batch_points_segment_distance_sse2
+(
+        const double *x,
+                /*!< array with the X-values of the points. */
+        const double *y,
+                /*!< array with the Y-values of the points. */
+        size_t i,
+                /*!< index of the first point to process. */
+        size_t n,
+                /*!< number of points in the arrays. */
+        double x0,
+                /*!< X-value of the start point of the segment. */
+        double y0,
+                /*!< Y-value of the start point of the segment. */
+        double dx,
+                /*!< X-value of the direction of the segment. */
+        double dy,
+                /*!< Y-value of the direction of the segment. */
+        double inverse_length2,
+                /*!< inverse of the squared length of the segment, 0.0
+                 * for a segment of zero length. */
+        double *distances
+                /*!< array receiving the distance of each point to the
+                 * segment. */
+)
+{
+        __m128d ax = _mm_set1_pd (x0);
+        __m128d ay = _mm_set1_pd (y0);
+        __m128d bx = _mm_set1_pd (dx);
+        __m128d by = _mm_set1_pd (dy);
+        __m128d il2 = _mm_set1_pd (inverse_length2);
+        __m128d zero = _mm_setzero_pd ();
+        __m128d one = _mm_set1_pd (1.0);
+        __m128d px;
+        __m128d py;
+        __m128d t;
+
+        for (; i + 2 <= n; i += 2)
+        {
+                px = _mm_sub_pd (_mm_loadu_pd (x + i), ax);
+                py = _mm_sub_pd (_mm_loadu_pd (y + i), ay);
+                t = _mm_mul_pd (_mm_add_pd (_mm_mul_pd (px, bx), _mm_mul_pd (py, by)), il2);
+                t = _mm_min_pd (_mm_max_pd (t, zero), one);
+                px = _mm_sub_pd (px, _mm_mul_pd (t, bx));
+                py = _mm_sub_pd (py, _mm_mul_pd (t, by));
+                _mm_storeu_pd (distances + i,
+                  _mm_sqrt_pd (_mm_add_pd (_mm_mul_pd (px, px), _mm_mul_pd (py, py))));
+        }
+        return (i);
+}
+#endif
+
+
+/* Segment versus box kernels. */
+
+/*!
+ * \brief Test a single segment against a box.
+ *
+ * The segment overlaps the box when the bounding boxes overlap and the
+ * four corners of the box are not all strictly on the same side of the
+ * line through the segment (separating axis test).
+ */
+static int
+dxf_geom_batch_segment_overlap_box
+(
+        double x0,
+                /*!< X-value of the start point of the segment. */
+        double y0,
+                /*!< Y-value of the start point of the segment. */
+        double x1,
+                /*!< X-value of the end point of the segment. */
+        double y1,
+                /*!< Y-value of the end point of the segment. */
+        double min_x,
+                /*!< minimum X-value of the box. */
+        double min_y,
+                /*!< minimum Y-value of the box. */
+        double max_x,
+                /*!< maximum X-value of the box. */
+        double max_y
+                /*!< maximum Y-value of the box. */
+)
+{
+        double dx = x1 - x0;
+        double dy = y1 - y0;
+        double f0;
+        double f1;
+        double f2;
+        double f3;
+
+        if ((fmin (x0, x1) > max_x) || (fmax (x0, x1) < min_x)
+          || (fmin (y0, y1) > max_y) || (fmax (y0, y1) < min_y))
+        {
+                return (FALSE);
+        }
+        f0 = dx * (min_y - y0) - dy * (min_x - x0);
+        f1 = dx * (min_y - y0) - dy * (max_x - x0);
+        f2 = dx * (max_y - y0) - dy * (min_x - x0);
+        f3 = dx * (max_y - y0) - dy * (max_x - x0);
+        if ((f0 > 0.0) && (f1 > 0.0) && (f2 > 0.0) && (f3 > 0.0))
+        {
+                return (FALSE);
+        }
+        if ((f0 < 0.0) && (f1 < 0.0) && (f2 < 0.0) && (f3 < 0.0))
+        {
+                return (FALSE);
+        }
+        return (TRUE);
+}
+
+
+#ifdef DXF_GEOM_BATCH_HAVE_AVX2
+/*!
+ * \brief Test if line segments overlap an axis aligned box, four
+ * segments at a time with AVX2.
+ *
+ * \return the index of the first of the remaining segments, which the
+ * caller processes one at a time.
+ */
+DXF_GEOM_BATCH_TARGET_AVX2
+static size_t
+dxf_geom_batch_segments_overlap_box_avx2
+(
+        const double *x0,
+                /*!< array with the X-values of the start points. */
+        const double *y0,
+                /*!< array with the Y-values of the start points. */
+        const double *x1,
+                /*!< array with the X-values of the end points. */
+        const double *y1,
+                /*!< array with the Y-values of the end points. */
+        size_t i,
+                /*!< index of the first segment to process. */
+        size_t n,
+                /*!< number of segments in the arrays. */
+        double min_x,
+                /*!< minimum X-value of the box. */
+        double min_y,
+                /*!< minimum Y-value of the box. */
+        double max_x,
+                /*!< maximum X-value of the box. */
+        double max_y,
+                /*!< maximum Y-value of the box. */
+        int *results
+                /*!< array receiving \c TRUE or \c FALSE for each
+                 * segment. */
+)
+{
+        __m256d bx0 = _mm256_set1_pd (min_x);
+        __m256d by0 = _mm256_set1_pd (min_y);
+        __m256d bx1 = _mm256_set1_pd (max_x);
+        __m256d by1 = _mm256_set1_pd (max_y);
+        __m256d zero = _mm256_setzero_pd ();
+        __m256d ax;
+        __m256d ay;
+        __m256d bx;
+        __m256d by;
+        __m256d dx;
+        __m256d dy;
+        __m256d ok;
+        __m256d f[4];
+        __m256d pos;
+        __m256d neg;
+        int bits;
+        int k;
+
+        for (; i + 4 <= n; i += 4)
+        {
+                ax = _mm256_loadu_pd (x0 + i);
+                ay = _mm256_loadu_pd (y0 + i);
+                bx = _mm256_loadu_pd (x1 + i);
+                by = _mm256_loadu_pd (y1 + i);
+                ok = _mm256_and_pd (
+                  _mm256_cmp_pd (_mm256_min_pd (ax, bx), bx1, _CMP_LE_OQ),
+                  _mm256_cmp_pd (_mm256_max_pd (ax, bx), bx0, _CMP_GE_OQ));
+                ok = _mm256_and_pd (ok, _mm256_and_pd (
+                  _mm256_cmp_pd (_mm256_min_pd (ay, by), by1, _CMP_LE_OQ),
+                  _mm256_cmp_pd (_mm256_max_pd (ay, by), by0, _CMP_GE_OQ)));
+                dx = _mm256_sub_pd (bx, ax);
+                dy = _mm256_sub_pd (by, ay);
+                f[0] = _mm256_sub_pd (_mm256_mul_pd (dx, _mm256_sub_pd (by0, ay)), _mm256_mul_pd (dy, _mm256_sub_pd (bx0, ax)));
+                f[1] = _mm256_sub_pd (_mm256_mul_pd (dx, _mm256_sub_pd (by0, ay)), _mm256_mul_pd (dy, _mm256_sub_pd (bx1, ax)));
+                f[2] = _mm256_sub_pd (_mm256_mul_pd (dx, _mm256_sub_pd (by1, ay)), _mm256_mul_pd (dy, _mm256_sub_pd (bx0, ax)));
+                f[3] = _mm256_sub_pd (_mm256_mul_pd (dx, _mm256_sub_pd (by1, ay)), _mm256_mul_pd (dy, _mm256_sub_pd (bx1, ax)));
+                pos = _mm256_cmp_pd (f[0], zero, _CMP_GT_OQ);
+                neg = _mm256_cmp_pd (f[0], zero, _CMP_LT_OQ);
+                for (k = 1; k < 4; k++)
+                {
+                        pos = _mm256_and_pd (pos, _mm256_cmp_pd (f[k], zero, _CMP_GT_OQ));
+                        neg = _mm256_and_pd (neg, _mm256_cmp_pd (f[k], zero, _CMP_LT_OQ));
+                }
+                ok = _mm256_andnot_pd (_mm256_or_pd (pos, neg), ok);
+                bits = _mm256_movemask_pd (ok);
+                for (k = 0; k < 4; k++)
+                {
+                        results[i + k] = (bits >> k) & 1;
+                }
+        }
+        return (i);
+}
+#endif
+
+
+#ifdef __SSE2__
+/*!
+ * \brief Test if line segments overlap an axis aligned box, two
+ * segments at a time with SSE2.
+ *
+ * \return the index of the first of the remaining segments, which the
+ * caller processes one at a time.
+ */
+static size_t
+dxf_geom_batch_segments_overlap_box_sse2
+(
+        const double *x0,
+                /*!< array with the X-values of the start points. */
+        const double *y0,
+                /*!< array with the Y-values of the start points. */
+        const double *x1,
+                /*!< array with the X-values of the end points. */
+        const double *y1,
+                /*!< array with the Y-values of the end points. */
+        size_t i,
+                /*!< index of the first segment to process. */
+        size_t n,
+                /*!< number of segments in the arrays. */
+        double min_x,
+                /*!< minimum X-value of the box. */
+        double min_y,
+                /*!< minimum Y-value of the box. */
+        double max_x,
+                /*!< maximum X-value of the box. */
+        double max_y,
+                /*!< maximum Y-value of the box. */
+        int *results
+                /*!< array receiving \c TRUE or \c FALSE for each
+                 * segment. */
+)
+{
+        __m128d bx0 = _mm_set1_pd (min_x);
+        __m128d by0 = _mm_set1_pd (min_y);
+        __m128d bx1 = _mm_set1_pd (max_x);
+        __m128d by1 = _mm_set1_pd (max_y);
+        __m128d zero = _mm_setzero_pd ();
+        __m128d ax;
+        __m128d ay;
+        __m128d bx;
+        __m128d by;
+        __m128d dx;
+        __m128d dy;
+        __m128d ok;
+        __m128d f[4];
+        __m128d pos;
+        __m128d neg;
+        int bits;
+        int k;
+
+        for (; i + 2 <= n; i += 2)
+        {
+                ax = _mm_loadu_pd (x0 + i);
+                ay = _mm_loadu_pd (y0 + i);
+                bx = _mm_loadu_pd (x1 + i);
+                by = _mm_loadu_pd (y1 + i);
+                ok = _mm_and_pd (
+                  _mm_cmple_pd (_mm_min_pd (ax, bx), bx1),
+                  _mm_cmpge_pd (_mm_max_pd (ax, bx), bx0));
+                ok = _mm_and_pd (ok, _mm_and_pd (
+                  _mm_cmple_pd (_mm_min_pd (ay, by), by1),
+                  _mm_cmpge_pd (_mm_max_pd (ay, by), by0)));
+                dx = _mm_sub_pd (bx, ax);
+                dy = _mm_sub_pd (by, ay);
+                f[0] = _mm_sub_pd (_mm_mul_pd (dx, _mm_sub_pd (by0, ay)), _mm_mul_pd (dy, _mm_sub_pd (bx0, ax)));
+                f[1] = _mm_sub_pd (_mm_mul_pd (dx, _mm_sub_pd (by0, ay)), _mm_mul_pd (dy, _mm_sub_pd (bx1, ax)));
+                f[2] = _mm_sub_pd (_mm_mul_pd (dx, _mm_sub_pd (by1, ay)), _mm_mul_pd (dy, _mm_sub_pd (bx0, ax)));
+                f[3] = _mm_sub_pd (_mm_mul_pd (dx, _mm_sub_pd (by1, ay)), _mm_mul_pd (dy, _mm_sub_pd (bx1, ax)));
+                pos = _mm_cmpgt_pd (f[0], zero);
+                neg = _mm_cmplt_pd (f[0], zero);
+                for (k = 1; k < 4; k++)
+                {
+                        pos = _mm_and_pd (pos, _mm_cmpgt_pd (f[k], zero));
+                        neg = _mm_and_pd (neg, _mm_cmplt_pd (f[k], zero));
+                }
+                ok = _mm_andnot_pd (_mm_or_pd (pos, neg), ok);
+                bits = _mm_movemask_pd (ok);
+                results[i] = bits & 1;
+                results[i + 1] = (bits >> 1) & 1;
+        }
+        return (i);
+}
+#endif
+
+
+/* dxf_geom_batch functions. */
+
+/*!
+ * \brief Get the instruction set used by the batch geometry kernels on
+ * this processor.
+ *
+ * \return \c DXF_GEOM_BATCH_ISA_AVX2, \c DXF_GEOM_BATCH_ISA_SSE2 or
+ * \c DXF_GEOM_BATCH_ISA_SCALAR.
+ */
+DxfGeomBatchIsa
+dxf_geom_batch_get_isa ()
+{
+        if (dxf_geom_batch_have_avx2 ())
+        {
+                return (DXF_GEOM_BATCH_ISA_AVX2);
+        }
+#ifdef __SSE2__
+        return (DXF_GEOM_BATCH_ISA_SSE2);
+#else
+        return (DXF_GEOM_BATCH_ISA_SCALAR);
+#endif
+}
+
+
+/*!
+ * \brief Test if points are inside a circle.
+ *
+ * Batch version of \c dxf_circle_test_point_in_circle(), the
+ * classification of each point is identical.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ *
+ * \note A two-dimensional circle on a plane with z = 0.0.
+ */
+int
+dxf_geom_batch_points_in_circle
+(
+        const double *x,
+                /*!< array with the X-values of the points. */
+        const double *y,
+                /*!< array with the Y-values of the points. */
+        size_t number_of_points,
+                /*!< number of points in the arrays. */
+        double center_x,
+                /*!< X-value of the center point of the circle. */
+        double center_y,
+                /*!< Y-value of the center point of the circle. */
+        double radius,
+                /*!< radius of the circle. */
+        int *results
+                /*!< array receiving \c INSIDE, \c OUTSIDE or
+                 * \c ON_EDGE for each point. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double dx;
+        double dy;
+        double d2;
+        double r2;
+        size_t i = 0;
+
+        /* Do some basic checks. */
+        if ((number_of_points > 0)
+          && ((x == NULL) || (y == NULL) || (results == NULL)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (radius < 0.0)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a negative value was found.\n")),
+                  __FUNCTION__);
+        }
+#ifdef DXF_GEOM_BATCH_HAVE_AVX2
+        if (dxf_geom_batch_have_avx2 ())
+        {
+                i = dxf_geom_batch_points_in_circle_avx2 (x, y, i,
+                  number_of_points, center_x, center_y, radius, results);
+        }
+#endif
+#ifdef __SSE2__
+        i = dxf_geom_batch_points_in_circle_sse2 (x, y, i,
+          number_of_points, center_x, center_y, radius, results);
+#endif
+        r2 = radius * radius;
+        for (; i < number_of_points; i++)
+        {
+                dx = x[i] - center_x;
+                dy = y[i] - center_y;
+                d2 = dx * dx + dy * dy;
+                results[i] = dxf_geom_batch_classify (d2 < r2, d2 > r2);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Test if points are on an arc.
+ *
+ * A point is on the arc when its distance to the arc's circle is at
+ * most \c tolerance and it lies within the angular range of the arc,
+ * running counter clockwise from \c start_angle to \c end_angle.\n
+ * The angular range is tested with cross products, no trigonometric
+ * functions are evaluated per point.\n
+ * An arc with equal start and end angles is treated as a full circle.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ *
+ * \note A two-dimensional arc on a plane with z = 0.0.
+ */
+int
+dxf_geom_batch_points_on_arc
+(
+        const double *x,
+                /*!< array with the X-values of the points. */
+        const double *y,
+                /*!< array with the Y-values of the points. */
+        size_t number_of_points,
+                /*!< number of points in the arrays. */
+        double center_x,
+                /*!< X-value of the center point of the arc. */
+        double center_y,
+                /*!< Y-value of the center point of the arc. */
+        double radius,
+                /*!< radius of the arc. */
+        double start_angle,
+                /*!< start angle of the arc in degrees. */
+        double end_angle,
+                /*!< end angle of the arc in degrees. */
+        double tolerance,
+                /*!< maximum distance of a point to the arc. */
+        int *results
+                /*!< array receiving \c TRUE or \c FALSE for each
+                 * point. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfGeomBatchArc arc;
+        double sweep;
+        size_t i = 0;
+
+        /* Do some basic checks. */
+        if ((number_of_points > 0)
+          && ((x == NULL) || (y == NULL) || (results == NULL)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (tolerance < 0.0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a negative tolerance was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        sweep = fmod (end_angle - start_angle, 360.0);
+        if (sweep < 0.0)
+        {
+                sweep += 360.0;
+        }
+        arc.cx = center_x;
+        arc.cy = center_y;
+        arc.radius = radius;
+        arc.tolerance = tolerance;
+        arc.sx = cos (start_angle * M_PI / 180.0);
+        arc.sy = sin (start_angle * M_PI / 180.0);
+        arc.ex = cos (end_angle * M_PI / 180.0);
+        arc.ey = sin (end_angle * M_PI / 180.0);
+        if (sweep == 0.0)
+        {
+                arc.mode = 0;
+        }
+        else if (sweep <= 180.0)
+        {
+                arc.mode = 1;
+        }
+        else
+        {
+                arc.mode = 2;
+        }
+#ifdef DXF_GEOM_BATCH_HAVE_AVX2
+        if (dxf_geom_batch_have_avx2 ())
+        {
+                i = dxf_geom_batch_points_on_arc_avx2 (x, y, i,
+                  number_of_points, &arc, results);
+        }
+#endif
+#ifdef __SSE2__
+        i = dxf_geom_batch_points_on_arc_sse2 (x, y, i,
+          number_of_points, &arc, results);
+#endif
+        for (; i < number_of_points; i++)
+        {
+                results[i] = dxf_geom_batch_arc_test (&arc, x[i], y[i]);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Compute the distances of points to a line segment.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ *
+ * \note A two-dimensional segment on a plane with z = 0.0.
+ */
+int
+dxf_geom_batch_points_segment_distance
+(
+        const double *x,
+                /*!< array with the X-values of the points. */
+        const double *y,
+                /*!< array with the Y-values of the points. */
+        size_t number_of_points,
+                /*!< number of points in the arrays. */
+        double x0,
+                /*!< X-value of the start point of the segment. */
+        double y0,
+                /*!< Y-value of the start point of the segment. */
+        double x1,
+                /*!< X-value of the end point of the segment. */
+        double y1,
+                /*!< Y-value of the end point of the segment. */
+        double *distances
+                /*!< array receiving the distance of each point to
+                 * the segment. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double dx = x1 - x0;
+        double dy = y1 - y0;
+        double inverse_length2;
+        double px;
+        double py;
+        double t;
+        size_t i = 0;
+
+        /* Do some basic checks. */
+        if ((number_of_points > 0)
+          && ((x == NULL) || (y == NULL) || (distances == NULL)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        /* A segment of zero length is a point. */
+        inverse_length2 = dx * dx + dy * dy;
+        inverse_length2 = (inverse_length2 > 0.0) ? 1.0 / inverse_length2 : 0.0;
+#ifdef DXF_GEOM_BATCH_HAVE_AVX2
+        if (dxf_geom_batch_have_avx2 ())
+        {
+                i = dxf_geom_batch_points_segment_distance_avx2 (x, y, i,
+                  number_of_points, x0, y0, dx, dy, inverse_length2,
+                  distances);
+        }
+#endif
+#ifdef __SSE2__
+        i = dxf_geom_batch_points_segment_distance_sse2 (x, y, i,
+          number_of_points, x0, y0, dx, dy, inverse_length2, distances);
+#endif
+        for (; i < number_of_points; i++)
+        {
+                px = x[i] - x0;
+                py = y[i] - y0;
+                t = (px * dx + py * dy) * inverse_length2;
+                t = fmin (fmax (t, 0.0), 1.0);
+                px -= t * dx;
+                py -= t * dy;
+                distances[i] = sqrt (px * px + py * py);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Test if line segments overlap an axis aligned box.
+ *
+ * Segments touching the box are reported as overlapping.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ *
+ * \note Two-dimensional segments on a plane with z = 0.0.
+ */
+int
+dxf_geom_batch_segments_overlap_box
+(
+        const double *x0,
+                /*!< array with the X-values of the start points. */
+        const double *y0,
+                /*!< array with the Y-values of the start points. */
+        const double *x1,
+                /*!< array with the X-values of the end points. */
+        const double *y1,
+                /*!< array with the Y-values of the end points. */
+        size_t number_of_segments,
+                /*!< number of segments in the arrays. */
+        double min_x,
+                /*!< minimum X-value of the box. */
+        double min_y,
+                /*!< minimum Y-value of the box. */
+        double max_x,
+                /*!< maximum X-value of the box. */
+        double max_y,
+                /*!< maximum Y-value of the box. */
+        int *results
+                /*!< array receiving \c TRUE or \c FALSE for each
+                 * segment. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        size_t i = 0;
+
+        /* Do some basic checks. */
+        if ((number_of_segments > 0)
+          && ((x0 == NULL) || (y0 == NULL) || (x1 == NULL) || (y1 == NULL)
+          || (results == NULL)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((min_x > max_x) || (min_y > max_y))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an invalid box was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#ifdef DXF_GEOM_BATCH_HAVE_AVX2
+        if (dxf_geom_batch_have_avx2 ())
+        {
+                i = dxf_geom_batch_segments_overlap_box_avx2 (x0, y0, x1,
+                  y1, i, number_of_segments, min_x, min_y, max_x, max_y,
+                  results);
+        }
+#endif
+#ifdef __SSE2__
+        i = dxf_geom_batch_segments_overlap_box_sse2 (x0, y0, x1, y1, i,
+          number_of_segments, min_x, min_y, max_x, max_y, results);
+#endif
+        for (; i < number_of_segments; i++)
+        {
+                results[i] = dxf_geom_batch_segment_overlap_box (x0[i],
+                  y0[i], x1[i], y1[i], min_x, min_y, max_x, max_y);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/* EOF */
@@ -0,0 +1,78 @@
+/*!
+ * \file geom_batch.h
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for libDXF batch geometry predicates.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_GEOM_BATCH_H
+#define LIBDXF_SRC_GEOM_BATCH_H
+
+
+#include "global.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief Definition of the instruction set used by the batch geometry
+ * kernels.
+ */
+typedef enum
+dxf_geom_batch_isa
+{
+        DXF_GEOM_BATCH_ISA_SCALAR = 0,
+                /*!< Plain C, no SIMD instructions. */
+        DXF_GEOM_BATCH_ISA_SSE2 = 1,
+                /*!< 2 doubles per instruction (SSE2). */
+        DXF_GEOM_BATCH_ISA_AVX2 = 2
+                /*!< 4 doubles per instruction (AVX2). */
+} DxfGeomBatchIsa;
+
+
+DxfGeomBatchIsa dxf_geom_batch_get_isa ();
+int dxf_geom_batch_points_in_circle (const double *x, const double *y, size_t number_of_points, double center_x, double center_y, double radius, int *results);
+int dxf_geom_batch_points_on_arc (const double *x, const double *y, size_t number_of_points, double center_x, double center_y, double radius, double start_angle, double end_angle, double tolerance, int *results);
+int dxf_geom_batch_points_segment_distance (const double *x, const double *y, size_t number_of_points, double x0, double y0, double x1, double y1, double *distances);
+int dxf_geom_batch_segments_overlap_box (const double *x0, const double *y0, const double *x1, const double *y1, size_t number_of_segments, double min_x, double min_y, double max_x, double max_y, int *results);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_GEOM_BATCH_H */
+
+
+/* EOF */
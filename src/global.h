@@ -86,6 +86,7 @@
 
 #include "dbg.h"
 #include "entity.h"
+#include "allocator.h"
 
 
 #ifdef __MSDOS__
@@ -129,7 +130,7 @@
 
 #ifndef DEBUG
 #  define DEBUG 0
-        /*!< \brief Verbose debugging output to \c stderr on/off toggle.
+        /*!< \brief Function tracing on/off toggle, see DXF_DEBUG_BEGIN.
          *
          * If not already defined as a compiler directive the default value is
          * 0 (off). */
@@ -171,21 +172,130 @@
         /*!< \brief A DXF error is -1. */
 #endif
 
+#include "tracing.h"
+#include "diagnostic.h"
+
+
 #define DXF_DEBUG_BEGIN \
-        fprintf (stderr, \
-          (_("[File: %s: line: %d] Entering %s () function.\n")), \
-          __FILE__, __LINE__, __FUNCTION__);
-        /*!< \brief Verbose debugging output to \c stderr.
+        DXF_TRACE_BEGIN (DXF_TRACING_FUNCTION, __FUNCTION__);
+        /*!< \brief Record the entry of a function in the trace.
          *
-         * Compile with -DDEBUG compiler directive enabled. */
+         * Compile with -DDEBUG compiler directive enabled, dump the trace
+         * with dxf_tracing_dump (). */
 
 #define DXF_DEBUG_END \
-        fprintf (stderr, \
-          (_("[File: %s: line: %d] Leaving %s () function.\n")), \
-          __FILE__, __LINE__, __FUNCTION__);
-        /*!< \brief Verbose debugging output to \c stderr.
+        DXF_TRACE_END (DXF_TRACING_FUNCTION, __FUNCTION__);
+        /*!< \brief Record the exit of a function in the trace.
          *
-         * Compile with -DDEBUG compiler directive enabled. */
+         * Compile with -DDEBUG compiler directive enabled, dump the trace
+         * with dxf_tracing_dump (). */
+
+
+/*!
+ * \brief Sections of a DXF file for which statistics are collected.
+ */
+typedef enum
+dxf_stats_section
+{
+        DXF_STATS_SECTION_HEADER,
+        DXF_STATS_SECTION_CLASSES,
+        DXF_STATS_SECTION_TABLES,
+        DXF_STATS_SECTION_BLOCKS,
+        DXF_STATS_SECTION_ENTITIES,
+        DXF_STATS_SECTION_OBJECTS,
+        DXF_STATS_SECTION_THUMBNAIL,
+        DXF_STATS_NUMBER_OF_SECTIONS
+} DxfStatsSection;
+
+
+#define DXF_STATS_NUMBER_OF_ENTITY_TYPES (XLINE + 1)
+        /*!< \brief Number of entity types for which statistics are
+         * collected, one for every \c DxfEntityType. */
+
+
+/*!
+ * \brief DXF definition of the runtime statistics of a DXF file.
+ *
+ * Statistics are only collected for a DXF file with statistics
+ * attached, see dxf_file_set_stats ().\n
+ * Times are in nanoseconds.
+ */
+typedef struct
+dxf_stats_struct
+{
+    int64_t bytes_read;
+        /*!< Number of bytes consumed. */
+    int64_t lines_read;
+        /*!< Number of lines consumed. */
+    int64_t section_count[DXF_STATS_NUMBER_OF_SECTIONS];
+        /*!< Number of sections read, per section. */
+    int64_t section_nanoseconds[DXF_STATS_NUMBER_OF_SECTIONS];
+        /*!< Time spent reading, per section. */
+    int64_t entities_read[DXF_STATS_NUMBER_OF_ENTITY_TYPES];
+        /*!< Number of entities parsed, per entity type. */
+    int64_t entity_nanoseconds[DXF_STATS_NUMBER_OF_ENTITY_TYPES];
+        /*!< Time spent parsing entities, per entity type. */
+    int64_t entities_skipped;
+        /*!< Number of entities skipped because libDXF can not parse
+         * them. */
+    int64_t allocations;
+        /*!< Number of entities and vertices allocated while reading. */
+    int64_t unknown_group_codes;
+        /*!< Number of group codes not known to the entity reader. */
+    int64_t skipped_group_codes;
+        /*!< Number of group codes of skipped entities. */
+    int64_t bytes_written;
+        /*!< Number of bytes written. */
+    int64_t entities_written[DXF_STATS_NUMBER_OF_ENTITY_TYPES];
+        /*!< Number of entities written, per entity type. */
+    int64_t write_nanoseconds;
+        /*!< Time spent writing. */
+} DxfStats;
+
+
+#define DXF_STATS_ADD(fp, counter, value) \
+        do \
+        { \
+                if ((fp)->stats != NULL) \
+                { \
+                        (fp)->stats->counter += (value); \
+                } \
+        } while (0)
+        /*!< \brief Add \c value to the \c counter of the statistics of
+         * the DXF file \c fp, if any. */
+
+
+/*!
+ * \brief Handling of the ACIS proprietary data of \c 3DSOLID, \c BODY,
+ * \c REGION and \c SURFACE entities while reading.
+ *
+ * See dxf_file_set_acis_mode ().
+ */
+typedef enum
+dxf_acis_mode
+{
+        DXF_ACIS_LOAD,
+                /*!< Keep the proprietary data as one contiguous buffer,
+                 * as found in the file (default). */
+        DXF_ACIS_DECRYPT,
+                /*!< Keep the proprietary data as one contiguous buffer
+                 * of decrypted SAT text. */
+        DXF_ACIS_DEFER,
+                /*!< Record the byte range of the proprietary data in
+                 * the file only, the data is loaded on demand. */
+        DXF_ACIS_SKIP
+                /*!< Discard the proprietary data. */
+} DxfAcisMode;
+
+
+/*!
+ * \brief Function invoked for every entity read from the \c ENTITIES
+ * section, with the \c data passed to dxf_file_set_entity_callback ().
+ *
+ * \return \c TRUE when the function takes over the entity, which is
+ * then not appended to the lists of the drawing, \c FALSE otherwise.
+ */
+typedef int (*DxfEntityCallback) (DxfEntityType type, void *entity, void *data);
 
 
 /*!
@@ -206,6 +316,15 @@ dxf_file_struct
         /*!< AutoCAD version number. */
     int follow_strict_version_rules;
         /*!< follow strict rules when writing to file. */
+    DxfStats *stats;
+        /*!< Runtime statistics, \c NULL when no statistics are
+         * collected. */
+    DxfAcisMode acis_mode;
+        /*!< Handling of ACIS proprietary data while reading. */
+    DxfEntityCallback entity_callback;
+        /*!< Function invoked for every entity read, or \c NULL. */
+    void *entity_callback_data;
+        /*!< Data passed to \c entity_callback. */
 } DxfFile;
 
 
@@ -61,7 +61,7 @@ dxf_group_new ()
         size = sizeof (DxfGroup);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((group = malloc (size)) == NULL)
+        if ((group = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -99,25 +99,25 @@ dxf_group_init
         /* Do some basic checks. */
         if (group == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 group = dxf_group_new ();
         }
         if (group == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         group->id_code = 0;
-        group->description = strdup ("");
-        group->handle_entity_in_group = strdup ("");
+        group->description = dxf_strdup ("");
+        group->handle_entity_in_group = dxf_strdup ("");
         group->unnamed_flag = 0;
         group->selectability_flag = 0;
-        group->dictionary_owner_soft = strdup ("");
-        group->dictionary_owner_hard = strdup ("");
+        group->dictionary_owner_soft = dxf_strdup ("");
+        group->dictionary_owner_hard = dxf_strdup ("");
         group->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -153,22 +153,22 @@ dxf_group_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (group == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 group = dxf_group_init (group);
@@ -179,11 +179,11 @@ dxf_group_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -217,7 +217,7 @@ dxf_group_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "AcDbGroup") != 0)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -258,13 +258,14 @@ dxf_group_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -290,48 +291,48 @@ dxf_group_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("GROUP");
+        char *dxf_entity_name = dxf_strdup ("GROUP");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (group == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (group->description, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty description string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, group->id_code);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (group->handle_entity_in_group, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty string for handle entity in group for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, group->id_code);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, group->id_code);
         }
@@ -374,7 +375,7 @@ dxf_group_write
         fprintf (fp->fp, " 71\n%d\n", group->selectability_flag);
         fprintf (fp->fp, "340\n%s\n", group->handle_entity_in_group);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -403,23 +404,23 @@ dxf_group_free
         /* Do some basic checks. */
         if (group == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (group->next != NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (group->dictionary_owner_soft);
-        free (group->dictionary_owner_hard);
-        free (group->description);
-        free (group->handle_entity_in_group);
-        free (group);
+        dxf_free (group->dictionary_owner_soft);
+        dxf_free (group->dictionary_owner_hard);
+        dxf_free (group->description);
+        dxf_free (group->handle_entity_in_group);
+        dxf_free (group);
         group = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -440,18 +441,19 @@ dxf_group_free_list
                  * objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (groups == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (groups != NULL)
         {
                 DxfGroup *iter = (DxfGroup *) groups->next;
+                groups->next = NULL;
                 dxf_group_free (groups);
                 groups = (DxfGroup *) iter;
         }
@@ -572,7 +574,7 @@ dxf_group_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (group->dictionary_owner_soft));
+        return (dxf_strdup (group->dictionary_owner_soft));
 }
 
 
@@ -608,7 +610,7 @@ dxf_group_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        group->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        group->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -652,7 +654,7 @@ dxf_group_get_object_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (group->object_owner_soft));
+        return (dxf_strdup (group->object_owner_soft));
 }
 
 
@@ -688,7 +690,7 @@ dxf_group_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        group->object_owner_soft = strdup (object_owner_soft);
+        group->object_owner_soft = dxf_strdup (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -732,7 +734,7 @@ dxf_group_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (group->dictionary_owner_hard));
+        return (dxf_strdup (group->dictionary_owner_hard));
 }
 
 
@@ -768,7 +770,7 @@ dxf_group_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        group->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        group->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -973,7 +975,7 @@ dxf_group_get_description
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (group->description));
+        return (dxf_strdup (group->description));
 }
 
 
@@ -1007,7 +1009,7 @@ dxf_group_set_description
                   __FUNCTION__);
                 return (NULL);
         }
-        group->description = strdup (description);
+        group->description = dxf_strdup (description);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1049,7 +1051,7 @@ dxf_group_get_handle_entity_in_group
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (group->handle_entity_in_group));
+        return (dxf_strdup (group->handle_entity_in_group));
 }
 
 
@@ -1084,7 +1086,7 @@ dxf_group_set_handle_entity_in_group
                   __FUNCTION__);
                 return (NULL);
         }
-        group->handle_entity_in_group = strdup (handle_entity_in_group);
+        group->handle_entity_in_group = dxf_strdup (handle_entity_in_group);
 #if DEBUG
         DXF_DEBUG_END
 #endif
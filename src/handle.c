@@ -0,0 +1,591 @@
+/*!
+ * \file handle.c
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for a libDXF handle allocator.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "handle.h"
+
+
+/*!
+ * \brief Hash a handle (Fibonacci hashing).
+ */
+static size_t
+dxf_handle_set_hash
+(
+        int handle
+)
+{
+        return ((size_t) ((uint32_t) handle * 2654435769u));
+}
+
+
+/*!
+ * \brief Find the slot of a handle, or the empty slot where it belongs.
+ */
+static size_t
+dxf_handle_set_slot
+(
+        DxfHandleSet *set,
+        int handle
+)
+{
+        size_t mask;
+        size_t i;
+
+        mask = set->size - 1;
+        for (i = dxf_handle_set_hash (handle) & mask;
+          (set->handles[i] != 0) && (set->handles[i] != handle);
+          i = (i + 1) & mask)
+        {
+        }
+        return (i);
+}
+
+
+/*!
+ * \brief Resize the hash table of a \c DxfHandleSet.
+ */
+static int
+dxf_handle_set_resize
+(
+        DxfHandleSet *set,
+        size_t size
+)
+{
+        int *handles = NULL;
+        int *old_handles = NULL;
+        size_t old_size;
+        size_t i;
+
+        handles = dxf_calloc (size, sizeof (int));
+        if (handles == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        old_handles = set->handles;
+        old_size = set->size;
+        set->handles = handles;
+        set->size = size;
+        for (i = 0; i < old_size; i++)
+        {
+                if (old_handles[i] != 0)
+                {
+                        set->handles[dxf_handle_set_slot (set, old_handles[i])] = old_handles[i];
+                }
+        }
+        dxf_free (old_handles);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate memory for a \c DxfHandleAllocator.
+ *
+ * Fill the memory contents with zeros.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfHandleAllocator *
+dxf_handle_allocator_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHandleAllocator *allocator = NULL;
+        size_t size;
+
+        size = sizeof (DxfHandleAllocator);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((allocator = dxf_malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                allocator = NULL;
+        }
+        else
+        {
+                memset (allocator, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (allocator);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize a \c DxfHandleAllocator with no
+ * handles in use.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfHandleAllocator *
+dxf_handle_allocator_init
+(
+        DxfHandleAllocator *allocator
+                /*!< a pointer to a \c DxfHandleAllocator. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (allocator == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                allocator = dxf_handle_allocator_new ();
+        }
+        if (allocator == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        __atomic_store_n (&allocator->last_handle, 0, __ATOMIC_SEQ_CST);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (allocator);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfHandleAllocator.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_handle_allocator_free
+(
+        DxfHandleAllocator *allocator
+                /*!< a pointer to the memory occupied by the
+                 * \c DxfHandleAllocator. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (allocator == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_free (allocator);
+        allocator = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate a new handle.
+ *
+ * \return the new handle, or -1 when an error occurred.
+ */
+int
+dxf_handle_allocator_next
+(
+        DxfHandleAllocator *allocator
+                /*!< a pointer to a \c DxfHandleAllocator. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int handle;
+
+        /* Do some basic checks. */
+        if (allocator == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        handle = __atomic_add_fetch (&allocator->last_handle, 1, __ATOMIC_RELAXED);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (handle);
+}
+
+
+/*!
+ * \brief Allocate a range of \c number_of_handles consecutive handles.
+ *
+ * A thread can reserve a range once and hand out the handles without
+ * further synchronization.
+ *
+ * \return the first handle of the range, or -1 when an error occurred.
+ */
+int
+dxf_handle_allocator_reserve
+(
+        DxfHandleAllocator *allocator,
+                /*!< a pointer to a \c DxfHandleAllocator. */
+        int number_of_handles
+                /*!< number of handles to allocate. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int first;
+
+        /* Do some basic checks. */
+        if (allocator == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (number_of_handles < 1)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a number of handles less than 1 was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        first = __atomic_fetch_add (&allocator->last_handle,
+          number_of_handles, __ATOMIC_RELAXED) + 1;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (first);
+}
+
+
+/*!
+ * \brief Mark \c handle as in use, a handle that was set by other
+ * means than the allocator (for example read from a file).
+ *
+ * Following handles from the allocator are larger than \c handle.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_handle_allocator_use
+(
+        DxfHandleAllocator *allocator,
+                /*!< a pointer to a \c DxfHandleAllocator. */
+        int handle
+                /*!< a handle in use. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int last_handle;
+
+        /* Do some basic checks. */
+        if (allocator == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        last_handle = __atomic_load_n (&allocator->last_handle, __ATOMIC_RELAXED);
+        while ((handle > last_handle)
+          && !__atomic_compare_exchange_n (&allocator->last_handle,
+          &last_handle, handle, TRUE, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        {
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the largest handle in use.
+ *
+ * \return the largest handle in use, 0 when no handle is in use, or -1
+ * when an error occurred.
+ */
+int
+dxf_handle_allocator_get_last
+(
+        DxfHandleAllocator *allocator
+                /*!< a pointer to a \c DxfHandleAllocator. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int last_handle;
+
+        /* Do some basic checks. */
+        if (allocator == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        last_handle = __atomic_load_n (&allocator->last_handle, __ATOMIC_RELAXED);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (last_handle);
+}
+
+
+/*!
+ * \brief Allocate memory for a \c DxfHandleSet.
+ *
+ * Fill the memory contents with zeros.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfHandleSet *
+dxf_handle_set_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHandleSet *set = NULL;
+        size_t size;
+
+        size = sizeof (DxfHandleSet);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((set = dxf_malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                set = NULL;
+        }
+        else
+        {
+                memset (set, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (set);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize an empty \c DxfHandleSet.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfHandleSet *
+dxf_handle_set_init
+(
+        DxfHandleSet *set
+                /*!< a pointer to a \c DxfHandleSet. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (set == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                set = dxf_handle_set_new ();
+        }
+        if (set == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        set->handles = NULL;
+        set->size = 0;
+        set->number_of_handles = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (set);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfHandleSet.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_handle_set_free
+(
+        DxfHandleSet *set
+                /*!< a pointer to the memory occupied by the
+                 * \c DxfHandleSet. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (set == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_free (set->handles);
+        dxf_free (set);
+        set = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Insert a handle into a \c DxfHandleSet.
+ *
+ * \return \c TRUE when the handle was inserted, \c FALSE when the
+ * handle was already in the set, or -1 when an error occurred.
+ */
+int
+dxf_handle_set_insert
+(
+        DxfHandleSet *set,
+                /*!< a pointer to a \c DxfHandleSet. */
+        int handle
+                /*!< the handle to insert, not 0. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        size_t i;
+
+        /* Do some basic checks. */
+        if (set == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (handle == 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the handle 0 was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (2 * (set->number_of_handles + 1) > set->size)
+        {
+                if (dxf_handle_set_resize (set, (set->size == 0)
+                  ? DXF_HANDLE_SET_MIN_SIZE : 2 * set->size) == EXIT_FAILURE)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (-1);
+                }
+        }
+        i = dxf_handle_set_slot (set, handle);
+        if (set->handles[i] == handle)
+        {
+                return (FALSE);
+        }
+        set->handles[i] = handle;
+        set->number_of_handles++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (TRUE);
+}
+
+
+/*!
+ * \brief Test if a handle is in a \c DxfHandleSet.
+ *
+ * \return \c TRUE when the handle is in the set, \c FALSE otherwise.
+ */
+int
+dxf_handle_set_contains
+(
+        DxfHandleSet *set,
+                /*!< a pointer to a \c DxfHandleSet. */
+        int handle
+                /*!< the handle to look for. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int result;
+
+        /* Do some basic checks. */
+        if (set == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (FALSE);
+        }
+        if ((set->size == 0) || (handle == 0))
+        {
+                return (FALSE);
+        }
+        result = (set->handles[dxf_handle_set_slot (set, handle)] == handle)
+          ? TRUE : FALSE;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/* EOF */
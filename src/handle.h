@@ -0,0 +1,109 @@
+/*!
+ * \file handle.h
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Prototypes for a libDXF handle allocator.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_HANDLE_H
+#define LIBDXF_SRC_HANDLE_H
+
+
+#include "global.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_HANDLE_SET_MIN_SIZE 64
+        /*!< \brief Initial number of slots of a handle set. */
+
+
+/*!
+ * \brief Definition of a handle allocator.
+ *
+ * A handle allocator hands out unique handles (id-codes) for the
+ * entities and objects of a drawing.\n
+ * All operations on a handle allocator are atomic, an allocator can be
+ * shared by threads building a drawing in parallel.
+ */
+typedef struct
+dxf_handle_allocator_struct
+{
+        int last_handle;
+                /*!< The largest handle in use, only to be accessed by
+                 * the dxf_handle_allocator_* () functions. */
+} DxfHandleAllocator;
+
+
+/*!
+ * \brief Definition of a set of handles.
+ *
+ * A hash table with open addressing and linear probing, used to find
+ * duplicate handles.\n
+ * The handle 0 (no handle) can not be stored.
+ */
+typedef struct
+dxf_handle_set_struct
+{
+        int *handles;
+                /*!< Slots of the hash table, 0 for an empty slot. */
+        size_t size;
+                /*!< Number of slots, a power of two. */
+        size_t number_of_handles;
+                /*!< Number of handles in the set. */
+} DxfHandleSet;
+
+
+DxfHandleAllocator *dxf_handle_allocator_new ();
+DxfHandleAllocator *dxf_handle_allocator_init (DxfHandleAllocator *allocator);
+int dxf_handle_allocator_free (DxfHandleAllocator *allocator);
+int dxf_handle_allocator_next (DxfHandleAllocator *allocator);
+int dxf_handle_allocator_reserve (DxfHandleAllocator *allocator, int number_of_handles);
+int dxf_handle_allocator_use (DxfHandleAllocator *allocator, int handle);
+int dxf_handle_allocator_get_last (DxfHandleAllocator *allocator);
+DxfHandleSet *dxf_handle_set_new ();
+DxfHandleSet *dxf_handle_set_init (DxfHandleSet *set);
+int dxf_handle_set_free (DxfHandleSet *set);
+int dxf_handle_set_insert (DxfHandleSet *set, int handle);
+int dxf_handle_set_contains (DxfHandleSet *set, int handle);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_HANDLE_H */
+
+
+/* EOF */
@@ -40,6 +40,11 @@
 
 
 #include "hatch.h"
+#include "nurbs.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 
 /* dxf_hatch functions. */
@@ -61,7 +66,7 @@ dxf_hatch_new ()
         size = sizeof (DxfHatch);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((hatch = malloc (size)) == NULL)
+        if ((hatch = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -99,22 +104,22 @@ dxf_hatch_init
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 hatch = dxf_hatch_new ();
         }
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         /* Assign initial values to members. */
         hatch->id_code = 0;
-        hatch->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        hatch->layer = strdup (DXF_DEFAULT_LAYER);
+        hatch->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        hatch->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         hatch->elevation = 0.0;
         hatch->thickness = 0.0;
         hatch->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -123,16 +128,16 @@ dxf_hatch_init
         hatch->paperspace = DXF_MODELSPACE;
         hatch->graphics_data_size = 0;
         hatch->shadow_mode = 0;
-        hatch->dictionary_owner_soft = strdup ("");
-        hatch->object_owner_soft = strdup ("");
-        hatch->material = strdup ("");
-        hatch->dictionary_owner_hard = strdup ("");
+        hatch->dictionary_owner_soft = dxf_strdup ("");
+        hatch->object_owner_soft = dxf_strdup ("");
+        hatch->material = dxf_strdup ("");
+        hatch->dictionary_owner_hard = dxf_strdup ("");
         hatch->lineweight = 0;
-        hatch->plot_style_name = strdup ("");
+        hatch->plot_style_name = dxf_strdup ("");
         hatch->color_value = 0;
-        hatch->color_name = strdup ("");
+        hatch->color_name = dxf_strdup ("");
         hatch->transparency = 0;
-        hatch->pattern_name = strdup ("");
+        hatch->pattern_name = dxf_strdup ("");
         hatch->pattern_scale = 1.0;
         hatch->pixel_size = 1.0;
         hatch->pattern_angle = 0.0;
@@ -178,66 +183,66 @@ dxf_hatch_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("HATCH");
+        char *dxf_entity_name = dxf_strdup ("HATCH");
         DxfHatchPatternDefLine *line = NULL;
         DxfHatchPatternSeedPoint *point = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (hatch->p0 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (hatch->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning: empty layer string for the %s entity with id-code: %x\n")),
                         dxf_entity_name, hatch->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("    %s entity is relocated to layer 0")),
                         dxf_entity_name);
-                hatch->layer = strdup (DXF_DEFAULT_LAYER);
+                hatch->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (strcmp (hatch->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning: empty linetype string for the %s entity with id-code: %x\n")),
                         dxf_entity_name, hatch->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("    %s entity is reset to default linetype")),
                         dxf_entity_name);
-                hatch->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                hatch->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -325,16 +330,7 @@ dxf_hatch_write
 #else
                 fprintf (fp->fp, " 92\n%" PRIi32 "\n", hatch->graphics_data_size);
 #endif
-                if (hatch->binary_graphics_data != NULL)
-                {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) hatch->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
-                }
+                dxf_binary_data_write (fp, (DxfBinaryData *) hatch->binary_graphics_data);
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
@@ -385,7 +381,7 @@ dxf_hatch_write
         /* Clean up. */
         dxf_hatch_pattern_def_line_free (line);
         dxf_hatch_pattern_seedpoint_free (point);
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -414,33 +410,33 @@ dxf_hatch_free
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (hatch->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (hatch->linetype);
-        free (hatch->layer);
+        dxf_free (hatch->linetype);
+        dxf_free (hatch->layer);
         dxf_binary_data_free_list ((DxfBinaryData *) hatch->binary_graphics_data);
-        free (hatch->dictionary_owner_soft);
-        free (hatch->material);
-        free (hatch->dictionary_owner_hard);
-        free (hatch->plot_style_name);
-        free (hatch->color_name);
-        free (hatch->pattern_name);
+        dxf_free (hatch->dictionary_owner_soft);
+        dxf_free (hatch->material);
+        dxf_free (hatch->dictionary_owner_hard);
+        dxf_free (hatch->plot_style_name);
+        dxf_free (hatch->color_name);
+        dxf_free (hatch->pattern_name);
         dxf_point_free ((DxfPoint *) hatch->p0);
         dxf_hatch_boundary_path_free_list ((DxfHatchBoundaryPath *) hatch->paths);
         dxf_hatch_pattern_free_list ((DxfHatchPattern *) hatch->patterns);
         dxf_hatch_pattern_def_line_free_list ((DxfHatchPatternDefLine *) hatch->def_lines);
         dxf_hatch_pattern_seedpoint_free_list ((DxfHatchPatternSeedPoint *) hatch->seed_points);
-        free (hatch);
+        dxf_free (hatch);
         hatch = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -461,19 +457,20 @@ dxf_hatch_free_list
                  * entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (hatches == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (hatches != NULL)
         {
                 DxfHatch *iter = (DxfHatch *) hatches->next;
+                hatches->next = NULL;
                 dxf_hatch_free (hatches);
                 hatches = (DxfHatch *) iter;
         }
@@ -591,7 +588,7 @@ dxf_hatch_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (hatch->linetype));
+        return (dxf_strdup (hatch->linetype));
 }
 
 
@@ -625,7 +622,7 @@ dxf_hatch_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->linetype = strdup (linetype);
+        hatch->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -666,7 +663,7 @@ dxf_hatch_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (hatch->layer));
+        return (dxf_strdup (hatch->layer));
 }
 
 
@@ -700,7 +697,7 @@ dxf_hatch_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->layer = strdup (layer);
+        hatch->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1362,7 +1359,7 @@ dxf_hatch_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (hatch->dictionary_owner_soft));
+        return (dxf_strdup (hatch->dictionary_owner_soft));
 }
 
 
@@ -1398,7 +1395,7 @@ dxf_hatch_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        hatch->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1442,7 +1439,7 @@ dxf_hatch_get_object_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (hatch->object_owner_soft));
+        return (dxf_strdup (hatch->object_owner_soft));
 }
 
 
@@ -1478,7 +1475,7 @@ dxf_hatch_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->object_owner_soft = strdup (object_owner_soft);
+        hatch->object_owner_soft = dxf_strdup (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1522,7 +1519,7 @@ dxf_hatch_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (hatch->material));
+        return (dxf_strdup (hatch->material));
 }
 
 
@@ -1560,7 +1557,7 @@ dxf_hatch_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->material = strdup (material);
+        hatch->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1604,7 +1601,7 @@ dxf_hatch_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (hatch->dictionary_owner_hard));
+        return (dxf_strdup (hatch->dictionary_owner_hard));
 }
 
 
@@ -1640,7 +1637,7 @@ dxf_hatch_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        hatch->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1771,7 +1768,7 @@ dxf_hatch_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (hatch->plot_style_name));
+        return (dxf_strdup (hatch->plot_style_name));
 }
 
 
@@ -1809,7 +1806,7 @@ dxf_hatch_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->plot_style_name = strdup (plot_style_name);
+        hatch->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1916,7 +1913,7 @@ dxf_hatch_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (hatch->color_name));
+        return (dxf_strdup (hatch->color_name));
 }
 
 
@@ -1954,7 +1951,7 @@ dxf_hatch_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->color_name = strdup (color_name);
+        hatch->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2060,7 +2057,7 @@ dxf_hatch_get_pattern_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (hatch->pattern_name));
+        return (dxf_strdup (hatch->pattern_name));
 }
 
 
@@ -2094,7 +2091,7 @@ dxf_hatch_set_pattern_name
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->pattern_name = strdup (pattern_name);
+        hatch->pattern_name = dxf_strdup (pattern_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2114,7 +2111,7 @@ dxf_hatch_get_p0
                 /*!< a pointer to a DXF \c HATCH entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2154,7 +2151,7 @@ dxf_hatch_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3545,7 +3542,7 @@ dxf_hatch_pattern_new ()
         size = sizeof (DxfHatchPattern);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((pattern = malloc (size)) == NULL)
+        if ((pattern = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -3583,14 +3580,14 @@ dxf_hatch_pattern_init
         /* Do some basic checks. */
         if (pattern == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 pattern = dxf_hatch_pattern_new ();
         }
         if (pattern == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3632,21 +3629,21 @@ dxf_hatch_pattern_free
         /* Do some basic checks. */
         if (pattern == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (pattern->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (pattern->def_lines);
-        free (pattern->seed_points);
-        free (pattern);
+        dxf_free (pattern->def_lines);
+        dxf_free (pattern->seed_points);
+        dxf_free (pattern);
         pattern = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -3667,19 +3664,20 @@ dxf_hatch_pattern_free_list
                  * patterns. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (patterns == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (patterns != NULL)
         {
                 DxfHatchPattern *iter = (DxfHatchPattern *) patterns->next;
+                patterns->next = NULL;
                 dxf_hatch_pattern_free (patterns);
                 patterns = (DxfHatchPattern *) iter;
         }
@@ -4217,7 +4215,7 @@ dxf_hatch_pattern_def_line_dash_new ()
         size = sizeof (DxfHatchPatternDefLineDash);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((dash = malloc (size)) == NULL)
+        if ((dash = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -4256,7 +4254,7 @@ dxf_hatch_pattern_def_line_dash_init
         /* Do some basic checks. */
         if (dash == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 dash = dxf_hatch_pattern_def_line_dash_new ();
@@ -4292,19 +4290,19 @@ dxf_hatch_pattern_def_line_dash_free
         /* Do some basic checks. */
         if (dash == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dash->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (dash);
+        dxf_free (dash);
         dash = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -4325,19 +4323,20 @@ dxf_hatch_pattern_def_line_dash_free_list
                  * pattern definition line dashes. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dashes == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (dashes != NULL)
         {
                 DxfHatchPatternDefLineDash *iter = (DxfHatchPatternDefLineDash *) dashes->next;
+                dashes->next = NULL;
                 dxf_hatch_pattern_def_line_dash_free (dashes);
                 dashes = (DxfHatchPatternDefLineDash *) iter;
         }
@@ -4553,7 +4552,7 @@ dxf_hatch_pattern_def_line_new ()
         size = sizeof (DxfHatchPatternDefLine);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((line = malloc (size)) == NULL)
+        if ((line = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -4591,14 +4590,14 @@ dxf_hatch_pattern_def_line_init
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 line = dxf_hatch_pattern_def_line_new ();
         }
         if (line == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4647,14 +4646,14 @@ dxf_hatch_pattern_def_line_write
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -4674,7 +4673,7 @@ dxf_hatch_pattern_def_line_write
                 dash = dxf_hatch_pattern_def_line_get_dashes (line);
                 if (dash == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () no pointer to the first dash found.\n")),
                           __FUNCTION__);
 
@@ -4687,7 +4686,7 @@ dxf_hatch_pattern_def_line_write
                 }
                 if (i >= line->number_of_dash_items)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () more dashes found than expected.\n")),
                           __FUNCTION__);
 
@@ -4695,7 +4694,7 @@ dxf_hatch_pattern_def_line_write
         }
         else
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () no dash length found.\n")),
                   __FUNCTION__);
         }
@@ -4727,19 +4726,19 @@ dxf_hatch_pattern_def_line_free
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (line);
+        dxf_free (line);
         line = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -4760,19 +4759,20 @@ dxf_hatch_pattern_def_line_free_list
                  * pattern definition lines. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (lines == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (lines != NULL)
         {
                 DxfHatchPatternDefLine *iter = (DxfHatchPatternDefLine *) lines->next;
+                lines->next = NULL;
                 dxf_hatch_pattern_def_line_free (lines);
                 lines = (DxfHatchPatternDefLine *) iter;
         }
@@ -5468,7 +5468,7 @@ dxf_hatch_pattern_seedpoint_new ()
         size = sizeof (DxfHatchPatternSeedPoint);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((seedpoint = malloc (size)) == NULL)
+        if ((seedpoint = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -5506,14 +5506,14 @@ dxf_hatch_pattern_seedpoint_init
         /* Do some basic checks. */
         if (seedpoint == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 seedpoint = dxf_hatch_pattern_seedpoint_new ();
         }
         if (seedpoint == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5554,14 +5554,14 @@ dxf_hatch_pattern_seedpoint_write
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (seedpoint == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -5597,19 +5597,19 @@ dxf_hatch_pattern_seedpoint_free
         /* Do some basic checks. */
         if (seedpoint == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (seedpoint->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (seedpoint);
+        dxf_free (seedpoint);
         seedpoint = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -5630,19 +5630,20 @@ dxf_hatch_pattern_seedpoint_free_list
                  * pattern seed points. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (hatch_pattern_seed_points == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (hatch_pattern_seed_points != NULL)
         {
                 DxfHatchPatternSeedPoint *iter = (DxfHatchPatternSeedPoint *) hatch_pattern_seed_points->next;
+                hatch_pattern_seed_points->next = NULL;
                 dxf_hatch_pattern_seedpoint_free (hatch_pattern_seed_points);
                 hatch_pattern_seed_points = (DxfHatchPatternSeedPoint *) iter;
         }
@@ -5993,7 +5994,7 @@ dxf_hatch_boundary_path_new ()
         size = sizeof (DxfHatchBoundaryPath);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((path = malloc (size)) == NULL)
+        if ((path = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -6031,14 +6032,14 @@ dxf_hatch_boundary_path_init
         /* Do some basic checks. */
         if (path == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 path = dxf_hatch_boundary_path_new ();
         }
         if (path == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -6075,65 +6076,72 @@ dxf_hatch_boundary_path_write
         DXF_DEBUG_BEGIN
 #endif
         DxfHatchBoundaryPathPolyline *iter;
+        DxfHatchBoundaryPathEdge *edge;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (path == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
-        for (;;)
+        while (path != NULL)
         {
-                if (path->next == NULL)
+                /* Test for edge type or polylines type. */
+                if (path->polylines != NULL)
                 {
-                        fprintf (stderr,
-                          (_("Information from %s () last boundary path encountered.\n")),
-                          __FUNCTION__);
-                        break;
-                }
-                else
-                {
-                        /* Test for edge type or polylines type. */
-                        if (path->edges != NULL)
+                        /* Boundary path type flag: polyline. */
+                        fprintf (fp->fp, " 92\n2\n");
+                        iter = (DxfHatchBoundaryPathPolyline *) path->polylines;
+                        while (iter != NULL)
                         {
-                                /*! \todo Write edges data. */
+                                dxf_hatch_boundary_path_polyline_write
+                                (
+                                        fp,
+                                        iter
+                                );
+                                iter = (DxfHatchBoundaryPathPolyline *) iter->next;
                         }
-                        else if (path->polylines != NULL)
+                }
+                else if (path->edges != NULL)
+                {
+                        /* Boundary path type flag: default (edges). */
+                        fprintf (fp->fp, " 92\n0\n");
+                        fprintf (fp->fp, " 93\n%d\n",
+                          dxf_hatch_boundary_path_edge_count
+                          (
+                                  (DxfHatchBoundaryPathEdge *) path->edges
+                          ));
+                        edge = (DxfHatchBoundaryPathEdge *) path->edges;
+                        while (edge != NULL)
                         {
-                                iter = dxf_hatch_boundary_path_polyline_new ();
-                                iter = (DxfHatchBoundaryPathPolyline *) path->polylines;
-                                for (;;)
+                                if (dxf_hatch_boundary_path_edge_write
+                                  (fp, edge) == EXIT_FAILURE)
                                 {
-                                        dxf_hatch_boundary_path_polyline_write
-                                        (
-                                                fp,
-                                                iter
-                                        );
-                                        iter = (DxfHatchBoundaryPathPolyline *) iter->next;
-                                        if (iter == NULL)
-                                        {
-                                                break;
-                                        }
+                                        return (EXIT_FAILURE);
                                 }
+                                edge = (DxfHatchBoundaryPathEdge *) edge->next;
                         }
-                        else
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () unknown boundary path type encountered.\n")),
-                                  __FUNCTION__);
-                                return (EXIT_FAILURE);
-                        }
                 }
+                else
+                {
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () unknown boundary path type encountered.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                /* Number of source boundary objects. */
+                fprintf (fp->fp, " 97\n0\n");
+                path = (DxfHatchBoundaryPath *) path->next;
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -6163,21 +6171,21 @@ dxf_hatch_boundary_path_free
         /* Do some basic checks. */
         if (path == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (path->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (path->edges);
-        free (path->polylines);
-        free (path);
+        dxf_free (path->edges);
+        dxf_free (path->polylines);
+        dxf_free (path);
         path = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -6198,19 +6206,20 @@ dxf_hatch_boundary_path_free_list
                  * boundary paths. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (hatch_boundary_paths == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (hatch_boundary_paths != NULL)
         {
                 DxfHatchBoundaryPath *iter = (DxfHatchBoundaryPath *) hatch_boundary_paths->next;
+                hatch_boundary_paths->next = NULL;
                 dxf_hatch_boundary_path_free (hatch_boundary_paths);
                 hatch_boundary_paths = (DxfHatchBoundaryPath *) iter;
         }
@@ -6593,7 +6602,7 @@ dxf_hatch_boundary_path_polyline_new ()
         size = sizeof (DxfHatchBoundaryPathPolyline);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((polyline = malloc (size)) == NULL)
+        if ((polyline = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -6631,14 +6640,14 @@ dxf_hatch_boundary_path_polyline_init
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 polyline = dxf_hatch_boundary_path_polyline_new ();
         }
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -6681,14 +6690,14 @@ dxf_hatch_boundary_path_polyline_write
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -6696,9 +6705,8 @@ dxf_hatch_boundary_path_polyline_write
         fprintf (fp->fp, " 73\n%hd\n", polyline->is_closed);
         fprintf (fp->fp, " 93\n%" PRIi32 "\n", polyline->number_of_vertices);
         /* draw hatch boundary vertices. */
-        iter = dxf_hatch_boundary_path_polyline_vertex_new ();
         iter = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
-        for (;;)
+        while (iter != NULL)
         {
                 dxf_hatch_boundary_path_polyline_vertex_write
                 (
@@ -6706,10 +6714,6 @@ dxf_hatch_boundary_path_polyline_write
                         iter
                 );
                 iter = (DxfHatchBoundaryPathPolylineVertex *) iter->next;
-                if (iter == NULL)
-                {
-                        break;
-                }
         }
         /* test for closed polyline: close with first vertex. */
         if (polyline->is_closed)
@@ -6748,20 +6752,20 @@ dxf_hatch_boundary_path_polyline_free
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (polyline->vertices);
-        free (polyline);
+        dxf_free (polyline->vertices);
+        dxf_free (polyline);
         polyline = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -6782,19 +6786,20 @@ dxf_hatch_boundary_path_polyline_free_list
                  * boundary path polylines. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (polylines == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (polylines != NULL)
         {
                 DxfHatchBoundaryPathPolyline *iter = (DxfHatchBoundaryPathPolyline *) polylines->next;
+                polylines->next = NULL;
                 dxf_hatch_boundary_path_polyline_free (polylines);
                 polylines = (DxfHatchBoundaryPathPolyline *) iter;
         }
@@ -7226,33 +7231,201 @@ dxf_hatch_boundary_path_polyline_close_polyline
 
 
 /*!
- * \brief Compute if the coordinates of a point \c p lie inside or
- * outside a DXF hatch boundary path polyline \c polyline entity.
+ * \brief Compute the contribution of the chord of a boundary path
+ * polyline segment to the winding number around a point.
  *
- * \author Paul Bourke <http://www.paulbourke.net/geometry/insidepoly/>\n
- * Adapted for libDXF by Bert Timmerman <bert.timmerman@xs4all.nl>
+ * Crossing rule after Dan Sunday: an upward crossing of the horizontal
+ * ray from the point with the point left of the edge counts +1, a
+ * downward crossing with the point right of the edge counts -1.
+ *
+ * \return the winding number contribution (-1, 0 or 1).
+ */
+static int
+dxf_hatch_boundary_path_polyline_chord_winding
+(
+        double x0,
+                /*!< X-value of the start of the segment. */
+        double y0,
+                /*!< Y-value of the start of the segment. */
+        double x1,
+                /*!< X-value of the end of the segment. */
+        double y1,
+                /*!< Y-value of the end of the segment. */
+        double px,
+                /*!< X-value of the point. */
+        double py,
+                /*!< Y-value of the point. */
+        int *on_edge
+                /*!< set to \c TRUE when the point lies on the chord. */
+)
+{
+        double cross;
+
+        cross = (x1 - x0) * (py - y0) - (px - x0) * (y1 - y0);
+        if ((cross == 0.0)
+          && (px >= fmin (x0, x1)) && (px <= fmax (x0, x1))
+          && (py >= fmin (y0, y1)) && (py <= fmax (y0, y1)))
+        {
+                *on_edge = TRUE;
+        }
+        if ((y0 <= py) && (y1 > py) && (cross > 0.0))
+        {
+                return (1);
+        }
+        if ((y0 > py) && (y1 <= py) && (cross < 0.0))
+        {
+                return (-1);
+        }
+        return (0);
+}
+
+
+/*!
+ * \brief Compute the contribution of the arc of a bulged boundary path
+ * polyline segment to the winding number around a point.
  *
- * A solution by Philippe Reverdy is to compute the sum of the angles
- * made between the test point and each pair of points making up the
- * polygon.\n
- * If this sum is (\f$ 2\pi \f$) then the point is an interior point,
- * if 0 then the point is an exterior point.\n
- * This also works for polygons with holes given the polygon is defined
- * with a path made up of coincident edges into and out of the hole as
- * is common practice in many CAD packages.\n
+ * The arc is split at its top and bottom points into pieces that are
+ * monotone in Y, every piece is counted with the same crossing rule as
+ * a chord, using the exact vertex coordinates at the ends of the arc
+ * so results are consistent with the adjacent segments.
  *
- * \note For most of the "point-in-polygon" algorithms there is a
- * pathological case if the point being queries lies exactly on a
- * vertex.\n
- * The easiest way to cope with this is to test that as a separate
- * process and make your own decision as to whether you want to consider
- * them inside or outside.
+ * \return the winding number contribution (-1, 0 or 1).
+ */
+static int
+dxf_hatch_boundary_path_polyline_arc_winding
+(
+        double x0,
+                /*!< X-value of the start of the segment. */
+        double y0,
+                /*!< Y-value of the start of the segment. */
+        double x1,
+                /*!< X-value of the end of the segment. */
+        double y1,
+                /*!< Y-value of the end of the segment. */
+        double bulge,
+                /*!< bulge of the segment. */
+        double px,
+                /*!< X-value of the point. */
+        double py,
+                /*!< Y-value of the point. */
+        int *on_edge
+                /*!< set to \c TRUE when the point lies on the arc. */
+)
+{
+        double dx;
+        double dy;
+        double d;
+        double h;
+        double cx;
+        double cy;
+        double r;
+        double r2;
+        double p2;
+        double cross;
+        double start;
+        double sweep;
+        double direction;
+        double s[4];
+        double y[4];
+        double extreme;
+        double angle;
+        double xc;
+        int n;
+        int i;
+        int winding;
+
+        dx = x1 - x0;
+        dy = y1 - y0;
+        d = sqrt (dx * dx + dy * dy);
+        if ((bulge == 0.0) || (d == 0.0))
+        {
+                return (dxf_hatch_boundary_path_polyline_chord_winding
+                  (x0, y0, x1, y1, px, py, on_edge));
+        }
+        /* Center on the left hand normal of the chord at a signed
+         * distance h from the chord mid point. */
+        h = d * (1.0 - bulge * bulge) / (4.0 * bulge);
+        cx = (x0 + x1) / 2.0 - dy / d * h;
+        cy = (y0 + y1) / 2.0 + dx / d * h;
+        r2 = (x0 - cx) * (x0 - cx) + (y0 - cy) * (y0 - cy);
+        r = sqrt (r2);
+        /* On the arc: on the circle and on the arc side of the chord (a
+         * positive bulge runs counter clockwise, right of the chord). */
+        p2 = (px - cx) * (px - cx) + (py - cy) * (py - cy);
+        cross = dx * (py - y0) - (px - x0) * dy;
+        if ((fabs (p2 - r2) <= DXF_HATCH_ON_EDGE_TOLERANCE * r2)
+          && ((bulge > 0.0) ? (cross <= 0.0) : (cross >= 0.0)))
+        {
+                *on_edge = TRUE;
+        }
+        /* Split points in traversal order: the start vertex, the top
+         * and bottom of the circle within the sweep, the end vertex. */
+        direction = (bulge > 0.0) ? 1.0 : -1.0;
+        start = atan2 (y0 - cy, x0 - cx);
+        sweep = 4.0 * atan (fabs (bulge));
+        s[0] = 0.0;
+        y[0] = y0;
+        n = 1;
+        for (i = 0; i < 2; i++)
+        {
+                extreme = (i == 0) ? M_PI / 2.0 : 3.0 * M_PI / 2.0;
+                angle = fmod (direction * (extreme - start), 2.0 * M_PI);
+                if (angle < 0.0)
+                {
+                        angle += 2.0 * M_PI;
+                }
+                if ((angle > 0.0) && (angle < sweep))
+                {
+                        s[n] = angle;
+                        y[n] = (i == 0) ? cy + r : cy - r;
+                        n++;
+                }
+        }
+        if ((n == 3) && (s[2] < s[1]))
+        {
+                angle = s[1]; s[1] = s[2]; s[2] = angle;
+                angle = y[1]; y[1] = y[2]; y[2] = angle;
+        }
+        s[n] = sweep;
+        y[n] = y1;
+        winding = 0;
+        for (i = 0; i < n; i++)
+        {
+                if (!(((y[i] <= py) && (y[i + 1] > py))
+                  || ((y[i] > py) && (y[i + 1] <= py))))
+                {
+                        continue;
+                }
+                /* The piece lies in the right or the left half of the
+                 * circle. */
+                angle = start + direction * (s[i] + s[i + 1]) / 2.0;
+                xc = sqrt (fmax (0.0, r2 - (py - cy) * (py - cy)));
+                xc = (cos (angle) >= 0.0) ? cx + xc : cx - xc;
+                if (xc > px)
+                {
+                        winding += (y[i + 1] > y[i]) ? 1 : -1;
+                }
+        }
+        return (winding);
+}
+
+
+/*!
+ * \brief Compute if the coordinates of a point \c p lie inside or
+ * outside a DXF hatch boundary path polyline \c polyline entity.
  *
- * \note It is assumed that the polygon is simple (does not intersect
- * itself).
+ * The winding number of the boundary around the point is computed
+ * from the crossings of the segments, including the arcs of bulged
+ * segments, with a horizontal ray from the point.\n
+ * A non-zero winding number denotes an interior point (non-zero fill
+ * rule), so self intersecting boundaries and boundaries running
+ * clockwise are handled as well.\n
+ * The last vertex connects to the first vertex, a closing vertex
+ * duplicating the first vertex is allowed.
  *
  * \return \c INSIDE if an interior point, \c OUTSIDE if an exterior
- * point, or \c EXIT_FAILURE if an error occurred.
+ * point, \c ON_EDGE if the point lies on the boundary, or
+ * \c EXIT_FAILURE if an error occurred.
  */
 int
 dxf_hatch_boundary_path_polyline_point_inside_polyline
@@ -7266,6 +7439,11 @@ dxf_hatch_boundary_path_polyline_point_inside_polyline
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        DxfHatchBoundaryPathPolylineVertex *iter = NULL;
+        DxfHatchBoundaryPathPolylineVertex *next = NULL;
+        int winding;
+        int on_edge;
+
         /* Do some basic checks. */
         if (polyline == NULL)
         {
@@ -7288,48 +7466,292 @@ dxf_hatch_boundary_path_polyline_point_inside_polyline
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        DxfHatchBoundaryPathPolylineVertex *p0;
-        DxfHatchBoundaryPathPolylineVertex *p1;
-        DxfHatchBoundaryPathPolylineVertex *iter;
-        DxfHatchBoundaryPathPolylineVertex *next;
-        double angle;
-        p0 = dxf_hatch_boundary_path_polyline_vertex_new ();
-        p1 = dxf_hatch_boundary_path_polyline_vertex_new ();
-        iter = dxf_hatch_boundary_path_polyline_vertex_new ();
-        next = dxf_hatch_boundary_path_polyline_vertex_new ();
-        iter = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
-        next = (DxfHatchBoundaryPathPolylineVertex *) iter->next;
-        angle = 0;
-        for (;;)
+        if (polyline->vertices == NULL)
         {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        winding = 0;
+        on_edge = FALSE;
+        for (iter = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+          iter != NULL;
+          iter = (DxfHatchBoundaryPathPolylineVertex *) iter->next)
+        {
+                next = (DxfHatchBoundaryPathPolylineVertex *) iter->next;
                 if (next == NULL)
                 {
-                        /* iter is the last vertex, no use to continue. */
-                        break;
+                        /* The closing segment. */
+                        next = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+                }
+                if (iter->has_bulge && (iter->bulge != 0.0))
+                {
+                        winding += dxf_hatch_boundary_path_polyline_arc_winding
+                          (iter->x0, iter->y0, next->x0, next->y0, iter->bulge,
+                          point->x0, point->y0, &on_edge);
+                }
+                else
+                {
+                        winding += dxf_hatch_boundary_path_polyline_chord_winding
+                          (iter->x0, iter->y0, next->x0, next->y0,
+                          point->x0, point->y0, &on_edge);
                 }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        if (on_edge)
+        {
+                return (ON_EDGE);
+        }
+        return ((winding != 0) ? INSIDE : OUTSIDE);
+}
+
+
+/*!
+ * \brief Classify a batch of points against a DXF hatch boundary path
+ * polyline \c polyline entity.
+ *
+ * The boundary is converted once into contiguous arrays, the straight
+ * segments are processed two at a time with SSE2 instructions (when
+ * available at compile time), the bulged segments are processed one at
+ * a time.\n
+ * Points outside the bounding box of the boundary are rejected
+ * without visiting the segments.\n
+ * The classification is the same as with
+ * \c dxf_hatch_boundary_path_polyline_point_inside_polyline().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_boundary_path_polyline_points_inside_polyline
+(
+        DxfHatchBoundaryPathPolyline *polyline,
+                /*!< DXF hatch boundary path polyline entity. */
+        const double *xy,
+                /*!< The points to be tested for, \c number_of_points
+                 * pairs of X- and Y-values. */
+        size_t number_of_points,
+                /*!< The number of points. */
+        int *results
+                /*!< The results, \c INSIDE, \c OUTSIDE or \c ON_EDGE
+                 * for every point. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPathPolylineVertex *iter = NULL;
+        DxfHatchBoundaryPathPolylineVertex *next = NULL;
+        double *buffer = NULL;
+        double *sx0 = NULL;
+        double *sy0 = NULL;
+        double *sx1 = NULL;
+        double *sy1 = NULL;
+        double *arcs = NULL;
+        double bx0;
+        double by0;
+        double bx1;
+        double by1;
+        double r;
+        double px;
+        double py;
+        size_t number_of_vertices;
+        size_t number_of_straights;
+        size_t number_of_arcs;
+        size_t padded;
+        size_t i;
+        size_t j;
+        int winding;
+        int on_edge;
+#ifdef __SSE2__
+        __m128d vpx;
+        __m128d vpy;
+        __m128d vx0;
+        __m128d vy0;
+        __m128d vx1;
+        __m128d vy1;
+        __m128d cross;
+        __m128d up;
+        __m128d down;
+        __m128d on;
+        __m128d sum;
+        __m128d zero;
+        __m128d one;
+        double lanes[2];
+#endif
+
+        /* Do some basic checks. */
+        if ((polyline == NULL) || (results == NULL)
+          || ((xy == NULL) && (number_of_points > 0)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (polyline->is_closed != 1)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () polyline is not a closed polygon.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (polyline->vertices == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        number_of_vertices = 0;
+        for (iter = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+          iter != NULL;
+          iter = (DxfHatchBoundaryPathPolylineVertex *) iter->next)
+        {
+                number_of_vertices++;
+        }
+        /* Straight segments in structure of arrays layout, padded to a
+         * multiple of 2 with NaN (which never crosses nor touches),
+         * bulged segments as 5 values (x0, y0, x1, y1, bulge). */
+        padded = number_of_vertices + (number_of_vertices & 1);
+        buffer = dxf_malloc ((4 * padded + 5 * number_of_vertices) * sizeof (double));
+        if (buffer == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        sx0 = buffer;
+        sy0 = sx0 + padded;
+        sx1 = sy0 + padded;
+        sy1 = sx1 + padded;
+        arcs = sy1 + padded;
+        number_of_straights = 0;
+        number_of_arcs = 0;
+        iter = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+        bx0 = bx1 = iter->x0;
+        by0 = by1 = iter->y0;
+        for (; iter != NULL; iter = (DxfHatchBoundaryPathPolylineVertex *) iter->next)
+        {
                 next = (DxfHatchBoundaryPathPolylineVertex *) iter->next;
-                p0->x0 = iter->x0 - point->x0;
-                p0->y0 = iter->y0 - point->y0;
-                p1->x0 = next->x0 - point->x0;
-                p1->y0 = next->y0 - point->y0;
-                angle += dxf_hatch_boundary_path_polyline_vertex_angle (iter, next);
-                iter = next;
+                if (next == NULL)
+                {
+                        next = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+                }
+                bx0 = fmin (bx0, iter->x0);
+                bx1 = fmax (bx1, iter->x0);
+                by0 = fmin (by0, iter->y0);
+                by1 = fmax (by1, iter->y0);
+                if (iter->has_bulge && (iter->bulge != 0.0))
+                {
+                        arcs[5 * number_of_arcs] = iter->x0;
+                        arcs[5 * number_of_arcs + 1] = iter->y0;
+                        arcs[5 * number_of_arcs + 2] = next->x0;
+                        arcs[5 * number_of_arcs + 3] = next->y0;
+                        arcs[5 * number_of_arcs + 4] = iter->bulge;
+                        number_of_arcs++;
+                        /* Grow the box by the full circle of the arc. */
+                        r = sqrt ((next->x0 - iter->x0) * (next->x0 - iter->x0)
+                          + (next->y0 - iter->y0) * (next->y0 - iter->y0))
+                          * (1.0 + iter->bulge * iter->bulge) / (4.0 * fabs (iter->bulge));
+                        bx0 = fmin (bx0, iter->x0 - 2.0 * r);
+                        bx1 = fmax (bx1, iter->x0 + 2.0 * r);
+                        by0 = fmin (by0, iter->y0 - 2.0 * r);
+                        by1 = fmax (by1, iter->y0 + 2.0 * r);
+                }
+                else
+                {
+                        sx0[number_of_straights] = iter->x0;
+                        sy0[number_of_straights] = iter->y0;
+                        sx1[number_of_straights] = next->x0;
+                        sy1[number_of_straights] = next->y0;
+                        number_of_straights++;
+                }
         }
-        /* clean up. */
-        dxf_hatch_boundary_path_polyline_vertex_free (p0);
-        dxf_hatch_boundary_path_polyline_vertex_free (p1);
-        if (abs (angle) < M_PI)
-                return (OUTSIDE);
-        else
-                return (INSIDE);
+        for (i = number_of_straights; i < number_of_straights + (number_of_straights & 1); i++)
+        {
+                sx0[i] = sy0[i] = sx1[i] = sy1[i] = NAN;
+        }
+#ifdef __SSE2__
+        zero = _mm_setzero_pd ();
+        one = _mm_set1_pd (1.0);
+#endif
+        for (j = 0; j < number_of_points; j++)
+        {
+                px = xy[2 * j];
+                py = xy[2 * j + 1];
+                if ((px < bx0) || (px > bx1) || (py < by0) || (py > by1))
+                {
+                        results[j] = OUTSIDE;
+                        continue;
+                }
+                winding = 0;
+                on_edge = FALSE;
+#ifdef __SSE2__
+                vpx = _mm_set1_pd (px);
+                vpy = _mm_set1_pd (py);
+                sum = _mm_setzero_pd ();
+                on = _mm_setzero_pd ();
+                for (i = 0; i < number_of_straights; i += 2)
+                {
+                        vx0 = _mm_loadu_pd (&sx0[i]);
+                        vy0 = _mm_loadu_pd (&sy0[i]);
+                        vx1 = _mm_loadu_pd (&sx1[i]);
+                        vy1 = _mm_loadu_pd (&sy1[i]);
+                        cross = _mm_sub_pd
+                          (_mm_mul_pd (_mm_sub_pd (vx1, vx0), _mm_sub_pd (vpy, vy0)),
+                          _mm_mul_pd (_mm_sub_pd (vpx, vx0), _mm_sub_pd (vy1, vy0)));
+                        up = _mm_and_pd (_mm_and_pd (_mm_cmple_pd (vy0, vpy),
+                          _mm_cmpgt_pd (vy1, vpy)), _mm_cmpgt_pd (cross, zero));
+                        down = _mm_and_pd (_mm_and_pd (_mm_cmpgt_pd (vy0, vpy),
+                          _mm_cmple_pd (vy1, vpy)), _mm_cmplt_pd (cross, zero));
+                        sum = _mm_add_pd (sum, _mm_and_pd (up, one));
+                        sum = _mm_sub_pd (sum, _mm_and_pd (down, one));
+                        on = _mm_or_pd (on, _mm_and_pd (_mm_cmpeq_pd (cross, zero),
+                          _mm_and_pd (
+                            _mm_and_pd (_mm_cmpge_pd (vpx, _mm_min_pd (vx0, vx1)),
+                              _mm_cmple_pd (vpx, _mm_max_pd (vx0, vx1))),
+                            _mm_and_pd (_mm_cmpge_pd (vpy, _mm_min_pd (vy0, vy1)),
+                              _mm_cmple_pd (vpy, _mm_max_pd (vy0, vy1))))));
+                }
+                _mm_storeu_pd (lanes, sum);
+                winding = (int) (lanes[0] + lanes[1]);
+                on_edge = (_mm_movemask_pd (on) != 0);
+#else
+                for (i = 0; i < number_of_straights; i++)
+                {
+                        winding += dxf_hatch_boundary_path_polyline_chord_winding
+                          (sx0[i], sy0[i], sx1[i], sy1[i], px, py, &on_edge);
+                }
+#endif
+                for (i = 0; i < number_of_arcs; i++)
+                {
+                        winding += dxf_hatch_boundary_path_polyline_arc_winding
+                          (arcs[5 * i], arcs[5 * i + 1], arcs[5 * i + 2],
+                          arcs[5 * i + 3], arcs[5 * i + 4], px, py, &on_edge);
+                }
+                if (on_edge)
+                {
+                        results[j] = ON_EDGE;
+                }
+                else
+                {
+                        results[j] = (winding != 0) ? INSIDE : OUTSIDE;
+                }
+        }
+        dxf_free (buffer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        /*! \todo This is a dead code path. */
-        return (EXIT_FAILURE);
+        return (EXIT_SUCCESS);
 }
 
 
+
 /*!
  * \brief Get the pointer to the next \c HATCH boundary path polyline
  * from a DXF \c HATCH boundary path polyline.
@@ -7475,7 +7897,7 @@ dxf_hatch_boundary_path_polyline_vertex_new ()
         size = sizeof (DxfHatchBoundaryPathPolylineVertex);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((vertex = malloc (size)) == NULL)
+        if ((vertex = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -7513,14 +7935,14 @@ dxf_hatch_boundary_path_polyline_vertex_init
         /* Do some basic checks. */
         if (vertex == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 vertex = dxf_hatch_boundary_path_polyline_vertex_new ();
         }
         if (vertex == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -7560,14 +7982,14 @@ dxf_hatch_boundary_path_polyline_vertex_write
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (vertex == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -7607,19 +8029,19 @@ dxf_hatch_boundary_path_polyline_vertex_free
         /* Do some basic checks. */
         if (vertex == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (vertex->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (vertex);
+        dxf_free (vertex);
         vertex = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -7640,19 +8062,20 @@ dxf_hatch_boundary_path_polyline_vertex_free_list
                  * boundary path polyline vertices. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (hatch_boundary_path_polyline_vertices == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (hatch_boundary_path_polyline_vertices != NULL)
         {
                 DxfHatchBoundaryPathPolylineVertex *iter = (DxfHatchBoundaryPathPolylineVertex *) hatch_boundary_path_polyline_vertices->next;
+                hatch_boundary_path_polyline_vertices->next = NULL;
                 dxf_hatch_boundary_path_polyline_vertex_free (hatch_boundary_path_polyline_vertices);
                 hatch_boundary_path_polyline_vertices = (DxfHatchBoundaryPathPolylineVertex *) iter;
         }
@@ -8245,7 +8668,7 @@ dxf_hatch_boundary_path_edge_new ()
         size = sizeof (DxfHatchBoundaryPathEdge);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((edge = malloc (size)) == NULL)
+        if ((edge = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -8283,14 +8706,14 @@ dxf_hatch_boundary_path_edge_init
         /* Do some basic checks. */
         if (edge == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 edge = dxf_hatch_boundary_path_edge_new ();
         }
         if (edge == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -8311,6 +8734,193 @@ dxf_hatch_boundary_path_edge_init
 }
 
 
+/*!
+ * \brief Count the edges (lines, arcs, ellipses and splines) in a
+ * single linked list of DXF \c HATCH boundary path edges.
+ *
+ * \return the number of edges.
+ */
+int
+dxf_hatch_boundary_path_edge_count
+(
+        DxfHatchBoundaryPathEdge *edge
+                /*!< a pointer to the first DXF \c HATCH boundary path
+                 * edge in the list. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPathEdgeArc *arc;
+        DxfHatchBoundaryPathEdgeEllipse *ellipse;
+        DxfHatchBoundaryPathEdgeLine *line;
+        DxfHatchBoundaryPathEdgeSpline *spline;
+        int count = 0;
+
+        while (edge != NULL)
+        {
+                for (line = (DxfHatchBoundaryPathEdgeLine *) edge->lines;
+                  line != NULL;
+                  line = (DxfHatchBoundaryPathEdgeLine *) line->next)
+                {
+                        count++;
+                }
+                for (arc = (DxfHatchBoundaryPathEdgeArc *) edge->arcs;
+                  arc != NULL;
+                  arc = (DxfHatchBoundaryPathEdgeArc *) arc->next)
+                {
+                        count++;
+                }
+                for (ellipse = (DxfHatchBoundaryPathEdgeEllipse *) edge->ellipses;
+                  ellipse != NULL;
+                  ellipse = (DxfHatchBoundaryPathEdgeEllipse *) ellipse->next)
+                {
+                        count++;
+                }
+                for (spline = (DxfHatchBoundaryPathEdgeSpline *) edge->splines;
+                  spline != NULL;
+                  spline = (DxfHatchBoundaryPathEdgeSpline *) spline->next)
+                {
+                        count++;
+                }
+                edge = (DxfHatchBoundaryPathEdge *) edge->next;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (count);
+}
+
+
+/*!
+ * \brief Write DXF output to a file for the edges of a DXF \c HATCH
+ * boundary path edge.
+ *
+ * Each edge is written with its edge type (group code 72): lines
+ * first, then circular arcs, elliptic arcs and splines.\n
+ * The edge model keeps one list per edge type, so the original order
+ * of mixed edge types is not preserved.\n
+ * Angles are written in degrees.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_boundary_path_edge_write
+(
+        DxfFile *fp,
+                /*!< file pointer to output file (or device). */
+        DxfHatchBoundaryPathEdge *edge
+                /*!< DXF hatch boundary path edge entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPathEdgeArc *arc;
+        DxfHatchBoundaryPathEdgeEllipse *ellipse;
+        DxfHatchBoundaryPathEdgeLine *line;
+        DxfHatchBoundaryPathEdgeSpline *spline;
+        DxfHatchBoundaryPathEdgeSplineCp *control_point;
+        int i;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (edge == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        line = (DxfHatchBoundaryPathEdgeLine *) edge->lines;
+        while (line != NULL)
+        {
+                fprintf (fp->fp, " 72\n1\n");
+                fprintf (fp->fp, " 10\n%f\n", line->x0);
+                fprintf (fp->fp, " 20\n%f\n", line->y0);
+                fprintf (fp->fp, " 11\n%f\n", line->x1);
+                fprintf (fp->fp, " 21\n%f\n", line->y1);
+                line = (DxfHatchBoundaryPathEdgeLine *) line->next;
+        }
+        arc = (DxfHatchBoundaryPathEdgeArc *) edge->arcs;
+        while (arc != NULL)
+        {
+                fprintf (fp->fp, " 72\n2\n");
+                fprintf (fp->fp, " 10\n%f\n", arc->x0);
+                fprintf (fp->fp, " 20\n%f\n", arc->y0);
+                fprintf (fp->fp, " 40\n%f\n", arc->radius);
+                fprintf (fp->fp, " 50\n%f\n", arc->start_angle);
+                fprintf (fp->fp, " 51\n%f\n", arc->end_angle);
+                fprintf (fp->fp, " 73\n%hd\n", arc->is_ccw);
+                arc = (DxfHatchBoundaryPathEdgeArc *) arc->next;
+        }
+        ellipse = (DxfHatchBoundaryPathEdgeEllipse *) edge->ellipses;
+        while (ellipse != NULL)
+        {
+                fprintf (fp->fp, " 72\n3\n");
+                fprintf (fp->fp, " 10\n%f\n", ellipse->x0);
+                fprintf (fp->fp, " 20\n%f\n", ellipse->y0);
+                fprintf (fp->fp, " 11\n%f\n", ellipse->x1);
+                fprintf (fp->fp, " 21\n%f\n", ellipse->y1);
+                fprintf (fp->fp, " 40\n%f\n", ellipse->ratio);
+                fprintf (fp->fp, " 50\n%f\n", ellipse->start_angle);
+                fprintf (fp->fp, " 51\n%f\n", ellipse->end_angle);
+                fprintf (fp->fp, " 73\n%hd\n", ellipse->is_ccw);
+                ellipse = (DxfHatchBoundaryPathEdgeEllipse *) ellipse->next;
+        }
+        spline = (DxfHatchBoundaryPathEdgeSpline *) edge->splines;
+        while (spline != NULL)
+        {
+                if ((spline->number_of_knots < 0)
+                  || (spline->number_of_knots > DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS))
+                {
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () invalid number of knots in a spline edge.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                fprintf (fp->fp, " 72\n4\n");
+                fprintf (fp->fp, " 94\n%" PRIi32 "\n", spline->degree);
+                fprintf (fp->fp, " 73\n%hd\n", spline->rational);
+                fprintf (fp->fp, " 74\n%hd\n", spline->periodic);
+                fprintf (fp->fp, " 95\n%" PRIi32 "\n", spline->number_of_knots);
+                fprintf (fp->fp, " 96\n%" PRIi32 "\n", spline->number_of_control_points);
+                for (i = 0; i < spline->number_of_knots; i++)
+                {
+                        fprintf (fp->fp, " 40\n%f\n", spline->knots[i]);
+                }
+                control_point = (DxfHatchBoundaryPathEdgeSplineCp *) spline->control_points;
+                while (control_point != NULL)
+                {
+                        fprintf (fp->fp, " 10\n%f\n", control_point->x0);
+                        fprintf (fp->fp, " 20\n%f\n", control_point->y0);
+                        if (spline->rational)
+                        {
+                                fprintf (fp->fp, " 42\n%f\n", control_point->weight);
+                        }
+                        control_point = (DxfHatchBoundaryPathEdgeSplineCp *) control_point->next;
+                }
+                if (fp->acad_version_number >= AutoCAD_2010)
+                {
+                        /* Number of fit data: none are kept. */
+                        fprintf (fp->fp, " 97\n0\n");
+                }
+                spline = (DxfHatchBoundaryPathEdgeSpline *) spline->next;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /*!
  * \brief Free the allocated memory for a DXF \c HATCH boundary path
  * edge and all it's data fields.
@@ -8332,23 +8942,23 @@ dxf_hatch_boundary_path_edge_free
         /* Do some basic checks. */
         if (edge == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (edge->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (edge->arcs);
-        free (edge->ellipses);
-        free (edge->lines);
-        free (edge->splines);
-        free (edge);
+        dxf_free (edge->arcs);
+        dxf_free (edge->ellipses);
+        dxf_free (edge->lines);
+        dxf_free (edge->splines);
+        dxf_free (edge);
         edge = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -8369,19 +8979,20 @@ dxf_hatch_boundary_path_edge_free_list
                  * \c HATCH boundary path edges. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (edges == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (edges != NULL)
         {
                 DxfHatchBoundaryPathEdge *iter = (DxfHatchBoundaryPathEdge *) edges->next;
+                edges->next = NULL;
                 dxf_hatch_boundary_path_edge_free (edges);
                 edges = (DxfHatchBoundaryPathEdge *) iter;
         }
@@ -8922,7 +9533,7 @@ dxf_hatch_boundary_path_edge_arc_new ()
         size = sizeof (DxfHatchBoundaryPathEdgeArc);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((arc = malloc (size)) == NULL)
+        if ((arc = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -8960,14 +9571,14 @@ dxf_hatch_boundary_path_edge_arc_init
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 arc = dxf_hatch_boundary_path_edge_arc_new ();
         }
         if (arc == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -9011,19 +9622,19 @@ dxf_hatch_boundary_path_edge_arc_free
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (arc->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (arc);
+        dxf_free (arc);
         arc = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -9044,19 +9655,20 @@ dxf_hatch_boundary_path_edge_arc_free_list
                  * boundary path edge arcs. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (hatch_boundary_path_edge_arcs == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (hatch_boundary_path_edge_arcs != NULL)
         {
                 DxfHatchBoundaryPathEdgeArc *iter = (DxfHatchBoundaryPathEdgeArc *) hatch_boundary_path_edge_arcs->next;
+                hatch_boundary_path_edge_arcs->next = NULL;
                 dxf_hatch_boundary_path_edge_arc_free (hatch_boundary_path_edge_arcs);
                 hatch_boundary_path_edge_arcs = (DxfHatchBoundaryPathEdgeArc *) iter;
         }
@@ -9283,7 +9895,7 @@ dxf_hatch_boundary_path_edge_arc_get_center_point
                  * file. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *p1 = NULL;
@@ -9334,7 +9946,7 @@ dxf_hatch_boundary_path_edge_arc_set_center_point
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -9790,7 +10402,7 @@ dxf_hatch_boundary_path_edge_ellipse_new ()
         size = sizeof (DxfHatchBoundaryPathEdgeEllipse);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((ellipse = malloc (size)) == NULL)
+        if ((ellipse = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -9828,14 +10440,14 @@ dxf_hatch_boundary_path_edge_ellipse_init
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 ellipse = dxf_hatch_boundary_path_edge_ellipse_new ();
         }
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -9881,19 +10493,19 @@ dxf_hatch_boundary_path_edge_ellipse_free
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ellipse->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (ellipse);
+        dxf_free (ellipse);
         ellipse = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -9914,19 +10526,20 @@ dxf_hatch_boundary_path_edge_ellipse_free_list
                  * boundary path edge ellipses. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (hatch_boundary_path_edge_ellipses == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (hatch_boundary_path_edge_ellipses != NULL)
         {
                 DxfHatchBoundaryPathEdgeEllipse *iter = (DxfHatchBoundaryPathEdgeEllipse *) hatch_boundary_path_edge_ellipses->next;
+                hatch_boundary_path_edge_ellipses->next = NULL;
                 dxf_hatch_boundary_path_edge_ellipse_free (hatch_boundary_path_edge_ellipses);
                 hatch_boundary_path_edge_ellipses = (DxfHatchBoundaryPathEdgeEllipse *) iter;
         }
@@ -10164,7 +10777,7 @@ dxf_hatch_boundary_path_edge_ellipse_get_center_point
                  * file. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *p1 = NULL;
@@ -10217,7 +10830,7 @@ dxf_hatch_boundary_path_edge_ellipse_set_center_point
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -10394,7 +11007,7 @@ dxf_hatch_boundary_path_edge_ellipse_get_end_point
                  * file. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *p1 = NULL;
@@ -10447,7 +11060,7 @@ dxf_hatch_boundary_path_edge_ellipse_set_end_point
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -10922,7 +11535,7 @@ dxf_hatch_boundary_path_edge_line_new ()
         size = sizeof (DxfHatchBoundaryPathEdgeLine);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((line = malloc (size)) == NULL)
+        if ((line = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -10960,14 +11573,14 @@ dxf_hatch_boundary_path_edge_line_init
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 line = dxf_hatch_boundary_path_edge_line_new ();
         }
         if (line == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -11009,19 +11622,19 @@ dxf_hatch_boundary_path_edge_line_free
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (line);
+        dxf_free (line);
         line = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -11042,19 +11655,20 @@ dxf_hatch_boundary_path_edge_line_free_list
                  * boundary path edge lines. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (hatch_boundary_path_edge_lines == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (hatch_boundary_path_edge_lines != NULL)
         {
                 DxfHatchBoundaryPathEdgeLine *iter = (DxfHatchBoundaryPathEdgeLine *) hatch_boundary_path_edge_lines->next;
+                hatch_boundary_path_edge_lines->next = NULL;
                 dxf_hatch_boundary_path_edge_line_free (hatch_boundary_path_edge_lines);
                 hatch_boundary_path_edge_lines = (DxfHatchBoundaryPathEdgeLine *) iter;
         }
@@ -11285,7 +11899,7 @@ dxf_hatch_boundary_path_edge_line_get_start_point
                  * file. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *p1 = NULL;
@@ -11344,7 +11958,7 @@ dxf_hatch_boundary_path_edge_line_set_start_point
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -11515,7 +12129,7 @@ dxf_hatch_boundary_path_edge_line_get_end_point
                  * file. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *p2 = NULL;
@@ -11574,7 +12188,7 @@ dxf_hatch_boundary_path_edge_line_set_end_point
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -11745,7 +12359,7 @@ dxf_hatch_boundary_path_edge_spline_new ()
         size = sizeof (DxfHatchBoundaryPathEdgeSpline);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((spline = malloc (size)) == NULL)
+        if ((spline = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -11785,14 +12399,14 @@ dxf_hatch_boundary_path_edge_spline_init
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 spline = dxf_hatch_boundary_path_edge_spline_new ();
         }
         if (spline == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -11840,20 +12454,20 @@ dxf_hatch_boundary_path_edge_spline_free
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (spline->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (spline->control_points);
-        free (spline);
+        dxf_free (spline->control_points);
+        dxf_free (spline);
         spline = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -11874,19 +12488,20 @@ dxf_hatch_boundary_path_edge_spline_free_list
                  * boundary path edge splines. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (hatch_boundary_path_edge_splines == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (hatch_boundary_path_edge_splines != NULL)
         {
                 DxfHatchBoundaryPathEdgeSpline *iter = (DxfHatchBoundaryPathEdgeSpline *) hatch_boundary_path_edge_splines->next;
+                hatch_boundary_path_edge_splines->next = NULL;
                 dxf_hatch_boundary_path_edge_spline_free (hatch_boundary_path_edge_splines);
                 hatch_boundary_path_edge_splines = (DxfHatchBoundaryPathEdgeSpline *) iter;
         }
@@ -12587,7 +13202,7 @@ dxf_hatch_boundary_path_edge_spline_append_control_point
         }
         if (sizeof (spline) < sizeof (DxfHatchBoundaryPathEdgeSpline))
         {
-                spline = realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
+                spline = dxf_realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
         }
         if (spline->control_points == NULL)
         {
@@ -12728,7 +13343,7 @@ dxf_hatch_boundary_path_edge_spline_prepend_control_point
         }
         if (sizeof (spline) < sizeof (DxfHatchBoundaryPathEdgeSpline))
         {
-                spline = realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
+                spline = dxf_realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
         }
         if (spline->control_points == NULL)
         {
@@ -12814,7 +13429,7 @@ dxf_hatch_boundary_path_edge_spline_get_control_point
         }
         if (sizeof (spline) < sizeof (DxfHatchBoundaryPathEdgeSpline))
         {
-                spline = realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
+                spline = dxf_realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
         }
         if (spline->number_of_control_points <= position)
         {
@@ -12912,7 +13527,7 @@ dxf_hatch_boundary_path_edge_spline_set_control_point
         }
         if (sizeof (spline) < sizeof (DxfHatchBoundaryPathEdgeSpline))
         {
-                spline = realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
+                spline = dxf_realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
         }
         if (spline->number_of_control_points <= position)
         {
@@ -13101,7 +13716,7 @@ dxf_hatch_boundary_path_edge_spline_insert_control_point
         }
         if (sizeof (spline) < sizeof (DxfHatchBoundaryPathEdgeSpline))
         {
-                spline = realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
+                spline = dxf_realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
         }
         if (spline->control_points == NULL)
         {
@@ -13233,7 +13848,7 @@ dxf_hatch_boundary_path_edge_spline_remove_control_point
         }
         if (sizeof (spline) < sizeof (DxfHatchBoundaryPathEdgeSpline))
         {
-                spline = realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
+                spline = dxf_realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
         }
         if (spline->control_points == NULL)
         {
@@ -13396,7 +14011,7 @@ dxf_hatch_boundary_path_edge_spline_copy_control_points
         }
         if (sizeof (spline) < sizeof (DxfHatchBoundaryPathEdgeSpline))
         {
-                spline = realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
+                spline = dxf_realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
         }
         if (spline->control_points == NULL)
         {
@@ -14006,6 +14621,101 @@ dxf_hatch_boundary_path_edge_spline_get_last
 }
 
 
+/*!
+ * \brief Tessellate a DXF \c HATCH boundary path edge spline into a
+ * polyline.
+ *
+ * A new curve is started in \c tessellation, the points are in the
+ * Object Coordinate System (OCS) of the hatch with a Z-value of 0.0.\n
+ * The weights of the control points are only used for rational
+ * splines.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_boundary_path_edge_spline_tessellate
+(
+        DxfHatchBoundaryPathEdgeSpline *spline,
+                /*!< a pointer to a DXF \c HATCH boundary path spline. */
+        double tolerance,
+                /*!< maximum distance between the spline and the
+                 * polyline (chord tolerance). */
+        DxfTessellation *tessellation
+                /*!< a pointer to the \c DxfTessellation receiving the
+                 * points. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPathEdgeSplineCp *iter = NULL;
+        double *cpw = NULL;
+        int number_of_control_points;
+        int number_of_knots;
+        int result;
+        int i;
+
+        /* Do some basic checks. */
+        if ((spline == NULL) || (tessellation == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_tessellation_begin_curve (tessellation) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        number_of_control_points = 0;
+        for (iter = (DxfHatchBoundaryPathEdgeSplineCp *) spline->control_points;
+          iter != NULL;
+          iter = (DxfHatchBoundaryPathEdgeSplineCp *) iter->next)
+        {
+                number_of_control_points++;
+        }
+        if (number_of_control_points == 0)
+        {
+#if DEBUG
+                DXF_DEBUG_END
+#endif
+                return (EXIT_SUCCESS);
+        }
+        cpw = dxf_malloc (4 * number_of_control_points * sizeof (double));
+        if (cpw == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        i = 0;
+        for (iter = (DxfHatchBoundaryPathEdgeSplineCp *) spline->control_points;
+          iter != NULL;
+          iter = (DxfHatchBoundaryPathEdgeSplineCp *) iter->next)
+        {
+                cpw[4 * i] = iter->x0;
+                cpw[4 * i + 1] = iter->y0;
+                cpw[4 * i + 2] = 0.0;
+                cpw[4 * i + 3] = spline->rational ? iter->weight : 1.0;
+                i++;
+        }
+        number_of_knots = spline->number_of_knots;
+        if (number_of_knots > DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS)
+        {
+                number_of_knots = DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS;
+        }
+        result = dxf_nurbs_tessellate (spline->degree,
+          number_of_control_points, cpw, number_of_knots, spline->knots,
+          tolerance, tessellation);
+        dxf_free (cpw);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
 /* dxf_hatch_boundary_path_edge_splie_control_point functions. */
 
 /*!
@@ -14026,7 +14736,7 @@ dxf_hatch_boundary_path_edge_spline_control_point_new ()
         size = sizeof (DxfHatchBoundaryPathEdgeSplineCp);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((control_point = malloc (size)) == NULL)
+        if ((control_point = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -14064,14 +14774,14 @@ dxf_hatch_boundary_path_edge_spline_control_point_init
         /* Do some basic checks. */
         if (control_point == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 control_point = dxf_hatch_boundary_path_edge_spline_control_point_new ();
         }
         if (control_point == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -14112,19 +14822,19 @@ dxf_hatch_boundary_path_edge_spline_control_point_free
         /* Do some basic checks. */
         if (control_point == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (control_point->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (control_point);
+        dxf_free (control_point);
         control_point = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -14146,19 +14856,20 @@ dxf_hatch_boundary_path_edge_spline_control_point_free_list
                  * boundary path edge spline control points. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (hatch_boundary_path_edge_spline_control_points == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (hatch_boundary_path_edge_spline_control_points != NULL)
         {
                 DxfHatchBoundaryPathEdgeSplineCp *iter = (DxfHatchBoundaryPathEdgeSplineCp *) hatch_boundary_path_edge_spline_control_points->next;
+                hatch_boundary_path_edge_spline_control_points->next = NULL;
                 dxf_hatch_boundary_path_edge_spline_control_point_free (hatch_boundary_path_edge_spline_control_points);
                 hatch_boundary_path_edge_spline_control_points = (DxfHatchBoundaryPathEdgeSplineCp *) iter;
         }
@@ -14398,7 +15109,7 @@ dxf_hatch_boundary_path_edge_spline_cp_get_point
                  * file. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *p1 = NULL;
@@ -14452,7 +15163,7 @@ dxf_hatch_boundary_path_edge_spline_cp_set_point
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
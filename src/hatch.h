@@ -48,6 +48,7 @@
 #include "global.h"
 #include "point.h"
 #include "binary_data.h"
+#include "tessellation.h"
 
 
 #ifdef __cplusplus
@@ -57,6 +58,9 @@ extern "C" {
 
 #define DXF_MAX_HATCH_PATTERN_DEF_LINE_DASH_ITEMS 16
 #define DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS 64
+#define DXF_HATCH_ON_EDGE_TOLERANCE 1.0e-12
+        /*!< \brief Relative tolerance on the squared radius for a point
+         * to be considered on an arc of a boundary path. */
 
 
 /*!
@@ -822,6 +826,7 @@ DxfHatchBoundaryPathPolylineVertex *dxf_hatch_boundary_path_polyline_get_vertice
 DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_polyline_set_vertices (DxfHatchBoundaryPathPolyline *polyline, DxfHatchBoundaryPathPolylineVertex *vertices);
 int dxf_hatch_boundary_path_polyline_close_polyline (DxfHatchBoundaryPathPolyline *polyline);
 int dxf_hatch_boundary_path_polyline_point_inside_polyline (DxfHatchBoundaryPathPolyline *polyline, DxfPoint *point);
+int dxf_hatch_boundary_path_polyline_points_inside_polyline (DxfHatchBoundaryPathPolyline *polyline, const double *xy, size_t number_of_points, int *results);
 DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_polyline_get_next (DxfHatchBoundaryPathPolyline *polyline);
 DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_polyline_set_next (DxfHatchBoundaryPathPolyline *polyline, DxfHatchBoundaryPathPolyline *next);
 DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_polyline_get_last (DxfHatchBoundaryPathPolyline *polyline);
@@ -848,6 +853,8 @@ DxfHatchBoundaryPathPolylineVertex *dxf_hatch_boundary_path_polyline_vertex_get_
 /* dxf_hatch_boundary_path_edge functions. */
 DxfHatchBoundaryPathEdge *dxf_hatch_boundary_path_edge_new ();
 DxfHatchBoundaryPathEdge * dxf_hatch_boundary_path_edge_init (DxfHatchBoundaryPathEdge *edge);
+int dxf_hatch_boundary_path_edge_count (DxfHatchBoundaryPathEdge *edge);
+int dxf_hatch_boundary_path_edge_write (DxfFile *fp, DxfHatchBoundaryPathEdge *edge);
 int dxf_hatch_boundary_path_edge_free (DxfHatchBoundaryPathEdge *edge);
 void dxf_hatch_boundary_path_edge_free_list (DxfHatchBoundaryPathEdge *edges);
 int dxf_hatch_boundary_path_edge_get_id_code (DxfHatchBoundaryPathEdge *edge);
@@ -977,6 +984,7 @@ int dxf_hatch_boundary_path_edge_spline_copy_knot_values (DxfHatchBoundaryPathEd
 DxfHatchBoundaryPathEdgeSpline *dxf_hatch_boundary_path_edge_spline_get_next (DxfHatchBoundaryPathEdgeSpline *spline);
 DxfHatchBoundaryPathEdgeSpline *dxf_hatch_boundary_path_edge_spline_set_next (DxfHatchBoundaryPathEdgeSpline *spline, DxfHatchBoundaryPathEdgeSpline *next);
 DxfHatchBoundaryPathEdgeSpline *dxf_hatch_boundary_path_edge_spline_get_last (DxfHatchBoundaryPathEdgeSpline *spline);
+int dxf_hatch_boundary_path_edge_spline_tessellate (DxfHatchBoundaryPathEdgeSpline *spline, double tolerance, DxfTessellation *tessellation);
 /* dxf_hatch_boundary_path_edge_spline_control_point functions. */
 DxfHatchBoundaryPathEdgeSplineCp *dxf_hatch_boundary_path_edge_spline_control_point_new ();
 DxfHatchBoundaryPathEdgeSplineCp *dxf_hatch_boundary_path_edge_spline_control_point_init (DxfHatchBoundaryPathEdgeSplineCp *control_point);
@@ -74,7 +74,7 @@ dxf_header_new ()
         size = sizeof (DxfHeader);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((header = malloc (size)) == NULL)
+        if ((header = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfHeader struct.\n")),
@@ -209,14 +209,14 @@ dxf_header_init
         /* Do some basic checks. */
         if (header == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 header = dxf_header_new ();
         }
         if (header == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHeader struct.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -233,12 +233,12 @@ dxf_header_init
                         header->AttDia = 0;
                         header->AttReq = 1;
                         header->Handling = 1;
-                        header->HandSeed = strdup ("233");
+                        header->HandSeed = dxf_strdup ("233");
 
                 }
                 case AC1012: /* AutoCAD 13 */
                 {
-                        header->DWGCodePage = strdup ("ANSI_1252");
+                        header->DWGCodePage = dxf_strdup ("ANSI_1252");
                         header->DragMode = 2;
                         header->OSMode = 125;
                         header->CELTScale = 1.0;
@@ -258,7 +258,7 @@ dxf_header_init
                         header->DimTDEC = 4;
                         header->DimALTU = 2;
                         header->DimALTTD = 2;
-                        header->DimTXSTY = strdup ("STANDARD");
+                        header->DimTXSTY = dxf_strdup ("STANDARD");
                         header->DimAUNIT = 0;
                         header->BlipMode = 0;
                         header->ChamferC = 10.0;
@@ -267,10 +267,10 @@ dxf_header_init
                         header->AttDia = 0;
                         header->AttReq = 1;
                         header->Handling = 1;
-                        header->HandSeed = strdup ("233");
+                        header->HandSeed = dxf_strdup ("233");
                         header->TreeDepth = 3020;
                         header->PickStyle = 1;
-                        header->CMLStyle = strdup ("STANDARD");
+                        header->CMLStyle = dxf_strdup ("STANDARD");
                         header->CMLJust = 0;
                         header->CMLScale = 1.0;
                         header->SaveImages = 1;
@@ -278,7 +278,7 @@ dxf_header_init
                 case AC1014: /* AutoCAD 14 */
                 {
                         header->AcadMaintVer = 0;
-                        header->DWGCodePage = strdup ("ANSI_1252");
+                        header->DWGCodePage = dxf_strdup ("ANSI_1252");
                         header->DragMode = 2;
                         header->OSMode = 125;
                         header->CELTScale = 1.0;
@@ -298,7 +298,7 @@ dxf_header_init
                         header->DimTDEC = 4;
                         header->DimALTU = 2;
                         header->DimALTTD = 2;
-                        header->DimTXSTY = strdup ("STANDARD");
+                        header->DimTXSTY = dxf_strdup ("STANDARD");
                         header->DimAUNIT = 0;
                         header->BlipMode = 0;
                         header->ChamferC = 10.0;
@@ -307,10 +307,10 @@ dxf_header_init
                         header->AttDia = 0;
                         header->AttReq = 1;
                         header->Handling = 1;
-                        header->HandSeed = strdup ("262");
+                        header->HandSeed = dxf_strdup ("262");
                         header->TreeDepth = 3020;
                         header->PickStyle = 1;
-                        header->CMLStyle = strdup ("STANDARD");
+                        header->CMLStyle = dxf_strdup ("STANDARD");
                         header->CMLJust = 0;
                         header->CMLScale = 1.0;
                         header->ProxyGraphics = 1;
@@ -319,7 +319,7 @@ dxf_header_init
                 case AC1015: /* AutoCAD 2000 */
                 {
                         header->AcadMaintVer = 20;
-                        header->DWGCodePage = strdup ("ANSI_1252");
+                        header->DWGCodePage = dxf_strdup ("ANSI_1252");
                         header->CELTScale = 1.0;
                         header->DispSilH = 0;
                         header->DimJUST = 0;
@@ -334,7 +334,7 @@ dxf_header_init
                         header->DimTDEC = 4;
                         header->DimALTU = 2;
                         header->DimALTTD = 2;
-                        header->DimTXSTY = strdup ("STANDARD");
+                        header->DimTXSTY = dxf_strdup ("STANDARD");
                         header->DimAUNIT = 0;
                         header->DimADEC = 0;
                         header->DimALTRND = 0.0;
@@ -342,7 +342,7 @@ dxf_header_init
                         header->DimDSEP = 46;
                         header->DimATFIT = 3;
                         header->DimFRAC = 0;
-                        header->DimLDRBLK = strdup ("");
+                        header->DimLDRBLK = dxf_strdup ("");
                         header->DimLUNIT = 2;
                         header->DimLWD = -2;
                         header->DimLWE = -2;
@@ -351,9 +351,9 @@ dxf_header_init
                         header->ChamferD = 10.0;
                         header->TDUCreate = 0.0;
                         header->TDUUpdate = 0.0;
-                        header->HandSeed = strdup ("274");
-                        header->UCSBase = strdup ("");
-                        header->UCSOrthoRef = strdup ("");
+                        header->HandSeed = dxf_strdup ("274");
+                        header->UCSBase = dxf_strdup ("");
+                        header->UCSOrthoRef = dxf_strdup ("");
                         header->UCSOrthoView = 0;
                         header->UCSOrgTop.x0 = 0.0;
                         header->UCSOrgTop.y0 = 0.0;
@@ -373,8 +373,8 @@ dxf_header_init
                         header->UCSOrgBack.x0 = 0.0;
                         header->UCSOrgBack.y0 = 0.0;
                         header->UCSOrgBack.z0 = 0.0;
-                        header->PUCSBase = strdup ("");
-                        header->PUCSOrthoRef = strdup ("");
+                        header->PUCSBase = dxf_strdup ("");
+                        header->PUCSOrthoRef = dxf_strdup ("");
                         header->PUCSOrthoView = 0;
                         header->PUCSOrgTop.x0 = 0.0;
                         header->PUCSOrgTop.y0 = 0.0;
@@ -395,7 +395,7 @@ dxf_header_init
                         header->PUCSOrgBack.y0 = 0.0;
                         header->PUCSOrgBack.z0 = 0.0;
                         header->TreeDepth = 3020;
-                        header->CMLStyle = strdup ("STANDARD");
+                        header->CMLStyle = dxf_strdup ("STANDARD");
                         header->CMLJust = 0;
                         header->CMLScale = 1.0;
                         header->ProxyGraphics = 1;
@@ -405,13 +405,13 @@ dxf_header_init
                         header->JoinStyle = 0;
                         header->LWDisplay = 0;
                         header->InsUnits = 0;
-                        header->HyperLinkBase = strdup ("");
-                        header->StyleSheet = strdup ("");
+                        header->HyperLinkBase = dxf_strdup ("");
+                        header->StyleSheet = dxf_strdup ("");
                         header->XEdit = 1;
                         header->CEPSNType = 0;
                         header->PStyleMode = 1;
-                        header->FingerPrintGUID = strdup ("");
-                        header->VersionGUID = strdup ("");
+                        header->FingerPrintGUID = dxf_strdup ("");
+                        header->VersionGUID = dxf_strdup ("");
                         header->ExtNames = 0;
                         header->PSVPScale = 0.0;
                         header->OLEStartUp = 0;
@@ -419,7 +419,7 @@ dxf_header_init
                 case AC1018: /* AutoCAD 2004 */
                 {
                         header->AcadMaintVer = 0;
-                        header->DWGCodePage = strdup ("ANSI_1252");
+                        header->DWGCodePage = dxf_strdup ("ANSI_1252");
                         header->CELTScale = 1.0;
                         header->DispSilH = 0;
                         header->DimJUST = 0;
@@ -434,7 +434,7 @@ dxf_header_init
                         header->DimTDEC = 4;
                         header->DimALTU = 2;
                         header->DimALTTD = 2;
-                        header->DimTXSTY = strdup ("STANDARD");
+                        header->DimTXSTY = dxf_strdup ("STANDARD");
                         header->DimAUNIT = 0;
                         header->DimADEC = 0;
                         header->DimALTRND = 0.0;
@@ -442,7 +442,7 @@ dxf_header_init
                         header->DimDSEP = 46;
                         header->DimATFIT = 3;
                         header->DimFRAC = 0;
-                        header->DimLDRBLK = strdup ("");
+                        header->DimLDRBLK = dxf_strdup ("");
                         header->DimLUNIT = 2;
                         header->DimLWD = -2;
                         header->DimLWE = -2;
@@ -451,9 +451,9 @@ dxf_header_init
                         header->ChamferD = 10.0;
                         header->TDUCreate = 0.0;
                         header->TDUUpdate = 0.0;
-                        header->HandSeed = strdup ("26A");
-                        header->UCSBase = strdup ("");
-                        header->UCSOrthoRef = strdup ("");
+                        header->HandSeed = dxf_strdup ("26A");
+                        header->UCSBase = dxf_strdup ("");
+                        header->UCSOrthoRef = dxf_strdup ("");
                         header->UCSOrthoView = 0;
                         header->UCSOrgTop.x0 = 0.0;
                         header->UCSOrgTop.y0 = 0.0;
@@ -473,8 +473,8 @@ dxf_header_init
                         header->UCSOrgBack.x0 = 0.0;
                         header->UCSOrgBack.y0 = 0.0;
                         header->UCSOrgBack.z0 = 0.0;
-                        header->PUCSBase = strdup ("");
-                        header->PUCSOrthoRef = strdup ("");
+                        header->PUCSBase = dxf_strdup ("");
+                        header->PUCSOrthoRef = dxf_strdup ("");
                         header->PUCSOrthoView = 0;
                         header->PUCSOrgTop.x0 = 0.0;
                         header->PUCSOrgTop.y0 = 0.0;
@@ -495,7 +495,7 @@ dxf_header_init
                         header->PUCSOrgBack.y0 = 0.0;
                         header->PUCSOrgBack.z0 = 0.0;
                         header->TreeDepth = 3020;
-                        header->CMLStyle = strdup ("STANDARD");
+                        header->CMLStyle = dxf_strdup ("STANDARD");
                         header->CMLJust = 0;
                         header->CMLScale = 1.0;
                         header->ProxyGraphics = 1;
@@ -505,13 +505,13 @@ dxf_header_init
                         header->JoinStyle = 0;
                         header->LWDisplay = 0;
                         header->InsUnits = 0;
-                        header->HyperLinkBase = strdup ("");
-                        header->StyleSheet = strdup ("");
+                        header->HyperLinkBase = dxf_strdup ("");
+                        header->StyleSheet = dxf_strdup ("");
                         header->XEdit = 1;
                         header->CEPSNType = 0;
                         header->PStyleMode = 1;
-                        header->FingerPrintGUID = strdup ("");
-                        header->VersionGUID = strdup ("");
+                        header->FingerPrintGUID = dxf_strdup ("");
+                        header->VersionGUID = dxf_strdup ("");
                         header->ExtNames = 0;
                         header->PSVPScale = 0.0;
                         header->OLEStartUp = 0;
@@ -525,10 +525,10 @@ dxf_header_init
                         header->InterSectionDisplay = 0;
                         header->InterSectionColor = 257;
                         header->DimASSOC = 1;
-                        header->ProjectName = strdup ("");
+                        header->ProjectName = dxf_strdup ("");
                 }
         }
-        header->AcadVer = strdup (dxf_header_acad_version_to_string (acad_version_number));
+        header->AcadVer = dxf_strdup (dxf_header_acad_version_to_string (acad_version_number));
         header->InsBase.x0 = 0.0;
         header->InsBase.y0 = 0.0;
         header->InsBase.z0 = 0.0;
@@ -551,9 +551,9 @@ dxf_header_init
         header->AttMode = 1;
         header->TextSize = 2.5;
         header->TraceWid = 1.0;
-        header->TextStyle = strdup ("STANDARD");
-        header->CELType = strdup ("BYLAYER");
-        header->CLayer = strdup ("0");
+        header->TextStyle = dxf_strdup ("STANDARD");
+        header->CELType = dxf_strdup ("BYLAYER");
+        header->CLayer = dxf_strdup ("0");
         header->CEColor = 256;
         header->DimSCALE = 1.0;
         header->DimASZ = 2.5;
@@ -575,11 +575,11 @@ dxf_header_init
         header->DimSE2 = 0;
         header->DimTAD = 1;
         header->DimZIN = 8;
-        header->DimBLK = strdup ("");
+        header->DimBLK = dxf_strdup ("");
         header->DimASO = 1;
         header->DimSHO = 1;
-        header->DimPOST = strdup ("");
-        header->DimAPOST = strdup ("");
+        header->DimPOST = dxf_strdup ("");
+        header->DimAPOST = dxf_strdup ("");
         header->DimALT = 0;
         header->DimALTD = 4;
         header->DimALTF = 0.0394;
@@ -589,8 +589,8 @@ dxf_header_init
         header->DimTIX = 0;
         header->DimSOXD = 0;
         header->DimSAH = 0;
-        header->DimBLK1 = strdup ("");
-        header->DimBLK2 = strdup ("");
+        header->DimBLK1 = dxf_strdup ("");
+        header->DimBLK2 = dxf_strdup ("");
         header->DimCLRD = 0;
         header->DimCLRE = 0;
         header->DimCLRT = 0;
@@ -602,7 +602,7 @@ dxf_header_init
         header->FilletRad = 1.0;
         header->AUnits = 0;
         header->AUPrec = 0;
-        header->Menu = strdup (".");
+        header->Menu = dxf_strdup (".");
         header->Elevation = 0.0;
         header->PElevation = 0.0;
         header->Thickness = 0.0;
@@ -628,7 +628,7 @@ dxf_header_init
         header->SurfType = 6;
         header->SurfU = 6;
         header->SurfV = 6;
-        header->UCSName = strdup ("");
+        header->UCSName = dxf_strdup ("");
         header->UCSOrg.x0 = 0.0;
         header->UCSOrg.y0 = 0.0;
         header->UCSOrg.z0 = 0.0;
@@ -638,7 +638,7 @@ dxf_header_init
         header->UCSYDir.x0 = 0.0;
         header->UCSYDir.y0 = 0.0;
         header->UCSYDir.z0 = 0.0;
-        header->PUCSName = strdup ("");
+        header->PUCSName = dxf_strdup ("");
         header->PUCSOrg.x0 = 0.0;
         header->PUCSOrg.y0 = 0.0;
         header->PUCSOrg.z0 = 0.0;
@@ -840,7 +840,8 @@ dxf_header_write_metric_new
         time_t now;
         if (time(&now) != (time_t)(-1))
         {
-            struct tm *current_time = localtime(&now);
+            struct tm local_time;
+            struct tm *current_time = localtime_r(&now, &local_time);
 
             JD=current_time->tm_mday-32075+1461*(current_time->tm_year+6700+(current_time->tm_mon-13)/12)/4+367*(current_time->tm_mon-1-(current_time->tm_mon-13)/12*12)/12-3*((current_time->tm_year+6800+(current_time->tm_mon-13)/12)/100)/4;
             /* Transforms the current local gregorian date in a julian date.*/
@@ -936,25 +937,25 @@ dxf_header_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("HEADER");
+        char *dxf_entity_name = dxf_strdup ("HEADER");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (header == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         dxf_section_write (fp, dxf_entity_name);
@@ -1187,7 +1188,7 @@ dxf_header_write
         if (fp->acad_version_number >= AC1018) fprintf (fp->fp, "  9\n$PROJECTNAME\n  1\n%s\n", header->ProjectName);
         dxf_endsec_write (fp);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1216,7 +1217,7 @@ dxf_header_read_parse_string
                 dxf_read_scanf (fp, "%i\n%s\n", &n, tstring);
                 if (dxf_read_is_string(n))
                 {
-                        *value_string = strdup(tstring);
+                        *value_string = dxf_strdup(tstring);
                 }
                 else
                         ret = FAIL;
@@ -1885,35 +1886,41 @@ dxf_header_read
 
         char line_in[256];
         char temp_string[256];
-        int ch;
+        int group_code;
 
-        while((ch = fgetc(fp->fp)) != EOF)
+        /* Read group code lines: a 9 is followed by a variable name, a 0
+         * ends the header section, and the value of any other group
+         * code (of an ignored or unknown variable) is skipped. */
+        while(fgets(line_in, sizeof(line_in), fp->fp) != NULL)
         {
-            /* Skip whitespace */
-            if(isspace(ch))
+            fp->line_number++;
+            if(sscanf(line_in, "%d", &group_code) != 1)
             {
-                if(ch == '\n')
+                /* Skip empty lines. */
+                continue;
+            }
+            if(group_code == 0)
+            {
+                /* End of header section */
+                break;
+            }
+            if(group_code != 9)
+            {
+                if(fgets(line_in, sizeof(line_in), fp->fp) == NULL)
                 {
-                    fp->line_number++;
+                    break;
                 }
+                fp->line_number++;
                 continue;
             }
-
-            if(ch == '9')
             {
-                /* Skip to variable name */
-                while((ch = fgetc(fp->fp)) != '$')
+                if(fgets(line_in, sizeof(line_in), fp->fp) == NULL)
                 {
-                    if(ch == '\n')
-                    {
-                        fp->line_number++;
-                    }
-                    continue;
+                    break;
                 }
-                ungetc(ch, fp->fp);
-                fgets(line_in, sizeof(line_in), fp->fp);
                 fp->line_number++;
-                sscanf(line_in, "%s", temp_string);
+                temp_string[0] = '\0';
+                sscanf(line_in, "%255s", temp_string);
                 /* TODO: Match temp_string to variable name, then get
                  * value for variable */
                 if(!strcmp(temp_string, "$ACADMAINTVER"))
@@ -2791,12 +2798,6 @@ dxf_header_read
                  * specifications more recent than 2012. */
 
             }
-
-            if(ch == '0')
-            {
-                /* End of header section */
-                break;
-            }
         }
 
 #if DEBUG
@@ -2826,43 +2827,43 @@ dxf_header_free
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (header == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (header);
         }
-        free (header->AcadVer);
-        free (header->DWGCodePage);
+        dxf_free (header->AcadVer);
+        dxf_free (header->DWGCodePage);
 //        dxf_point_free ((struct DxfPoint) header->InsBase);
 //        dxf_point_free ((struct DxfPoint) header->ExtMin);
 //        dxf_point_free ((struct DxfPoint) header->ExtMax);
 //        dxf_point_free ((struct DxfPoint) header->LimMin);
 //        dxf_point_free ((struct DxfPoint) header->LimMax);
-        free (header->TextStyle);
-        free (header->CLayer);
-        free (header->CELType);
-        free (header->DimBLK);
-        free (header->DimPOST);
-        free (header->DimAPOST);
-        free (header->DimBLK1);
-        free (header->DimBLK2);
-        free (header->DimSTYLE);
-        free (header->DimTXSTY);
-        free (header->DimLDRBLK);
-        free (header->Menu);
-        free (header->HandSeed);
-        free (header->UCSBase);
-        free (header->UCSName);
+        dxf_free (header->TextStyle);
+        dxf_free (header->CLayer);
+        dxf_free (header->CELType);
+        dxf_free (header->DimBLK);
+        dxf_free (header->DimPOST);
+        dxf_free (header->DimAPOST);
+        dxf_free (header->DimBLK1);
+        dxf_free (header->DimBLK2);
+        dxf_free (header->DimSTYLE);
+        dxf_free (header->DimTXSTY);
+        dxf_free (header->DimLDRBLK);
+        dxf_free (header->Menu);
+        dxf_free (header->HandSeed);
+        dxf_free (header->UCSBase);
+        dxf_free (header->UCSName);
 //        dxf_point_free ((struct DxfPoint) header->UCSOrg);
 //        dxf_point_free ((struct DxfPoint) header->UCSXDir);
 //        dxf_point_free ((struct DxfPoint) header->UCSYDir);
-        free (header->UCSOrthoRef);
+        dxf_free (header->UCSOrthoRef);
 //        dxf_point_free ((struct DxfPoint) header->UCSOrgTop);
 //        dxf_point_free ((struct DxfPoint) header->UCSOrgBottom);
 //        dxf_point_free ((struct DxfPoint) header->UCSOrgLeft);
@@ -2872,7 +2873,7 @@ dxf_header_free
 //        dxf_point_free ((struct DxfPoint) header->PUCSOrg);
 //        dxf_point_free ((struct DxfPoint) header->PUCSXDir);
 //        dxf_point_free ((struct DxfPoint) header->PUCSYDir);
-        free (header->PUCSOrthoRef);
+        dxf_free (header->PUCSOrthoRef);
 //        dxf_point_free ((struct DxfPoint) header->PUCSOrgTop);
 //        dxf_point_free ((struct DxfPoint) header->PUCSOrgBottom);
 //        dxf_point_free ((struct DxfPoint) header->PUCSOrgLeft);
@@ -2884,15 +2885,15 @@ dxf_header_free
 //        dxf_point_free ((struct DxfPoint) header->PExtMax);
 //        dxf_point_free ((struct DxfPoint) header->PLimMin);
 //        dxf_point_free ((struct DxfPoint) header->PLimMax);
-        free (header->CMLStyle);
-        free (header->HyperLinkBase);
-        free (header->StyleSheet);
-        free (header->FingerPrintGUID);
-        free (header->VersionGUID);
-        free (header->ProjectName);
-        free (header);
+        dxf_free (header->CMLStyle);
+        dxf_free (header->HyperLinkBase);
+        dxf_free (header->StyleSheet);
+        dxf_free (header->FingerPrintGUID);
+        dxf_free (header->VersionGUID);
+        dxf_free (header->ProjectName);
+        dxf_free (header);
         header = NULL;
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_END
 #endif
         return (header);
@@ -2958,7 +2959,7 @@ dxf_header_get_int_variable
                 {
                         continue;
                 }
-                else if(isdigit(ch))
+                else if(isdigit(ch) || (ch == '-') || (ch == '+'))
                 {
                         /* Store the variable value in the result */
                         ungetc(ch, fp->fp);
@@ -3041,7 +3042,7 @@ dxf_header_get_int16_variable
                 {
                         continue;
                 }
-                else if(isdigit(ch))
+                else if(isdigit(ch) || (ch == '-') || (ch == '+'))
                 {
                         /* Store the variable value in the result */
                         ungetc(ch, fp->fp);
@@ -3125,7 +3126,7 @@ dxf_header_get_double_variable
                 {
                         continue;
                 }
-                else if(isdigit(ch))
+                else if(isdigit(ch) || (ch == '-') || (ch == '+') || (ch == '.'))
                 {
                         /* Store the variable value in the result */
                         ungetc(ch, fp->fp);
@@ -3197,46 +3198,25 @@ dxf_header_get_string_variable
                 }
         }
 
-        while((ch = fgetc(fp->fp))!= EOF)
+        /* The value is the next line, it may start with a digit (a
+         * handle) or be empty. */
+        char line_in[DXF_MAX_STRING_LENGTH] = {};
+        char temp_string[DXF_MAX_STRING_LENGTH] = {};
+        if(fgets(line_in, sizeof(line_in), fp->fp) != NULL)
         {
-                /* Skip whitespace */
-                if(ch == '\n')
-                {
-                        fp->line_number++;
-                }
-                else if(isspace(ch))
-                {
-                        continue;
-                }
-                else if(isalpha(ch))
-                {
-                        /* Store the variable value in the result */
-                        ungetc(ch, fp->fp);
-                        char line_in[64] = {};
-                        char temp_string[64] = {};
-                        fgets(line_in, sizeof(line_in), fp->fp);
-                        sscanf(line_in, "%s", temp_string);
-                        /* Swap out the default string for the new one */
-                        free(*res);
-                        *res = strdup(temp_string);
-                        break;
-                }
-                else
-                {
-                        ungetc(ch, fp->fp);
-                        char line_in[64] = {};
-                        fgets(line_in, sizeof(line_in), fp->fp);
-                        fprintf(stderr, (_("Warning in %s () unknown input: %s"
-                                           "File: %s\n"
-                                           "Line: %d\n")),
-                                __FUNCTION__, line_in, fp->filename, fp->line_number);
-                        fp->line_number++;
-                }
+                fp->line_number++;
+                sscanf(line_in, "%s", temp_string);
+                /* Swap out the default string for the new one */
+                dxf_free(*res);
+                *res = dxf_strdup(temp_string);
         }
 }
 
 /*!
  *  \brief Read a DxfPoint variable from a /c DxfFile
+ *
+ *  A point variable holds an X-value (group code 10), an Y-value (group
+ *  code 20) and, for a 3D point only, a Z-value (group code 30).
  */
 static void
 dxf_header_get_dxf_point_variable
@@ -3248,7 +3228,22 @@ dxf_header_get_dxf_point_variable
         /*!< DXF file handle of input file (or device)  */
         )
 {
-        dxf_point_read(fp, res);
+        long position;
+        int group_code = 0;
+
+        dxf_header_get_double_variable(&res->x0, fp);
+        dxf_header_get_double_variable(&res->y0, fp);
+        /* Peek at the next group code for a Z-value. */
+        position = ftell(fp->fp);
+        if((fscanf(fp->fp, "%d", &group_code) == 1) && (group_code == 30))
+        {
+                fseek(fp->fp, position, SEEK_SET);
+                dxf_header_get_double_variable(&res->z0, fp);
+        }
+        else
+        {
+                fseek(fp->fp, position, SEEK_SET);
+        }
 }
 
 /* EOF */
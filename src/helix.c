@@ -60,7 +60,7 @@ dxf_helix_new ()
         size = sizeof (DxfHelix);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((helix = malloc (size)) == NULL)
+        if ((helix = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -98,22 +98,22 @@ dxf_helix_init
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 helix = dxf_helix_new ();
         }
         if (helix == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         /* Assign initial values to members. */
         helix->id_code = 0;
-        helix->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        helix->layer = strdup (DXF_DEFAULT_LAYER);
+        helix->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        helix->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         helix->thickness = 0.0;
         helix->radius = 0.0;
         helix->number_of_turns = 0.0;
@@ -128,13 +128,13 @@ dxf_helix_init
         helix->constraint_type = 0;
         helix->shadow_mode = 0;
         helix->handedness = 0;
-        helix->dictionary_owner_hard = strdup ("");
-        helix->material = strdup ("");
-        helix->dictionary_owner_soft = strdup ("");
+        helix->dictionary_owner_hard = dxf_strdup ("");
+        helix->material = dxf_strdup ("");
+        helix->dictionary_owner_soft = dxf_strdup ("");
         helix->lineweight = 0;
-        helix->plot_style_name = strdup ("");
+        helix->plot_style_name = dxf_strdup ("");
         helix->color_value = 0;
-        helix->color_name = strdup ("");
+        helix->color_name = dxf_strdup ("");
         helix->transparency = 0;
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
@@ -175,36 +175,34 @@ dxf_helix_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (helix == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 helix = dxf_helix_init (helix);
         }
         if (helix->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfBinaryData struct.\n")));
                 helix->binary_graphics_data = dxf_binary_graphics_data_init (helix->binary_graphics_data);
                 if (helix->binary_graphics_data == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -212,15 +210,15 @@ dxf_helix_read
         }
         if (helix->p0 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 helix->p0 = dxf_point_init (helix->p0);
                 if (helix->p0 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -228,15 +226,15 @@ dxf_helix_read
         }
         if (helix->p1 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 helix->p1 = dxf_point_init (helix->p1);
                 if (helix->p1 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -244,32 +242,30 @@ dxf_helix_read
         }
         if (helix->p2 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 helix->p2 = dxf_point_init (helix->p2);
                 if (helix->p2 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
                 }
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        memset (temp_string, 0, sizeof (temp_string));
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -284,13 +280,17 @@ dxf_helix_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->linetype);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (helix->linetype);
+                        helix->linetype = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->layer);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (helix->layer);
+                        helix->layer = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -445,7 +445,7 @@ dxf_helix_read
                         else if ((strcmp (temp_string, "AcDbEntity") != 0)
                                 && ((strcmp (temp_string, "AcDbHelix") != 0)))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -483,30 +483,35 @@ dxf_helix_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) helix->binary_graphics_data->next);
-                        helix->binary_graphics_data = (DxfBinaryGraphicsData *) helix->binary_graphics_data->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_graphics_data_append_hex ((DxfBinaryGraphicsData *) helix->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing a
                          * soft-pointer ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->dictionary_owner_soft);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (helix->dictionary_owner_soft);
+                        helix->dictionary_owner_soft = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "347") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->material);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (helix->material);
+                        helix->material = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->dictionary_owner_hard);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (helix->dictionary_owner_hard);
+                        helix->dictionary_owner_hard = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -520,7 +525,9 @@ dxf_helix_read
                         /* Now follows a string containing a plot style
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->plot_style_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (helix->plot_style_name);
+                        helix->plot_style_name = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -533,7 +540,9 @@ dxf_helix_read
                         /* Now follows a string containing a color
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->color_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (helix->color_name);
+                        helix->color_name = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -551,22 +560,25 @@ dxf_helix_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
+                        dxf_read_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (helix->linetype, "") == 0)
         {
-                helix->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_free (helix->linetype);
+                helix->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (helix->layer, "") == 0)
         {
-                helix->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_free (helix->layer);
+                helix->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -592,72 +604,71 @@ dxf_helix_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("HELIX");
+        char *dxf_entity_name = dxf_strdup ("HELIX");
         int i;
         DxfPoint *iter = NULL;
-        DxfBinaryGraphicsData *iter_310 = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (helix == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (helix->spline == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (helix->radius == 0.0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () radius value equals 0.0 for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, helix->id_code);
-                fprintf (stderr, "    skipping %s entity.\n",
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE, "    skipping %s entity.\n",
                         dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_2007)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (strcmp (helix->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, helix->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                helix->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                helix->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (helix->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, helix->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to default layer.\n")),
                   dxf_entity_name);
                 helix->layer = DXF_DEFAULT_LAYER;
@@ -705,12 +716,7 @@ dxf_helix_write
 #else
         fprintf (fp->fp, " 92\n%" PRIi32 "\n", helix->graphics_data_size);
 #endif
-        iter_310 = (DxfBinaryGraphicsData *) helix->binary_graphics_data;
-        while (iter_310 != NULL)
-        {
-                fprintf (fp->fp, "310\n%s\n", iter_310->data_line);
-                iter_310 = (DxfBinaryGraphicsData *) iter_310->next;
-        }
+        dxf_binary_graphics_data_write (fp, (DxfBinaryGraphicsData *) helix->binary_graphics_data);
         fprintf (fp->fp, "420\n%" PRIi32 "\n", helix->color_value);
         fprintf (fp->fp, "430\n%s\n", helix->color_name);
         fprintf (fp->fp, "440\n%" PRIi32 "\n", helix->transparency);
@@ -781,7 +787,7 @@ dxf_helix_write
         fprintf (fp->fp, "290\n%d\n", helix->handedness);
         fprintf (fp->fp, "280\n%hd\n", helix->constraint_type);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -810,30 +816,30 @@ dxf_helix_free
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (helix->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (helix->linetype);
-        free (helix->layer);
+        dxf_free (helix->linetype);
+        dxf_free (helix->layer);
         dxf_binary_graphics_data_free_list ((DxfBinaryGraphicsData *) helix->binary_graphics_data);
-        free (helix->dictionary_owner_hard);
-        free (helix->material);
-        free (helix->dictionary_owner_soft);
-        free (helix->plot_style_name);
-        free (helix->color_name);
+        dxf_free (helix->dictionary_owner_hard);
+        dxf_free (helix->material);
+        dxf_free (helix->dictionary_owner_soft);
+        dxf_free (helix->plot_style_name);
+        dxf_free (helix->color_name);
         dxf_point_free (helix->p0);
         dxf_point_free (helix->p1);
         dxf_point_free (helix->p2);
-        free (helix);
+        dxf_free (helix);
         helix = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -854,18 +860,19 @@ dxf_helix_free_list
                  * of DXF \c HELIX entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (helices == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (helices != NULL)
         {
                 DxfHelix *iter = (DxfHelix *) helices->next;
+                helices->next = NULL;
                 dxf_helix_free (helices);
                 helices = (DxfHelix *) iter;
         }
@@ -987,7 +994,7 @@ dxf_helix_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->linetype));
+        return (dxf_strdup (helix->linetype));
 }
 
 
@@ -1024,7 +1031,7 @@ dxf_helix_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->linetype = strdup (linetype);
+        helix->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1065,7 +1072,7 @@ dxf_helix_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->layer));
+        return (dxf_strdup (helix->layer));
 }
 
 
@@ -1102,7 +1109,7 @@ dxf_helix_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->layer = strdup (layer);
+        helix->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1821,7 +1828,7 @@ dxf_helix_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->dictionary_owner_soft));
+        return (dxf_strdup (helix->dictionary_owner_soft));
 }
 
 
@@ -1860,7 +1867,7 @@ dxf_helix_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        helix->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1904,7 +1911,7 @@ dxf_helix_get_object_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->object_owner_soft));
+        return (dxf_strdup (helix->object_owner_soft));
 }
 
 
@@ -1940,7 +1947,7 @@ dxf_helix_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->object_owner_soft = strdup (object_owner_soft);
+        helix->object_owner_soft = dxf_strdup (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1984,7 +1991,7 @@ dxf_helix_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->material));
+        return (dxf_strdup (helix->material));
 }
 
 
@@ -2022,7 +2029,7 @@ dxf_helix_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->material = strdup (material);
+        helix->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2067,7 +2074,7 @@ dxf_helix_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->dictionary_owner_hard));
+        return (dxf_strdup (helix->dictionary_owner_hard));
 }
 
 
@@ -2106,7 +2113,7 @@ dxf_helix_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        helix->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2213,7 +2220,7 @@ dxf_helix_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->plot_style_name));
+        return (dxf_strdup (helix->plot_style_name));
 }
 
 
@@ -2251,7 +2258,7 @@ dxf_helix_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->plot_style_name = strdup (plot_style_name);
+        helix->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2358,7 +2365,7 @@ dxf_helix_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->color_name));
+        return (dxf_strdup (helix->color_name));
 }
 
 
@@ -2396,7 +2403,7 @@ dxf_helix_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->color_name = strdup (color_name);
+        helix->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -0,0 +1,394 @@
+/*!
+ * \file hex.c
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for the hexadecimal codec for binary data (group codes 310 - 319).
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "hex.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+
+/*!
+ * \brief Upper case hexadecimal digits, as written by AutoCAD.
+ */
+static const char dxf_hex_digits[] = "0123456789ABCDEF";
+
+
+/*!
+ * \brief Value of a hexadecimal digit, -1 for any other character.
+ */
+static int
+dxf_hex_value
+(
+        unsigned char c
+)
+{
+        if ((c >= '0') && (c <= '9'))
+        {
+                return (c - '0');
+        }
+        c |= 0x20;
+        if ((c >= 'a') && (c <= 'f'))
+        {
+                return (c - 'a' + 10);
+        }
+        return (-1);
+}
+
+
+#ifdef __SSE2__
+/*!
+ * \brief Convert 16 hexadecimal characters to their nibble values.
+ *
+ * \c valid is set to the movemask of the valid characters.
+ */
+static __m128i
+dxf_hex_decode_nibbles_sse2
+(
+        __m128i c,
+        int *valid
+)
+{
+        __m128i lower = _mm_or_si128 (c, _mm_set1_epi8 (0x20));
+        __m128i digit = _mm_sub_epi8 (c, _mm_set1_epi8 ('0'));
+        __m128i alpha = _mm_sub_epi8 (lower, _mm_set1_epi8 ('a'));
+        __m128i is_digit;
+        __m128i is_alpha;
+
+        is_digit = _mm_and_si128 (_mm_cmpgt_epi8 (digit, _mm_set1_epi8 (-1)),
+          _mm_cmplt_epi8 (digit, _mm_set1_epi8 (10)));
+        is_alpha = _mm_and_si128 (_mm_cmpgt_epi8 (alpha, _mm_set1_epi8 (-1)),
+          _mm_cmplt_epi8 (alpha, _mm_set1_epi8 (6)));
+        *valid = _mm_movemask_epi8 (_mm_or_si128 (is_digit, is_alpha));
+        return (_mm_or_si128 (_mm_and_si128 (is_digit, digit),
+          _mm_and_si128 (is_alpha, _mm_add_epi8 (alpha, _mm_set1_epi8 (10)))));
+}
+
+
+/*!
+ * \brief Decode 32 hexadecimal characters into 16 bytes at a time.
+ *
+ * \return the number of characters decoded, or -1 when an invalid
+ * character was found.
+ */
+static long
+dxf_hex_decode_sse2
+(
+        const char *hex,
+        size_t length,
+        unsigned char *bytes
+)
+{
+        __m128i mask = _mm_set1_epi16 (0x00f0);
+        __m128i a;
+        __m128i b;
+        int valid_a;
+        int valid_b;
+        size_t i;
+
+        for (i = 0; i + 32 <= length; i += 32)
+        {
+                a = dxf_hex_decode_nibbles_sse2 (_mm_loadu_si128 ((const __m128i *) (hex + i)), &valid_a);
+                b = dxf_hex_decode_nibbles_sse2 (_mm_loadu_si128 ((const __m128i *) (hex + i + 16)), &valid_b);
+                if ((valid_a & valid_b) != 0xffff)
+                {
+                        return (-1);
+                }
+                /* Every 16 bit lane holds the high nibble in its low
+                 * byte and the low nibble in its high byte. */
+                a = _mm_or_si128 (_mm_and_si128 (_mm_slli_epi16 (a, 4), mask),
+                  _mm_srli_epi16 (a, 8));
+                b = _mm_or_si128 (_mm_and_si128 (_mm_slli_epi16 (b, 4), mask),
+                  _mm_srli_epi16 (b, 8));
+                _mm_storeu_si128 ((__m128i *) (bytes + i / 2), _mm_packus_epi16 (a, b));
+        }
+        return ((long) i);
+}
+
+
+/*!
+ * \brief Encode 16 bytes into 32 hexadecimal characters at a time.
+ *
+ * \return the number of bytes encoded.
+ */
+static size_t
+dxf_hex_encode_sse2
+(
+        const unsigned char *bytes,
+        size_t size,
+        char *hex
+)
+{
+        __m128i nibble = _mm_set1_epi8 (0x0f);
+        __m128i nine = _mm_set1_epi8 (9);
+        __m128i letter = _mm_set1_epi8 ('A' - '0' - 10);
+        __m128i zero = _mm_set1_epi8 ('0');
+        __m128i v;
+        __m128i high;
+        __m128i low;
+        size_t i;
+
+        for (i = 0; i + 16 <= size; i += 16)
+        {
+                v = _mm_loadu_si128 ((const __m128i *) (bytes + i));
+                high = _mm_and_si128 (_mm_srli_epi16 (v, 4), nibble);
+                low = _mm_and_si128 (v, nibble);
+                high = _mm_add_epi8 (_mm_add_epi8 (high, zero),
+                  _mm_and_si128 (_mm_cmpgt_epi8 (high, nine), letter));
+                low = _mm_add_epi8 (_mm_add_epi8 (low, zero),
+                  _mm_and_si128 (_mm_cmpgt_epi8 (low, nine), letter));
+                _mm_storeu_si128 ((__m128i *) (hex + 2 * i), _mm_unpacklo_epi8 (high, low));
+                _mm_storeu_si128 ((__m128i *) (hex + 2 * i + 16), _mm_unpackhi_epi8 (high, low));
+        }
+        return (i);
+}
+#endif
+
+
+/*!
+ * \brief Decode \c length hexadecimal characters from \c hex into
+ * \c bytes.
+ *
+ * \c bytes must hold at least \c length / 2 bytes.
+ *
+ * \return the number of bytes decoded, or -1 when \c length is odd or
+ * an invalid character was found.
+ */
+long
+dxf_hex_decode
+(
+        const char *hex,
+                /*!< hexadecimal characters, upper or lower case. */
+        size_t length,
+                /*!< number of characters in \c hex. */
+        unsigned char *bytes
+                /*!< the decoded bytes. */
+)
+{
+        size_t i = 0;
+        int high;
+        int low;
+
+        if ((length % 2) != 0)
+        {
+                return (-1);
+        }
+#ifdef __SSE2__
+        {
+                long done = dxf_hex_decode_sse2 (hex, length, bytes);
+
+                if (done < 0)
+                {
+                        return (-1);
+                }
+                i = (size_t) done;
+        }
+#endif
+        for (; i < length; i += 2)
+        {
+                high = dxf_hex_value ((unsigned char) hex[i]);
+                low = dxf_hex_value ((unsigned char) hex[i + 1]);
+                if ((high < 0) || (low < 0))
+                {
+                        return (-1);
+                }
+                bytes[i / 2] = (unsigned char) ((high << 4) | low);
+        }
+        return ((long) (length / 2));
+}
+
+
+/*!
+ * \brief Encode \c size bytes into upper case hexadecimal characters.
+ *
+ * \c hex must hold at least 2 * \c size characters, no terminating
+ * nul character is written.
+ */
+void
+dxf_hex_encode
+(
+        const unsigned char *bytes,
+                /*!< the bytes to encode. */
+        size_t size,
+                /*!< number of bytes to encode. */
+        char *hex
+                /*!< the encoded hexadecimal characters. */
+)
+{
+        size_t i = 0;
+
+#ifdef __SSE2__
+        i = dxf_hex_encode_sse2 (bytes, size, hex);
+#endif
+        for (; i < size; i++)
+        {
+                hex[2 * i] = dxf_hex_digits[bytes[i] >> 4];
+                hex[2 * i + 1] = dxf_hex_digits[bytes[i] & 0x0f];
+        }
+}
+
+
+/*!
+ * \brief Decode a line of hexadecimal characters and append the bytes
+ * to a growable buffer.
+ *
+ * Trailing white space (a carriage return) is ignored.\n
+ * The buffer at \c bytes is (re)allocated as required and grows by
+ * doubling its \c capacity.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hex_append
+(
+        unsigned char **bytes,
+                /*!< a pointer to the buffer. */
+        size_t *size,
+                /*!< a pointer to the number of bytes in the buffer. */
+        size_t *capacity,
+                /*!< a pointer to the allocated size of the buffer. */
+        const char *hex
+                /*!< a nul terminated line of hexadecimal characters. */
+)
+{
+        unsigned char *buffer;
+        size_t length;
+        size_t needed;
+        long decoded;
+
+        /* Do some basic checks. */
+        if ((bytes == NULL) || (size == NULL) || (capacity == NULL) || (hex == NULL))
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        length = strlen (hex);
+        while ((length > 0) && isspace ((unsigned char) hex[length - 1]))
+        {
+                length--;
+        }
+        needed = *size + length / 2;
+        if (needed > *capacity)
+        {
+                size_t new_capacity = (*capacity > 0) ? *capacity : 256;
+
+                while (new_capacity < needed)
+                {
+                        new_capacity *= 2;
+                }
+                buffer = dxf_realloc (*bytes, new_capacity);
+                if (buffer == NULL)
+                {
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                *bytes = buffer;
+                *capacity = new_capacity;
+        }
+        decoded = dxf_hex_decode (hex, length, *bytes + *size);
+        if (decoded < 0)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () invalid hexadecimal data encountered.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        *size += (size_t) decoded;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Write \c size bytes as lines of hexadecimal characters with
+ * \c group_code.
+ *
+ * Every line holds up to \c DXF_HEX_LINE_BYTES bytes (254 characters).
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hex_write
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        int group_code,
+                /*!< group code of the lines, 310 for binary chunk
+                 * data. */
+        const unsigned char *bytes,
+                /*!< the bytes to write. */
+        size_t size
+                /*!< number of bytes to write. */
+)
+{
+        char line[2 * DXF_HEX_LINE_BYTES + 1];
+        size_t offset;
+        size_t chunk;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((bytes == NULL) && (size > 0))
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (offset = 0; offset < size; offset += chunk)
+        {
+                chunk = size - offset;
+                if (chunk > DXF_HEX_LINE_BYTES)
+                {
+                        chunk = DXF_HEX_LINE_BYTES;
+                }
+                dxf_hex_encode (bytes + offset, chunk, line);
+                line[2 * chunk] = '\0';
+                fprintf (fp->fp, "%3d\n%s\n", group_code, line);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/* EOF */
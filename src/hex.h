@@ -0,0 +1,70 @@
+/*!
+ * \file hex.h
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Definition of the hexadecimal codec for binary data (group codes 310 - 319).
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_HEX_H
+#define LIBDXF_SRC_HEX_H
+
+
+#include "global.h"
+
+
+/*!
+ * \brief Maximum number of bytes written in one line of hexadecimal
+ * binary data.
+ *
+ * A binary chunk line holds at most 254 hexadecimal characters.
+ */
+#define DXF_HEX_LINE_BYTES 127
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+long dxf_hex_decode (const char *hex, size_t length, unsigned char *bytes);
+void dxf_hex_encode (const unsigned char *bytes, size_t size, char *hex);
+int dxf_hex_append (unsigned char **bytes, size_t *size, size_t *capacity, const char *hex);
+int dxf_hex_write (DxfFile *fp, int group_code, const unsigned char *bytes, size_t size);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_HEX_H */
+
+
+/* EOF */
@@ -64,7 +64,7 @@ dxf_idbuffer_new ()
         size = sizeof (DxfIdbuffer);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((idbuffer = malloc (size)) == NULL)
+        if ((idbuffer = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -102,23 +102,23 @@ dxf_idbuffer_init
         /* Do some basic checks. */
         if (idbuffer == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 idbuffer = dxf_idbuffer_new ();
         }
         if (idbuffer == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         /* Assign initial values to members. */
         idbuffer->id_code = 0;
-        idbuffer->dictionary_owner_soft = strdup ("");
-        idbuffer->object_owner_soft = strdup ("");
-        idbuffer->dictionary_owner_hard = strdup ("");
+        idbuffer->dictionary_owner_soft = dxf_strdup ("");
+        idbuffer->object_owner_soft = dxf_strdup ("");
+        idbuffer->dictionary_owner_hard = dxf_strdup ("");
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         idbuffer->entity_pointer = NULL;
@@ -161,22 +161,22 @@ dxf_idbuffer_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (idbuffer == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 idbuffer = dxf_idbuffer_init (idbuffer);
@@ -190,11 +190,11 @@ dxf_idbuffer_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -213,7 +213,7 @@ dxf_idbuffer_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "AcDbIdBuffer") != 0)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -264,13 +264,14 @@ dxf_idbuffer_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -296,31 +297,31 @@ dxf_idbuffer_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("IDBUFFER");
+        char *dxf_entity_name = dxf_strdup ("IDBUFFER");
         DxfIdbufferEntityPointer * entity_pointer = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (idbuffer == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, dxf_idbuffer_get_id_code (idbuffer));
         }
@@ -370,7 +371,7 @@ dxf_idbuffer_write
                 entity_pointer = dxf_idbuffer_entity_pointer_get_next (dxf_idbuffer_get_entity_pointer (idbuffer));
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -399,23 +400,23 @@ dxf_idbuffer_free
         /* Do some basic checks. */
         if (idbuffer == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (idbuffer->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (idbuffer->dictionary_owner_soft);
-        free (idbuffer->object_owner_soft);
-        free (idbuffer->dictionary_owner_hard);
+        dxf_free (idbuffer->dictionary_owner_soft);
+        dxf_free (idbuffer->object_owner_soft);
+        dxf_free (idbuffer->dictionary_owner_hard);
         dxf_idbuffer_entity_pointer_free_list ((DxfIdbufferEntityPointer *) idbuffer->entity_pointer);
-        free (idbuffer);
+        dxf_free (idbuffer);
         idbuffer = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -436,18 +437,19 @@ dxf_idbuffer_free_list
                  * \c IDBUFFER objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (id_buffers == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (id_buffers != NULL)
         {
-                DxfIdbuffer *iter = (DxfIdbuffer *) dxf_idbuffer_get_next (id_buffers);
+                DxfIdbuffer *iter = (DxfIdbuffer *) id_buffers->next;
+                id_buffers->next = NULL;
                 dxf_idbuffer_free (id_buffers);
                 id_buffers = (DxfIdbuffer *) iter;
         }
@@ -573,7 +575,7 @@ dxf_idbuffer_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (idbuffer->dictionary_owner_soft));
+        return (dxf_strdup (idbuffer->dictionary_owner_soft));
 }
 
 
@@ -612,7 +614,7 @@ dxf_idbuffer_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        idbuffer->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        idbuffer->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -656,7 +658,7 @@ dxf_idbuffer_get_object_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (idbuffer->object_owner_soft));
+        return (dxf_strdup (idbuffer->object_owner_soft));
 }
 
 
@@ -692,7 +694,7 @@ dxf_idbuffer_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        idbuffer->object_owner_soft = strdup (object_owner_soft);
+        idbuffer->object_owner_soft = dxf_strdup (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -737,7 +739,7 @@ dxf_idbuffer_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (idbuffer->dictionary_owner_hard));
+        return (dxf_strdup (idbuffer->dictionary_owner_hard));
 }
 
 
@@ -776,7 +778,7 @@ dxf_idbuffer_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        idbuffer->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        idbuffer->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1011,7 +1013,7 @@ dxf_idbuffer_entity_pointer_new ()
         size = sizeof (DxfIdbufferEntityPointer);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((entity_pointer = malloc (size)) == NULL)
+        if ((entity_pointer = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -1049,19 +1051,19 @@ dxf_idbuffer_entity_pointer_init
         /* Do some basic checks. */
         if (entity_pointer == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 entity_pointer = dxf_idbuffer_entity_pointer_new ();
         }
         if (entity_pointer == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        entity_pointer->soft_pointer = strdup ("");
+        entity_pointer->soft_pointer = dxf_strdup ("");
         entity_pointer->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -1091,20 +1093,20 @@ dxf_idbuffer_entity_pointer_free
         /* Do some basic checks. */
         if (entity_pointer == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (entity_pointer->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (entity_pointer->soft_pointer);
-        free (entity_pointer);
+        dxf_free (entity_pointer->soft_pointer);
+        dxf_free (entity_pointer);
         entity_pointer = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -1125,18 +1127,19 @@ dxf_idbuffer_entity_pointer_free_list
                  * \c DxfIdbufferEntityPointer structs. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (entity_pointers == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (entity_pointers != NULL)
         {
                 DxfIdbufferEntityPointer *iter = (DxfIdbufferEntityPointer *) entity_pointers->next;
+                entity_pointers->next = NULL;
                 dxf_idbuffer_entity_pointer_free (entity_pointers);
                 entity_pointers = (DxfIdbufferEntityPointer *) iter;
         }
@@ -1183,7 +1186,7 @@ dxf_idbuffer_entity_pointer_get_soft_pointer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (entity_pointer->soft_pointer));
+        return (dxf_strdup (entity_pointer->soft_pointer));
 }
 
 
@@ -1222,7 +1225,7 @@ dxf_idbuffer_entity_pointer_set_soft_pointer
                   __FUNCTION__);
                 return (NULL);
         }
-        entity_pointer->soft_pointer = strdup (soft_pointer);
+        entity_pointer->soft_pointer = dxf_strdup (soft_pointer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
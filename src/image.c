@@ -68,7 +68,7 @@ dxf_image_new ()
         size = sizeof (DxfImage);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((image = malloc (size)) == NULL)
+        if ((image = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -106,22 +106,22 @@ dxf_image_init
         /* Do some basic checks. */
         if (image == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 image = dxf_image_new ();
         }
         if (image == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         /* Assign initial values to members. */
         image->id_code = 0;
-        image->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        image->layer = strdup (DXF_DEFAULT_LAYER);
+        image->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        image->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         image->elevation = 0.0;
         image->thickness = 0.0;
         image->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -130,13 +130,13 @@ dxf_image_init
         image->paperspace = DXF_MODELSPACE;
         image->graphics_data_size = 0;
         image->shadow_mode = 0;
-        image->dictionary_owner_soft = strdup ("");
-        image->material = strdup ("");
-        image->dictionary_owner_hard = strdup ("");
+        image->dictionary_owner_soft = dxf_strdup ("");
+        image->material = dxf_strdup ("");
+        image->dictionary_owner_hard = dxf_strdup ("");
         image->lineweight = 0;
-        image->plot_style_name = strdup ("");
+        image->plot_style_name = dxf_strdup ("");
         image->color_value = 0;
-        image->color_name = strdup ("");
+        image->color_name = dxf_strdup ("");
         image->transparency = 0;
         image->image_display_properties = 0;
         image->clipping_boundary_type = 0;
@@ -146,8 +146,8 @@ dxf_image_init
         image->brightness = 50;
         image->contrast = 50;
         image->fade = 50;
-        image->imagedef_object = strdup ("");
-        image->imagedef_reactor_object = strdup ("");
+        image->imagedef_object = dxf_strdup ("");
+        image->imagedef_reactor_object = dxf_strdup ("");
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         image->p0 = NULL;
@@ -190,38 +190,37 @@ dxf_image_read
         char *temp_string = NULL;
         DxfPoint *iter = NULL;
         int next_x4;
-        DxfBinaryData *iter310 = NULL;
         int iter330;
         int iter360;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (image == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 image = dxf_image_init (image);
         }
         if (image->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfBinaryData struct.\n")));
                 image->binary_graphics_data = dxf_binary_data_init (image->binary_graphics_data);
                 if (image->binary_graphics_data == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -229,15 +228,15 @@ dxf_image_read
         }
         if (image->p0 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 image->p0 = dxf_point_init (image->p0);
                 if (image->p0 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -245,15 +244,15 @@ dxf_image_read
         }
         if (image->p1 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 image->p1 = dxf_point_init (image->p1);
                 if (image->p1 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -261,15 +260,15 @@ dxf_image_read
         }
         if (image->p2 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 image->p2 = dxf_point_init (image->p2);
                 if (image->p2 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -277,15 +276,15 @@ dxf_image_read
         }
         if (image->p3 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 image->p3 = dxf_point_init (image->p3);
                 if (image->p3 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -293,15 +292,15 @@ dxf_image_read
         }
         if (image->p4 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 image->p4 = dxf_point_init (image->p4);
                 if (image->p4 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -309,7 +308,6 @@ dxf_image_read
         }
         iter = (DxfPoint *) image->p4;
         next_x4 = 0;
-        iter310 = (DxfBinaryData *) image->binary_graphics_data;
         iter330 = 0;
         iter360 = 0;
         (fp->line_number)++;
@@ -318,12 +316,12 @@ dxf_image_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -533,7 +531,7 @@ dxf_image_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbRasterImage") != 0)))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -585,9 +583,8 @@ dxf_image_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_data_append_hex ((DxfBinaryData *) image->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -682,22 +679,23 @@ dxf_image_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (image->linetype, "") == 0)
         {
-                image->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                image->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (image->layer, "") == 0)
         {
-                image->layer = strdup (DXF_DEFAULT_LAYER);
+                image->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -723,53 +721,53 @@ dxf_image_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("IMAGE");
+        char *dxf_entity_name = dxf_strdup ("IMAGE");
         DxfPoint *iter = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (image == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (strcmp (image->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, image->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                image->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                image->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (image->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, image->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to default layer.\n")),
                   dxf_entity_name);
-                image->layer = strdup (DXF_DEFAULT_LAYER);
+                image->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -852,16 +850,7 @@ dxf_image_write
 #else
                 fprintf (fp->fp, " 92\n%" PRIi32 "\n", image->graphics_data_size);
 #endif
-                if (image->binary_graphics_data != NULL)
-                {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) image->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
-                }
+                dxf_binary_data_write (fp, (DxfBinaryData *) image->binary_graphics_data);
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
@@ -914,7 +903,7 @@ dxf_image_write
                 iter = (DxfPoint *) iter->next;
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -943,35 +932,35 @@ dxf_image_free
         /* Do some basic checks. */
         if (image == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (image->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (image->linetype);
-        free (image->layer);
+        dxf_free (image->linetype);
+        dxf_free (image->layer);
         dxf_binary_data_free_list (image->binary_graphics_data);
-        free (image->dictionary_owner_soft);
-        free (image->material);
-        free (image->dictionary_owner_hard);
-        free (image->object_owner_soft);
-        free (image->plot_style_name);
-        free (image->color_name);
+        dxf_free (image->dictionary_owner_soft);
+        dxf_free (image->material);
+        dxf_free (image->dictionary_owner_hard);
+        dxf_free (image->object_owner_soft);
+        dxf_free (image->plot_style_name);
+        dxf_free (image->color_name);
         dxf_point_free (image->p0);
         dxf_point_free (image->p1);
         dxf_point_free (image->p2);
         dxf_point_free (image->p3);
         dxf_point_free_list (image->p4);
-        free (image->imagedef_object);
-        free (image->imagedef_reactor_object);
-        free (image);
+        dxf_free (image->imagedef_object);
+        dxf_free (image->imagedef_reactor_object);
+        dxf_free (image);
         image = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -992,18 +981,19 @@ dxf_image_free_list
                  * entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (images == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (images != NULL)
         {
                 DxfImage *iter = (DxfImage *) images->next;
+                images->next = NULL;
                 dxf_image_free (images);
                 images = (DxfImage *) iter;
         }
@@ -1125,7 +1115,7 @@ dxf_image_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->linetype));
+        return (dxf_strdup (image->linetype));
 }
 
 
@@ -1162,7 +1152,7 @@ dxf_image_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        image->linetype = strdup (linetype);
+        image->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1203,7 +1193,7 @@ dxf_image_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->layer));
+        return (dxf_strdup (image->layer));
 }
 
 
@@ -1240,7 +1230,7 @@ dxf_image_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        image->layer = strdup (layer);
+        image->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2026,7 +2016,7 @@ dxf_image_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->dictionary_owner_soft));
+        return (dxf_strdup (image->dictionary_owner_soft));
 }
 
 
@@ -2065,7 +2055,7 @@ dxf_image_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        image->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        image->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2109,7 +2099,7 @@ dxf_image_get_object_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->object_owner_soft));
+        return (dxf_strdup (image->object_owner_soft));
 }
 
 
@@ -2145,7 +2135,7 @@ dxf_image_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        image->object_owner_soft = strdup (object_owner_soft);
+        image->object_owner_soft = dxf_strdup (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2189,7 +2179,7 @@ dxf_image_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->material));
+        return (dxf_strdup (image->material));
 }
 
 
@@ -2227,7 +2217,7 @@ dxf_image_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        image->material = strdup (material);
+        image->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2272,7 +2262,7 @@ dxf_image_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->dictionary_owner_hard));
+        return (dxf_strdup (image->dictionary_owner_hard));
 }
 
 
@@ -2311,7 +2301,7 @@ dxf_image_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        image->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        image->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2418,7 +2408,7 @@ dxf_image_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->plot_style_name));
+        return (dxf_strdup (image->plot_style_name));
 }
 
 
@@ -2456,7 +2446,7 @@ dxf_image_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        image->plot_style_name = strdup (plot_style_name);
+        image->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2563,7 +2553,7 @@ dxf_image_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->color_name));
+        return (dxf_strdup (image->color_name));
 }
 
 
@@ -2601,7 +2591,7 @@ dxf_image_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        image->color_name = strdup (color_name);
+        image->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2686,7 +2676,7 @@ dxf_image_get_p0
                 /*!< a pointer to a DXF \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2725,7 +2715,7 @@ dxf_image_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2764,7 +2754,7 @@ dxf_image_get_x0
                 /*!< a pointer to a DXF \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2807,7 +2797,7 @@ dxf_image_set_x0
                  * \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2855,7 +2845,7 @@ dxf_image_get_y0
                 /*!< a pointer to a DXF \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2898,7 +2888,7 @@ dxf_image_set_y0
                  * \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2946,7 +2936,7 @@ dxf_image_get_z0
                 /*!< a pointer to a DXF \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2989,7 +2979,7 @@ dxf_image_set_z0
                  * \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3037,7 +3027,7 @@ dxf_image_get_p1
                 /*!< a pointer to a DXF \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3077,7 +3067,7 @@ dxf_image_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3116,7 +3106,7 @@ dxf_image_get_x1
                 /*!< a pointer to a DXF \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3159,7 +3149,7 @@ dxf_image_set_x1
                  * of a DXF \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3207,7 +3197,7 @@ dxf_image_get_y1
                 /*!< a pointer to a DXF \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3250,7 +3240,7 @@ dxf_image_set_y1
                  * of a DXF \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3298,7 +3288,7 @@ dxf_image_get_z1
                 /*!< a pointer to a DXF \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3341,7 +3331,7 @@ dxf_image_set_z1
                  * of a DXF \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3389,7 +3379,7 @@ dxf_image_get_p2
                 /*!< a pointer to a DXF \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3429,7 +3419,7 @@ dxf_image_set_p2
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3468,7 +3458,7 @@ dxf_image_get_x2
                 /*!< a pointer to a DXF \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3511,7 +3501,7 @@ dxf_image_set_x2
                  * of a DXF \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3559,7 +3549,7 @@ dxf_image_get_y2
                 /*!< a pointer to a DXF \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3602,7 +3592,7 @@ dxf_image_set_y2
                  * of a DXF \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3650,7 +3640,7 @@ dxf_image_get_z2
                 /*!< a pointer to a DXF \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3693,7 +3683,7 @@ dxf_image_set_z2
                  * of a DXF \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3741,7 +3731,7 @@ dxf_image_get_p3
                 /*!< a pointer to a DXF \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3781,7 +3771,7 @@ dxf_image_set_p3
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3820,7 +3810,7 @@ dxf_image_get_x3
                 /*!< a pointer to a DXF \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3863,7 +3853,7 @@ dxf_image_set_x3
                  * DXF \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3911,7 +3901,7 @@ dxf_image_get_y3
                 /*!< a pointer to a DXF \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3954,7 +3944,7 @@ dxf_image_set_y3
                  * DXF \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4002,7 +3992,7 @@ dxf_image_get_p4
                 /*!< a pointer to a DXF \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4042,7 +4032,7 @@ dxf_image_set_p4
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4082,7 +4072,7 @@ dxf_image_get_x4
                 /*!< a pointer to a DXF \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4125,7 +4115,7 @@ dxf_image_set_x4
                  * (multiple entries) \c x4 of a DXF \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4174,7 +4164,7 @@ dxf_image_get_y4
                 /*!< a pointer to a DXF \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4217,7 +4207,7 @@ dxf_image_set_y4
                  * (multiple entries) \c y4 of a DXF \c IMAGE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4963,7 +4953,7 @@ dxf_image_get_imagedef_object
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->imagedef_object));
+        return (dxf_strdup (image->imagedef_object));
 }
 
 
@@ -5001,7 +4991,7 @@ dxf_image_set_imagedef_object
                   __FUNCTION__);
                 return (NULL);
         }
-        image->imagedef_object = strdup (imagedef_object);
+        image->imagedef_object = dxf_strdup (imagedef_object);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5043,7 +5033,7 @@ dxf_image_get_imagedef_reactor_object
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->imagedef_reactor_object));
+        return (dxf_strdup (image->imagedef_reactor_object));
 }
 
 
@@ -5081,7 +5071,7 @@ dxf_image_set_imagedef_reactor_object
                   __FUNCTION__);
                 return (NULL);
         }
-        image->imagedef_reactor_object = strdup (imagedef_reactor_object);
+        image->imagedef_reactor_object = dxf_strdup (imagedef_reactor_object);
 #if DEBUG
         DXF_DEBUG_END
 #endif
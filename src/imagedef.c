@@ -63,7 +63,7 @@ dxf_imagedef_new ()
         size = sizeof (DxfImagedef);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((imagedef = malloc (size)) == NULL)
+        if ((imagedef = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -101,27 +101,27 @@ dxf_imagedef_init
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 imagedef = dxf_imagedef_new ();
         }
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         /* Assign initial values to members. */
         imagedef->id_code = 0;
-        imagedef->dictionary_owner_soft = strdup ("");
-        imagedef->dictionary_owner_hard = strdup ("");
-        imagedef->file_name = strdup ("");
+        imagedef->dictionary_owner_soft = dxf_strdup ("");
+        imagedef->dictionary_owner_hard = dxf_strdup ("");
+        imagedef->file_name = dxf_strdup ("");
         imagedef->class_version = 0;
         imagedef->image_is_loaded_flag = 0;
         imagedef->resolution_units = 0;
-        imagedef->acad_image_dict_soft = strdup ("");
+        imagedef->acad_image_dict_soft = dxf_strdup ("");
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         imagedef->p0 = NULL;
@@ -164,37 +164,37 @@ dxf_imagedef_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 imagedef = dxf_imagedef_init (imagedef);
         }
         if (imagedef->p0 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 imagedef->p0 = dxf_point_init (imagedef->p0);
                 if (imagedef->p0 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -202,15 +202,15 @@ dxf_imagedef_read
         }
         if (imagedef->p1 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 imagedef->p1 = dxf_point_init (imagedef->p1);
                 if (imagedef->p1 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -223,11 +223,11 @@ dxf_imagedef_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -290,7 +290,7 @@ dxf_imagedef_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "AcDbRasterImageDef") != 0)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -353,13 +353,14 @@ dxf_imagedef_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -385,48 +386,48 @@ dxf_imagedef_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("IMAGEDEF");
+        char *dxf_entity_name = dxf_strdup ("IMAGEDEF");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (imagedef->p0 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (imagedef->p1 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, imagedef->id_code);
         }
@@ -484,7 +485,7 @@ dxf_imagedef_write
         fprintf (fp->fp, "280\n%hd\n", imagedef->image_is_loaded_flag);
         fprintf (fp->fp, "281\n%hd\n", imagedef->resolution_units);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -515,27 +516,27 @@ dxf_imagedef_free
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (imagedef->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (imagedef->dictionary_owner_soft);
-        free (imagedef->dictionary_owner_hard);
-        free (imagedef->file_name);
-        free (imagedef->acad_image_dict_soft);
+        dxf_free (imagedef->dictionary_owner_soft);
+        dxf_free (imagedef->dictionary_owner_hard);
+        dxf_free (imagedef->file_name);
+        dxf_free (imagedef->acad_image_dict_soft);
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
-                free (imagedef->imagedef_reactor_soft[i]);
+                dxf_free (imagedef->imagedef_reactor_soft[i]);
         }
-        free (imagedef);
+        dxf_free (imagedef);
         imagedef = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -556,18 +557,19 @@ dxf_imagedef_free_list
                  * \c IMAGEDEF objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (imagedefs == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (imagedefs != NULL)
         {
                 DxfImagedef *iter = (DxfImagedef *) imagedefs->next;
+                imagedefs->next = NULL;
                 dxf_imagedef_free (imagedefs);
                 imagedefs = (DxfImagedef *) iter;
         }
@@ -693,7 +695,7 @@ dxf_imagedef_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (imagedef->dictionary_owner_soft));
+        return (dxf_strdup (imagedef->dictionary_owner_soft));
 }
 
 
@@ -732,7 +734,7 @@ dxf_imagedef_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        imagedef->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        imagedef->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -777,7 +779,7 @@ dxf_imagedef_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (imagedef->dictionary_owner_hard));
+        return (dxf_strdup (imagedef->dictionary_owner_hard));
 }
 
 
@@ -816,7 +818,7 @@ dxf_imagedef_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        imagedef->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        imagedef->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -857,7 +859,7 @@ dxf_imagedef_get_file_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (imagedef->file_name));
+        return (dxf_strdup (imagedef->file_name));
 }
 
 
@@ -895,7 +897,7 @@ dxf_imagedef_set_file_name
                   __FUNCTION__);
                 return (NULL);
         }
-        imagedef->file_name = strdup (file_name);
+        imagedef->file_name = dxf_strdup (file_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -915,7 +917,7 @@ dxf_imagedef_get_p0
                 /*!< a pointer to a DXF \c IMAGEDEF object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -954,7 +956,7 @@ dxf_imagedef_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -993,7 +995,7 @@ dxf_imagedef_get_x0
                 /*!< a pointer to a DXF \c IMAGEDEF object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1036,7 +1038,7 @@ dxf_imagedef_set_x0
                  * DXF \c IMAGEDEF object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1084,7 +1086,7 @@ dxf_imagedef_get_y0
                 /*!< a pointer to a DXF \c IMAGEDEF object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1127,7 +1129,7 @@ dxf_imagedef_set_y0
                  * DXF \c IMAGEDEF object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1175,7 +1177,7 @@ dxf_imagedef_get_p1
                 /*!< a pointer to a DXF \c IMAGEDEF object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1215,7 +1217,7 @@ dxf_imagedef_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1254,7 +1256,7 @@ dxf_imagedef_get_x1
                 /*!< a pointer to a DXF \c IMAGEDEF object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1297,7 +1299,7 @@ dxf_imagedef_set_x1
                  * AutoCAD units \c x1 of a DXF \c IMAGEDEF object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1345,7 +1347,7 @@ dxf_imagedef_get_y1
                 /*!< a pointer to a DXF \c IMAGEDEF object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1388,7 +1390,7 @@ dxf_imagedef_set_y1
                  * AutoCAD units \c y1 of a DXF \c IMAGEDEF object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1727,7 +1729,7 @@ dxf_imagedef_get_acad_image_dict_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (imagedef->acad_image_dict_soft));
+        return (dxf_strdup (imagedef->acad_image_dict_soft));
 }
 
 
@@ -1766,7 +1768,7 @@ dxf_imagedef_set_acad_image_dict_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        imagedef->acad_image_dict_soft = strdup (acad_image_dict_soft);
+        imagedef->acad_image_dict_soft = dxf_strdup (acad_image_dict_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
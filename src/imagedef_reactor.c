@@ -64,7 +64,7 @@ dxf_imagedef_reactor_new ()
         size = sizeof (DxfImagedefReactor);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((imagedef_reactor = malloc (size)) == NULL)
+        if ((imagedef_reactor = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -102,23 +102,23 @@ dxf_imagedef_reactor_init
         /* Do some basic checks. */
         if (imagedef_reactor == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 imagedef_reactor = dxf_imagedef_reactor_new ();
         }
         if (imagedef_reactor == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         imagedef_reactor->id_code = 0;
-        imagedef_reactor->dictionary_owner_soft = strdup ("");
-        imagedef_reactor->dictionary_owner_hard = strdup ("");
+        imagedef_reactor->dictionary_owner_soft = dxf_strdup ("");
+        imagedef_reactor->dictionary_owner_hard = dxf_strdup ("");
         imagedef_reactor->class_version = 2;
-        imagedef_reactor->associated_image_object = strdup ("");
+        imagedef_reactor->associated_image_object = dxf_strdup ("");
         imagedef_reactor->associated_image_object_length = 0;
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
@@ -160,22 +160,22 @@ dxf_imagedef_reactor_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (imagedef_reactor == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 imagedef_reactor = dxf_imagedef_reactor_init (imagedef_reactor);
@@ -187,11 +187,11 @@ dxf_imagedef_reactor_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -218,7 +218,7 @@ dxf_imagedef_reactor_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "AcDbRasterImageDef") != 0)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -257,13 +257,14 @@ dxf_imagedef_reactor_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -290,30 +291,30 @@ dxf_imagedef_reactor_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("IMAGEDEF_REACTOR");
+        char *dxf_entity_name = dxf_strdup ("IMAGEDEF_REACTOR");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (imagedef_reactor == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, imagedef_reactor->id_code);
         }
@@ -358,7 +359,7 @@ dxf_imagedef_reactor_write
         fprintf (fp->fp, " 90\n%" PRIi32 "\n", imagedef_reactor->class_version);
         fprintf (fp->fp, "330\n%s\n", imagedef_reactor->associated_image_object);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -387,22 +388,22 @@ dxf_imagedef_reactor_free
         /* Do some basic checks. */
         if (imagedef_reactor == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (imagedef_reactor->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (imagedef_reactor->dictionary_owner_soft);
-        free (imagedef_reactor->dictionary_owner_hard);
-        free (imagedef_reactor->associated_image_object);
-        free (imagedef_reactor);
+        dxf_free (imagedef_reactor->dictionary_owner_soft);
+        dxf_free (imagedef_reactor->dictionary_owner_hard);
+        dxf_free (imagedef_reactor->associated_image_object);
+        dxf_free (imagedef_reactor);
         imagedef_reactor = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -423,18 +424,19 @@ dxf_imagedef_reactor_free_list
                  * \c IMAGEDEF_REACTOR objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (imagedef_reactors == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (imagedef_reactors != NULL)
         {
                 DxfImagedefReactor *iter = (DxfImagedefReactor *) imagedef_reactors->next;
+                imagedef_reactors->next = NULL;
                 dxf_imagedef_reactor_free (imagedef_reactors);
                 imagedef_reactors = (DxfImagedefReactor *) iter;
         }
@@ -562,7 +564,7 @@ dxf_imagedef_reactor_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (imagedef_reactor->dictionary_owner_soft));
+        return (dxf_strdup (imagedef_reactor->dictionary_owner_soft));
 }
 
 
@@ -601,7 +603,7 @@ dxf_imagedef_reactor_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        imagedef_reactor->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        imagedef_reactor->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -646,7 +648,7 @@ dxf_imagedef_reactor_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (imagedef_reactor->dictionary_owner_hard));
+        return (dxf_strdup (imagedef_reactor->dictionary_owner_hard));
 }
 
 
@@ -685,7 +687,7 @@ dxf_imagedef_reactor_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        imagedef_reactor->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        imagedef_reactor->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -823,7 +825,7 @@ dxf_imagedef_reactor_get_associated_image_object
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (imagedef_reactor->associated_image_object));
+        return (dxf_strdup (imagedef_reactor->associated_image_object));
 }
 
 
@@ -862,7 +864,7 @@ dxf_imagedef_reactor_set_associated_image_object
                   __FUNCTION__);
                 return (NULL);
         }
-        imagedef_reactor->associated_image_object = strdup (associated_image_object);
+        imagedef_reactor->associated_image_object = dxf_strdup (associated_image_object);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -64,7 +64,7 @@ dxf_insert_new ()
         size = sizeof (DxfInsert);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((insert = malloc (size)) == NULL)
+        if ((insert = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -101,21 +101,21 @@ dxf_insert_init
         /* Do some basic checks. */
         if (insert == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 insert = dxf_insert_new ();
         }
         if (insert == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         insert->id_code = 0;
-        insert->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        insert->layer = strdup (DXF_DEFAULT_LAYER);
+        insert->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        insert->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         insert->elevation = 0.0;
         insert->thickness = 0.0;
         insert->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -124,15 +124,15 @@ dxf_insert_init
         insert->paperspace = DXF_MODELSPACE;
         insert->graphics_data_size = 0;
         insert->shadow_mode = 0;
-        insert->dictionary_owner_soft = strdup ("");
-        insert->material = strdup ("");
-        insert->dictionary_owner_hard = strdup ("");
+        insert->dictionary_owner_soft = dxf_strdup ("");
+        insert->material = dxf_strdup ("");
+        insert->dictionary_owner_hard = dxf_strdup ("");
         insert->lineweight = 0.0;
-        insert->plot_style_name = strdup ("");
+        insert->plot_style_name = dxf_strdup ("");
         insert->color_value = 0;
-        insert->color_name = strdup ("");
+        insert->color_name = dxf_strdup ("");
         insert->transparency = 0;
-        insert->block_name = strdup ("");
+        insert->block_name = dxf_strdup ("");
         insert->rel_x_scale = 1.0;
         insert->rel_y_scale = 1.0;
         insert->rel_z_scale = 1.0;
@@ -185,31 +185,31 @@ dxf_insert_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (insert == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 insert = dxf_insert_init (insert);
         }
         if (insert->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfBinaryData struct.\n")));
                 insert->binary_graphics_data = (DxfBinaryData *) dxf_binary_data_init (insert->binary_graphics_data);
                 if (insert->binary_graphics_data == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -217,15 +217,15 @@ dxf_insert_read
         }
         if (insert->p0 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 insert->p0 = dxf_point_init (insert->p0);
                 if (insert->p0 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         return (NULL);
@@ -237,12 +237,12 @@ dxf_insert_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "2") == 0)
@@ -415,7 +415,7 @@ dxf_insert_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && (strcmp (temp_string, "AcDbBlockReference") != 0))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -464,22 +464,23 @@ dxf_insert_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (insert->linetype, "") == 0)
         {
-                insert->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                insert->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (insert->layer, "") == 0)
         {
-                insert->layer = strdup (DXF_DEFAULT_LAYER);
+                insert->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -505,73 +506,73 @@ dxf_insert_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("INSERT");
+        char *dxf_entity_name = dxf_strdup ("INSERT");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (insert == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (insert->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, insert->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                insert->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                insert->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (insert->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, insert->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to layer 0.\n")),
                   dxf_entity_name);
-                insert->layer = strdup (DXF_DEFAULT_LAYER);
+                insert->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (insert->rel_x_scale == 0.0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, insert->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\tdefault relative X-scale of 1.0 applied to %s entity.\n")),
                   dxf_entity_name);
                 insert->rel_x_scale = 1.0;
         }
         if (insert->rel_y_scale == 0.0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () relative Y-scale factor has a value of 0.0 for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, insert->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\tdefault relative Y-scale of 1.0 applied to %s entity.\n")),
                   dxf_entity_name);
                 insert->rel_y_scale = 1.0;
         }
         if (insert->rel_z_scale == 0.0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () relative Z-scale factor has a value of 0.0 for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, insert->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\tdefault relative Z-scale of 1.0 applied to %s entity.\n")),
                   dxf_entity_name);
                 insert->rel_z_scale = 1.0;
@@ -579,10 +580,10 @@ dxf_insert_write
         if ((insert->columns > 1)
           && (insert->column_spacing == 0.0))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () number of columns is greater than 1 and the column spacing has a value of 0.0 for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, insert->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\tdefault number of columns value of 1 applied to %s entity.\n")),
                   dxf_entity_name);
                 insert->columns = 1;
@@ -590,10 +591,10 @@ dxf_insert_write
         if ((insert->rows > 1)
           && (insert->row_spacing == 0.0))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () number of rows is greater than 1 and the row spacing has a value of 0.0 for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, insert->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\tdefault number of rows value of 1 applied to %s entity.\n")),
                   dxf_entity_name);
                 insert->rows = 1;
@@ -721,7 +722,7 @@ dxf_insert_write
                 fprintf (fp->fp, "230\n%f\n", insert->extr_z0);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -750,29 +751,29 @@ dxf_insert_free
         /* Do some basic checks. */
         if (insert == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (insert->next != NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (insert->linetype);
-        free (insert->layer);
+        dxf_free (insert->linetype);
+        dxf_free (insert->layer);
         dxf_binary_data_free_list (insert->binary_graphics_data);
-        free (insert->dictionary_owner_soft);
-        free (insert->material);
-        free (insert->dictionary_owner_hard);
-        free (insert->plot_style_name);
-        free (insert->color_name);
-        free (insert->block_name);
+        dxf_free (insert->dictionary_owner_soft);
+        dxf_free (insert->material);
+        dxf_free (insert->dictionary_owner_hard);
+        dxf_free (insert->plot_style_name);
+        dxf_free (insert->color_name);
+        dxf_free (insert->block_name);
         dxf_point_free_list (insert->p0);
-        free (insert);
+        dxf_free (insert);
         insert = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -793,18 +794,19 @@ dxf_insert_free_list
                  * entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (inserts == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (inserts != NULL)
         {
                 DxfInsert *iter = (DxfInsert *) inserts->next;
+                inserts->next = NULL;
                 dxf_insert_free (inserts);
                 inserts = (DxfInsert *) iter;
         }
@@ -924,7 +926,7 @@ dxf_insert_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (insert->linetype));
+        return (dxf_strdup (insert->linetype));
 }
 
 
@@ -958,7 +960,7 @@ dxf_insert_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        insert->linetype = strdup (linetype);
+        insert->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -999,7 +1001,7 @@ dxf_insert_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (insert->layer));
+        return (dxf_strdup (insert->layer));
 }
 
 
@@ -1033,7 +1035,7 @@ dxf_insert_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        insert->layer = strdup (layer);
+        insert->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1805,7 +1807,7 @@ dxf_insert_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (insert->dictionary_owner_soft));
+        return (dxf_strdup (insert->dictionary_owner_soft));
 }
 
 
@@ -1841,7 +1843,7 @@ dxf_insert_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        insert->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        insert->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1885,7 +1887,7 @@ dxf_insert_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (insert->material));
+        return (dxf_strdup (insert->material));
 }
 
 
@@ -1923,7 +1925,7 @@ dxf_insert_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        insert->material = strdup (material);
+        insert->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1967,7 +1969,7 @@ dxf_insert_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (insert->dictionary_owner_hard));
+        return (dxf_strdup (insert->dictionary_owner_hard));
 }
 
 
@@ -2003,7 +2005,7 @@ dxf_insert_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        insert->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        insert->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2110,7 +2112,7 @@ dxf_insert_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (insert->plot_style_name));
+        return (dxf_strdup (insert->plot_style_name));
 }
 
 
@@ -2148,7 +2150,7 @@ dxf_insert_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        insert->plot_style_name = strdup (plot_style_name);
+        insert->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2255,7 +2257,7 @@ dxf_insert_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (insert->color_name));
+        return (dxf_strdup (insert->color_name));
 }
 
 
@@ -2293,7 +2295,7 @@ dxf_insert_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        insert->color_name = strdup (color_name);
+        insert->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2400,7 +2402,7 @@ dxf_insert_get_block_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (insert->block_name));
+        return (dxf_strdup (insert->block_name));
 }
 
 
@@ -2438,7 +2440,7 @@ dxf_insert_set_block_name
                   __FUNCTION__);
                 return (NULL);
         }
-        insert->block_name = strdup (block_name);
+        insert->block_name = dxf_strdup (block_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2458,7 +2460,7 @@ dxf_insert_get_p0
                 /*!< a pointer to a DXF \c INSERT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2497,7 +2499,7 @@ dxf_insert_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2536,7 +2538,7 @@ dxf_insert_get_x0
                 /*!< a pointer to a DXF \c INSERT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2579,7 +2581,7 @@ dxf_insert_set_x0
                  * \c INSERT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2627,7 +2629,7 @@ dxf_insert_get_y0
                 /*!< a pointer to a DXF \c INSERT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2670,7 +2672,7 @@ dxf_insert_set_y0
                  * \c INSERT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2718,7 +2720,7 @@ dxf_insert_get_z0
                 /*!< a pointer to a DXF \c INSERT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2761,7 +2763,7 @@ dxf_insert_set_z0
                  * \c INSERT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2809,7 +2811,7 @@ dxf_insert_get_rel_x_scale
                 /*!< a pointer to a DXF \c INSERT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2851,7 +2853,7 @@ dxf_insert_set_rel_x_scale
                  * \c INSERT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2889,7 +2891,7 @@ dxf_insert_get_rel_y_scale
                 /*!< a pointer to a DXF \c INSERT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2931,7 +2933,7 @@ dxf_insert_set_rel_y_scale
                  * \c INSERT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2969,7 +2971,7 @@ dxf_insert_get_rel_z_scale
                 /*!< a pointer to a DXF \c INSERT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3011,7 +3013,7 @@ dxf_insert_set_rel_z_scale
                  * \c INSERT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3049,7 +3051,7 @@ dxf_insert_get_column_spacing
                 /*!< a pointer to a DXF \c INSERT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3091,7 +3093,7 @@ dxf_insert_set_column_spacing
                  * \c INSERT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3129,7 +3131,7 @@ dxf_insert_get_row_spacing
                 /*!< a pointer to a DXF \c INSERT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3170,7 +3172,7 @@ dxf_insert_set_row_spacing
                  * \c INSERT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3208,7 +3210,7 @@ dxf_insert_get_rot_angle
                 /*!< a pointer to a DXF \c INSERT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3251,7 +3253,7 @@ dxf_insert_set_rot_angle
                  * \c INSERT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3541,7 +3543,7 @@ dxf_insert_get_extr_x0
                 /*!< a pointer to a DXF \c INSERT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3577,7 +3579,7 @@ dxf_insert_set_extr_x0
                  * DXF \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3609,7 +3611,7 @@ dxf_insert_get_extr_y0
                 /*!< a pointer to a DXF \c INSERT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3645,7 +3647,7 @@ dxf_insert_set_extr_y0
                  * DXF \c INSERT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3677,7 +3679,7 @@ dxf_insert_get_extr_z0
                 /*!< a pointer to a DXF \c INSERT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3713,7 +3715,7 @@ dxf_insert_set_extr_z0
                  * DXF \c INSERT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -66,7 +66,7 @@ dxf_layer_new ()
         size = sizeof (DxfLayer);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((layer = malloc (size)) == NULL)
+        if ((layer = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfLayer struct.\n")),
@@ -104,29 +104,29 @@ dxf_layer_init
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 layer = dxf_layer_new ();
         }
         if (layer == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfLayer struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         dxf_layer_set_id_code (layer, 0);
-        dxf_layer_set_layer_name (layer, strdup (""));
-        dxf_layer_set_linetype (layer, strdup (DXF_DEFAULT_LINETYPE));
+        dxf_layer_set_layer_name (layer, dxf_strdup (""));
+        dxf_layer_set_linetype (layer, dxf_strdup (DXF_DEFAULT_LINETYPE));
         dxf_layer_set_color (layer, DXF_COLOR_BYLAYER);
         dxf_layer_set_flag (layer, 0);
         dxf_layer_set_plotting_flag (layer, 0);
-        dxf_layer_set_dictionary_owner_soft (layer, strdup (""));
-        dxf_layer_set_material (layer, strdup (""));
-        dxf_layer_set_dictionary_owner_hard (layer, strdup (""));
+        dxf_layer_set_dictionary_owner_soft (layer, dxf_strdup (""));
+        dxf_layer_set_material (layer, dxf_strdup (""));
+        dxf_layer_set_dictionary_owner_hard (layer, dxf_strdup (""));
         dxf_layer_set_lineweight (layer, 0);
-        dxf_layer_set_plot_style_name (layer, strdup (""));
+        dxf_layer_set_plot_style_name (layer, dxf_strdup (""));
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         dxf_layer_set_next (layer, NULL);
@@ -165,16 +165,16 @@ dxf_layer_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (layer == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 layer = dxf_layer_init (layer);
@@ -185,12 +185,12 @@ dxf_layer_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "2") == 0)
@@ -231,7 +231,7 @@ dxf_layer_read
                         if ((strcmp (temp_string, "AcDbSymbolTable") != 0)
                         && ((strcmp (temp_string, "AcDbLayerTableRecord") != 0)))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -286,27 +286,28 @@ dxf_layer_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (layer->layer_name, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () found a bad layer name in: %s in line: %d.\n")),
                   __FUNCTION__, fp->filename, fp->line_number);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\tskipping layer.\n")));
                 return (NULL);
         }
         if (strcmp (layer->linetype, "") == 0)
         {
-                layer->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                layer->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -332,45 +333,45 @@ dxf_layer_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("LAYER");
+        char *dxf_entity_name = dxf_strdup ("LAYER");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (layer == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (dxf_layer_get_layer_name (layer), "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty layer string for the %s table.\n")),
                   __FUNCTION__, dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (dxf_layer_get_linetype (layer), "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s layer\n")),
                   __FUNCTION__, dxf_entity_name);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                dxf_layer_set_linetype (layer, strdup (DXF_DEFAULT_LINETYPE));
+                dxf_layer_set_linetype (layer, dxf_strdup (DXF_DEFAULT_LINETYPE));
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -418,7 +419,7 @@ dxf_layer_write
                 fprintf (fp->fp, "347\n%s\n", dxf_layer_get_material (layer));
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -447,25 +448,25 @@ dxf_layer_free
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (layer->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (dxf_layer_get_layer_name (layer));
-        free (dxf_layer_get_linetype (layer));
-        free (dxf_layer_get_dictionary_owner_soft (layer));
-        free (dxf_layer_get_material (layer));
-        free (dxf_layer_get_dictionary_owner_hard (layer));
-        free (dxf_layer_get_plot_style_name (layer));
-        free (layer);
+        dxf_free (dxf_layer_get_layer_name (layer));
+        dxf_free (dxf_layer_get_linetype (layer));
+        dxf_free (dxf_layer_get_dictionary_owner_soft (layer));
+        dxf_free (dxf_layer_get_material (layer));
+        dxf_free (dxf_layer_get_dictionary_owner_hard (layer));
+        dxf_free (dxf_layer_get_plot_style_name (layer));
+        dxf_free (layer);
         layer = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -486,18 +487,19 @@ dxf_layer_free_list
                  * tables. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (layers == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (layers != NULL)
         {
                 DxfLayer *iter = (DxfLayer *) layers->next;
+                layers->next = NULL;
                 dxf_layer_free (layers);
                 layers = (DxfLayer *) iter;
         }
@@ -617,7 +619,7 @@ dxf_layer_get_layer_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer->layer_name));
+        return (dxf_strdup (layer->layer_name));
 }
 
 
@@ -652,7 +654,7 @@ dxf_layer_set_layer_name
                   __FUNCTION__);
                 return (NULL);
         }
-        layer->layer_name = strdup (layer_name);
+        layer->layer_name = dxf_strdup (layer_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -693,7 +695,7 @@ dxf_layer_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer->linetype));
+        return (dxf_strdup (layer->linetype));
 }
 
 
@@ -727,7 +729,7 @@ dxf_layer_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        layer->linetype = strdup (linetype);
+        layer->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1205,7 +1207,7 @@ dxf_layer_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer->dictionary_owner_soft));
+        return (dxf_strdup (layer->dictionary_owner_soft));
 }
 
 
@@ -1241,7 +1243,7 @@ dxf_layer_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        layer->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        layer->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1285,7 +1287,7 @@ dxf_layer_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer->material));
+        return (dxf_strdup (layer->material));
 }
 
 
@@ -1323,7 +1325,7 @@ dxf_layer_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        layer->material = strdup (material);
+        layer->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1367,7 +1369,7 @@ dxf_layer_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer->dictionary_owner_hard));
+        return (dxf_strdup (layer->dictionary_owner_hard));
 }
 
 
@@ -1403,7 +1405,7 @@ dxf_layer_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        layer->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        layer->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1510,7 +1512,7 @@ dxf_layer_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer->plot_style_name));
+        return (dxf_strdup (layer->plot_style_name));
 }
 
 
@@ -1548,7 +1550,7 @@ dxf_layer_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        layer->plot_style_name = strdup (plot_style_name);
+        layer->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
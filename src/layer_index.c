@@ -80,7 +80,7 @@ dxf_layer_index_new ()
         size = sizeof (DxfLayerIndex);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((layer_index = malloc (size)) == NULL)
+        if ((layer_index = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfLayerIndex struct.\n")),
@@ -118,21 +118,21 @@ dxf_layer_index_init
         /* Do some basic checks. */
         if (layer_index == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 layer_index = dxf_layer_index_new ();
         }
         if (layer_index == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfLayerIndex struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         layer_index->id_code = 0;
-        layer_index->dictionary_owner_soft = strdup ("");
-        layer_index->dictionary_owner_hard = strdup ("");
+        layer_index->dictionary_owner_soft = dxf_strdup ("");
+        layer_index->dictionary_owner_hard = dxf_strdup ("");
         layer_index->time_stamp = 0;
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
@@ -184,22 +184,22 @@ dxf_layer_index_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (layer_index == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 layer_index = dxf_layer_index_init (layer_index);
@@ -214,11 +214,11 @@ dxf_layer_index_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -269,7 +269,7 @@ dxf_layer_index_read
                         if ((strcmp (temp_string, "AcDbIndex") != 0)
                           && (strcmp (temp_string, "AcDbLayerIndex") != 0))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -311,13 +311,14 @@ dxf_layer_index_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -346,32 +347,32 @@ dxf_layer_index_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("LAYER_INDEX");
+        char *dxf_entity_name = dxf_strdup ("LAYER_INDEX");
         DxfLayerName *iter;
         int i;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (layer_index == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, layer_index->id_code);
         }
@@ -428,7 +429,7 @@ dxf_layer_index_write
         }
          */
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -457,23 +458,23 @@ dxf_layer_index_free
         /* Do some basic checks. */
         if (layer_index == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (layer_index->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (layer_index->dictionary_owner_soft);
-        free (layer_index->dictionary_owner_hard);
+        dxf_free (layer_index->dictionary_owner_soft);
+        dxf_free (layer_index->dictionary_owner_hard);
         dxf_char_free_list (layer_index->layer_name);
         dxf_char_free_list (layer_index->hard_owner_reference);
-        free (layer_index);
+        dxf_free (layer_index);
         layer_index = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -494,18 +495,19 @@ dxf_layer_index_free_list
                  * \c LAYER_INDEX objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (layer_indices == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (layer_indices != NULL)
         {
                 DxfLayerIndex *iter = (DxfLayerIndex *) layer_indices->next;
+                layer_indices->next = NULL;
                 dxf_layer_index_free (layer_indices);
                 layer_indices = (DxfLayerIndex *) iter;
         }
@@ -628,7 +630,7 @@ dxf_layer_index_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer_index->dictionary_owner_soft));
+        return (dxf_strdup (layer_index->dictionary_owner_soft));
 }
 
 
@@ -664,7 +666,7 @@ dxf_layer_index_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        layer_index->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        layer_index->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -708,7 +710,7 @@ dxf_layer_index_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer_index->dictionary_owner_hard));
+        return (dxf_strdup (layer_index->dictionary_owner_hard));
 }
 
 
@@ -744,7 +746,7 @@ dxf_layer_index_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        layer_index->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        layer_index->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
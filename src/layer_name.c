@@ -61,7 +61,7 @@ dxf_layer_name_new ()
         size = sizeof (DxfLayerName);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((layer_name = malloc (size)) == NULL)
+        if ((layer_name = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -99,19 +99,19 @@ dxf_layer_name_init
         /* Do some basic checks. */
         if (layer_name == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 layer_name = dxf_layer_name_new ();
         }
         if (layer_name == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        layer_name->name = strdup ("");
+        layer_name->name = dxf_strdup ("");
         layer_name->length = 0;
         layer_name->next = NULL;
 #if DEBUG
@@ -142,20 +142,20 @@ dxf_layer_name_free
         /* Do some basic checks. */
         if (layer_name == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (layer_name->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (layer_name->name);
-        free (layer_name);
+        dxf_free (layer_name->name);
+        dxf_free (layer_name);
         layer_name = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -176,18 +176,19 @@ dxf_layer_name_free_list
                  * \c LAYER_NAME objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (layer_names == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (layer_names != NULL)
         {
                 DxfLayerName *iter = (DxfLayerName *) layer_names->next;
+                layer_names->next = NULL;
                 dxf_layer_name_free (layer_names);
                 layer_names = (DxfLayerName *) iter;
         }
@@ -232,7 +233,7 @@ dxf_layer_name_get_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer_name->name));
+        return (dxf_strdup (layer_name->name));
 }
 
 
@@ -266,7 +267,7 @@ dxf_layer_name_set_name
                   __FUNCTION__);
                 return (NULL);
         }
-        layer_name->name = strdup (name);
+        layer_name->name = dxf_strdup (name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -64,7 +64,7 @@ dxf_leader_new ()
         size = sizeof (DxfLeader);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((leader = malloc (size)) == NULL)
+        if ((leader = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfArc struct.\n")),
@@ -102,21 +102,21 @@ dxf_leader_init
         /* Do some basic checks. */
         if (leader == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 leader = dxf_leader_new ();
         }
         if (leader == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         leader->id_code = 0;
-        leader->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        leader->layer = strdup (DXF_DEFAULT_LAYER);
+        leader->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        leader->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         leader->elevation = 0.0;
         leader->thickness = 0.0;
         leader->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -125,16 +125,16 @@ dxf_leader_init
         leader->paperspace = DXF_MODELSPACE;
         leader->graphics_data_size = 0;
         leader->shadow_mode = 0;
-        leader->dictionary_owner_soft = strdup ("");
-        leader->object_owner_soft = strdup ("");
-        leader->material = strdup ("");
-        leader->dictionary_owner_hard = strdup ("");
+        leader->dictionary_owner_soft = dxf_strdup ("");
+        leader->object_owner_soft = dxf_strdup ("");
+        leader->material = dxf_strdup ("");
+        leader->dictionary_owner_hard = dxf_strdup ("");
         leader->lineweight = 0;
-        leader->plot_style_name = strdup ("");
+        leader->plot_style_name = dxf_strdup ("");
         leader->color_value = 0;
-        leader->color_name = strdup ("");
+        leader->color_name = dxf_strdup ("");
         leader->transparency = 0;
-        leader->dimension_style_name = strdup ("");
+        leader->dimension_style_name = dxf_strdup ("");
         leader->text_annotation_height = 0.0;
         leader->text_annotation_width = 0.0;
         leader->arrow_head_flag = 0;
@@ -147,7 +147,7 @@ dxf_leader_init
         leader->extr_x0 = 0.0;
         leader->extr_y0 = 0.0;
         leader->extr_z0 = 0.0;
-        leader->annotation_reference_hard = strdup ("");
+        leader->annotation_reference_hard = dxf_strdup ("");
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         leader->binary_graphics_data = NULL;
@@ -193,122 +193,122 @@ dxf_leader_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (leader == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 leader = dxf_leader_init (leader);
                 if (leader == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
         }
         if (leader->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfBinaryData struct.\n")));
                 leader->binary_graphics_data = dxf_binary_data_init (leader->binary_graphics_data);
                 if (leader->binary_graphics_data == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
         }
         if (leader->p0 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 leader->p0 = dxf_point_init (leader->p0);
                 if (leader->p0 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
         }
         if (leader->p1 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 leader->p1 = dxf_point_init (leader->p1);
                 if (leader->p1 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
         }
         if (leader->p2 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 leader->p2 = dxf_point_init (leader->p2);
                 if (leader->p2 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
         }
         if (leader->p3 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("Initializing a DxfPoint.\n")));
                 leader->p3 = dxf_point_init (leader->p3);
                 if (leader->p3 == NULL)
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
         }
@@ -320,11 +320,11 @@ dxf_leader_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -505,7 +505,7 @@ dxf_leader_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "AcDbLeader") != 0)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -634,28 +634,29 @@ dxf_leader_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         if (i != leader->number_vertices)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () actual number of vertices differs from number_vertices value in struct.\n")),
                   __FUNCTION__);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (leader->linetype, "") == 0)
         {
-                leader->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                leader->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (leader->layer, "") == 0)
         {
-                leader->layer = strdup (DXF_DEFAULT_LAYER);
+                leader->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -681,63 +682,63 @@ dxf_leader_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("LEADER");
+        char *dxf_entity_name = dxf_strdup ("LEADER");
         int i;
         DxfPoint *iter;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (leader == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (leader->p0 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, leader->id_code);
         }
         if (strcmp (leader->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, leader->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                leader->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                leader->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (leader->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, leader->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                leader->layer = strdup (DXF_DEFAULT_LAYER);
+                leader->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -829,7 +830,7 @@ dxf_leader_write
         }
         if (i != leader->number_vertices)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () actual number of vertices differs from number_vertices value in struct.\n")),
                   __FUNCTION__);
         }
@@ -851,7 +852,7 @@ dxf_leader_write
          * follow.\n This describes any dimension overrides that have
          * been applied to this entity. */
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -880,25 +881,25 @@ dxf_leader_free
         /* Do some basic checks. */
         if (leader == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (leader->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (leader->linetype);
-        free (leader->layer);
-        free (leader->dictionary_owner_soft);
-        free (leader->dictionary_owner_hard);
-        free (leader->dimension_style_name);
-        free (leader->annotation_reference_hard);
-        free (leader);
+        dxf_free (leader->linetype);
+        dxf_free (leader->layer);
+        dxf_free (leader->dictionary_owner_soft);
+        dxf_free (leader->dictionary_owner_hard);
+        dxf_free (leader->dimension_style_name);
+        dxf_free (leader->annotation_reference_hard);
+        dxf_free (leader);
         leader = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -919,18 +920,19 @@ dxf_leader_free_list
                  * \c LEADER entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (leaders == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (leaders != NULL)
         {
                 DxfLeader *iter = (DxfLeader *) leaders->next;
+                leaders->next = NULL;
                 dxf_leader_free (leaders);
                 leaders = (DxfLeader *) iter;
         }
@@ -1050,7 +1052,7 @@ dxf_leader_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (leader->linetype));
+        return (dxf_strdup (leader->linetype));
 }
 
 
@@ -1084,7 +1086,7 @@ dxf_leader_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        leader->linetype = strdup (linetype);
+        leader->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1125,7 +1127,7 @@ dxf_leader_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (leader->layer));
+        return (dxf_strdup (leader->layer));
 }
 
 
@@ -1159,7 +1161,7 @@ dxf_leader_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        leader->layer = strdup (layer);
+        leader->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1663,7 +1665,7 @@ dxf_leader_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (leader->dictionary_owner_soft));
+        return (dxf_strdup (leader->dictionary_owner_soft));
 }
 
 
@@ -1699,7 +1701,7 @@ dxf_leader_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        leader->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        leader->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1743,7 +1745,7 @@ dxf_leader_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (leader->dictionary_owner_hard));
+        return (dxf_strdup (leader->dictionary_owner_hard));
 }
 
 
@@ -1779,7 +1781,7 @@ dxf_leader_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        leader->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        leader->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1821,7 +1823,7 @@ dxf_leader_get_dimension_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (leader->dimension_style_name));
+        return (dxf_strdup (leader->dimension_style_name));
 }
 
 
@@ -1856,7 +1858,7 @@ dxf_leader_set_dimension_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        leader->layer = strdup (dimension_style_name);
+        leader->layer = dxf_strdup (dimension_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1876,7 +1878,7 @@ dxf_leader_get_p0
                 /*!< a pointer to a DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1915,7 +1917,7 @@ dxf_leader_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1954,7 +1956,7 @@ dxf_leader_get_x0
                 /*!< a pointer to a DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1997,7 +1999,7 @@ dxf_leader_set_x0
                  * DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2036,7 +2038,7 @@ dxf_leader_get_y0
                 /*!< a pointer to a DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2079,7 +2081,7 @@ dxf_leader_set_y0
                  * DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2118,7 +2120,7 @@ dxf_leader_get_z0
                 /*!< a pointer to a DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2161,7 +2163,7 @@ dxf_leader_set_z0
                  * DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2199,7 +2201,7 @@ dxf_leader_get_text_annotation_height
                 /*!< a pointer to a DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2240,7 +2242,7 @@ dxf_leader_set_text_annotation_height
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2277,7 +2279,7 @@ dxf_leader_get_text_annotation_width
                 /*!< a pointer to a DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2318,7 +2320,7 @@ dxf_leader_set_text_annotation_width
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2949,7 +2951,7 @@ dxf_leader_get_extr_x0
                 /*!< a pointer to a DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2985,7 +2987,7 @@ dxf_leader_set_extr_x0
                  * DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3017,7 +3019,7 @@ dxf_leader_get_extr_y0
                 /*!< a pointer to a DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3053,7 +3055,7 @@ dxf_leader_set_extr_y0
                  * DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3085,7 +3087,7 @@ dxf_leader_get_extr_z0
                 /*!< a pointer to a DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3121,7 +3123,7 @@ dxf_leader_set_extr_z0
                  * DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3153,7 +3155,7 @@ dxf_leader_get_p1
                 /*!< a pointer to a DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3193,7 +3195,7 @@ dxf_leader_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3232,7 +3234,7 @@ dxf_leader_get_x1
                 /*!< a pointer to a DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3275,7 +3277,7 @@ dxf_leader_set_x1
                  * leader \c x1 of a DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3314,7 +3316,7 @@ dxf_leader_get_y1
                 /*!< a pointer to a DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3357,7 +3359,7 @@ dxf_leader_set_y1
                  * leader \c y1 of a DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3396,7 +3398,7 @@ dxf_leader_get_z1
                 /*!< a pointer to a DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3439,7 +3441,7 @@ dxf_leader_set_z1
                  * leader \c z1 of a DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3478,7 +3480,7 @@ dxf_leader_get_p2
                 /*!< a pointer to a DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3518,7 +3520,7 @@ dxf_leader_set_p2
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3558,7 +3560,7 @@ dxf_leader_get_x2
                 /*!< a pointer to a DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3602,7 +3604,7 @@ dxf_leader_set_x2
                  * \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3642,7 +3644,7 @@ dxf_leader_get_y2
                 /*!< a pointer to a DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3686,7 +3688,7 @@ dxf_leader_set_y2
                  * \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3726,7 +3728,7 @@ dxf_leader_get_z2
                 /*!< a pointer to a DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3770,7 +3772,7 @@ dxf_leader_set_z2
                  * \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3809,7 +3811,7 @@ dxf_leader_get_p3
                 /*!< a pointer to a DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3849,7 +3851,7 @@ dxf_leader_set_p3
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3889,7 +3891,7 @@ dxf_leader_get_x3
                 /*!< a pointer to a DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3933,7 +3935,7 @@ dxf_leader_set_x3
                  * \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3973,7 +3975,7 @@ dxf_leader_get_y3
                 /*!< a pointer to a DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4017,7 +4019,7 @@ dxf_leader_set_y3
                  * \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4057,7 +4059,7 @@ dxf_leader_get_z3
                 /*!< a pointer to a DXF \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4101,7 +4103,7 @@ dxf_leader_set_z3
                  * \c LEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4163,7 +4165,7 @@ dxf_leader_get_annotation_reference_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (leader->annotation_reference_hard));
+        return (dxf_strdup (leader->annotation_reference_hard));
 }
 
 
@@ -4199,7 +4201,7 @@ dxf_leader_set_annotation_reference_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        leader->annotation_reference_hard = strdup (annotation_reference_hard);
+        leader->annotation_reference_hard = dxf_strdup (annotation_reference_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
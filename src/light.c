@@ -58,7 +58,7 @@ dxf_light_new ()
         size = sizeof (DxfLight);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((light = malloc (size)) == NULL)
+        if ((light = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -96,21 +96,21 @@ dxf_light_init
         /* Do some basic checks. */
         if (light == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 light = dxf_light_new ();
         }
         if (light == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         light->id_code = 0;
-        light->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        light->layer = strdup (DXF_DEFAULT_LAYER);
+        light->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        light->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         light->thickness = 0.0;
         light->linetype_scale = 0.0;
         light->visibility = 0;
@@ -119,15 +119,15 @@ dxf_light_init
         light->graphics_data_size = 0;
         light->shadow_mode = 0;
         light->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init (light->binary_graphics_data);
-        light->dictionary_owner_hard = strdup ("");
-        light->material = strdup ("");
-        light->dictionary_owner_soft = strdup ("");
+        light->dictionary_owner_hard = dxf_strdup ("");
+        light->material = dxf_strdup ("");
+        light->dictionary_owner_soft = dxf_strdup ("");
         light->lineweight = 0;
-        light->plot_style_name = strdup ("");
+        light->plot_style_name = dxf_strdup ("");
         light->color_value = 0;
-        light->color_name = strdup ("");
+        light->color_name = dxf_strdup ("");
         light->transparency = 0;
-        light->light_name = strdup ("");
+        light->light_name = dxf_strdup ("");
         light->p0 = dxf_point_init (light->p0);
         light->p1 = dxf_point_init (light->p1);
         light->intensity = 0.0;
@@ -182,16 +182,16 @@ dxf_light_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (light == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 light = dxf_light_init (light);
@@ -202,12 +202,12 @@ dxf_light_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -391,7 +391,7 @@ dxf_light_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                                 && ((strcmp (temp_string, "AcDbLight") != 0)))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -429,9 +429,8 @@ dxf_light_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, light->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) light->binary_graphics_data->next);
-                        light->binary_graphics_data = (DxfBinaryGraphicsData *) light->binary_graphics_data->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_graphics_data_append_hex ((DxfBinaryGraphicsData *) light->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -497,22 +496,23 @@ dxf_light_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (light->linetype, "") == 0)
         {
-                light->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                light->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (light->layer, "") == 0)
         {
-                light->layer = strdup (DXF_DEFAULT_LAYER);
+                light->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -538,50 +538,49 @@ dxf_light_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("LIGHT");
-        DxfBinaryGraphicsData *iter_310 = NULL;
+        char *dxf_entity_name = dxf_strdup ("LIGHT");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (light == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_2007)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (strcmp (light->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, light->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                light->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                light->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (light->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, light->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to default layer.\n")),
                   dxf_entity_name);
                 light->layer = DXF_DEFAULT_LAYER;
@@ -629,12 +628,7 @@ dxf_light_write
 #else
         fprintf (fp->fp, " 92\n%d\n", light->graphics_data_size);
 #endif
-        iter_310 = (DxfBinaryGraphicsData *) light->binary_graphics_data;
-        while (iter_310 != NULL)
-        {
-                fprintf (fp->fp, "310\n%s\n", iter_310->data_line);
-                iter_310 = (DxfBinaryGraphicsData *) iter_310->next;
-        }
+        dxf_binary_graphics_data_write (fp, (DxfBinaryGraphicsData *) light->binary_graphics_data);
         fprintf (fp->fp, "420\n%ld\n", light->color_value);
         fprintf (fp->fp, "430\n%s\n", light->color_name);
         fprintf (fp->fp, "440\n%ld\n", light->transparency);
@@ -664,7 +658,7 @@ dxf_light_write
         fprintf (fp->fp, " 91\n%hi\n", light->shadow_map_size);
         fprintf (fp->fp, "280\n%d\n", light->shadow_map_softness);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -693,30 +687,30 @@ dxf_light_free
         /* Do some basic checks. */
         if (light == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (light->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (light->linetype);
-        free (light->layer);
+        dxf_free (light->linetype);
+        dxf_free (light->layer);
         dxf_binary_graphics_data_free_list ((DxfBinaryGraphicsData *) light->binary_graphics_data);
-        free (light->dictionary_owner_hard);
-        free (light->material);
-        free (light->dictionary_owner_soft);
-        free (light->plot_style_name);
-        free (light->color_name);
-        free (light->light_name);
+        dxf_free (light->dictionary_owner_hard);
+        dxf_free (light->material);
+        dxf_free (light->dictionary_owner_soft);
+        dxf_free (light->plot_style_name);
+        dxf_free (light->color_name);
+        dxf_free (light->light_name);
         dxf_point_free (light->p0);
         dxf_point_free (light->p1);
-        free (light);
+        dxf_free (light);
         light = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -737,18 +731,19 @@ dxf_light_free_list
                  * of DXF \c LIGHT entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (light_list == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (light_list != NULL)
         {
                 DxfLight *iter = (DxfLight *) light_list->next;
+                light_list->next = NULL;
                 dxf_light_free (light_list);
                 light_list = (DxfLight *) iter;
         }
@@ -870,7 +865,7 @@ dxf_light_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (light->linetype));
+        return (dxf_strdup (light->linetype));
 }
 
 
@@ -907,7 +902,7 @@ dxf_light_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        light->linetype = strdup (linetype);
+        light->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -948,7 +943,7 @@ dxf_light_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (light->layer));
+        return (dxf_strdup (light->layer));
 }
 
 
@@ -985,7 +980,7 @@ dxf_light_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        light->layer = strdup (layer);
+        light->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1704,7 +1699,7 @@ dxf_light_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (light->dictionary_owner_soft));
+        return (dxf_strdup (light->dictionary_owner_soft));
 }
 
 
@@ -1743,7 +1738,7 @@ dxf_light_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        light->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        light->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1787,7 +1782,7 @@ dxf_light_get_object_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (light->object_owner_soft));
+        return (dxf_strdup (light->object_owner_soft));
 }
 
 
@@ -1823,7 +1818,7 @@ dxf_light_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        light->object_owner_soft = strdup (object_owner_soft);
+        light->object_owner_soft = dxf_strdup (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1867,7 +1862,7 @@ dxf_light_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (light->material));
+        return (dxf_strdup (light->material));
 }
 
 
@@ -1905,7 +1900,7 @@ dxf_light_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        light->material = strdup (material);
+        light->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1950,7 +1945,7 @@ dxf_light_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (light->dictionary_owner_hard));
+        return (dxf_strdup (light->dictionary_owner_hard));
 }
 
 
@@ -1989,7 +1984,7 @@ dxf_light_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        light->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        light->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2096,7 +2091,7 @@ dxf_light_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (light->plot_style_name));
+        return (dxf_strdup (light->plot_style_name));
 }
 
 
@@ -2134,7 +2129,7 @@ dxf_light_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        light->plot_style_name = strdup (plot_style_name);
+        light->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2241,7 +2236,7 @@ dxf_light_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (light->color_name));
+        return (dxf_strdup (light->color_name));
 }
 
 
@@ -2279,7 +2274,7 @@ dxf_light_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        light->color_name = strdup (color_name);
+        light->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -40,6 +40,7 @@
 
 
 #include "line.h"
+#include "util.h"
 
 
 /*!
@@ -65,7 +66,7 @@ dxf_line_new ()
         size = sizeof (DxfLine);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((line = malloc (size)) == NULL)
+        if ((line = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -103,14 +104,14 @@ dxf_line_init
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 line = dxf_line_new ();
         }
         if (line == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
@@ -119,7 +120,7 @@ dxf_line_init
         line->binary_graphics_data = (DxfBinaryData *) dxf_binary_data_init (line->binary_graphics_data);
         if (line->binary_graphics_data == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
@@ -127,7 +128,7 @@ dxf_line_init
         line->p0 = (DxfPoint *) dxf_point_init (line->p0);
         if (line->p0 == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
@@ -135,15 +136,15 @@ dxf_line_init
         line->p1 = (DxfPoint *) dxf_point_init (line->p1);
         if (line->p1 == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         /* Assign initial values to members. */
         line->id_code = 0;
-        line->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        line->layer = strdup (DXF_DEFAULT_LAYER);
+        line->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        line->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         line->elevation = 0.0;
         line->thickness = 0.0;
         line->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -152,14 +153,14 @@ dxf_line_init
         line->paperspace = DXF_MODELSPACE;
         line->graphics_data_size = 0;
         line->shadow_mode = 0;
-        line->dictionary_owner_soft = strdup ("");
-        line->object_owner_soft = strdup ("");
-        line->material = strdup ("");
-        line->dictionary_owner_hard = strdup ("");
+        line->dictionary_owner_soft = dxf_strdup ("");
+        line->object_owner_soft = dxf_strdup ("");
+        line->material = dxf_strdup ("");
+        line->dictionary_owner_hard = dxf_strdup ("");
         line->lineweight = 0;
-        line->plot_style_name = strdup ("");
+        line->plot_style_name = dxf_strdup ("");
         line->color_value = 0;
-        line->color_name = strdup ("");
+        line->color_name = dxf_strdup ("");
         line->transparency = 0;
         line->p0->x0 = 0.0;
         line->p0->y0 = 0.0;
@@ -201,41 +202,35 @@ dxf_line_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int iter330;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (line == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 line = dxf_line_init (line);
         }
-        iter310 = (DxfBinaryData *) line->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        memset (temp_string, 0, sizeof (temp_string));
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -250,13 +245,17 @@ dxf_line_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->linetype);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (line->linetype);
+                        line->linetype = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->layer);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (line->layer);
+                        line->layer = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -358,7 +357,7 @@ dxf_line_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbLine") != 0)))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -403,9 +402,8 @@ dxf_line_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_data_append_hex ((DxfBinaryData *) line->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -414,14 +412,18 @@ dxf_line_read
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
                                 (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->dictionary_owner_soft);
+                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                                dxf_free (line->dictionary_owner_soft);
+                                line->dictionary_owner_soft = dxf_strdup (temp_string);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
                                 (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->object_owner_soft);
+                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                                dxf_free (line->object_owner_soft);
+                                line->object_owner_soft = dxf_strdup (temp_string);
                         }
                         iter330++;
                 }
@@ -430,14 +432,18 @@ dxf_line_read
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->material);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (line->material);
+                        line->material = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->dictionary_owner_hard);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (line->dictionary_owner_hard);
+                        line->dictionary_owner_hard = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -451,7 +457,9 @@ dxf_line_read
                         /* Now follows a string containing a plot style
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->plot_style_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (line->plot_style_name);
+                        line->plot_style_name = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -464,7 +472,9 @@ dxf_line_read
                         /* Now follows a string containing a color
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->color_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (line->color_name);
+                        line->color_name = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -482,22 +492,25 @@ dxf_line_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
+                        dxf_read_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (line->linetype, "") == 0)
         {
-                line->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_free (line->linetype);
+                line->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (line->layer, "") == 0)
         {
-                line->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_free (line->layer);
+                line->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -523,58 +536,58 @@ dxf_line_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("LINE");
+        char *dxf_entity_name = dxf_strdup ("LINE");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (line == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((line->p0->x0 == line->p1->x0)
                 && (line->p0->y0 == line->p1->y0)
                 && (line->p0->z0 == line->p1->z0))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () start point and end point are identical for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, line->id_code);
                 dxf_entity_skip (dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (line->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, line->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                line->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                line->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (line->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, line->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                line->layer = strdup (DXF_DEFAULT_LAYER);
+                line->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -663,16 +676,7 @@ dxf_line_write
 #else
                 fprintf (fp->fp, " 92\n%" PRIi32 "\n", line->graphics_data_size);
 #endif
-                if (line->binary_graphics_data != NULL)
-                {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) line->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
-                }
+                dxf_binary_data_write (fp, (DxfBinaryData *) line->binary_graphics_data);
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
@@ -705,7 +709,7 @@ dxf_line_write
                 fprintf (fp->fp, "230\n%f\n", line->extr_z0);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -734,30 +738,30 @@ dxf_line_free
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (line->linetype);
-        free (line->layer);
+        dxf_free (line->linetype);
+        dxf_free (line->layer);
         dxf_binary_data_free_list (line->binary_graphics_data);
-        free (line->dictionary_owner_soft);
-        free (line->object_owner_soft);
-        free (line->material);
-        free (line->dictionary_owner_hard);
-        free (line->plot_style_name);
-        free (line->color_name);
+        dxf_free (line->dictionary_owner_soft);
+        dxf_free (line->object_owner_soft);
+        dxf_free (line->material);
+        dxf_free (line->dictionary_owner_hard);
+        dxf_free (line->plot_style_name);
+        dxf_free (line->color_name);
         dxf_point_free (line->p0);
         dxf_point_free (line->p1);
-        free (line);
+        dxf_free (line);
         line = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -778,18 +782,19 @@ dxf_line_free_list
                  * entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (lines == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (lines != NULL)
         {
                 DxfLine *iter = (DxfLine *) lines->next;
+                lines->next = NULL;
                 dxf_line_free (lines);
                 lines = (DxfLine *) iter;
         }
@@ -907,7 +912,7 @@ dxf_line_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->linetype));
+        return (dxf_strdup (line->linetype));
 }
 
 
@@ -941,7 +946,7 @@ dxf_line_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        line->linetype = strdup (linetype);
+        line->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -982,7 +987,7 @@ dxf_line_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->layer));
+        return (dxf_strdup (line->layer));
 }
 
 
@@ -1016,7 +1021,7 @@ dxf_line_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        line->layer = strdup (layer);
+        line->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1773,7 +1778,7 @@ dxf_line_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->dictionary_owner_soft));
+        return (dxf_strdup (line->dictionary_owner_soft));
 }
 
 
@@ -1809,7 +1814,7 @@ dxf_line_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        line->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        line->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1854,7 +1859,7 @@ dxf_line_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->material));
+        return (dxf_strdup (line->material));
 }
 
 
@@ -1893,7 +1898,7 @@ dxf_line_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        line->material = strdup (material);
+        line->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1937,7 +1942,7 @@ dxf_line_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->dictionary_owner_hard));
+        return (dxf_strdup (line->dictionary_owner_hard));
 }
 
 
@@ -1973,7 +1978,7 @@ dxf_line_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        line->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        line->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2080,7 +2085,7 @@ dxf_line_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->plot_style_name));
+        return (dxf_strdup (line->plot_style_name));
 }
 
 
@@ -2118,7 +2123,7 @@ dxf_line_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        line->plot_style_name = strdup (plot_style_name);
+        line->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2225,7 +2230,7 @@ dxf_line_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->color_name));
+        return (dxf_strdup (line->color_name));
 }
 
 
@@ -2263,7 +2268,7 @@ dxf_line_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        line->color_name = strdup (color_name);
+        line->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2348,7 +2353,7 @@ dxf_line_get_p0
                 /*!< a pointer to a DXF \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2387,7 +2392,7 @@ dxf_line_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2426,7 +2431,7 @@ dxf_line_get_x0
                 /*!< a pointer to a DXF \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2469,7 +2474,7 @@ dxf_line_set_x0
                  * \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2508,7 +2513,7 @@ dxf_line_get_y0
                 /*!< a pointer to a DXF \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2551,7 +2556,7 @@ dxf_line_set_y0
                  * \c line entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2590,7 +2595,7 @@ dxf_line_get_z0
                 /*!< a pointer to a DXF \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2633,7 +2638,7 @@ dxf_line_set_z0
                  * \c line entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2671,7 +2676,7 @@ dxf_line_get_p1
                 /*!< a pointer to a DXF \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2710,7 +2715,7 @@ dxf_line_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2749,7 +2754,7 @@ dxf_line_get_x1
                 /*!< a pointer to a DXF \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2792,7 +2797,7 @@ dxf_line_set_x1
                  * \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2831,7 +2836,7 @@ dxf_line_get_y1
                 /*!< a pointer to a DXF \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2874,7 +2879,7 @@ dxf_line_set_y1
                  * \c line entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2913,7 +2918,7 @@ dxf_line_get_z1
                 /*!< a pointer to a DXF \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2956,7 +2961,7 @@ dxf_line_set_z1
                  * \c line entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2995,7 +3000,7 @@ dxf_line_get_extr_x0
                 /*!< a pointer to a DXF \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3031,7 +3036,7 @@ dxf_line_set_extr_x0
                  * \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3063,7 +3068,7 @@ dxf_line_get_extr_y0
                 /*!< a pointer to a DXF \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3099,7 +3104,7 @@ dxf_line_set_extr_y0
                  * \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3131,7 +3136,7 @@ dxf_line_get_extr_z0
                 /*!< a pointer to a DXF \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3167,7 +3172,7 @@ dxf_line_set_extr_z0
                  * \c POLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3201,7 +3206,7 @@ dxf_line_get_extrusion_vector_as_point
                 /*!< a pointer to a DXF \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *point = NULL;
@@ -3426,7 +3431,7 @@ dxf_line_get_mid_point
                  */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *point = NULL;
@@ -3474,11 +3479,11 @@ dxf_line_get_mid_point
                 case 1:
                         if (line->linetype != NULL)
                         {
-                                point->linetype = strdup (line->linetype);
+                                point->linetype = dxf_strdup (line->linetype);
                         }
                         if (line->layer != NULL)
                         {
-                                point->layer = strdup (line->layer);
+                                point->layer = dxf_strdup (line->layer);
                         }
                         point->thickness = line->thickness;
                         point->linetype_scale = line->linetype_scale;
@@ -3487,11 +3492,11 @@ dxf_line_get_mid_point
                         point->paperspace = line->paperspace;
                         if (line->dictionary_owner_soft != NULL)
                         {
-                                point->dictionary_owner_soft = strdup (line->dictionary_owner_soft);
+                                point->dictionary_owner_soft = dxf_strdup (line->dictionary_owner_soft);
                         }
                         if (line->dictionary_owner_hard != NULL)
                         {
-                                point->dictionary_owner_hard = strdup (line->dictionary_owner_hard);
+                                point->dictionary_owner_hard = dxf_strdup (line->dictionary_owner_hard);
                         }
                         break;
                 default:
@@ -3522,7 +3527,7 @@ dxf_line_get_length
                 /*!< a pointer to a DXF \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         double length;
@@ -3660,25 +3665,25 @@ dxf_line_create_from_points
                         line->binary_graphics_data = p1->binary_graphics_data;
                         if (p1->dictionary_owner_soft != NULL)
                         {
-                                line->dictionary_owner_soft = strdup (p1->dictionary_owner_soft);
+                                line->dictionary_owner_soft = dxf_strdup (p1->dictionary_owner_soft);
                         }
                         if (p1->material != NULL)
                         {
-                                line->material = strdup (p1->material);
+                                line->material = dxf_strdup (p1->material);
                         }
                         if (p1->dictionary_owner_hard != NULL)
                         {
-                                line->dictionary_owner_hard = strdup (p1->dictionary_owner_hard);
+                                line->dictionary_owner_hard = dxf_strdup (p1->dictionary_owner_hard);
                         }
                         line->lineweight = p1->lineweight;
                         if (p1->plot_style_name != NULL)
                         {
-                                line->plot_style_name = strdup (p1->plot_style_name);
+                                line->plot_style_name = dxf_strdup (p1->plot_style_name);
                         }
                         line->color_value = p1->color_value;
                         if (p1->color_name != NULL)
                         {
-                                line->color_name = strdup (p1->color_name);
+                                line->color_name = dxf_strdup (p1->color_name);
                         }
                         line->transparency = p1->transparency;
                         break;
@@ -3702,25 +3707,25 @@ dxf_line_create_from_points
                         line->binary_graphics_data = p2->binary_graphics_data;
                         if (p2->dictionary_owner_soft != NULL)
                         {
-                                line->dictionary_owner_soft = strdup (p2->dictionary_owner_soft);
+                                line->dictionary_owner_soft = dxf_strdup (p2->dictionary_owner_soft);
                         }
                         if (p2->material != NULL)
                         {
-                                line->material = strdup (p2->material);
+                                line->material = dxf_strdup (p2->material);
                         }
                         if (p2->dictionary_owner_hard != NULL)
                         {
-                                line->dictionary_owner_hard = strdup (p2->dictionary_owner_hard);
+                                line->dictionary_owner_hard = dxf_strdup (p2->dictionary_owner_hard);
                         }
                         line->lineweight = p2->lineweight;
                         if (p2->plot_style_name != NULL)
                         {
-                                line->plot_style_name = strdup (p2->plot_style_name);
+                                line->plot_style_name = dxf_strdup (p2->plot_style_name);
                         }
                         line->color_value = p2->color_value;
                         if (p2->color_name != NULL)
                         {
-                                line->color_name = strdup (p2->color_name);
+                                line->color_name = dxf_strdup (p2->color_name);
                         }
                         line->transparency = p2->transparency;
                         break;
@@ -59,7 +59,7 @@ dxf_ltype_new ()
         size = sizeof (DxfLType);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((ltype = malloc (size)) == NULL)
+        if ((ltype = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfArc struct.\n")),
@@ -99,26 +99,26 @@ dxf_ltype_init
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 ltype = dxf_ltype_new ();
         }
         if (ltype == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfLType struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         ltype->id_code = 0;
-        ltype->linetype_name = strdup ("");
-        ltype->description = strdup ("");
+        ltype->linetype_name = dxf_strdup ("");
+        ltype->description = dxf_strdup ("");
         ltype->total_pattern_length = 0.0;
         ltype->number_of_linetype_elements = 0;
         for ((i = 0); (i <= DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS); i++)
         {
-                dxf_ltype_set_complex_text_string (ltype, i, strdup (""));
+                dxf_ltype_set_complex_text_string (ltype, i, dxf_strdup (""));
                 dxf_ltype_set_complex_x_offset (ltype, i, 0.0);
                 dxf_ltype_set_complex_y_offset (ltype, i, 0.0);
                 dxf_ltype_set_complex_scale (ltype, i, 0.0);
@@ -126,12 +126,12 @@ dxf_ltype_init
                 dxf_ltype_set_complex_rotation (ltype, i, 0.0);
                 dxf_ltype_set_complex_element (ltype, i, 1);
                 dxf_ltype_set_complex_shape_number (ltype, i, 0);
-                dxf_ltype_set_complex_style_pointer (ltype, i, strdup (""));
+                dxf_ltype_set_complex_style_pointer (ltype, i, dxf_strdup (""));
         }
         ltype->flag = 0;
         ltype->alignment = 65;
-        ltype->dictionary_owner_soft = strdup ("");
-        ltype->dictionary_owner_hard = strdup ("");
+        ltype->dictionary_owner_soft = dxf_strdup ("");
+        ltype->dictionary_owner_hard = dxf_strdup ("");
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -168,16 +168,16 @@ dxf_ltype_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 ltype = dxf_ltype_init (ltype);
@@ -189,12 +189,12 @@ dxf_ltype_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -339,18 +339,19 @@ dxf_ltype_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (ltype->linetype_name, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s (): empty linetype name string for the entity with id-code: %x\n")),
                   __FUNCTION__, ltype->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\tentity is discarded from output.\n")));
                 return (NULL);
         }
@@ -359,7 +360,7 @@ dxf_ltype_read
                 ltype->alignment = 65;
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -385,38 +386,38 @@ dxf_ltype_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("LTYPE");
+        char *dxf_entity_name = dxf_strdup ("LTYPE");
         int i;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (ltype->linetype_name, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s (): empty linetype name string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, ltype->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is discarded from output.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
@@ -539,14 +540,14 @@ dxf_ltype_write
                                 fprintf (fp->fp, "340\n%s\n", dxf_ltype_get_complex_style_pointer (ltype, i));
                                 break;
                         default:
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s (): unknown complex element code for the %s entity with id-code: %x\n")),
                                   __FUNCTION__, dxf_entity_name, ltype->id_code);
                                 break;
                 }
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -577,28 +578,28 @@ dxf_ltype_free
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ltype->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (ltype->linetype_name);
-        free (ltype->description);
+        dxf_free (ltype->linetype_name);
+        dxf_free (ltype->description);
         for ((i = 0); (i <= DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS); i++)
         {
-                free (dxf_ltype_get_complex_text_string (ltype, i));
-                free (dxf_ltype_get_complex_style_pointer (ltype, i));
+                dxf_free (dxf_ltype_get_complex_text_string (ltype, i));
+                dxf_free (dxf_ltype_get_complex_style_pointer (ltype, i));
         }
-        free (ltype->dictionary_owner_soft);
-        free (ltype->dictionary_owner_hard);
-        free (ltype);
+        dxf_free (ltype->dictionary_owner_soft);
+        dxf_free (ltype->dictionary_owner_hard);
+        dxf_free (ltype);
         ltype = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -619,18 +620,19 @@ dxf_ltype_free_list
                  * \c LTYPE symbol table entries. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (ltypes == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (ltypes != NULL)
         {
                 DxfLType *iter = (DxfLType *) ltypes->next;
+                ltypes->next = NULL;
                 dxf_ltype_free (ltypes);
                 ltypes = (DxfLType *) iter;
         }
@@ -751,7 +753,7 @@ dxf_ltype_get_linetype_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ltype->linetype_name));
+        return (dxf_strdup (ltype->linetype_name));
 }
 
 
@@ -786,7 +788,7 @@ dxf_ltype_set_linetype_name
                   __FUNCTION__);
                 return (NULL);
         }
-        ltype->linetype_name = strdup (linetype_name);
+        ltype->linetype_name = dxf_strdup (linetype_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -828,7 +830,7 @@ dxf_ltype_get_description
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ltype->description));
+        return (dxf_strdup (ltype->description));
 }
 
 
@@ -863,7 +865,7 @@ dxf_ltype_set_description
                   __FUNCTION__);
                 return (NULL);
         }
-        ltype->description = strdup (description);
+        ltype->description = dxf_strdup (description);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -922,7 +924,7 @@ dxf_ltype_get_complex_text_string
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ltype->complex_text_string[i]));
+        return (dxf_strdup (ltype->complex_text_string[i]));
 }
 
 
@@ -974,7 +976,7 @@ dxf_ltype_set_complex_text_string
                   __FUNCTION__);
                 return (NULL);
         }
-        ltype->complex_text_string[i] = strdup (complex_text_string);
+        ltype->complex_text_string[i] = dxf_strdup (complex_text_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2075,7 +2077,7 @@ dxf_ltype_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ltype->dictionary_owner_soft));
+        return (dxf_strdup (ltype->dictionary_owner_soft));
 }
 
 
@@ -2111,7 +2113,7 @@ dxf_ltype_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        ltype->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        ltype->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2170,7 +2172,7 @@ dxf_ltype_get_complex_style_pointer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ltype->complex_style_pointer[i]));
+        return (dxf_strdup (ltype->complex_style_pointer[i]));
 }
 
 
@@ -2222,7 +2224,7 @@ dxf_ltype_set_complex_style_pointer
                   __FUNCTION__);
                 return (NULL);
         }
-        ltype->complex_style_pointer[i] = strdup (complex_style_pointer);
+        ltype->complex_style_pointer[i] = dxf_strdup (complex_style_pointer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2266,7 +2268,7 @@ dxf_ltype_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ltype->dictionary_owner_hard));
+        return (dxf_strdup (ltype->dictionary_owner_hard));
 }
 
 
@@ -2302,7 +2304,7 @@ dxf_ltype_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        ltype->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        ltype->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -44,6 +44,7 @@
 
 
 #include "lwpolyline.h"
+#include "util.h"
 
 
 /*!
@@ -65,7 +66,7 @@ dxf_lwpolyline_new ()
         size = sizeof (DxfLWPolyline);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((lwpolyline = malloc (size)) == NULL)
+        if ((lwpolyline = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfLWPolyline struct.\n")),
@@ -103,21 +104,21 @@ dxf_lwpolyline_init
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 lwpolyline = dxf_lwpolyline_new ();
         }
         if (lwpolyline == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfLWPolyline struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         lwpolyline->id_code = 0;
-        lwpolyline->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        lwpolyline->layer = strdup (DXF_DEFAULT_LAYER);
+        lwpolyline->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        lwpolyline->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         lwpolyline->elevation = 0.0;
         lwpolyline->thickness = 0.0;
         lwpolyline->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -130,9 +131,9 @@ dxf_lwpolyline_init
         lwpolyline->extr_x0 = 0.0;
         lwpolyline->extr_y0 = 0.0;
         lwpolyline->extr_z0 = 0.0;
-        lwpolyline->dictionary_owner_soft = strdup ("");
-        lwpolyline->dictionary_owner_hard = strdup ("");
-        lwpolyline->vertices = (struct DxfVertex *) dxf_vertex_new ();
+        lwpolyline->dictionary_owner_soft = dxf_strdup ("");
+        lwpolyline->dictionary_owner_hard = dxf_strdup ("");
+        lwpolyline->vertices = (struct DxfVertex *) dxf_vertex_init (dxf_vertex_new ());
         lwpolyline->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -164,34 +165,33 @@ dxf_lwpolyline_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         DxfVertex *iter = NULL;
+        int number_of_vertices = 0;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 lwpolyline = dxf_lwpolyline_init (lwpolyline);
         }
         iter = (DxfVertex *) lwpolyline->vertices;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        memset (temp_string, 0, sizeof (temp_string));
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
@@ -209,18 +209,29 @@ dxf_lwpolyline_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, lwpolyline->linetype);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (lwpolyline->linetype);
+                        lwpolyline->linetype = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, lwpolyline->layer);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (lwpolyline->layer);
+                        lwpolyline->layer = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
                         /* Now follows a string containing the
-                        * X-coordinate of a vertex. */
+                        * X-coordinate of a vertex, the first member
+                        * of a vertex. */
+                        if (number_of_vertices > 0)
+                        {
+                                iter->next = (struct DxfVertex *) dxf_vertex_init (dxf_vertex_new ());
+                                iter = (DxfVertex *) iter->next;
+                        }
+                        number_of_vertices++;
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &iter->p0->x0);
                 }
@@ -267,11 +278,6 @@ dxf_lwpolyline_read
                          * the vertex. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &iter->bulge);
-                        /* The last member of the vertex is read.\n */
-                        /*! \todo The pointer administration needs to be checked for functionality. */
-                         /* Increment iter to next DxfVertex. */
-                        iter->next = (struct DxfVertex *) dxf_vertex_new ();
-                        iter = (DxfVertex *) iter->next;
                 }
                 else if (strcmp (temp_string, "43") == 0)
                 {
@@ -359,14 +365,18 @@ dxf_lwpolyline_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, lwpolyline->dictionary_owner_soft);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (lwpolyline->dictionary_owner_soft);
+                        lwpolyline->dictionary_owner_soft = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, lwpolyline->dictionary_owner_hard);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (lwpolyline->dictionary_owner_hard);
+                        lwpolyline->dictionary_owner_hard = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -377,10 +387,13 @@ dxf_lwpolyline_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
+                        dxf_read_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /*! \todo Free memory to the last (unused) vertex in the linked list. */
 
@@ -389,14 +402,14 @@ dxf_lwpolyline_read
         /* Handle omitted members and/or illegal values. */
         if (strcmp (lwpolyline->linetype, "") == 0)
         {
-                lwpolyline->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_free (lwpolyline->linetype);
+                lwpolyline->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (lwpolyline->layer, "") == 0)
         {
-                lwpolyline->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_free (lwpolyline->layer);
+                lwpolyline->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -429,61 +442,61 @@ dxf_lwpolyline_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("LWPOLYLINE");
+        char *dxf_entity_name = dxf_strdup ("LWPOLYLINE");
         DxfVertex *iter = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((fp->acad_version_number < AutoCAD_14)
           && (fp->follow_strict_version_rules))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, lwpolyline->id_code);
                 return (EXIT_FAILURE);
         }
         else
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, lwpolyline->id_code);
         }
         if (strcmp (lwpolyline->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, lwpolyline->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                lwpolyline->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                lwpolyline->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (lwpolyline->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, lwpolyline->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                lwpolyline->layer = strdup (DXF_DEFAULT_LAYER);
+                lwpolyline->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -578,7 +591,7 @@ dxf_lwpolyline_write
                 fprintf (fp->fp, "230\n%f\n", lwpolyline->extr_z0);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -606,21 +619,22 @@ dxf_lwpolyline_free
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (lwpolyline->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (lwpolyline->linetype);
-        free (lwpolyline->layer);
-        free (lwpolyline);
+        dxf_free (lwpolyline->linetype);
+        dxf_free (lwpolyline->layer);
+        dxf_vertex_free_list ((DxfVertex *) lwpolyline->vertices);
+        dxf_free (lwpolyline);
         lwpolyline = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -641,18 +655,19 @@ dxf_lwpolyline_free_list
                  * \c LWPOLYLINE entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (lwpolylines == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (lwpolylines != NULL)
         {
                 DxfLWPolyline *iter = (DxfLWPolyline *) lwpolylines->next;
+                lwpolylines->next = NULL;
                 dxf_lwpolyline_free (lwpolylines);
                 lwpolylines = (DxfLWPolyline *) iter;
         }
@@ -772,7 +787,7 @@ dxf_lwpolyline_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (lwpolyline->linetype));
+        return (dxf_strdup (lwpolyline->linetype));
 }
 
 
@@ -806,7 +821,7 @@ dxf_lwpolyline_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->linetype = strdup (linetype);
+        lwpolyline->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -847,7 +862,7 @@ dxf_lwpolyline_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (lwpolyline->layer));
+        return (dxf_strdup (lwpolyline->layer));
 }
 
 
@@ -881,7 +896,7 @@ dxf_lwpolyline_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->layer = strdup (layer);
+        lwpolyline->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1651,7 +1666,7 @@ dxf_lwpolyline_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (lwpolyline->dictionary_owner_soft));
+        return (dxf_strdup (lwpolyline->dictionary_owner_soft));
 }
 
 
@@ -1687,7 +1702,7 @@ dxf_lwpolyline_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        lwpolyline->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1731,7 +1746,7 @@ dxf_lwpolyline_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (lwpolyline->material));
+        return (dxf_strdup (lwpolyline->material));
 }
 
 
@@ -1770,7 +1785,7 @@ dxf_lwpolyline_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->material = strdup (material);
+        lwpolyline->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1814,7 +1829,7 @@ dxf_lwpolyline_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (lwpolyline->dictionary_owner_hard));
+        return (dxf_strdup (lwpolyline->dictionary_owner_hard));
 }
 
 
@@ -1850,7 +1865,7 @@ dxf_lwpolyline_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        lwpolyline->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1957,7 +1972,7 @@ dxf_lwpolyline_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (lwpolyline->plot_style_name));
+        return (dxf_strdup (lwpolyline->plot_style_name));
 }
 
 
@@ -1995,7 +2010,7 @@ dxf_lwpolyline_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->plot_style_name = strdup (plot_style_name);
+        lwpolyline->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2102,7 +2117,7 @@ dxf_lwpolyline_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (lwpolyline->color_name));
+        return (dxf_strdup (lwpolyline->color_name));
 }
 
 
@@ -2140,7 +2155,7 @@ dxf_lwpolyline_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->color_name = strdup (color_name);
+        lwpolyline->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2225,7 +2240,7 @@ dxf_lwpolyline_get_constant_width
                 /*!< a pointer to a DXF \c LWPOLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2267,7 +2282,7 @@ dxf_lwpolyline_set_constant_width
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2456,7 +2471,7 @@ dxf_lwpolyline_get_extr_x0
                 /*!< a pointer to a DXF \c LWPOLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2492,7 +2507,7 @@ dxf_lwpolyline_set_extr_x0
                  * DXF \c LWPOLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2524,7 +2539,7 @@ dxf_lwpolyline_get_extr_y0
                 /*!< a pointer to a DXF \c LWPOLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2560,7 +2575,7 @@ dxf_lwpolyline_set_extr_y0
                  * DXF \c LWPOLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2592,7 +2607,7 @@ dxf_lwpolyline_get_extr_z0
                 /*!< a pointer to a DXF \c LWPOLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2628,7 +2643,7 @@ dxf_lwpolyline_set_extr_z0
                  * DXF \c LWPOLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
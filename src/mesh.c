@@ -58,7 +58,7 @@ dxf_mesh_new ()
         size = sizeof (DxfMesh);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((mesh = malloc (size)) == NULL)
+        if ((mesh = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -96,21 +96,21 @@ dxf_mesh_init
         /* Do some basic checks. */
         if (mesh == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 mesh = dxf_mesh_new ();
         }
         if (mesh == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         mesh->id_code = 0;
-        mesh->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        mesh->layer = strdup (DXF_DEFAULT_LAYER);
+        mesh->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        mesh->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         mesh->elevation = 0.0;
         mesh->thickness = 0.0;
         mesh->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -121,14 +121,14 @@ dxf_mesh_init
         mesh->shadow_mode = 0;
         mesh->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
         mesh->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init (mesh->binary_graphics_data);
-        mesh->dictionary_owner_soft = strdup ("");
-        mesh->object_owner_soft = strdup ("");
-        mesh->material = strdup ("");
-        mesh->dictionary_owner_hard = strdup ("");
+        mesh->dictionary_owner_soft = dxf_strdup ("");
+        mesh->object_owner_soft = dxf_strdup ("");
+        mesh->material = dxf_strdup ("");
+        mesh->dictionary_owner_hard = dxf_strdup ("");
         mesh->lineweight = 0;
-        mesh->plot_style_name = strdup ("");
+        mesh->plot_style_name = dxf_strdup ("");
         mesh->color_value = 0;
-        mesh->color_name = strdup ("");
+        mesh->color_name = dxf_strdup ("");
         mesh->transparency = 0;
         mesh->p0 = dxf_point_new ();
         mesh->p0 = dxf_point_init (mesh->p0);
@@ -184,27 +184,25 @@ dxf_mesh_read
         DXF_DEBUG_BEGIN
 #endif
         char *temp_string = NULL;
-        DxfBinaryGraphicsData *iter310 = NULL;
         int iter330;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (mesh == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 mesh = dxf_mesh_init (mesh);
         }
-        iter310 = (DxfBinaryGraphicsData *) mesh->binary_graphics_data;
         iter330 = 0;
         (fp->line_number)++;
         fscanf (fp->fp, "%[^\n]", temp_string);
@@ -212,12 +210,12 @@ dxf_mesh_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -321,7 +319,7 @@ dxf_mesh_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "AcDbSubMesh") != 0)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -345,9 +343,8 @@ dxf_mesh_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) iter310->next);
-                        iter310 = (DxfBinaryGraphicsData *) iter310->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_graphics_data_append_hex ((DxfBinaryGraphicsData *) mesh->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -424,22 +421,23 @@ dxf_mesh_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (mesh->linetype, "") == 0)
         {
-                mesh->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                mesh->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (mesh->layer, "") == 0)
         {
-                mesh->layer = strdup (DXF_DEFAULT_LAYER);
+                mesh->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -465,52 +463,52 @@ dxf_mesh_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("MESH");
+        char *dxf_entity_name = dxf_strdup ("MESH");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (mesh == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (mesh->p0 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (mesh->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, mesh->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                mesh->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                mesh->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (mesh->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, mesh->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
                 mesh->layer = DXF_DEFAULT_LAYER;
@@ -597,16 +595,7 @@ dxf_mesh_write
 #else
                 fprintf (fp->fp, " 92\n%d\n", mesh->graphics_data_size);
 #endif
-                if (mesh->binary_graphics_data != NULL)
-                {
-                        DxfBinaryGraphicsData *iter;
-                        iter = (DxfBinaryGraphicsData *) mesh->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryGraphicsData *) iter->next;
-                        }
-                }
+                dxf_binary_graphics_data_write (fp, (DxfBinaryGraphicsData *) mesh->binary_graphics_data);
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
@@ -681,7 +670,7 @@ dxf_mesh_write
         fprintf (fp->fp, " 92\n%d\n", mesh->count_of_property_overridden);
         fprintf (fp->fp, " 90\n%d\n", mesh->property_type);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -710,32 +699,32 @@ dxf_mesh_free
         /* Do some basic checks. */
         if (mesh == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (mesh->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (mesh->linetype);
-        free (mesh->layer);
+        dxf_free (mesh->linetype);
+        dxf_free (mesh->layer);
         dxf_binary_graphics_data_free_list (mesh->binary_graphics_data);
-        free (mesh->dictionary_owner_soft);
-        free (mesh->object_owner_soft);
-        free (mesh->material);
-        free (mesh->dictionary_owner_hard);
-        free (mesh->plot_style_name);
-        free (mesh->color_name);
+        dxf_free (mesh->dictionary_owner_soft);
+        dxf_free (mesh->object_owner_soft);
+        dxf_free (mesh->material);
+        dxf_free (mesh->dictionary_owner_hard);
+        dxf_free (mesh->plot_style_name);
+        dxf_free (mesh->color_name);
         dxf_point_free_list (mesh->p0);
         dxf_int32_free_list (mesh->face_list_item);
         dxf_int32_free_list (mesh->edge_vertex_index);
         dxf_double_free_list (mesh->edge_create_value);
-        free (mesh);
+        dxf_free (mesh);
         mesh = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -756,18 +745,19 @@ dxf_mesh_free_list
                  * \c MESH entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (meshes == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (meshes != NULL)
         {
                 DxfMesh *iter = (DxfMesh *) meshes->next;
+                meshes->next = NULL;
                 dxf_mesh_free (meshes);
                 meshes = (DxfMesh *) iter;
         }
@@ -888,7 +878,7 @@ dxf_mesh_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mesh->linetype));
+        return (dxf_strdup (mesh->linetype));
 }
 
 
@@ -926,7 +916,7 @@ dxf_mesh_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        mesh->linetype = strdup (linetype);
+        mesh->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -967,7 +957,7 @@ dxf_mesh_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mesh->layer));
+        return (dxf_strdup (mesh->layer));
 }
 
 
@@ -1005,7 +995,7 @@ dxf_mesh_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        mesh->layer = strdup (layer);
+        mesh->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1781,7 +1771,7 @@ dxf_mesh_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mesh->dictionary_owner_soft));
+        return (dxf_strdup (mesh->dictionary_owner_soft));
 }
 
 
@@ -1820,7 +1810,7 @@ dxf_mesh_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        mesh->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        mesh->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1864,7 +1854,7 @@ dxf_mesh_get_object_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mesh->object_owner_soft));
+        return (dxf_strdup (mesh->object_owner_soft));
 }
 
 
@@ -1903,7 +1893,7 @@ dxf_mesh_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        mesh->object_owner_soft = strdup (object_owner_soft);
+        mesh->object_owner_soft = dxf_strdup (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1947,7 +1937,7 @@ dxf_mesh_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mesh->material));
+        return (dxf_strdup (mesh->material));
 }
 
 
@@ -1985,7 +1975,7 @@ dxf_mesh_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        mesh->material = strdup (material);
+        mesh->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2029,7 +2019,7 @@ dxf_mesh_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mesh->dictionary_owner_hard));
+        return (dxf_strdup (mesh->dictionary_owner_hard));
 }
 
 
@@ -2068,7 +2058,7 @@ dxf_mesh_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        mesh->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        mesh->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2175,7 +2165,7 @@ dxf_mesh_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mesh->plot_style_name));
+        return (dxf_strdup (mesh->plot_style_name));
 }
 
 
@@ -2213,7 +2203,7 @@ dxf_mesh_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mesh->plot_style_name = strdup (plot_style_name);
+        mesh->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2320,7 +2310,7 @@ dxf_mesh_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mesh->color_name));
+        return (dxf_strdup (mesh->color_name));
 }
 
 
@@ -2358,7 +2348,7 @@ dxf_mesh_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mesh->color_name = strdup (color_name);
+        mesh->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2443,7 +2433,7 @@ dxf_mesh_get_p0
                 /*!< a pointer to a DXF \c MESH entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2483,7 +2473,7 @@ dxf_mesh_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2522,7 +2512,7 @@ dxf_mesh_get_x0
                 /*!< a pointer to a DXF \c MESH entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2565,7 +2555,7 @@ dxf_mesh_set_x0
                  * \c MESH entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2604,7 +2594,7 @@ dxf_mesh_get_y0
                 /*!< a pointer to a DXF \c MESH entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2647,7 +2637,7 @@ dxf_mesh_set_y0
                  * \c MESH entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2686,7 +2676,7 @@ dxf_mesh_get_z0
                 /*!< a pointer to a DXF \c MESH entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2729,7 +2719,7 @@ dxf_mesh_set_z0
                  * \c MESH entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3674,7 +3664,7 @@ dxf_mesh_get_edge_create_value
                 /*!< a pointer to a DXF \c MESH entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3708,7 +3698,7 @@ dxf_mesh_set_edge_create_value
                 /*!< the \c edge_create_value of a DXF \c MESH entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -57,7 +57,7 @@ dxf_mleader_new ()
         size = sizeof (DxfMLeader);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((mleader = malloc (size)) == NULL)
+        if ((mleader = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -95,21 +95,21 @@ dxf_mleader_init
         /* Do some basic checks. */
         if (mleader == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 mleader = dxf_mleader_new ();
         }
         if (mleader == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         mleader->id_code = 0;
-        mleader->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        mleader->layer = strdup (DXF_DEFAULT_LAYER);
+        mleader->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        mleader->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         mleader->elevation = 0.0;
         mleader->thickness = 0.0;
         mleader->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -120,14 +120,14 @@ dxf_mleader_init
         mleader->shadow_mode = 0;
         mleader->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
         mleader->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init (mleader->binary_graphics_data);
-        mleader->dictionary_owner_soft = strdup ("");
-        mleader->object_owner_soft = strdup ("");
-        mleader->material = strdup ("");
-        mleader->dictionary_owner_hard = strdup ("");
+        mleader->dictionary_owner_soft = dxf_strdup ("");
+        mleader->object_owner_soft = dxf_strdup ("");
+        mleader->material = dxf_strdup ("");
+        mleader->dictionary_owner_hard = dxf_strdup ("");
         mleader->lineweight = 0;
-        mleader->plot_style_name = strdup ("");
+        mleader->plot_style_name = dxf_strdup ("");
         mleader->color_value = 0;
-        mleader->color_name = strdup ("");
+        mleader->color_name = dxf_strdup ("");
         mleader->transparency = 0;
         mleader->block_content_scale = 0.0;
         mleader->dogleg_length = 0.0;
@@ -158,13 +158,13 @@ dxf_mleader_init
         mleader->enable_frame_text = 0;
         mleader->enable_annotation_scale = 0;
         mleader->text_direction_negative = 0;
-        mleader->block_attribute_text_string = strdup ("");
-        mleader->block_attribute_id = strdup ("");
-        mleader->leader_style_id = strdup ("");
-        mleader->arrowhead_id = strdup ("");
-        mleader->text_style_id = strdup ("");
-        mleader->block_content_id = strdup ("");
-        mleader->arrow_head_id = strdup ("");
+        mleader->block_attribute_text_string = dxf_strdup ("");
+        mleader->block_attribute_id = dxf_strdup ("");
+        mleader->leader_style_id = dxf_strdup ("");
+        mleader->arrowhead_id = dxf_strdup ("");
+        mleader->text_style_id = dxf_strdup ("");
+        mleader->block_content_id = dxf_strdup ("");
+        mleader->arrow_head_id = dxf_strdup ("");
         mleader->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -197,28 +197,26 @@ dxf_mleader_read
         DXF_DEBUG_BEGIN
 #endif
         char *temp_string = NULL;
-        DxfBinaryGraphicsData *iter310 = NULL;
         int iter92;
         int iter330;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (mleader == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 mleader = dxf_mleader_init (mleader);
         }
-        iter310 = (DxfBinaryGraphicsData *) mleader->binary_graphics_data;
         iter92 = 0;
         iter330 = 0;
         (fp->line_number)++;
@@ -227,12 +225,12 @@ dxf_mleader_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -538,9 +536,8 @@ dxf_mleader_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) iter310->next);
-                        iter310 = (DxfBinaryGraphicsData *) iter310->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_graphics_data_append_hex ((DxfBinaryGraphicsData *) mleader->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -666,22 +663,23 @@ dxf_mleader_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (mleader->linetype, "") == 0)
         {
-                mleader->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                mleader->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (mleader->layer, "") == 0)
         {
-                mleader->layer = strdup (DXF_DEFAULT_LAYER);
+                mleader->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -704,49 +702,49 @@ dxf_mleader_write
                 /*!< a pointer to a DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("MLEADER");
+        char *dxf_entity_name = dxf_strdup ("MLEADER");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (mleader == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((strcmp (mleader->layer, "") == 0) || (mleader->layer == NULL))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () invalid layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, mleader->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                mleader->layer = strdup (DXF_DEFAULT_LAYER);
+                mleader->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (mleader->linetype == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () invalid linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, mleader->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s linetype is set to %s\n")),
                   dxf_entity_name, DXF_DEFAULT_LINETYPE);
-                mleader->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                mleader->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -835,16 +833,7 @@ dxf_mleader_write
 #else
                 fprintf (fp->fp, " 92\n%d\n", mleader->graphics_data_size);
 #endif
-                if (mleader->binary_graphics_data != NULL)
-                {
-                        DxfBinaryGraphicsData *iter;
-                        iter = (DxfBinaryGraphicsData *) mleader->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryGraphicsData *) iter->next;
-                        }
-                }
+                dxf_binary_graphics_data_write (fp, (DxfBinaryGraphicsData *) mleader->binary_graphics_data);
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
@@ -858,8 +847,8 @@ dxf_mleader_write
                 fprintf (fp->fp, "284\n%d\n", mleader->shadow_mode);
         }
         /* Clean up. */
-        free (dxf_entity_name);
-#ifdef DEBUG
+        dxf_free (dxf_entity_name);
+#if DEBUG
         DXF_DEBUG_END
 #endif
         return (EXIT_SUCCESS);
@@ -887,36 +876,36 @@ dxf_mleader_free
         /* Do some basic checks. */
         if (mleader == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (mleader->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (mleader->linetype);
-        free (mleader->layer);
+        dxf_free (mleader->linetype);
+        dxf_free (mleader->layer);
         dxf_binary_graphics_data_free_list (mleader->binary_graphics_data);
-        free (mleader->dictionary_owner_soft);
-        free (mleader->object_owner_soft);
-        free (mleader->material);
-        free (mleader->dictionary_owner_hard);
-        free (mleader->plot_style_name);
-        free (mleader->color_name);
-        free (mleader->block_attribute_text_string);
-        free (mleader->block_attribute_id);
-        free (mleader->leader_style_id);
-        free (mleader->leader_linetype_id);
-        free (mleader->arrowhead_id);
-        free (mleader->text_style_id);
-        free (mleader->block_content_id);
-        free (mleader->arrow_head_id);
-        free (mleader);
+        dxf_free (mleader->dictionary_owner_soft);
+        dxf_free (mleader->object_owner_soft);
+        dxf_free (mleader->material);
+        dxf_free (mleader->dictionary_owner_hard);
+        dxf_free (mleader->plot_style_name);
+        dxf_free (mleader->color_name);
+        dxf_free (mleader->block_attribute_text_string);
+        dxf_free (mleader->block_attribute_id);
+        dxf_free (mleader->leader_style_id);
+        dxf_free (mleader->leader_linetype_id);
+        dxf_free (mleader->arrowhead_id);
+        dxf_free (mleader->text_style_id);
+        dxf_free (mleader->block_content_id);
+        dxf_free (mleader->arrow_head_id);
+        dxf_free (mleader);
         mleader = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -937,18 +926,19 @@ dxf_mleader_free_list
                  * \c MLEADER entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (mleaders == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (mleaders != NULL)
         {
                 DxfMLeader *iter = (DxfMLeader *) mleaders->next;
+                mleaders->next = NULL;
                 dxf_mleader_free (mleaders);
                 mleaders = (DxfMLeader *) iter;
         }
@@ -1069,7 +1059,7 @@ dxf_mleader_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->linetype));
+        return (dxf_strdup (mleader->linetype));
 }
 
 
@@ -1107,7 +1097,7 @@ dxf_mleader_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->linetype = strdup (linetype);
+        mleader->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1148,7 +1138,7 @@ dxf_mleader_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->layer));
+        return (dxf_strdup (mleader->layer));
 }
 
 
@@ -1186,7 +1176,7 @@ dxf_mleader_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->layer = strdup (layer);
+        mleader->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1964,7 +1954,7 @@ dxf_mleader_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->dictionary_owner_soft));
+        return (dxf_strdup (mleader->dictionary_owner_soft));
 }
 
 
@@ -2003,7 +1993,7 @@ dxf_mleader_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        mleader->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2047,7 +2037,7 @@ dxf_mleader_get_object_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->object_owner_soft));
+        return (dxf_strdup (mleader->object_owner_soft));
 }
 
 
@@ -2086,7 +2076,7 @@ dxf_mleader_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->object_owner_soft = strdup (object_owner_soft);
+        mleader->object_owner_soft = dxf_strdup (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2131,7 +2121,7 @@ dxf_mleader_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->material));
+        return (dxf_strdup (mleader->material));
 }
 
 
@@ -2169,7 +2159,7 @@ dxf_mleader_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->material = strdup (material);
+        mleader->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2213,7 +2203,7 @@ dxf_mleader_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->dictionary_owner_hard));
+        return (dxf_strdup (mleader->dictionary_owner_hard));
 }
 
 
@@ -2252,7 +2242,7 @@ dxf_mleader_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        mleader->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2359,7 +2349,7 @@ dxf_mleader_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->plot_style_name));
+        return (dxf_strdup (mleader->plot_style_name));
 }
 
 
@@ -2397,7 +2387,7 @@ dxf_mleader_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->plot_style_name = strdup (plot_style_name);
+        mleader->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2504,7 +2494,7 @@ dxf_mleader_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->color_name));
+        return (dxf_strdup (mleader->color_name));
 }
 
 
@@ -2542,7 +2532,7 @@ dxf_mleader_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->color_name = strdup (color_name);
+        mleader->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2627,7 +2617,7 @@ dxf_mleader_get_block_content_scale
                 /*!< a pointer to a DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2661,7 +2651,7 @@ dxf_mleader_set_block_content_scale
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2692,7 +2682,7 @@ dxf_mleader_get_dogleg_length
                 /*!< a pointer to a DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2726,7 +2716,7 @@ dxf_mleader_set_dogleg_length
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2757,7 +2747,7 @@ dxf_mleader_get_arrowhead_size
                 /*!< a pointer to a DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2791,7 +2781,7 @@ dxf_mleader_set_arrowhead_size
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2822,7 +2812,7 @@ dxf_mleader_get_block_content_rotation
                 /*!< a pointer to a DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2856,7 +2846,7 @@ dxf_mleader_set_block_content_rotation
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2887,7 +2877,7 @@ dxf_mleader_get_block_attribute_width
                 /*!< a pointer to a DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2921,7 +2911,7 @@ dxf_mleader_set_block_attribute_width
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4699,7 +4689,7 @@ dxf_mleader_get_block_attribute_text_string
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->block_attribute_text_string));
+        return (dxf_strdup (mleader->block_attribute_text_string));
 }
 
 
@@ -4739,7 +4729,7 @@ dxf_mleader_set_block_attribute_text_string
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->block_attribute_text_string = strdup (block_attribute_text_string);
+        mleader->block_attribute_text_string = dxf_strdup (block_attribute_text_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4781,7 +4771,7 @@ dxf_mleader_get_block_attribute_id
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->block_attribute_id));
+        return (dxf_strdup (mleader->block_attribute_id));
 }
 
 
@@ -4819,7 +4809,7 @@ dxf_mleader_set_block_attribute_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->block_attribute_id = strdup (block_attribute_id);
+        mleader->block_attribute_id = dxf_strdup (block_attribute_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4861,7 +4851,7 @@ dxf_mleader_get_leader_style_id
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->leader_style_id));
+        return (dxf_strdup (mleader->leader_style_id));
 }
 
 
@@ -4899,7 +4889,7 @@ dxf_mleader_set_leader_style_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->leader_style_id = strdup (leader_style_id);
+        mleader->leader_style_id = dxf_strdup (leader_style_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4941,7 +4931,7 @@ dxf_mleader_get_leader_linetype_id
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->leader_linetype_id));
+        return (dxf_strdup (mleader->leader_linetype_id));
 }
 
 
@@ -4979,7 +4969,7 @@ dxf_mleader_set_leader_linetype_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->leader_linetype_id = strdup (leader_linetype_id);
+        mleader->leader_linetype_id = dxf_strdup (leader_linetype_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5021,7 +5011,7 @@ dxf_mleader_get_arrowhead_id
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->arrowhead_id));
+        return (dxf_strdup (mleader->arrowhead_id));
 }
 
 
@@ -5059,7 +5049,7 @@ dxf_mleader_set_arrowhead_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->arrowhead_id = strdup (arrowhead_id);
+        mleader->arrowhead_id = dxf_strdup (arrowhead_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5101,7 +5091,7 @@ dxf_mleader_get_text_style_id
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->text_style_id));
+        return (dxf_strdup (mleader->text_style_id));
 }
 
 
@@ -5139,7 +5129,7 @@ dxf_mleader_set_text_style_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->text_style_id = strdup (text_style_id);
+        mleader->text_style_id = dxf_strdup (text_style_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5181,7 +5171,7 @@ dxf_mleader_get_block_content_id
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->block_content_id));
+        return (dxf_strdup (mleader->block_content_id));
 }
 
 
@@ -5219,7 +5209,7 @@ dxf_mleader_set_block_content_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->block_content_id = strdup (block_content_id);
+        mleader->block_content_id = dxf_strdup (block_content_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5261,7 +5251,7 @@ dxf_mleader_get_arrow_head_id
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->arrow_head_id));
+        return (dxf_strdup (mleader->arrow_head_id));
 }
 
 
@@ -5299,7 +5289,7 @@ dxf_mleader_set_arrow_head_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->arrow_head_id = strdup (arrow_head_id);
+        mleader->arrow_head_id = dxf_strdup (arrow_head_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5455,7 +5445,7 @@ dxf_mleader_context_data_new ()
         size = sizeof (DxfMLeaderContextData);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((data = malloc (size)) == NULL)
+        if ((data = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -5494,14 +5484,14 @@ dxf_mleader_context_data_init
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 data = dxf_mleader_context_data_new ();
         }
         if (data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5555,9 +5545,9 @@ dxf_mleader_context_data_init
         data->text_use_word_break = 0;
         data->has_block = 0;
         data->MLeader_plane_normal_reversed = 0;
-        data->default_text_contents = strdup ("");
-        data->type_style_id = strdup ("");
-        data->block_content_id = strdup ("");
+        data->default_text_contents = dxf_strdup ("");
+        data->type_style_id = dxf_strdup ("");
+        data->block_content_id = dxf_strdup ("");
         data->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -5588,14 +5578,14 @@ dxf_mleader_context_data_free
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (data->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -5607,10 +5597,10 @@ dxf_mleader_context_data_free
         dxf_point_free_list (data->p3);
         dxf_point_free_list (data->p4);
         dxf_point_free_list (data->p5);
-        free (data->default_text_contents);
-        free (data->type_style_id);
-        free (data->block_content_id);
-        free (data);
+        dxf_free (data->default_text_contents);
+        dxf_free (data->type_style_id);
+        dxf_free (data->block_content_id);
+        dxf_free (data);
         data = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -5632,18 +5622,19 @@ dxf_mleader_context_data_free_list
                  * \c DxfMLeaderContextData objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (datas == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (datas != NULL)
         {
                 DxfMLeaderContextData *iter = (DxfMLeaderContextData *) datas->next;
+                datas->next = NULL;
                 dxf_mleader_context_data_free (datas);
                 datas = (DxfMLeaderContextData *) iter;
         }
@@ -5667,7 +5658,7 @@ dxf_mleader_context_data_get_p0
                  * DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5708,7 +5699,7 @@ dxf_mleader_context_data_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5747,7 +5738,7 @@ dxf_mleader_context_data_get_x0
                 /*!< a pointer to a \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -5790,7 +5781,7 @@ dxf_mleader_context_data_set_x0
                  * object of a DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5829,7 +5820,7 @@ dxf_mleader_context_data_get_y0
                 /*!< a pointer to a \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -5872,7 +5863,7 @@ dxf_mleader_context_data_set_y0
                  * object of a DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5911,7 +5902,7 @@ dxf_mleader_context_data_get_z0
                 /*!< a pointer to a \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -5954,7 +5945,7 @@ dxf_mleader_context_data_set_z0
                  * object of a DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5994,7 +5985,7 @@ dxf_mleader_context_data_get_vertex
                  * DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6035,7 +6026,7 @@ dxf_mleader_context_data_set_vertex
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6074,7 +6065,7 @@ dxf_mleader_context_data_get_vertex_x0
                 /*!< a pointer to a \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -6118,7 +6109,7 @@ dxf_mleader_context_data_set_vertex_x0
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6157,7 +6148,7 @@ dxf_mleader_context_data_get_vertex_y0
                 /*!< a pointer to a \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -6201,7 +6192,7 @@ dxf_mleader_context_data_set_vertex_y0
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6240,7 +6231,7 @@ dxf_mleader_context_data_get_vertex_z0
                 /*!< a pointer to a \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -6284,7 +6275,7 @@ dxf_mleader_context_data_set_vertex_z0
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6324,7 +6315,7 @@ dxf_mleader_context_data_get_p1
                  * DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6365,7 +6356,7 @@ dxf_mleader_context_data_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6404,7 +6395,7 @@ dxf_mleader_context_data_get_x1
                 /*!< a pointer to a \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -6447,7 +6438,7 @@ dxf_mleader_context_data_set_x1
                  * object of a DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6486,7 +6477,7 @@ dxf_mleader_context_data_get_y1
                 /*!< a pointer to a \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -6529,7 +6520,7 @@ dxf_mleader_context_data_set_y1
                  * object of a DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6568,7 +6559,7 @@ dxf_mleader_context_data_get_z1
                 /*!< a pointer to a \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -6611,7 +6602,7 @@ dxf_mleader_context_data_set_z1
                  * object of a DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6651,7 +6642,7 @@ dxf_mleader_context_data_get_p2
                  * DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6692,7 +6683,7 @@ dxf_mleader_context_data_set_p2
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6731,7 +6722,7 @@ dxf_mleader_context_data_get_x2
                 /*!< a pointer to a \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -6774,7 +6765,7 @@ dxf_mleader_context_data_set_x2
                  * object of a DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6813,7 +6804,7 @@ dxf_mleader_context_data_get_y2
                 /*!< a pointer to a \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -6856,7 +6847,7 @@ dxf_mleader_context_data_set_y2
                  * object of a DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6895,7 +6886,7 @@ dxf_mleader_context_data_get_z2
                 /*!< a pointer to a \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -6938,7 +6929,7 @@ dxf_mleader_context_data_set_z2
                  * object of a DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6978,7 +6969,7 @@ dxf_mleader_context_data_get_p3
                  * DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -7019,7 +7010,7 @@ dxf_mleader_context_data_set_p3
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -7058,7 +7049,7 @@ dxf_mleader_context_data_get_x3
                 /*!< a pointer to a \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -7101,7 +7092,7 @@ dxf_mleader_context_data_set_x3
                  * object of a DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -7140,7 +7131,7 @@ dxf_mleader_context_data_get_y3
                 /*!< a pointer to a \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -7183,7 +7174,7 @@ dxf_mleader_context_data_set_y3
                  * object of a DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -7222,7 +7213,7 @@ dxf_mleader_context_data_get_z3
                 /*!< a pointer to a \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -7265,7 +7256,7 @@ dxf_mleader_context_data_set_z3
                  * object of a DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -7305,7 +7296,7 @@ dxf_mleader_context_data_get_p4
                  * DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -7346,7 +7337,7 @@ dxf_mleader_context_data_set_p4
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -7385,7 +7376,7 @@ dxf_mleader_context_data_get_x4
                 /*!< a pointer to a \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -7428,7 +7419,7 @@ dxf_mleader_context_data_set_x4
                  * object of a DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -7467,7 +7458,7 @@ dxf_mleader_context_data_get_y4
                 /*!< a pointer to a \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -7510,7 +7501,7 @@ dxf_mleader_context_data_set_y4
                  * object of a DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -7549,7 +7540,7 @@ dxf_mleader_context_data_get_z4
                 /*!< a pointer to a \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -7592,7 +7583,7 @@ dxf_mleader_context_data_set_z4
                  * object of a DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -7632,7 +7623,7 @@ dxf_mleader_context_data_get_p5
                  * DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -7673,7 +7664,7 @@ dxf_mleader_context_data_set_p5
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -7712,7 +7703,7 @@ dxf_mleader_context_data_get_x5
                 /*!< a pointer to a \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -7755,7 +7746,7 @@ dxf_mleader_context_data_set_x5
                  * object of a DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -7794,7 +7785,7 @@ dxf_mleader_context_data_get_y5
                 /*!< a pointer to a \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -7837,7 +7828,7 @@ dxf_mleader_context_data_set_y5
                  * object of a DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -7876,7 +7867,7 @@ dxf_mleader_context_data_get_z5
                 /*!< a pointer to a \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -7919,7 +7910,7 @@ dxf_mleader_context_data_set_z5
                  * object of a DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -7958,7 +7949,7 @@ dxf_mleader_context_data_get_block_content_scale
                 /*!< a pointer to a DXF \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -7992,7 +7983,7 @@ dxf_mleader_context_data_set_block_content_scale
                 /*!< the \c block_content_scale. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8024,7 +8015,7 @@ dxf_mleader_context_data_get_content_scale
                 /*!< a pointer to a DXF \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8059,7 +8050,7 @@ dxf_mleader_context_data_set_content_scale
                  * \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8091,7 +8082,7 @@ dxf_mleader_context_data_get_text_height
                 /*!< a pointer to a DXF \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8126,7 +8117,7 @@ dxf_mleader_context_data_set_text_height
                  * \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8158,7 +8149,7 @@ dxf_mleader_context_data_get_text_rotation
                 /*!< a pointer to a DXF \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8193,7 +8184,7 @@ dxf_mleader_context_data_set_text_rotation
                  * \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8225,7 +8216,7 @@ dxf_mleader_context_data_get_text_width
                 /*!< a pointer to a DXF \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8260,7 +8251,7 @@ dxf_mleader_context_data_set_text_width
                  * \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8292,7 +8283,7 @@ dxf_mleader_context_data_get_text_height2
                 /*!< a pointer to a DXF \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8327,7 +8318,7 @@ dxf_mleader_context_data_set_text_height2
                  * \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8359,7 +8350,7 @@ dxf_mleader_context_data_get_text_line_spacing_factor
                 /*!< a pointer to a DXF \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8394,7 +8385,7 @@ dxf_mleader_context_data_set_text_line_spacing_factor
                  * \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8426,7 +8417,7 @@ dxf_mleader_context_data_get_block_content_rotation
                 /*!< a pointer to a DXF \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8461,7 +8452,7 @@ dxf_mleader_context_data_set_block_content_rotation
                  * \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8493,7 +8484,7 @@ dxf_mleader_context_data_get_block_transformation_matrix
                 /*!< a pointer to a DXF \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8528,7 +8519,7 @@ dxf_mleader_context_data_set_block_transformation_matrix
                  * \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8892,7 +8883,7 @@ dxf_mleader_context_data_get_MLeader_plane_origin_point
                 /*!< a pointer to a DXF \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8927,7 +8918,7 @@ dxf_mleader_context_data_set_MLeader_plane_origin_point
                  * \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8959,7 +8950,7 @@ dxf_mleader_context_data_get_MLeader_plane_X_axis_direction
                 /*!< a pointer to a DXF \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8994,7 +8985,7 @@ dxf_mleader_context_data_set_MLeader_plane_X_axis_direction
                  * \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -9026,7 +9017,7 @@ dxf_mleader_context_data_get_MLeader_plane_Y_axis_direction
                 /*!< a pointer to a DXF \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -9061,7 +9052,7 @@ dxf_mleader_context_data_set_MLeader_plane_Y_axis_direction
                  * \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -9093,7 +9084,7 @@ dxf_mleader_context_data_get_arrowhead_size
                 /*!< a pointer to a DXF \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -9128,7 +9119,7 @@ dxf_mleader_context_data_set_arrowhead_size
                  * \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -9160,7 +9151,7 @@ dxf_mleader_context_data_get_text_background_scale_factor
                 /*!< a pointer to a DXF \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -9195,7 +9186,7 @@ dxf_mleader_context_data_set_text_background_scale_factor
                  * \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -9227,7 +9218,7 @@ dxf_mleader_context_data_get_text_column_width
                 /*!< a pointer to a DXF \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -9262,7 +9253,7 @@ dxf_mleader_context_data_set_text_column_width
                  * \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -9294,7 +9285,7 @@ dxf_mleader_context_data_get_text_column_gutter_width
                 /*!< a pointer to a DXF \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -9329,7 +9320,7 @@ dxf_mleader_context_data_set_text_column_gutter_width
                  * \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -9361,7 +9352,7 @@ dxf_mleader_context_data_get_text_column_height
                 /*!< a pointer to a DXF \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -9396,7 +9387,7 @@ dxf_mleader_context_data_set_text_column_height
                  * \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -9428,7 +9419,7 @@ dxf_mleader_context_data_get_landing_gap
                 /*!< a pointer to a DXF \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -9463,7 +9454,7 @@ dxf_mleader_context_data_set_landing_gap
                  * \c DxfMLeaderContextData object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -10625,7 +10616,7 @@ dxf_mleader_leader_node_new ()
         size = sizeof (DxfMLeaderLeaderNode);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((node = malloc (size)) == NULL)
+        if ((node = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -10664,14 +10655,14 @@ dxf_mleader_leader_node_init
         /* Do some basic checks. */
         if (node == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 node = dxf_mleader_leader_node_new ();
         }
         if (node == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -10718,14 +10709,14 @@ dxf_mleader_leader_node_free
         /* Do some basic checks. */
         if (node == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (node->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -10734,7 +10725,7 @@ dxf_mleader_leader_node_free
         dxf_point_free_list (node->p1);
         dxf_point_free_list (node->p2);
         dxf_point_free_list (node->p3);
-        free (node);
+        dxf_free (node);
         node = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -10756,18 +10747,19 @@ dxf_mleader_leader_node_free_list
                  * \c DxfMLeaderLeaderNode objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (nodes == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (nodes != NULL)
         {
                 DxfMLeaderLeaderNode *iter = (DxfMLeaderLeaderNode *) nodes->next;
+                nodes->next = NULL;
                 dxf_mleader_leader_node_free (nodes);
                 nodes = (DxfMLeaderLeaderNode *) iter;
         }
@@ -10791,7 +10783,7 @@ dxf_mleader_leader_node_get_p0
                  * DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -10832,7 +10824,7 @@ dxf_mleader_leader_node_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -10871,7 +10863,7 @@ dxf_mleader_leader_node_get_x0
                 /*!< a pointer to a \c DxfMLeaderLeaderNode object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -10915,7 +10907,7 @@ dxf_mleader_leader_node_set_x0
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -10954,7 +10946,7 @@ dxf_mleader_leader_node_get_y0
                 /*!< a pointer to a \c DxfMLeaderLeaderNode object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -10998,7 +10990,7 @@ dxf_mleader_leader_node_set_y0
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -11037,7 +11029,7 @@ dxf_mleader_leader_node_get_z0
                 /*!< a pointer to a \c DxfMLeaderLeaderNode object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -11081,7 +11073,7 @@ dxf_mleader_leader_node_set_z0
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -11121,7 +11113,7 @@ dxf_mleader_leader_node_get_p1
                  * DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -11162,7 +11154,7 @@ dxf_mleader_leader_node_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -11201,7 +11193,7 @@ dxf_mleader_leader_node_get_x1
                 /*!< a pointer to a \c DxfMLeaderLeaderNode object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -11245,7 +11237,7 @@ dxf_mleader_leader_node_set_x1
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -11284,7 +11276,7 @@ dxf_mleader_leader_node_get_y1
                 /*!< a pointer to a \c DxfMLeaderLeaderNode object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -11328,7 +11320,7 @@ dxf_mleader_leader_node_set_y1
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -11367,7 +11359,7 @@ dxf_mleader_leader_node_get_z1
                 /*!< a pointer to a \c DxfMLeaderLeaderNode object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -11411,7 +11403,7 @@ dxf_mleader_leader_node_set_z1
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -11451,7 +11443,7 @@ dxf_mleader_leader_node_get_p2
                  * DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -11492,7 +11484,7 @@ dxf_mleader_leader_node_set_p2
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -11531,7 +11523,7 @@ dxf_mleader_leader_node_get_x2
                 /*!< a pointer to a \c DxfMLeaderLeaderNode object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -11575,7 +11567,7 @@ dxf_mleader_leader_node_set_x2
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -11614,7 +11606,7 @@ dxf_mleader_leader_node_get_y2
                 /*!< a pointer to a \c DxfMLeaderLeaderNode object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -11658,7 +11650,7 @@ dxf_mleader_leader_node_set_y2
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -11697,7 +11689,7 @@ dxf_mleader_leader_node_get_z2
                 /*!< a pointer to a \c DxfMLeaderLeaderNode object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -11741,7 +11733,7 @@ dxf_mleader_leader_node_set_z2
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -11781,7 +11773,7 @@ dxf_mleader_leader_node_get_p3
                  * DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -11822,7 +11814,7 @@ dxf_mleader_leader_node_set_p3
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -11861,7 +11853,7 @@ dxf_mleader_leader_node_get_x3
                 /*!< a pointer to a \c DxfMLeaderLeaderNode object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -11905,7 +11897,7 @@ dxf_mleader_leader_node_set_x3
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -11944,7 +11936,7 @@ dxf_mleader_leader_node_get_y3
                 /*!< a pointer to a \c DxfMLeaderLeaderNode object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -11988,7 +11980,7 @@ dxf_mleader_leader_node_set_y3
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -12027,7 +12019,7 @@ dxf_mleader_leader_node_get_z3
                 /*!< a pointer to a \c DxfMLeaderLeaderNode object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -12071,7 +12063,7 @@ dxf_mleader_leader_node_set_z3
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -12110,7 +12102,7 @@ dxf_mleader_leader_node_get_dogleg_length
                 /*!< a pointer to a \c DxfMLeaderLeaderNode object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -12146,7 +12138,7 @@ dxf_mleader_leader_node_set_dogleg_length
                  * object of a DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -12514,7 +12506,7 @@ dxf_mleader_leader_line_new ()
         size = sizeof (DxfMLeaderLeaderLine);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((line = malloc (size)) == NULL)
+        if ((line = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -12553,14 +12545,14 @@ dxf_mleader_leader_line_init
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 line = dxf_mleader_leader_line_new ();
         }
         if (line == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -12603,14 +12595,14 @@ dxf_mleader_leader_line_free
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -12618,7 +12610,7 @@ dxf_mleader_leader_line_free
         dxf_point_free_list (line->p0);
         dxf_point_free_list (line->p1);
         dxf_point_free_list (line->p2);
-        free (line);
+        dxf_free (line);
         line = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -12640,18 +12632,19 @@ dxf_mleader_leader_line_free_list
                  * \c DxfMLeaderLeaderLine objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (lines == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (lines != NULL)
         {
                 DxfMLeaderLeaderLine *iter = (DxfMLeaderLeaderLine *) lines->next;
+                lines->next = NULL;
                 dxf_mleader_leader_line_free (lines);
                 lines = (DxfMLeaderLeaderLine *) iter;
         }
@@ -12675,7 +12668,7 @@ dxf_mleader_leader_line_get_p0
                  * DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -12716,7 +12709,7 @@ dxf_mleader_leader_line_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -12755,7 +12748,7 @@ dxf_mleader_leader_line_get_x0
                 /*!< a pointer to a \c DxfMLeaderLeaderLine object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -12799,7 +12792,7 @@ dxf_mleader_leader_line_set_x0
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -12838,7 +12831,7 @@ dxf_mleader_leader_line_get_y0
                 /*!< a pointer to a \c DxfMLeaderLeaderLine object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -12882,7 +12875,7 @@ dxf_mleader_leader_line_set_y0
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -12921,7 +12914,7 @@ dxf_mleader_leader_line_get_z0
                 /*!< a pointer to a \c DxfMLeaderLeaderLine object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -12965,7 +12958,7 @@ dxf_mleader_leader_line_set_z0
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -13005,7 +12998,7 @@ dxf_mleader_leader_line_get_p1
                  * DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -13046,7 +13039,7 @@ dxf_mleader_leader_line_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -13085,7 +13078,7 @@ dxf_mleader_leader_line_get_x1
                 /*!< a pointer to a \c DxfMLeaderLeaderLine object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -13129,7 +13122,7 @@ dxf_mleader_leader_line_set_x1
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -13168,7 +13161,7 @@ dxf_mleader_leader_line_get_y1
                 /*!< a pointer to a \c DxfMLeaderLeaderLine object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -13212,7 +13205,7 @@ dxf_mleader_leader_line_set_y1
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -13251,7 +13244,7 @@ dxf_mleader_leader_line_get_z1
                 /*!< a pointer to a \c DxfMLeaderLeaderLine object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -13295,7 +13288,7 @@ dxf_mleader_leader_line_set_z1
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -13335,7 +13328,7 @@ dxf_mleader_leader_line_get_p2
                  * DXF \c MLEADER entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -13376,7 +13369,7 @@ dxf_mleader_leader_line_set_p2
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -13415,7 +13408,7 @@ dxf_mleader_leader_line_get_x2
                 /*!< a pointer to a \c DxfMLeaderLeaderLine object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -13459,7 +13452,7 @@ dxf_mleader_leader_line_set_x2
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -13498,7 +13491,7 @@ dxf_mleader_leader_line_get_y2
                 /*!< a pointer to a \c DxfMLeaderLeaderLine object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -13542,7 +13535,7 @@ dxf_mleader_leader_line_set_y2
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -13581,7 +13574,7 @@ dxf_mleader_leader_line_get_z2
                 /*!< a pointer to a \c DxfMLeaderLeaderLine object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -13625,7 +13618,7 @@ dxf_mleader_leader_line_set_z2
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -57,7 +57,7 @@ dxf_mleaderstyle_new ()
         size = sizeof (DxfMLeaderstyle);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((mleaderstyle = malloc (size)) == NULL)
+        if ((mleaderstyle = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -95,21 +95,21 @@ dxf_mleaderstyle_init
         /* Do some basic checks. */
         if (mleaderstyle == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 mleaderstyle = dxf_mleaderstyle_new ();
         }
         if (mleaderstyle == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         mleaderstyle->id_code = 0;
-        mleaderstyle->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        mleaderstyle->layer = strdup (DXF_DEFAULT_LAYER);
+        mleaderstyle->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        mleaderstyle->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         mleaderstyle->elevation = 0.0;
         mleaderstyle->thickness = 0.0;
         mleaderstyle->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -120,16 +120,16 @@ dxf_mleaderstyle_init
         mleaderstyle->shadow_mode = 0;
         mleaderstyle->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
         mleaderstyle->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init (mleaderstyle->binary_graphics_data);
-        mleaderstyle->dictionary_owner_soft = strdup ("");
-        mleaderstyle->object_owner_soft = strdup ("");
-        mleaderstyle->material = strdup ("");
-        mleaderstyle->dictionary_owner_hard = strdup ("");
+        mleaderstyle->dictionary_owner_soft = dxf_strdup ("");
+        mleaderstyle->object_owner_soft = dxf_strdup ("");
+        mleaderstyle->material = dxf_strdup ("");
+        mleaderstyle->dictionary_owner_hard = dxf_strdup ("");
         mleaderstyle->lineweight = 0;
-        mleaderstyle->plot_style_name = strdup ("");
+        mleaderstyle->plot_style_name = dxf_strdup ("");
         mleaderstyle->color_value = 0;
-        mleaderstyle->color_name = strdup ("");
+        mleaderstyle->color_name = dxf_strdup ("");
         mleaderstyle->transparency = 0;
-        mleaderstyle->mleaderstyle_description = strdup ("");
+        mleaderstyle->mleaderstyle_description = dxf_strdup ("");
         mleaderstyle->first_segment_angle_constraint = 0.0;
         mleaderstyle->second_segment_angle_constraint = 0.0;
         mleaderstyle->landing_gap = 0.0;
@@ -166,11 +166,11 @@ dxf_mleaderstyle_init
         mleaderstyle->overwrite_property_value = 1;
         mleaderstyle->is_annotative = 1;
         mleaderstyle->text_align_always_left = 1;
-        mleaderstyle->default_mtext_contents = strdup ("");
-        mleaderstyle->leader_linetype_id = strdup ("");
-        mleaderstyle->arrow_head_id = strdup ("");
-        mleaderstyle->mtext_style_id = strdup ("");
-        mleaderstyle->block_content_id = strdup ("");
+        mleaderstyle->default_mtext_contents = dxf_strdup ("");
+        mleaderstyle->leader_linetype_id = dxf_strdup ("");
+        mleaderstyle->arrow_head_id = dxf_strdup ("");
+        mleaderstyle->mtext_style_id = dxf_strdup ("");
+        mleaderstyle->block_content_id = dxf_strdup ("");
         mleaderstyle->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -203,28 +203,26 @@ dxf_mleaderstyle_read
         DXF_DEBUG_BEGIN
 #endif
         char *temp_string = NULL;
-        DxfBinaryGraphicsData *iter310 = NULL;
         int iter92;
         int iter330;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (mleaderstyle == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 mleaderstyle = dxf_mleaderstyle_init (mleaderstyle);
         }
-        iter310 = (DxfBinaryGraphicsData *) mleaderstyle->binary_graphics_data;
         iter92 = 0;
         iter330 = 0;
         (fp->line_number)++;
@@ -233,12 +231,12 @@ dxf_mleaderstyle_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -337,9 +335,8 @@ dxf_mleaderstyle_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) iter310->next);
-                        iter310 = (DxfBinaryGraphicsData *) iter310->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_graphics_data_append_hex ((DxfBinaryGraphicsData *) mleaderstyle->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -416,22 +413,23 @@ dxf_mleaderstyle_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (mleaderstyle->linetype, "") == 0)
         {
-                mleaderstyle->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                mleaderstyle->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (mleaderstyle->layer, "") == 0)
         {
-                mleaderstyle->layer = strdup (DXF_DEFAULT_LAYER);
+                mleaderstyle->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -454,16 +452,16 @@ dxf_mleaderstyle_write
                 /*!< a pointer to a DXF \c MLEADERSTYLE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("MLEADERSTYLE");
+        char *dxf_entity_name = dxf_strdup ("MLEADERSTYLE");
 
 /*! \todo Add code here. */
 
         /* Clean up. */
-        free (dxf_entity_name);
-#ifdef DEBUG
+        dxf_free (dxf_entity_name);
+#if DEBUG
         DXF_DEBUG_END
 #endif
         return (EXIT_SUCCESS);
@@ -491,34 +489,34 @@ dxf_mleaderstyle_free
         /* Do some basic checks. */
         if (mleaderstyle == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (mleaderstyle->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (mleaderstyle->linetype);
-        free (mleaderstyle->layer);
+        dxf_free (mleaderstyle->linetype);
+        dxf_free (mleaderstyle->layer);
         dxf_binary_graphics_data_free_list (mleaderstyle->binary_graphics_data);
-        free (mleaderstyle->dictionary_owner_soft);
-        free (mleaderstyle->object_owner_soft);
-        free (mleaderstyle->material);
-        free (mleaderstyle->dictionary_owner_hard);
-        free (mleaderstyle->plot_style_name);
-        free (mleaderstyle->color_name);
-        free (mleaderstyle->mleaderstyle_description);
-        free (mleaderstyle->default_mtext_contents);
-        free (mleaderstyle->leader_linetype_id);
-        free (mleaderstyle->arrow_head_id);
-        free (mleaderstyle->mtext_style_id);
-        free (mleaderstyle->block_content_id);
-        free (mleaderstyle);
+        dxf_free (mleaderstyle->dictionary_owner_soft);
+        dxf_free (mleaderstyle->object_owner_soft);
+        dxf_free (mleaderstyle->material);
+        dxf_free (mleaderstyle->dictionary_owner_hard);
+        dxf_free (mleaderstyle->plot_style_name);
+        dxf_free (mleaderstyle->color_name);
+        dxf_free (mleaderstyle->mleaderstyle_description);
+        dxf_free (mleaderstyle->default_mtext_contents);
+        dxf_free (mleaderstyle->leader_linetype_id);
+        dxf_free (mleaderstyle->arrow_head_id);
+        dxf_free (mleaderstyle->mtext_style_id);
+        dxf_free (mleaderstyle->block_content_id);
+        dxf_free (mleaderstyle);
         mleaderstyle = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -539,18 +537,19 @@ dxf_mleaderstyle_free_list
                  * \c MLEADERSTYLE entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (mleaderstyles == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (mleaderstyles != NULL)
         {
                 DxfMLeaderstyle *iter = (DxfMLeaderstyle *) mleaderstyles->next;
+                mleaderstyles->next = NULL;
                 dxf_mleaderstyle_free (mleaderstyles);
                 mleaderstyles = (DxfMLeaderstyle *) iter;
         }
@@ -671,7 +670,7 @@ dxf_mleaderstyle_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->linetype));
+        return (dxf_strdup (mleaderstyle->linetype));
 }
 
 
@@ -709,7 +708,7 @@ dxf_mleaderstyle_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->linetype = strdup (linetype);
+        mleaderstyle->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -750,7 +749,7 @@ dxf_mleaderstyle_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->layer));
+        return (dxf_strdup (mleaderstyle->layer));
 }
 
 
@@ -788,7 +787,7 @@ dxf_mleaderstyle_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->layer = strdup (layer);
+        mleaderstyle->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1567,7 +1566,7 @@ dxf_mleaderstyle_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->dictionary_owner_soft));
+        return (dxf_strdup (mleaderstyle->dictionary_owner_soft));
 }
 
 
@@ -1606,7 +1605,7 @@ dxf_mleaderstyle_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        mleaderstyle->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1650,7 +1649,7 @@ dxf_mleaderstyle_get_object_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->object_owner_soft));
+        return (dxf_strdup (mleaderstyle->object_owner_soft));
 }
 
 
@@ -1689,7 +1688,7 @@ dxf_mleaderstyle_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->object_owner_soft = strdup (object_owner_soft);
+        mleaderstyle->object_owner_soft = dxf_strdup (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1734,7 +1733,7 @@ dxf_mleaderstyle_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->material));
+        return (dxf_strdup (mleaderstyle->material));
 }
 
 
@@ -1773,7 +1772,7 @@ dxf_mleaderstyle_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->material = strdup (material);
+        mleaderstyle->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1817,7 +1816,7 @@ dxf_mleaderstyle_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->dictionary_owner_hard));
+        return (dxf_strdup (mleaderstyle->dictionary_owner_hard));
 }
 
 
@@ -1856,7 +1855,7 @@ dxf_mleaderstyle_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        mleaderstyle->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1963,7 +1962,7 @@ dxf_mleaderstyle_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->plot_style_name));
+        return (dxf_strdup (mleaderstyle->plot_style_name));
 }
 
 
@@ -2001,7 +2000,7 @@ dxf_mleaderstyle_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->plot_style_name = strdup (plot_style_name);
+        mleaderstyle->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2108,7 +2107,7 @@ dxf_mleaderstyle_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->color_name));
+        return (dxf_strdup (mleaderstyle->color_name));
 }
 
 
@@ -2146,7 +2145,7 @@ dxf_mleaderstyle_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->color_name = strdup (color_name);
+        mleaderstyle->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2254,7 +2253,7 @@ dxf_mleaderstyle_get_mleaderstyle_description
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->mleaderstyle_description));
+        return (dxf_strdup (mleaderstyle->mleaderstyle_description));
 }
 
 
@@ -2293,7 +2292,7 @@ dxf_mleaderstyle_set_mleaderstyle_description
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->mleaderstyle_description = strdup (mleaderstyle_description);
+        mleaderstyle->mleaderstyle_description = dxf_strdup (mleaderstyle_description);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4766,7 +4765,7 @@ dxf_mleaderstyle_get_default_mtext_contents
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->default_mtext_contents));
+        return (dxf_strdup (mleaderstyle->default_mtext_contents));
 }
 
 
@@ -4805,7 +4804,7 @@ dxf_mleaderstyle_set_default_mtext_contents
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->default_mtext_contents = strdup (default_mtext_contents);
+        mleaderstyle->default_mtext_contents = dxf_strdup (default_mtext_contents);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4848,7 +4847,7 @@ dxf_mleaderstyle_get_leader_linetype_id
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->leader_linetype_id));
+        return (dxf_strdup (mleaderstyle->leader_linetype_id));
 }
 
 
@@ -4887,7 +4886,7 @@ dxf_mleaderstyle_set_leader_linetype_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->leader_linetype_id = strdup (leader_linetype_id);
+        mleaderstyle->leader_linetype_id = dxf_strdup (leader_linetype_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4930,7 +4929,7 @@ dxf_mleaderstyle_get_arrow_head_id
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->arrow_head_id));
+        return (dxf_strdup (mleaderstyle->arrow_head_id));
 }
 
 
@@ -4969,7 +4968,7 @@ dxf_mleaderstyle_set_arrow_head_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->arrow_head_id = strdup (arrow_head_id);
+        mleaderstyle->arrow_head_id = dxf_strdup (arrow_head_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5012,7 +5011,7 @@ dxf_mleaderstyle_get_mtext_style_id
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->mtext_style_id));
+        return (dxf_strdup (mleaderstyle->mtext_style_id));
 }
 
 
@@ -5051,7 +5050,7 @@ dxf_mleaderstyle_set_mtext_style_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->mtext_style_id = strdup (mtext_style_id);
+        mleaderstyle->mtext_style_id = dxf_strdup (mtext_style_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5094,7 +5093,7 @@ dxf_mleaderstyle_get_block_content_id
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->block_content_id));
+        return (dxf_strdup (mleaderstyle->block_content_id));
 }
 
 
@@ -5133,7 +5132,7 @@ dxf_mleaderstyle_set_block_content_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->block_content_id = strdup (block_content_id);
+        mleaderstyle->block_content_id = dxf_strdup (block_content_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -64,7 +64,7 @@ dxf_mline_new ()
         size = sizeof (DxfMline);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((mline = malloc (size)) == NULL)
+        if ((mline = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfMline struct.\n")),
@@ -103,21 +103,21 @@ dxf_mline_init
         /* Do some basic checks. */
         if (mline == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 mline = dxf_mline_new ();
         }
         if (mline == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfMline struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         dxf_mline_set_id_code (mline, 0);
-        dxf_mline_set_linetype (mline, strdup (DXF_DEFAULT_LINETYPE));
-        dxf_mline_set_layer (mline, strdup (DXF_DEFAULT_LAYER));
+        dxf_mline_set_linetype (mline, dxf_strdup (DXF_DEFAULT_LINETYPE));
+        dxf_mline_set_layer (mline, dxf_strdup (DXF_DEFAULT_LAYER));
         dxf_mline_set_elevation (mline, 0.0);
         dxf_mline_set_thickness (mline, 0.0);
         dxf_mline_set_linetype_scale (mline, DXF_DEFAULT_LINETYPE_SCALE);
@@ -128,15 +128,15 @@ dxf_mline_init
         dxf_mline_set_shadow_mode (mline, 0);
         dxf_mline_set_binary_graphics_data (mline, dxf_binary_graphics_data_new ());
         dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) dxf_mline_get_binary_graphics_data (mline));
-        dxf_mline_set_dictionary_owner_soft (mline, strdup (""));
-        dxf_mline_set_material (mline, strdup (""));
-        dxf_mline_set_dictionary_owner_hard (mline, strdup (""));
+        dxf_mline_set_dictionary_owner_soft (mline, dxf_strdup (""));
+        dxf_mline_set_material (mline, dxf_strdup (""));
+        dxf_mline_set_dictionary_owner_hard (mline, dxf_strdup (""));
         dxf_mline_set_lineweight (mline, 0);
-        dxf_mline_set_plot_style_name (mline, strdup (""));
+        dxf_mline_set_plot_style_name (mline, dxf_strdup (""));
         dxf_mline_set_color_value (mline, 0);
-        dxf_mline_set_color_name (mline, strdup (""));
+        dxf_mline_set_color_name (mline, dxf_strdup (""));
         dxf_mline_set_transparency (mline, 0);
-        dxf_mline_set_style_name (mline, strdup (""));
+        dxf_mline_set_style_name (mline, dxf_strdup (""));
         dxf_mline_set_p0 (mline, dxf_point_new ());
         dxf_point_init ((DxfPoint *) dxf_mline_get_p0 (mline));
         dxf_mline_set_p1 (mline, dxf_point_new ());
@@ -159,7 +159,7 @@ dxf_mline_init
         dxf_mline_set_extr_x0 (mline, 0.0);
         dxf_mline_set_extr_y0 (mline, 0.0);
         dxf_mline_set_extr_z0 (mline, 1.0);
-        dxf_mline_set_mlinestyle_dictionary (mline, strdup (""));
+        dxf_mline_set_mlinestyle_dictionary (mline, dxf_strdup (""));
         dxf_mline_set_next (mline, NULL);
 #if DEBUG
         DXF_DEBUG_END
@@ -204,16 +204,16 @@ dxf_mline_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (mline == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 mline = dxf_mline_init (mline);
@@ -232,12 +232,12 @@ dxf_mline_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "2") == 0)
@@ -514,7 +514,7 @@ dxf_mline_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbMline") != 0)))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -570,22 +570,23 @@ dxf_mline_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (dxf_mline_get_linetype (mline), "") == 0)
         {
-                dxf_mline_set_linetype (mline, strdup (DXF_DEFAULT_LINETYPE));
+                dxf_mline_set_linetype (mline, dxf_strdup (DXF_DEFAULT_LINETYPE));
         }
         if (strcmp (dxf_mline_get_layer (mline), "") == 0)
         {
-                dxf_mline_set_layer (mline, strdup (DXF_DEFAULT_LAYER));
+                dxf_mline_set_layer (mline, dxf_strdup (DXF_DEFAULT_LAYER));
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -618,79 +619,79 @@ dxf_mline_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("MLINE");
+        char *dxf_entity_name = dxf_strdup ("MLINE");
         int i;
         DxfPoint *iter;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (mline == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((fp->acad_version_number < AutoCAD_13)
           && (fp->follow_strict_version_rules))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, mline->id_code);
                 return (EXIT_FAILURE);
         }
         else
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, dxf_mline_get_id_code (mline));
         }
         if (strcmp (dxf_mline_get_linetype (mline), "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_mline_get_id_code (mline));
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                dxf_mline_set_linetype (mline, strdup (DXF_DEFAULT_LINETYPE));
+                dxf_mline_set_linetype (mline, dxf_strdup (DXF_DEFAULT_LINETYPE));
         }
         if (strcmp (dxf_mline_get_layer (mline), "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_mline_get_id_code (mline));
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                dxf_mline_set_layer (mline, strdup (DXF_DEFAULT_LAYER));
+                dxf_mline_set_layer (mline, dxf_strdup (DXF_DEFAULT_LAYER));
         }
         if (dxf_mline_get_number_of_parameters (mline) >= (DXF_MAX_PARAM - 1))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () too many parameters.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dxf_mline_get_number_of_area_fill_parameters (mline) >= (DXF_MAX_PARAM - 1))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () too many area fill parameters.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
@@ -770,12 +771,7 @@ dxf_mline_write
 #else
                 fprintf (fp->fp, " 92\n%d\n", dxf_mline_get_graphics_data_size (mline));
 #endif
-                DxfBinaryGraphicsData *bgd_iter = (DxfBinaryGraphicsData *) dxf_mline_get_binary_graphics_data (mline);
-                while (dxf_binary_graphics_data_get_data_line (bgd_iter) != NULL)
-                {
-                        fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (bgd_iter));
-                        bgd_iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (bgd_iter);
-                }
+                dxf_binary_graphics_data_write (fp, (DxfBinaryGraphicsData *) dxf_mline_get_binary_graphics_data (mline));
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
@@ -827,7 +823,7 @@ dxf_mline_write
         }
         if (i != mline->number_of_vertices)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () actual number of vertices differs from number_of_vertices value in struct.\n")),
                   __FUNCTION__);
         }
@@ -843,7 +839,7 @@ dxf_mline_write
         }
         if (i != mline->number_of_vertices)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () actual number of vertices differs from number_of_vertices value in struct.\n")),
                   __FUNCTION__);
         }
@@ -859,7 +855,7 @@ dxf_mline_write
         }
         if (i != mline->number_of_vertices)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () actual number of vertices differs from number_of_vertices value in struct.\n")),
                   __FUNCTION__);
         }
@@ -874,7 +870,7 @@ dxf_mline_write
                 fprintf (fp->fp, " 42\n%f\n", mline->area_fill_parameters[i]);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -903,33 +899,33 @@ dxf_mline_free
         /* Do some basic checks. */
         if (mline == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (mline->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (mline->linetype);
-        free (mline->layer);
+        dxf_free (mline->linetype);
+        dxf_free (mline->layer);
         dxf_binary_graphics_data_free_list (mline->binary_graphics_data);
-        free (mline->dictionary_owner_soft);
-        free (mline->material);
-        free (mline->dictionary_owner_hard);
-        free (mline->plot_style_name);
-        free (mline->color_name);
-        free (mline->style_name);
+        dxf_free (mline->dictionary_owner_soft);
+        dxf_free (mline->material);
+        dxf_free (mline->dictionary_owner_hard);
+        dxf_free (mline->plot_style_name);
+        dxf_free (mline->color_name);
+        dxf_free (mline->style_name);
         dxf_point_free (mline->p0);
         dxf_point_free_list (mline->p1);
         dxf_point_free_list (mline->p2);
         dxf_point_free_list (mline->p3);
-        free (mline->mlinestyle_dictionary);
-        free (mline);
+        dxf_free (mline->mlinestyle_dictionary);
+        dxf_free (mline);
         mline = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -950,18 +946,19 @@ dxf_mline_free_list
                  * entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (mlines == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (mlines != NULL)
         {
                 DxfMline *iter = (DxfMline *) mlines->next;
+                mlines->next = NULL;
                 dxf_mline_free (mlines);
                 mlines = (DxfMline *) iter;
         }
@@ -1081,7 +1078,7 @@ dxf_mline_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mline->linetype));
+        return (dxf_strdup (mline->linetype));
 }
 
 
@@ -1115,7 +1112,7 @@ dxf_mline_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->linetype = strdup (linetype);
+        mline->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1156,7 +1153,7 @@ dxf_mline_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mline->layer));
+        return (dxf_strdup (mline->layer));
 }
 
 
@@ -1190,7 +1187,7 @@ dxf_mline_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->layer = strdup (layer);
+        mline->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1958,7 +1955,7 @@ dxf_mline_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mline->dictionary_owner_soft));
+        return (dxf_strdup (mline->dictionary_owner_soft));
 }
 
 
@@ -1994,7 +1991,7 @@ dxf_mline_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        mline->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2038,7 +2035,7 @@ dxf_mline_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mline->material));
+        return (dxf_strdup (mline->material));
 }
 
 
@@ -2076,7 +2073,7 @@ dxf_mline_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->material = strdup (material);
+        mline->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2120,7 +2117,7 @@ dxf_mline_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mline->dictionary_owner_hard));
+        return (dxf_strdup (mline->dictionary_owner_hard));
 }
 
 
@@ -2156,7 +2153,7 @@ dxf_mline_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        mline->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2263,7 +2260,7 @@ dxf_mline_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mline->plot_style_name));
+        return (dxf_strdup (mline->plot_style_name));
 }
 
 
@@ -2301,7 +2298,7 @@ dxf_mline_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->plot_style_name = strdup (plot_style_name);
+        mline->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2408,7 +2405,7 @@ dxf_mline_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mline->color_name));
+        return (dxf_strdup (mline->color_name));
 }
 
 
@@ -2446,7 +2443,7 @@ dxf_mline_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->color_name = strdup (color_name);
+        mline->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2553,7 +2550,7 @@ dxf_mline_get_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mline->style_name));
+        return (dxf_strdup (mline->style_name));
 }
 
 
@@ -2591,7 +2588,7 @@ dxf_mline_set_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->style_name = strdup (style_name);
+        mline->style_name = dxf_strdup (style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2611,7 +2608,7 @@ dxf_mline_get_p0
                 /*!< a pointer to a DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2650,7 +2647,7 @@ dxf_mline_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2689,7 +2686,7 @@ dxf_mline_get_x0
                 /*!< a pointer to a DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2732,7 +2729,7 @@ dxf_mline_set_x0
                  * \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2771,7 +2768,7 @@ dxf_mline_get_y0
                 /*!< a pointer to a DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2814,7 +2811,7 @@ dxf_mline_set_y0
                  * \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2853,7 +2850,7 @@ dxf_mline_get_z0
                 /*!< a pointer to a DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2896,7 +2893,7 @@ dxf_mline_set_z0
                  * \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2935,7 +2932,7 @@ dxf_mline_get_p1
                 /*!< a pointer to a DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2975,7 +2972,7 @@ dxf_mline_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3015,7 +3012,7 @@ dxf_mline_get_x1
                 /*!< a pointer to a DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3058,7 +3055,7 @@ dxf_mline_set_x1
                  * vertices \c x1 of a DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3098,7 +3095,7 @@ dxf_mline_get_y1
                 /*!< a pointer to a DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3141,7 +3138,7 @@ dxf_mline_set_y1
                  * vertices \c y1 of a DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3181,7 +3178,7 @@ dxf_mline_get_z1
                 /*!< a pointer to a DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3224,7 +3221,7 @@ dxf_mline_set_z1
                  * vertices \c z1 of a DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3263,7 +3260,7 @@ dxf_mline_get_p2
                 /*!< a pointer to a DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3303,7 +3300,7 @@ dxf_mline_set_p2
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3343,7 +3340,7 @@ dxf_mline_get_x2
                 /*!< a pointer to a DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3387,7 +3384,7 @@ dxf_mline_set_x2
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3427,7 +3424,7 @@ dxf_mline_get_y2
                 /*!< a pointer to a DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3471,7 +3468,7 @@ dxf_mline_set_y2
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3511,7 +3508,7 @@ dxf_mline_get_z2
                 /*!< a pointer to a DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3555,7 +3552,7 @@ dxf_mline_set_z2
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3594,7 +3591,7 @@ dxf_mline_get_p3
                 /*!< a pointer to a DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3634,7 +3631,7 @@ dxf_mline_set_p3
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3675,7 +3672,7 @@ dxf_mline_get_x3
                 /*!< a pointer to a DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3720,7 +3717,7 @@ dxf_mline_set_x3
                  * vertex \c x3 of a DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3761,7 +3758,7 @@ dxf_mline_get_y3
                 /*!< a pointer to a DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3806,7 +3803,7 @@ dxf_mline_set_y3
                  * vertex \c y3 of a DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3847,7 +3844,7 @@ dxf_mline_get_z3
                 /*!< a pointer to a DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3892,7 +3889,7 @@ dxf_mline_set_z3
                  * vertex \c z3 of a DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3930,7 +3927,7 @@ dxf_mline_get_scale_factor
                 /*!< a pointer to a DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3971,7 +3968,7 @@ dxf_mline_set_scale_factor
                 /*!< the \c scale_factor to be set for the entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4002,7 +3999,7 @@ dxf_mline_get_element_parameters
                 /*!< a pointer to a DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4045,7 +4042,7 @@ dxf_mline_set_element_parameters
                  * be set for the entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4083,7 +4080,7 @@ dxf_mline_get_area_fill_parameters
                 /*!< a pointer to a DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4119,7 +4116,7 @@ dxf_mline_set_area_fill_parameters
                  * be set for the entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4641,7 +4638,7 @@ dxf_mline_get_extrusion_vector_as_point
                 /*!< a pointer to a DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *point = NULL;
@@ -4685,7 +4682,7 @@ dxf_mline_get_extr_x0
                 /*!< a pointer to a DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4721,7 +4718,7 @@ dxf_mline_set_extr_x0
                  * DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4753,7 +4750,7 @@ dxf_mline_get_extr_y0
                 /*!< a pointer to a DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4789,7 +4786,7 @@ dxf_mline_set_extr_y0
                  * DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4821,7 +4818,7 @@ dxf_mline_get_extr_z0
                 /*!< a pointer to a DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4857,7 +4854,7 @@ dxf_mline_set_extr_z0
                  * DXF \c MLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4988,7 +4985,7 @@ dxf_mline_get_mlinestyle_dictionary
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mline->mlinestyle_dictionary));
+        return (dxf_strdup (mline->mlinestyle_dictionary));
 }
 
 
@@ -5026,7 +5023,7 @@ dxf_mline_set_mlinestyle_dictionary
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->mlinestyle_dictionary = strdup (mlinestyle_dictionary);
+        mline->mlinestyle_dictionary = dxf_strdup (mlinestyle_dictionary);
 #if DEBUG
         DXF_DEBUG_END
 #endif
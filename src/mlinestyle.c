@@ -64,7 +64,7 @@ dxf_mlinestyle_new ()
         size = sizeof (DxfMlinestyle);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((mlinestyle = malloc (size)) == NULL)
+        if ((mlinestyle = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfMlinestyle struct.\n")),
@@ -104,23 +104,23 @@ dxf_mlinestyle_init
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 mlinestyle = dxf_mlinestyle_new ();
         }
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfMlinestyle struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dxf_mlinestyle_set_name (mlinestyle, strdup (""));
-        dxf_mlinestyle_set_description (mlinestyle, strdup (""));
+        dxf_mlinestyle_set_name (mlinestyle, dxf_strdup (""));
+        dxf_mlinestyle_set_description (mlinestyle, dxf_strdup (""));
         dxf_mlinestyle_set_id_code (mlinestyle, 0);
-        dxf_mlinestyle_set_dictionary_owner_soft (mlinestyle, strdup (""));
-        dxf_mlinestyle_set_dictionary_owner_hard (mlinestyle, strdup (""));
+        dxf_mlinestyle_set_dictionary_owner_soft (mlinestyle, dxf_strdup (""));
+        dxf_mlinestyle_set_dictionary_owner_hard (mlinestyle, dxf_strdup (""));
         dxf_mlinestyle_set_start_angle (mlinestyle, 0.0);
         dxf_mlinestyle_set_end_angle (mlinestyle, 0.0);
         dxf_mlinestyle_set_color (mlinestyle, DXF_COLOR_BYLAYER);
@@ -128,7 +128,7 @@ dxf_mlinestyle_init
         dxf_mlinestyle_set_number_of_elements (mlinestyle, 0);
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
-                dxf_mlinestyle_set_ith_element_linetype (mlinestyle, strdup (""), i);
+                dxf_mlinestyle_set_ith_element_linetype (mlinestyle, dxf_strdup (""), i);
                 dxf_mlinestyle_set_ith_element_offset (mlinestyle, 0.0, i);
                 dxf_mlinestyle_set_ith_element_color (mlinestyle, 0, i);
         }
@@ -169,22 +169,22 @@ dxf_mlinestyle_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 mlinestyle = dxf_mlinestyle_init (mlinestyle);
@@ -196,11 +196,11 @@ dxf_mlinestyle_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -294,7 +294,7 @@ dxf_mlinestyle_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "AcDbMlineStyle") != 0)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -322,13 +322,14 @@ dxf_mlinestyle_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -361,39 +362,39 @@ dxf_mlinestyle_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("MLINESTYLE");
+        char *dxf_entity_name = dxf_strdup ("MLINESTYLE");
         int i;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((fp->acad_version_number < AutoCAD_13)
           && (fp->follow_strict_version_rules))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, dxf_mlinestyle_get_id_code (mlinestyle));
                 return (EXIT_FAILURE);
         }
         else
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, dxf_mlinestyle_get_id_code (mlinestyle));
         }
@@ -445,7 +446,7 @@ dxf_mlinestyle_write
                 fprintf (fp->fp, "  6\n%s\n", dxf_mlinestyle_get_ith_element_linetype (mlinestyle, i));
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -476,27 +477,27 @@ dxf_mlinestyle_free
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (mlinestyle->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (dxf_mlinestyle_get_dictionary_owner_soft (mlinestyle));
-        free (dxf_mlinestyle_get_dictionary_owner_hard (mlinestyle));
-        free (dxf_mlinestyle_get_name (mlinestyle));
-        free (dxf_mlinestyle_get_description (mlinestyle));
+        dxf_free (dxf_mlinestyle_get_dictionary_owner_soft (mlinestyle));
+        dxf_free (dxf_mlinestyle_get_dictionary_owner_hard (mlinestyle));
+        dxf_free (dxf_mlinestyle_get_name (mlinestyle));
+        dxf_free (dxf_mlinestyle_get_description (mlinestyle));
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
-                free (dxf_mlinestyle_get_ith_element_linetype (mlinestyle, 1));
+                dxf_free (dxf_mlinestyle_get_ith_element_linetype (mlinestyle, 1));
         }
-        free (mlinestyle);
+        dxf_free (mlinestyle);
         mlinestyle = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -517,18 +518,19 @@ dxf_mlinestyle_free_list
                  * \c MLINESTYLE objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (mlinestyles == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (mlinestyles != NULL)
         {
                 DxfMlinestyle *iter = (DxfMlinestyle *) mlinestyles->next;
+                mlinestyles->next = NULL;
                 dxf_mlinestyle_free (mlinestyles);
                 mlinestyles = (DxfMlinestyle *) iter;
         }
@@ -651,7 +653,7 @@ dxf_mlinestyle_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mlinestyle->dictionary_owner_soft));
+        return (dxf_strdup (mlinestyle->dictionary_owner_soft));
 }
 
 
@@ -687,7 +689,7 @@ dxf_mlinestyle_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        mlinestyle->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        mlinestyle->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -731,7 +733,7 @@ dxf_mlinestyle_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mlinestyle->dictionary_owner_hard));
+        return (dxf_strdup (mlinestyle->dictionary_owner_hard));
 }
 
 
@@ -767,7 +769,7 @@ dxf_mlinestyle_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        mlinestyle->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        mlinestyle->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -810,7 +812,7 @@ dxf_mlinestyle_get_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mlinestyle->name));
+        return (dxf_strdup (mlinestyle->name));
 }
 
 
@@ -844,7 +846,7 @@ dxf_mlinestyle_set_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mlinestyle->name = strdup (name);
+        mlinestyle->name = dxf_strdup (name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -887,7 +889,7 @@ dxf_mlinestyle_get_description
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mlinestyle->description));
+        return (dxf_strdup (mlinestyle->description));
 }
 
 
@@ -922,7 +924,7 @@ dxf_mlinestyle_set_description
                   __FUNCTION__);
                 return (NULL);
         }
-        mlinestyle->description = strdup (description);
+        mlinestyle->description = dxf_strdup (description);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -981,7 +983,7 @@ dxf_mlinestyle_get_ith_element_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mlinestyle->element_linetype[i]));
+        return (dxf_strdup (mlinestyle->element_linetype[i]));
 }
 
 
@@ -1032,7 +1034,7 @@ dxf_mlinestyle_set_ith_element_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        mlinestyle->element_linetype[i] = strdup (element_linetype);
+        mlinestyle->element_linetype[i] = dxf_strdup (element_linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1052,7 +1054,7 @@ dxf_mlinestyle_get_element_offset
                 /*!< a pointer to a DXF \c MLINESTYLE object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1095,7 +1097,7 @@ dxf_mlinestyle_set_element_offset
                  * be set for the object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
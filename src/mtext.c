@@ -61,7 +61,7 @@ dxf_mtext_new ()
         size = sizeof (DxfMtext);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((mtext = malloc (size)) == NULL)
+        if ((mtext = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfMtext struct.\n")),
@@ -100,33 +100,48 @@ dxf_mtext_init
         /* Do some basic checks. */
         if (mtext == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 mtext = dxf_mtext_new ();
         }
         if (mtext == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfMtext struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         mtext->id_code = 0;
-        mtext->text_value = strdup ("");
-        for (i = 1; i < DXF_MAX_PARAM; i++)
-        {
-                mtext->text_additional_value[i] = strdup ("");
-        }
-        mtext->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        mtext->text_style = strdup ("");
-        mtext->layer = strdup (DXF_DEFAULT_LAYER);
-        mtext->p0->x0 = 0.0;
-        mtext->p0->y0 = 0.0;
-        mtext->p0->z0 = 0.0;
-        mtext->p1->x0 = 0.0;
-        mtext->p1->y0 = 0.0;
-        mtext->p1->z0 = 0.0;
+        mtext->text_value = dxf_strdup ("");
+        for (i = 0; i < DXF_MAX_PARAM; i++)
+        {
+                mtext->text_additional_value[i] = dxf_strdup ("");
+        }
+        mtext->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        mtext->text_style = dxf_strdup ("");
+        mtext->layer = dxf_strdup (DXF_DEFAULT_LAYER);
+        mtext->dictionary_owner_soft = dxf_strdup ("");
+        mtext->material = dxf_strdup ("");
+        mtext->dictionary_owner_hard = dxf_strdup ("");
+        mtext->plot_style_name = dxf_strdup ("");
+        mtext->color_name = dxf_strdup ("");
+        mtext->p0 = dxf_point_init (dxf_point_new ());
+        if (mtext->p0 == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        mtext->p1 = dxf_point_init (dxf_point_new ());
+        if (mtext->p1 == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         mtext->elevation = 0.0;
         mtext->thickness = 0.0;
         mtext->height = 0.0;
@@ -154,7 +169,7 @@ dxf_mtext_init
         mtext->extr_y0 = 0.0;
         mtext->extr_z0 = 0.0;
         mtext->background_color_rgb = 0;
-        mtext->background_color_name = strdup ("");
+        mtext->background_color_name = dxf_strdup ("");
         mtext->background_transparency = 0;
 #if DEBUG
         DXF_DEBUG_END
@@ -192,16 +207,16 @@ dxf_mtext_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (mtext == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 mtext = dxf_mtext_init (mtext);
@@ -212,12 +227,12 @@ dxf_mtext_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
@@ -464,7 +479,7 @@ dxf_mtext_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbMText") != 0)))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -500,22 +515,23 @@ dxf_mtext_read
 
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (mtext->linetype, "") == 0)
         {
-                mtext->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                mtext->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (mtext->layer, "") == 0)
         {
-                mtext->layer = strdup (DXF_DEFAULT_LAYER);
+                mtext->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -548,58 +564,58 @@ dxf_mtext_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("MTEXT");
+        char *dxf_entity_name = dxf_strdup ("MTEXT");
         int i;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (mtext == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((fp->acad_version_number < AutoCAD_13)
           && (fp->follow_strict_version_rules))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, mtext->id_code);
                 return (EXIT_FAILURE);
         }
         else
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, mtext->id_code);
         }
         if (strcmp (mtext->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, mtext->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                mtext->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                mtext->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (mtext->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, mtext->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
                 mtext->layer = DXF_DEFAULT_LAYER;
@@ -682,7 +698,8 @@ dxf_mtext_write
         fprintf (fp->fp, " 72\n%d\n", mtext->drawing_direction);
         fprintf (fp->fp, "  1\n%s\n", mtext->text_value);
         i = 0;
-        while (strlen (mtext->text_additional_value[i]) > 0)
+        while ((i < DXF_MAX_PARAM)
+          && (strlen (mtext->text_additional_value[i]) > 0))
         {
                 fprintf (fp->fp, "  3\n%s\n", mtext->text_additional_value[i]);
                 i++;
@@ -705,7 +722,7 @@ dxf_mtext_write
         fprintf (fp->fp, " 43\n%f\n", mtext->rectangle_height);
         fprintf (fp->fp, " 50\n%f\n", mtext->rot_angle);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -735,30 +752,35 @@ dxf_mtext_free
         /* Do some basic checks. */
         if (mtext == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (mtext->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (mtext->linetype);
-        free (mtext->layer);
-        free (mtext->text_value);
+        dxf_free (mtext->linetype);
+        dxf_free (mtext->layer);
+        dxf_free (mtext->text_value);
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
-                free (mtext->text_additional_value[i]);
-        }
-        free (mtext->text_style);
-        free (mtext->dictionary_owner_soft);
-        free (mtext->dictionary_owner_hard);
-        free (mtext->background_color_name);
-        free (mtext);
+                dxf_free (mtext->text_additional_value[i]);
+        }
+        dxf_free (mtext->text_style);
+        dxf_free (mtext->dictionary_owner_soft);
+        dxf_free (mtext->material);
+        dxf_free (mtext->dictionary_owner_hard);
+        dxf_free (mtext->plot_style_name);
+        dxf_free (mtext->color_name);
+        dxf_free (mtext->background_color_name);
+        dxf_point_free (mtext->p0);
+        dxf_point_free (mtext->p1);
+        dxf_free (mtext);
         mtext = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -779,18 +801,19 @@ dxf_mtext_free_list
                  * entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (mtexts == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (mtexts != NULL)
         {
                 DxfMtext *iter = (DxfMtext *) mtexts->next;
+                mtexts->next = NULL;
                 dxf_mtext_free (mtexts);
                 mtexts = (DxfMtext *) iter;
         }
@@ -910,7 +933,7 @@ dxf_mtext_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mtext->linetype));
+        return (dxf_strdup (mtext->linetype));
 }
 
 
@@ -944,7 +967,7 @@ dxf_mtext_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->linetype = strdup (linetype);
+        mtext->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -985,7 +1008,7 @@ dxf_mtext_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mtext->layer));
+        return (dxf_strdup (mtext->layer));
 }
 
 
@@ -1019,7 +1042,7 @@ dxf_mtext_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->layer = strdup (layer);
+        mtext->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1787,7 +1810,7 @@ dxf_mtext_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mtext->dictionary_owner_soft));
+        return (dxf_strdup (mtext->dictionary_owner_soft));
 }
 
 
@@ -1823,7 +1846,7 @@ dxf_mtext_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        mtext->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1867,7 +1890,7 @@ dxf_mtext_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mtext->material));
+        return (dxf_strdup (mtext->material));
 }
 
 
@@ -1905,7 +1928,7 @@ dxf_mtext_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->material = strdup (material);
+        mtext->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1949,7 +1972,7 @@ dxf_mtext_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mtext->dictionary_owner_hard));
+        return (dxf_strdup (mtext->dictionary_owner_hard));
 }
 
 
@@ -1985,7 +2008,7 @@ dxf_mtext_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        mtext->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2092,7 +2115,7 @@ dxf_mtext_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mtext->plot_style_name));
+        return (dxf_strdup (mtext->plot_style_name));
 }
 
 
@@ -2130,7 +2153,7 @@ dxf_mtext_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->plot_style_name = strdup (plot_style_name);
+        mtext->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2237,7 +2260,7 @@ dxf_mtext_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mtext->color_name));
+        return (dxf_strdup (mtext->color_name));
 }
 
 
@@ -2275,7 +2298,7 @@ dxf_mtext_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->color_name = strdup (color_name);
+        mtext->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2382,7 +2405,7 @@ dxf_mtext_get_text_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mtext->text_value));
+        return (dxf_strdup (mtext->text_value));
 }
 
 
@@ -2420,7 +2443,7 @@ dxf_mtext_set_text_value
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->text_value = strdup (text_value);
+        mtext->text_value = dxf_strdup (text_value);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2462,7 +2485,7 @@ dxf_mtext_get_text_style
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mtext->text_style));
+        return (dxf_strdup (mtext->text_style));
 }
 
 
@@ -2500,7 +2523,7 @@ dxf_mtext_set_text_style
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->text_style = strdup (text_style);
+        mtext->text_style = dxf_strdup (text_style);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2520,7 +2543,7 @@ dxf_mtext_get_p0
                 /*!< a pointer to a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2559,7 +2582,7 @@ dxf_mtext_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2598,7 +2621,7 @@ dxf_mtext_get_x0
                 /*!< a pointer to a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2641,7 +2664,7 @@ dxf_mtext_set_x0
                  * \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2680,7 +2703,7 @@ dxf_mtext_get_y0
                 /*!< a pointer to a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2723,7 +2746,7 @@ dxf_mtext_set_y0
                  * \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2762,7 +2785,7 @@ dxf_mtext_get_z0
                 /*!< a pointer to a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2805,7 +2828,7 @@ dxf_mtext_set_z0
                  * \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2843,7 +2866,7 @@ dxf_mtext_get_p1
                 /*!< a pointer to a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2882,7 +2905,7 @@ dxf_mtext_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2921,7 +2944,7 @@ dxf_mtext_get_x1
                 /*!< a pointer to a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2964,7 +2987,7 @@ dxf_mtext_set_x1
                  * \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3003,7 +3026,7 @@ dxf_mtext_get_y1
                 /*!< a pointer to a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3046,7 +3069,7 @@ dxf_mtext_set_y1
                  * \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3085,7 +3108,7 @@ dxf_mtext_get_z1
                 /*!< a pointer to a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3128,7 +3151,7 @@ dxf_mtext_set_z1
                  * \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3167,7 +3190,7 @@ dxf_mtext_get_height
                 /*!< a pointer to a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3209,7 +3232,7 @@ dxf_mtext_set_height
                  * \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3247,7 +3270,7 @@ dxf_mtext_get_rectangle_width
                 /*!< a pointer to a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3288,7 +3311,7 @@ dxf_mtext_set_rectangle_width
                 /*!< the \c rectangle_width of a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3325,7 +3348,7 @@ dxf_mtext_get_horizontal_width
                 /*!< a pointer to a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3365,7 +3388,7 @@ dxf_mtext_set_horizontal_width
                 /*!< the \c horizontal_width of a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3402,7 +3425,7 @@ dxf_mtext_get_rectangle_height
                 /*!< a pointer to a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3442,7 +3465,7 @@ dxf_mtext_set_rectangle_height
                 /*!< the \c rectangle_height of a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3479,7 +3502,7 @@ dxf_mtext_get_spacing_factor
                 /*!< a pointer to a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3519,7 +3542,7 @@ dxf_mtext_set_spacing_factor
                 /*!< the \c spacing_factor of a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3556,7 +3579,7 @@ dxf_mtext_get_box_scale
                 /*!< a pointer to a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3596,7 +3619,7 @@ dxf_mtext_set_box_scale
                 /*!< the \c box_scale of a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3633,7 +3656,7 @@ dxf_mtext_get_column_width
                 /*!< a pointer to a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3673,7 +3696,7 @@ dxf_mtext_set_column_width
                 /*!< the \c column_width of a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3710,7 +3733,7 @@ dxf_mtext_get_column_gutter
                 /*!< a pointer to a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3750,7 +3773,7 @@ dxf_mtext_set_column_gutter
                 /*!< the \c column_gutter of a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3787,7 +3810,7 @@ dxf_mtext_get_column_heights
                 /*!< a pointer to a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3827,7 +3850,7 @@ dxf_mtext_set_column_heights
                 /*!< the \c column_heights of a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3864,7 +3887,7 @@ dxf_mtext_get_rot_angle
                 /*!< a pointer to a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3898,7 +3921,7 @@ dxf_mtext_set_rot_angle
                 /*!< the \c rot_angle of a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4635,7 +4658,7 @@ dxf_mtext_get_extr_x0
                 /*!< a pointer to a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4671,7 +4694,7 @@ dxf_mtext_set_extr_x0
                  * DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4703,7 +4726,7 @@ dxf_mtext_get_extr_y0
                 /*!< a pointer to a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4739,7 +4762,7 @@ dxf_mtext_set_extr_y0
                  * DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4771,7 +4794,7 @@ dxf_mtext_get_extr_z0
                 /*!< a pointer to a DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4807,7 +4830,7 @@ dxf_mtext_set_extr_z0
                  * DXF \c MTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4999,7 +5022,7 @@ dxf_mtext_get_background_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mtext->background_color_name));
+        return (dxf_strdup (mtext->background_color_name));
 }
 
 
@@ -5037,7 +5060,7 @@ dxf_mtext_set_background_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->background_color_name = strdup (background_color_name);
+        mtext->background_color_name = dxf_strdup (background_color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -0,0 +1,440 @@
+/*!
+ * \file nurbs.c
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for libDXF NURBS (rational B-spline) curve evaluation.
+ *
+ * Curves are given by their degree, an array of control points with
+ * their weights (X, Y, Z and W for every control point) and a knot
+ * vector with (number of control points + degree + 1) values, as found
+ * in a DXF \c SPLINE entity or a hatch boundary path spline edge.
+ * Points are evaluated with the de Boor algorithm in homogeneous
+ * coordinates.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "nurbs.h"
+
+#include <math.h>
+
+
+/*!
+ * \brief Check the definition of a curve.
+ */
+static int
+dxf_nurbs_validate
+(
+        int degree,
+        int number_of_control_points,
+        const double *cpw,
+        int number_of_knots,
+        const double *knots
+)
+{
+        int i;
+
+        if ((degree < 1) || (degree > DXF_NURBS_MAX_DEGREE))
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((number_of_control_points < degree + 1)
+          || (number_of_knots != number_of_control_points + degree + 1))
+        {
+                return (EXIT_FAILURE);
+        }
+        for (i = 1; i < number_of_knots; i++)
+        {
+                if (knots[i] < knots[i - 1])
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        if (knots[number_of_control_points] <= knots[degree])
+        {
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < number_of_control_points; i++)
+        {
+                if (cpw[4 * i + 3] <= 0.0)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Find the knot span \c k with
+ * \f$ t_k \leq u < t_{k + 1} \f$ within the domain of the curve.
+ */
+static int
+dxf_nurbs_find_span
+(
+        int degree,
+        int number_of_control_points,
+        const double *knots,
+        double u
+)
+{
+        int low = degree;
+        int high = number_of_control_points;
+        int mid;
+
+        if (u >= knots[number_of_control_points])
+        {
+                /* Last non empty span. */
+                high = number_of_control_points - 1;
+                while ((high > degree) && (knots[high] >= knots[high + 1]))
+                {
+                        high--;
+                }
+                return (high);
+        }
+        if (u <= knots[degree])
+        {
+                low = degree;
+                while ((low < number_of_control_points - 1)
+                  && (knots[low + 1] <= knots[degree]))
+                {
+                        low++;
+                }
+                return (low);
+        }
+        while (high - low > 1)
+        {
+                mid = (low + high) / 2;
+                if (u < knots[mid])
+                {
+                        high = mid;
+                }
+                else
+                {
+                        low = mid;
+                }
+        }
+        return (low);
+}
+
+
+/*!
+ * \brief Evaluate a curve at \c u within knot span \c span (de Boor).
+ */
+static void
+dxf_nurbs_evaluate_span
+(
+        int degree,
+        const double *cpw,
+        const double *knots,
+        int span,
+        double u,
+        double *point
+)
+{
+        double d[DXF_NURBS_MAX_DEGREE + 1][4];
+        const double *cp = NULL;
+        double alpha;
+        double denominator;
+        int first = span - degree;
+        int r;
+        int j;
+
+        for (j = 0; j <= degree; j++)
+        {
+                cp = cpw + 4 * (first + j);
+                d[j][0] = cp[0] * cp[3];
+                d[j][1] = cp[1] * cp[3];
+                d[j][2] = cp[2] * cp[3];
+                d[j][3] = cp[3];
+        }
+        for (r = 1; r <= degree; r++)
+        {
+                for (j = degree; j >= r; j--)
+                {
+                        denominator = knots[first + j + degree - r + 1] - knots[first + j];
+                        alpha = (denominator > 0.0) ? (u - knots[first + j]) / denominator : 0.0;
+                        d[j][0] = (1.0 - alpha) * d[j - 1][0] + alpha * d[j][0];
+                        d[j][1] = (1.0 - alpha) * d[j - 1][1] + alpha * d[j][1];
+                        d[j][2] = (1.0 - alpha) * d[j - 1][2] + alpha * d[j][2];
+                        d[j][3] = (1.0 - alpha) * d[j - 1][3] + alpha * d[j][3];
+                }
+        }
+        point[0] = d[degree][0] / d[degree][3];
+        point[1] = d[degree][1] / d[degree][3];
+        point[2] = d[degree][2] / d[degree][3];
+}
+
+
+/*!
+ * \brief Distance of point \c p to the segment from \c a to \c b.
+ */
+static double
+dxf_nurbs_segment_distance
+(
+        const double *a,
+        const double *b,
+        const double *p
+)
+{
+        double d[3];
+        double v[3];
+        double length2;
+        double t;
+        int i;
+
+        length2 = 0.0;
+        t = 0.0;
+        for (i = 0; i < 3; i++)
+        {
+                d[i] = b[i] - a[i];
+                v[i] = p[i] - a[i];
+                length2 += d[i] * d[i];
+                t += d[i] * v[i];
+        }
+        t = (length2 > 0.0) ? t / length2 : 0.0;
+        if (t < 0.0) t = 0.0;
+        if (t > 1.0) t = 1.0;
+        for (i = 0; i < 3; i++)
+        {
+                v[i] -= t * d[i];
+        }
+        return (sqrt (v[0] * v[0] + v[1] * v[1] + v[2] * v[2]));
+}
+
+
+/*!
+ * \brief Evaluate a NURBS curve at a parameter value.
+ *
+ * Parameter values outside the domain
+ * \f$ [t_{degree}, t_{number\_of\_control\_points}] \f$ are clamped.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_nurbs_evaluate
+(
+        int degree,
+                /*!< degree of the curve. */
+        int number_of_control_points,
+                /*!< number of control points. */
+        const double *cpw,
+                /*!< control points and weights (X, Y, Z and W for
+                 * every control point). */
+        int number_of_knots,
+                /*!< number of knots, must be
+                 * \c number_of_control_points + \c degree + 1. */
+        const double *knots,
+                /*!< knot vector. */
+        double u,
+                /*!< parameter value. */
+        double *point
+                /*!< receives X, Y and Z of the point on the curve. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((cpw == NULL) || (knots == NULL) || (point == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_nurbs_validate (degree, number_of_control_points, cpw,
+          number_of_knots, knots) != EXIT_SUCCESS)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an invalid curve was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (u < knots[degree]) u = knots[degree];
+        if (u > knots[number_of_control_points]) u = knots[number_of_control_points];
+        dxf_nurbs_evaluate_span (degree, cpw, knots,
+          dxf_nurbs_find_span (degree, number_of_control_points, knots, u),
+          u, point);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Tessellate a NURBS curve into a polyline.
+ *
+ * Every non empty knot span is halved recursively until the curve
+ * deviates less than \c tolerance from the chord of each piece, this
+ * is tested at a quarter, half and three quarters of every piece.\n
+ * Pieces of curves of degree 2 or higher are halved at least once.\n
+ * The points (including the start and end point of the curve) are
+ * added to the last curve of \c tessellation, start a new curve with
+ * \c dxf_tessellation_begin_curve() first when needed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_nurbs_tessellate
+(
+        int degree,
+                /*!< degree of the curve. */
+        int number_of_control_points,
+                /*!< number of control points. */
+        const double *cpw,
+                /*!< control points and weights (X, Y, Z and W for
+                 * every control point). */
+        int number_of_knots,
+                /*!< number of knots, must be
+                 * \c number_of_control_points + \c degree + 1. */
+        const double *knots,
+                /*!< knot vector. */
+        double tolerance,
+                /*!< maximum distance between the curve and the
+                 * polyline (chord tolerance). */
+        DxfTessellation *tessellation
+                /*!< a pointer to the \c DxfTessellation receiving the
+                 * points. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double stack_u[DXF_NURBS_MAX_SUBDIVISION_DEPTH + 2];
+        double stack_point[DXF_NURBS_MAX_SUBDIVISION_DEPTH + 2][3];
+        int stack_depth[DXF_NURBS_MAX_SUBDIVISION_DEPTH + 2];
+        double start_u;
+        double start_point[3];
+        double probe[3];
+        double deviation;
+        double u;
+        int minimum_depth;
+        int top;
+        int span;
+        int k;
+
+        /* Do some basic checks. */
+        if ((cpw == NULL) || (knots == NULL) || (tessellation == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (!(tolerance > 0.0))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a tolerance of zero or less was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_nurbs_validate (degree, number_of_control_points, cpw,
+          number_of_knots, knots) != EXIT_SUCCESS)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an invalid curve was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        minimum_depth = (degree > 1) ? 1 : 0;
+        span = dxf_nurbs_find_span (degree, number_of_control_points, knots, knots[degree]);
+        dxf_nurbs_evaluate_span (degree, cpw, knots, span, knots[degree], start_point);
+        if (dxf_tessellation_add_point (tessellation, start_point[0],
+          start_point[1], start_point[2]) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        for (span = degree; span < number_of_control_points; span++)
+        {
+                if (knots[span + 1] <= knots[span])
+                {
+                        continue;
+                }
+                /* The stack holds the end points of the pieces still to
+                 * be processed, the piece on top starts at start_u. */
+                start_u = knots[span];
+                top = 0;
+                stack_u[0] = knots[span + 1];
+                dxf_nurbs_evaluate_span (degree, cpw, knots, span,
+                  stack_u[0], stack_point[0]);
+                stack_depth[0] = 0;
+                while (top >= 0)
+                {
+                        deviation = 0.0;
+                        if (stack_depth[top] >= minimum_depth)
+                        {
+                                for (k = 1; k <= 3; k++)
+                                {
+                                        u = start_u + 0.25 * k * (stack_u[top] - start_u);
+                                        dxf_nurbs_evaluate_span (degree, cpw,
+                                          knots, span, u, probe);
+                                        deviation = fmax (deviation,
+                                          dxf_nurbs_segment_distance (start_point,
+                                          stack_point[top], probe));
+                                }
+                        }
+                        if (((stack_depth[top] >= minimum_depth) && (deviation <= tolerance))
+                          || (stack_depth[top] >= DXF_NURBS_MAX_SUBDIVISION_DEPTH))
+                        {
+                                /* Accept the piece. */
+                                if (dxf_tessellation_add_point (tessellation,
+                                  stack_point[top][0], stack_point[top][1],
+                                  stack_point[top][2]) != EXIT_SUCCESS)
+                                {
+                                        return (EXIT_FAILURE);
+                                }
+                                start_u = stack_u[top];
+                                memcpy (start_point, stack_point[top], sizeof (start_point));
+                                top--;
+                        }
+                        else
+                        {
+                                /* Halve the piece, the first half goes
+                                 * on top. */
+                                u = 0.5 * (start_u + stack_u[top]);
+                                stack_depth[top]++;
+                                stack_u[top + 1] = u;
+                                stack_depth[top + 1] = stack_depth[top];
+                                dxf_nurbs_evaluate_span (degree, cpw, knots,
+                                  span, u, stack_point[top + 1]);
+                                top++;
+                        }
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/* EOF */
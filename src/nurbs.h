@@ -0,0 +1,68 @@
+/*!
+ * \file nurbs.h
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for libDXF NURBS (rational B-spline) curve evaluation.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_NURBS_H
+#define LIBDXF_SRC_NURBS_H
+
+
+#include "global.h"
+#include "tessellation.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_NURBS_MAX_DEGREE 31
+        /*!< \brief Highest degree of a curve that can be evaluated. */
+
+#define DXF_NURBS_MAX_SUBDIVISION_DEPTH 24
+        /*!< \brief Maximum number of times a knot span is halved by
+         * \c dxf_nurbs_tessellate(). */
+
+
+int dxf_nurbs_evaluate (int degree, int number_of_control_points, const double *cpw, int number_of_knots, const double *knots, double u, double *point);
+int dxf_nurbs_tessellate (int degree, int number_of_control_points, const double *cpw, int number_of_knots, const double *knots, double tolerance, DxfTessellation *tessellation);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_NURBS_H */
+
+
+/* EOF */
@@ -53,7 +53,7 @@ dxf_object_new ()
         size = sizeof (DxfObject);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((object = malloc (size)) == NULL)
+        if ((object = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfObject struct.\n")),
@@ -93,19 +93,20 @@ dxf_object_init
         /* Do some basic checks. */
         if (object == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 object = dxf_object_new ();
         }
         if (object == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfObject struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         object->entity_type = UNKNOWN_ENTITY;
+        object->id_code = 0;
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
                 /*! \todo Add code for initialising a DxfParam. */
@@ -164,19 +165,19 @@ dxf_object_free
         /* Do some basic checks. */
         if (object == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (object->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (object);
+        dxf_free (object);
         object = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -198,18 +199,19 @@ dxf_object_free_list
                  * \c objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (objects == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (objects != NULL)
         {
                 DxfObject *iter = (DxfObject *) objects->next;
+                objects->next = NULL;
                 dxf_object_free (objects);
                 objects = (DxfObject *) iter;
         }
@@ -296,6 +298,69 @@ dxf_object_set_entity_type
 }
 
 
+/*!
+ * \brief Get the \c id_code from a DXF \c OBJECT entity.
+ *
+ * \return \c id_code, or -1 when an error occurred.
+ */
+int
+dxf_object_get_id_code
+(
+        DxfObject *object
+                /*!< a pointer to a DXF \c OBJECT entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (object == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (object->id_code);
+}
+
+
+/*!
+ * \brief Set the \c id_code for a DXF \c OBJECT entity.
+ */
+DxfObject *
+dxf_object_set_id_code
+(
+        DxfObject *object,
+                /*!< a pointer to a DXF \c OBJECT entity. */
+        int id_code
+                /*!< Identification number for the object.\n
+                 * This is to be an unique (sequential) number in the DXF
+                 * file. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (object == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        object->id_code = id_code;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (object);
+}
+
+
 /*!
  * \brief Get the pointer to the next \c OBJECT entity from a DXF
  * \c OBJECT entity.
@@ -56,6 +56,11 @@ dxf_object_struct
 {
         DxfEntityType entity_type;
                 /*!< dxf entity type. */
+        int id_code;
+                /*!< Identification number for the object.\n
+                 * This is to be an unique (sequential) number in the DXF
+                 * file.\n
+                 * Group code = 5. */
         DxfParam parameter[DXF_MAX_PARAM];
                 /*!< corresponding values stored in here. */
         struct DxfObject *next;
@@ -71,6 +76,8 @@ int dxf_object_free (DxfObject *object);
 void dxf_object_free_list (DxfObject *objects);
 DxfEntityType *dxf_object_get_entity_type (DxfObject *object);
 DxfObject *dxf_object_set_entity_type (DxfObject *object, DxfEntityType entity_type);
+int dxf_object_get_id_code (DxfObject *object);
+DxfObject *dxf_object_set_id_code (DxfObject *object, int id_code);
 DxfObject *dxf_object_get_next (DxfObject *object);
 DxfObject *dxf_object_set_next (DxfObject *object, DxfObject *next);
 DxfObject *dxf_object_get_last (DxfObject *object);
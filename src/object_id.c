@@ -53,7 +53,7 @@ dxf_object_id_new ()
         size = sizeof (DxfObjectId);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((object_id = malloc (size)) == NULL)
+        if ((object_id = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfObjectId struct.\n")),
@@ -91,19 +91,19 @@ dxf_object_id_init
         /* Do some basic checks. */
         if (object_id == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 object_id = dxf_object_id_new ();
         }
         if (object_id == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfObjectId struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        object_id->data = strdup ("");
+        object_id->data = dxf_strdup ("");
         object_id->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -133,20 +133,20 @@ dxf_object_id_free
         /* Do some basic checks. */
         if (object_id == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (object_id->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (object_id->data);
-        free (object_id);
+        dxf_free (object_id->data);
+        dxf_free (object_id);
         object_id = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -167,18 +167,19 @@ dxf_object_id_free_list
                  * \c object_ids. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (object_ids == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (object_ids != NULL)
         {
                 DxfObjectId *iter = (DxfObjectId *) object_ids->next;
+                object_ids->next = NULL;
                 dxf_object_id_free (object_ids);
                 object_ids = (DxfObjectId *) iter;
         }
@@ -305,7 +306,7 @@ dxf_object_id_get_data
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (object_id->data));
+        return (dxf_strdup (object_id->data));
 }
 
 
@@ -339,7 +340,7 @@ dxf_object_id_set_data
                   __FUNCTION__);
                 return (NULL);
         }
-        object_id->data = strdup (data);
+        object_id->data = dxf_strdup (data);
 #if DEBUG
         DXF_DEBUG_END
 #endif
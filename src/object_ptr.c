@@ -61,7 +61,7 @@ dxf_object_ptr_new ()
         size = sizeof (DxfObjectPtr);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((object_ptr = malloc (size)) == NULL)
+        if ((object_ptr = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfObjectPtr struct.\n")),
@@ -99,21 +99,21 @@ dxf_object_ptr_init
         /* Do some basic checks. */
         if (object_ptr == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 object_ptr = dxf_object_ptr_new ();
         }
         if (object_ptr == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfObjectPtr struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         object_ptr->id_code = 0;
-        object_ptr->dictionary_owner_soft = strdup ("");
-        object_ptr->dictionary_owner_hard = strdup ("");
+        object_ptr->dictionary_owner_soft = dxf_strdup ("");
+        object_ptr->dictionary_owner_hard = dxf_strdup ("");
         object_ptr->xdata->value = NULL;
         object_ptr->xdata->length = 0;
         object_ptr->xdata->next = NULL;
@@ -153,22 +153,22 @@ dxf_object_ptr_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (object_ptr == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 object_ptr = dxf_object_ptr_init (object_ptr);
@@ -179,11 +179,11 @@ dxf_object_ptr_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -226,13 +226,14 @@ dxf_object_ptr_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -258,30 +259,30 @@ dxf_object_ptr_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("OBJECT_PTR");
+        char *dxf_entity_name = dxf_strdup ("OBJECT_PTR");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (object_ptr == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, object_ptr->id_code);
         }
@@ -321,7 +322,7 @@ dxf_object_ptr_write
                 /*! \todo Write the complete linked list of char values. */
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -352,32 +353,32 @@ dxf_object_ptr_free
         /* Do some basic checks. */
         if (object_ptr == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (object_ptr->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (object_ptr->dictionary_owner_soft);
-        free (object_ptr->dictionary_owner_hard);
+        dxf_free (object_ptr->dictionary_owner_soft);
+        dxf_free (object_ptr->dictionary_owner_hard);
         while (object_ptr->xdata->value != NULL)
         {
                 iter = (struct DxfChar *) object_ptr->xdata->next;
-                free (object_ptr->xdata->value);
-                free (object_ptr->xdata);
+                dxf_free (object_ptr->xdata->value);
+                dxf_free (object_ptr->xdata);
                 if (iter != NULL)
                 {
                         object_ptr->xdata = (DxfChar *) iter;
                 }
         }
-        free (object_ptr);
-        free (iter);
+        dxf_free (object_ptr);
+        dxf_free (iter);
         object_ptr = NULL;
         iter = NULL;
 #if DEBUG
@@ -399,18 +400,19 @@ dxf_object_ptr_free_list
                  * \c OBJECT_PTR objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (objectptrs == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (objectptrs != NULL)
         {
                 DxfObjectPtr *iter = (DxfObjectPtr *) objectptrs->next;
+                objectptrs->next = NULL;
                 dxf_object_ptr_free (objectptrs);
                 objectptrs = (DxfObjectPtr *) iter;
         }
@@ -533,7 +535,7 @@ dxf_object_ptr_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (object_ptr->dictionary_owner_soft));
+        return (dxf_strdup (object_ptr->dictionary_owner_soft));
 }
 
 
@@ -569,7 +571,7 @@ dxf_object_ptr_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        object_ptr->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        object_ptr->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -613,7 +615,7 @@ dxf_object_ptr_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (object_ptr->dictionary_owner_hard));
+        return (dxf_strdup (object_ptr->dictionary_owner_hard));
 }
 
 
@@ -649,7 +651,7 @@ dxf_object_ptr_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        object_ptr->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        object_ptr->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -61,7 +61,7 @@ dxf_ole2frame_new ()
         size = sizeof (DxfOle2Frame);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((ole2frame = malloc (size)) == NULL)
+        if ((ole2frame = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfOle2Frame struct.\n")),
@@ -99,31 +99,31 @@ dxf_ole2frame_init
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 ole2frame = dxf_ole2frame_new ();
         }
         if (ole2frame == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfOle2Frame struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         ole2frame->id_code = 0;
-        ole2frame->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        ole2frame->layer = strdup (DXF_DEFAULT_LAYER);
+        ole2frame->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        ole2frame->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         ole2frame->elevation = 0.0;
         ole2frame->thickness = 0.0;
         ole2frame->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
         ole2frame->visibility = DXF_DEFAULT_VISIBILITY;
         ole2frame->color = DXF_COLOR_BYLAYER;
         ole2frame->paperspace = DXF_MODELSPACE;
-        ole2frame->dictionary_owner_soft = strdup ("");
-        ole2frame->dictionary_owner_hard = strdup ("");
-        ole2frame->end_of_data = strdup ("OLE");
-        ole2frame->length_of_binary_data = strdup ("");
+        ole2frame->dictionary_owner_soft = dxf_strdup ("");
+        ole2frame->dictionary_owner_hard = dxf_strdup ("");
+        ole2frame->end_of_data = dxf_strdup ("OLE");
+        ole2frame->length_of_binary_data = dxf_strdup ("");
         dxf_ole2frame_set_p0 (ole2frame, dxf_point_new ());
         dxf_point_init ((DxfPoint *) dxf_ole2frame_get_p0 (ole2frame));
         ole2frame->p0->x0 = 0.0;
@@ -138,11 +138,7 @@ dxf_ole2frame_init
         ole2frame->ole_object_type = 0;
         ole2frame->tilemode_descriptor = 0;
         ole2frame->length = 0;
-        ole2frame->binary_data = dxf_char_new ();
-        ole2frame->binary_data = dxf_char_init (ole2frame->binary_data);
-        ole2frame->binary_data->value = strdup ("");
-        ole2frame->binary_data->length = 0;
-        ole2frame->binary_data->next = NULL;
+        ole2frame->binary_data = dxf_binary_data_init (dxf_binary_data_new ());
         ole2frame->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -174,39 +170,35 @@ dxf_ole2frame_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfChar *iter = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 ole2frame = dxf_ole2frame_init (ole2frame);
         }
-        iter = (DxfChar *) ole2frame->binary_data;
         (fp->line_number)++;
         fscanf (fp->fp, "%[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
@@ -217,7 +209,7 @@ dxf_ole2frame_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "OLE") != 0)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad End of Ole data marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -372,7 +364,7 @@ dxf_ole2frame_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbOle2Frame") != 0)))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -381,9 +373,8 @@ dxf_ole2frame_read
                 {
                         /* Now follows a string containing binary data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter->value);
-                        iter->next = (struct DxfChar *) dxf_char_init ((DxfChar *) iter->next);
-                        iter = (DxfChar *) iter->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_data_append_hex (ole2frame->binary_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -408,22 +399,22 @@ dxf_ole2frame_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (ole2frame->linetype, "") == 0)
         {
-                ole2frame->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                ole2frame->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (ole2frame->layer, "") == 0)
         {
-                ole2frame->layer = strdup (DXF_DEFAULT_LAYER);
+                ole2frame->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -449,53 +440,52 @@ dxf_ole2frame_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("OLE2FRAME");
-        DxfChar *iter = NULL;
+        char *dxf_entity_name = dxf_strdup ("OLE2FRAME");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (strcmp (ole2frame->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, ole2frame->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                ole2frame->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                ole2frame->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (ole2frame->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, ole2frame->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                ole2frame->layer = strdup (DXF_DEFAULT_LAYER);
+                ole2frame->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -577,22 +567,10 @@ dxf_ole2frame_write
         fprintf (fp->fp, " 71\n%d\n", ole2frame->ole_object_type);
         fprintf (fp->fp, " 72\n%d\n", ole2frame->tilemode_descriptor);
         fprintf (fp->fp, " 90\n%ld\n", ole2frame->length);
-        if (ole2frame->binary_data != NULL)
-        {
-                iter = (DxfChar*) ole2frame->binary_data;
-                while ((iter != NULL) && (iter->value != NULL))
-                {
-                        fprintf (fp->fp, "310\n%s\n", iter->value);
-                        iter = (DxfChar*) iter->next;
-                }
-        }
-        else
-        {
-                fprintf (fp->fp, "310\n\n");
-        }
+        dxf_binary_data_write (fp, ole2frame->binary_data);
         fprintf (fp->fp, "  1\nOLE\n");
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -621,29 +599,26 @@ dxf_ole2frame_free
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ole2frame->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (ole2frame->end_of_data);
-        free (ole2frame->length_of_binary_data);
-        free (ole2frame->linetype);
-        free (ole2frame->layer);
-        free (ole2frame->dictionary_owner_soft);
-        free (ole2frame->dictionary_owner_hard);
-        free (ole2frame->binary_data->value);
-        /*! \todo Needs a proper implementation. */
-        free (ole2frame->binary_data);
-        /*! \todo Needs a proper implementation. */
-        free (ole2frame);
+        dxf_free (ole2frame->end_of_data);
+        dxf_free (ole2frame->length_of_binary_data);
+        dxf_free (ole2frame->linetype);
+        dxf_free (ole2frame->layer);
+        dxf_free (ole2frame->dictionary_owner_soft);
+        dxf_free (ole2frame->dictionary_owner_hard);
+        dxf_binary_data_free_list (ole2frame->binary_data);
+        dxf_free (ole2frame);
         ole2frame = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -664,18 +639,19 @@ dxf_ole2frame_free_list
                  * \c OLE2FRAME entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (ole2frames == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (ole2frames != NULL)
         {
                 DxfOle2Frame *iter = (DxfOle2Frame *) ole2frames->next;
+                ole2frames->next = NULL;
                 dxf_ole2frame_free (ole2frames);
                 ole2frames = (DxfOle2Frame *) iter;
         }
@@ -795,7 +771,7 @@ dxf_ole2frame_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->linetype));
+        return (dxf_strdup (ole2frame->linetype));
 }
 
 
@@ -829,7 +805,7 @@ dxf_ole2frame_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->linetype = strdup (linetype);
+        ole2frame->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -870,7 +846,7 @@ dxf_ole2frame_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->layer));
+        return (dxf_strdup (ole2frame->layer));
 }
 
 
@@ -904,7 +880,7 @@ dxf_ole2frame_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->layer = strdup (layer);
+        ole2frame->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1661,7 +1637,7 @@ dxf_ole2frame_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->dictionary_owner_soft));
+        return (dxf_strdup (ole2frame->dictionary_owner_soft));
 }
 
 
@@ -1697,7 +1673,7 @@ dxf_ole2frame_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        ole2frame->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1742,7 +1718,7 @@ dxf_ole2frame_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->material));
+        return (dxf_strdup (ole2frame->material));
 }
 
 
@@ -1781,7 +1757,7 @@ dxf_ole2frame_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->material = strdup (material);
+        ole2frame->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1825,7 +1801,7 @@ dxf_ole2frame_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->dictionary_owner_hard));
+        return (dxf_strdup (ole2frame->dictionary_owner_hard));
 }
 
 
@@ -1861,7 +1837,7 @@ dxf_ole2frame_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        ole2frame->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1968,7 +1944,7 @@ dxf_ole2frame_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->plot_style_name));
+        return (dxf_strdup (ole2frame->plot_style_name));
 }
 
 
@@ -2006,7 +1982,7 @@ dxf_ole2frame_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->plot_style_name = strdup (plot_style_name);
+        ole2frame->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2113,7 +2089,7 @@ dxf_ole2frame_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->color_name));
+        return (dxf_strdup (ole2frame->color_name));
 }
 
 
@@ -2151,7 +2127,7 @@ dxf_ole2frame_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->color_name = strdup (color_name);
+        ole2frame->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2258,7 +2234,7 @@ dxf_ole2frame_get_end_of_data
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->end_of_data));
+        return (dxf_strdup (ole2frame->end_of_data));
 }
 
 
@@ -2296,7 +2272,7 @@ dxf_ole2frame_set_end_of_data
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->end_of_data = strdup (end_of_data);
+        ole2frame->end_of_data = dxf_strdup (end_of_data);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2338,7 +2314,7 @@ dxf_ole2frame_get_length_of_binary_data
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->length_of_binary_data));
+        return (dxf_strdup (ole2frame->length_of_binary_data));
 }
 
 
@@ -2376,7 +2352,7 @@ dxf_ole2frame_set_length_of_binary_data
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->length_of_binary_data = strdup (length_of_binary_data);
+        ole2frame->length_of_binary_data = dxf_strdup (length_of_binary_data);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2396,7 +2372,7 @@ dxf_ole2frame_get_p0
                 /*!< a pointer to a DXF \c OLE2FRAME entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2435,7 +2411,7 @@ dxf_ole2frame_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2474,7 +2450,7 @@ dxf_ole2frame_get_x0
                 /*!< a pointer to a DXF \c OLE2FRAME entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2517,7 +2493,7 @@ dxf_ole2frame_set_x0
                  * \c OLE2FRAME entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2556,7 +2532,7 @@ dxf_ole2frame_get_y0
                 /*!< a pointer to a DXF \c OLE2FRAME entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2599,7 +2575,7 @@ dxf_ole2frame_set_y0
                  * \c OLE2FRAME entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2638,7 +2614,7 @@ dxf_ole2frame_get_z0
                 /*!< a pointer to a DXF \c OLE2FRAME entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2681,7 +2657,7 @@ dxf_ole2frame_set_z0
                  * \c OLE2FRAME entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2719,7 +2695,7 @@ dxf_ole2frame_get_p1
                 /*!< a pointer to a DXF \c OLE2FRAME entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2758,7 +2734,7 @@ dxf_ole2frame_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2797,7 +2773,7 @@ dxf_ole2frame_get_x1
                 /*!< a pointer to a DXF \c OLE2FRAME entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2840,7 +2816,7 @@ dxf_ole2frame_set_x1
                  * \c OLE2FRAME entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2879,7 +2855,7 @@ dxf_ole2frame_get_y1
                 /*!< a pointer to a DXF \c OLE2FRAME entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2922,7 +2898,7 @@ dxf_ole2frame_set_y1
                  * \c OLE2FRAME entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2961,7 +2937,7 @@ dxf_ole2frame_get_z1
                 /*!< a pointer to a DXF \c OLE2FRAME entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3004,7 +2980,7 @@ dxf_ole2frame_set_z1
                  * \c OLE2FRAME entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3346,7 +3322,7 @@ dxf_ole2frame_set_length
  *
  * \warning No deep copy is made of the \c binary_data.
  */
-DxfChar *
+DxfBinaryData *
 dxf_ole2frame_get_binary_data
 (
         DxfOle2Frame *ole2frame
@@ -3391,7 +3367,7 @@ dxf_ole2frame_set_binary_data
 (
         DxfOle2Frame *ole2frame,
                 /*!< a pointer to a DXF \c OLE2FRAME entity. */
-        DxfChar *binary_data
+        DxfBinaryData *binary_data
                 /*!< a string containing the \c binary_data for the
                  * entity. */
 )
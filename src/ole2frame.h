@@ -211,9 +211,10 @@ dxf_ole2frame_struct
         long length;
                 /*!< group code = 90\n
                  * Length of binary data.\n */
-        DxfChar *binary_data;
+        DxfBinaryData *binary_data;
                 /*!< group code = 310\n
-                 * Binary data (multiple lines).*/
+                 * Binary data (multiple lines), decoded into
+                 * contiguous bytes.*/
         struct DxfOle2Frame *next;
                 /*!< pointer to the next DxfOle2Frame.\n
                  * \c NULL in the last DxfOle2Frame. */
@@ -294,8 +295,8 @@ int dxf_ole2frame_get_tilemode_descriptor (DxfOle2Frame *ole2frame);
 DxfOle2Frame *dxf_ole2frame_set_tilemode_descriptor (DxfOle2Frame *ole2frame, int tilemode_descriptor);
 long dxf_ole2frame_get_length (DxfOle2Frame *ole2frame);
 DxfOle2Frame *dxf_ole2frame_set_length (DxfOle2Frame *ole2frame, long length);
-DxfChar *dxf_ole2frame_get_binary_data (DxfOle2Frame *ole2frame);
-DxfOle2Frame *dxf_ole2frame_set_binary_data (DxfOle2Frame *ole2frame, DxfChar *binary_data);
+DxfBinaryData *dxf_ole2frame_get_binary_data (DxfOle2Frame *ole2frame);
+DxfOle2Frame *dxf_ole2frame_set_binary_data (DxfOle2Frame *ole2frame, DxfBinaryData *binary_data);
 DxfOle2Frame *dxf_ole2frame_get_next (DxfOle2Frame *ole2frame);
 DxfOle2Frame *dxf_ole2frame_set_next (DxfOle2Frame *ole2frame, DxfOle2Frame *next);
 DxfOle2Frame *dxf_ole2frame_get_last (DxfOle2Frame *ole2frame);
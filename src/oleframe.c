@@ -59,7 +59,7 @@ dxf_oleframe_new ()
         size = sizeof (DxfOleFrame);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((oleframe = malloc (size)) == NULL)
+        if ((oleframe = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfOleFrame struct.\n")),
@@ -97,36 +97,32 @@ dxf_oleframe_init
         /* Do some basic checks. */
         if (oleframe == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 oleframe = dxf_oleframe_new ();
         }
         if (oleframe == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfOleFrame struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         oleframe->id_code = 0;
-        oleframe->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        oleframe->layer = strdup (DXF_DEFAULT_LAYER);
+        oleframe->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        oleframe->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         oleframe->elevation = 0.0;
         oleframe->thickness = 0.0;
         oleframe->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
         oleframe->visibility = DXF_DEFAULT_VISIBILITY;
         oleframe->color = DXF_COLOR_BYLAYER;
         oleframe->paperspace = DXF_MODELSPACE;
-        oleframe->dictionary_owner_soft = strdup ("");
-        oleframe->dictionary_owner_hard = strdup ("");
+        oleframe->dictionary_owner_soft = dxf_strdup ("");
+        oleframe->dictionary_owner_hard = dxf_strdup ("");
         oleframe->ole_version_number = 1;
         oleframe->length = 0;
-        oleframe->binary_data = dxf_char_new ();
-        oleframe->binary_data = dxf_char_init (oleframe->binary_data);
-        oleframe->binary_data->value = strdup ("");
-        oleframe->binary_data->length = 0;
-        oleframe->binary_data->next = NULL;
+        oleframe->binary_data = dxf_binary_data_init (dxf_binary_data_new ());
         oleframe->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -158,39 +154,35 @@ dxf_oleframe_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfChar *iter = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (oleframe == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 oleframe = dxf_oleframe_init (oleframe);
         }
-        iter = (DxfChar *) oleframe->binary_data;
         (fp->line_number)++;
         fscanf (fp->fp, "%[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
@@ -201,7 +193,7 @@ dxf_oleframe_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "OLE") != 0)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad End of Ole data marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -294,7 +286,7 @@ dxf_oleframe_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbOleFrame") != 0)))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -303,9 +295,8 @@ dxf_oleframe_read
                 {
                         /* Now follows a string containing binary data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter->value);
-                        iter->next = (struct DxfChar *) dxf_char_init ((DxfChar *) iter->next);
-                        iter = (DxfChar *) iter->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_data_append_hex (oleframe->binary_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -330,22 +321,22 @@ dxf_oleframe_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (oleframe->linetype, "") == 0)
         {
-                oleframe->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                oleframe->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (oleframe->layer, "") == 0)
         {
-                oleframe->layer = strdup (DXF_DEFAULT_LAYER);
+                oleframe->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -371,53 +362,52 @@ dxf_oleframe_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("OLEFRAME");
-        DxfChar *iter = NULL;
+        char *dxf_entity_name = dxf_strdup ("OLEFRAME");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (oleframe == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (strcmp (oleframe->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, oleframe->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                oleframe->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                oleframe->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (oleframe->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, oleframe->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                oleframe->layer = strdup (DXF_DEFAULT_LAYER);
+                oleframe->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -490,22 +480,10 @@ dxf_oleframe_write
         }
         fprintf (fp->fp, " 70\n%d\n", oleframe->ole_version_number);
         fprintf (fp->fp, " 90\n%ld\n", oleframe->length);
-        if (oleframe->binary_data != NULL)
-        {
-                iter = (DxfChar*) oleframe->binary_data;
-                while ((iter != NULL) && (iter->value != NULL))
-                {
-                        fprintf (fp->fp, "310\n%s\n", iter->value);
-                        iter = (DxfChar*) iter->next;
-                }
-        }
-        else
-        {
-                fprintf (fp->fp, "310\n\n");
-        }
+        dxf_binary_data_write (fp, oleframe->binary_data);
         fprintf (fp->fp, "  1\nOLE\n");
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -534,24 +512,24 @@ dxf_oleframe_free
         /* Do some basic checks. */
         if (oleframe == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (oleframe->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (oleframe->linetype);
-        free (oleframe->layer);
-        free (oleframe->dictionary_owner_soft);
-        free (oleframe->dictionary_owner_hard);
-        dxf_char_free_list (oleframe->binary_data);
-        free (oleframe);
+        dxf_free (oleframe->linetype);
+        dxf_free (oleframe->layer);
+        dxf_free (oleframe->dictionary_owner_soft);
+        dxf_free (oleframe->dictionary_owner_hard);
+        dxf_binary_data_free_list (oleframe->binary_data);
+        dxf_free (oleframe);
         oleframe = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -572,18 +550,19 @@ dxf_oleframe_free_list
                  * \c OLEFRAME entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (oleframes == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (oleframes != NULL)
         {
                 DxfOleFrame *iter = (DxfOleFrame *) oleframes->next;
+                oleframes->next = NULL;
                 dxf_oleframe_free (oleframes);
                 oleframes = (DxfOleFrame *) iter;
         }
@@ -701,7 +680,7 @@ dxf_oleframe_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (oleframe->linetype));
+        return (dxf_strdup (oleframe->linetype));
 }
 
 
@@ -735,7 +714,7 @@ dxf_oleframe_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        oleframe->linetype = strdup (linetype);
+        oleframe->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -776,7 +755,7 @@ dxf_oleframe_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (oleframe->layer));
+        return (dxf_strdup (oleframe->layer));
 }
 
 
@@ -810,7 +789,7 @@ dxf_oleframe_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        oleframe->layer = strdup (layer);
+        oleframe->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1566,7 +1545,7 @@ dxf_oleframe_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (oleframe->dictionary_owner_soft));
+        return (dxf_strdup (oleframe->dictionary_owner_soft));
 }
 
 
@@ -1602,7 +1581,7 @@ dxf_oleframe_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        oleframe->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        oleframe->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1646,7 +1625,7 @@ dxf_oleframe_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (oleframe->material));
+        return (dxf_strdup (oleframe->material));
 }
 
 
@@ -1685,7 +1664,7 @@ dxf_oleframe_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        oleframe->material = strdup (material);
+        oleframe->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1729,7 +1708,7 @@ dxf_oleframe_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (oleframe->dictionary_owner_hard));
+        return (dxf_strdup (oleframe->dictionary_owner_hard));
 }
 
 
@@ -1765,7 +1744,7 @@ dxf_oleframe_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        oleframe->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        oleframe->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1872,7 +1851,7 @@ dxf_oleframe_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (oleframe->plot_style_name));
+        return (dxf_strdup (oleframe->plot_style_name));
 }
 
 
@@ -1910,7 +1889,7 @@ dxf_oleframe_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        oleframe->plot_style_name = strdup (plot_style_name);
+        oleframe->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2017,7 +1996,7 @@ dxf_oleframe_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (oleframe->color_name));
+        return (dxf_strdup (oleframe->color_name));
 }
 
 
@@ -2055,7 +2034,7 @@ dxf_oleframe_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        oleframe->color_name = strdup (color_name);
+        oleframe->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2274,7 +2253,7 @@ dxf_oleframe_set_length
  *
  * \warning No deep copy of the returned pointer is made.
  */
-DxfChar *
+DxfBinaryData *
 dxf_oleframe_get_binary_data
 (
         DxfOleFrame *oleframe
@@ -2319,7 +2298,7 @@ dxf_oleframe_set_binary_data
 (
         DxfOleFrame *oleframe,
                 /*!< a pointer to a DXF \c OLEFRAME entity. */
-        DxfChar *binary_data
+        DxfBinaryData *binary_data
                 /*!< the \c binary_data for the entity. */
 )
 {
@@ -191,8 +191,9 @@ dxf_oleframe_struct
         long length;
                 /*!< Length of binary data.\n
                  * Group code = 90. */
-        DxfChar *binary_data;
-                /*!< Binary data (multiple lines).\n
+        DxfBinaryData *binary_data;
+                /*!< Binary data (multiple lines), decoded into
+                 * contiguous bytes.\n
                  * Group code = 310. */
         struct DxfOleFrame *next;
                 /*!< Pointer to the next DxfOleFrame.\n
@@ -250,8 +251,8 @@ int dxf_oleframe_get_ole_version_number (DxfOleFrame *oleframe);
 DxfOleFrame *dxf_oleframe_set_ole_version_number (DxfOleFrame *oleframe, int ole_version_number);
 long dxf_oleframe_get_length (DxfOleFrame *oleframe);
 DxfOleFrame *dxf_oleframe_set_length (DxfOleFrame *oleframe, long length);
-DxfChar *dxf_oleframe_get_binary_data (DxfOleFrame *oleframe);
-DxfOleFrame *dxf_oleframe_set_binary_data (DxfOleFrame *oleframe, DxfChar *binary_data);
+DxfBinaryData *dxf_oleframe_get_binary_data (DxfOleFrame *oleframe);
+DxfOleFrame *dxf_oleframe_set_binary_data (DxfOleFrame *oleframe, DxfBinaryData *binary_data);
 DxfOleFrame *dxf_oleframe_get_next (DxfOleFrame *oleframe);
 DxfOleFrame *dxf_oleframe_set_next (DxfOleFrame *oleframe, DxfOleFrame *next);
 DxfOleFrame *dxf_oleframe_get_last (DxfOleFrame *oleframe);
@@ -0,0 +1,607 @@
+/*!
+ * \file parser.c
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for the libDXF push parser.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "parser.h"
+#include "file.h"
+#include "section.h"
+#include "stats.h"
+
+
+/*!
+ * \brief Open a stream reading \c size bytes of \c data.
+ *
+ * Without fmemopen () (Windows) the data is copied to a temporary
+ * file.
+ */
+static FILE *
+dxf_parser_open_stream
+(
+        char *data,
+        size_t size
+)
+{
+#if defined (_WIN32)
+        FILE *fp;
+
+        fp = tmpfile ();
+        if (fp == NULL)
+        {
+                return (NULL);
+        }
+        if (fwrite (data, 1, size, fp) != size)
+        {
+                fclose (fp);
+                return (NULL);
+        }
+        rewind (fp);
+        return (fp);
+#else
+        return (fmemopen (data, size, "r"));
+#endif
+}
+
+
+/*!
+ * \brief Parse the received data up to offset \c end in the buffer of
+ * \c parser, and continue after it.
+ *
+ * Inside the \c ENTITIES section the data holds the group codes of
+ * the entity named \c parser->entity_name, followed by the group code
+ * \c 0 and the name of the next entity.\n
+ * Inside other sections the data holds the section from the section
+ * name up to and including the \c ENDSEC marker.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_parser_parse
+(
+        DxfParser *parser,
+        size_t end
+)
+{
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int result = EXIT_SUCCESS;
+
+        /* dxf_read_line () skips the white space following the previous
+         * line, the readers expect the group code without it. */
+        while ((parser->unit_start < end)
+          && isspace ((unsigned char) parser->buffer[parser->unit_start]))
+        {
+                parser->unit_start++;
+        }
+        if (end > parser->unit_start)
+        {
+                parser->fp->fp = dxf_parser_open_stream (parser->buffer
+                  + parser->unit_start, end - parser->unit_start);
+                if (parser->fp->fp == NULL)
+                {
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not open a stream over the received data.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                parser->fp->line_number = parser->unit_line_number;
+                if (parser->state == DXF_PARSER_ENTITIES)
+                {
+                        memset (temp_string, 0, sizeof (temp_string));
+                        strcpy (temp_string, parser->entity_name);
+                        result = dxf_entities_read_next (parser->fp,
+                          (DxfEntities *) parser->drawing->entities_list,
+                          parser->last, temp_string);
+                }
+                else
+                {
+                        result = dxf_section_read (parser->fp, parser->drawing);
+                }
+                fclose (parser->fp->fp);
+                parser->fp->fp = NULL;
+        }
+        parser->unit_start = end;
+        parser->unit_line_number = parser->line_number;
+        return (result);
+}
+
+
+/*!
+ * \brief Handle a group code and value pair received by \c parser.
+ *
+ * The pair ends at offset \c end in the buffer of \c parser.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_parser_pair
+(
+        DxfParser *parser,
+        const char *value,
+        size_t end
+)
+{
+        int result = EXIT_SUCCESS;
+
+        switch (parser->state)
+        {
+                case DXF_PARSER_OUTSIDE:
+                        if (parser->group_code == 999)
+                        {
+                                fprintf (stdout, "DXF comment: %s\n", value);
+                        }
+                        else if ((parser->group_code == 0)
+                          && (strcmp (value, "SECTION") == 0))
+                        {
+                                parser->state = DXF_PARSER_SECTION_NAME;
+                        }
+                        else if ((parser->group_code == 0)
+                          && (strcmp (value, "EOF") == 0))
+                        {
+                                parser->state = DXF_PARSER_DONE;
+                        }
+                        else
+                        {
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
+                                  (_("Warning: in line %d \"SECTION\" was expected, \"%s\" was found.\n")),
+                                  parser->line_number, value);
+                        }
+                        parser->unit_start = end;
+                        parser->unit_line_number = parser->line_number;
+                        break;
+                case DXF_PARSER_SECTION_NAME:
+                        if ((parser->group_code == 2)
+                          && (strcmp (value, "ENTITIES") == 0))
+                        {
+                                if (parser->drawing->entities_list == NULL)
+                                {
+                                        parser->drawing->entities_list = (struct DxfEntities *) dxf_entities_new ();
+                                }
+                                if (parser->drawing->entities_list == NULL)
+                                {
+                                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                                          (_("Error in %s () could not allocate memory.\n")),
+                                          __FUNCTION__);
+                                        return (EXIT_FAILURE);
+                                }
+                                dxf_entities_find_last ((DxfEntities *) parser->drawing->entities_list,
+                                  parser->last);
+                                DXF_TRACE_BEGIN (DXF_TRACING_SECTION,
+                                  dxf_stats_get_section_name (DXF_STATS_SECTION_ENTITIES));
+                                if (parser->fp->stats != NULL)
+                                {
+                                        parser->fp->stats->section_count[DXF_STATS_SECTION_ENTITIES]++;
+                                }
+                                parser->entity_name[0] = '\0';
+                                parser->in_polyline = FALSE;
+                                parser->state = DXF_PARSER_ENTITIES;
+                                parser->unit_start = end;
+                                parser->unit_line_number = parser->line_number;
+                                break;
+                        }
+                        /* The section name is parsed with the
+                         * section. */
+                        parser->state = DXF_PARSER_SECTION;
+                        /* Fall through. */
+                case DXF_PARSER_SECTION:
+                        if ((parser->group_code == 0)
+                          && (strcmp (value, "ENDSEC") == 0))
+                        {
+                                result = dxf_parser_parse (parser, end);
+                                parser->state = DXF_PARSER_OUTSIDE;
+                        }
+                        break;
+                case DXF_PARSER_ENTITIES:
+                        if (parser->group_code != 0)
+                        {
+                                break;
+                        }
+                        if (parser->entity_name[0] == '\0')
+                        {
+                                /* The first entity, or ENDSEC. */
+                                strcpy (parser->entity_name, value);
+                                parser->unit_start = end;
+                                parser->unit_line_number = parser->line_number;
+                        }
+                        else if (parser->in_polyline
+                          && ((strcmp (value, "VERTEX") == 0)
+                          || (strcmp (value, "SEQEND") == 0)))
+                        {
+                                /* The vertices are read with the
+                                 * POLYLINE entity. */
+                                break;
+                        }
+                        else
+                        {
+                                result = dxf_parser_parse (parser, end);
+                                /* Continue with the entity found by
+                                 * the split, whatever the reader
+                                 * consumed. */
+                                strcpy (parser->entity_name, value);
+                        }
+                        parser->in_polyline = (strcmp (parser->entity_name, "POLYLINE") == 0);
+                        if (strcmp (parser->entity_name, "ENDSEC") == 0)
+                        {
+                                DXF_TRACE_END (DXF_TRACING_SECTION,
+                                  dxf_stats_get_section_name (DXF_STATS_SECTION_ENTITIES));
+                                parser->entity_name[0] = '\0';
+                                parser->state = DXF_PARSER_OUTSIDE;
+                        }
+                        break;
+                case DXF_PARSER_DONE:
+                default:
+                        parser->unit_start = end;
+                        parser->unit_line_number = parser->line_number;
+                        break;
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Split the received data of \c parser into lines and handle
+ * every complete group code and value pair.
+ *
+ * An empty line is an empty value.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_parser_split
+(
+        DxfParser *parser
+)
+{
+        char value[DXF_MAX_STRING_LENGTH];
+        char *newline;
+        size_t first;
+        size_t last;
+        size_t end;
+        size_t size;
+        int result = EXIT_SUCCESS;
+
+        while ((parser->scan < parser->length)
+          && ((newline = memchr (parser->buffer + parser->scan, '\n',
+          parser->length - parser->scan)) != NULL))
+        {
+                first = parser->scan;
+                end = (size_t) (newline - parser->buffer) + 1;
+                parser->scan = end;
+                while ((first < end) && isspace ((unsigned char) parser->buffer[first]))
+                {
+                        first++;
+                }
+                last = end;
+                while ((last > first) && isspace ((unsigned char) parser->buffer[last - 1]))
+                {
+                        last--;
+                }
+                parser->line_number++;
+                size = last - first;
+                if (size > DXF_MAX_STRING_LENGTH - 1)
+                {
+                        size = DXF_MAX_STRING_LENGTH - 1;
+                }
+                memcpy (value, parser->buffer + first, size);
+                value[size] = '\0';
+                if (parser->code_line)
+                {
+                        parser->group_code = atoi (value);
+                        parser->code_line = FALSE;
+                }
+                else
+                {
+                        parser->code_line = TRUE;
+                        if (dxf_parser_pair (parser, value, end) != EXIT_SUCCESS)
+                        {
+                                result = EXIT_FAILURE;
+                        }
+                }
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Open a libDXF push parser storing the parsed data in
+ * \c drawing.
+ *
+ * \return a pointer to the parser, or \c NULL when an error occurred.
+ */
+DxfParser *
+dxf_parser_open
+(
+        DxfDrawing *drawing
+                /*!< a pointer to the libDXF drawing receiving the
+                 * parsed data. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfParser *parser = NULL;
+
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        parser = dxf_malloc (sizeof (DxfParser));
+        if (parser == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (parser, 0, sizeof (DxfParser));
+        parser->fp = dxf_malloc (sizeof (DxfFile));
+        if (parser->fp == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_free (parser);
+                return (NULL);
+        }
+        memset (parser->fp, 0, sizeof (DxfFile));
+        parser->drawing = drawing;
+        parser->state = DXF_PARSER_OUTSIDE;
+        parser->code_line = TRUE;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (parser);
+}
+
+
+/*!
+ * \brief Get the DXF file handle of a libDXF push parser.
+ *
+ * The file handle can be passed to dxf_file_set_stats (),
+ * dxf_file_set_acis_mode () and dxf_file_set_entity_callback () before
+ * the first data is fed.\n
+ * Its stream is only valid while data is parsed.
+ *
+ * \return a pointer to the DXF file handle, or \c NULL when an error
+ * occurred.
+ */
+DxfFile *
+dxf_parser_get_file
+(
+        DxfParser *parser
+                /*!< a pointer to a libDXF push parser. */
+)
+{
+        /* Do some basic checks. */
+        if (parser == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        return (parser->fp);
+}
+
+
+/*!
+ * \brief Feed the next chunk of a DXF file to a libDXF push parser.
+ *
+ * The chunk may end anywhere, the data not parsed yet is kept until
+ * the next chunk arrives.\n
+ * Only the entity or section being received is buffered.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_parser_feed
+(
+        DxfParser *parser,
+                /*!< a pointer to a libDXF push parser. */
+        const char *data,
+                /*!< the next chunk of the DXF file. */
+        size_t size
+                /*!< number of bytes in \c data. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char *buffer;
+        size_t capacity;
+        int result;
+
+        /* Do some basic checks. */
+        if ((parser == NULL) || ((data == NULL) && (size > 0)))
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        parser->bytes_received += (int64_t) size;
+        if ((parser->state == DXF_PARSER_DONE) || (size == 0))
+        {
+                return (EXIT_SUCCESS);
+        }
+        if (parser->length + size > parser->capacity)
+        {
+                capacity = (parser->capacity > 0)
+                  ? parser->capacity : DXF_PARSER_BUFFER_SIZE;
+                while (capacity < parser->length + size)
+                {
+                        capacity *= 2;
+                }
+                buffer = dxf_realloc (parser->buffer, capacity);
+                if (buffer == NULL)
+                {
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                parser->buffer = buffer;
+                parser->capacity = capacity;
+        }
+        memcpy (parser->buffer + parser->length, data, size);
+        parser->length += size;
+        result = dxf_parser_split (parser);
+        /* Drop the parsed data. */
+        if (parser->unit_start > 0)
+        {
+                memmove (parser->buffer, parser->buffer + parser->unit_start,
+                  parser->length - parser->unit_start);
+                parser->length -= parser->unit_start;
+                parser->scan -= parser->unit_start;
+                parser->unit_start = 0;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Close a libDXF push parser after the last chunk was fed.
+ *
+ * The data still buffered is parsed, the handles of the drawing are
+ * scanned as dxf_file_read_drawing () does and the parser is freed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred or the DXF file was truncated inside a section.
+ */
+int
+dxf_parser_close
+(
+        DxfParser *parser
+                /*!< a pointer to a libDXF push parser. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int result = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if (parser == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        /* The last line may lack a line feed. */
+        if ((parser->state != DXF_PARSER_DONE)
+          && (parser->scan < parser->length)
+          && (dxf_parser_feed (parser, "\n", 1) != EXIT_SUCCESS))
+        {
+                result = EXIT_FAILURE;
+        }
+        if ((parser->state == DXF_PARSER_SECTION_NAME)
+          || (parser->state == DXF_PARSER_SECTION)
+          || (parser->state == DXF_PARSER_ENTITIES))
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
+                  (_("Warning in %s () the DXF data ended inside a section in line %d.\n")),
+                  __FUNCTION__, parser->line_number);
+                if ((parser->state == DXF_PARSER_SECTION)
+                  || ((parser->state == DXF_PARSER_ENTITIES)
+                  && (parser->entity_name[0] != '\0')))
+                {
+                        dxf_parser_parse (parser, parser->length);
+                }
+                result = EXIT_FAILURE;
+        }
+        if (parser->fp->stats != NULL)
+        {
+                parser->fp->stats->bytes_read = parser->bytes_received;
+                parser->fp->stats->lines_read = parser->line_number;
+        }
+        if (result == EXIT_SUCCESS)
+        {
+                dxf_drawing_scan_handles (parser->drawing);
+        }
+        dxf_parser_free (parser);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a libDXF push parser.
+ *
+ * The data still buffered is discarded, use dxf_parser_close () to
+ * parse it.\n
+ * The drawing is not freed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_parser_free
+(
+        DxfParser *parser
+                /*!< a pointer to a libDXF push parser. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (parser == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_free (parser->buffer);
+        dxf_free (parser->fp);
+        dxf_free (parser);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/* EOF */
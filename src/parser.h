@@ -0,0 +1,143 @@
+/*!
+ * \file parser.h
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for the libDXF push parser.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_PARSER_H
+#define LIBDXF_SRC_PARSER_H
+
+
+#include "global.h"
+#include "drawing.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_PARSER_BUFFER_SIZE 65536
+        /*!< \brief Initial size of the buffer of a push parser. */
+
+
+/*!
+ * \brief Position of a libDXF push parser in the DXF file.
+ */
+typedef enum
+dxf_parser_state
+{
+        DXF_PARSER_OUTSIDE,
+                /*!< Between sections. */
+        DXF_PARSER_SECTION_NAME,
+                /*!< After a \c SECTION marker, before the section
+                 * name. */
+        DXF_PARSER_SECTION,
+                /*!< Inside a section other than \c ENTITIES. */
+        DXF_PARSER_ENTITIES,
+                /*!< Inside the \c ENTITIES section. */
+        DXF_PARSER_DONE
+                /*!< After the \c EOF marker. */
+} DxfParserState;
+
+
+/*!
+ * \brief Definition of a libDXF push parser.
+ *
+ * A push parser reads a DXF file from chunks of arbitrary size, as
+ * they arrive, with dxf_parser_feed ().\n
+ * The chunks are split into group code and value pairs, a chunk may end
+ * anywhere, also within a group code or a value.\n
+ * Every entity of the \c ENTITIES section is parsed as soon as the
+ * group code \c 0 following it has arrived, other sections are parsed
+ * when their \c ENDSEC marker has arrived.\n
+ * The data is parsed with the same functions as a file read by
+ * dxf_file_read_drawing (), an entity callback set on the file handle
+ * returned by dxf_parser_get_file () is invoked in the same order.
+ */
+typedef struct
+dxf_parser_struct
+{
+        DxfFile *fp;
+                /*!< DXF file handle passed to the readers, \c fp->fp
+                 * is a stream over the data being parsed. */
+        DxfDrawing *drawing;
+                /*!< The drawing receiving the parsed data. */
+        DxfParserState state;
+                /*!< Position in the DXF file. */
+        char *buffer;
+                /*!< Data received and not parsed yet. */
+        size_t length;
+                /*!< Number of bytes in \c buffer. */
+        size_t capacity;
+                /*!< Allocated size of \c buffer. */
+        size_t scan;
+                /*!< Offset in \c buffer of the first byte not split
+                 * into lines yet. */
+        size_t unit_start;
+                /*!< Offset in \c buffer of the data not parsed yet. */
+        int unit_line_number;
+                /*!< Number of lines before \c unit_start. */
+        int line_number;
+                /*!< Number of lines split from the received data. */
+        int code_line;
+                /*!< \c TRUE when the next line holds a group code. */
+        int group_code;
+                /*!< The last group code. */
+        char entity_name[DXF_MAX_STRING_LENGTH];
+                /*!< Name of the entity being received, an empty
+                 * string at the start of the \c ENTITIES section. */
+        int in_polyline;
+                /*!< \c TRUE while the \c VERTEX and \c SEQEND entities
+                 * of a \c POLYLINE entity are received. */
+        void *last[DXF_STATS_NUMBER_OF_ENTITY_TYPES];
+                /*!< Last entity of every list of the drawing. */
+        int64_t bytes_received;
+                /*!< Number of bytes received. */
+} DxfParser;
+
+
+DxfParser *dxf_parser_open (DxfDrawing *drawing);
+DxfFile *dxf_parser_get_file (DxfParser *parser);
+int dxf_parser_feed (DxfParser *parser, const char *data, size_t size);
+int dxf_parser_close (DxfParser *parser);
+int dxf_parser_free (DxfParser *parser);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_PARSER_H */
+
+
+/* EOF */
@@ -57,6 +57,7 @@
 
 
 #include "point.h"
+#include "util.h"
 
 
 /*!
@@ -76,7 +77,7 @@ dxf_point_new ()
         size = sizeof (DxfPoint);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((point = malloc (size)) == NULL)
+        if ((point = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfPoint struct.\n")),
@@ -113,21 +114,21 @@ dxf_point_init
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 point = dxf_point_new ();
         }
         if (point == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfPoint struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         point->id_code = 0;
-        point->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        point->layer = strdup (DXF_DEFAULT_LAYER);
+        point->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        point->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         point->elevation = 0.0;
         point->thickness = 0.0;
         point->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -138,14 +139,14 @@ dxf_point_init
         point->shadow_mode = 0;
         point->binary_graphics_data = (DxfBinaryData *) dxf_binary_data_new ();
         point->binary_graphics_data = (DxfBinaryData *) dxf_binary_data_init (point->binary_graphics_data);
-        point->dictionary_owner_soft = strdup ("");
-        point->object_owner_soft = strdup ("");
-        point->material = strdup ("");
-        point->dictionary_owner_hard = strdup ("");
+        point->dictionary_owner_soft = dxf_strdup ("");
+        point->object_owner_soft = dxf_strdup ("");
+        point->material = dxf_strdup ("");
+        point->dictionary_owner_hard = dxf_strdup ("");
         point->lineweight = 0;
-        point->plot_style_name = strdup ("");
+        point->plot_style_name = dxf_strdup ("");
         point->color_value = 0;
-        point->color_name = strdup ("");
+        point->color_name = dxf_strdup ("");
         point->transparency = 0;
         point->x0 = 0.0;
         point->y0 = 0.0;
@@ -186,41 +187,35 @@ dxf_point_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int iter330;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (point == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 point = dxf_point_init (point);
         }
-        iter310 = (DxfBinaryData *) point->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        memset (temp_string, 0, sizeof (temp_string));
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -235,13 +230,17 @@ dxf_point_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, point->linetype);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (point->linetype);
+                        point->linetype = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, point->layer);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (point->layer);
+                        point->layer = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -332,7 +331,7 @@ dxf_point_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbPoint") != 0)))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -377,9 +376,8 @@ dxf_point_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_data_append_hex ((DxfBinaryData *) point->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -388,14 +386,18 @@ dxf_point_read
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
                                 (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, point->dictionary_owner_soft);
+                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                                dxf_free (point->dictionary_owner_soft);
+                                point->dictionary_owner_soft = dxf_strdup (temp_string);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
                                 (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, point->object_owner_soft);
+                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                                dxf_free (point->object_owner_soft);
+                                point->object_owner_soft = dxf_strdup (temp_string);
                         }
                         iter330++;
                 }
@@ -404,14 +406,18 @@ dxf_point_read
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, point->material);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (point->material);
+                        point->material = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, point->dictionary_owner_hard);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (point->dictionary_owner_hard);
+                        point->dictionary_owner_hard = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -425,7 +431,9 @@ dxf_point_read
                         /* Now follows a string containing a plot style
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, point->plot_style_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (point->plot_style_name);
+                        point->plot_style_name = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -456,22 +464,25 @@ dxf_point_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning: in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
+                        dxf_read_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (point->linetype, "") == 0)
         {
-                point->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_free (point->linetype);
+                point->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (point->layer, "") == 0)
         {
-                point->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_free (point->layer);
+                point->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -497,47 +508,47 @@ dxf_point_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("POINT");
+        char *dxf_entity_name = dxf_strdup ("POINT");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (point == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (point->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, point->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                point->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                point->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (point->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name,
                         point->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                point->layer = strdup (DXF_DEFAULT_LAYER);
+                point->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -620,16 +631,7 @@ dxf_point_write
 #else
                 fprintf (fp->fp, " 92\n%" PRIi32 "\n", point->graphics_data_size);
 #endif
-                if (point->binary_graphics_data != NULL)
-                {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) point->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
-                }
+                dxf_binary_data_write (fp, (DxfBinaryData *) point->binary_graphics_data);
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
@@ -660,7 +662,7 @@ dxf_point_write
         }
         fprintf (fp->fp, " 50\n%f\n", point->angle_to_X);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -689,23 +691,31 @@ dxf_point_free
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (point->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (point->linetype);
-        free (point->layer);
-        free (point->dictionary_owner_soft);
-        free (point->dictionary_owner_hard);
-        free (point);
+        dxf_free (point->linetype);
+        dxf_free (point->layer);
+        if (point->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (point->binary_graphics_data);
+        }
+        dxf_free (point->dictionary_owner_soft);
+        dxf_free (point->object_owner_soft);
+        dxf_free (point->material);
+        dxf_free (point->dictionary_owner_hard);
+        dxf_free (point->plot_style_name);
+        dxf_free (point->color_name);
+        dxf_free (point);
         point = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -726,18 +736,19 @@ dxf_point_free_list
                  * \c POINT entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (points == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (points != NULL)
         {
                 DxfPoint *iter = (DxfPoint *) points->next;
+                points->next = NULL;
                 dxf_point_free (points);
                 points = (DxfPoint *) iter;
         }
@@ -858,7 +869,7 @@ dxf_point_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (point->linetype));
+        return (dxf_strdup (point->linetype));
 }
 
 
@@ -895,7 +906,7 @@ dxf_point_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        point->linetype = strdup (linetype);
+        point->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -936,7 +947,7 @@ dxf_point_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (point->layer));
+        return (dxf_strdup (point->layer));
 }
 
 
@@ -973,7 +984,7 @@ dxf_point_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        point->layer = strdup (layer);
+        point->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1750,7 +1761,7 @@ dxf_point_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (point->dictionary_owner_soft));
+        return (dxf_strdup (point->dictionary_owner_soft));
 }
 
 
@@ -1789,7 +1800,7 @@ dxf_point_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        point->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        point->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1833,7 +1844,7 @@ dxf_point_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (point->material));
+        return (dxf_strdup (point->material));
 }
 
 
@@ -1871,7 +1882,7 @@ dxf_point_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        point->material = strdup (material);
+        point->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1915,7 +1926,7 @@ dxf_point_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (point->dictionary_owner_hard));
+        return (dxf_strdup (point->dictionary_owner_hard));
 }
 
 
@@ -1954,7 +1965,7 @@ dxf_point_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        point->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        point->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2061,7 +2072,7 @@ dxf_point_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (point->plot_style_name));
+        return (dxf_strdup (point->plot_style_name));
 }
 
 
@@ -2099,7 +2110,7 @@ dxf_point_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        point->plot_style_name = strdup (plot_style_name);
+        point->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2206,7 +2217,7 @@ dxf_point_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (point->color_name));
+        return (dxf_strdup (point->color_name));
 }
 
 
@@ -2244,7 +2255,7 @@ dxf_point_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        point->color_name = strdup (color_name);
+        point->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2591,7 +2602,7 @@ dxf_point_get_extrusion_vector_as_point
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *result = NULL;
@@ -42,6 +42,7 @@
 
 
 #include "polyline.h"
+#include "util.h"
 
 
 /*!
@@ -61,7 +62,7 @@ dxf_polyline_new ()
         size = sizeof (DxfPolyline);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((polyline = malloc (size)) == NULL)
+        if ((polyline = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfArc struct.\n")),
@@ -98,21 +99,21 @@ dxf_polyline_init
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 polyline = dxf_polyline_new ();
         }
         if (polyline == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfPolyline struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         dxf_polyline_set_id_code (polyline, 0);
-        dxf_polyline_set_linetype (polyline, strdup (DXF_DEFAULT_LINETYPE));
-        dxf_polyline_set_layer (polyline, strdup (DXF_DEFAULT_LAYER));
+        dxf_polyline_set_linetype (polyline, dxf_strdup (DXF_DEFAULT_LINETYPE));
+        dxf_polyline_set_layer (polyline, dxf_strdup (DXF_DEFAULT_LAYER));
         dxf_polyline_set_elevation (polyline, 0.0);
         dxf_polyline_set_thickness (polyline, 0.0);
         dxf_polyline_set_linetype_scale (polyline, DXF_DEFAULT_LINETYPE_SCALE);
@@ -122,13 +123,13 @@ dxf_polyline_init
         dxf_polyline_set_graphics_data_size (polyline, 0);
         dxf_polyline_set_shadow_mode (polyline, 0);
         dxf_polyline_set_binary_graphics_data (polyline, (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ());
-        dxf_polyline_set_dictionary_owner_soft (polyline, strdup (""));
-        dxf_polyline_set_material (polyline, strdup (""));
-        dxf_polyline_set_dictionary_owner_hard (polyline, strdup (""));
+        dxf_polyline_set_dictionary_owner_soft (polyline, dxf_strdup (""));
+        dxf_polyline_set_material (polyline, dxf_strdup (""));
+        dxf_polyline_set_dictionary_owner_hard (polyline, dxf_strdup (""));
         dxf_polyline_set_lineweight (polyline, 0);
-        dxf_polyline_set_plot_style_name (polyline, strdup (""));
+        dxf_polyline_set_plot_style_name (polyline, dxf_strdup (""));
         dxf_polyline_set_color_value (polyline, 0);
-        dxf_polyline_set_color_name (polyline, strdup (""));
+        dxf_polyline_set_color_name (polyline, dxf_strdup (""));
         dxf_polyline_set_transparency (polyline, 0);
         dxf_polyline_set_p0 (polyline, (DxfPoint *) dxf_point_new ());
         dxf_point_init ((DxfPoint *) dxf_polyline_get_p0 (polyline));
@@ -182,37 +183,33 @@ dxf_polyline_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 polyline = dxf_polyline_init (polyline);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        memset (temp_string, 0, sizeof (temp_string));
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -227,13 +224,17 @@ dxf_polyline_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, polyline->linetype);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (polyline->linetype);
+                        polyline->linetype = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, polyline->layer);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (polyline->layer);
+                        polyline->layer = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -397,14 +398,18 @@ dxf_polyline_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, polyline->dictionary_owner_soft);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (polyline->dictionary_owner_soft);
+                        polyline->dictionary_owner_soft = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, polyline->dictionary_owner_hard);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (polyline->dictionary_owner_hard);
+                        polyline->dictionary_owner_hard = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -415,22 +420,23 @@ dxf_polyline_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
+                        dxf_read_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (dxf_polyline_get_linetype (polyline), "") == 0)
         {
-                dxf_polyline_set_linetype (polyline, strdup (DXF_DEFAULT_LINETYPE));
+                dxf_polyline_set_linetype (polyline, dxf_strdup (DXF_DEFAULT_LINETYPE));
         }
         if (strcmp (dxf_polyline_get_layer (polyline), "") == 0)
         {
-                dxf_polyline_set_layer (polyline, strdup (DXF_DEFAULT_LAYER));
+                dxf_polyline_set_layer (polyline, dxf_strdup (DXF_DEFAULT_LAYER));
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -456,74 +462,74 @@ dxf_polyline_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("POLYLINE");
+        char *dxf_entity_name = dxf_strdup ("POLYLINE");
         DxfVertex *iter = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dxf_polyline_get_x0 (polyline) != 0.0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () start point has an invalid X-value for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_polyline_get_id_code (polyline));
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dxf_polyline_get_y0 (polyline) != 0.0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () start point has an invalid Y-value for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_polyline_get_id_code (polyline));
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dxf_polyline_get_vertices_follow (polyline) != 1)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () vertices follow flag has an invalid value for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_polyline_get_id_code (polyline));
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (dxf_polyline_get_linetype (polyline), "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_polyline_get_id_code (polyline));
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                dxf_polyline_set_linetype (polyline, strdup (DXF_DEFAULT_LINETYPE));
+                dxf_polyline_set_linetype (polyline, dxf_strdup (DXF_DEFAULT_LINETYPE));
         }
         if (strcmp (dxf_polyline_get_layer (polyline), "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_polyline_get_id_code (polyline));
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                dxf_polyline_set_layer (polyline, strdup (DXF_DEFAULT_LAYER));
+                dxf_polyline_set_layer (polyline, dxf_strdup (DXF_DEFAULT_LAYER));
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -633,7 +639,7 @@ dxf_polyline_write
         }
         dxf_vertex_free (iter);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -662,29 +668,29 @@ dxf_polyline_free
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (dxf_polyline_get_linetype (polyline));
-        free (dxf_polyline_get_layer (polyline));
+        dxf_free (dxf_polyline_get_linetype (polyline));
+        dxf_free (dxf_polyline_get_layer (polyline));
         dxf_binary_graphics_data_free_list (dxf_polyline_get_binary_graphics_data (polyline));
-        free (dxf_polyline_get_dictionary_owner_soft (polyline));
-        free (dxf_polyline_get_material (polyline));
-        free (dxf_polyline_get_dictionary_owner_hard (polyline));
-        free (dxf_polyline_get_plot_style_name (polyline));
-        free (dxf_polyline_get_color_name (polyline));
+        dxf_free (dxf_polyline_get_dictionary_owner_soft (polyline));
+        dxf_free (dxf_polyline_get_material (polyline));
+        dxf_free (dxf_polyline_get_dictionary_owner_hard (polyline));
+        dxf_free (dxf_polyline_get_plot_style_name (polyline));
+        dxf_free (dxf_polyline_get_color_name (polyline));
         dxf_point_free (dxf_polyline_get_p0 (polyline));
         dxf_vertex_free_list (dxf_polyline_get_vertices (polyline));
-        free (polyline);
+        dxf_free (polyline);
         polyline = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -705,18 +711,19 @@ dxf_polyline_free_list
                  * \c POLYLINE entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (polylines == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (polylines != NULL)
         {
                 DxfPolyline *iter = (DxfPolyline *) polylines->next;
+                polylines->next = NULL;
                 dxf_polyline_free (polylines);
                 polylines = (DxfPolyline *) iter;
         }
@@ -838,7 +845,7 @@ dxf_polyline_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (polyline->linetype));
+        return (dxf_strdup (polyline->linetype));
 }
 
 
@@ -878,7 +885,7 @@ dxf_polyline_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->linetype = strdup (linetype);
+        polyline->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -920,7 +927,7 @@ dxf_polyline_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (polyline->layer));
+        return (dxf_strdup (polyline->layer));
 }
 
 
@@ -959,7 +966,7 @@ dxf_polyline_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->layer = strdup (layer);
+        polyline->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1746,7 +1753,7 @@ dxf_polyline_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (polyline->dictionary_owner_soft));
+        return (dxf_strdup (polyline->dictionary_owner_soft));
 }
 
 
@@ -1782,7 +1789,7 @@ dxf_polyline_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        polyline->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1827,7 +1834,7 @@ dxf_polyline_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (polyline->material));
+        return (dxf_strdup (polyline->material));
 }
 
 
@@ -1866,7 +1873,7 @@ dxf_polyline_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->material = strdup (material);
+        polyline->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1910,7 +1917,7 @@ dxf_polyline_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (polyline->dictionary_owner_hard));
+        return (dxf_strdup (polyline->dictionary_owner_hard));
 }
 
 
@@ -1949,7 +1956,7 @@ dxf_polyline_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        polyline->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2056,7 +2063,7 @@ dxf_polyline_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (polyline->plot_style_name));
+        return (dxf_strdup (polyline->plot_style_name));
 }
 
 
@@ -2094,7 +2101,7 @@ dxf_polyline_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->plot_style_name = strdup (plot_style_name);
+        polyline->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2201,7 +2208,7 @@ dxf_polyline_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (polyline->color_name));
+        return (dxf_strdup (polyline->color_name));
 }
 
 
@@ -2239,7 +2246,7 @@ dxf_polyline_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->color_name = strdup (color_name);
+        polyline->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2324,7 +2331,7 @@ dxf_polyline_get_p0
                 /*!< a pointer to a DXF \c POLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2364,7 +2371,7 @@ dxf_polyline_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2403,7 +2410,7 @@ dxf_polyline_get_x0
                 /*!< a pointer to a DXF \c POLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2446,7 +2453,7 @@ dxf_polyline_set_x0
                  * DXF \c POLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2485,7 +2492,7 @@ dxf_polyline_get_y0
                 /*!< a pointer to a DXF \c POLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2528,7 +2535,7 @@ dxf_polyline_set_y0
                  * DXF \c polyline entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2567,7 +2574,7 @@ dxf_polyline_get_z0
                 /*!< a pointer to a DXF \c POLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2610,7 +2617,7 @@ dxf_polyline_set_z0
                  * DXF \c polyline entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2648,7 +2655,7 @@ dxf_polyline_get_start_width
                 /*!< a pointer to a DXF \c POLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2688,7 +2695,7 @@ dxf_polyline_set_start_width
                 /*!< the \c start_width of a DXF \c polyline entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2725,7 +2732,7 @@ dxf_polyline_get_end_width
                 /*!< a pointer to a DXF \c POLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2765,7 +2772,7 @@ dxf_polyline_set_end_width
                 /*!< the \c end_width of a DXF \c polyline entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3352,7 +3359,7 @@ dxf_polyline_get_extr_x0
                 /*!< a pointer to a DXF \c POLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3388,7 +3395,7 @@ dxf_polyline_set_extr_x0
                  * \c POLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3420,7 +3427,7 @@ dxf_polyline_get_extr_y0
                 /*!< a pointer to a DXF \c POLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3456,7 +3463,7 @@ dxf_polyline_set_extr_y0
                  * \c POLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3488,7 +3495,7 @@ dxf_polyline_get_extr_z0
                 /*!< a pointer to a DXF \c POLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3524,7 +3531,7 @@ dxf_polyline_set_extr_z0
                  * \c POLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
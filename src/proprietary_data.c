@@ -53,7 +53,7 @@ dxf_proprietary_data_new ()
         size = sizeof (DxfProprietaryData);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((data = malloc (size)) == NULL)
+        if ((data = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfProprietaryData struct.\n")),
@@ -91,19 +91,19 @@ dxf_proprietary_data_init
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 data = dxf_proprietary_data_new ();
         }
         if (data == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfProprietaryData struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        data->line = strdup ("");
+        data->line = dxf_strdup ("");
         data->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -133,20 +133,20 @@ dxf_proprietary_data_free
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (data->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (data->line);
-        free (data);
+        dxf_free (data->line);
+        dxf_free (data);
         data = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -167,18 +167,19 @@ dxf_proprietary_data_free_list
                  * \c DxfProprietaryData objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (datas == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (datas != NULL)
         {
                 DxfProprietaryData *iter = (DxfProprietaryData *) datas->next;
+                datas->next = NULL;
                 dxf_proprietary_data_free (datas);
                 datas = (DxfProprietaryData *) iter;
         }
@@ -298,7 +299,7 @@ dxf_proprietary_data_get_line
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (data->line));
+        return (dxf_strdup (data->line));
 }
 
 
@@ -335,7 +336,7 @@ dxf_proprietary_data_set_line
                   __FUNCTION__);
                 return (NULL);
         }
-        data->line = strdup (line);
+        data->line = dxf_strdup (line);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -61,7 +61,7 @@ dxf_rastervariables_new ()
         size = sizeof (DxfRasterVariables);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((rastervariables = malloc (size)) == NULL)
+        if ((rastervariables = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfRasterVariables struct.\n")),
@@ -99,21 +99,21 @@ dxf_rastervariables_init
         /* Do some basic checks. */
         if (rastervariables == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 rastervariables = dxf_rastervariables_new ();
         }
         if (rastervariables == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfRasterVariables struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         rastervariables->id_code = 0;
-        rastervariables->dictionary_owner_soft = strdup ("");
-        rastervariables->dictionary_owner_hard = strdup ("");
+        rastervariables->dictionary_owner_soft = dxf_strdup ("");
+        rastervariables->dictionary_owner_hard = dxf_strdup ("");
         rastervariables->display_image_frame = 0;
         rastervariables->display_quality = 0;
         rastervariables->units = 0;
@@ -155,22 +155,22 @@ dxf_rastervariables_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (rastervariables == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 rastervariables = dxf_rastervariables_init (rastervariables);
@@ -182,11 +182,11 @@ dxf_rastervariables_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -234,7 +234,7 @@ dxf_rastervariables_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "AcDbIdBuffer") != 0)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -263,13 +263,14 @@ dxf_rastervariables_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -295,30 +296,30 @@ dxf_rastervariables_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("RASTERVARIABLES");
+        char *dxf_entity_name = dxf_strdup ("RASTERVARIABLES");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (rastervariables == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, rastervariables->id_code);
         }
@@ -361,7 +362,7 @@ dxf_rastervariables_write
         fprintf (fp->fp, " 71\n%d\n", rastervariables->display_quality);
         fprintf (fp->fp, " 72\n%d\n", rastervariables->units);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -390,21 +391,21 @@ dxf_rastervariables_free
         /* Do some basic checks. */
         if (rastervariables == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (rastervariables->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (rastervariables->dictionary_owner_soft);
-        free (rastervariables->dictionary_owner_hard);
-        free (rastervariables);
+        dxf_free (rastervariables->dictionary_owner_soft);
+        dxf_free (rastervariables->dictionary_owner_hard);
+        dxf_free (rastervariables);
         rastervariables = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -425,18 +426,19 @@ dxf_rastervariables_free_list
                  * \c RASTERVARIABLES objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (rastervariables == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (rastervariables != NULL)
         {
                 DxfRasterVariables *iter = (DxfRasterVariables *) rastervariables->next;
+                rastervariables->next = NULL;
                 dxf_rastervariables_free (rastervariables);
                 rastervariables = (DxfRasterVariables *) iter;
         }
@@ -557,7 +559,7 @@ dxf_rastervariables_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rastervariables->dictionary_owner_soft));
+        return (dxf_strdup (rastervariables->dictionary_owner_soft));
 }
 
 
@@ -593,7 +595,7 @@ dxf_rastervariables_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        rastervariables->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        rastervariables->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -637,7 +639,7 @@ dxf_rastervariables_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rastervariables->dictionary_owner_hard));
+        return (dxf_strdup (rastervariables->dictionary_owner_hard));
 }
 
 
@@ -673,7 +675,7 @@ dxf_rastervariables_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        rastervariables->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        rastervariables->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -64,7 +64,7 @@ dxf_ray_new ()
         size = sizeof (DxfRay);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((ray = malloc (size)) == NULL)
+        if ((ray = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfRay struct.\n")),
@@ -101,21 +101,21 @@ dxf_ray_init
         /* Do some basic checks. */
         if (ray == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 ray = dxf_ray_new ();
         }
         if (ray == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfRay struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         ray->id_code = 0;
-        ray->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        ray->layer = strdup (DXF_DEFAULT_LAYER);
+        ray->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        ray->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         ray->elevation = 0.0;
         ray->thickness = 0.0;
         ray->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -126,13 +126,13 @@ dxf_ray_init
         ray->shadow_mode = 0;
         ray->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
         ray->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) ray->binary_graphics_data);
-        ray->dictionary_owner_soft = strdup ("");
-        ray->material = strdup ("");
-        ray->dictionary_owner_hard = strdup ("");
+        ray->dictionary_owner_soft = dxf_strdup ("");
+        ray->material = dxf_strdup ("");
+        ray->dictionary_owner_hard = dxf_strdup ("");
         ray->lineweight = 0;
-        ray->plot_style_name = strdup ("");
+        ray->plot_style_name = dxf_strdup ("");
         ray->color_value = 0;
-        ray->color_name = strdup ("");
+        ray->color_name = dxf_strdup ("");
         ray->transparency = 0;
         ray->p0 = (DxfPoint *) dxf_point_new ();
         ray->p0 = dxf_point_init ((DxfPoint *) ray->p0);
@@ -181,16 +181,16 @@ dxf_ray_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (ray == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 ray = dxf_ray_init (ray);
@@ -201,12 +201,12 @@ dxf_ray_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -325,7 +325,7 @@ dxf_ray_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbRay") != 0)))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -353,22 +353,23 @@ dxf_ray_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (ray->linetype, "") == 0)
         {
-                ray->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                ray->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (ray->layer, "") == 0)
         {
-                ray->layer = strdup (DXF_DEFAULT_LAYER);
+                ray->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -394,64 +395,64 @@ dxf_ray_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("RAY");
+        char *dxf_entity_name = dxf_strdup ("RAY");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (ray == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((ray->p0->x0 == ray->p1->x0)
                 && (ray->p0->y0 == ray->p1->y0)
                 && (ray->p0->z0 == ray->p1->z0))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () start point and end point are identical for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, ray->id_code);
                 dxf_entity_skip (dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (strcmp (ray->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, ray->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                ray->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                ray->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (ray->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, ray->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                ray->layer = strdup (DXF_DEFAULT_LAYER);
+                ray->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -529,7 +530,7 @@ dxf_ray_write
         fprintf (fp->fp, " 21\n%f\n", ray->p1->y0);
         fprintf (fp->fp, " 31\n%f\n", ray->p1->z0);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -558,25 +559,25 @@ dxf_ray_free
         /* Do some basic checks. */
         if (ray == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ray->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (ray->linetype);
-        free (ray->layer);
-        free (ray->dictionary_owner_soft);
-        free (ray->dictionary_owner_hard);
+        dxf_free (ray->linetype);
+        dxf_free (ray->layer);
+        dxf_free (ray->dictionary_owner_soft);
+        dxf_free (ray->dictionary_owner_hard);
         dxf_point_free (ray->p0);
         dxf_point_free (ray->p1);
-        free (ray);
+        dxf_free (ray);
         ray = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -597,18 +598,19 @@ dxf_ray_free_list
                  * \c RAY entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (rays == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (rays != NULL)
         {
                 DxfRay *iter = (DxfRay *) rays->next;
+                rays->next = NULL;
                 dxf_ray_free (rays);
                 rays = (DxfRay *) iter;
         }
@@ -726,7 +728,7 @@ dxf_ray_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ray->linetype));
+        return (dxf_strdup (ray->linetype));
 }
 
 
@@ -761,7 +763,7 @@ dxf_ray_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        ray->linetype = strdup (linetype);
+        ray->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -802,7 +804,7 @@ dxf_ray_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ray->layer));
+        return (dxf_strdup (ray->layer));
 }
 
 
@@ -837,7 +839,7 @@ dxf_ray_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        ray->layer = strdup (layer);
+        ray->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1606,7 +1608,7 @@ dxf_ray_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ray->dictionary_owner_soft));
+        return (dxf_strdup (ray->dictionary_owner_soft));
 }
 
 
@@ -1642,7 +1644,7 @@ dxf_ray_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        ray->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        ray->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1686,7 +1688,7 @@ dxf_ray_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ray->material));
+        return (dxf_strdup (ray->material));
 }
 
 
@@ -1724,7 +1726,7 @@ dxf_ray_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        ray->material = strdup (material);
+        ray->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1768,7 +1770,7 @@ dxf_ray_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ray->dictionary_owner_hard));
+        return (dxf_strdup (ray->dictionary_owner_hard));
 }
 
 
@@ -1804,7 +1806,7 @@ dxf_ray_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        ray->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        ray->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1911,7 +1913,7 @@ dxf_ray_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ray->plot_style_name));
+        return (dxf_strdup (ray->plot_style_name));
 }
 
 
@@ -1949,7 +1951,7 @@ dxf_ray_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        ray->plot_style_name = strdup (plot_style_name);
+        ray->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2056,7 +2058,7 @@ dxf_ray_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ray->color_name));
+        return (dxf_strdup (ray->color_name));
 }
 
 
@@ -2094,7 +2096,7 @@ dxf_ray_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        ray->color_name = strdup (color_name);
+        ray->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2179,7 +2181,7 @@ dxf_ray_get_p0
                 /*!< a pointer to a DXF \c RAY entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2218,7 +2220,7 @@ dxf_ray_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2257,7 +2259,7 @@ dxf_ray_get_x0
                 /*!< a pointer to a DXF \c RAY entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2300,7 +2302,7 @@ dxf_ray_set_x0
                  * \c RAY entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2339,7 +2341,7 @@ dxf_ray_get_y0
                 /*!< a pointer to a DXF \c RAY entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2382,7 +2384,7 @@ dxf_ray_set_y0
                  * \c RAY entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2421,7 +2423,7 @@ dxf_ray_get_z0
                 /*!< a pointer to a DXF \c RAY entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2464,7 +2466,7 @@ dxf_ray_set_z0
                  * \c RAY entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2502,7 +2504,7 @@ dxf_ray_get_p1
                 /*!< a pointer to a DXF \c RAY entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2541,7 +2543,7 @@ dxf_ray_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2580,7 +2582,7 @@ dxf_ray_get_x1
                 /*!< a pointer to a DXF \c RAY entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2623,7 +2625,7 @@ dxf_ray_set_x1
                  * \c RAY entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2662,7 +2664,7 @@ dxf_ray_get_y1
                 /*!< a pointer to a DXF \c RAY entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2705,7 +2707,7 @@ dxf_ray_set_y1
                  * \c RAY entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2744,7 +2746,7 @@ dxf_ray_get_z1
                 /*!< a pointer to a DXF \c RAY entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2787,7 +2789,7 @@ dxf_ray_set_z1
                  * \c RAY entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
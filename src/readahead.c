@@ -0,0 +1,665 @@
+/*!
+ * \file readahead.c
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for the read-ahead input stream.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+        /* fopencookie () */
+#endif
+
+#include "readahead.h"
+
+#if defined (__APPLE__) || defined (__FreeBSD__) || defined (__NetBSD__) || defined (__OpenBSD__)
+#define DXF_READAHEAD_FUNOPEN 1
+#elif defined (__GLIBC__) || defined (__CYGWIN__)
+#define DXF_READAHEAD_FOPENCOOKIE 1
+#endif
+
+#if defined (DXF_READAHEAD_FUNOPEN) || defined (DXF_READAHEAD_FOPENCOOKIE)
+#include <pthread.h>
+
+
+/*!
+ * \brief State of a read-ahead stream.
+ *
+ * The I/O thread fills the buffers of a ring in order, the stream
+ * consumes them in the same order.\n
+ * The buffers from \c head up to \c head + \c count (modulo
+ * \c number_of_buffers) are filled, the I/O thread only writes to the
+ * buffer following them, so both threads copy data without holding
+ * the mutex.
+ */
+typedef struct
+dxf_readahead_struct
+{
+        FILE *fp;
+                /*!< The file read by the I/O thread. */
+        int fd;
+                /*!< File descriptor of \c fp for pread (), or -1 when
+                 * \c fp is read with fread (). */
+        pthread_t thread;
+                /*!< The I/O thread. */
+        pthread_mutex_t mutex;
+                /*!< Mutex protecting the members below. */
+        pthread_cond_t filled;
+                /*!< Signalled when a buffer was filled, or the I/O
+                 * thread became idle. */
+        pthread_cond_t emptied;
+                /*!< Signalled when a buffer was consumed, the stream
+                 * was repositioned or the thread has to stop. */
+        int number_of_buffers;
+                /*!< Number of buffers in the ring. */
+        size_t buffer_size;
+                /*!< Size of every buffer. */
+        char **buffers;
+                /*!< The ring of buffers. */
+        size_t *lengths;
+                /*!< Number of bytes in every filled buffer. */
+        int head;
+                /*!< Index of the buffer being consumed. */
+        int count;
+                /*!< Number of filled buffers. */
+        size_t offset;
+                /*!< Offset of the next byte to consume in the \c head
+                 * buffer. */
+        long file_offset;
+                /*!< File offset of the data of the next buffer to
+                 * fill. */
+        long position;
+                /*!< File offset of the next byte to consume. */
+        int busy;
+                /*!< \c TRUE while the I/O thread reads. */
+        int eof;
+                /*!< \c TRUE when the I/O thread reached the end of the
+                 * file. */
+        int error;
+                /*!< \c TRUE when the I/O thread failed to read. */
+        int stop;
+                /*!< \c TRUE when the I/O thread has to stop. */
+} DxfReadahead;
+
+
+/*!
+ * \brief Fill \c buffer with up to \c size bytes from the file offset
+ * \c offset.
+ *
+ * \return the number of bytes read, or -1 when an error occurred.
+ */
+static long
+dxf_readahead_fill
+(
+        DxfReadahead *readahead,
+        char *buffer,
+        size_t size,
+        long offset
+)
+{
+        size_t length = 0;
+        ssize_t n;
+
+        if (readahead->fd < 0)
+        {
+                length = fread (buffer, 1, size, readahead->fp);
+                /* The error flag of the stream stays set, the data
+                 * read before an error is returned first. */
+                return (((length == 0) && ferror (readahead->fp))
+                  ? -1 : (long) length);
+        }
+        while (length < size)
+        {
+                n = pread (readahead->fd, buffer + length, size - length,
+                  (off_t) offset + (off_t) length);
+                if (n < 0)
+                {
+                        if (errno == EINTR)
+                        {
+                                continue;
+                        }
+                        return (-1);
+                }
+                if (n == 0)
+                {
+                        break;
+                }
+                length += (size_t) n;
+        }
+        return ((long) length);
+}
+
+
+/*!
+ * \brief The I/O thread of a read-ahead stream.
+ */
+static void *
+dxf_readahead_thread
+(
+        void *data
+)
+{
+        DxfReadahead *readahead = (DxfReadahead *) data;
+        char *buffer;
+        long offset;
+        long length;
+        int slot;
+
+        pthread_mutex_lock (&readahead->mutex);
+        while (!readahead->stop)
+        {
+                if ((readahead->count == readahead->number_of_buffers)
+                  || readahead->eof || readahead->error)
+                {
+                        pthread_cond_wait (&readahead->emptied, &readahead->mutex);
+                        continue;
+                }
+                slot = (readahead->head + readahead->count) % readahead->number_of_buffers;
+                buffer = readahead->buffers[slot];
+                offset = readahead->file_offset;
+                readahead->busy = TRUE;
+                pthread_mutex_unlock (&readahead->mutex);
+                length = dxf_readahead_fill (readahead, buffer,
+                  readahead->buffer_size, offset);
+                pthread_mutex_lock (&readahead->mutex);
+                readahead->busy = FALSE;
+                if (length < 0)
+                {
+                        readahead->error = TRUE;
+                }
+                else if (length == 0)
+                {
+                        readahead->eof = TRUE;
+                }
+                else
+                {
+                        readahead->lengths[slot] = (size_t) length;
+                        readahead->count++;
+                        readahead->file_offset += length;
+                }
+                pthread_cond_broadcast (&readahead->filled);
+        }
+        pthread_mutex_unlock (&readahead->mutex);
+        return (NULL);
+}
+
+
+/*!
+ * \brief Copy up to \c size bytes from the ring of \c readahead to
+ * \c data.
+ *
+ * \return the number of bytes copied, 0 at the end of the file, or -1
+ * when an error occurred.
+ */
+static long
+dxf_readahead_read
+(
+        DxfReadahead *readahead,
+        char *data,
+        size_t size
+)
+{
+        char *buffer;
+        size_t length;
+
+        pthread_mutex_lock (&readahead->mutex);
+        while ((readahead->count == 0) && !readahead->eof && !readahead->error)
+        {
+                pthread_cond_wait (&readahead->filled, &readahead->mutex);
+        }
+        if (readahead->count == 0)
+        {
+                length = readahead->error;
+                /* Report an error once, then the end of the file, so
+                 * loops testing feof () terminate. */
+                readahead->error = FALSE;
+                readahead->eof = TRUE;
+                pthread_mutex_unlock (&readahead->mutex);
+                return ((length != 0) ? -1 : 0);
+        }
+        buffer = readahead->buffers[readahead->head] + readahead->offset;
+        length = readahead->lengths[readahead->head] - readahead->offset;
+        pthread_mutex_unlock (&readahead->mutex);
+        if (length > size)
+        {
+                length = size;
+        }
+        memcpy (data, buffer, length);
+        pthread_mutex_lock (&readahead->mutex);
+        readahead->offset += length;
+        readahead->position += (long) length;
+        if (readahead->offset == readahead->lengths[readahead->head])
+        {
+                readahead->head = (readahead->head + 1) % readahead->number_of_buffers;
+                readahead->count--;
+                readahead->offset = 0;
+                pthread_cond_signal (&readahead->emptied);
+        }
+        pthread_mutex_unlock (&readahead->mutex);
+        return ((long) length);
+}
+
+
+/*!
+ * \brief Move the next byte to consume to the file offset
+ * \c position, the buffered data is discarded.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_readahead_seek
+(
+        DxfReadahead *readahead,
+        long position
+)
+{
+        int result = EXIT_SUCCESS;
+
+        if (position == readahead->position)
+        {
+                /* ftell () */
+                return (EXIT_SUCCESS);
+        }
+        if (position < 0)
+        {
+                return (EXIT_FAILURE);
+        }
+        pthread_mutex_lock (&readahead->mutex);
+        while (readahead->busy)
+        {
+                pthread_cond_wait (&readahead->filled, &readahead->mutex);
+        }
+        if ((readahead->fd < 0)
+          && (fseek (readahead->fp, position, SEEK_SET) != 0))
+        {
+                result = EXIT_FAILURE;
+        }
+        else
+        {
+                readahead->head = 0;
+                readahead->count = 0;
+                readahead->offset = 0;
+                readahead->file_offset = position;
+                readahead->position = position;
+                readahead->eof = FALSE;
+                readahead->error = FALSE;
+                pthread_cond_signal (&readahead->emptied);
+        }
+        pthread_mutex_unlock (&readahead->mutex);
+        return (result);
+}
+
+
+/*!
+ * \brief Resolve a file offset relative to \c whence.
+ *
+ * \return the file offset, or -1 when an error occurred.
+ */
+static long
+dxf_readahead_offset
+(
+        DxfReadahead *readahead,
+        long offset,
+        int whence
+)
+{
+        struct stat buffer;
+
+        switch (whence)
+        {
+                case SEEK_SET:
+                        return (offset);
+                case SEEK_CUR:
+                        return (readahead->position + offset);
+                case SEEK_END:
+                        if ((readahead->fd < 0)
+                          || (fstat (readahead->fd, &buffer) != 0))
+                        {
+                                return (-1);
+                        }
+                        return ((long) buffer.st_size + offset);
+                default:
+                        return (-1);
+        }
+}
+
+
+/*!
+ * \brief Free \c readahead, the file is not closed.
+ */
+static void
+dxf_readahead_free
+(
+        DxfReadahead *readahead
+)
+{
+        int i;
+
+        pthread_cond_destroy (&readahead->filled);
+        pthread_cond_destroy (&readahead->emptied);
+        pthread_mutex_destroy (&readahead->mutex);
+        for (i = 0; (readahead->buffers != NULL) && (i < readahead->number_of_buffers); i++)
+        {
+                dxf_free (readahead->buffers[i]);
+        }
+        dxf_free (readahead->buffers);
+        dxf_free (readahead->lengths);
+        dxf_free (readahead);
+}
+
+
+/*!
+ * \brief Stop the I/O thread of \c readahead.
+ */
+static void
+dxf_readahead_stop
+(
+        DxfReadahead *readahead
+)
+{
+        pthread_mutex_lock (&readahead->mutex);
+        readahead->stop = TRUE;
+        pthread_cond_broadcast (&readahead->emptied);
+        pthread_mutex_unlock (&readahead->mutex);
+        pthread_join (readahead->thread, NULL);
+}
+
+
+/*!
+ * \brief Stop the I/O thread, close the file and free \c readahead.
+ *
+ * \return 0 when done, or \c EOF when an error occurred.
+ */
+static int
+dxf_readahead_close
+(
+        DxfReadahead *readahead
+)
+{
+        int result = 0;
+
+        dxf_readahead_stop (readahead);
+        if (fclose (readahead->fp) != 0)
+        {
+                result = EOF;
+        }
+        dxf_readahead_free (readahead);
+        return (result);
+}
+
+
+#if defined (DXF_READAHEAD_FOPENCOOKIE)
+static ssize_t
+dxf_readahead_cookie_read
+(
+        void *cookie,
+        char *data,
+        size_t size
+)
+{
+        return ((ssize_t) dxf_readahead_read ((DxfReadahead *) cookie, data, size));
+}
+
+
+static int
+dxf_readahead_cookie_seek
+(
+        void *cookie,
+        off64_t *offset,
+        int whence
+)
+{
+        DxfReadahead *readahead = (DxfReadahead *) cookie;
+        long position;
+
+        position = dxf_readahead_offset (readahead, (long) *offset, whence);
+        if (dxf_readahead_seek (readahead, position) != EXIT_SUCCESS)
+        {
+                return (-1);
+        }
+        *offset = (off64_t) readahead->position;
+        return (0);
+}
+
+
+static int
+dxf_readahead_cookie_close
+(
+        void *cookie
+)
+{
+        return (dxf_readahead_close ((DxfReadahead *) cookie));
+}
+#else
+static int
+dxf_readahead_funopen_read
+(
+        void *cookie,
+        char *data,
+        int size
+)
+{
+        return ((int) dxf_readahead_read ((DxfReadahead *) cookie, data, (size_t) size));
+}
+
+
+static fpos_t
+dxf_readahead_funopen_seek
+(
+        void *cookie,
+        fpos_t offset,
+        int whence
+)
+{
+        DxfReadahead *readahead = (DxfReadahead *) cookie;
+        long position;
+
+        position = dxf_readahead_offset (readahead, (long) offset, whence);
+        if (dxf_readahead_seek (readahead, position) != EXIT_SUCCESS)
+        {
+                return (-1);
+        }
+        return ((fpos_t) readahead->position);
+}
+
+
+static int
+dxf_readahead_funopen_close
+(
+        void *cookie
+)
+{
+        return (dxf_readahead_close ((DxfReadahead *) cookie));
+}
+#endif
+#endif
+
+
+/*!
+ * \brief Open a stream reading the file \c fp through an I/O thread.
+ *
+ * The I/O thread reads ahead into a ring of \c number_of_buffers
+ * buffers of \c buffer_size bytes, while the caller parses the data of
+ * the current buffer, so reading from a slow disk or a network file
+ * system overlaps with parsing.\n
+ * A regular file is read with pread (), other streams (e.g. a
+ * decompressing stream) with fread ().\n
+ * The returned stream owns \c fp and closes it with fclose ().\n
+ * ftell () is answered without stopping the I/O thread, fseek ()
+ * discards the buffered data and restarts reading at the new offset.
+ *
+ * \return the read-ahead stream, or \c NULL when an error occurred or
+ * read-ahead is not supported on this platform, \c fp is not closed
+ * then.
+ */
+FILE *
+dxf_readahead_open
+(
+        FILE *fp,
+                /*!< a file opened for reading. */
+        int number_of_buffers,
+                /*!< number of buffers, 0 for
+                 * \c DXF_READAHEAD_NUMBER_OF_BUFFERS. */
+        size_t buffer_size
+                /*!< size of every buffer, 0 for
+                 * \c DXF_READAHEAD_BUFFER_SIZE. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if defined (DXF_READAHEAD_FUNOPEN) || defined (DXF_READAHEAD_FOPENCOOKIE)
+        {
+                DxfReadahead *readahead = NULL;
+                FILE *result = NULL;
+                int i;
+#if defined (DXF_READAHEAD_FOPENCOOKIE)
+                cookie_io_functions_t functions;
+#endif
+
+                if (number_of_buffers <= 0)
+                {
+                        number_of_buffers = DXF_READAHEAD_NUMBER_OF_BUFFERS;
+                }
+                if (number_of_buffers < 2)
+                {
+                        /* One buffer is consumed while the next one is
+                         * filled. */
+                        number_of_buffers = 2;
+                }
+                if (buffer_size == 0)
+                {
+                        buffer_size = DXF_READAHEAD_BUFFER_SIZE;
+                }
+                readahead = dxf_malloc (sizeof (DxfReadahead));
+                if (readahead == NULL)
+                {
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+                memset (readahead, 0, sizeof (DxfReadahead));
+                pthread_mutex_init (&readahead->mutex, NULL);
+                pthread_cond_init (&readahead->filled, NULL);
+                pthread_cond_init (&readahead->emptied, NULL);
+                readahead->number_of_buffers = number_of_buffers;
+                readahead->buffer_size = buffer_size;
+                readahead->buffers = dxf_malloc (number_of_buffers * sizeof (char *));
+                readahead->lengths = dxf_malloc (number_of_buffers * sizeof (size_t));
+                if ((readahead->buffers != NULL) && (readahead->lengths != NULL))
+                {
+                        memset (readahead->buffers, 0, number_of_buffers * sizeof (char *));
+                        for (i = 0; i < number_of_buffers; i++)
+                        {
+                                readahead->buffers[i] = dxf_malloc (buffer_size);
+                                if (readahead->buffers[i] == NULL)
+                                {
+                                        break;
+                                }
+                        }
+                }
+                if ((readahead->buffers == NULL) || (readahead->lengths == NULL)
+                  || (readahead->buffers[number_of_buffers - 1] == NULL))
+                {
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_readahead_free (readahead);
+                        return (NULL);
+                }
+                readahead->fp = fp;
+                readahead->position = ftell (fp);
+                if (readahead->position < 0)
+                {
+                        readahead->position = 0;
+                }
+                readahead->file_offset = readahead->position;
+                /* pread () needs a seekable file descriptor, a stream
+                 * without one (fileno () returns -1) or a pipe is
+                 * read with fread (). */
+                readahead->fd = fileno (fp);
+                if ((readahead->fd >= 0)
+                  && (lseek (readahead->fd, 0, SEEK_CUR) < 0))
+                {
+                        readahead->fd = -1;
+                }
+                if (pthread_create (&readahead->thread, NULL,
+                  dxf_readahead_thread, readahead) != 0)
+                {
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not create the I/O thread.\n")),
+                          __FUNCTION__);
+                        dxf_readahead_free (readahead);
+                        return (NULL);
+                }
+#if defined (DXF_READAHEAD_FOPENCOOKIE)
+                memset (&functions, 0, sizeof (functions));
+                functions.read = dxf_readahead_cookie_read;
+                functions.seek = dxf_readahead_cookie_seek;
+                functions.close = dxf_readahead_cookie_close;
+                result = fopencookie (readahead, "r", functions);
+#else
+                result = funopen (readahead, dxf_readahead_funopen_read, NULL,
+                  dxf_readahead_funopen_seek, dxf_readahead_funopen_close);
+#endif
+                if (result == NULL)
+                {
+                        dxf_readahead_stop (readahead);
+                        dxf_readahead_free (readahead);
+                        return (NULL);
+                }
+                setvbuf (result, NULL, _IOFBF, 65536);
+#if DEBUG
+                DXF_DEBUG_END
+#endif
+                return (result);
+        }
+#else
+        (void) number_of_buffers;
+        (void) buffer_size;
+        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
+          (_("Note in %s () read-ahead is not supported on this platform.\n")),
+          __FUNCTION__);
+        return (NULL);
+#endif
+}
+
+
+/* EOF */
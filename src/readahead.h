@@ -0,0 +1,66 @@
+/*!
+ * \file readahead.h
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for the read-ahead input stream.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_READAHEAD_H
+#define LIBDXF_SRC_READAHEAD_H
+
+
+#include "global.h"
+
+
+#define DXF_READAHEAD_BUFFER_SIZE 1048576
+        /*!< \brief Default size of a buffer of a read-ahead stream. */
+
+
+#define DXF_READAHEAD_NUMBER_OF_BUFFERS 4
+        /*!< \brief Default number of buffers of a read-ahead stream. */
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+FILE *dxf_readahead_open (FILE *fp, int number_of_buffers, size_t buffer_size);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_READAHEAD_H */
+
+
+/* EOF */
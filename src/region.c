@@ -61,7 +61,7 @@ dxf_region_new ()
         size = sizeof (DxfRegion);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((region = malloc (size)) == NULL)
+        if ((region = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfRegion struct.\n")),
@@ -99,22 +99,22 @@ dxf_region_init
         /* Do some basic checks. */
         if (region == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 region = dxf_region_new ();
         }
         if (region == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfRegion struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         region->modeler_format_version_number = 0;
         region->id_code = 0;
-        region->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        region->layer = strdup (DXF_DEFAULT_LAYER);
+        region->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        region->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         region->elevation = 0.0;
         region->thickness = 0.0;
         region->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -124,16 +124,17 @@ dxf_region_init
         region->modeler_format_version_number = 1;
         dxf_char_new (region->proprietary_data);
         region->proprietary_data = dxf_char_init (region->proprietary_data);
-        region->proprietary_data->value = strdup ("");
+        region->proprietary_data->value = dxf_strdup ("");
         region->proprietary_data->length = 0;
         region->proprietary_data->next = NULL;
         dxf_char_new (region->additional_proprietary_data);
         region->additional_proprietary_data = dxf_char_init (region->additional_proprietary_data);
-        region->additional_proprietary_data->value = strdup ("");
+        region->additional_proprietary_data->value = dxf_strdup ("");
         region->additional_proprietary_data->length = 0;
         region->additional_proprietary_data->next = NULL;
-        region->dictionary_owner_soft = strdup ("");
-        region->dictionary_owner_hard = strdup ("");
+        region->dictionary_owner_soft = dxf_strdup ("");
+        region->dictionary_owner_hard = dxf_strdup ("");
+        region->acis = NULL;
         region->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -166,62 +167,47 @@ dxf_region_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfChar *iter1 = NULL;
-        DxfChar *iter2 = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (region == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 region = dxf_region_init (region);
         }
-        iter1 = (DxfChar *) region->proprietary_data;
-        iter2 = (DxfChar *) region->additional_proprietary_data;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        memset (temp_string, 0, sizeof (temp_string));
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                else if (strcmp (temp_string, "  1") == 0)
+                else if ((strcmp (temp_string, "1") == 0)
+                  || (strcmp (temp_string, "3") == 0))
                 {
                         /* Now follows a string containing proprietary
-                         * data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter1->value);
-                        iter1->next = (struct DxfChar *) dxf_char_init ((DxfChar *) iter1->next);
-                        iter1 = (DxfChar *) iter1->next;
-                }
-                else if (strcmp (temp_string, "  3") == 0)
-                {
-                        /* Now follows a string containing additional
-                         * proprietary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter2->value);
-                        iter2->next = (struct DxfChar *) dxf_char_init ((DxfChar *) iter2->next);
-                        iter2 = (DxfChar *) iter2->next;
+                         * data, or additional proprietary data. */
+                        if (region->acis == NULL)
+                        {
+                                region->acis = dxf_acis_init (dxf_acis_new ());
+                        }
+                        dxf_acis_read (fp, region->acis, atoi (temp_string), temp_string);
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -233,13 +219,17 @@ dxf_region_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, region->linetype);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (region->linetype);
+                        region->linetype = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, region->layer);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (region->layer);
+                        region->layer = dxf_strdup (temp_string);
                 }
                 else if ((fp->acad_version_number <= AutoCAD_11)
                         && (strcmp (temp_string, "38") == 0)
@@ -300,9 +290,10 @@ dxf_region_read
                          * subclass marker value. */
                         (fp->line_number)++;
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "AcDbModelerGeometry") != 0)
+                        if ((strcmp (temp_string, "AcDbEntity") != 0)
+                          && (strcmp (temp_string, "AcDbModelerGeometry") != 0))
                         {
-                                fprintf (stderr, "Error in dxf_region_read () found a bad subclass marker in: %s in line: %d.\n",
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR, "Error in dxf_region_read () found a bad subclass marker in: %s in line: %d.\n",
                                         fp->filename, fp->line_number);
                         }
                 }
@@ -311,14 +302,18 @@ dxf_region_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, region->dictionary_owner_soft);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (region->dictionary_owner_soft);
+                        region->dictionary_owner_soft = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, region->dictionary_owner_hard);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (region->dictionary_owner_hard);
+                        region->dictionary_owner_hard = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -329,22 +324,23 @@ dxf_region_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
+                        dxf_read_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (region->linetype, "") == 0)
         {
-                region->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                region->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (region->layer, "") == 0)
         {
-                region->layer = strdup (DXF_DEFAULT_LAYER);
+                region->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -370,54 +366,54 @@ dxf_region_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("REGION");
+        char *dxf_entity_name = dxf_strdup ("REGION");
         DxfChar *iter1 = NULL;
         DxfChar *iter2 = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (region == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, region->id_code);
         }
         if (strcmp (region->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, region->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                region->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                region->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (region->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, region->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                region->layer = strdup (DXF_DEFAULT_LAYER);
+                region->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -492,34 +488,41 @@ dxf_region_write
         {
                 fprintf (fp->fp, " 70\n%d\n", region->modeler_format_version_number);
         }
-        if (region->proprietary_data != NULL)
+        if (region->acis != NULL)
         {
-                iter1 = (DxfChar*) region->proprietary_data;
-                while ((iter1 != NULL) && (iter1->value != NULL))
-                {
-                        fprintf (fp->fp, "  1\n%s\n", iter1->value);
-                        iter1 = (DxfChar*) iter1->next;
-                }
+                dxf_acis_write (fp, region->acis);
         }
         else
         {
-                fprintf (fp->fp, "  1\n\n");
-        }
-        if (region->additional_proprietary_data != NULL)
-        {
-                iter2 = (DxfChar*) region->additional_proprietary_data;
-                while ((iter2 != NULL) && (iter2->value != NULL))
+                if (region->proprietary_data != NULL)
                 {
-                        fprintf (fp->fp, "  3\n%s\n", iter2->value);
-                        iter2 = (DxfChar*) iter2->next;
+                        iter1 = (DxfChar*) region->proprietary_data;
+                        while ((iter1 != NULL) && (iter1->value != NULL))
+                        {
+                                fprintf (fp->fp, "  1\n%s\n", iter1->value);
+                                iter1 = (DxfChar*) iter1->next;
+                        }
+                }
+                else
+                {
+                        fprintf (fp->fp, "  1\n\n");
+                }
+                if (region->additional_proprietary_data != NULL)
+                {
+                        iter2 = (DxfChar*) region->additional_proprietary_data;
+                        while ((iter2 != NULL) && (iter2->value != NULL))
+                        {
+                                fprintf (fp->fp, "  3\n%s\n", iter2->value);
+                                iter2 = (DxfChar*) iter2->next;
+                        }
+                }
+                else
+                {
+                        fprintf (fp->fp, "  3\n\n");
                 }
-        }
-        else
-        {
-                fprintf (fp->fp, "  3\n\n");
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -548,29 +551,33 @@ dxf_region_free
         /* Do some basic checks. */
         if (region == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (region->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (region->linetype);
-        free (region->layer);
+        dxf_free (region->linetype);
+        dxf_free (region->layer);
         dxf_binary_graphics_data_free_list (region->binary_graphics_data);
-        free (region->dictionary_owner_soft);
-        free (region->material);
-        free (region->dictionary_owner_hard);
-        free (region->plot_style_name);
-        free (region->color_name);
+        dxf_free (region->dictionary_owner_soft);
+        dxf_free (region->material);
+        dxf_free (region->dictionary_owner_hard);
+        dxf_free (region->plot_style_name);
+        dxf_free (region->color_name);
         dxf_char_free_list (region->proprietary_data);
         dxf_char_free_list (region->additional_proprietary_data);
-        free (region);
+        if (region->acis != NULL)
+        {
+                dxf_acis_free (region->acis);
+        }
+        dxf_free (region);
         region = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -591,18 +598,19 @@ dxf_region_free_list
                  * \c REGION entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (regions == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (regions != NULL)
         {
                 DxfRegion *iter = (DxfRegion *) regions->next;
+                regions->next = NULL;
                 dxf_region_free (regions);
                 regions = (DxfRegion *) iter;
         }
@@ -720,7 +728,7 @@ dxf_region_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (region->linetype));
+        return (dxf_strdup (region->linetype));
 }
 
 
@@ -755,7 +763,7 @@ dxf_region_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        region->linetype = strdup (linetype);
+        region->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -796,7 +804,7 @@ dxf_region_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (region->layer));
+        return (dxf_strdup (region->layer));
 }
 
 
@@ -831,7 +839,7 @@ dxf_region_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        region->layer = strdup (layer);
+        region->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1601,7 +1609,7 @@ dxf_region_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (region->dictionary_owner_soft));
+        return (dxf_strdup (region->dictionary_owner_soft));
 }
 
 
@@ -1637,7 +1645,7 @@ dxf_region_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        region->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        region->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1681,7 +1689,7 @@ dxf_region_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (region->material));
+        return (dxf_strdup (region->material));
 }
 
 
@@ -1719,7 +1727,7 @@ dxf_region_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        region->material = strdup (material);
+        region->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1763,7 +1771,7 @@ dxf_region_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (region->dictionary_owner_hard));
+        return (dxf_strdup (region->dictionary_owner_hard));
 }
 
 
@@ -1799,7 +1807,7 @@ dxf_region_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        region->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        region->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1906,7 +1914,7 @@ dxf_region_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (region->plot_style_name));
+        return (dxf_strdup (region->plot_style_name));
 }
 
 
@@ -1944,7 +1952,7 @@ dxf_region_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        region->plot_style_name = strdup (plot_style_name);
+        region->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2051,7 +2059,7 @@ dxf_region_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (region->color_name));
+        return (dxf_strdup (region->color_name));
 }
 
 
@@ -2089,7 +2097,7 @@ dxf_region_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        region->color_name = strdup (color_name);
+        region->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2352,6 +2360,78 @@ dxf_region_set_additional_proprietary_data
 }
 
 
+/*!
+ * \brief Get the ACIS proprietary data from a DXF \c REGION entity.
+ *
+ * \return a pointer to the ACIS proprietary data, or \c NULL when the
+ * entity holds none or when an error occurred.
+ */
+DxfAcis *
+dxf_region_get_acis
+(
+        DxfRegion *region
+                /*!< a pointer to a DXF \c REGION entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (region == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (region->acis);
+}
+
+
+/*!
+ * \brief Set the ACIS proprietary data for a DXF \c REGION entity.
+ *
+ * The entity takes ownership of \c acis, ACIS proprietary data held
+ * before is freed.
+ *
+ * \return a pointer to \c region, or \c NULL when an error occurred.
+ */
+DxfRegion *
+dxf_region_set_acis
+(
+        DxfRegion *region,
+                /*!< a pointer to a DXF \c REGION entity. */
+        DxfAcis *acis
+                /*!< a pointer to the ACIS proprietary data, or
+                 * \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (region == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((region->acis != NULL) && (region->acis != acis))
+        {
+                dxf_acis_free (region->acis);
+        }
+        region->acis = acis;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (region);
+}
+
+
 /*!
  * \brief Get the \c modeler_format_version_number from a DXF \c REGION
  * entity.
@@ -46,6 +46,7 @@
 
 
 #include "global.h"
+#include "acis.h"
 #include "point.h"
 #include "binary_graphics_data.h"
 #include "util.h"
@@ -196,6 +197,12 @@ dxf_region_struct
                  * group 1 string is greater than 255 characters
                  * (optional).\n
                  * Group code = 3. */
+        DxfAcis *acis;
+                /*!< Proprietary data (group codes 1 and 3) as read with
+                 * the ACIS mode of the DXF file, see
+                 * dxf_file_set_acis_mode ().\n
+                 * Written instead of \c proprietary_data and
+                 * \c additional_proprietary_data when not \c NULL. */
         int modeler_format_version_number;
                 /*!< Modeler format version number (currently = 1).\n
                  * Group code = 70. */
@@ -255,6 +262,8 @@ DxfChar *dxf_region_get_proprietary_data (DxfRegion *region);
 DxfRegion *dxf_region_set_proprietary_data (DxfRegion *region, DxfChar *proprietary_data);
 DxfChar *dxf_region_get_additional_proprietary_data (DxfRegion *region);
 DxfRegion *dxf_region_set_additional_proprietary_data (DxfRegion *region, DxfChar *additional_proprietary_data);
+DxfAcis *dxf_region_get_acis (DxfRegion *region);
+DxfRegion *dxf_region_set_acis (DxfRegion *region, DxfAcis *acis);
 int dxf_region_get_modeler_format_version_number (DxfRegion *region);
 DxfRegion *dxf_region_set_modeler_format_version_number (DxfRegion *region, int modeler_format_version_number);
 DxfRegion *dxf_region_get_next (DxfRegion *region);
@@ -59,7 +59,7 @@ dxf_rtext_new ()
         size = sizeof (DxfRText);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((rtext = malloc (size)) == NULL)
+        if ((rtext = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfRText struct.\n")),
@@ -96,21 +96,21 @@ dxf_rtext_init
         /* Do some basic checks. */
         if (rtext == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 rtext = dxf_rtext_new ();
         }
         if (rtext == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfRText struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         rtext->id_code = 0;
-        rtext->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        rtext->layer = strdup (DXF_DEFAULT_LAYER);
+        rtext->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        rtext->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         rtext->elevation = 0.0;
         rtext->thickness = 0.0;
         rtext->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -121,16 +121,16 @@ dxf_rtext_init
         rtext->shadow_mode = 0;
         rtext->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
         rtext->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) rtext->binary_graphics_data);
-        rtext->dictionary_owner_soft = strdup ("");
-        rtext->material = strdup ("");
-        rtext->dictionary_owner_hard = strdup ("");
+        rtext->dictionary_owner_soft = dxf_strdup ("");
+        rtext->material = dxf_strdup ("");
+        rtext->dictionary_owner_hard = dxf_strdup ("");
         rtext->lineweight = 0;
-        rtext->plot_style_name = strdup ("");
+        rtext->plot_style_name = dxf_strdup ("");
         rtext->color_value = 0;
-        rtext->color_name = strdup ("");
+        rtext->color_name = dxf_strdup ("");
         rtext->transparency = 0;
-        rtext->text_value = strdup ("");
-        rtext->text_style = strdup ("");
+        rtext->text_value = dxf_strdup ("");
+        rtext->text_style = dxf_strdup ("");
         rtext->p0 = (DxfPoint *) dxf_point_new ();
         rtext->p0 = dxf_point_init ((DxfPoint *) rtext->p0);
         rtext->p0->x0 = 0.0;
@@ -174,22 +174,22 @@ dxf_rtext_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("RTEXT");
+        char *dxf_entity_name = dxf_strdup ("RTEXT");
         char *temp_string = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (rtext == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 rtext = dxf_rtext_init (rtext);
@@ -200,12 +200,12 @@ dxf_rtext_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
@@ -344,7 +344,7 @@ dxf_rtext_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbRText") != 0)))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -389,9 +389,8 @@ dxf_rtext_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) rtext->binary_graphics_data->next);
-                        rtext->binary_graphics_data = (DxfBinaryGraphicsData *) rtext->binary_graphics_data->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_graphics_data_append_hex ((DxfBinaryGraphicsData *) rtext->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -457,15 +456,16 @@ dxf_rtext_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning: in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (rtext->text_value, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () text value string is empty for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, rtext->id_code);
                 dxf_entity_skip (dxf_entity_name);
@@ -473,14 +473,14 @@ dxf_rtext_read
         }
         if (strcmp (rtext->linetype, "") == 0)
         {
-                rtext->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                rtext->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (rtext->layer, "") == 0)
         {
-                rtext->layer = strdup (DXF_DEFAULT_LAYER);
+                rtext->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -503,57 +503,57 @@ dxf_rtext_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("RTEXT");
+        char *dxf_entity_name = dxf_strdup ("RTEXT");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (rtext == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (rtext->text_value, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () text value string is empty for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, rtext->id_code);
                 dxf_entity_skip (dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (rtext->text_style, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () text style string is empty for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, rtext->id_code);
-                rtext->text_style = strdup (DXF_DEFAULT_TEXTSTYLE);
+                rtext->text_style = dxf_strdup (DXF_DEFAULT_TEXTSTYLE);
         }
         if (strcmp (rtext->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, rtext->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                rtext->layer = strdup (DXF_DEFAULT_LAYER);
+                rtext->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (rtext->height == 0.0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () height has a value of 0.0 for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, rtext->id_code);
         }
@@ -635,16 +635,7 @@ dxf_rtext_write
 #else
                 fprintf (fp->fp, " 92\n%d\n", rtext->graphics_data_size);
 #endif
-                if (rtext->binary_graphics_data != NULL)
-                {
-                        DxfBinaryGraphicsData *iter;
-                        iter = rtext->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (iter));
-                                iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (iter);
-                        }
-                }
+                dxf_binary_graphics_data_write (fp, (DxfBinaryGraphicsData *) rtext->binary_graphics_data);
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
@@ -696,7 +687,7 @@ dxf_rtext_write
                 fprintf (fp->fp, "100\nAcDbRText\n");
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -724,30 +715,30 @@ dxf_rtext_free
 #endif
         if (rtext == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (rtext->next != NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (rtext->linetype);
-        free (rtext->layer);
+        dxf_free (rtext->linetype);
+        dxf_free (rtext->layer);
         dxf_binary_graphics_data_free_list (rtext->binary_graphics_data);
-        free (rtext->dictionary_owner_soft);
-        free (rtext->material);
-        free (rtext->dictionary_owner_hard);
-        free (rtext->plot_style_name);
-        free (rtext->color_name);
-        free (rtext->text_value);
-        free (rtext->text_style);
+        dxf_free (rtext->dictionary_owner_soft);
+        dxf_free (rtext->material);
+        dxf_free (rtext->dictionary_owner_hard);
+        dxf_free (rtext->plot_style_name);
+        dxf_free (rtext->color_name);
+        dxf_free (rtext->text_value);
+        dxf_free (rtext->text_style);
         dxf_point_free (rtext->p0);
-        free (rtext);
+        dxf_free (rtext);
         rtext = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -768,18 +759,19 @@ dxf_rtext_free_list
                  * entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (rtexts == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (rtexts != NULL)
         {
                 DxfRText *iter = (DxfRText *) rtexts->next;
+                rtexts->next = NULL;
                 dxf_rtext_free (rtexts);
                 rtexts = (DxfRText *) iter;
         }
@@ -897,7 +889,7 @@ dxf_rtext_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rtext->linetype));
+        return (dxf_strdup (rtext->linetype));
 }
 
 
@@ -932,7 +924,7 @@ dxf_rtext_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        rtext->linetype = strdup (linetype);
+        rtext->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -973,7 +965,7 @@ dxf_rtext_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rtext->layer));
+        return (dxf_strdup (rtext->layer));
 }
 
 
@@ -1008,7 +1000,7 @@ dxf_rtext_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        rtext->layer = strdup (layer);
+        rtext->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1762,7 +1754,7 @@ dxf_rtext_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rtext->dictionary_owner_soft));
+        return (dxf_strdup (rtext->dictionary_owner_soft));
 }
 
 
@@ -1798,7 +1790,7 @@ dxf_rtext_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        rtext->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        rtext->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1842,7 +1834,7 @@ dxf_rtext_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rtext->material));
+        return (dxf_strdup (rtext->material));
 }
 
 
@@ -1880,7 +1872,7 @@ dxf_rtext_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        rtext->material = strdup (material);
+        rtext->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1924,7 +1916,7 @@ dxf_rtext_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rtext->dictionary_owner_hard));
+        return (dxf_strdup (rtext->dictionary_owner_hard));
 }
 
 
@@ -1960,7 +1952,7 @@ dxf_rtext_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        rtext->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        rtext->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2067,7 +2059,7 @@ dxf_rtext_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rtext->plot_style_name));
+        return (dxf_strdup (rtext->plot_style_name));
 }
 
 
@@ -2105,7 +2097,7 @@ dxf_rtext_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        rtext->plot_style_name = strdup (plot_style_name);
+        rtext->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2212,7 +2204,7 @@ dxf_rtext_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rtext->color_name));
+        return (dxf_strdup (rtext->color_name));
 }
 
 
@@ -2250,7 +2242,7 @@ dxf_rtext_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        rtext->color_name = strdup (color_name);
+        rtext->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2357,7 +2349,7 @@ dxf_rtext_get_text_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rtext->text_value));
+        return (dxf_strdup (rtext->text_value));
 }
 
 
@@ -2395,7 +2387,7 @@ dxf_rtext_set_text_value
                   __FUNCTION__);
                 return (NULL);
         }
-        rtext->text_value = strdup (text_value);
+        rtext->text_value = dxf_strdup (text_value);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2437,7 +2429,7 @@ dxf_rtext_get_text_style
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rtext->text_style));
+        return (dxf_strdup (rtext->text_style));
 }
 
 
@@ -2475,7 +2467,7 @@ dxf_rtext_set_text_style
                   __FUNCTION__);
                 return (NULL);
         }
-        rtext->text_style = strdup (text_style);
+        rtext->text_style = dxf_strdup (text_style);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2495,7 +2487,7 @@ dxf_rtext_get_p0
                 /*!< a pointer to a DXF \c RTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2534,7 +2526,7 @@ dxf_rtext_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2573,7 +2565,7 @@ dxf_rtext_get_x0
                 /*!< a pointer to a DXF \c RTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2616,7 +2608,7 @@ dxf_rtext_set_x0
                  * \c RTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2655,7 +2647,7 @@ dxf_rtext_get_y0
                 /*!< a pointer to a DXF \c RTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2698,7 +2690,7 @@ dxf_rtext_set_y0
                  * \c RTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2737,7 +2729,7 @@ dxf_rtext_get_z0
                 /*!< a pointer to a DXF \c RTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2780,7 +2772,7 @@ dxf_rtext_set_z0
                  * \c RTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3062,7 +3054,7 @@ dxf_rtext_get_extr_x0
                 /*!< a pointer to a DXF \c RTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3098,7 +3090,7 @@ dxf_rtext_set_extr_x0
                  * DXF \c RTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3130,7 +3122,7 @@ dxf_rtext_get_extr_y0
                 /*!< a pointer to a DXF \c RTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3166,7 +3158,7 @@ dxf_rtext_set_extr_y0
                  * DXF \c RTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3198,7 +3190,7 @@ dxf_rtext_get_extr_z0
                 /*!< a pointer to a DXF \c RTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3234,7 +3226,7 @@ dxf_rtext_set_extr_z0
                  * DXF \c RTEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
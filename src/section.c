@@ -38,37 +38,93 @@
 
 
 #include "section.h"
+#include "drawing.h"
+#include "stats.h"
+
+
+/*!
+ * \brief Account the time spent since \c start to \c section and
+ * continue with \c next, in the statistics and the trace.
+ *
+ * Pass \c DXF_STATS_NUMBER_OF_SECTIONS as \c next after the last
+ * section.
+ */
+static void
+dxf_section_stats_switch
+(
+        DxfFile *fp,
+        DxfStatsSection *section,
+        int64_t *start,
+        DxfStatsSection next
+)
+{
+        int64_t now;
+
+        if (*section < DXF_STATS_NUMBER_OF_SECTIONS)
+        {
+                DXF_TRACE_END (DXF_TRACING_SECTION, dxf_stats_get_section_name (*section));
+        }
+        if (next < DXF_STATS_NUMBER_OF_SECTIONS)
+        {
+                DXF_TRACE_BEGIN (DXF_TRACING_SECTION, dxf_stats_get_section_name (next));
+        }
+        if (fp->stats != NULL)
+        {
+                now = dxf_stats_now ();
+                if (*section < DXF_STATS_NUMBER_OF_SECTIONS)
+                {
+                        fp->stats->section_nanoseconds[*section] += now - *start;
+                }
+                if (next < DXF_STATS_NUMBER_OF_SECTIONS)
+                {
+                        fp->stats->section_count[next]++;
+                }
+                *start = now;
+        }
+        *section = next;
+}
 
 
 /*!
  * \brief Function reads a SECTION in a DXF file.
+ *
+ * The parsed data is stored in \c drawing.
  */
 int
 dxf_section_read
 (
-        DxfFile *fp
+        DxfFile *fp,
                 /*!< DXF file handle of input file (or device). */
+        DxfDrawing *drawing
+                /*!< a pointer to the libDXF drawing receiving the
+                 * parsed data. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         char temp_string[DXF_MAX_STRING_LENGTH];
-        DxfHeader dxf_header;
-        DxfBlock dxf_block;
-        char *dxf_entities_list = NULL;
+        DxfStatsSection section = DXF_STATS_NUMBER_OF_SECTIONS;
+        int64_t start = 0;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
+        if (drawing == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
         memset(temp_string, 0, sizeof(temp_string));
         dxf_read_line (temp_string, fp);
-        if (strcmp (temp_string, "2") == 0)
+        if (strcmp (temp_string + strspn (temp_string, " "), "2") == 0)
         {
                 while (!feof (fp->fp)) /* Does this actually work? */
                 {
@@ -77,53 +133,98 @@ dxf_section_read
                         if (strcmp (temp_string, "HEADER") == 0)
                         {
                                 /* We have found the begin of the HEADER section. */
-                                dxf_header_read (fp, &dxf_header);
+                                dxf_section_stats_switch (fp, &section,
+                                  &start, DXF_STATS_SECTION_HEADER);
+                                if (drawing->header == NULL)
+                                {
+                                        drawing->header = (struct DxfHeader *) dxf_header_new ();
+                                }
+                                if (drawing->header == NULL)
+                                {
+                                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                                          (_("Error in %s () could not allocate memory.\n")),
+                                          __FUNCTION__);
+                                        return (EXIT_FAILURE);
+                                }
+                                dxf_header_read (fp, (DxfHeader *) drawing->header);
+                                if (((DxfHeader *) drawing->header)->_AcadVer > 0)
+                                {
+                                        fp->acad_version_number = ((DxfHeader *) drawing->header)->_AcadVer;
+                                }
                         }
                         else if (strcmp (temp_string, "CLASSES") == 0)
                         {
                                 /* We have found the begin of the CLASSES sction. */
+                                dxf_section_stats_switch (fp, &section,
+                                  &start, DXF_STATS_SECTION_CLASSES);
                                 /*! \todo Invoke a function for parsing the \c CLASSES section. */ 
                         }
                         else if (strcmp (temp_string, "TABLES") == 0)
                         {
                                 /* We have found the begin of the TABLES sction. */
+                                dxf_section_stats_switch (fp, &section,
+                                  &start, DXF_STATS_SECTION_TABLES);
                                 /*! \todo Invoke a function for parsing the \c TABLES section. */ 
                         }
                         else if (strcmp (temp_string, "BLOCKS") == 0)
                         {
                                 /* We have found the begin of the BLOCKS sction. */
+                                dxf_section_stats_switch (fp, &section,
+                                  &start, DXF_STATS_SECTION_BLOCKS);
 
                                 /*! \todo Experimental usage of block_read */
 //                                dxf_read_blocks
 //                                (
 //                                        fp->fp,
-//                                        &dxf_blocks_list,
-//                                        dxf_header._AcadVer
+//                                        &drawing->block_list,
+//                                        fp->acad_version_number
 //                                );
                         }
                         else if (strcmp (temp_string, "ENTITIES") == 0)
                         {
                                 /* We have found the begin of the ENTITIES sction. */
-                                dxf_entities_read_table (fp->filename,
-                                                   fp->fp,
-                                                   fp->line_number,
-                                                   dxf_entities_list,
-                                                   dxf_header._AcadVer);                        }
+                                dxf_section_stats_switch (fp, &section,
+                                  &start, DXF_STATS_SECTION_ENTITIES);
+                                if (drawing->entities_list == NULL)
+                                {
+                                        drawing->entities_list = (struct DxfEntities *) dxf_entities_new ();
+                                }
+                                if (drawing->entities_list == NULL)
+                                {
+                                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                                          (_("Error in %s () could not allocate memory.\n")),
+                                          __FUNCTION__);
+                                        return (EXIT_FAILURE);
+                                }
+                                dxf_entities_read_table (fp,
+                                  (DxfEntities *) drawing->entities_list);
+                        }
                         else if (strcmp (temp_string, "OBJECTS") == 0)
                         {
                                 /* We have found the begin of the OBJECTS sction. */
+                                dxf_section_stats_switch (fp, &section,
+                                  &start, DXF_STATS_SECTION_OBJECTS);
                                 /*! \todo Invoke a function for parsing the \c OBJECTS section. */ 
                         }
-                        else if (strcmp (temp_string, "THUMBNAIL") == 0)
+                        else if (strcmp (temp_string, "THUMBNAILIMAGE") == 0)
                         {
-                                /* We have found the begin of the THUMBNAIL sction. */
-                                /*! \todo Invoke a function for parsing the \c THUMBNAIL section. */ 
+                                /* We have found the begin of the THUMBNAILIMAGE sction. */
+                                dxf_section_stats_switch (fp, &section,
+                                  &start, DXF_STATS_SECTION_THUMBNAIL);
+                                if (drawing->thumbnail != NULL)
+                                {
+                                        dxf_thumbnail_free ((DxfThumbnail *) drawing->thumbnail);
+                                }
+                                drawing->thumbnail = (struct DxfThumbnail *) dxf_thumbnail_read (fp,
+                                  dxf_thumbnail_init (dxf_thumbnail_new ()));
                         }
                 }
+                dxf_section_stats_switch (fp, &section, &start,
+                  DXF_STATS_NUMBER_OF_SECTIONS);
         }
         else
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () unexpected string encountered while reading line %d from: %s.\n")),
                   __FUNCTION__, fp->line_number, fp->filename);
         }
@@ -150,14 +251,14 @@ dxf_section_write
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (section_name == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -51,7 +51,11 @@ extern "C" {
 #endif
 
 
-int dxf_section_read (DxfFile *fp);
+struct dxf_drawing_struct;
+        /*!< \brief Forward declaration of a libDXF drawing (drawing.h). */
+
+
+int dxf_section_read (DxfFile *fp, struct dxf_drawing_struct *drawing);
 int dxf_section_write (DxfFile *fp, char *section_name);
 
 
@@ -42,6 +42,7 @@
 
 
 #include "seqend.h"
+#include "util.h"
 
 
 /*!
@@ -64,7 +65,7 @@ dxf_seqend_new ()
         size = sizeof (DxfSeqend);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((seqend = malloc (size)) == NULL)
+        if ((seqend = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfSeqend struct.\n")),
@@ -102,21 +103,21 @@ dxf_seqend_init
         /* Do some basic checks. */
         if (seqend == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 seqend = dxf_seqend_new ();
         }
         if (seqend == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfSeqend struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         seqend->id_code = 0;
-        seqend->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        seqend->layer = strdup (DXF_DEFAULT_LAYER);
+        seqend->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        seqend->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         seqend->elevation = 0.0;
         seqend->thickness = 0.0;
         seqend->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -127,15 +128,15 @@ dxf_seqend_init
         seqend->shadow_mode = 0;
         seqend->binary_graphics_data = dxf_binary_graphics_data_new ();
         seqend->binary_graphics_data = dxf_binary_graphics_data_init (seqend->binary_graphics_data);
-        seqend->dictionary_owner_soft = strdup ("");
-        seqend->material = strdup ("");
-        seqend->dictionary_owner_hard = strdup ("");
+        seqend->dictionary_owner_soft = dxf_strdup ("");
+        seqend->material = dxf_strdup ("");
+        seqend->dictionary_owner_hard = dxf_strdup ("");
         seqend->lineweight = 0;
-        seqend->plot_style_name = strdup ("");
+        seqend->plot_style_name = dxf_strdup ("");
         seqend->color_value = 0;
-        seqend->color_name = strdup ("");
+        seqend->color_name = dxf_strdup ("");
         seqend->transparency = 0;
-        seqend->app_name = strdup ("");
+        seqend->app_name = dxf_strdup ("");
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -166,37 +167,33 @@ dxf_seqend_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (seqend == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 seqend = dxf_seqend_init (seqend);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        memset (temp_string, 0, sizeof (temp_string));
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "2") == 0)
@@ -204,7 +201,9 @@ dxf_seqend_read
                         /* Now follows a string containing an application
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->app_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (seqend->app_name);
+                        seqend->app_name = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "5") == 0)
                 {
@@ -218,13 +217,17 @@ dxf_seqend_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->linetype);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (seqend->linetype);
+                        seqend->linetype = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->layer);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (seqend->layer);
+                        seqend->layer = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "38") == 0)
                 {
@@ -284,7 +287,7 @@ dxf_seqend_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "AcDbEntity") != 0)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -301,30 +304,35 @@ dxf_seqend_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) seqend->binary_graphics_data->next);
-                        seqend->binary_graphics_data = (DxfBinaryGraphicsData *) seqend->binary_graphics_data->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_graphics_data_append_hex ((DxfBinaryGraphicsData *) seqend->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->dictionary_owner_soft);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (seqend->dictionary_owner_soft);
+                        seqend->dictionary_owner_soft = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "347") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->material);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (seqend->material);
+                        seqend->material = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->dictionary_owner_hard);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (seqend->dictionary_owner_hard);
+                        seqend->dictionary_owner_hard = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -338,7 +346,9 @@ dxf_seqend_read
                         /* Now follows a string containing a plot style
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->plot_style_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (seqend->plot_style_name);
+                        seqend->plot_style_name = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -351,7 +361,9 @@ dxf_seqend_read
                         /* Now follows a string containing a color
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->color_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (seqend->color_name);
+                        seqend->color_name = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -369,22 +381,25 @@ dxf_seqend_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
+                        dxf_read_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (seqend->linetype, "") == 0)
         {
-                seqend->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_free (seqend->linetype);
+                seqend->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (seqend->layer, "") == 0)
         {
-                seqend->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_free (seqend->layer);
+                seqend->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -418,43 +433,43 @@ dxf_seqend_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("SEQEND");
+        char *dxf_entity_name = dxf_strdup ("SEQEND");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (seqend == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (seqend->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, seqend->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                seqend->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                seqend->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (seqend->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, seqend->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
                 seqend->layer = DXF_DEFAULT_LAYER;
@@ -542,16 +557,7 @@ dxf_seqend_write
 #else
                 fprintf (fp->fp, " 92\n%d\n", seqend->graphics_data_size);
 #endif
-                if (seqend->binary_graphics_data != NULL)
-                {
-                        DxfBinaryGraphicsData *iter;
-                        iter = (DxfBinaryGraphicsData *) seqend->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (iter));
-                                iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (iter);
-                        }
-                }
+                dxf_binary_graphics_data_write (fp, (DxfBinaryGraphicsData *) seqend->binary_graphics_data);
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
@@ -565,7 +571,7 @@ dxf_seqend_write
                 fprintf (fp->fp, "284\n%d\n", seqend->shadow_mode);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -594,21 +600,21 @@ dxf_seqend_free
         /* Do some basic checks. */
         if (seqend == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (seqend->linetype);
-        free (seqend->layer);
+        dxf_free (seqend->linetype);
+        dxf_free (seqend->layer);
         dxf_binary_graphics_data_free_list (seqend->binary_graphics_data);
-        free (seqend->dictionary_owner_soft);
-        free (seqend->material);
-        free (seqend->dictionary_owner_hard);
-        free (seqend->plot_style_name);
-        free (seqend->color_name);
-        free (seqend->app_name);
-        free (seqend);
+        dxf_free (seqend->dictionary_owner_soft);
+        dxf_free (seqend->material);
+        dxf_free (seqend->dictionary_owner_hard);
+        dxf_free (seqend->plot_style_name);
+        dxf_free (seqend->color_name);
+        dxf_free (seqend->app_name);
+        dxf_free (seqend);
         seqend = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -725,7 +731,7 @@ dxf_seqend_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (seqend->linetype));
+        return (dxf_strdup (seqend->linetype));
 }
 
 
@@ -760,7 +766,7 @@ dxf_seqend_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        seqend->linetype = strdup (linetype);
+        seqend->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -801,7 +807,7 @@ dxf_seqend_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (seqend->layer));
+        return (dxf_strdup (seqend->layer));
 }
 
 
@@ -836,7 +842,7 @@ dxf_seqend_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        seqend->layer = strdup (layer);
+        seqend->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1607,7 +1613,7 @@ dxf_seqend_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (seqend->dictionary_owner_soft));
+        return (dxf_strdup (seqend->dictionary_owner_soft));
 }
 
 
@@ -1643,7 +1649,7 @@ dxf_seqend_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        seqend->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        seqend->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1687,7 +1693,7 @@ dxf_seqend_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (seqend->material));
+        return (dxf_strdup (seqend->material));
 }
 
 
@@ -1725,7 +1731,7 @@ dxf_seqend_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        seqend->material = strdup (material);
+        seqend->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1769,7 +1775,7 @@ dxf_seqend_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (seqend->dictionary_owner_hard));
+        return (dxf_strdup (seqend->dictionary_owner_hard));
 }
 
 
@@ -1805,7 +1811,7 @@ dxf_seqend_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        seqend->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        seqend->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1912,7 +1918,7 @@ dxf_seqend_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (seqend->plot_style_name));
+        return (dxf_strdup (seqend->plot_style_name));
 }
 
 
@@ -1950,7 +1956,7 @@ dxf_seqend_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        seqend->plot_style_name = strdup (plot_style_name);
+        seqend->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2057,7 +2063,7 @@ dxf_seqend_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (seqend->color_name));
+        return (dxf_strdup (seqend->color_name));
 }
 
 
@@ -2095,7 +2101,7 @@ dxf_seqend_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        seqend->color_name = strdup (color_name);
+        seqend->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2202,7 +2208,7 @@ dxf_seqend_get_app_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (seqend->app_name));
+        return (dxf_strdup (seqend->app_name));
 }
 
 
@@ -2240,7 +2246,7 @@ dxf_seqend_set_app_name
                   __FUNCTION__);
                 return (NULL);
         }
-        seqend->app_name = strdup (app_name);
+        seqend->app_name = dxf_strdup (app_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -64,7 +64,7 @@ dxf_shape_new ()
         size = sizeof (DxfShape);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((shape = malloc (size)) == NULL)
+        if ((shape = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfShape struct.\n")),
@@ -102,21 +102,21 @@ dxf_shape_init
         /* Do some basic checks. */
         if (shape == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 shape = dxf_shape_new ();
         }
         if (shape == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfShape struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         shape->id_code = 0;
-        shape->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        shape->layer = strdup (DXF_DEFAULT_LAYER);
+        shape->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        shape->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         shape->elevation = 0.0;
         shape->thickness = 0.0;
         shape->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -127,15 +127,15 @@ dxf_shape_init
         shape->shadow_mode = 0;
         shape->binary_graphics_data = dxf_binary_graphics_data_new ();
         shape->binary_graphics_data = dxf_binary_graphics_data_init (shape->binary_graphics_data);
-        shape->dictionary_owner_soft = strdup ("");
-        shape->material = strdup ("");
-        shape->dictionary_owner_hard = strdup ("");
+        shape->dictionary_owner_soft = dxf_strdup ("");
+        shape->material = dxf_strdup ("");
+        shape->dictionary_owner_hard = dxf_strdup ("");
         shape->lineweight = 0;
-        shape->plot_style_name = strdup ("");
+        shape->plot_style_name = dxf_strdup ("");
         shape->color_value = 0;
-        shape->color_name = strdup ("");
+        shape->color_name = dxf_strdup ("");
         shape->transparency = 0;
-        shape->shape_name = strdup ("");
+        shape->shape_name = dxf_strdup ("");
         shape->p0->x0 = 0.0;
         shape->p0->y0 = 0.0;
         shape->p0->z0 = 0.0;
@@ -177,21 +177,21 @@ dxf_shape_read
         DXF_DEBUG_BEGIN
 #endif
         char *temp_string = NULL;
-        char *dxf_entity_name = strdup ("SHAPE");
+        char *dxf_entity_name = dxf_strdup ("SHAPE");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (shape == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 shape = dxf_shape_init (shape);
@@ -202,12 +202,12 @@ dxf_shape_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "2") == 0)
@@ -345,7 +345,7 @@ dxf_shape_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbShape") != 0)))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -383,9 +383,8 @@ dxf_shape_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, shape->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) shape->binary_graphics_data->next);
-                        shape->binary_graphics_data = (DxfBinaryGraphicsData *) shape->binary_graphics_data->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_graphics_data_append_hex ((DxfBinaryGraphicsData *) shape->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -451,29 +450,30 @@ dxf_shape_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (shape->shape_name, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty name string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, shape->id_code);
                 return (NULL);
         }
         if (strcmp (shape->linetype, "") == 0)
         {
-                shape->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                shape->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (shape->layer, "") == 0)
         {
-                shape->layer = strdup (DXF_DEFAULT_LAYER);
+                shape->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -499,65 +499,65 @@ dxf_shape_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("SHAPE");
+        char *dxf_entity_name = dxf_strdup ("SHAPE");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (shape == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (shape->shape_name, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty name string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, shape->id_code);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (shape->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, shape->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                shape->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                shape->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (shape->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, shape->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                shape->layer = strdup (DXF_DEFAULT_LAYER);
+                shape->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (shape->size == 0.0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () size has a value of 0.0 for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, shape->id_code);
         }
         if (shape->rel_x_scale == 0.0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning: in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, shape->id_code);
         }
@@ -644,16 +644,7 @@ dxf_shape_write
 #else
                 fprintf (fp->fp, " 92\n%d\n", shape->graphics_data_size);
 #endif
-                if (shape->binary_graphics_data != NULL)
-                {
-                        DxfBinaryGraphicsData *iter;
-                        iter = (DxfBinaryGraphicsData *) shape->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (iter));
-                                iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (iter);
-                        }
-                }
+                dxf_binary_graphics_data_write (fp, (DxfBinaryGraphicsData *) shape->binary_graphics_data);
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
@@ -701,7 +692,7 @@ dxf_shape_write
                 fprintf (fp->fp, "230\n%f\n", shape->extr_z0);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -730,29 +721,29 @@ dxf_shape_free
         /* Do some basic checks. */
         if (shape == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (shape->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (shape->linetype);
-        free (shape->layer);
+        dxf_free (shape->linetype);
+        dxf_free (shape->layer);
         dxf_binary_graphics_data_free_list (shape->binary_graphics_data);
-        free (shape->dictionary_owner_soft);
-        free (shape->material);
-        free (shape->dictionary_owner_hard);
-        free (shape->plot_style_name);
-        free (shape->color_name);
-        free (shape->shape_name);
+        dxf_free (shape->dictionary_owner_soft);
+        dxf_free (shape->material);
+        dxf_free (shape->dictionary_owner_hard);
+        dxf_free (shape->plot_style_name);
+        dxf_free (shape->color_name);
+        dxf_free (shape->shape_name);
         dxf_point_free (shape->p0);
-        free (shape);
+        dxf_free (shape);
         shape = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -773,18 +764,19 @@ dxf_shape_free_list
                  * \c SHAPE entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (shapes == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (shapes != NULL)
         {
                 DxfShape *iter = (DxfShape *) shapes->next;
+                shapes->next = NULL;
                 dxf_shape_free (shapes);
                 shapes = (DxfShape *) iter;
         }
@@ -902,7 +894,7 @@ dxf_shape_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (shape->linetype));
+        return (dxf_strdup (shape->linetype));
 }
 
 
@@ -937,7 +929,7 @@ dxf_shape_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        shape->linetype = strdup (linetype);
+        shape->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -978,7 +970,7 @@ dxf_shape_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (shape->layer));
+        return (dxf_strdup (shape->layer));
 }
 
 
@@ -1013,7 +1005,7 @@ dxf_shape_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        shape->layer = strdup (layer);
+        shape->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1770,7 +1762,7 @@ dxf_shape_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (shape->dictionary_owner_soft));
+        return (dxf_strdup (shape->dictionary_owner_soft));
 }
 
 
@@ -1806,7 +1798,7 @@ dxf_shape_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        shape->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        shape->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1850,7 +1842,7 @@ dxf_shape_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (shape->material));
+        return (dxf_strdup (shape->material));
 }
 
 
@@ -1888,7 +1880,7 @@ dxf_shape_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        shape->material = strdup (material);
+        shape->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1932,7 +1924,7 @@ dxf_shape_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (shape->dictionary_owner_hard));
+        return (dxf_strdup (shape->dictionary_owner_hard));
 }
 
 
@@ -1968,7 +1960,7 @@ dxf_shape_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        shape->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        shape->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2075,7 +2067,7 @@ dxf_shape_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (shape->plot_style_name));
+        return (dxf_strdup (shape->plot_style_name));
 }
 
 
@@ -2113,7 +2105,7 @@ dxf_shape_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        shape->plot_style_name = strdup (plot_style_name);
+        shape->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2220,7 +2212,7 @@ dxf_shape_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (shape->color_name));
+        return (dxf_strdup (shape->color_name));
 }
 
 
@@ -2258,7 +2250,7 @@ dxf_shape_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        shape->color_name = strdup (color_name);
+        shape->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2343,7 +2335,7 @@ dxf_shape_get_p0
                 /*!< a pointer to a DXF \c SHAPE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2382,7 +2374,7 @@ dxf_shape_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2421,7 +2413,7 @@ dxf_shape_get_x0
                 /*!< a pointer to a DXF \c SHAPE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2464,7 +2456,7 @@ dxf_shape_set_x0
                  * \c SHAPE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2503,7 +2495,7 @@ dxf_shape_get_y0
                 /*!< a pointer to a DXF \c SHAPE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2546,7 +2538,7 @@ dxf_shape_set_y0
                  * \c SHAPE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2585,7 +2577,7 @@ dxf_shape_get_z0
                 /*!< a pointer to a DXF \c SHAPE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2628,7 +2620,7 @@ dxf_shape_set_z0
                  * \c SHAPE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2666,7 +2658,7 @@ dxf_shape_get_size
                 /*!< a pointer to a DXF \c SHAPE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2700,7 +2692,7 @@ dxf_shape_set_size
                 /*!< the \c size of a DXF \c SHAPE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2731,7 +2723,7 @@ dxf_shape_get_rel_x_scale
                 /*!< a pointer to a DXF \c SHAPE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2765,7 +2757,7 @@ dxf_shape_set_rel_x_scale
                 /*!< the \c rel_x_scale of a DXF \c SHAPE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2796,7 +2788,7 @@ dxf_shape_get_rot_angle
                 /*!< a pointer to a DXF \c SHAPE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2830,7 +2822,7 @@ dxf_shape_set_rot_angle
                 /*!< the \c rot_angle of a DXF \c SHAPE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2861,7 +2853,7 @@ dxf_shape_get_obl_angle
                 /*!< a pointer to a DXF \c SHAPE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2895,7 +2887,7 @@ dxf_shape_set_obl_angle
                 /*!< the \c obl_angle of a DXF \c SHAPE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2927,7 +2919,7 @@ dxf_shape_get_extr_x0
                 /*!< a pointer to a DXF \c SHAPE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2963,7 +2955,7 @@ dxf_shape_set_extr_x0
                  * DXF \c SHAPE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2995,7 +2987,7 @@ dxf_shape_get_extr_y0
                 /*!< a pointer to a DXF \c SHAPE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3031,7 +3023,7 @@ dxf_shape_set_extr_y0
                  * DXF \c SHAPE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3063,7 +3055,7 @@ dxf_shape_get_extr_z0
                 /*!< a pointer to a DXF \c SHAPE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3099,7 +3091,7 @@ dxf_shape_set_extr_z0
                  * DXF \c SHAPE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -70,7 +70,7 @@ dxf_sortentstable_new ()
         size = sizeof (DxfSortentsTable);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((sortentstable = malloc (size)) == NULL)
+        if ((sortentstable = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfSortentsTable struct.\n")),
@@ -108,22 +108,22 @@ dxf_sortentstable_init
         /* Do some basic checks. */
         if (sortentstable == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 sortentstable = dxf_sortentstable_new ();
         }
         if (sortentstable == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfSortentsTable struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         sortentstable->id_code = 0;
-        sortentstable->dictionary_owner_soft = strdup ("");
-        sortentstable->dictionary_owner_hard = strdup ("");
-        sortentstable->block_owner = strdup ("");
+        sortentstable->dictionary_owner_soft = dxf_strdup ("");
+        sortentstable->dictionary_owner_hard = dxf_strdup ("");
+        sortentstable->block_owner = dxf_strdup ("");
         sortentstable->entity_owner = dxf_char_init (sortentstable->entity_owner);
         sortentstable->sort_handle->value = 0;
         sortentstable->next = NULL;
@@ -167,22 +167,22 @@ dxf_sortentstable_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (sortentstable == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 sortentstable = dxf_sortentstable_init (sortentstable);
@@ -198,11 +198,11 @@ dxf_sortentstable_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -233,7 +233,7 @@ dxf_sortentstable_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "AcDbSortentsTable") != 0)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -284,13 +284,14 @@ dxf_sortentstable_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -316,32 +317,32 @@ dxf_sortentstable_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("SORTENTSTABLE");
+        char *dxf_entity_name = dxf_strdup ("SORTENTSTABLE");
         DxfInt *iter_5 = NULL;
         DxfChar *iter_331 = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (sortentstable == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, sortentstable->id_code);
         }
@@ -399,7 +400,7 @@ dxf_sortentstable_write
                 }
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -428,23 +429,23 @@ dxf_sortentstable_free
         /* Do some basic checks. */
         if (sortentstable == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (sortentstable->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (sortentstable->dictionary_owner_soft);
-        free (sortentstable->dictionary_owner_hard);
-        free (sortentstable->block_owner);
+        dxf_free (sortentstable->dictionary_owner_soft);
+        dxf_free (sortentstable->dictionary_owner_hard);
+        dxf_free (sortentstable->block_owner);
         dxf_char_free_list (sortentstable->entity_owner);
-        free (sortentstable);
+        dxf_free (sortentstable);
         sortentstable = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -465,18 +466,19 @@ dxf_sortentstable_free_list
                  * \c SORTENTSTABLE objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (sortentstables == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (sortentstables != NULL)
         {
                 DxfSortentsTable *iter = (DxfSortentsTable *) sortentstables->next;
+                sortentstables->next = NULL;
                 dxf_sortentstable_free (sortentstables);
                 sortentstables = (DxfSortentsTable *) iter;
         }
@@ -597,7 +599,7 @@ dxf_sortentstable_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sortentstable->dictionary_owner_soft));
+        return (dxf_strdup (sortentstable->dictionary_owner_soft));
 }
 
 
@@ -633,7 +635,7 @@ dxf_sortentstable_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        sortentstable->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        sortentstable->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -677,7 +679,7 @@ dxf_sortentstable_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sortentstable->dictionary_owner_hard));
+        return (dxf_strdup (sortentstable->dictionary_owner_hard));
 }
 
 
@@ -713,7 +715,7 @@ dxf_sortentstable_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        sortentstable->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        sortentstable->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -757,7 +759,7 @@ dxf_sortentstable_get_block_owner
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sortentstable->block_owner));
+        return (dxf_strdup (sortentstable->block_owner));
 }
 
 
@@ -793,7 +795,7 @@ dxf_sortentstable_set_block_owner
                   __FUNCTION__);
                 return (NULL);
         }
-        sortentstable->block_owner = strdup (block_owner);
+        sortentstable->block_owner = dxf_strdup (block_owner);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -974,7 +976,7 @@ dxf_sortentstable_get_entity_owner_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (entity_owner->value));
+        return (dxf_strdup (entity_owner->value));
 }
 
 
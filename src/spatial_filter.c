@@ -61,7 +61,7 @@ dxf_spatial_filter_new ()
         size = sizeof (DxfSpatialFilter);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((spatial_filter = malloc (size)) == NULL)
+        if ((spatial_filter = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfSpatialFilter struct.\n")),
@@ -101,21 +101,21 @@ dxf_spatial_filter_init
         /* Do some basic checks. */
         if (spatial_filter == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 spatial_filter = dxf_spatial_filter_new ();
         }
         if (spatial_filter == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfSpatialFilter struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         spatial_filter->id_code = 0;
-        spatial_filter->dictionary_owner_soft = strdup ("");
-        spatial_filter->dictionary_owner_hard = strdup ("");
+        spatial_filter->dictionary_owner_soft = dxf_strdup ("");
+        spatial_filter->dictionary_owner_hard = dxf_strdup ("");
         spatial_filter->p0 = dxf_point_new ();
         spatial_filter->p0 = dxf_point_init (spatial_filter->p0);
         spatial_filter->p0->x0 = 0.0;
@@ -178,22 +178,22 @@ dxf_spatial_filter_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (spatial_filter == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 spatial_filter = dxf_spatial_filter_init (spatial_filter);
@@ -207,11 +207,11 @@ dxf_spatial_filter_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -338,7 +338,7 @@ dxf_spatial_filter_read
                         if ((strcmp (temp_string, "AcDbFilter") != 0)
                           && (strcmp (temp_string, "AcDbSpatialFilter") != 0))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -391,13 +391,14 @@ dxf_spatial_filter_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -423,44 +424,44 @@ dxf_spatial_filter_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("SPATIAL_FILTER");
+        char *dxf_entity_name = dxf_strdup ("SPATIAL_FILTER");
         int i;
         DxfPoint *iter_p0 = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (spatial_filter == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (spatial_filter->number_of_points < 2)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () number of the clip boundary definition points is too small.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\tThe %s object with id-code %x is dropped from output.\n")),
                   dxf_entity_name, spatial_filter->id_code);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, spatial_filter->id_code);
         }
@@ -542,7 +543,7 @@ dxf_spatial_filter_write
                 fprintf (fp->fp, " 40\n%f\n", spatial_filter->block_transformation[i]);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -571,21 +572,21 @@ dxf_spatial_filter_free
         /* Do some basic checks. */
         if (spatial_filter == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (spatial_filter->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (spatial_filter->dictionary_owner_soft);
-        free (spatial_filter->dictionary_owner_hard);
-        free (spatial_filter);
+        dxf_free (spatial_filter->dictionary_owner_soft);
+        dxf_free (spatial_filter->dictionary_owner_hard);
+        dxf_free (spatial_filter);
         spatial_filter = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -606,18 +607,19 @@ dxf_spatial_filter_free_list
                  * \c SPATIAL_FILTER objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (spatial_filters == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (spatial_filters != NULL)
         {
                 DxfSpatialFilter *iter = (DxfSpatialFilter *) spatial_filters->next;
+                spatial_filters->next = NULL;
                 dxf_spatial_filter_free (spatial_filters);
                 spatial_filters = (DxfSpatialFilter *) iter;
         }
@@ -738,7 +740,7 @@ dxf_spatial_filter_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spatial_filter->dictionary_owner_soft));
+        return (dxf_strdup (spatial_filter->dictionary_owner_soft));
 }
 
 
@@ -774,7 +776,7 @@ dxf_spatial_filter_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        spatial_filter->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        spatial_filter->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -818,7 +820,7 @@ dxf_spatial_filter_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spatial_filter->dictionary_owner_hard));
+        return (dxf_strdup (spatial_filter->dictionary_owner_hard));
 }
 
 
@@ -854,7 +856,7 @@ dxf_spatial_filter_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        spatial_filter->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        spatial_filter->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -875,7 +877,7 @@ dxf_spatial_filter_get_p0
                 /*!< a pointer to a DXF \c SPATIAL_FILTER object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -915,7 +917,7 @@ dxf_spatial_filter_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -954,7 +956,7 @@ dxf_spatial_filter_get_x0
                 /*!< a pointer to a DXF \c SPATIAL_FILTER object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -997,7 +999,7 @@ dxf_spatial_filter_set_x0
                  * \c x0 of a DXF \c SPATIAL_FILTER object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1036,7 +1038,7 @@ dxf_spatial_filter_get_y0
                 /*!< a pointer to a DXF \c SPATIAL_FILTER object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1079,7 +1081,7 @@ dxf_spatial_filter_set_y0
                  * \c y0 of a DXF \c SPATIAL_FILTER object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1120,7 +1122,7 @@ dxf_spatial_filter_get_p0_next
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1165,7 +1167,7 @@ dxf_spatial_filter_set_p0_next
                  * DXF \c SPATIAL_FILTER object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1204,7 +1206,7 @@ dxf_spatial_filter_get_p1
                 /*!< a pointer to a DXF \c SPATIAL_FILTER object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1244,7 +1246,7 @@ dxf_spatial_filter_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1285,7 +1287,7 @@ dxf_spatial_filter_get_x1
                 /*!< a pointer to a DXF \c SPATIAL_FILTER object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1330,7 +1332,7 @@ dxf_spatial_filter_set_x1
                  * \c SPATIAL_FILTER object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1371,7 +1373,7 @@ dxf_spatial_filter_get_y1
                 /*!< a pointer to a DXF \c SPATIAL_FILTER object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1416,7 +1418,7 @@ dxf_spatial_filter_set_y1
                  * \c SPATIAL_FILTER object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1457,7 +1459,7 @@ dxf_spatial_filter_get_z1
                 /*!< a pointer to a DXF \c SPATIAL_FILTER object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1502,7 +1504,7 @@ dxf_spatial_filter_set_z1
                  * \c SPATIAL_FILTER object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1562,7 +1564,7 @@ dxf_spatial_filter_get_front_clipping_plane_distance
                 /*!< a pointer to a DXF \c SPATIAL_FILTER object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1599,7 +1601,7 @@ dxf_spatial_filter_set_front_clipping_plane_distance
                  * \c SPATIAL_FILTER object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1632,7 +1634,7 @@ dxf_spatial_filter_get_back_clipping_plane_distance
                 /*!< a pointer to a DXF \c SPATIAL_FILTER object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1669,7 +1671,7 @@ dxf_spatial_filter_set_back_clipping_plane_distance
                  * \c SPATIAL_FILTER object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2041,7 +2043,7 @@ dxf_spatial_filter_get_extrusion_vector_as_point
                 /*!< a pointer to a DXF \c SPATIAL_FILTER object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *point = NULL;
@@ -2085,7 +2087,7 @@ dxf_spatial_filter_get_extr_x0
                 /*!< a pointer to a DXF \c SPATIAL_FILTER object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2121,7 +2123,7 @@ dxf_spatial_filter_set_extr_x0
                  * DXF \c SPATIAL_FILTER object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2153,7 +2155,7 @@ dxf_spatial_filter_get_extr_y0
                 /*!< a pointer to a DXF \c SPATIAL_FILTER object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2189,7 +2191,7 @@ dxf_spatial_filter_set_extr_y0
                  * DXF \c SPATIAL_FILTER object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2221,7 +2223,7 @@ dxf_spatial_filter_get_extr_z0
                 /*!< a pointer to a DXF \c SPATIAL_FILTER object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2257,7 +2259,7 @@ dxf_spatial_filter_set_extr_z0
                  * DXF \c SPATIAL_FILTER object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
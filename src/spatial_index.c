@@ -64,7 +64,7 @@ dxf_spatial_index_new ()
         size = sizeof (DxfSpatialIndex);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((spatial_index = malloc (size)) == NULL)
+        if ((spatial_index = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfSpatialIndex struct.\n")),
@@ -104,26 +104,27 @@ dxf_spatial_index_init
         /* Do some basic checks. */
         if (spatial_index == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 spatial_index = dxf_spatial_index_new ();
         }
         if (spatial_index == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfSpatialIndex struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         spatial_index->id_code = 0;
-        spatial_index->dictionary_owner_soft = strdup ("");
-        spatial_index->dictionary_owner_hard = strdup ("");
+        spatial_index->dictionary_owner_soft = dxf_strdup ("");
+        spatial_index->dictionary_owner_hard = dxf_strdup ("");
         if (time (&now) != (time_t)(-1))
         {
                 float fraction_day;
                 int JD;
-                struct tm *current_time = localtime (&now);
+                struct tm local_time;
+                struct tm *current_time = localtime_r (&now, &local_time);
 
                 /* Transform the current local gregorian date in a julian date.*/
                 JD = current_time->tm_mday - 32075 + 1461 * (current_time->tm_year + 6700 + (current_time->tm_mon - 13) / 12) / 4 + 367 * (current_time->tm_mon - 1 - (current_time->tm_mon - 13) / 12 * 12) / 12 - 3 * ((current_time->tm_year + 6800 + (current_time->tm_mon - 13) / 12) / 100) / 4;
@@ -168,22 +169,22 @@ dxf_spatial_index_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (spatial_index == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 spatial_index = dxf_spatial_index_init (spatial_index);
@@ -194,11 +195,11 @@ dxf_spatial_index_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -226,7 +227,7 @@ dxf_spatial_index_read
                         if ((strcmp (temp_string, "AcDbIndex") != 0)
                           && (strcmp (temp_string, "AcDbSpatialIndex") != 0))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -254,13 +255,14 @@ dxf_spatial_index_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -289,30 +291,30 @@ dxf_spatial_index_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("SPATIAL_INDEX");
+        char *dxf_entity_name = dxf_strdup ("SPATIAL_INDEX");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (spatial_index == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, spatial_index->id_code);
         }
@@ -356,7 +358,7 @@ dxf_spatial_index_write
                 fprintf (fp->fp, "100\nAcDbSpatialIndex\n");
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -385,21 +387,21 @@ dxf_spatial_index_free
         /* Do some basic checks. */
         if (spatial_index == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (spatial_index->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (spatial_index->dictionary_owner_soft);
-        free (spatial_index->dictionary_owner_hard);
-        free (spatial_index);
+        dxf_free (spatial_index->dictionary_owner_soft);
+        dxf_free (spatial_index->dictionary_owner_hard);
+        dxf_free (spatial_index);
         spatial_index = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -420,18 +422,19 @@ dxf_spatial_index_free_list
                  * \c SPATIAL_INDEX objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (spatial_indices == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (spatial_indices != NULL)
         {
                 DxfSpatialIndex *iter = (DxfSpatialIndex *) spatial_indices->next;
+                spatial_indices->next = NULL;
                 dxf_spatial_index_free (spatial_indices);
                 spatial_indices = (DxfSpatialIndex *) iter;
         }
@@ -552,7 +555,7 @@ dxf_spatial_index_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spatial_index->dictionary_owner_soft));
+        return (dxf_strdup (spatial_index->dictionary_owner_soft));
 }
 
 
@@ -588,7 +591,7 @@ dxf_spatial_index_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        spatial_index->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        spatial_index->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -632,7 +635,7 @@ dxf_spatial_index_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spatial_index->dictionary_owner_hard));
+        return (dxf_strdup (spatial_index->dictionary_owner_hard));
 }
 
 
@@ -668,7 +671,7 @@ dxf_spatial_index_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        spatial_index->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        spatial_index->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -689,7 +692,7 @@ dxf_spatial_index_get_time_stamp
                 /*!< a pointer to a DXF \c SPATIAL_INDEX object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -725,7 +728,7 @@ dxf_spatial_index_set_time_stamp
                  * \c SPATIAL_INDEX object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
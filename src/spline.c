@@ -231,6 +231,7 @@
 
 
 #include "spline.h"
+#include "nurbs.h"
 
 
 /*!
@@ -253,7 +254,7 @@ dxf_spline_new ()
         size = sizeof (DxfSpline);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((spline = malloc (size)) == NULL)
+        if ((spline = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfSpline struct.\n")),
@@ -291,21 +292,21 @@ dxf_spline_init
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 spline = dxf_spline_new ();
         }
         if (spline == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfSpline struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         spline->id_code = 0;
-        spline->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        spline->layer = strdup (DXF_DEFAULT_LAYER);
+        spline->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        spline->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         spline->elevation = 0.0;
         spline->thickness = 0.0;
         spline->linetype_scale = 1.0;
@@ -315,13 +316,13 @@ dxf_spline_init
         spline->graphics_data_size = 0;
         spline->shadow_mode = 0;
         dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) spline->binary_graphics_data);
-        spline->dictionary_owner_soft = strdup ("");
-        spline->material = strdup ("");
-        spline->dictionary_owner_hard = strdup ("");
+        spline->dictionary_owner_soft = dxf_strdup ("");
+        spline->material = dxf_strdup ("");
+        spline->dictionary_owner_hard = dxf_strdup ("");
         spline->lineweight = 0;
-        spline->plot_style_name = strdup ("");
+        spline->plot_style_name = dxf_strdup ("");
         spline->color_value = 0;
-        spline->color_name = strdup ("");
+        spline->color_name = dxf_strdup ("");
         spline->transparency = 0;
         spline->p0 = dxf_point_new ();
         spline->p0 = dxf_point_init (spline->p0);
@@ -379,51 +380,49 @@ dxf_spline_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryGraphicsData *binary_graphics_data = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         DxfPoint *p0 = NULL;
         DxfPoint *p1 = NULL;
         DxfPoint *p2 = NULL;
         DxfPoint *p3 = NULL;
+        int number_of_control_points = 0;
+        int number_of_fit_points = 0;
+        int number_of_knots = 0;
+        int number_of_weights = 0;
         DxfDouble *kv = NULL; /* knot_value iter. */
         DxfDouble *wv = NULL; /* weight value iter. */
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (spline == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 spline = dxf_spline_init (spline);
         }
-        binary_graphics_data = (DxfBinaryGraphicsData *) spline->binary_graphics_data;
         p0 = (DxfPoint *) spline->p0;
         p1 = (DxfPoint *) spline->p1;
         p2 = (DxfPoint *) spline->p2;
         p3 = (DxfPoint *) spline->p3;
         kv = (DxfDouble *) spline->knot_value;
         wv = (DxfDouble *) spline->weight_value;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        memset (temp_string, 0, sizeof (temp_string));
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -438,19 +437,29 @@ dxf_spline_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spline->linetype);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (spline->linetype);
+                        spline->linetype = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spline->layer);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (spline->layer);
+                        spline->layer = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
                         /* Now follows a string containing the
                          * X-value of the control point coordinate
                          * (multiple entries). */
+                        if (number_of_control_points > 0)
+                        {
+                                p0->next = (struct DxfPoint *) dxf_point_init (dxf_point_new ());
+                                p0 = (DxfPoint *) p0->next;
+                        }
+                        number_of_control_points++;
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &p0->x0);
                 }
@@ -469,14 +478,18 @@ dxf_spline_read
                          * (multiple entries). */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &p0->z0);
-                        dxf_point_init ((DxfPoint *) p0->next);
-                        p0 = (DxfPoint *) p0->next;
                 }
                 else if (strcmp (temp_string, "11") == 0)
                 {
                         /* Now follows a string containing the
                          * X-coordinate of the fit point coordinate
                          * (multiple entries). */
+                        if (number_of_fit_points > 0)
+                        {
+                                p1->next = (struct DxfPoint *) dxf_point_init (dxf_point_new ());
+                                p1 = (DxfPoint *) p1->next;
+                        }
+                        number_of_fit_points++;
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &p1->x0);
                 }
@@ -495,8 +508,6 @@ dxf_spline_read
                          * (multiple entries). */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &p1->z0);
-                        dxf_point_init ((DxfPoint *) p1->next);
-                        p1 = (DxfPoint *) p1->next;
                 }
                 else if (strcmp (temp_string, "12") == 0)
                 {
@@ -564,18 +575,26 @@ dxf_spline_read
                 else if (strcmp (temp_string, "40") == 0)
                 {
                         /* Now follows a knot value (one entry per knot, multiple entries). */
+                        if (number_of_knots > 0)
+                        {
+                                kv->next = (struct DxfDouble *) dxf_double_init (dxf_double_new ());
+                                kv = (DxfDouble *) kv->next;
+                        }
+                        number_of_knots++;
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &kv->value);
-                        dxf_double_init ((DxfDouble *) kv->next);
-                        kv = (DxfDouble *) kv->next;
                 }
                 else if (strcmp (temp_string, "41") == 0)
                 {
                         /* Now follows a weight value (one entry per knot, multiple entries). */
+                        if (number_of_weights > 0)
+                        {
+                                wv->next = (struct DxfDouble *) dxf_double_init (dxf_double_new ());
+                                wv = (DxfDouble *) wv->next;
+                        }
+                        number_of_weights++;
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &wv->value);
-                        dxf_double_init ((DxfDouble *) wv->next);
-                        wv = (DxfDouble *) wv->next;
                 }
                 else if (strcmp (temp_string, "42") == 0)
                 {
@@ -666,35 +685,53 @@ dxf_spline_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%hd\n", &spline->shadow_mode);
                 }
+                else if (strcmp (temp_string, "100") == 0)
+                {
+                        /* Now follows a string containing the
+                         * subclass marker value. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        if (strcmp (temp_string, "AcDbHelix") == 0)
+                        {
+                                /* The data of a HELIX entity follows,
+                                 * it is read by dxf_helix_read (). */
+                                break;
+                        }
+                }
                 else if (strcmp (temp_string, "310") == 0)
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) binary_graphics_data->next);
-                        binary_graphics_data = (DxfBinaryGraphicsData *) binary_graphics_data->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_graphics_data_append_hex ((DxfBinaryGraphicsData *) spline->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing a
                          * soft-pointer ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spline->dictionary_owner_soft);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (spline->dictionary_owner_soft);
+                        spline->dictionary_owner_soft = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "347") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spline->material);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (spline->material);
+                        spline->material = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spline->dictionary_owner_hard);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (spline->dictionary_owner_hard);
+                        spline->dictionary_owner_hard = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -708,7 +745,9 @@ dxf_spline_read
                         /* Now follows a string containing a plot style
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spline->plot_style_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (spline->plot_style_name);
+                        spline->plot_style_name = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -721,7 +760,9 @@ dxf_spline_read
                         /* Now follows a string containing a color
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spline->color_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (spline->color_name);
+                        spline->color_name = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -739,22 +780,25 @@ dxf_spline_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
+                        dxf_read_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (spline->linetype, "") == 0)
         {
-                spline->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_free (spline->linetype);
+                spline->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (spline->layer, "") == 0)
         {
-                spline->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_free (spline->layer);
+                spline->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -780,61 +824,60 @@ dxf_spline_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("SPLINE");
+        char *dxf_entity_name = dxf_strdup ("SPLINE");
         int i;
-        DxfBinaryGraphicsData *binary_graphics_data = NULL;
         DxfPoint *p0 = NULL;
         DxfPoint *p1 = NULL;
         DxfPoint *p2 = NULL;
         DxfPoint *p3 = NULL;
+        DxfDouble *value = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (spline == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (strcmp (spline->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, spline->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                spline->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                spline->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (spline->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, spline->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to default layer.\n")),
                   dxf_entity_name);
                 spline->layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
-        binary_graphics_data = (DxfBinaryGraphicsData *) spline->binary_graphics_data;
         p0 = (DxfPoint *) spline->p0;
         p1 = (DxfPoint *) spline->p1;
         p2 = (DxfPoint *) spline->p2;
@@ -910,11 +953,7 @@ dxf_spline_write
         /*!
          * \todo On 64 bit machines use group code 160.
          */
-        while (binary_graphics_data != NULL)
-        {
-                fprintf (fp->fp, "310\n%s\n", binary_graphics_data->data_line);
-                binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (binary_graphics_data);
-        }
+        dxf_binary_graphics_data_write (fp, (DxfBinaryGraphicsData *) spline->binary_graphics_data);
         fprintf (fp->fp, "420\n%" PRIi32 "\n", spline->color_value);
         fprintf (fp->fp, "430\n%s\n", spline->color_name);
         fprintf (fp->fp, "440\n%" PRIi32 "\n", spline->transparency);
@@ -943,35 +982,36 @@ dxf_spline_write
         fprintf (fp->fp, " 13\n%f\n", p3->x0);
         fprintf (fp->fp, " 23\n%f\n", p3->y0);
         fprintf (fp->fp, " 33\n%f\n", p3->z0);
-        for (i = 0; i < spline->number_of_knots; i++)
+        value = (DxfDouble *) spline->knot_value;
+        for (i = 0; (i < spline->number_of_knots) && (value != NULL); i++)
         {
-                fprintf (fp->fp, " 40\n%f\n", spline->knot_value->value);
-                /*! \todo implement as a single linked list of double. */
+                fprintf (fp->fp, " 40\n%f\n", value->value);
+                value = (DxfDouble *) value->next;
         }
-        if (spline->number_of_fit_points != 0)
+        /* Weights are written for a rational spline only. */
+        value = (DxfDouble *) spline->weight_value;
+        for (i = 0; (spline->flag & 4) && (i < spline->number_of_control_points)
+          && (value != NULL); i++)
         {
-        for (i = 0; i < spline->number_of_fit_points; i++)
-                {
-                        fprintf (fp->fp, " 41\n%f\n", spline->weight_value->value);
-                        /*! \todo implement as a single linked list of double. */
-                }
+                fprintf (fp->fp, " 41\n%f\n", value->value);
+                value = (DxfDouble *) value->next;
         }
-        while (spline->p0 != NULL)
+        while (p0 != NULL)
         {
                 fprintf (fp->fp, " 10\n%f\n", p0->x0);
                 fprintf (fp->fp, " 20\n%f\n", p0->y0);
                 fprintf (fp->fp, " 30\n%f\n", p0->z0);
-                p0 = (DxfPoint *) dxf_point_get_next (p0);
+                p0 = (DxfPoint *) p0->next;
         }
-        while (spline->p1 != NULL)
+        while (p1 != NULL)
         {
                 fprintf (fp->fp, " 11\n%f\n", p1->x0);
                 fprintf (fp->fp, " 21\n%f\n", p1->y0);
                 fprintf (fp->fp, " 31\n%f\n", p1->z0);
-                p1 = (DxfPoint *) dxf_point_get_next (p1);
+                p1 = (DxfPoint *) p1->next;
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1000,33 +1040,33 @@ dxf_spline_free
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (spline->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (spline->linetype);
-        free (spline->layer);
+        dxf_free (spline->linetype);
+        dxf_free (spline->layer);
         dxf_binary_graphics_data_free_list ((DxfBinaryGraphicsData *) spline->binary_graphics_data);
-        free (spline->dictionary_owner_soft);
-        free (spline->material);
-        free (spline->dictionary_owner_hard);
-        free (spline->plot_style_name);
-        free (spline->color_name);
+        dxf_free (spline->dictionary_owner_soft);
+        dxf_free (spline->material);
+        dxf_free (spline->dictionary_owner_hard);
+        dxf_free (spline->plot_style_name);
+        dxf_free (spline->color_name);
         dxf_point_free_list (spline->p0);
         dxf_point_free_list (spline->p1);
         dxf_point_free (spline->p2);
         dxf_point_free (spline->p3);
         dxf_double_free_list (spline->knot_value);
         dxf_double_free_list (spline->weight_value);
-        free (spline);
+        dxf_free (spline);
         spline = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -1047,18 +1087,19 @@ dxf_spline_free_list
                  * \c SPLINE entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (splines == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (splines != NULL)
         {
                 DxfSpline *iter = (DxfSpline *) splines->next;
+                splines->next = NULL;
                 dxf_spline_free (splines);
                 splines = (DxfSpline *) iter;
         }
@@ -1179,7 +1220,7 @@ dxf_spline_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spline->linetype));
+        return (dxf_strdup (spline->linetype));
 }
 
 
@@ -1216,7 +1257,7 @@ dxf_spline_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->linetype = strdup (linetype);
+        spline->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1257,7 +1298,7 @@ dxf_spline_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spline->layer));
+        return (dxf_strdup (spline->layer));
 }
 
 
@@ -1294,7 +1335,7 @@ dxf_spline_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->layer = strdup (layer);
+        spline->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2093,7 +2134,7 @@ dxf_spline_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spline->dictionary_owner_soft));
+        return (dxf_strdup (spline->dictionary_owner_soft));
 }
 
 
@@ -2132,7 +2173,7 @@ dxf_spline_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        spline->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2176,7 +2217,7 @@ dxf_spline_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spline->material));
+        return (dxf_strdup (spline->material));
 }
 
 
@@ -2214,7 +2255,7 @@ dxf_spline_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->material = strdup (material);
+        spline->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2259,7 +2300,7 @@ dxf_spline_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spline->dictionary_owner_hard));
+        return (dxf_strdup (spline->dictionary_owner_hard));
 }
 
 
@@ -2298,7 +2339,7 @@ dxf_spline_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        spline->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2405,7 +2446,7 @@ dxf_spline_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spline->plot_style_name));
+        return (dxf_strdup (spline->plot_style_name));
 }
 
 
@@ -2443,7 +2484,7 @@ dxf_spline_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->plot_style_name = strdup (plot_style_name);
+        spline->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2550,7 +2591,7 @@ dxf_spline_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spline->color_name));
+        return (dxf_strdup (spline->color_name));
 }
 
 
@@ -2588,7 +2629,7 @@ dxf_spline_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->color_name = strdup (color_name);
+        spline->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2758,7 +2799,7 @@ dxf_spline_get_x0
                 /*!< a pointer to a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2801,7 +2842,7 @@ dxf_spline_set_x0
                  * to be set for a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2840,7 +2881,7 @@ dxf_spline_get_y0
                 /*!< a pointer to a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2883,7 +2924,7 @@ dxf_spline_set_y0
                  * to be set for a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2922,7 +2963,7 @@ dxf_spline_get_z0
                 /*!< a pointer to a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2965,7 +3006,7 @@ dxf_spline_set_z0
                  * to be set for a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3088,7 +3129,7 @@ dxf_spline_get_x1
                 /*!< a pointer to a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3131,7 +3172,7 @@ dxf_spline_set_x1
                  * to be set for a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3170,7 +3211,7 @@ dxf_spline_get_y1
                 /*!< a pointer to a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3213,7 +3254,7 @@ dxf_spline_set_y1
                  * to be set for a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3252,7 +3293,7 @@ dxf_spline_get_z1
                 /*!< a pointer to a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3295,7 +3336,7 @@ dxf_spline_set_z1
                  * to be set for a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3413,7 +3454,7 @@ dxf_spline_get_x2
                 /*!< a pointer to a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3456,7 +3497,7 @@ dxf_spline_set_x2
                  * to be set for a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3495,7 +3536,7 @@ dxf_spline_get_y2
                 /*!< a pointer to a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3538,7 +3579,7 @@ dxf_spline_set_y2
                  * to be set for a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3577,7 +3618,7 @@ dxf_spline_get_z2
                 /*!< a pointer to a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3620,7 +3661,7 @@ dxf_spline_set_z2
                  * to be set for a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3738,7 +3779,7 @@ dxf_spline_get_x3
                 /*!< a pointer to a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3781,7 +3822,7 @@ dxf_spline_set_x3
                  * to be set for a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3820,7 +3861,7 @@ dxf_spline_get_y3
                 /*!< a pointer to a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3863,7 +3904,7 @@ dxf_spline_set_y3
                  * to be set for a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3902,7 +3943,7 @@ dxf_spline_get_z3
                 /*!< a pointer to a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3945,7 +3986,7 @@ dxf_spline_set_z3
                  * to be set for a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3983,7 +4024,7 @@ dxf_spline_get_knot_tolerance
                 /*!< a pointer to a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4018,7 +4059,7 @@ dxf_spline_set_knot_tolerance
                  * \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4049,7 +4090,7 @@ dxf_spline_get_control_point_tolerance
                 /*!< a pointer to a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4084,7 +4125,7 @@ dxf_spline_set_control_point_tolerance
                  * \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4115,7 +4156,7 @@ dxf_spline_get_fit_tolerance
                 /*!< a pointer to a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4150,7 +4191,7 @@ dxf_spline_set_fit_tolerance
                  * \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4578,7 +4619,7 @@ dxf_spline_get_extrusion_vector_as_point
                 /*!< a pointer to a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *point = NULL;
@@ -4700,7 +4741,7 @@ dxf_spline_get_extr_x0
                 /*!< a pointer to a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4736,7 +4777,7 @@ dxf_spline_set_extr_x0
                  * DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4768,7 +4809,7 @@ dxf_spline_get_extr_y0
                 /*!< a pointer to a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4804,7 +4845,7 @@ dxf_spline_set_extr_y0
                  * DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4836,7 +4877,7 @@ dxf_spline_get_extr_z0
                 /*!< a pointer to a DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4872,7 +4913,7 @@ dxf_spline_set_extr_z0
                  * DXF \c SPLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5015,4 +5056,125 @@ dxf_spline_get_last
 }
 
 
+/*!
+ * \brief Tessellate a DXF \c SPLINE entity into a polyline.
+ *
+ * A new curve is started in \c tessellation and the spline is
+ * evaluated from its control points, weights and knots with
+ * \c dxf_nurbs_tessellate().\n
+ * A spline without control points is approximated by the polyline
+ * through its fit points.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_spline_tessellate
+(
+        DxfSpline *spline,
+                /*!< a pointer to a DXF \c SPLINE entity. */
+        double tolerance,
+                /*!< maximum distance between the spline and the
+                 * polyline (chord tolerance). */
+        DxfTessellation *tessellation
+                /*!< a pointer to the \c DxfTessellation receiving the
+                 * points. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPoint *iter = NULL;
+        DxfDouble *value = NULL;
+        double *cpw = NULL;
+        double *knots = NULL;
+        int number_of_control_points;
+        int number_of_weights;
+        int number_of_knots;
+        int result;
+        int i;
+
+        /* Do some basic checks. */
+        if ((spline == NULL) || (tessellation == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_tessellation_begin_curve (tessellation) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        number_of_control_points = 0;
+        for (iter = spline->p0; iter != NULL; iter = (DxfPoint *) iter->next)
+        {
+                number_of_control_points++;
+        }
+        if (number_of_control_points == 0)
+        {
+                for (iter = spline->p1; iter != NULL; iter = (DxfPoint *) iter->next)
+                {
+                        if (dxf_tessellation_add_point (tessellation,
+                          iter->x0, iter->y0, iter->z0) != EXIT_SUCCESS)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                }
+#if DEBUG
+                DXF_DEBUG_END
+#endif
+                return (EXIT_SUCCESS);
+        }
+        number_of_weights = 0;
+        for (value = spline->weight_value; value != NULL; value = (DxfDouble *) value->next)
+        {
+                number_of_weights++;
+        }
+        number_of_knots = 0;
+        for (value = spline->knot_value; value != NULL; value = (DxfDouble *) value->next)
+        {
+                number_of_knots++;
+        }
+        cpw = dxf_malloc (4 * number_of_control_points * sizeof (double));
+        knots = dxf_malloc ((number_of_knots + 1) * sizeof (double));
+        if ((cpw == NULL) || (knots == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_free (cpw);
+                dxf_free (knots);
+                return (EXIT_FAILURE);
+        }
+        /* Weights are only used when every control point has one. */
+        value = (number_of_weights == number_of_control_points) ? spline->weight_value : NULL;
+        for (iter = spline->p0, i = 0; iter != NULL; iter = (DxfPoint *) iter->next, i++)
+        {
+                cpw[4 * i] = iter->x0;
+                cpw[4 * i + 1] = iter->y0;
+                cpw[4 * i + 2] = iter->z0;
+                cpw[4 * i + 3] = 1.0;
+                if (value != NULL)
+                {
+                        cpw[4 * i + 3] = value->value;
+                        value = (DxfDouble *) value->next;
+                }
+        }
+        for (value = spline->knot_value, i = 0; value != NULL; value = (DxfDouble *) value->next, i++)
+        {
+                knots[i] = value->value;
+        }
+        result = dxf_nurbs_tessellate (spline->degree,
+          number_of_control_points, cpw, number_of_knots, knots,
+          tolerance, tessellation);
+        dxf_free (cpw);
+        dxf_free (knots);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
 /* EOF */
@@ -46,6 +46,7 @@
 #include "global.h"
 #include "binary_graphics_data.h"
 #include "point.h"
+#include "tessellation.h"
 #include "util.h"
 
 
@@ -348,6 +349,7 @@ DxfSpline *dxf_spline_set_extr_z0 (DxfSpline *spline, double extr_z0);
 DxfSpline *dxf_spline_get_next (DxfSpline *spline);
 DxfSpline *dxf_spline_set_next (DxfSpline *spline, DxfSpline *next);
 DxfSpline *dxf_spline_get_last (DxfSpline *spline);
+int dxf_spline_tessellate (DxfSpline *spline, double tolerance, DxfTessellation *tessellation);
 
 
 #ifdef __cplusplus
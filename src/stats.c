@@ -0,0 +1,280 @@
+/*!
+ * \file stats.c
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for the runtime statistics of a DXF file.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "stats.h"
+
+
+/*!
+ * \brief Names of the sections, in the order of the \c DxfStatsSection
+ * enumeration.
+ */
+static const char *dxf_stats_section_names[] =
+{
+        "HEADER",
+        "CLASSES",
+        "TABLES",
+        "BLOCKS",
+        "ENTITIES",
+        "OBJECTS",
+        "THUMBNAIL"
+};
+
+
+/*!
+ * \brief Allocate memory for a \c DxfStats.
+ *
+ * Fill the memory contents with zeros.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfStats *
+dxf_stats_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfStats *stats = NULL;
+        size_t size;
+
+        size = sizeof (DxfStats);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((stats = dxf_malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                stats = NULL;
+        }
+        else
+        {
+                memset (stats, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (stats);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize a \c DxfStats with all
+ * counters set to zero.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfStats *
+dxf_stats_init
+(
+        DxfStats *stats
+                /*!< a pointer to a \c DxfStats. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (stats == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                stats = dxf_stats_new ();
+        }
+        if (stats == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (stats, 0, sizeof (DxfStats));
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (stats);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfStats.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_stats_free
+(
+        DxfStats *stats
+                /*!< a pointer to the memory occupied by the
+                 * \c DxfStats. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (stats == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_free (stats);
+        stats = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the time of a monotonic clock, for timing intervals.
+ *
+ * \return the time in nanoseconds.
+ */
+int64_t
+dxf_stats_now ()
+{
+        struct timespec now;
+
+#if defined (_WIN32)
+        timespec_get (&now, TIME_UTC);
+#else
+        clock_gettime (CLOCK_MONOTONIC, &now);
+#endif
+        return ((int64_t) now.tv_sec * 1000000000 + (int64_t) now.tv_nsec);
+}
+
+
+/*!
+ * \brief Get the name of a section.
+ *
+ * \return the name of the section, \c "UNKNOWN" for an unknown section.
+ */
+const char *
+dxf_stats_get_section_name
+(
+        DxfStatsSection section
+                /*!< the section. */
+)
+{
+        if ((section < DXF_STATS_SECTION_HEADER)
+          || (section >= DXF_STATS_NUMBER_OF_SECTIONS))
+        {
+                return ("UNKNOWN");
+        }
+        return (dxf_stats_section_names[section]);
+}
+
+
+/*!
+ * \brief Print a report of the statistics of a DXF file.
+ *
+ * Only sections and entity types with a non zero count are reported.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_stats_print
+(
+        FILE *out,
+                /*!< the stream to print to. */
+        DxfStats *stats
+                /*!< a pointer to a \c DxfStats. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        /* Do some basic checks. */
+        if ((out == NULL) || (stats == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        fprintf (out, "bytes read: %" PRId64 "\n", stats->bytes_read);
+        fprintf (out, "lines read: %" PRId64 "\n", stats->lines_read);
+        for (i = 0; i < DXF_STATS_NUMBER_OF_SECTIONS; i++)
+        {
+                if (stats->section_count[i] > 0)
+                {
+                        fprintf (out, "section %s: %" PRId64 " x, %.3f ms\n",
+                          dxf_stats_section_names[i],
+                          stats->section_count[i],
+                          stats->section_nanoseconds[i] / 1e6);
+                }
+        }
+        for (i = 0; i < DXF_STATS_NUMBER_OF_ENTITY_TYPES; i++)
+        {
+                if (stats->entities_read[i] > 0)
+                {
+                        fprintf (out, "entity %s: %" PRId64 " read, %.3f ms, %.0f ns/entity\n",
+                          dxf_entity_get_name ((DxfEntityType) i),
+                          stats->entities_read[i],
+                          stats->entity_nanoseconds[i] / 1e6,
+                          (double) stats->entity_nanoseconds[i] / stats->entities_read[i]);
+                }
+        }
+        fprintf (out, "entities skipped: %" PRId64 "\n", stats->entities_skipped);
+        fprintf (out, "allocations: %" PRId64 "\n", stats->allocations);
+        fprintf (out, "unknown group codes: %" PRId64 "\n", stats->unknown_group_codes);
+        fprintf (out, "skipped group codes: %" PRId64 "\n", stats->skipped_group_codes);
+        fprintf (out, "bytes written: %" PRId64 "\n", stats->bytes_written);
+        for (i = 0; i < DXF_STATS_NUMBER_OF_ENTITY_TYPES; i++)
+        {
+                if (stats->entities_written[i] > 0)
+                {
+                        fprintf (out, "entity %s: %" PRId64 " written\n",
+                          dxf_entity_get_name ((DxfEntityType) i),
+                          stats->entities_written[i]);
+                }
+        }
+        fprintf (out, "write time: %.3f ms\n", stats->write_nanoseconds / 1e6);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/* EOF */
@@ -69,7 +69,7 @@ dxf_style_new ()
         size = sizeof (DxfStyle);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((style = malloc (size)) == NULL)
+        if ((style = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfStyle struct.\n")),
@@ -107,30 +107,30 @@ dxf_style_init
         /* Do some basic checks. */
         if (style == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 style = dxf_style_new ();
         }
         if (style == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfStyle struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         style->id_code = 0;
-        style->style_name = strdup ("");
-        style->primary_font_filename = strdup ("");
-        style->big_font_filename = strdup ("");
+        style->style_name = dxf_strdup ("");
+        style->primary_font_filename = dxf_strdup ("");
+        style->big_font_filename = dxf_strdup ("");
         style->height = 0.0;
         style->width = 0.0;
         style->last_height = 0.0;
         style->oblique_angle = 0.0;
         style->flag = 0;
         style->text_generation_flag = 0;
-        style->dictionary_owner_soft = strdup ("");
-        style->dictionary_owner_hard = strdup ("");
+        style->dictionary_owner_soft = dxf_strdup ("");
+        style->dictionary_owner_hard = dxf_strdup ("");
         style->ttf_flags = 0;
         style->next = NULL;
 #if DEBUG
@@ -168,16 +168,16 @@ dxf_style_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (style == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 style = dxf_style_init (style);
@@ -188,12 +188,12 @@ dxf_style_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -275,7 +275,7 @@ dxf_style_read
                         if ((strcmp (temp_string, "AcDbSymbolTableRecord") != 0)
                         && ((strcmp (temp_string, "AcDbTextStyleTableRecord") != 0)))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -309,16 +309,17 @@ dxf_style_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (style->style_name, "") == 0)
         {
                 sprintf (style->style_name, "%i", style->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal style name value found while reading from: %s in line: %d.\n")),
                   __FUNCTION__, fp->filename, fp->line_number);
         }
@@ -326,12 +327,12 @@ dxf_style_read
           && (style->flag == 1))
         {
                 sprintf (style->primary_font_filename, "%i", style->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal primary font filename value found while reading from: %s in line: %d.\n")),
                   __FUNCTION__, fp->filename, fp->line_number);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -357,25 +358,25 @@ dxf_style_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("STYLE");
+        char *dxf_entity_name = dxf_strdup ("STYLE");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (style == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
@@ -424,7 +425,7 @@ dxf_style_write
         fprintf (fp->fp, "  4\n%s\n", style->big_font_filename);
         fprintf (fp->fp, "1071\n%d\n", style->ttf_flags);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -453,24 +454,24 @@ dxf_style_free
         /* Do some basic checks. */
         if (style == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (style->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (style->style_name);
-        free (style->primary_font_filename);
-        free (style->big_font_filename);
-        free (style->dictionary_owner_soft);
-        free (style->dictionary_owner_hard);
-        free (style);
+        dxf_free (style->style_name);
+        dxf_free (style->primary_font_filename);
+        dxf_free (style->big_font_filename);
+        dxf_free (style->dictionary_owner_soft);
+        dxf_free (style->dictionary_owner_hard);
+        dxf_free (style);
         style = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -491,18 +492,19 @@ dxf_style_free_list
                  * \c STYLE symbol table entries. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (styles == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (styles != NULL)
         {
                 DxfStyle *iter = (DxfStyle *) styles->next;
+                styles->next = NULL;
                 dxf_style_free (styles);
                 styles = (DxfStyle *) iter;
         }
@@ -622,7 +624,7 @@ dxf_style_get_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (style->style_name));
+        return (dxf_strdup (style->style_name));
 }
 
 
@@ -660,7 +662,7 @@ dxf_style_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        style->style_name = strdup (style_name);
+        style->style_name = dxf_strdup (style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -703,7 +705,7 @@ dxf_style_get_primary_font_filename
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (style->primary_font_filename));
+        return (dxf_strdup (style->primary_font_filename));
 }
 
 
@@ -742,7 +744,7 @@ dxf_style_set_primary_font_filename
                   __FUNCTION__);
                 return (NULL);
         }
-        style->primary_font_filename = strdup (primary_font_filename);
+        style->primary_font_filename = dxf_strdup (primary_font_filename);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -785,7 +787,7 @@ dxf_style_get_big_font_filename
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (style->big_font_filename));
+        return (dxf_strdup (style->big_font_filename));
 }
 
 
@@ -824,7 +826,7 @@ dxf_style_set_big_font_filename
                   __FUNCTION__);
                 return (NULL);
         }
-        style->big_font_filename = strdup (big_font_filename);
+        style->big_font_filename = dxf_strdup (big_font_filename);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1534,7 +1536,7 @@ dxf_style_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (style->dictionary_owner_soft));
+        return (dxf_strdup (style->dictionary_owner_soft));
 }
 
 
@@ -1570,7 +1572,7 @@ dxf_style_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        style->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        style->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1614,7 +1616,7 @@ dxf_style_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (style->dictionary_owner_hard));
+        return (dxf_strdup (style->dictionary_owner_hard));
 }
 
 
@@ -1650,7 +1652,7 @@ dxf_style_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        style->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        style->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -63,7 +63,7 @@ dxf_sun_new ()
         size = sizeof (DxfSun);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((sun = malloc (size)) == NULL)
+        if ((sun = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -101,21 +101,21 @@ dxf_sun_init
         /* Do some basic checks. */
         if (sun == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 sun = dxf_sun_new ();
         }
         if (sun == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         sun->id_code = 0;
-        sun->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        sun->layer = strdup (DXF_DEFAULT_LAYER);
+        sun->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        sun->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         sun->elevation = 0.0;
         sun->thickness = 0.0;
         sun->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -126,14 +126,14 @@ dxf_sun_init
         sun->shadow_mode = 0;
         sun->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
         sun->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init (sun->binary_graphics_data);
-        sun->dictionary_owner_soft = strdup ("");
-        sun->object_owner_soft = strdup ("");
-        sun->material = strdup ("");
-        sun->dictionary_owner_hard = strdup ("");
+        sun->dictionary_owner_soft = dxf_strdup ("");
+        sun->object_owner_soft = dxf_strdup ("");
+        sun->material = dxf_strdup ("");
+        sun->dictionary_owner_hard = dxf_strdup ("");
         sun->lineweight = 0;
-        sun->plot_style_name = strdup ("");
+        sun->plot_style_name = dxf_strdup ("");
         sun->color_value = 0;
-        sun->color_name = strdup ("");
+        sun->color_name = dxf_strdup ("");
         sun->transparency = 0;
         sun->intensity = 0.0;
         sun->sun_color = DXF_COLOR_BYLAYER;
@@ -179,28 +179,26 @@ dxf_sun_read
 #endif
         char *temp_string = NULL;
         int iter92;
-        DxfBinaryGraphicsData *iter310 = NULL;
         int iter330;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (sun == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 sun = dxf_sun_init (sun);
         }
         iter92 = 0;
-        iter310 = (DxfBinaryGraphicsData *) sun->binary_graphics_data;
         iter330 = 0;
         (fp->line_number)++;
         fscanf (fp->fp, "%[^\n]", temp_string);
@@ -208,12 +206,12 @@ dxf_sun_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -349,7 +347,7 @@ dxf_sun_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbSun") != 0)))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -401,9 +399,8 @@ dxf_sun_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) iter310->next);
-                        iter310 = (DxfBinaryGraphicsData *) iter310->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_graphics_data_append_hex ((DxfBinaryGraphicsData *) sun->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -480,22 +477,23 @@ dxf_sun_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (sun->linetype, "") == 0)
         {
-                sun->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                sun->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (sun->layer, "") == 0)
         {
-                sun->layer = strdup (DXF_DEFAULT_LAYER);
+                sun->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -521,43 +519,43 @@ dxf_sun_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("SUN");
+        char *dxf_entity_name = dxf_strdup ("SUN");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (sun == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (sun->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, sun->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                sun->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                sun->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (sun->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, sun->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
                 sun->layer = DXF_DEFAULT_LAYER;
@@ -644,16 +642,7 @@ dxf_sun_write
 #else
                 fprintf (fp->fp, " 92\n%d\n", sun->graphics_data_size);
 #endif
-                if (sun->binary_graphics_data != NULL)
-                {
-                        DxfBinaryGraphicsData *iter;
-                        iter = (DxfBinaryGraphicsData *) sun->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryGraphicsData *) iter->next;
-                        }
-                }
+                dxf_binary_graphics_data_write (fp, (DxfBinaryGraphicsData *) sun->binary_graphics_data);
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
@@ -686,7 +675,7 @@ dxf_sun_write
         fprintf (fp->fp, " 71\n%d\n", sun->shadow_map_size);
         fprintf (fp->fp, "280\n%" PRIi16 "\n", sun->shadow_softness);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -715,27 +704,27 @@ dxf_sun_free
         /* Do some basic checks. */
         if (sun == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (sun->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (sun->linetype);
-        free (sun->layer);
-        free (sun->dictionary_owner_soft);
-        free (sun->object_owner_soft);
-        free (sun->material);
-        free (sun->dictionary_owner_hard);
-        free (sun->plot_style_name);
-        free (sun->color_name);
-        free (sun);
+        dxf_free (sun->linetype);
+        dxf_free (sun->layer);
+        dxf_free (sun->dictionary_owner_soft);
+        dxf_free (sun->object_owner_soft);
+        dxf_free (sun->material);
+        dxf_free (sun->dictionary_owner_hard);
+        dxf_free (sun->plot_style_name);
+        dxf_free (sun->color_name);
+        dxf_free (sun);
         sun = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -756,18 +745,19 @@ dxf_sun_free_list
                  * \c SUN entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (suns == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (suns != NULL)
         {
                 DxfSun *iter = (DxfSun *) suns->next;
+                suns->next = NULL;
                 dxf_sun_free (suns);
                 suns = (DxfSun *) iter;
         }
@@ -888,7 +878,7 @@ dxf_sun_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sun->linetype));
+        return (dxf_strdup (sun->linetype));
 }
 
 
@@ -926,7 +916,7 @@ dxf_sun_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        sun->linetype = strdup (linetype);
+        sun->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -967,7 +957,7 @@ dxf_sun_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sun->layer));
+        return (dxf_strdup (sun->layer));
 }
 
 
@@ -1005,7 +995,7 @@ dxf_sun_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        sun->layer = strdup (layer);
+        sun->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1781,7 +1771,7 @@ dxf_sun_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sun->dictionary_owner_soft));
+        return (dxf_strdup (sun->dictionary_owner_soft));
 }
 
 
@@ -1820,7 +1810,7 @@ dxf_sun_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        sun->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        sun->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1864,7 +1854,7 @@ dxf_sun_get_object_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sun->object_owner_soft));
+        return (dxf_strdup (sun->object_owner_soft));
 }
 
 
@@ -1900,7 +1890,7 @@ dxf_sun_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        sun->object_owner_soft = strdup (object_owner_soft);
+        sun->object_owner_soft = dxf_strdup (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1944,7 +1934,7 @@ dxf_sun_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sun->material));
+        return (dxf_strdup (sun->material));
 }
 
 
@@ -1982,7 +1972,7 @@ dxf_sun_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        sun->material = strdup (material);
+        sun->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2026,7 +2016,7 @@ dxf_sun_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sun->dictionary_owner_hard));
+        return (dxf_strdup (sun->dictionary_owner_hard));
 }
 
 
@@ -2065,7 +2055,7 @@ dxf_sun_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        sun->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        sun->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2172,7 +2162,7 @@ dxf_sun_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sun->plot_style_name));
+        return (dxf_strdup (sun->plot_style_name));
 }
 
 
@@ -2210,7 +2200,7 @@ dxf_sun_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        sun->plot_style_name = strdup (plot_style_name);
+        sun->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2317,7 +2307,7 @@ dxf_sun_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sun->color_name));
+        return (dxf_strdup (sun->color_name));
 }
 
 
@@ -2355,7 +2345,7 @@ dxf_sun_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        sun->color_name = strdup (color_name);
+        sun->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -63,7 +63,7 @@ dxf_surface_new ()
         size = sizeof (DxfSurface);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((surface = malloc (size)) == NULL)
+        if ((surface = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -101,14 +101,14 @@ dxf_surface_init
         /* Do some basic checks. */
         if (surface == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 surface = dxf_surface_new ();
         }
         if (surface == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -117,7 +117,7 @@ dxf_surface_init
         surface->binary_graphics_data = (DxfBinaryData *) dxf_binary_data_init (surface->binary_graphics_data);
         if (surface->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -125,7 +125,7 @@ dxf_surface_init
         surface->proprietary_data = (DxfProprietaryData *) dxf_proprietary_data_init (surface->proprietary_data);
         if (surface->proprietary_data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -133,15 +133,15 @@ dxf_surface_init
         surface->additional_proprietary_data = (DxfProprietaryData *) dxf_proprietary_data_init (surface->additional_proprietary_data);
         if (surface->additional_proprietary_data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         /* Assign initial values to members. */
         surface->id_code = 0;
-        surface->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        surface->layer = strdup (DXF_DEFAULT_LAYER);
+        surface->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        surface->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         surface->elevation = 0.0;
         surface->thickness = 0.0;
         surface->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -150,19 +150,20 @@ dxf_surface_init
         surface->paperspace = DXF_MODELSPACE;
         surface->graphics_data_size = 0;
         surface->shadow_mode = 0;
-        surface->dictionary_owner_soft = strdup ("");
-        surface->object_owner_soft = strdup ("");
-        surface->material = strdup ("");
-        surface->dictionary_owner_hard = strdup ("");
+        surface->dictionary_owner_soft = dxf_strdup ("");
+        surface->object_owner_soft = dxf_strdup ("");
+        surface->material = dxf_strdup ("");
+        surface->dictionary_owner_hard = dxf_strdup ("");
         surface->lineweight = 0;
-        surface->plot_style_name = strdup ("");
+        surface->plot_style_name = dxf_strdup ("");
         surface->color_value = 0;
-        surface->color_name = strdup ("");
+        surface->color_name = dxf_strdup ("");
         surface->transparency = 0;
         surface->modeler_format_version_number = 1;
         surface->number_of_U_isolines = 0;
         surface->number_of_V_isolines = 0;
         surface->type = 0;
+        surface->acis = NULL;
         surface->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -194,74 +195,55 @@ dxf_surface_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int iter330;
-        int i;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_2007)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (surface == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 surface = dxf_surface_init (surface);
         }
-        iter310 = (DxfBinaryData *) surface->binary_graphics_data;
         iter330 = 0;
-        i = 1;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        memset (temp_string, 0, sizeof (temp_string));
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
-                else if (strcmp (temp_string, "  1") == 0)
+                else if ((strcmp (temp_string, "1") == 0)
+                  || (strcmp (temp_string, "3") == 0))
                 {
                         /* Now follows a string containing proprietary
-                         * data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->proprietary_data->line);
-                        surface->proprietary_data->order = i;
-                        i++;
-                        dxf_proprietary_data_init ((DxfProprietaryData *) surface->proprietary_data->next);
-                        surface->proprietary_data = (DxfProprietaryData *) surface->proprietary_data->next;
-                }
-                else if (strcmp (temp_string, "  3") == 0)
-                {
-                        /* Now follows a string containing additional
-                         * proprietary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->additional_proprietary_data->line);
-                        surface->additional_proprietary_data->order = i;
-                        i++;
-                        dxf_proprietary_data_init ((DxfProprietaryData *) surface->additional_proprietary_data->next);
-                        surface->additional_proprietary_data = (DxfProprietaryData *) surface->additional_proprietary_data->next;
+                         * data, or additional proprietary data. */
+                        if (surface->acis == NULL)
+                        {
+                                surface->acis = dxf_acis_init (dxf_acis_new ());
+                        }
+                        dxf_acis_read (fp, surface->acis, atoi (temp_string), temp_string);
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -273,13 +255,17 @@ dxf_surface_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->linetype);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (surface->linetype);
+                        surface->linetype = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->layer);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (surface->layer);
+                        surface->layer = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "38") == 0)
                 {
@@ -405,7 +391,7 @@ dxf_surface_read
                         else
                         {
                                 surface->type = NO_TYPE;
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                                 return (surface);
@@ -430,9 +416,8 @@ dxf_surface_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_data_append_hex ((DxfBinaryData *) surface->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -441,14 +426,18 @@ dxf_surface_read
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
                                 (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->dictionary_owner_soft);
+                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                                dxf_free (surface->dictionary_owner_soft);
+                                surface->dictionary_owner_soft = dxf_strdup (temp_string);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
                                 (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->object_owner_soft);
+                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                                dxf_free (surface->object_owner_soft);
+                                surface->object_owner_soft = dxf_strdup (temp_string);
                         }
                         iter330++;
                 }
@@ -457,14 +446,18 @@ dxf_surface_read
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->material);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (surface->material);
+                        surface->material = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->dictionary_owner_hard);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (surface->dictionary_owner_hard);
+                        surface->dictionary_owner_hard = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -478,7 +471,9 @@ dxf_surface_read
                         /* Now follows a string containing a plot style
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->plot_style_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (surface->plot_style_name);
+                        surface->plot_style_name = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -491,7 +486,9 @@ dxf_surface_read
                         /* Now follows a string containing a color
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->color_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (surface->color_name);
+                        surface->color_name = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -509,22 +506,23 @@ dxf_surface_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
+                        dxf_read_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (surface->linetype, "") == 0)
         {
-                surface->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                surface->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (surface->layer, "") == 0)
         {
-                surface->layer = strdup (DXF_DEFAULT_LAYER);
+                surface->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -547,36 +545,36 @@ dxf_surface_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("SURFACE");
+        char *dxf_entity_name = dxf_strdup ("SURFACE");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (surface == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (surface->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, surface->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                surface->layer = strdup (DXF_DEFAULT_LAYER);
+                surface->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -656,16 +654,7 @@ dxf_surface_write
 #else
                 fprintf (fp->fp, " 92\n%d\n", surface->graphics_data_size);
 #endif
-                if (surface->binary_graphics_data != NULL)
-                {
-                        DxfBinaryData *iter;
-                        iter = surface->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_data_get_data_line (iter));
-                                iter = (DxfBinaryData *) dxf_binary_data_get_next (iter);
-                        }
-                }
+                dxf_binary_data_write (fp, (DxfBinaryData *) surface->binary_graphics_data);
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
@@ -690,24 +679,31 @@ dxf_surface_write
         {
                 fprintf (fp->fp, " 70\n%hd\n", surface->modeler_format_version_number);
         }
-        if (surface->proprietary_data != NULL)
+        if (surface->acis != NULL)
         {
-                DxfProprietaryData *iter1a;
-                iter1a = (DxfProprietaryData *) surface->proprietary_data;
-                while (iter1a != NULL)
-                {
-                        fprintf (fp->fp, "  1\n%s\n", iter1a->line);
-                        iter1a = (DxfProprietaryData *) iter1a->next;
-                }
+                dxf_acis_write (fp, surface->acis);
         }
-        if (surface->additional_proprietary_data != NULL)
+        else
         {
-                DxfProprietaryData *iter3a;
-                iter3a = (DxfProprietaryData *) surface->additional_proprietary_data;
-                while (iter3a != NULL)
+                if (surface->proprietary_data != NULL)
                 {
-                        fprintf (fp->fp, "  3\n%s\n", iter3a->line);
-                        iter3a = (DxfProprietaryData *) iter3a->next;
+                        DxfProprietaryData *iter1a;
+                        iter1a = (DxfProprietaryData *) surface->proprietary_data;
+                        while (iter1a != NULL)
+                        {
+                                fprintf (fp->fp, "  1\n%s\n", iter1a->line);
+                                iter1a = (DxfProprietaryData *) iter1a->next;
+                        }
+                }
+                if (surface->additional_proprietary_data != NULL)
+                {
+                        DxfProprietaryData *iter3a;
+                        iter3a = (DxfProprietaryData *) surface->additional_proprietary_data;
+                        while (iter3a != NULL)
+                        {
+                                fprintf (fp->fp, "  3\n%s\n", iter3a->line);
+                                iter3a = (DxfProprietaryData *) iter3a->next;
+                        }
                 }
         }
         if (fp->acad_version_number >= AutoCAD_13)
@@ -737,18 +733,18 @@ dxf_surface_write
         }
         else if (surface->type == NO_TYPE)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NO_TYPE value was passed.\n")),
                   __FUNCTION__);
         }
         else
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an unknown type value was passed.\n")),
                   __FUNCTION__);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -777,29 +773,33 @@ dxf_surface_free
         /* Do some basic checks. */
         if (surface == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (surface->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (surface->linetype);
-        free (surface->layer);
-        free (surface->dictionary_owner_soft);
-        free (surface->object_owner_soft);
-        free (surface->material);
-        free (surface->dictionary_owner_hard);
-        free (surface->plot_style_name);
-        free (surface->color_name);
+        dxf_free (surface->linetype);
+        dxf_free (surface->layer);
+        dxf_free (surface->dictionary_owner_soft);
+        dxf_free (surface->object_owner_soft);
+        dxf_free (surface->material);
+        dxf_free (surface->dictionary_owner_hard);
+        dxf_free (surface->plot_style_name);
+        dxf_free (surface->color_name);
         dxf_proprietary_data_free_list (surface->proprietary_data);
         dxf_proprietary_data_free_list (surface->additional_proprietary_data);
-        free (surface);
+        if (surface->acis != NULL)
+        {
+                dxf_acis_free (surface->acis);
+        }
+        dxf_free (surface);
         surface = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -820,18 +820,19 @@ dxf_surface_free_list
                  * \c SURFACE entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (surfaces == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (surfaces != NULL)
         {
                 DxfSurface *iter = (DxfSurface *) surfaces->next;
+                surfaces->next = NULL;
                 dxf_surface_free (surfaces);
                 surfaces = (DxfSurface *) iter;
         }
@@ -952,7 +953,7 @@ dxf_surface_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (surface->linetype));
+        return (dxf_strdup (surface->linetype));
 }
 
 
@@ -992,7 +993,7 @@ dxf_surface_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        surface->linetype = strdup (linetype);
+        surface->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1033,7 +1034,7 @@ dxf_surface_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (surface->layer));
+        return (dxf_strdup (surface->layer));
 }
 
 
@@ -1071,7 +1072,7 @@ dxf_surface_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        surface->layer = strdup (layer);
+        surface->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1872,7 +1873,7 @@ dxf_surface_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (surface->dictionary_owner_soft));
+        return (dxf_strdup (surface->dictionary_owner_soft));
 }
 
 
@@ -1911,7 +1912,7 @@ dxf_surface_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        surface->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        surface->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1955,7 +1956,7 @@ dxf_surface_get_object_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (surface->object_owner_soft));
+        return (dxf_strdup (surface->object_owner_soft));
 }
 
 
@@ -1991,7 +1992,7 @@ dxf_surface_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        surface->object_owner_soft = strdup (object_owner_soft);
+        surface->object_owner_soft = dxf_strdup (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2036,7 +2037,7 @@ dxf_surface_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (surface->material));
+        return (dxf_strdup (surface->material));
 }
 
 
@@ -2075,7 +2076,7 @@ dxf_surface_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        surface->material = strdup (material);
+        surface->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2119,7 +2120,7 @@ dxf_surface_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (surface->dictionary_owner_hard));
+        return (dxf_strdup (surface->dictionary_owner_hard));
 }
 
 
@@ -2158,7 +2159,7 @@ dxf_surface_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        surface->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        surface->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2265,7 +2266,7 @@ dxf_surface_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (surface->plot_style_name));
+        return (dxf_strdup (surface->plot_style_name));
 }
 
 
@@ -2303,7 +2304,7 @@ dxf_surface_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        surface->plot_style_name = strdup (plot_style_name);
+        surface->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2410,7 +2411,7 @@ dxf_surface_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (surface->color_name));
+        return (dxf_strdup (surface->color_name));
 }
 
 
@@ -2448,7 +2449,7 @@ dxf_surface_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        surface->color_name = strdup (color_name);
+        surface->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2683,6 +2684,78 @@ dxf_surface_set_additional_proprietary_data
 }
 
 
+/*!
+ * \brief Get the ACIS proprietary data from a DXF \c SURFACE entity.
+ *
+ * \return a pointer to the ACIS proprietary data, or \c NULL when the
+ * entity holds none or when an error occurred.
+ */
+DxfAcis *
+dxf_surface_get_acis
+(
+        DxfSurface *surface
+                /*!< a pointer to a DXF \c SURFACE entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (surface == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (surface->acis);
+}
+
+
+/*!
+ * \brief Set the ACIS proprietary data for a DXF \c SURFACE entity.
+ *
+ * The entity takes ownership of \c acis, ACIS proprietary data held
+ * before is freed.
+ *
+ * \return a pointer to \c surface, or \c NULL when an error occurred.
+ */
+DxfSurface *
+dxf_surface_set_acis
+(
+        DxfSurface *surface,
+                /*!< a pointer to a DXF \c SURFACE entity. */
+        DxfAcis *acis
+                /*!< a pointer to the ACIS proprietary data, or
+                 * \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (surface == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((surface->acis != NULL) && (surface->acis != acis))
+        {
+                dxf_acis_free (surface->acis);
+        }
+        surface->acis = acis;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (surface);
+}
+
+
 /*!
  * \brief Get the modeler format version number from a DXF \c SURFACE
  * entity.
@@ -3074,7 +3147,7 @@ dxf_surface_extruded_new ()
         size = sizeof (DxfSurfaceExtruded);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((extruded_surface = malloc (size)) == NULL)
+        if ((extruded_surface = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -3112,14 +3185,14 @@ dxf_surface_extruded_init
         /* Do some basic checks. */
         if (extruded_surface == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 extruded_surface = dxf_surface_extruded_new ();
         }
         if (extruded_surface == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3128,7 +3201,7 @@ dxf_surface_extruded_init
         extruded_surface->p0 = (DxfPoint *) dxf_point_init (extruded_surface->p0);
         if (extruded_surface->p0 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3136,7 +3209,7 @@ dxf_surface_extruded_init
         extruded_surface->p1 = (DxfPoint *) dxf_point_init (extruded_surface->p1);
         if (extruded_surface->p1 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3144,7 +3217,7 @@ dxf_surface_extruded_init
         extruded_surface->transform_matrix = (DxfDouble *) dxf_double_init (extruded_surface->transform_matrix);
         if (extruded_surface->transform_matrix == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3152,7 +3225,7 @@ dxf_surface_extruded_init
         extruded_surface->sweep_matrix = (DxfDouble *) dxf_double_init (extruded_surface->sweep_matrix);
         if (extruded_surface->sweep_matrix == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3160,7 +3233,7 @@ dxf_surface_extruded_init
         extruded_surface->path_matrix = (DxfDouble *) dxf_double_init (extruded_surface->path_matrix);
         if (extruded_surface->path_matrix == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3168,7 +3241,7 @@ dxf_surface_extruded_init
         extruded_surface->binary_data = (DxfBinaryData *) dxf_binary_data_init (extruded_surface->binary_data);
         if (extruded_surface->binary_data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3227,27 +3300,26 @@ dxf_surface_extruded_read
         DxfDouble *iter46 = NULL;
         DxfDouble *iter47 = NULL;
         int iter90;
-        DxfBinaryData *iter310 = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_2007)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (extruded_surface == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 extruded_surface = dxf_surface_extruded_init (extruded_surface);
@@ -3256,18 +3328,17 @@ dxf_surface_extruded_read
         iter46 = (DxfDouble *) extruded_surface->sweep_matrix;
         iter47 = (DxfDouble *) extruded_surface->path_matrix;
         iter90 = 0;
-        iter310 = (DxfBinaryData *) extruded_surface->binary_data;
         (fp->line_number)++;
         fscanf (fp->fp, "%[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -3456,9 +3527,8 @@ dxf_surface_extruded_read
                 {
                         /* Now follows a string containing binary data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_data_append_hex ((DxfBinaryData *) extruded_surface->binary_data, temp_string);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -3469,13 +3539,14 @@ dxf_surface_extruded_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3501,14 +3572,14 @@ dxf_surface_extruded_write
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (extruded_surface == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3519,16 +3590,7 @@ dxf_surface_extruded_write
         }
         fprintf (fp->fp, " 90\n%" PRIi32 "\n", extruded_surface->class_ID);
         fprintf (fp->fp, " 90\n%" PRIi32 "\n", extruded_surface->binary_data_size);
-        if (extruded_surface->binary_data != NULL)
-        {
-                DxfBinaryData *iter310;
-                iter310 = (DxfBinaryData *) extruded_surface->binary_data;
-                while (iter310 != NULL)
-                {
-                        fprintf (fp->fp, "310\n%s\n", iter310->data_line);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-        }
+        dxf_binary_data_write (fp, (DxfBinaryData *) extruded_surface->binary_data);
         fprintf (fp->fp, " 10\n%f\n", extruded_surface->p0->x0);
         fprintf (fp->fp, " 20\n%f\n", extruded_surface->p0->y0);
         fprintf (fp->fp, " 30\n%f\n", extruded_surface->p0->z0);
@@ -3606,14 +3668,14 @@ dxf_surface_extruded_free
         /* Do some basic checks. */
         if (extruded_surface == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (extruded_surface->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3624,7 +3686,7 @@ dxf_surface_extruded_free
         dxf_double_free_list (extruded_surface->sweep_matrix);
         dxf_double_free_list (extruded_surface->path_matrix);
         dxf_binary_data_free_list (extruded_surface->binary_data);
-        free (extruded_surface);
+        dxf_free (extruded_surface);
         extruded_surface = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -3645,18 +3707,19 @@ dxf_surface_extruded_free_list
                  * extruded \c SURFACE entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (extruded_surfaces == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (extruded_surfaces != NULL)
         {
                 DxfSurfaceExtruded *iter = (DxfSurfaceExtruded *) extruded_surfaces->next;
+                extruded_surfaces->next = NULL;
                 dxf_surface_extruded_free (extruded_surfaces);
                 extruded_surfaces = (DxfSurfaceExtruded *) iter;
         }
@@ -3678,7 +3741,7 @@ dxf_surface_extruded_get_p0
                 /*!< a pointer to a DXF extruded \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3759,7 +3822,7 @@ dxf_surface_extruded_get_x0
                 /*!< a pointer to a DXF extruded \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3802,7 +3865,7 @@ dxf_surface_extruded_set_x0
                  * extruded \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3841,7 +3904,7 @@ dxf_surface_extruded_get_y0
                 /*!< a pointer to a DXF extruded \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3884,7 +3947,7 @@ dxf_surface_extruded_set_y0
                  * extruded \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3923,7 +3986,7 @@ dxf_surface_extruded_get_z0
                 /*!< a pointer to a DXF extruded \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3966,7 +4029,7 @@ dxf_surface_extruded_set_z0
                  * extruded \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4005,7 +4068,7 @@ dxf_surface_extruded_get_p1
                 /*!< a pointer to a DXF extruded \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4088,7 +4151,7 @@ dxf_surface_extruded_get_x1
                 /*!< a pointer to a DXF extruded \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4131,7 +4194,7 @@ dxf_surface_extruded_set_x1
                  * twist \c x1 of a DXF extruded \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4171,7 +4234,7 @@ dxf_surface_extruded_get_y1
                 /*!< a pointer to a DXF extruded \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4214,7 +4277,7 @@ dxf_surface_extruded_set_y1
                  * twist \c y1 of a DXF extruded \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4254,7 +4317,7 @@ dxf_surface_extruded_get_z1
                 /*!< a pointer to a DXF extruded \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4297,7 +4360,7 @@ dxf_surface_extruded_set_z1
                  * twist \c z1 of a DXF extruded \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4336,7 +4399,7 @@ dxf_surface_extruded_get_transform_matrix
                 /*!< a pointer to a DXF extruded \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4379,7 +4442,7 @@ dxf_surface_extruded_set_transform_matrix
                  * extruded \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4418,7 +4481,7 @@ dxf_surface_extruded_get_draft_angle
                 /*!< a pointer to a DXF extruded \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4454,7 +4517,7 @@ dxf_surface_extruded_set_draft_angle
                  * \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4486,7 +4549,7 @@ dxf_surface_extruded_get_draft_start_distance
                 /*!< a pointer to a DXF extruded \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4522,7 +4585,7 @@ dxf_surface_extruded_set_draft_start_distance
                  * a DXF extruded \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4554,7 +4617,7 @@ dxf_surface_extruded_get_draft_end_distance
                 /*!< a pointer to a DXF extruded \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4590,7 +4653,7 @@ dxf_surface_extruded_set_draft_end_distance
                  * a DXF extruded \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4622,7 +4685,7 @@ dxf_surface_extruded_get_twist_angle
                 /*!< a pointer to a DXF extruded \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4658,7 +4721,7 @@ dxf_surface_extruded_set_twist_angle
                  * \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4693,7 +4756,7 @@ dxf_surface_extruded_get_sweep_matrix
                 /*!< a pointer to a DXF extruded \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4739,7 +4802,7 @@ dxf_surface_extruded_set_sweep_matrix
                  * extruded \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4781,7 +4844,7 @@ dxf_surface_extruded_get_path_matrix
                 /*!< a pointer to a DXF extruded \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4827,7 +4890,7 @@ dxf_surface_extruded_set_path_matrix
                  * extruded \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4866,7 +4929,7 @@ dxf_surface_extruded_get_scale_factor
                 /*!< a pointer to a DXF extruded \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4902,7 +4965,7 @@ dxf_surface_extruded_set_scale_factor
                  * \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4934,7 +4997,7 @@ dxf_surface_extruded_get_align_angle
                 /*!< a pointer to a DXF extruded \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4970,7 +5033,7 @@ dxf_surface_extruded_set_align_angle
                  * \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5853,7 +5916,7 @@ dxf_surface_lofted_new ()
         size = sizeof (DxfSurfaceLofted);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((lofted_surface = malloc (size)) == NULL)
+        if ((lofted_surface = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -5891,14 +5954,14 @@ dxf_surface_lofted_init
         /* Do some basic checks. */
         if (lofted_surface == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 lofted_surface = dxf_surface_lofted_new ();
         }
         if (lofted_surface == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5907,7 +5970,7 @@ dxf_surface_lofted_init
         lofted_surface->transform_matrix = (DxfDouble *) dxf_double_init (lofted_surface->transform_matrix);
         if (lofted_surface->transform_matrix == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5965,22 +6028,22 @@ dxf_surface_lofted_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_2007)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (lofted_surface == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 lofted_surface = dxf_surface_lofted_init (lofted_surface);
@@ -5992,11 +6055,11 @@ dxf_surface_lofted_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -6102,7 +6165,7 @@ dxf_surface_lofted_read
                 }
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -6128,14 +6191,14 @@ dxf_surface_lofted_write
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (lofted_surface == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -6197,20 +6260,20 @@ dxf_surface_lofted_free
         /* Do some basic checks. */
         if (lofted_surface == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (lofted_surface->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         dxf_double_free_list (lofted_surface->transform_matrix);
-        free (lofted_surface);
+        dxf_free (lofted_surface);
         lofted_surface = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -6231,18 +6294,19 @@ dxf_surface_lofted_free_list
                  * lofted \c SURFACE entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (lofted_surfaces == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (lofted_surfaces != NULL)
         {
                 DxfSurfaceLofted *iter = (DxfSurfaceLofted *) lofted_surfaces->next;
+                lofted_surfaces->next = NULL;
                 dxf_surface_lofted_free (lofted_surfaces);
                 lofted_surfaces = (DxfSurfaceLofted *) iter;
         }
@@ -6265,7 +6329,7 @@ dxf_surface_lofted_get_transform_matrix
                 /*!< a pointer to a DXF lofted \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -6308,7 +6372,7 @@ dxf_surface_lofted_set_transform_matrix
                  * lofted \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6347,7 +6411,7 @@ dxf_surface_lofted_get_start_draft_angle
                 /*!< a pointer to a DXF lofted \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -6383,7 +6447,7 @@ dxf_surface_lofted_set_start_draft_angle
                  * lofted \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6415,7 +6479,7 @@ dxf_surface_lofted_get_end_draft_angle
                 /*!< a pointer to a DXF lofted \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -6451,7 +6515,7 @@ dxf_surface_lofted_set_end_draft_angle
                  * lofted \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6483,7 +6547,7 @@ dxf_surface_lofted_get_start_draft_magnitude
                 /*!< a pointer to a DXF lofted \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -6519,7 +6583,7 @@ dxf_surface_lofted_set_start_draft_magnitude
                  * of a DXF lofted \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6551,7 +6615,7 @@ dxf_surface_lofted_get_end_draft_magnitude
                 /*!< a pointer to a DXF lofted \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -6587,7 +6651,7 @@ dxf_surface_lofted_set_end_draft_magnitude
                  * of a DXF lofted \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -7347,7 +7411,7 @@ dxf_surface_revolved_new ()
         size = sizeof (DxfSurfaceRevolved);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((revolved_surface = malloc (size)) == NULL)
+        if ((revolved_surface = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -7385,14 +7449,14 @@ dxf_surface_revolved_init
         /* Do some basic checks. */
         if (revolved_surface == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 revolved_surface = dxf_surface_revolved_new ();
         }
         if (revolved_surface == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -7401,7 +7465,7 @@ dxf_surface_revolved_init
         revolved_surface->p0 = (DxfPoint *) dxf_point_init (revolved_surface->p0);
         if (revolved_surface->p0 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -7409,7 +7473,7 @@ dxf_surface_revolved_init
         revolved_surface->p1 = (DxfPoint *) dxf_point_init (revolved_surface->p1);
         if (revolved_surface->p1 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -7417,7 +7481,7 @@ dxf_surface_revolved_init
         revolved_surface->transform_matrix = (DxfDouble *) dxf_double_init (revolved_surface->transform_matrix);
         if (revolved_surface->transform_matrix == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -7425,7 +7489,7 @@ dxf_surface_revolved_init
         revolved_surface->binary_data = (DxfBinaryData *) dxf_binary_data_init (revolved_surface->binary_data);
         if (revolved_surface->binary_data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -7477,45 +7541,43 @@ dxf_surface_revolved_read
         char *temp_string = NULL;
         DxfDouble *iter42 = NULL;
         int iter90;
-        DxfBinaryData *iter310 = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_2007)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (revolved_surface == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 revolved_surface = dxf_surface_revolved_init (revolved_surface);
         }
         iter42 = (DxfDouble *) revolved_surface->transform_matrix;
         iter90 = 0;
-        iter310 = (DxfBinaryData *) revolved_surface->binary_data;
         (fp->line_number)++;
         fscanf (fp->fp, "%[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -7648,13 +7710,12 @@ dxf_surface_revolved_read
                 {
                         /* Now follows a string containing binary data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_data_append_hex ((DxfBinaryData *) revolved_surface->binary_data, temp_string);
                 }
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -7680,14 +7741,14 @@ dxf_surface_revolved_write
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (revolved_surface == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -7698,16 +7759,7 @@ dxf_surface_revolved_write
         }
         fprintf (fp->fp, " 90\n%" PRIi32 "\n", revolved_surface->ID);
         fprintf (fp->fp, " 90\n%" PRIi32 "\n", revolved_surface->binary_data_size);
-        if (revolved_surface->binary_data != NULL)
-        {
-                DxfBinaryData *iter310;
-                iter310 = (DxfBinaryData *) revolved_surface->binary_data;
-                while (iter310 != NULL)
-                {
-                        fprintf (fp->fp, "310\n%s\n", iter310->data_line);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-        }
+        dxf_binary_data_write (fp, (DxfBinaryData *) revolved_surface->binary_data);
         fprintf (fp->fp, " 10\n%f\n", revolved_surface->p0->x0);
         fprintf (fp->fp, " 20\n%f\n", revolved_surface->p0->y0);
         fprintf (fp->fp, " 30\n%f\n", revolved_surface->p0->z0);
@@ -7760,14 +7812,14 @@ dxf_surface_revolved_free
         /* Do some basic checks. */
         if (revolved_surface == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (revolved_surface->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -7776,7 +7828,7 @@ dxf_surface_revolved_free
         dxf_point_free (revolved_surface->p1);
         dxf_double_free_list (revolved_surface->transform_matrix);
         dxf_binary_data_free_list (revolved_surface->binary_data);
-        free (revolved_surface);
+        dxf_free (revolved_surface);
         revolved_surface = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -7797,18 +7849,19 @@ dxf_surface_revolved_free_list
                  * revolved \c SURFACE entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (revolved_surfaces == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (revolved_surfaces != NULL)
         {
                 DxfSurfaceRevolved *iter = (DxfSurfaceRevolved *) revolved_surfaces->next;
+                revolved_surfaces->next = NULL;
                 dxf_surface_revolved_free (revolved_surfaces);
                 revolved_surfaces = (DxfSurfaceRevolved *) iter;
         }
@@ -7830,7 +7883,7 @@ dxf_surface_revolved_get_p0
                 /*!< a pointer to a DXF revolved \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -7910,7 +7963,7 @@ dxf_surface_revolved_get_x0
                 /*!< a pointer to a DXF revolved \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -7953,7 +8006,7 @@ dxf_surface_revolved_set_x0
                  * revolved \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -7992,7 +8045,7 @@ dxf_surface_revolved_get_y0
                 /*!< a pointer to a DXF revolved \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -8035,7 +8088,7 @@ dxf_surface_revolved_set_y0
                  * revolved \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8074,7 +8127,7 @@ dxf_surface_revolved_get_z0
                 /*!< a pointer to a DXF revolved \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -8117,7 +8170,7 @@ dxf_surface_revolved_set_z0
                  * revolved \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8155,7 +8208,7 @@ dxf_surface_revolved_get_p1
                 /*!< a pointer to a DXF revolved \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8235,7 +8288,7 @@ dxf_surface_revolved_get_x1
                 /*!< a pointer to a DXF revolved \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -8278,7 +8331,7 @@ dxf_surface_revolved_set_x1
                  * revolved \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8317,7 +8370,7 @@ dxf_surface_revolved_get_y1
                 /*!< a pointer to a DXF revolved \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -8360,7 +8413,7 @@ dxf_surface_revolved_set_y1
                  * revolved \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8399,7 +8452,7 @@ dxf_surface_revolved_get_z1
                 /*!< a pointer to a DXF revolved \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -8442,7 +8495,7 @@ dxf_surface_revolved_set_z1
                  * revolved \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8481,7 +8534,7 @@ dxf_surface_revolved_get_revolve_angle
                 /*!< a pointer to a DXF revolved \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -8517,7 +8570,7 @@ dxf_surface_revolved_set_revolve_angle
                  * revolved \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8549,7 +8602,7 @@ dxf_surface_revolved_get_start_angle
                 /*!< a pointer to a DXF revolved \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -8585,7 +8638,7 @@ dxf_surface_revolved_set_start_angle
                  * revolved \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8617,7 +8670,7 @@ dxf_surface_revolved_get_transform_matrix
                 /*!< a pointer to a DXF revolved \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -8660,7 +8713,7 @@ dxf_surface_revolved_set_transform_matrix
                  * revolved \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8699,7 +8752,7 @@ dxf_surface_revolved_get_draft_angle
                 /*!< a pointer to a DXF revolved \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -8735,7 +8788,7 @@ dxf_surface_revolved_set_draft_angle
                  * revolved \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8767,7 +8820,7 @@ dxf_surface_revolved_get_start_draft_distance
                 /*!< a pointer to a DXF revolved \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -8803,7 +8856,7 @@ dxf_surface_revolved_set_start_draft_distance
                  * a DXF revolved \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8835,7 +8888,7 @@ dxf_surface_revolved_get_end_draft_distance
                 /*!< a pointer to a DXF revolved \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -8871,7 +8924,7 @@ dxf_surface_revolved_set_end_draft_distance
                  * a DXF revolved \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -8903,7 +8956,7 @@ dxf_surface_revolved_get_twist_angle
                 /*!< a pointer to a DXF revolved \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -8939,7 +8992,7 @@ dxf_surface_revolved_set_twist_angle
                  * \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -9443,7 +9496,7 @@ dxf_surface_swept_new ()
         size = sizeof (DxfSurfaceSwept);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((swept_surface = malloc (size)) == NULL)
+        if ((swept_surface = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -9481,14 +9534,14 @@ dxf_surface_swept_init
         /* Do some basic checks. */
         if (swept_surface == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 swept_surface = dxf_surface_swept_new ();
         }
         if (swept_surface == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -9497,7 +9550,7 @@ dxf_surface_swept_init
         swept_surface->p1 = (DxfPoint *) dxf_point_init (swept_surface->p1);
         if (swept_surface->p1 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -9505,7 +9558,7 @@ dxf_surface_swept_init
         swept_surface->transform_sweep_matrix = (DxfDouble *) dxf_double_init (swept_surface->transform_sweep_matrix);
         if (swept_surface->transform_sweep_matrix == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -9513,7 +9566,7 @@ dxf_surface_swept_init
         swept_surface->transform_path_matrix = (DxfDouble *) dxf_double_init (swept_surface->transform_path_matrix);
         if (swept_surface->transform_path_matrix == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -9521,7 +9574,7 @@ dxf_surface_swept_init
         swept_surface->transform_sweep_matrix2 = (DxfDouble *) dxf_double_init (swept_surface->transform_sweep_matrix2);
         if (swept_surface->transform_sweep_matrix2 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -9529,7 +9582,7 @@ dxf_surface_swept_init
         swept_surface->transform_path_matrix2 = (DxfDouble *) dxf_double_init (swept_surface->transform_path_matrix2);
         if (swept_surface->transform_path_matrix2 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -9537,7 +9590,7 @@ dxf_surface_swept_init
         swept_surface->sweep_binary_data = (DxfBinaryData *) dxf_binary_data_init (swept_surface->sweep_binary_data);
         if (swept_surface->sweep_binary_data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -9545,7 +9598,7 @@ dxf_surface_swept_init
         swept_surface->path_binary_data = (DxfBinaryData *) dxf_binary_data_init (swept_surface->path_binary_data);
         if (swept_surface->path_binary_data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -9607,27 +9660,26 @@ dxf_surface_swept_read
         DxfDouble *iter46 = NULL;
         DxfDouble *iter47 = NULL;
         int iter90;
-        DxfBinaryData *iter310 = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_2007)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (swept_surface == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 swept_surface = dxf_surface_swept_init (swept_surface);
@@ -9637,18 +9689,17 @@ dxf_surface_swept_read
         iter46 = (DxfDouble *) swept_surface->transform_sweep_matrix2;
         iter47 = (DxfDouble *) swept_surface->transform_path_matrix2;
         iter90 = 0;
-        iter310 = (DxfBinaryData *) swept_surface->sweep_binary_data;
         (fp->line_number)++;
         fscanf (fp->fp, "%[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -9840,13 +9891,12 @@ dxf_surface_swept_read
                         /*! \todo Fix the parsing of binary data. */
                         /* Now follows a string containing binary data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_data_append_hex ((DxfBinaryData *) swept_surface->sweep_binary_data, temp_string);
                 }
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -9872,14 +9922,14 @@ dxf_surface_swept_write
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (swept_surface == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -9890,16 +9940,7 @@ dxf_surface_swept_write
         }
         fprintf (fp->fp, " 90\n%" PRIi32 "\n", swept_surface->sweep_ID);
         fprintf (fp->fp, " 90\n%" PRIi32 "\n", swept_surface->sweep_binary_data_size);
-        if (swept_surface->sweep_binary_data != NULL)
-        {
-                DxfBinaryData *iter310;
-                iter310 = (DxfBinaryData *) swept_surface->sweep_binary_data;
-                while (iter310 != NULL)
-                {
-                        fprintf (fp->fp, "310\n%s\n", iter310->data_line);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-        }
+        dxf_binary_data_write (fp, (DxfBinaryData *) swept_surface->sweep_binary_data);
 
 
 #if DEBUG
@@ -9930,14 +9971,14 @@ dxf_surface_swept_free
         /* Do some basic checks. */
         if (swept_surface == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (swept_surface->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -9949,7 +9990,7 @@ dxf_surface_swept_free
         dxf_double_free_list (swept_surface->transform_path_matrix2);
         dxf_binary_data_free_list (swept_surface->sweep_binary_data);
         dxf_binary_data_free_list (swept_surface->path_binary_data);
-        free (swept_surface);
+        dxf_free (swept_surface);
         swept_surface = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -9970,18 +10011,19 @@ dxf_surface_swept_free_list
                  * \c SURFACE entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (swept_surfaces == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (swept_surfaces != NULL)
         {
                 DxfSurfaceSwept *iter = (DxfSurfaceSwept *) swept_surfaces->next;
+                swept_surfaces->next = NULL;
                 dxf_surface_swept_free (swept_surfaces);
                 swept_surfaces = (DxfSurfaceSwept *) iter;
         }
@@ -10004,7 +10046,7 @@ dxf_surface_swept_get_p1
                 /*!< a pointer to a DXF swept \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -10085,7 +10127,7 @@ dxf_surface_swept_get_x1
                 /*!< a pointer to a DXF swept \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -10128,7 +10170,7 @@ dxf_surface_swept_set_x1
                  * of a DXF swept \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -10167,7 +10209,7 @@ dxf_surface_swept_get_y1
                 /*!< a pointer to a DXF swept \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -10210,7 +10252,7 @@ dxf_surface_swept_set_y1
                  * of a DXF swept \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -10249,7 +10291,7 @@ dxf_surface_swept_get_z1
                 /*!< a pointer to a DXF swept \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -10292,7 +10334,7 @@ dxf_surface_swept_set_z1
                  * of a DXF swept \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -10331,7 +10373,7 @@ dxf_surface_swept_get_transform_sweep_matrix
                 /*!< a pointer to a DXF swept \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -10375,7 +10417,7 @@ dxf_surface_swept_set_transform_sweep_matrix
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -10414,7 +10456,7 @@ dxf_surface_swept_get_transform_path_matrix
                 /*!< a pointer to a DXF swept \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -10457,7 +10499,7 @@ dxf_surface_swept_set_transform_path_matrix
                  * of a DXF swept \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -10496,7 +10538,7 @@ dxf_surface_swept_get_draft_angle
                 /*!< a pointer to a DXF swept \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -10532,7 +10574,7 @@ dxf_surface_swept_set_draft_angle
                  * \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -10564,7 +10606,7 @@ dxf_surface_swept_get_start_draft_distance
                 /*!< a pointer to a DXF swept \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -10600,7 +10642,7 @@ dxf_surface_swept_set_start_draft_distance
                  * a DXF swept \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -10632,7 +10674,7 @@ dxf_surface_swept_get_end_draft_distance
                 /*!< a pointer to a DXF swept \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -10668,7 +10710,7 @@ dxf_surface_swept_set_end_draft_distance
                  * a DXF swept \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -10700,7 +10742,7 @@ dxf_surface_swept_get_twist_angle
                 /*!< a pointer to a DXF swept \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -10736,7 +10778,7 @@ dxf_surface_swept_set_twist_angle
                  * \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -10768,7 +10810,7 @@ dxf_surface_swept_get_transform_sweep_matrix2
                 /*!< a pointer to a DXF swept \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -10812,7 +10854,7 @@ dxf_surface_swept_set_transform_sweep_matrix2
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -10851,7 +10893,7 @@ dxf_surface_swept_get_transform_path_matrix2
                 /*!< a pointer to a DXF swept \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -10895,7 +10937,7 @@ dxf_surface_swept_set_transform_path_matrix2
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -10934,7 +10976,7 @@ dxf_surface_swept_get_scale_factor
                 /*!< a pointer to a DXF swept \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -10970,7 +11012,7 @@ dxf_surface_swept_set_scale_factor
                  * \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -11002,7 +11044,7 @@ dxf_surface_swept_get_align_angle
                 /*!< a pointer to a DXF swept \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -11038,7 +11080,7 @@ dxf_surface_swept_set_align_angle
                  * \c SURFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
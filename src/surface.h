@@ -45,6 +45,7 @@
 
 
 #include "global.h"
+#include "acis.h"
 #include "util.h"
 #include "point.h"
 #include "binary_data.h"
@@ -210,6 +211,12 @@ dxf_surface_struct
                  * group 1 string is greater than 255 characters
                  * (optional).\n
                  * Group code = 3. */
+        DxfAcis *acis;
+                /*!< Proprietary data (group codes 1 and 3) as read with
+                 * the ACIS mode of the DXF file, see
+                 * dxf_file_set_acis_mode ().\n
+                 * Written instead of \c proprietary_data and
+                 * \c additional_proprietary_data when not \c NULL. */
         int16_t modeler_format_version_number;
                 /*!< Modeler format version number (currently = 1).\n
                  * Group code = 70. */
@@ -600,6 +607,8 @@ DxfProprietaryData *dxf_surface_get_proprietary_data (DxfSurface *surface);
 DxfSurface *dxf_surface_set_proprietary_data (DxfSurface *surface, DxfProprietaryData *proprietary_data);
 DxfProprietaryData *dxf_surface_get_additional_proprietary_data (DxfSurface *surface);
 DxfSurface *dxf_surface_set_additional_proprietary_data (DxfSurface *surface, DxfProprietaryData *additional_proprietary_data);
+DxfAcis *dxf_surface_get_acis (DxfSurface *surface);
+DxfSurface *dxf_surface_set_acis (DxfSurface *surface, DxfAcis *acis);
 int16_t dxf_surface_get_modeler_format_version_number (DxfSurface *surface);
 DxfSurface *dxf_surface_set_modeler_format_version_number (DxfSurface *surface, int16_t modeler_format_version_number);
 int16_t dxf_surface_get_number_of_U_isolines (DxfSurface *surface);
@@ -0,0 +1,526 @@
+/*!
+ * \file symbol_index.c
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for a libDXF symbol name index.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "symbol_index.h"
+
+
+/*!
+ * \brief Fold an ASCII character to upper case.
+ *
+ * Locale independent, as the case of DXF symbol names is folded for
+ * ASCII letters only.
+ */
+static int
+dxf_symbol_index_fold
+(
+        int c
+)
+{
+        return (((c >= 'a') && (c <= 'z')) ? (c - 'a' + 'A') : c);
+}
+
+
+/*!
+ * \brief Compare two names case insensitive.
+ *
+ * \return \c TRUE when the names are equal, \c FALSE otherwise.
+ */
+static int
+dxf_symbol_index_equal
+(
+        const char *a,
+        const char *b
+)
+{
+        while ((*a != '\0')
+          && (dxf_symbol_index_fold ((unsigned char) *a)
+          == dxf_symbol_index_fold ((unsigned char) *b)))
+        {
+                a++;
+                b++;
+        }
+        return ((dxf_symbol_index_fold ((unsigned char) *a)
+          == dxf_symbol_index_fold ((unsigned char) *b)) ? TRUE : FALSE);
+}
+
+
+/*!
+ * \brief Find the slot of a name, or the empty slot where it belongs.
+ */
+static size_t
+dxf_symbol_index_slot
+(
+        DxfSymbolIndex *index,
+        const char *name,
+        unsigned long hash
+)
+{
+        size_t mask;
+        size_t i;
+
+        mask = index->size - 1;
+        for (i = hash & mask;
+          index->entries[i].name != NULL;
+          i = (i + 1) & mask)
+        {
+                if ((index->entries[i].hash == hash)
+                  && dxf_symbol_index_equal (index->entries[i].name, name))
+                {
+                        break;
+                }
+        }
+        return (i);
+}
+
+
+/*!
+ * \brief Resize the hash table of a \c DxfSymbolIndex.
+ */
+static int
+dxf_symbol_index_resize
+(
+        DxfSymbolIndex *index,
+        size_t size
+)
+{
+        DxfSymbolIndexEntry *entries = NULL;
+        DxfSymbolIndexEntry *old_entries = NULL;
+        size_t old_size;
+        size_t mask;
+        size_t i;
+        size_t j;
+
+        entries = dxf_calloc (size, sizeof (DxfSymbolIndexEntry));
+        if (entries == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        old_entries = index->entries;
+        old_size = index->size;
+        mask = size - 1;
+        for (i = 0; i < old_size; i++)
+        {
+                if (old_entries[i].name == NULL)
+                {
+                        continue;
+                }
+                for (j = old_entries[i].hash & mask;
+                  entries[j].name != NULL;
+                  j = (j + 1) & mask)
+                {
+                }
+                entries[j] = old_entries[i];
+        }
+        dxf_free (old_entries);
+        index->entries = entries;
+        index->size = size;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate memory for a \c DxfSymbolIndex.
+ *
+ * Fill the memory contents with zeros.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfSymbolIndex *
+dxf_symbol_index_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfSymbolIndex *index = NULL;
+        size_t size;
+
+        size = sizeof (DxfSymbolIndex);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((index = dxf_malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                index = NULL;
+        }
+        else
+        {
+                memset (index, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (index);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize an empty \c DxfSymbolIndex.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfSymbolIndex *
+dxf_symbol_index_init
+(
+        DxfSymbolIndex *index
+                /*!< a pointer to a \c DxfSymbolIndex. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                index = dxf_symbol_index_new ();
+        }
+        if (index == NULL)
+        {
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                (_("Error in %s () could not allocate memory.\n")),
+                __FUNCTION__);
+              return (NULL);
+        }
+        index->entries = NULL;
+        index->size = 0;
+        index->number_of_entries = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (index);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfSymbolIndex.
+ *
+ * The symbols are not freed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_symbol_index_free
+(
+        DxfSymbolIndex *index
+                /*!< a pointer to the memory occupied by the
+                 * \c DxfSymbolIndex. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (index == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_symbol_index_clear (index);
+        dxf_free (index->entries);
+        dxf_free (index);
+        index = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Remove all entries from a \c DxfSymbolIndex.
+ *
+ * The hash table is kept for reuse.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_symbol_index_clear
+(
+        DxfSymbolIndex *index
+                /*!< a pointer to a \c DxfSymbolIndex. */
+)
+{
+        size_t i;
+
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < index->size; i++)
+        {
+                dxf_free (index->entries[i].name);
+                index->entries[i].name = NULL;
+                index->entries[i].symbol = NULL;
+        }
+        index->number_of_entries = 0;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Compute the case insensitive hash value of a name.
+ *
+ * FNV-1a over the upper case folded characters.
+ *
+ * \return the hash value.
+ */
+unsigned long
+dxf_symbol_index_hash
+(
+        const char *name
+                /*!< name of a symbol. */
+)
+{
+        uint32_t hash;
+
+        hash = 2166136261u;
+        if (name != NULL)
+        {
+                while (*name != '\0')
+                {
+                        hash ^= (uint32_t) dxf_symbol_index_fold ((unsigned char) *name);
+                        hash *= 16777619u;
+                        name++;
+                }
+        }
+        return ((unsigned long) hash);
+}
+
+
+/*!
+ * \brief Insert a symbol into a \c DxfSymbolIndex.
+ *
+ * When a symbol with the same name (case insensitive) is in the index
+ * already, the index is not changed: the first definition of a name
+ * is the one found, just as with a walk of the list.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_symbol_index_insert
+(
+        DxfSymbolIndex *index,
+                /*!< a pointer to a \c DxfSymbolIndex. */
+        const char *name,
+                /*!< name of the symbol, copied into the index. */
+        void *symbol
+                /*!< a pointer to the symbol. */
+)
+{
+        unsigned long hash;
+        size_t i;
+
+        /* Do some basic checks. */
+        if ((index == NULL) || (name == NULL) || (symbol == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (2 * (index->number_of_entries + 1) > index->size)
+        {
+                if (dxf_symbol_index_resize (index, (index->size > 0)
+                  ? 2 * index->size : DXF_SYMBOL_INDEX_MIN_SIZE) != EXIT_SUCCESS)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+        }
+        hash = dxf_symbol_index_hash (name);
+        i = dxf_symbol_index_slot (index, name, hash);
+        if (index->entries[i].name != NULL)
+        {
+                return (EXIT_SUCCESS);
+        }
+        index->entries[i].name = dxf_strdup (name);
+        if (index->entries[i].name == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        index->entries[i].hash = hash;
+        index->entries[i].symbol = symbol;
+        index->number_of_entries++;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Remove a symbol from a \c DxfSymbolIndex.
+ *
+ * The entry for \c name is removed only when it refers to \c symbol.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_symbol_index_remove
+(
+        DxfSymbolIndex *index,
+                /*!< a pointer to a \c DxfSymbolIndex. */
+        const char *name,
+                /*!< name of the symbol. */
+        void *symbol
+                /*!< a pointer to the symbol. */
+)
+{
+        size_t mask;
+        size_t home;
+        size_t i;
+        size_t j;
+
+        /* Do some basic checks. */
+        if ((index == NULL) || (name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (index->number_of_entries == 0)
+        {
+                return (EXIT_SUCCESS);
+        }
+        i = dxf_symbol_index_slot (index, name, dxf_symbol_index_hash (name));
+        if ((index->entries[i].name == NULL)
+          || (index->entries[i].symbol != symbol))
+        {
+                return (EXIT_SUCCESS);
+        }
+        dxf_free (index->entries[i].name);
+        index->entries[i].name = NULL;
+        index->entries[i].symbol = NULL;
+        index->number_of_entries--;
+        /* Shift following entries of the probe sequence back, so that
+         * no tombstones are needed. */
+        mask = index->size - 1;
+        for (j = (i + 1) & mask;
+          index->entries[j].name != NULL;
+          j = (j + 1) & mask)
+        {
+                home = index->entries[j].hash & mask;
+                /* Move the entry when its home slot is not cyclically
+                 * in (i, j]. */
+                if (((j > i) && ((home <= i) || (home > j)))
+                  || ((j < i) && ((home <= i) && (home > j))))
+                {
+                        index->entries[i] = index->entries[j];
+                        index->entries[j].name = NULL;
+                        index->entries[j].symbol = NULL;
+                        i = j;
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Find a symbol by name (case insensitive) in a
+ * \c DxfSymbolIndex.
+ *
+ * \return a pointer to the symbol, or \c NULL when no symbol with the
+ * name was found.
+ */
+void *
+dxf_symbol_index_find
+(
+        DxfSymbolIndex *index,
+                /*!< a pointer to a \c DxfSymbolIndex. */
+        const char *name
+                /*!< name of the symbol. */
+)
+{
+        size_t i;
+
+        /* Do some basic checks. */
+        if ((index == NULL) || (name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (index->number_of_entries == 0)
+        {
+                return (NULL);
+        }
+        i = dxf_symbol_index_slot (index, name, dxf_symbol_index_hash (name));
+        return (index->entries[i].symbol);
+}
+
+
+/*!
+ * \brief Get the number of entries in a \c DxfSymbolIndex.
+ *
+ * \return the number of entries.
+ */
+size_t
+dxf_symbol_index_get_number_of_entries
+(
+        DxfSymbolIndex *index
+                /*!< a pointer to a \c DxfSymbolIndex. */
+)
+{
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        return (index->number_of_entries);
+}
+
+
+/* EOF */
@@ -0,0 +1,109 @@
+/*!
+ * \file symbol_index.h
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Prototypes for a libDXF symbol name index.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_SYMBOL_INDEX_H
+#define LIBDXF_SRC_SYMBOL_INDEX_H
+
+
+#include "global.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_SYMBOL_INDEX_MIN_SIZE 16
+        /*!< \brief Initial number of slots of a symbol index. */
+
+
+/*!
+ * \brief Definition of a symbol index entry.
+ */
+typedef struct
+dxf_symbol_index_entry_struct
+{
+        char *name;
+                /*!< Copy of the name of the symbol, \c NULL for an
+                 * empty slot. */
+        unsigned long hash;
+                /*!< Hash value of the name. */
+        void *symbol;
+                /*!< Pointer to the symbol (table entry or block). */
+} DxfSymbolIndexEntry;
+
+
+/*!
+ * \brief Definition of a symbol index.
+ *
+ * A symbol index maps names to symbols (symbol table entries or block
+ * definitions) with a hash table.\n
+ * Names are compared case insensitive (ASCII), as DXF symbol names
+ * are.\n
+ * The hash table uses open addressing with linear probing, the number
+ * of slots is a power of two and at least twice the number of
+ * entries.
+ */
+typedef struct
+dxf_symbol_index_struct
+{
+        DxfSymbolIndexEntry *entries;
+                /*!< Slots of the hash table. */
+        size_t size;
+                /*!< Number of slots in \c entries. */
+        size_t number_of_entries;
+                /*!< Number of used slots in \c entries. */
+} DxfSymbolIndex;
+
+
+DxfSymbolIndex *dxf_symbol_index_new ();
+DxfSymbolIndex *dxf_symbol_index_init (DxfSymbolIndex *index);
+int dxf_symbol_index_free (DxfSymbolIndex *index);
+int dxf_symbol_index_clear (DxfSymbolIndex *index);
+unsigned long dxf_symbol_index_hash (const char *name);
+int dxf_symbol_index_insert (DxfSymbolIndex *index, const char *name, void *symbol);
+int dxf_symbol_index_remove (DxfSymbolIndex *index, const char *name, void *symbol);
+void *dxf_symbol_index_find (DxfSymbolIndex *index, const char *name);
+size_t dxf_symbol_index_get_number_of_entries (DxfSymbolIndex *index);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_SYMBOL_INDEX_H */
+
+
+/* EOF */
@@ -67,7 +67,7 @@ dxf_table_cell_new ()
         size = sizeof (DxfTableCell);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((cell = malloc (size)) == NULL)
+        if ((cell = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfTableCell struct.\n")),
@@ -105,7 +105,7 @@ dxf_table_new ()
         size = sizeof (DxfTable);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((table = malloc (size)) == NULL)
+        if ((table = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfTable struct.\n")),
@@ -145,25 +145,25 @@ dxf_table_cell_init
         /* Do some basic checks. */
         if (cell == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 cell = dxf_table_cell_new ();
         }
         if (cell == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfTableCell struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        cell->text_string = strdup ("");
+        cell->text_string = dxf_strdup ("");
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
-                cell->optional_text_string[i] = strdup ("");
-                cell->attdef_soft_pointer[i] = strdup ("");
+                cell->optional_text_string[i] = dxf_strdup ("");
+                cell->attdef_soft_pointer[i] = dxf_strdup ("");
         }
-        cell->text_style_name = strdup (DXF_DEFAULT_TEXTSTYLE);
+        cell->text_style_name = dxf_strdup (DXF_DEFAULT_TEXTSTYLE);
         cell->color_bg = 0;
         cell->color_fg = DXF_COLOR_BYLAYER;
         cell->border_color_right = DXF_COLOR_BYLAYER;
@@ -192,9 +192,9 @@ dxf_table_cell_init
         cell->border_visibility_override_bottom = 0;
         cell->border_visibility_override_left = 0;
         cell->border_visibility_override_top = 0;
-        cell->attdef_text_string = strdup ("");
-        cell->block_table_record_hard_pointer = strdup ("");
-        cell->field_object_pointer = strdup ("");
+        cell->attdef_text_string = dxf_strdup ("");
+        cell->block_table_record_hard_pointer = dxf_strdup ("");
+        cell->field_object_pointer = dxf_strdup ("");
         cell->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -225,21 +225,21 @@ dxf_table_init
         /* Do some basic checks. */
         if (table == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 table = dxf_table_new ();
         }
         if (table == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfTable struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         table->id_code = 0;
-        table->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        table->layer = strdup (DXF_DEFAULT_LAYER);
+        table->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        table->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         table->elevation = 0.0;
         table->thickness = 0.0;
         table->visibility = 0;
@@ -248,14 +248,14 @@ dxf_table_init
         table->graphics_data_size = 0;
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
-                table->binary_graphics_data[i] = strdup ("");
+                table->binary_graphics_data[i] = dxf_strdup ("");
                 table->row_height[i] = 0.0;
                 table->column_height[i] = 0.0;
         }
-        table->dictionary_owner_soft = strdup ("");
-        table->dictionary_owner_hard = strdup ("");
-        table->block_name = strdup ("");
-        table->table_text_style_name = strdup ("");
+        table->dictionary_owner_soft = dxf_strdup ("");
+        table->dictionary_owner_hard = dxf_strdup ("");
+        table->block_name = dxf_strdup ("");
+        table->table_text_style_name = dxf_strdup ("");
         table->x0 = 0.0;
         table->y0 = 0.0;
         table->z0 = 0.0;
@@ -284,8 +284,8 @@ dxf_table_init
         table->suppress_table_title = 0;
         table->suppress_header_row = 0;
         table->table_cell_color_fill_override = 0;
-        table->tablestyle_object_pointer = strdup ("");
-        table->owning_block_pointer = strdup ("");
+        table->tablestyle_object_pointer = dxf_strdup ("");
+        table->owning_block_pointer = dxf_strdup ("");
         table->cells = NULL;
         table->next = NULL;
 #if DEBUG
@@ -327,16 +327,16 @@ dxf_table_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (table == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 table = dxf_table_new ();
@@ -352,12 +352,12 @@ dxf_table_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 else if (strcmp (temp_string, "2") == 0)
@@ -488,7 +488,7 @@ dxf_table_read
                         && ((strcmp (temp_string, "AcDbBlockReference") != 0))
                         && ((strcmp (temp_string, "AcDbBlockTable") != 0)))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -554,13 +554,14 @@ dxf_table_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -591,14 +592,14 @@ dxf_table_cell_write
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (cell == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -634,13 +635,13 @@ dxf_table_cell_write
         }
         if (cell->number_of_block_attdefs < (i + 1))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () more attdefs encountered than expected.\n")),
                   __FUNCTION__);
         }
         else if (cell->number_of_block_attdefs > (i + 1))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () less attdefs encountered than expected.\n")),
                   __FUNCTION__);
         }
@@ -670,26 +671,26 @@ dxf_table_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("ACAD_TABLE");
+        char *dxf_entity_name = dxf_strdup ("ACAD_TABLE");
         int i;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (table == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
@@ -745,7 +746,7 @@ dxf_table_write
         }
 
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -775,29 +776,29 @@ dxf_table_cell_free
         /* Do some basic checks. */
         if (cell == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (cell->next != NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (cell->text_string);
+        dxf_free (cell->text_string);
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
-                free (cell->optional_text_string[i]);
-                free (cell->attdef_soft_pointer[i]);
+                dxf_free (cell->optional_text_string[i]);
+                dxf_free (cell->attdef_soft_pointer[i]);
         }
-        free (cell->text_style_name);
-        free (cell->attdef_text_string);
-        free (cell->block_table_record_hard_pointer);
-        free (cell->field_object_pointer);
-        free (cell);
+        dxf_free (cell->text_style_name);
+        dxf_free (cell->attdef_text_string);
+        dxf_free (cell->block_table_record_hard_pointer);
+        dxf_free (cell->field_object_pointer);
+        dxf_free (cell);
         cell = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -828,32 +829,32 @@ dxf_table_free
         /* Do some basic checks. */
         if (table == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (table->next != NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (table->linetype);
-        free (table->layer);
+        dxf_free (table->linetype);
+        dxf_free (table->layer);
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
-                free (table->binary_graphics_data[i]);
+                dxf_free (table->binary_graphics_data[i]);
         }
-        free (table->dictionary_owner_soft);
-        free (table->dictionary_owner_hard);
-        free (table->block_name);
-        free (table->table_text_style_name);
-        free (table->tablestyle_object_pointer);
-        free (table->owning_block_pointer);
+        dxf_free (table->dictionary_owner_soft);
+        dxf_free (table->dictionary_owner_hard);
+        dxf_free (table->block_name);
+        dxf_free (table->table_text_style_name);
+        dxf_free (table->tablestyle_object_pointer);
+        dxf_free (table->owning_block_pointer);
 //        dxf_table_cells_free_list (table->cells);
-        free (table);
+        dxf_free (table);
         table = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -874,19 +875,20 @@ dxf_table_cell_free_list
                  * cells. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (cells == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (cells != NULL)
         {
                 DxfTableCell *iter = (DxfTableCell *) cells->next;
+                cells->next = NULL;
                 dxf_table_cell_free (cells);
                 cells = (DxfTableCell *) iter;
         }
@@ -908,19 +910,20 @@ dxf_table_free_list
                  * \c TABLE entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (tables == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (tables != NULL)
         {
                 struct DxfTable *iter = tables->next;
+                tables->next = NULL;
                 dxf_table_free (tables);
                 tables = (DxfTable *) iter;
         }
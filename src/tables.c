@@ -34,6 +34,316 @@
 
 #include "tables.h"
 #include "section.h"
+#include <stddef.h>
+
+
+/*!
+ * \brief Symbol tables of a \c DxfTables, the order of the members.
+ */
+enum dxf_tables_symbol_table
+{
+        DXF_TABLES_APPID,
+        DXF_TABLES_BLOCK_RECORD,
+        DXF_TABLES_DIMSTYLE,
+        DXF_TABLES_LAYER,
+        DXF_TABLES_LTYPE,
+        DXF_TABLES_STYLE,
+        DXF_TABLES_UCS,
+        DXF_TABLES_VIEW,
+        DXF_TABLES_VPORT
+};
+
+
+/*!
+ * \brief Location of the list, and of the name, id-code and next members
+ * of the entries, for every symbol table.
+ */
+static const struct
+{
+        size_t list;
+        size_t name;
+        size_t id_code;
+        size_t next;
+} dxf_tables_symbol_tables[DXF_TABLES_NUMBER_OF_SYMBOL_TABLES] =
+{
+        {offsetof (DxfTables, appids), offsetof (DxfAppid, application_name), offsetof (DxfAppid, id_code), offsetof (DxfAppid, next)},
+        {offsetof (DxfTables, block_records), offsetof (DxfBlockRecord, block_name), offsetof (DxfBlockRecord, id_code), offsetof (DxfBlockRecord, next)},
+        {offsetof (DxfTables, dimstyles), offsetof (DxfDimStyle, dimstyle_name), offsetof (DxfDimStyle, id_code), offsetof (DxfDimStyle, next)},
+        {offsetof (DxfTables, layers), offsetof (DxfLayer, layer_name), offsetof (DxfLayer, id_code), offsetof (DxfLayer, next)},
+        {offsetof (DxfTables, ltypes), offsetof (DxfLType, linetype_name), offsetof (DxfLType, id_code), offsetof (DxfLType, next)},
+        {offsetof (DxfTables, styles), offsetof (DxfStyle, style_name), offsetof (DxfStyle, id_code), offsetof (DxfStyle, next)},
+        {offsetof (DxfTables, ucss), offsetof (DxfUcs, UCS_name), offsetof (DxfUcs, id_code), offsetof (DxfUcs, next)},
+        {offsetof (DxfTables, views), offsetof (DxfView, name), offsetof (DxfView, id_code), offsetof (DxfView, next)},
+        {offsetof (DxfTables, vports), offsetof (DxfVPort, viewport_name), offsetof (DxfVPort, id_code), offsetof (DxfVPort, next)}
+};
+
+
+/*!
+ * \brief Get the address of the list of a symbol table.
+ */
+static void **
+dxf_tables_get_list_address
+(
+        DxfTables *tables,
+        int table
+)
+{
+        return ((void **) ((char *) tables + dxf_tables_symbol_tables[table].list));
+}
+
+
+/*!
+ * \brief Get the name of a symbol table entry.
+ */
+static char *
+dxf_tables_get_entry_name
+(
+        int table,
+        void *entry
+)
+{
+        return (*(char **) ((char *) entry + dxf_tables_symbol_tables[table].name));
+}
+
+
+/*!
+ * \brief Get the address of the next member of a symbol table entry.
+ */
+static void **
+dxf_tables_get_next_address
+(
+        int table,
+        void *entry
+)
+{
+        return ((void **) ((char *) entry + dxf_tables_symbol_tables[table].next));
+}
+
+
+/*!
+ * \brief Discard the name index of a symbol table.
+ */
+static void
+dxf_tables_discard_index
+(
+        DxfTables *tables,
+        int table
+)
+{
+        if (tables->indexes[table] != NULL)
+        {
+                dxf_symbol_index_free (tables->indexes[table]);
+        }
+        tables->indexes[table] = NULL;
+        tables->last_entries[table] = NULL;
+}
+
+
+/*!
+ * \brief Build the name index of a symbol table, when not built yet.
+ */
+static int
+dxf_tables_build_index
+(
+        DxfTables *tables,
+        int table
+)
+{
+        DxfSymbolIndex *index = NULL;
+        void *entry = NULL;
+        char *name = NULL;
+
+        if (tables->indexes[table] != NULL)
+        {
+                return (EXIT_SUCCESS);
+        }
+        index = dxf_symbol_index_init (dxf_symbol_index_new ());
+        if (index == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        for (entry = *dxf_tables_get_list_address (tables, table);
+          entry != NULL;
+          entry = *dxf_tables_get_next_address (table, entry))
+        {
+                name = dxf_tables_get_entry_name (table, entry);
+                if ((name != NULL)
+                  && (dxf_symbol_index_insert (index, name, entry) != EXIT_SUCCESS))
+                {
+                        dxf_symbol_index_free (index);
+                        return (EXIT_FAILURE);
+                }
+        }
+        tables->indexes[table] = index;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Find a symbol table entry by name (case insensitive).
+ *
+ * The name index is built on the first lookup, later lookups only read
+ * the index.
+ */
+static void *
+dxf_tables_find_entry
+(
+        DxfTables *tables,
+        int table,
+        const char *name
+)
+{
+        if (dxf_tables_build_index (tables, table) != EXIT_SUCCESS)
+        {
+                return (NULL);
+        }
+        return (dxf_symbol_index_find (tables->indexes[table], name));
+}
+
+
+/*!
+ * \brief Append an entry to a symbol table and its name index.
+ *
+ * When the name of the entry is in the table already, the entry is
+ * appended but lookups keep finding the first entry with that name.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the entry
+ * is in the table already or could not be added to the name index.
+ */
+static int
+dxf_tables_add_entry
+(
+        DxfTables *tables,
+        int table,
+        void *entry
+)
+{
+        void **address = NULL;
+        void *last = NULL;
+        char *name = NULL;
+
+        name = dxf_tables_get_entry_name (table, entry);
+        /* Appending an entry twice would make the list circular. */
+        if ((entry == tables->last_entries[table])
+          || ((tables->indexes[table] != NULL) && (name != NULL)
+          && (dxf_symbol_index_find (tables->indexes[table], name) == entry)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the entry is in the symbol table already.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        *dxf_tables_get_next_address (table, entry) = NULL;
+        address = dxf_tables_get_list_address (tables, table);
+        if (*address == NULL)
+        {
+                *address = entry;
+        }
+        else
+        {
+                last = tables->last_entries[table];
+                if (last == NULL)
+                {
+                        last = *address;
+                }
+                while (*dxf_tables_get_next_address (table, last) != NULL)
+                {
+                        last = *dxf_tables_get_next_address (table, last);
+                }
+                *dxf_tables_get_next_address (table, last) = entry;
+        }
+        tables->last_entries[table] = entry;
+        if ((tables->indexes[table] != NULL) && (name != NULL)
+          && (dxf_symbol_index_insert (tables->indexes[table], name, entry) != EXIT_SUCCESS))
+        {
+                /* The entry is in the list, let the next lookup rebuild
+                 * the index. */
+                dxf_tables_discard_index (tables, table);
+                fprintf (stderr,
+                  (_("Error in %s () could not add the entry to the name index.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Remove an entry from the name index of a symbol table.
+ *
+ * When another entry with the same name follows in the list, starting
+ * at \c following, that entry takes the place of \c entry in the name
+ * index.
+ */
+static int
+dxf_tables_unindex_entry
+(
+        DxfTables *tables,
+        int table,
+        void *entry,
+        void *following
+)
+{
+        void *iter = NULL;
+        char *name = NULL;
+        char *iter_name = NULL;
+
+        name = dxf_tables_get_entry_name (table, entry);
+        if ((tables->indexes[table] == NULL) || (name == NULL)
+          || (dxf_symbol_index_find (tables->indexes[table], name) != entry))
+        {
+                return (EXIT_SUCCESS);
+        }
+        dxf_symbol_index_remove (tables->indexes[table], name, entry);
+        for (iter = following;
+          iter != NULL;
+          iter = *dxf_tables_get_next_address (table, iter))
+        {
+                iter_name = dxf_tables_get_entry_name (table, iter);
+                if ((iter_name != NULL) && (strcasecmp (iter_name, name) == 0))
+                {
+                        return (dxf_symbol_index_insert (tables->indexes[table],
+                          iter_name, iter));
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Unlink an entry from a symbol table and its name index.
+ *
+ * When another entry with the same name follows in the list, that
+ * entry takes the place of the removed entry in the name index.
+ */
+static int
+dxf_tables_remove_entry
+(
+        DxfTables *tables,
+        int table,
+        void *entry
+)
+{
+        void **address = NULL;
+
+        for (address = dxf_tables_get_list_address (tables, table);
+          (*address != NULL) && (*address != entry);
+          address = dxf_tables_get_next_address (table, *address))
+        {
+        }
+        if (*address == NULL)
+        {
+                /* Not in the list. */
+                return (EXIT_FAILURE);
+        }
+        *address = *dxf_tables_get_next_address (table, entry);
+        *dxf_tables_get_next_address (table, entry) = NULL;
+        if (tables->last_entries[table] == entry)
+        {
+                tables->last_entries[table] = NULL;
+        }
+        return (dxf_tables_unindex_entry (tables, table, entry, *address));
+}
 
 
 /*!
@@ -56,7 +366,7 @@ dxf_tables_new ()
         size = sizeof (DxfTables);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((tables = malloc (size)) == NULL)
+        if ((tables = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfTables struct.\n")),
@@ -91,17 +401,19 @@ dxf_tables_init
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        int i;
+
         /* Do some basic checks. */
         if (tables == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 tables = dxf_tables_new ();
         }
         if (tables == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfTables struct.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -116,6 +428,11 @@ dxf_tables_init
         tables->ucss = (DxfUcs *) dxf_ucs_init ((DxfUcs *) tables->ucss);
         tables->views = (DxfView *) dxf_view_init ((DxfView *) tables->views);
         tables->vports = (DxfVPort *) dxf_vport_init ((DxfVPort *) tables->vports);
+        for (i = 0; i < DXF_TABLES_NUMBER_OF_SYMBOL_TABLES; i++)
+        {
+                tables->indexes[i] = NULL;
+                tables->last_entries[i] = NULL;
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -141,16 +458,16 @@ dxf_tables_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_section_name = strdup ("TABLES");
+        char *dxf_section_name = dxf_strdup ("TABLES");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_section_name);
+                dxf_free (dxf_section_name);
                 return (EXIT_FAILURE);
         }
         dxf_section_write (fp, dxf_section_name);
@@ -180,22 +497,56 @@ dxf_tables_free
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        int i;
+
         if (tables == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (tables->appids);
-        free (tables->block_records);
-        free (tables->dimstyles);
-        free (tables->layers);
-        free (tables->ltypes);
-        free (tables->styles);
-        free (tables->ucss);
-        free (tables->views);
-        free (tables->vports);
+        if (tables->appids != NULL)
+        {
+                dxf_appid_free_list ((DxfAppid *) tables->appids);
+        }
+        if (tables->block_records != NULL)
+        {
+                dxf_block_record_free_list ((DxfBlockRecord *) tables->block_records);
+        }
+        if (tables->dimstyles != NULL)
+        {
+                dxf_dimstyle_free_list ((DxfDimStyle *) tables->dimstyles);
+        }
+        if (tables->layers != NULL)
+        {
+                dxf_layer_free_list ((DxfLayer *) tables->layers);
+        }
+        if (tables->ltypes != NULL)
+        {
+                dxf_ltype_free_list ((DxfLType *) tables->ltypes);
+        }
+        if (tables->styles != NULL)
+        {
+                dxf_style_free_list ((DxfStyle *) tables->styles);
+        }
+        if (tables->ucss != NULL)
+        {
+                dxf_ucs_free_list ((DxfUcs *) tables->ucss);
+        }
+        if (tables->views != NULL)
+        {
+                dxf_view_free_list ((DxfView *) tables->views);
+        }
+        if (tables->vports != NULL)
+        {
+                dxf_vport_free_list ((DxfVPort *) tables->vports);
+        }
+        for (i = 0; i < DXF_TABLES_NUMBER_OF_SYMBOL_TABLES; i++)
+        {
+                dxf_tables_discard_index (tables, i);
+        }
+        dxf_free (tables);
         tables = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -344,6 +695,7 @@ dxf_tables_set_appids
                   __FUNCTION__);
                 return (NULL);
         }
+        dxf_tables_discard_index (tables, DXF_TABLES_APPID);
         tables->appids = appids;
 #if DEBUG
         DXF_DEBUG_END
@@ -419,6 +771,7 @@ dxf_tables_set_block_records
                   __FUNCTION__);
                 return (NULL);
         }
+        dxf_tables_discard_index (tables, DXF_TABLES_BLOCK_RECORD);
         tables->block_records = block_records;
 #if DEBUG
         DXF_DEBUG_END
@@ -494,6 +847,7 @@ dxf_tables_set_dimstyles
                   __FUNCTION__);
                 return (NULL);
         }
+        dxf_tables_discard_index (tables, DXF_TABLES_DIMSTYLE);
         tables->dimstyles = dimstyles;
 #if DEBUG
         DXF_DEBUG_END
@@ -569,6 +923,7 @@ dxf_tables_set_layers
                   __FUNCTION__);
                 return (NULL);
         }
+        dxf_tables_discard_index (tables, DXF_TABLES_LAYER);
         tables->layers = layers;
 #if DEBUG
         DXF_DEBUG_END
@@ -644,6 +999,7 @@ dxf_tables_set_ltypes
                   __FUNCTION__);
                 return (NULL);
         }
+        dxf_tables_discard_index (tables, DXF_TABLES_LTYPE);
         tables->ltypes = ltypes;
 #if DEBUG
         DXF_DEBUG_END
@@ -719,6 +1075,7 @@ dxf_tables_set_styles
                   __FUNCTION__);
                 return (NULL);
         }
+        dxf_tables_discard_index (tables, DXF_TABLES_STYLE);
         tables->styles = styles;
 #if DEBUG
         DXF_DEBUG_END
@@ -794,6 +1151,7 @@ dxf_tables_set_ucss
                   __FUNCTION__);
                 return (NULL);
         }
+        dxf_tables_discard_index (tables, DXF_TABLES_UCS);
         tables->ucss = ucss;
 #if DEBUG
         DXF_DEBUG_END
@@ -869,6 +1227,7 @@ dxf_tables_set_views
                   __FUNCTION__);
                 return (NULL);
         }
+        dxf_tables_discard_index (tables, DXF_TABLES_VIEW);
         tables->views = views;
 #if DEBUG
         DXF_DEBUG_END
@@ -944,6 +1303,7 @@ dxf_tables_set_vports
                   __FUNCTION__);
                 return (NULL);
         }
+        dxf_tables_discard_index (tables, DXF_TABLES_VPORT);
         tables->vports = vports;
 #if DEBUG
         DXF_DEBUG_END
@@ -952,4 +1312,1326 @@ dxf_tables_set_vports
 }
 
 
+/*!
+ * \brief Build the name indexes of all symbol tables of a DXF
+ * \c TABLES section.
+ *
+ * Indexes are built on the first lookup anyway, which modifies
+ * \c tables: build them in advance when lookups are to be done from
+ * multiple threads.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tables_build_indexes
+(
+        DxfTables *tables
+                /*!< a pointer to a DXF \c TABLES section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        /* Do some basic checks. */
+        if (tables == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < DXF_TABLES_NUMBER_OF_SYMBOL_TABLES; i++)
+        {
+                if (dxf_tables_build_index (tables, i) != EXIT_SUCCESS)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Discard the name indexes of all symbol tables of a DXF
+ * \c TABLES section.
+ *
+ * Call this function after changing the lists directly, or after
+ * renaming entries with their name setters instead of
+ * dxf_tables_rename_entry (), the indexes are rebuilt on the next
+ * lookup.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tables_clear_indexes
+(
+        DxfTables *tables
+                /*!< a pointer to a DXF \c TABLES section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        /* Do some basic checks. */
+        if (tables == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < DXF_TABLES_NUMBER_OF_SYMBOL_TABLES; i++)
+        {
+                dxf_tables_discard_index (tables, i);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the first entry of symbol table \c table of a DXF
+ * \c TABLES section.
+ *
+ * \c table is the number of the symbol table, in the order of the
+ * members of \c DxfTables (0 for \c APPID up to
+ * \c DXF_TABLES_NUMBER_OF_SYMBOL_TABLES - 1 for \c VPORT).
+ *
+ * \return a pointer to the first entry, or \c NULL when the symbol
+ * table is empty or an error occurred.
+ */
+void *
+dxf_tables_get_first_entry
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        int table
+                /*!< the number of the symbol table. */
+)
+{
+        /* Do some basic checks. */
+        if (tables == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((table < 0) || (table >= DXF_TABLES_NUMBER_OF_SYMBOL_TABLES))
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () an invalid symbol table was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        return (*dxf_tables_get_list_address (tables, table));
+}
+
+
+/*!
+ * \brief Get the entry following \c entry in symbol table \c table.
+ *
+ * \return a pointer to the next entry, or \c NULL after the last entry.
+ */
+void *
+dxf_tables_get_next_entry
+(
+        int table,
+                /*!< the number of the symbol table. */
+        void *entry
+                /*!< a pointer to an entry of the symbol table. */
+)
+{
+        if ((entry == NULL)
+          || (table < 0)
+          || (table >= DXF_TABLES_NUMBER_OF_SYMBOL_TABLES))
+        {
+                return (NULL);
+        }
+        return (*dxf_tables_get_next_address (table, entry));
+}
+
+
+/*!
+ * \brief Get the id-code (handle) of an entry of symbol table
+ * \c table.
+ *
+ * \return the id-code, or -1 when an error occurred.
+ */
+int
+dxf_tables_get_entry_id_code
+(
+        int table,
+                /*!< the number of the symbol table. */
+        void *entry
+                /*!< a pointer to an entry of the symbol table. */
+)
+{
+        if ((entry == NULL)
+          || (table < 0)
+          || (table >= DXF_TABLES_NUMBER_OF_SYMBOL_TABLES))
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer or an invalid symbol table was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        return (*(int *) ((char *) entry + dxf_tables_symbol_tables[table].id_code));
+}
+
+
+/*!
+ * \brief Set the id-code (handle) of an entry of symbol table
+ * \c table.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tables_set_entry_id_code
+(
+        int table,
+                /*!< the number of the symbol table. */
+        void *entry,
+                /*!< a pointer to an entry of the symbol table. */
+        int id_code
+                /*!< the id-code to be set. */
+)
+{
+        if ((entry == NULL)
+          || (table < 0)
+          || (table >= DXF_TABLES_NUMBER_OF_SYMBOL_TABLES))
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer or an invalid symbol table was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        *(int *) ((char *) entry + dxf_tables_symbol_tables[table].id_code) = id_code;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Rename an entry of symbol table \c table.
+ *
+ * The name index of the symbol table is updated right away, so lookups
+ * find the entry by its new name.\n
+ * \c entry has to be in the symbol table.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tables_rename_entry
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        int table,
+                /*!< the number of the symbol table. */
+        void *entry,
+                /*!< a pointer to an entry of the symbol table. */
+        const char *name
+                /*!< the new name of the entry. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char **address = NULL;
+        char *new_name = NULL;
+        void *first = NULL;
+        int indexed;
+
+        /* Do some basic checks. */
+        if ((tables == NULL) || (entry == NULL) || (name == NULL)
+          || (table < 0)
+          || (table >= DXF_TABLES_NUMBER_OF_SYMBOL_TABLES))
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer or an invalid symbol table was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        new_name = dxf_strdup (name);
+        if (new_name == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        indexed = (tables->indexes[table] != NULL);
+        if (dxf_tables_unindex_entry (tables, table, entry,
+          *dxf_tables_get_next_address (table, entry)) != EXIT_SUCCESS)
+        {
+                dxf_tables_discard_index (tables, table);
+        }
+        address = (char **) ((char *) entry + dxf_tables_symbol_tables[table].name);
+        dxf_free (*address);
+        *address = new_name;
+        if (tables->indexes[table] != NULL)
+        {
+                first = dxf_symbol_index_find (tables->indexes[table], new_name);
+                if (first == NULL)
+                {
+                        if (dxf_symbol_index_insert (tables->indexes[table],
+                          new_name, entry) != EXIT_SUCCESS)
+                        {
+                                dxf_tables_discard_index (tables, table);
+                        }
+                }
+                else if (first != entry)
+                {
+                        /* Another entry has the name, the first of
+                         * both in the list is found. */
+                        dxf_tables_discard_index (tables, table);
+                }
+        }
+        if (indexed && (tables->indexes[table] == NULL)
+          && (dxf_tables_build_index (tables, table) != EXIT_SUCCESS))
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Find a \c APPID symbol table entry by name (case insensitive)
+ * in a DXF \c TABLES section.
+ *
+ * \return a pointer to the first entry with the name, or \c NULL when
+ * no entry with the name was found.
+ */
+DxfAppid *
+dxf_tables_find_appid
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        const char *name
+                /*!< name of the \c APPID symbol table entry. */
+)
+{
+        /* Do some basic checks. */
+        if ((tables == NULL) || (name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        return ((DxfAppid *) dxf_tables_find_entry (tables, DXF_TABLES_APPID, name));
+}
+
+
+/*!
+ * \brief Append a \c APPID symbol table entry to a DXF \c TABLES
+ * section.
+ *
+ * The entry becomes the last entry of the list and is added to the name
+ * index.
+ *
+ * \return a pointer to \c tables when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfTables *
+dxf_tables_add_appid
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        DxfAppid *appid
+                /*!< a pointer to the \c APPID symbol table entry. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((tables == NULL) || (appid == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (dxf_tables_add_entry (tables, DXF_TABLES_APPID, appid) != EXIT_SUCCESS)
+        {
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tables);
+}
+
+
+/*!
+ * \brief Remove a \c APPID symbol table entry from a DXF \c TABLES
+ * section.
+ *
+ * The entry is unlinked from the list and the name index, it is not
+ * freed.
+ *
+ * \return a pointer to \c tables when successful, or \c NULL when the
+ * entry is not in the list.
+ */
+DxfTables *
+dxf_tables_remove_appid
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        DxfAppid *appid
+                /*!< a pointer to the \c APPID symbol table entry. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((tables == NULL) || (appid == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (dxf_tables_remove_entry (tables, DXF_TABLES_APPID, appid) != EXIT_SUCCESS)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the entry was not found.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tables);
+}
+
+
+/*!
+ * \brief Find a \c BLOCK_RECORD symbol table entry by name (case insensitive)
+ * in a DXF \c TABLES section.
+ *
+ * \return a pointer to the first entry with the name, or \c NULL when
+ * no entry with the name was found.
+ */
+DxfBlockRecord *
+dxf_tables_find_block_record
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        const char *name
+                /*!< name of the \c BLOCK_RECORD symbol table entry. */
+)
+{
+        /* Do some basic checks. */
+        if ((tables == NULL) || (name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        return ((DxfBlockRecord *) dxf_tables_find_entry (tables, DXF_TABLES_BLOCK_RECORD, name));
+}
+
+
+/*!
+ * \brief Append a \c BLOCK_RECORD symbol table entry to a DXF \c TABLES
+ * section.
+ *
+ * The entry becomes the last entry of the list and is added to the name
+ * index.
+ *
+ * \return a pointer to \c tables when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfTables *
+dxf_tables_add_block_record
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        DxfBlockRecord *block_record
+                /*!< a pointer to the \c BLOCK_RECORD symbol table entry. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((tables == NULL) || (block_record == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (dxf_tables_add_entry (tables, DXF_TABLES_BLOCK_RECORD, block_record) != EXIT_SUCCESS)
+        {
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tables);
+}
+
+
+/*!
+ * \brief Remove a \c BLOCK_RECORD symbol table entry from a DXF \c TABLES
+ * section.
+ *
+ * The entry is unlinked from the list and the name index, it is not
+ * freed.
+ *
+ * \return a pointer to \c tables when successful, or \c NULL when the
+ * entry is not in the list.
+ */
+DxfTables *
+dxf_tables_remove_block_record
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        DxfBlockRecord *block_record
+                /*!< a pointer to the \c BLOCK_RECORD symbol table entry. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((tables == NULL) || (block_record == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (dxf_tables_remove_entry (tables, DXF_TABLES_BLOCK_RECORD, block_record) != EXIT_SUCCESS)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the entry was not found.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tables);
+}
+
+
+/*!
+ * \brief Find a \c DIMSTYLE symbol table entry by name (case insensitive)
+ * in a DXF \c TABLES section.
+ *
+ * \return a pointer to the first entry with the name, or \c NULL when
+ * no entry with the name was found.
+ */
+DxfDimStyle *
+dxf_tables_find_dimstyle
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        const char *name
+                /*!< name of the \c DIMSTYLE symbol table entry. */
+)
+{
+        /* Do some basic checks. */
+        if ((tables == NULL) || (name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        return ((DxfDimStyle *) dxf_tables_find_entry (tables, DXF_TABLES_DIMSTYLE, name));
+}
+
+
+/*!
+ * \brief Append a \c DIMSTYLE symbol table entry to a DXF \c TABLES
+ * section.
+ *
+ * The entry becomes the last entry of the list and is added to the name
+ * index.
+ *
+ * \return a pointer to \c tables when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfTables *
+dxf_tables_add_dimstyle
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        DxfDimStyle *dimstyle
+                /*!< a pointer to the \c DIMSTYLE symbol table entry. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((tables == NULL) || (dimstyle == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (dxf_tables_add_entry (tables, DXF_TABLES_DIMSTYLE, dimstyle) != EXIT_SUCCESS)
+        {
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tables);
+}
+
+
+/*!
+ * \brief Remove a \c DIMSTYLE symbol table entry from a DXF \c TABLES
+ * section.
+ *
+ * The entry is unlinked from the list and the name index, it is not
+ * freed.
+ *
+ * \return a pointer to \c tables when successful, or \c NULL when the
+ * entry is not in the list.
+ */
+DxfTables *
+dxf_tables_remove_dimstyle
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        DxfDimStyle *dimstyle
+                /*!< a pointer to the \c DIMSTYLE symbol table entry. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((tables == NULL) || (dimstyle == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (dxf_tables_remove_entry (tables, DXF_TABLES_DIMSTYLE, dimstyle) != EXIT_SUCCESS)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the entry was not found.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tables);
+}
+
+
+/*!
+ * \brief Find a \c LAYER symbol table entry by name (case insensitive)
+ * in a DXF \c TABLES section.
+ *
+ * \return a pointer to the first entry with the name, or \c NULL when
+ * no entry with the name was found.
+ */
+DxfLayer *
+dxf_tables_find_layer
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        const char *name
+                /*!< name of the \c LAYER symbol table entry. */
+)
+{
+        /* Do some basic checks. */
+        if ((tables == NULL) || (name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        return ((DxfLayer *) dxf_tables_find_entry (tables, DXF_TABLES_LAYER, name));
+}
+
+
+/*!
+ * \brief Append a \c LAYER symbol table entry to a DXF \c TABLES
+ * section.
+ *
+ * The entry becomes the last entry of the list and is added to the name
+ * index.
+ *
+ * \return a pointer to \c tables when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfTables *
+dxf_tables_add_layer
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        DxfLayer *layer
+                /*!< a pointer to the \c LAYER symbol table entry. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((tables == NULL) || (layer == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (dxf_tables_add_entry (tables, DXF_TABLES_LAYER, layer) != EXIT_SUCCESS)
+        {
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tables);
+}
+
+
+/*!
+ * \brief Remove a \c LAYER symbol table entry from a DXF \c TABLES
+ * section.
+ *
+ * The entry is unlinked from the list and the name index, it is not
+ * freed.
+ *
+ * \return a pointer to \c tables when successful, or \c NULL when the
+ * entry is not in the list.
+ */
+DxfTables *
+dxf_tables_remove_layer
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        DxfLayer *layer
+                /*!< a pointer to the \c LAYER symbol table entry. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((tables == NULL) || (layer == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (dxf_tables_remove_entry (tables, DXF_TABLES_LAYER, layer) != EXIT_SUCCESS)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the entry was not found.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tables);
+}
+
+
+/*!
+ * \brief Find a \c LTYPE symbol table entry by name (case insensitive)
+ * in a DXF \c TABLES section.
+ *
+ * \return a pointer to the first entry with the name, or \c NULL when
+ * no entry with the name was found.
+ */
+DxfLType *
+dxf_tables_find_ltype
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        const char *name
+                /*!< name of the \c LTYPE symbol table entry. */
+)
+{
+        /* Do some basic checks. */
+        if ((tables == NULL) || (name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        return ((DxfLType *) dxf_tables_find_entry (tables, DXF_TABLES_LTYPE, name));
+}
+
+
+/*!
+ * \brief Append a \c LTYPE symbol table entry to a DXF \c TABLES
+ * section.
+ *
+ * The entry becomes the last entry of the list and is added to the name
+ * index.
+ *
+ * \return a pointer to \c tables when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfTables *
+dxf_tables_add_ltype
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        DxfLType *ltype
+                /*!< a pointer to the \c LTYPE symbol table entry. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((tables == NULL) || (ltype == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (dxf_tables_add_entry (tables, DXF_TABLES_LTYPE, ltype) != EXIT_SUCCESS)
+        {
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tables);
+}
+
+
+/*!
+ * \brief Remove a \c LTYPE symbol table entry from a DXF \c TABLES
+ * section.
+ *
+ * The entry is unlinked from the list and the name index, it is not
+ * freed.
+ *
+ * \return a pointer to \c tables when successful, or \c NULL when the
+ * entry is not in the list.
+ */
+DxfTables *
+dxf_tables_remove_ltype
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        DxfLType *ltype
+                /*!< a pointer to the \c LTYPE symbol table entry. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((tables == NULL) || (ltype == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (dxf_tables_remove_entry (tables, DXF_TABLES_LTYPE, ltype) != EXIT_SUCCESS)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the entry was not found.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tables);
+}
+
+
+/*!
+ * \brief Find a \c STYLE symbol table entry by name (case insensitive)
+ * in a DXF \c TABLES section.
+ *
+ * \return a pointer to the first entry with the name, or \c NULL when
+ * no entry with the name was found.
+ */
+DxfStyle *
+dxf_tables_find_style
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        const char *name
+                /*!< name of the \c STYLE symbol table entry. */
+)
+{
+        /* Do some basic checks. */
+        if ((tables == NULL) || (name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        return ((DxfStyle *) dxf_tables_find_entry (tables, DXF_TABLES_STYLE, name));
+}
+
+
+/*!
+ * \brief Append a \c STYLE symbol table entry to a DXF \c TABLES
+ * section.
+ *
+ * The entry becomes the last entry of the list and is added to the name
+ * index.
+ *
+ * \return a pointer to \c tables when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfTables *
+dxf_tables_add_style
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        DxfStyle *style
+                /*!< a pointer to the \c STYLE symbol table entry. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((tables == NULL) || (style == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (dxf_tables_add_entry (tables, DXF_TABLES_STYLE, style) != EXIT_SUCCESS)
+        {
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tables);
+}
+
+
+/*!
+ * \brief Remove a \c STYLE symbol table entry from a DXF \c TABLES
+ * section.
+ *
+ * The entry is unlinked from the list and the name index, it is not
+ * freed.
+ *
+ * \return a pointer to \c tables when successful, or \c NULL when the
+ * entry is not in the list.
+ */
+DxfTables *
+dxf_tables_remove_style
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        DxfStyle *style
+                /*!< a pointer to the \c STYLE symbol table entry. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((tables == NULL) || (style == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (dxf_tables_remove_entry (tables, DXF_TABLES_STYLE, style) != EXIT_SUCCESS)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the entry was not found.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tables);
+}
+
+
+/*!
+ * \brief Find a \c UCS symbol table entry by name (case insensitive)
+ * in a DXF \c TABLES section.
+ *
+ * \return a pointer to the first entry with the name, or \c NULL when
+ * no entry with the name was found.
+ */
+DxfUcs *
+dxf_tables_find_ucs
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        const char *name
+                /*!< name of the \c UCS symbol table entry. */
+)
+{
+        /* Do some basic checks. */
+        if ((tables == NULL) || (name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        return ((DxfUcs *) dxf_tables_find_entry (tables, DXF_TABLES_UCS, name));
+}
+
+
+/*!
+ * \brief Append a \c UCS symbol table entry to a DXF \c TABLES
+ * section.
+ *
+ * The entry becomes the last entry of the list and is added to the name
+ * index.
+ *
+ * \return a pointer to \c tables when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfTables *
+dxf_tables_add_ucs
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        DxfUcs *ucs
+                /*!< a pointer to the \c UCS symbol table entry. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((tables == NULL) || (ucs == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (dxf_tables_add_entry (tables, DXF_TABLES_UCS, ucs) != EXIT_SUCCESS)
+        {
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tables);
+}
+
+
+/*!
+ * \brief Remove a \c UCS symbol table entry from a DXF \c TABLES
+ * section.
+ *
+ * The entry is unlinked from the list and the name index, it is not
+ * freed.
+ *
+ * \return a pointer to \c tables when successful, or \c NULL when the
+ * entry is not in the list.
+ */
+DxfTables *
+dxf_tables_remove_ucs
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        DxfUcs *ucs
+                /*!< a pointer to the \c UCS symbol table entry. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((tables == NULL) || (ucs == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (dxf_tables_remove_entry (tables, DXF_TABLES_UCS, ucs) != EXIT_SUCCESS)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the entry was not found.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tables);
+}
+
+
+/*!
+ * \brief Find a \c VIEW symbol table entry by name (case insensitive)
+ * in a DXF \c TABLES section.
+ *
+ * \return a pointer to the first entry with the name, or \c NULL when
+ * no entry with the name was found.
+ */
+DxfView *
+dxf_tables_find_view
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        const char *name
+                /*!< name of the \c VIEW symbol table entry. */
+)
+{
+        /* Do some basic checks. */
+        if ((tables == NULL) || (name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        return ((DxfView *) dxf_tables_find_entry (tables, DXF_TABLES_VIEW, name));
+}
+
+
+/*!
+ * \brief Append a \c VIEW symbol table entry to a DXF \c TABLES
+ * section.
+ *
+ * The entry becomes the last entry of the list and is added to the name
+ * index.
+ *
+ * \return a pointer to \c tables when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfTables *
+dxf_tables_add_view
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        DxfView *view
+                /*!< a pointer to the \c VIEW symbol table entry. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((tables == NULL) || (view == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (dxf_tables_add_entry (tables, DXF_TABLES_VIEW, view) != EXIT_SUCCESS)
+        {
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tables);
+}
+
+
+/*!
+ * \brief Remove a \c VIEW symbol table entry from a DXF \c TABLES
+ * section.
+ *
+ * The entry is unlinked from the list and the name index, it is not
+ * freed.
+ *
+ * \return a pointer to \c tables when successful, or \c NULL when the
+ * entry is not in the list.
+ */
+DxfTables *
+dxf_tables_remove_view
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        DxfView *view
+                /*!< a pointer to the \c VIEW symbol table entry. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((tables == NULL) || (view == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (dxf_tables_remove_entry (tables, DXF_TABLES_VIEW, view) != EXIT_SUCCESS)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the entry was not found.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tables);
+}
+
+
+/*!
+ * \brief Find a \c VPORT symbol table entry by name (case insensitive)
+ * in a DXF \c TABLES section.
+ *
+ * \return a pointer to the first entry with the name, or \c NULL when
+ * no entry with the name was found.
+ */
+DxfVPort *
+dxf_tables_find_vport
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        const char *name
+                /*!< name of the \c VPORT symbol table entry. */
+)
+{
+        /* Do some basic checks. */
+        if ((tables == NULL) || (name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        return ((DxfVPort *) dxf_tables_find_entry (tables, DXF_TABLES_VPORT, name));
+}
+
+
+/*!
+ * \brief Append a \c VPORT symbol table entry to a DXF \c TABLES
+ * section.
+ *
+ * The entry becomes the last entry of the list and is added to the name
+ * index.
+ *
+ * \return a pointer to \c tables when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfTables *
+dxf_tables_add_vport
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        DxfVPort *vport
+                /*!< a pointer to the \c VPORT symbol table entry. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((tables == NULL) || (vport == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (dxf_tables_add_entry (tables, DXF_TABLES_VPORT, vport) != EXIT_SUCCESS)
+        {
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tables);
+}
+
+
+/*!
+ * \brief Remove a \c VPORT symbol table entry from a DXF \c TABLES
+ * section.
+ *
+ * The entry is unlinked from the list and the name index, it is not
+ * freed.
+ *
+ * \return a pointer to \c tables when successful, or \c NULL when the
+ * entry is not in the list.
+ */
+DxfTables *
+dxf_tables_remove_vport
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        DxfVPort *vport
+                /*!< a pointer to the \c VPORT symbol table entry. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((tables == NULL) || (vport == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (dxf_tables_remove_entry (tables, DXF_TABLES_VPORT, vport) != EXIT_SUCCESS)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the entry was not found.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tables);
+}
+
+
 /* EOF */
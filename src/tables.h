@@ -65,6 +65,7 @@
 #include "ucs.h"
 #include "view.h"
 #include "vport.h"
+#include "symbol_index.h"
 
 
 #ifdef __cplusplus
@@ -72,6 +73,11 @@ extern "C" {
 #endif
 
 
+#define DXF_TABLES_NUMBER_OF_SYMBOL_TABLES 9
+        /*!< \brief Number of symbol tables in a \c DxfTables, the
+         * number of name indexes. */
+
+
 /*!
  * \brief DXF definition of a tables section.
  */
@@ -99,6 +105,17 @@ dxf_tables_struct
                 /*!< Pointer to the first \c VIEW symbol table entry. */
         DxfVPort *vports;
                 /*!< Pointer to the first \c VPORT symbol table entry. */
+        DxfSymbolIndex *indexes[DXF_TABLES_NUMBER_OF_SYMBOL_TABLES];
+                /*!< Name indexes of the symbol tables (in the order of
+                 * the members above).\n
+                 * An index is built on the first lookup and maintained
+                 * by the add, remove and rename functions, setting a
+                 * list discards its index.\n
+                 * Renaming an entry with its name setter makes the
+                 * index stale, call dxf_tables_clear_indexes () then. */
+        void *last_entries[DXF_TABLES_NUMBER_OF_SYMBOL_TABLES];
+                /*!< Last entries of the symbol tables as seen by the add
+                 * functions (a hint for appending). */
 } DxfTables;
 
 
@@ -126,6 +143,40 @@ DxfView *dxf_tables_get_views (DxfTables *tables);
 DxfTables *dxf_tables_set_views (DxfTables *tables, DxfView *views);
 DxfVPort *dxf_tables_get_vports (DxfTables *tables);
 DxfTables *dxf_tables_set_vports (DxfTables *tables, DxfVPort *vports);
+int dxf_tables_build_indexes (DxfTables *tables);
+int dxf_tables_clear_indexes (DxfTables *tables);
+void *dxf_tables_get_first_entry (DxfTables *tables, int table);
+void *dxf_tables_get_next_entry (int table, void *entry);
+int dxf_tables_get_entry_id_code (int table, void *entry);
+int dxf_tables_set_entry_id_code (int table, void *entry, int id_code);
+int dxf_tables_rename_entry (DxfTables *tables, int table, void *entry, const char *name);
+DxfAppid *dxf_tables_find_appid (DxfTables *tables, const char *name);
+DxfTables *dxf_tables_add_appid (DxfTables *tables, DxfAppid *appid);
+DxfTables *dxf_tables_remove_appid (DxfTables *tables, DxfAppid *appid);
+DxfBlockRecord *dxf_tables_find_block_record (DxfTables *tables, const char *name);
+DxfTables *dxf_tables_add_block_record (DxfTables *tables, DxfBlockRecord *block_record);
+DxfTables *dxf_tables_remove_block_record (DxfTables *tables, DxfBlockRecord *block_record);
+DxfDimStyle *dxf_tables_find_dimstyle (DxfTables *tables, const char *name);
+DxfTables *dxf_tables_add_dimstyle (DxfTables *tables, DxfDimStyle *dimstyle);
+DxfTables *dxf_tables_remove_dimstyle (DxfTables *tables, DxfDimStyle *dimstyle);
+DxfLayer *dxf_tables_find_layer (DxfTables *tables, const char *name);
+DxfTables *dxf_tables_add_layer (DxfTables *tables, DxfLayer *layer);
+DxfTables *dxf_tables_remove_layer (DxfTables *tables, DxfLayer *layer);
+DxfLType *dxf_tables_find_ltype (DxfTables *tables, const char *name);
+DxfTables *dxf_tables_add_ltype (DxfTables *tables, DxfLType *ltype);
+DxfTables *dxf_tables_remove_ltype (DxfTables *tables, DxfLType *ltype);
+DxfStyle *dxf_tables_find_style (DxfTables *tables, const char *name);
+DxfTables *dxf_tables_add_style (DxfTables *tables, DxfStyle *style);
+DxfTables *dxf_tables_remove_style (DxfTables *tables, DxfStyle *style);
+DxfUcs *dxf_tables_find_ucs (DxfTables *tables, const char *name);
+DxfTables *dxf_tables_add_ucs (DxfTables *tables, DxfUcs *ucs);
+DxfTables *dxf_tables_remove_ucs (DxfTables *tables, DxfUcs *ucs);
+DxfView *dxf_tables_find_view (DxfTables *tables, const char *name);
+DxfTables *dxf_tables_add_view (DxfTables *tables, DxfView *view);
+DxfTables *dxf_tables_remove_view (DxfTables *tables, DxfView *view);
+DxfVPort *dxf_tables_find_vport (DxfTables *tables, const char *name);
+DxfTables *dxf_tables_add_vport (DxfTables *tables, DxfVPort *vport);
+DxfTables *dxf_tables_remove_vport (DxfTables *tables, DxfVPort *vport);
 
 
 #ifdef __cplusplus
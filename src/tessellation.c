@@ -0,0 +1,493 @@
+/*!
+ * \file tessellation.c
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for libDXF tessellation buffers.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "tessellation.h"
+
+
+/*!
+ * \brief Grow the arrays of a \c DxfTessellation.
+ *
+ * The capacities are doubled until they hold at least the requested
+ * number of points and curves.
+ */
+static int
+dxf_tessellation_grow
+(
+        DxfTessellation *tessellation,
+        size_t number_of_points,
+        size_t number_of_curves
+)
+{
+        double *points = NULL;
+        size_t *curves = NULL;
+        size_t size;
+
+        if (number_of_points > tessellation->max_number_of_points)
+        {
+                size = (tessellation->max_number_of_points > 0)
+                  ? tessellation->max_number_of_points : 64;
+                while (size < number_of_points)
+                {
+                        size *= 2;
+                }
+                points = dxf_realloc (tessellation->points, 3 * size * sizeof (double));
+                if (points == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                tessellation->points = points;
+                tessellation->max_number_of_points = size;
+        }
+        if (number_of_curves > tessellation->max_number_of_curves)
+        {
+                size = (tessellation->max_number_of_curves > 0)
+                  ? tessellation->max_number_of_curves : 16;
+                while (size < number_of_curves)
+                {
+                        size *= 2;
+                }
+                curves = dxf_realloc (tessellation->curves, size * sizeof (size_t));
+                if (curves == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                tessellation->curves = curves;
+                tessellation->max_number_of_curves = size;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate memory for a \c DxfTessellation.
+ *
+ * Fill the memory contents with zeros.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfTessellation *
+dxf_tessellation_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTessellation *tessellation = NULL;
+        size_t size;
+
+        size = sizeof (DxfTessellation);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((tessellation = dxf_malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                tessellation = NULL;
+        }
+        else
+        {
+                memset (tessellation, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tessellation);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize an empty \c DxfTessellation.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfTessellation *
+dxf_tessellation_init
+(
+        DxfTessellation *tessellation
+                /*!< a pointer to a \c DxfTessellation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (tessellation == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                tessellation = dxf_tessellation_new ();
+        }
+        if (tessellation == NULL)
+        {
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                (_("Error in %s () could not allocate memory.\n")),
+                __FUNCTION__);
+              return (NULL);
+        }
+        tessellation->points = NULL;
+        tessellation->number_of_points = 0;
+        tessellation->max_number_of_points = 0;
+        tessellation->curves = NULL;
+        tessellation->number_of_curves = 0;
+        tessellation->max_number_of_curves = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tessellation);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfTessellation and its
+ * arrays.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tessellation_free
+(
+        DxfTessellation *tessellation
+                /*!< a pointer to the memory occupied by the
+                 * \c DxfTessellation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (tessellation == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_free (tessellation->points);
+        dxf_free (tessellation->curves);
+        dxf_free (tessellation);
+        tessellation = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Remove all curves from a \c DxfTessellation.
+ *
+ * The arrays are kept for reuse.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tessellation_clear
+(
+        DxfTessellation *tessellation
+                /*!< a pointer to a \c DxfTessellation. */
+)
+{
+        /* Do some basic checks. */
+        if (tessellation == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        tessellation->number_of_points = 0;
+        tessellation->number_of_curves = 0;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Make room for at least \c number_of_points additional points
+ * in a \c DxfTessellation.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tessellation_reserve
+(
+        DxfTessellation *tessellation,
+                /*!< a pointer to a \c DxfTessellation. */
+        size_t number_of_points
+                /*!< number of points to make room for. */
+)
+{
+        /* Do some basic checks. */
+        if (tessellation == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_tessellation_grow (tessellation,
+          tessellation->number_of_points + number_of_points,
+          tessellation->number_of_curves) != EXIT_SUCCESS)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Start a new (empty) curve in a \c DxfTessellation.
+ *
+ * Points added after this call belong to the new curve.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tessellation_begin_curve
+(
+        DxfTessellation *tessellation
+                /*!< a pointer to a \c DxfTessellation. */
+)
+{
+        /* Do some basic checks. */
+        if (tessellation == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_tessellation_grow (tessellation,
+          tessellation->number_of_points,
+          tessellation->number_of_curves + 1) != EXIT_SUCCESS)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        tessellation->curves[tessellation->number_of_curves++] = tessellation->number_of_points;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add a point to the last curve of a \c DxfTessellation.
+ *
+ * A curve is started when the tessellation holds no curves yet.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tessellation_add_point
+(
+        DxfTessellation *tessellation,
+                /*!< a pointer to a \c DxfTessellation. */
+        double x,
+                /*!< X-value of the point. */
+        double y,
+                /*!< Y-value of the point. */
+        double z
+                /*!< Z-value of the point. */
+)
+{
+        double *point = NULL;
+
+        /* Do some basic checks. */
+        if (tessellation == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (tessellation->number_of_curves == 0)
+        {
+                if (dxf_tessellation_begin_curve (tessellation) != EXIT_SUCCESS)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        if ((tessellation->number_of_points == tessellation->max_number_of_points)
+          && (dxf_tessellation_grow (tessellation,
+          tessellation->number_of_points + 1,
+          tessellation->number_of_curves) != EXIT_SUCCESS))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        point = tessellation->points + 3 * tessellation->number_of_points;
+        point[0] = x;
+        point[1] = y;
+        point[2] = z;
+        tessellation->number_of_points++;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append all curves of \c source to a \c DxfTessellation.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tessellation_append
+(
+        DxfTessellation *tessellation,
+                /*!< a pointer to a \c DxfTessellation. */
+        DxfTessellation *source
+                /*!< a pointer to the \c DxfTessellation to append. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        size_t i;
+
+        /* Do some basic checks. */
+        if ((tessellation == NULL) || (source == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_tessellation_grow (tessellation,
+          tessellation->number_of_points + source->number_of_points,
+          tessellation->number_of_curves + source->number_of_curves) != EXIT_SUCCESS)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < source->number_of_curves; i++)
+        {
+                tessellation->curves[tessellation->number_of_curves + i] =
+                  tessellation->number_of_points + source->curves[i];
+        }
+        if (source->number_of_points > 0)
+        {
+                memcpy (tessellation->points + 3 * tessellation->number_of_points,
+                  source->points, 3 * source->number_of_points * sizeof (double));
+        }
+        tessellation->number_of_points += source->number_of_points;
+        tessellation->number_of_curves += source->number_of_curves;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the number of curves in a \c DxfTessellation.
+ *
+ * \return number of curves.
+ */
+size_t
+dxf_tessellation_get_number_of_curves
+(
+        DxfTessellation *tessellation
+                /*!< a pointer to a \c DxfTessellation. */
+)
+{
+        /* Do some basic checks. */
+        if (tessellation == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        return (tessellation->number_of_curves);
+}
+
+
+/*!
+ * \brief Get the points of a curve in a \c DxfTessellation.
+ *
+ * \return a pointer to the coordinates of the first point of the curve
+ * (X, Y and Z for every point), or \c NULL when the curve does not
+ * exist.
+ */
+double *
+dxf_tessellation_get_curve
+(
+        DxfTessellation *tessellation,
+                /*!< a pointer to a \c DxfTessellation. */
+        size_t index,
+                /*!< index of the curve. */
+        size_t *number_of_points
+                /*!< receives the number of points of the curve. */
+)
+{
+        size_t end;
+
+        /* Do some basic checks. */
+        if ((tessellation == NULL) || (number_of_points == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (index >= tessellation->number_of_curves)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an invalid index was passed.\n")),
+                  __FUNCTION__);
+                *number_of_points = 0;
+                return (NULL);
+        }
+        end = (index + 1 < tessellation->number_of_curves)
+          ? tessellation->curves[index + 1] : tessellation->number_of_points;
+        *number_of_points = end - tessellation->curves[index];
+        return (tessellation->points + 3 * tessellation->curves[index]);
+}
+
+
+/* EOF */
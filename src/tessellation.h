@@ -0,0 +1,96 @@
+/*!
+ * \file tessellation.h
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for libDXF tessellation buffers.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_TESSELLATION_H
+#define LIBDXF_SRC_TESSELLATION_H
+
+
+#include "global.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief Definition of a tessellation buffer.
+ *
+ * A tessellation buffer holds one or more polylines (curves) which
+ * approximate curved entities.\n
+ * The coordinates of all points of all curves are stored in one
+ * contiguous array (X, Y and Z for every point), the index of the first
+ * point of every curve is stored in a second array.\n
+ * The arrays grow when needed, a buffer can be reused after
+ * \c dxf_tessellation_clear() without reallocating memory.
+ */
+typedef struct
+dxf_tessellation_struct
+{
+        double *points;
+                /*!< Coordinates of the points (X, Y, Z, X, Y, Z, ...). */
+        size_t number_of_points;
+                /*!< Number of points in \c points. */
+        size_t max_number_of_points;
+                /*!< Number of points \c points can hold. */
+        size_t *curves;
+                /*!< Index of the first point of every curve. */
+        size_t number_of_curves;
+                /*!< Number of curves in \c curves. */
+        size_t max_number_of_curves;
+                /*!< Number of curves \c curves can hold. */
+} DxfTessellation;
+
+
+DxfTessellation *dxf_tessellation_new ();
+DxfTessellation *dxf_tessellation_init (DxfTessellation *tessellation);
+int dxf_tessellation_free (DxfTessellation *tessellation);
+int dxf_tessellation_clear (DxfTessellation *tessellation);
+int dxf_tessellation_reserve (DxfTessellation *tessellation, size_t number_of_points);
+int dxf_tessellation_begin_curve (DxfTessellation *tessellation);
+int dxf_tessellation_add_point (DxfTessellation *tessellation, double x, double y, double z);
+int dxf_tessellation_append (DxfTessellation *tessellation, DxfTessellation *source);
+size_t dxf_tessellation_get_number_of_curves (DxfTessellation *tessellation);
+double *dxf_tessellation_get_curve (DxfTessellation *tessellation, size_t index, size_t *number_of_points);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_TESSELLATION_H */
+
+
+/* EOF */
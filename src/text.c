@@ -61,7 +61,7 @@ dxf_text_new ()
         size = sizeof (DxfText);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((text = malloc (size)) == NULL)
+        if ((text = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfText struct.\n")),
@@ -98,21 +98,21 @@ dxf_text_init
         /* Do some basic checks. */
         if (text == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 text = dxf_text_new ();
         }
         if (text == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfText struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         text->id_code = 0;
-        text->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        text->layer = strdup (DXF_DEFAULT_LAYER);
+        text->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        text->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         text->elevation = 0.0;
         text->thickness = 0.0;
         text->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -123,16 +123,16 @@ dxf_text_init
         text->shadow_mode = 0;
         text->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
         text->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) text->binary_graphics_data);
-        text->dictionary_owner_soft = strdup ("");
-        text->material = strdup ("");
-        text->dictionary_owner_hard = strdup ("");
+        text->dictionary_owner_soft = dxf_strdup ("");
+        text->material = dxf_strdup ("");
+        text->dictionary_owner_hard = dxf_strdup ("");
         text->lineweight = 0;
-        text->plot_style_name = strdup ("");
+        text->plot_style_name = dxf_strdup ("");
         text->color_value = 0;
-        text->color_name = strdup ("");
+        text->color_name = dxf_strdup ("");
         text->transparency = 0;
-        text->text_value = strdup ("");
-        text->text_style = strdup ("");
+        text->text_value = dxf_strdup ("");
+        text->text_style = dxf_strdup ("");
         text->p0 = (DxfPoint *) dxf_point_new ();
         text->p0 = dxf_point_init ((DxfPoint *) text->p0);
         text->p0->x0 = 0.0;
@@ -185,22 +185,22 @@ dxf_text_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("TEXT");
+        char *dxf_entity_name = dxf_strdup ("TEXT");
         char *temp_string = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (text == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 text = dxf_text_init (text);
@@ -211,12 +211,12 @@ dxf_text_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
@@ -404,7 +404,7 @@ dxf_text_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbText") != 0)))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -449,9 +449,8 @@ dxf_text_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, text->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) text->binary_graphics_data->next);
-                        text->binary_graphics_data = (DxfBinaryGraphicsData *) text->binary_graphics_data->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_graphics_data_append_hex ((DxfBinaryGraphicsData *) text->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -517,15 +516,16 @@ dxf_text_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning: in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (text->text_value, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () text value string is empty for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, text->id_code);
                 dxf_entity_skip (dxf_entity_name);
@@ -533,14 +533,14 @@ dxf_text_read
         }
         if (strcmp (text->linetype, "") == 0)
         {
-                text->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                text->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (text->layer, "") == 0)
         {
-                text->layer = strdup (DXF_DEFAULT_LAYER);
+                text->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -563,62 +563,62 @@ dxf_text_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("TEXT");
+        char *dxf_entity_name = dxf_strdup ("TEXT");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (text == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (text->text_value, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () text value string is empty for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, text->id_code);
                 dxf_entity_skip (dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (text->text_style, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () text style string is empty for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, text->id_code);
-                text->text_style = strdup (DXF_DEFAULT_TEXTSTYLE);        }
+                text->text_style = dxf_strdup (DXF_DEFAULT_TEXTSTYLE);        }
         if (strcmp (text->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, text->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                text->layer = strdup (DXF_DEFAULT_LAYER);
+                text->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (text->height == 0.0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () height has a value of 0.0 for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, text->id_code);
         }
         if (text->rel_x_scale == 0.0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, text->id_code);
         }
@@ -700,16 +700,7 @@ dxf_text_write
 #else
                 fprintf (fp->fp, " 92\n%d\n", text->graphics_data_size);
 #endif
-                if (text->binary_graphics_data != NULL)
-                {
-                        DxfBinaryGraphicsData *iter;
-                        iter = text->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (iter));
-                                iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (iter);
-                        }
-                }
+                dxf_binary_graphics_data_write (fp, (DxfBinaryGraphicsData *) text->binary_graphics_data);
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
@@ -765,10 +756,10 @@ dxf_text_write
                   && (text->p0->y0 == text->p1->y0)
                   && (text->p0->z0 == text->p1->z0))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () insertion point and alignment point are identical for the %s entity with id-code: %x\n")),
                           __FUNCTION__, dxf_entity_name, text->id_code);
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                           (_("\tdefault justification applied to %s entity\n")),
                           dxf_entity_name);
                         text->hor_align = 0;
@@ -799,7 +790,7 @@ dxf_text_write
                 fprintf (fp->fp, " 73\n%d\n", text->vert_align);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -827,31 +818,31 @@ dxf_text_free
 #endif
         if (text == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (text->next != NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (text->linetype);
-        free (text->layer);
+        dxf_free (text->linetype);
+        dxf_free (text->layer);
         dxf_binary_graphics_data_free_list (text->binary_graphics_data);
-        free (text->dictionary_owner_soft);
-        free (text->material);
-        free (text->dictionary_owner_hard);
-        free (text->plot_style_name);
-        free (text->color_name);
-        free (text->text_value);
-        free (text->text_style);
+        dxf_free (text->dictionary_owner_soft);
+        dxf_free (text->material);
+        dxf_free (text->dictionary_owner_hard);
+        dxf_free (text->plot_style_name);
+        dxf_free (text->color_name);
+        dxf_free (text->text_value);
+        dxf_free (text->text_style);
         dxf_point_free (text->p0);
         dxf_point_free (text->p1);
-        free (text);
+        dxf_free (text);
         text = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -872,18 +863,19 @@ dxf_text_free_list
                  * entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (texts == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (texts != NULL)
         {
                 DxfText *iter = (DxfText *) texts->next;
+                texts->next = NULL;
                 dxf_text_free (texts);
                 texts = (DxfText *) iter;
         }
@@ -1001,7 +993,7 @@ dxf_text_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (text->linetype));
+        return (dxf_strdup (text->linetype));
 }
 
 
@@ -1036,7 +1028,7 @@ dxf_text_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        text->linetype = strdup (linetype);
+        text->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1077,7 +1069,7 @@ dxf_text_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (text->layer));
+        return (dxf_strdup (text->layer));
 }
 
 
@@ -1112,7 +1104,7 @@ dxf_text_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        text->layer = strdup (layer);
+        text->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1866,7 +1858,7 @@ dxf_text_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (text->dictionary_owner_soft));
+        return (dxf_strdup (text->dictionary_owner_soft));
 }
 
 
@@ -1902,7 +1894,7 @@ dxf_text_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        text->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        text->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1946,7 +1938,7 @@ dxf_text_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (text->material));
+        return (dxf_strdup (text->material));
 }
 
 
@@ -1984,7 +1976,7 @@ dxf_text_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        text->material = strdup (material);
+        text->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2028,7 +2020,7 @@ dxf_text_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (text->dictionary_owner_hard));
+        return (dxf_strdup (text->dictionary_owner_hard));
 }
 
 
@@ -2064,7 +2056,7 @@ dxf_text_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        text->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        text->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2171,7 +2163,7 @@ dxf_text_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (text->plot_style_name));
+        return (dxf_strdup (text->plot_style_name));
 }
 
 
@@ -2209,7 +2201,7 @@ dxf_text_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        text->plot_style_name = strdup (plot_style_name);
+        text->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2316,7 +2308,7 @@ dxf_text_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (text->color_name));
+        return (dxf_strdup (text->color_name));
 }
 
 
@@ -2354,7 +2346,7 @@ dxf_text_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        text->color_name = strdup (color_name);
+        text->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2461,7 +2453,7 @@ dxf_text_get_text_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (text->text_value));
+        return (dxf_strdup (text->text_value));
 }
 
 
@@ -2499,7 +2491,7 @@ dxf_text_set_text_value
                   __FUNCTION__);
                 return (NULL);
         }
-        text->text_value = strdup (text_value);
+        text->text_value = dxf_strdup (text_value);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2541,7 +2533,7 @@ dxf_text_get_text_style
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (text->text_style));
+        return (dxf_strdup (text->text_style));
 }
 
 
@@ -2579,7 +2571,7 @@ dxf_text_set_text_style
                   __FUNCTION__);
                 return (NULL);
         }
-        text->text_style = strdup (text_style);
+        text->text_style = dxf_strdup (text_style);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2599,7 +2591,7 @@ dxf_text_get_p0
                 /*!< a pointer to a DXF \c TEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2638,7 +2630,7 @@ dxf_text_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2677,7 +2669,7 @@ dxf_text_get_x0
                 /*!< a pointer to a DXF \c TEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2720,7 +2712,7 @@ dxf_text_set_x0
                  * \c TEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2759,7 +2751,7 @@ dxf_text_get_y0
                 /*!< a pointer to a DXF \c TEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2802,7 +2794,7 @@ dxf_text_set_y0
                  * \c TEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2841,7 +2833,7 @@ dxf_text_get_z0
                 /*!< a pointer to a DXF \c TEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2884,7 +2876,7 @@ dxf_text_set_z0
                  * \c TEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2922,7 +2914,7 @@ dxf_text_get_p1
                 /*!< a pointer to a DXF \c TEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2961,7 +2953,7 @@ dxf_text_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3000,7 +2992,7 @@ dxf_text_get_x1
                 /*!< a pointer to a DXF \c TEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3043,7 +3035,7 @@ dxf_text_set_x1
                  * a DXF \c TEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3082,7 +3074,7 @@ dxf_text_get_y1
                 /*!< a pointer to a DXF \c TEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3125,7 +3117,7 @@ dxf_text_set_y1
                  * a DXF \c TEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3164,7 +3156,7 @@ dxf_text_get_z1
                 /*!< a pointer to a DXF \c TEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3207,7 +3199,7 @@ dxf_text_set_z1
                  * a DXF \c TEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3801,7 +3793,7 @@ dxf_text_get_extrusion_vector_as_point
                 /*!< a pointer to a DXF \c TEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *point = NULL;
@@ -3845,7 +3837,7 @@ dxf_text_get_extr_x0
                 /*!< a pointer to a DXF \c TEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3881,7 +3873,7 @@ dxf_text_set_extr_x0
                  * DXF \c TEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3913,7 +3905,7 @@ dxf_text_get_extr_y0
                 /*!< a pointer to a DXF \c TEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3949,7 +3941,7 @@ dxf_text_set_extr_y0
                  * DXF \c TEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3981,7 +3973,7 @@ dxf_text_get_extr_z0
                 /*!< a pointer to a DXF \c TEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4017,7 +4009,7 @@ dxf_text_set_extr_z0
                  * DXF \c TEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -55,6 +55,22 @@
 
 
 #include "thumbnail.h"
+#include "endsec.h"
+#include "section.h"
+
+
+/*!
+ * \brief Size of the blocks read by dxf_thumbnail_probe () while
+ * scanning backward from the end of a file.
+ */
+#define DXF_THUMBNAIL_PROBE_BLOCK_SIZE 65536
+
+
+/*!
+ * \brief Number of bytes kept from the previous block, enough to hold
+ * a section marker line.
+ */
+#define DXF_THUMBNAIL_PROBE_CARRY 32
 
 
 /*!
@@ -77,7 +93,7 @@ dxf_thumbnail_new ()
         size = sizeof (DxfThumbnail);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((thumbnail = malloc (size)) == NULL)
+        if ((thumbnail = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfThumbnail struct.\n")),
@@ -115,22 +131,28 @@ dxf_thumbnail_init
         /* Do some basic checks. */
         if (thumbnail == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 thumbnail = dxf_thumbnail_new ();
         }
         if (thumbnail == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfThumbnail struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         thumbnail->number_of_bytes = 0;
-        thumbnail->preview_image_data = NULL;
-        thumbnail->preview_image_data->length = 0;
-        thumbnail->preview_image_data->value = strdup ("");
+        thumbnail->preview_image_data = dxf_binary_data_init (dxf_binary_data_new ());
+        if (thumbnail->preview_image_data == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_free (thumbnail);
+                return (NULL);
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -143,8 +165,8 @@ dxf_thumbnail_init
  *
  * The last line read from file contained the string "THUMBNAILIMAGE". \n
  * Now follows some data for the \c THUMBNAILIMAGE, to be terminated
- * with a "  0" string announcing the following entity, or the end of
- * the \c ENTITY section marker \c ENDSEC. \n
+ * with a "  0" string announcing the end of the section marker
+ * \c ENDSEC. \n
  * While parsing the DXF file store data in \c thumbnail. \n
  *
  * \return a pointer to \c thumbnail.
@@ -161,43 +183,41 @@ dxf_thumbnail_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (thumbnail == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 thumbnail = dxf_thumbnail_init (thumbnail);
         }
         if (fp->acad_version_number < AutoCAD_2000)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        memset (temp_string, 0, sizeof (temp_string));
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 else if (strcmp (temp_string, "90") == 0)
@@ -209,11 +229,11 @@ dxf_thumbnail_read
                 }
                 else if (strcmp (temp_string, "310") == 0)
                 {
-                        /* Now follows a string containing additional
-                         * proprietary data. */
+                        /* Now follows a string containing preview
+                         * image data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, thumbnail->preview_image_data->value);
-                        /*! \todo preview_image_data needs a proper implementation. */
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_data_append_hex (thumbnail->preview_image_data, temp_string);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -224,15 +244,24 @@ dxf_thumbnail_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
+                        dxf_read_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
-        /*! \todo preview_image_data needs a proper checking for data length. */
+        if ((size_t) thumbnail->number_of_bytes != thumbnail->preview_image_data->size)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
+                  (_("Warning in %s () %d bytes were announced, %d bytes were read.\n")),
+                  __FUNCTION__, thumbnail->number_of_bytes,
+                  (int) thumbnail->preview_image_data->size);
+                thumbnail->number_of_bytes = (int) thumbnail->preview_image_data->size;
+        }
         /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -255,49 +284,49 @@ dxf_thumbnail_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("THUMBNAILIMAGE");
+        char *dxf_entity_name = dxf_strdup ("THUMBNAILIMAGE");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (thumbnail == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (thumbnail->number_of_bytes < 1)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () number of bytes was 0 or less.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_2000)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
+        dxf_section_write (fp, dxf_entity_name);
         fprintf (fp->fp, " 90\n%d\n", thumbnail->number_of_bytes);
-        fprintf (fp->fp, "310\n%s\n", thumbnail->preview_image_data->value);
-        /*! \todo preview_image_data needs a proper implementation. */
+        dxf_binary_data_write (fp, thumbnail->preview_image_data);
+        dxf_endsec_write (fp);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -326,15 +355,13 @@ dxf_thumbnail_free
         /* Do some basic checks. */
         if (thumbnail == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (thumbnail->preview_image_data->value);
-        free (thumbnail->preview_image_data);
-        /*! \todo preview_image_data needs a proper implementation. */
-        free (thumbnail);
+        dxf_binary_data_free_list (thumbnail->preview_image_data);
+        dxf_free (thumbnail);
         thumbnail = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -344,334 +371,474 @@ dxf_thumbnail_free
 
 
 /*!
- * \brief Get the \c number_of_bytes from a DXF \c THUMBNAILIMAGE object.
- *
- * \return \c number_of_bytes.
+ * \brief Test if the line starting at \c line is \c marker.
  */
-int
-dxf_thumbnail_get_number_of_bytes
+static int
+dxf_thumbnail_probe_match
 (
-        DxfThumbnail *thumbnail
-                /*!< a pointer to a DXF \c THUMBNAILIMAGE object. */
+        const char *line,
+                /*!< the start of the line. */
+        size_t length,
+                /*!< number of bytes available at \c line. */
+        const char *marker
+                /*!< the expected contents of the line. */
 )
 {
-#if DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        /* Do some basic checks. */
-        if (thumbnail == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        if (thumbnail->number_of_bytes < 0)
+        size_t marker_length = strlen (marker);
+
+        if ((length < marker_length)
+          || (memcmp (line, marker, marker_length) != 0))
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
+                return (FALSE);
         }
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (thumbnail->number_of_bytes);
+        return ((length == marker_length)
+          || (line[marker_length] == '\r')
+          || (line[marker_length] == '\n'));
 }
 
 
 /*!
- * \brief Set the \c number_of_bytes for a DXF \c THUMBNAILIMAGE object.
+ * \brief Find the \c THUMBNAILIMAGE section marker, scanning backward
+ * from the end of the file.
+ *
+ * The \c THUMBNAILIMAGE section is the last section of a file, the
+ * scan gives up at the first \c 0 \c SECTION pair it meets, the start
+ * of the last section.\n
+ * Files without a thumbnail image thus cost a backward read of their
+ * last section (\c OBJECTS or \c ENTITIES).
+ *
+ * \return the offset of the marker line, or -1 when no marker was
+ * found.
  */
-DxfThumbnail *
-dxf_thumbnail_set_number_of_bytes
+static long
+dxf_thumbnail_probe_find
 (
-        DxfThumbnail *thumbnail,
-                /*!< a pointer to a DXF \c THUMBNAILIMAGE object. */
-        int number_of_bytes
-                /*!< the \c number_of_bytes to be set for the object. */
+        FILE *fp
+                /*!< the file to scan, opened in binary mode. */
 )
 {
-#if DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        /* Do some basic checks. */
-        if (thumbnail == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        if (number_of_bytes < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
+        char *buffer;
+        long position;
+        long result = -1;
+        size_t carry = 0;
+        size_t length;
+        size_t n;
+        size_t i;
+        size_t start;
+        int section = FALSE;
+        int done = FALSE;
+
+        buffer = dxf_malloc (DXF_THUMBNAIL_PROBE_BLOCK_SIZE + DXF_THUMBNAIL_PROBE_CARRY);
+        if (buffer == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if ((fseek (fp, 0, SEEK_END) != 0) || ((position = ftell (fp)) < 0))
+        {
+                dxf_free (buffer);
+                return (-1);
+        }
+        while ((position > 0) && (result < 0) && !done)
+        {
+                n = (position > DXF_THUMBNAIL_PROBE_BLOCK_SIZE)
+                  ? DXF_THUMBNAIL_PROBE_BLOCK_SIZE : (size_t) position;
+                position -= (long) n;
+                /* Keep the start of the previous block behind this
+                 * one, for the lines crossing the block boundary. */
+                memmove (buffer + n, buffer, carry);
+                if ((fseek (fp, position, SEEK_SET) != 0)
+                  || (fread (buffer, 1, n, fp) != n))
+                {
+                        break;
+                }
+                length = n + carry;
+                /* Visit the lines starting in this block from the
+                 * last one to the first one. */
+                for (i = n; i-- > 0;)
+                {
+                        if (buffer[i] == '\n')
+                        {
+                                start = i + 1;
+                        }
+                        else if ((i == 0) && (position == 0))
+                        {
+                                start = 0;
+                        }
+                        else
+                        {
+                                continue;
+                        }
+                        if (dxf_thumbnail_probe_match (buffer + start, length - start, "THUMBNAILIMAGE"))
+                        {
+                                result = position + (long) start;
+                                break;
+                        }
+                        /* A SECTION line preceded by a 0 group code
+                         * line is the start of the last section. */
+                        if (section)
+                        {
+                                while ((start < length) && (buffer[start] == ' '))
+                                {
+                                        start++;
+                                }
+                                if (dxf_thumbnail_probe_match (buffer + start, length - start, "0"))
+                                {
+                                        done = TRUE;
+                                        break;
+                                }
+                        }
+                        section = dxf_thumbnail_probe_match (buffer + start, length - start, "SECTION");
+                }
+                carry = (n < DXF_THUMBNAIL_PROBE_CARRY) ? n : DXF_THUMBNAIL_PROBE_CARRY;
         }
-        thumbnail->number_of_bytes = number_of_bytes;
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (thumbnail);
+        dxf_free (buffer);
+        return (result);
 }
 
 
 /*!
- * \brief Get the \c preview_image_data from a DXF \c THUMBNAILIMAGE
- * object.
+ * \brief Read the \c THUMBNAILIMAGE section of a DXF file, without
+ * parsing the rest of the drawing.
  *
- * \return \c preview_image_data when sucessful, \c NULL when an error
- * occurred.
+ * The section is found with a backward scan from the end of the file.
+ *
+ * \return a pointer to a new DXF \c THUMBNAILIMAGE object, or \c NULL
+ * when the file has no thumbnail image, or an error occurred.
  */
-DxfChar *
-dxf_thumbnail_get_preview_image_data
+DxfThumbnail *
+dxf_thumbnail_probe
 (
-        DxfThumbnail *thumbnail
-                /*!< a pointer to a DXF \c THUMBNAILIMAGE object. */
+        const char *filename
+                /*!< the name of the DXF file. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        DxfFile file;
+        DxfThumbnail *thumbnail = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        long offset;
+
         /* Do some basic checks. */
-        if (thumbnail == NULL)
+        if (filename == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        if (thumbnail->preview_image_data ==  NULL)
+        memset (&file, 0, sizeof (DxfFile));
+        file.fp = fopen (filename, "rb");
+        if (file.fp == NULL)
         {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not open file: %s for reading.\n")),
+                  __FUNCTION__, filename);
                 return (NULL);
         }
+        file.filename = (char *) filename;
+        file.acad_version_number = AutoCAD_2000;
+        offset = dxf_thumbnail_probe_find (file.fp);
+        if ((offset >= 0) && (fseek (file.fp, offset, SEEK_SET) == 0))
+        {
+                /* Skip the "THUMBNAILIMAGE" marker line. */
+                dxf_read_line (temp_string, &file);
+                thumbnail = dxf_thumbnail_read (&file,
+                  dxf_thumbnail_init (dxf_thumbnail_new ()));
+        }
+        fclose (file.fp);
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (thumbnail->preview_image_data);
+        return (thumbnail);
 }
 
 
 /*!
- * \brief Set the \c preview_image_data for a DXF \c THUMBNAILIMAGE
- * object.
+ * \brief Get the type of the preview image of a DXF \c THUMBNAILIMAGE
+ * object from the leading bytes of the image data.
+ *
+ * \return the type of the preview image.
  */
-DxfThumbnail *
-dxf_thumbnail_set_preview_image_data
+DxfThumbnailImageType
+dxf_thumbnail_get_image_type
 (
-        DxfThumbnail *thumbnail,
+        DxfThumbnail *thumbnail
                 /*!< a pointer to a DXF \c THUMBNAILIMAGE object. */
-        DxfChar *preview_image_data
-                /*!< a pointer to the \c preview_image_data to be set
-                 * for the object. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        static const unsigned char png_signature[] =
+          {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+        const unsigned char *bytes;
+        size_t size;
+        uint32_t header_size;
+
         /* Do some basic checks. */
-        if (thumbnail == NULL)
+        if ((thumbnail == NULL) || (thumbnail->preview_image_data == NULL))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
+                return (DXF_THUMBNAIL_IMAGE_UNKNOWN);
         }
-        if (preview_image_data == NULL)
+        bytes = thumbnail->preview_image_data->bytes;
+        size = thumbnail->preview_image_data->size;
+        if (size < sizeof (png_signature))
         {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (DXF_THUMBNAIL_IMAGE_UNKNOWN);
+        }
+        if (memcmp (bytes, png_signature, sizeof (png_signature)) == 0)
+        {
+                return (DXF_THUMBNAIL_IMAGE_PNG);
+        }
+        /* A placeable metafile, or a standard metafile header. */
+        if (((bytes[0] == 0xd7) && (bytes[1] == 0xcd) && (bytes[2] == 0xc6) && (bytes[3] == 0x9a))
+          || (((bytes[0] == 1) || (bytes[0] == 2)) && (bytes[1] == 0) && (bytes[2] == 9) && (bytes[3] == 0)))
+        {
+                return (DXF_THUMBNAIL_IMAGE_WMF);
+        }
+        /* A device independent bitmap, without a file header. */
+        header_size = (uint32_t) bytes[0] | ((uint32_t) bytes[1] << 8)
+          | ((uint32_t) bytes[2] << 16) | ((uint32_t) bytes[3] << 24);
+        if (((header_size == 12) || (header_size == 40) || (header_size == 52)
+          || (header_size == 56) || (header_size == 108) || (header_size == 124))
+          && (header_size <= size))
+        {
+                return (DXF_THUMBNAIL_IMAGE_BMP);
         }
-        thumbnail->preview_image_data = preview_image_data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (thumbnail);
+        return (DXF_THUMBNAIL_IMAGE_UNKNOWN);
 }
 
 
 /*!
- * \brief Get the \c preview_image_data value from a DXF
- * \c THUMBNAILIMAGE object.
+ * \brief Get the preview image of a DXF \c THUMBNAILIMAGE object as
+ * the contents of an image file.
+ *
+ * A bitmap is stored without a file header, a \c BITMAPFILEHEADER is
+ * prepended to make it a valid BMP file.\n
+ * Other images (PNG, WMF) are copied as is.
  *
- * \return \c preview_image_data value when sucessful, \c NULL when an
- * error occurred.
+ * \return a pointer to the image, to be freed with dxf_free (), or
+ * \c NULL when an error occurred.
  */
-char *
-dxf_thumbnail_get_preview_image_data_value
+unsigned char *
+dxf_thumbnail_get_image
 (
-        DxfChar *preview_image_data
-                /*!< a pointer to a DXF \c preview_image_data object. */
+        DxfThumbnail *thumbnail,
+                /*!< a pointer to a DXF \c THUMBNAILIMAGE object. */
+        size_t *size
+                /*!< the size of the returned image. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        const unsigned char *bytes;
+        unsigned char *image;
+        size_t data_size;
+        size_t header = 0;
+        uint32_t header_size;
+        uint32_t bit_count;
+        uint32_t compression = 0;
+        uint32_t colors = 0;
+        size_t entry_size = 4;
+        size_t offset;
+        size_t file_size;
+        int i;
+
         /* Do some basic checks. */
-        if (preview_image_data ==  NULL)
+        if ((thumbnail == NULL) || (size == NULL))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        if (preview_image_data->value ==  NULL)
+        if ((thumbnail->preview_image_data == NULL)
+          || (thumbnail->preview_image_data->size == 0))
         {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () no preview image data was found.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (preview_image_data->value);
-}
-
-
-/*!
- * \brief Set the \c value for a DXF \c preview_image_data of a DXF
- * \c THUMBNAILIMAGE object.
- */
-DxfChar *
-dxf_thumbnail_set_preview_image_data_value
-(
-        DxfChar *preview_image_data,
-                /*!< a pointer to a DXF \c preview_image_data. */
-        char *value
-                /*!< a pointer to the \c preview_image_data value to be
-                 * set for the object. */
-)
-{
-#if DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        /* Do some basic checks. */
-        if (preview_image_data == NULL)
+        bytes = thumbnail->preview_image_data->bytes;
+        data_size = thumbnail->preview_image_data->size;
+        if (dxf_thumbnail_get_image_type (thumbnail) == DXF_THUMBNAIL_IMAGE_BMP)
         {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                header = 14;
         }
-        if (value == NULL)
+        image = dxf_malloc (header + data_size);
+        if (image == NULL)
         {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        preview_image_data->value = value;
+        memcpy (image + header, bytes, data_size);
+        if (header > 0)
+        {
+                header_size = (uint32_t) bytes[0] | ((uint32_t) bytes[1] << 8);
+                if (header_size == 12)
+                {
+                        /* A BITMAPCOREHEADER with RGBTRIPLE colors. */
+                        bit_count = (uint32_t) bytes[10] | ((uint32_t) bytes[11] << 8);
+                        entry_size = 3;
+                }
+                else
+                {
+                        bit_count = (uint32_t) bytes[14] | ((uint32_t) bytes[15] << 8);
+                        compression = (uint32_t) bytes[16] | ((uint32_t) bytes[17] << 8);
+                        colors = (uint32_t) bytes[32] | ((uint32_t) bytes[33] << 8)
+                          | ((uint32_t) bytes[34] << 16) | ((uint32_t) bytes[35] << 24);
+                }
+                if ((colors == 0) && (bit_count <= 8))
+                {
+                        colors = 1u << bit_count;
+                }
+                offset = header + header_size + colors * entry_size;
+                /* The BI_BITFIELDS and BI_ALPHABITFIELDS masks follow
+                 * a BITMAPINFOHEADER. */
+                if ((header_size == 40) && (compression == 3))
+                {
+                        offset += 12;
+                }
+                else if ((header_size == 40) && (compression == 6))
+                {
+                        offset += 16;
+                }
+                file_size = header + data_size;
+                if (offset > file_size)
+                {
+                        offset = file_size;
+                }
+                image[0] = 'B';
+                image[1] = 'M';
+                for (i = 0; i < 4; i++)
+                {
+                        image[2 + i] = (unsigned char) (file_size >> (8 * i));
+                        image[6 + i] = 0;
+                        image[10 + i] = (unsigned char) (offset >> (8 * i));
+                }
+        }
+        *size = header + data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (preview_image_data);
+        return (image);
 }
 
 
 /*!
- * \brief Get the \c length of a \c preview_image_data \c value from a
- * DXF \c THUMBNAILIMAGE object.
+ * \brief Get the \c number_of_bytes from a DXF \c THUMBNAILIMAGE object.
  *
- * \return \c length when sucessful, \c NULL when an error occurred.
+ * \return \c number_of_bytes.
  */
 int
-dxf_thumbnail_get_preview_image_data_length
+dxf_thumbnail_get_number_of_bytes
 (
-        DxfChar *preview_image_data
-                /*!< a pointer to a DXF \c preview_image_data object
-                 * (linked list). */
+        DxfThumbnail *thumbnail
+                /*!< a pointer to a DXF \c THUMBNAILIMAGE object. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
-        if (preview_image_data == NULL)
+        if (thumbnail == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
+        if (thumbnail->number_of_bytes < 0)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a negative value was found.\n")),
+                  __FUNCTION__);
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (preview_image_data->length);
+        return (thumbnail->number_of_bytes);
 }
 
 
 /*!
- * \brief Set the \c length of the \c value for a DXF
- * \c preview_image_data of a DXF \c THUMBNAILIMAGE object.
+ * \brief Set the \c number_of_bytes for a DXF \c THUMBNAILIMAGE object.
  */
-DxfChar *
-dxf_thumbnail_set_preview_image_data_length
+DxfThumbnail *
+dxf_thumbnail_set_number_of_bytes
 (
-        DxfChar *preview_image_data,
-                /*!< a pointer to a DXF \c preview_image_data. */
-        int length
-                /*!< the \c length of the \c preview_image_data value to
-                 * be set for the object. */
+        DxfThumbnail *thumbnail,
+                /*!< a pointer to a DXF \c THUMBNAILIMAGE object. */
+        int number_of_bytes
+                /*!< the \c number_of_bytes to be set for the object. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
-        if (preview_image_data == NULL)
+        if (thumbnail == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        if (length < 0)
+        if (number_of_bytes < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
         }
-        preview_image_data->length = length;
+        thumbnail->number_of_bytes = number_of_bytes;
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (preview_image_data);
+        return (thumbnail);
 }
 
 
 /*!
- * \brief Get the \c next \c preview_image_data \c (linked list) from a
- * DXF \c THUMBNAILIMAGE object.
+ * \brief Get the \c preview_image_data from a DXF \c THUMBNAILIMAGE
+ * object.
  *
- * \return \c next when sucessful, \c NULL when an error occurred.
+ * \return \c preview_image_data when sucessful, \c NULL when an error
+ * occurred.
  */
-DxfChar *
-dxf_thumbnail_get_preview_image_data_next
+DxfBinaryData *
+dxf_thumbnail_get_preview_image_data
 (
-        DxfChar *preview_image_data
-                /*!< a pointer to a DXF \c preview_image_data object
-                 * (linked list). */
+        DxfThumbnail *thumbnail
+                /*!< a pointer to a DXF \c THUMBNAILIMAGE object. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
-        if (preview_image_data == NULL)
+        if (thumbnail == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        if (preview_image_data->next == NULL)
+        if (thumbnail->preview_image_data ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -681,69 +848,35 @@ dxf_thumbnail_get_preview_image_data_next
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfChar *) preview_image_data->next);
+        return (thumbnail->preview_image_data);
 }
 
 
 /*!
- * \brief Set the pointer to the \c next DXF \c preview_image_data
- * (linked list) for a DXF \c THUMBNAILIMAGE object.
+ * \brief Set the \c preview_image_data for a DXF \c THUMBNAILIMAGE
+ * object.
  */
-DxfChar *
-dxf_thumbnail_set_preview_image_data_next
+DxfThumbnail *
+dxf_thumbnail_set_preview_image_data
 (
-        DxfChar *preview_image_data,
-                /*!< a pointer to a DXF \c preview_image_data. */
-        DxfChar *next
-                /*!< a pointer to the the \c next \c preview_image_data
-                 * to be set for the object. */
+        DxfThumbnail *thumbnail,
+                /*!< a pointer to a DXF \c THUMBNAILIMAGE object. */
+        DxfBinaryData *preview_image_data
+                /*!< a pointer to the \c preview_image_data to be set
+                 * for the object. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
-        if (preview_image_data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        if (next == NULL)
+        if (thumbnail == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        preview_image_data->next = (struct DxfChar *) next;
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (preview_image_data);
-}
-
-
-/*!
- * \brief Get the pointer to the last \c preview_image_data object from a linked list
- * of DXF \c preview_image_data objects.
- *
- * \return pointer to the last \c preview_image_data object.
- *
- * \warning No checks are performed on the returned pointer.
- */
-DxfChar *
-dxf_thumbnail_get_preview_image_data_last
-(
-        DxfChar *preview_image_data
-                /*!< a pointer to a DXF \c preview_image_data object. */
-)
-{
-#if DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        /* Do some basic checks. */
         if (preview_image_data == NULL)
         {
                 fprintf (stderr,
@@ -751,22 +884,11 @@ dxf_thumbnail_get_preview_image_data_last
                   __FUNCTION__);
                 return (NULL);
         }
-        if (preview_image_data->next == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return ((DxfChar *) preview_image_data);
-        }
-        DxfChar *iter = (DxfChar *) preview_image_data->next;
-        while (iter->next != NULL)
-        {
-                iter = (DxfChar *) iter->next;
-        }
+        thumbnail->preview_image_data = preview_image_data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfChar *) iter);
+        return (thumbnail);
 }
 
 
@@ -59,6 +59,7 @@
 
 
 #include "global.h"
+#include "binary_data.h"
 
 
 #ifdef __cplusplus
@@ -76,28 +77,39 @@ dxf_thumbnail_struct
                 /*!< The number of bytes in the image (and subsequent
                  * binary chunk records).\n
                  * Group code = 90. */
-        DxfChar *preview_image_data;
-                /*!< Multiple lines (256 characters maximum per line).\n
+        DxfBinaryData *preview_image_data;
+                /*!< Preview image data (a BMP, WMF or PNG image),
+                 * decoded into contiguous bytes.\n
+                 * Multiple lines (254 characters maximum per line).\n
                  * Group code = 310. */
 } DxfThumbnail;
 
 
+/*!
+ * \brief Type of the preview image of a DXF \c THUMBNAILIMAGE.
+ */
+typedef enum
+dxf_thumbnail_image_type
+{
+        DXF_THUMBNAIL_IMAGE_UNKNOWN,
+        DXF_THUMBNAIL_IMAGE_BMP,
+        DXF_THUMBNAIL_IMAGE_WMF,
+        DXF_THUMBNAIL_IMAGE_PNG
+} DxfThumbnailImageType;
+
+
 DxfThumbnail *dxf_thumbnail_new ();
 DxfThumbnail *dxf_thumbnail_init (DxfThumbnail *thumbnail);
 DxfThumbnail *dxf_thumbnail_read (DxfFile *fp, DxfThumbnail *thumbnail);
 int dxf_thumbnail_write (DxfFile *fp, DxfThumbnail *thumbnail);
 int dxf_thumbnail_free (DxfThumbnail *thumbnail);
+DxfThumbnail *dxf_thumbnail_probe (const char *filename);
+DxfThumbnailImageType dxf_thumbnail_get_image_type (DxfThumbnail *thumbnail);
+unsigned char *dxf_thumbnail_get_image (DxfThumbnail *thumbnail, size_t *size);
 int dxf_thumbnail_get_number_of_bytes (DxfThumbnail *thumbnail);
 DxfThumbnail *dxf_thumbnail_set_number_of_bytes (DxfThumbnail *thumbnail, int number_of_bytes);
-DxfChar *dxf_thumbnail_get_preview_image_data (DxfThumbnail *thumbnail);
-DxfThumbnail *dxf_thumbnail_set_preview_image_data (DxfThumbnail *thumbnail, DxfChar *preview_image_data);
-char *dxf_thumbnail_get_preview_image_data_value (DxfChar *preview_image_data);
-DxfChar *dxf_thumbnail_set_preview_image_data_value (DxfChar *preview_image_data, char *value);
-int dxf_thumbnail_get_preview_image_data_length (DxfChar *preview_image_data);
-DxfChar *dxf_thumbnail_set_preview_image_data_length (DxfChar *preview_image_data, int length);
-DxfChar *dxf_thumbnail_get_preview_image_data_next (DxfChar *preview_image_data);
-DxfChar *dxf_thumbnail_set_preview_image_data_next (DxfChar *preview_image_data, DxfChar *next);
-DxfChar *dxf_thumbnail_get_preview_image_data_last (DxfChar *preview_image_data);
+DxfBinaryData *dxf_thumbnail_get_preview_image_data (DxfThumbnail *thumbnail);
+DxfThumbnail *dxf_thumbnail_set_preview_image_data (DxfThumbnail *thumbnail, DxfBinaryData *preview_image_data);
 
 
 #ifdef __cplusplus
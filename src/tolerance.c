@@ -62,7 +62,7 @@ dxf_tolerance_new ()
         size = sizeof (DxfTolerance);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((tolerance = malloc (size)) == NULL)
+        if ((tolerance = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfTolerance struct.\n")),
@@ -100,21 +100,21 @@ dxf_tolerance_init
         /* Do some basic checks. */
         if (tolerance == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 tolerance = dxf_tolerance_new ();
         }
         if (tolerance == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfTolerance struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         tolerance->id_code = 0;
-        tolerance->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        tolerance->layer = strdup (DXF_DEFAULT_LAYER);
+        tolerance->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        tolerance->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         tolerance->elevation = 0.0;
         tolerance->thickness = 0.0;
         tolerance->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -125,15 +125,15 @@ dxf_tolerance_init
         tolerance->shadow_mode = 0;
         tolerance->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
         tolerance->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) tolerance->binary_graphics_data);
-        tolerance->dictionary_owner_soft = strdup ("");
-        tolerance->material = strdup ("");
-        tolerance->dictionary_owner_hard = strdup ("");
+        tolerance->dictionary_owner_soft = dxf_strdup ("");
+        tolerance->material = dxf_strdup ("");
+        tolerance->dictionary_owner_hard = dxf_strdup ("");
         tolerance->lineweight = 0;
-        tolerance->plot_style_name = strdup ("");
+        tolerance->plot_style_name = dxf_strdup ("");
         tolerance->color_value = 0;
-        tolerance->color_name = strdup ("");
+        tolerance->color_name = dxf_strdup ("");
         tolerance->transparency = 0;
-        tolerance->dimstyle_name = strdup ("");
+        tolerance->dimstyle_name = dxf_strdup ("");
         tolerance->p0 = (DxfPoint *) dxf_point_new ();
         tolerance->p0 = dxf_point_init ((DxfPoint *) tolerance->p0);
         tolerance->p0->x0 = 0.0;
@@ -183,16 +183,16 @@ dxf_tolerance_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (tolerance == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 tolerance = dxf_tolerance_init (tolerance);
@@ -203,12 +203,12 @@ dxf_tolerance_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "3") == 0)
@@ -340,7 +340,7 @@ dxf_tolerance_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbFcf") != 0)))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -385,9 +385,8 @@ dxf_tolerance_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, tolerance->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) tolerance->binary_graphics_data->next);
-                        tolerance->binary_graphics_data = (DxfBinaryGraphicsData *) tolerance->binary_graphics_data->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_graphics_data_append_hex ((DxfBinaryGraphicsData *) tolerance->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -453,9 +452,10 @@ dxf_tolerance_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle omitted members and/or illegal values. */
@@ -465,14 +465,14 @@ dxf_tolerance_read
         }
         if (strcmp (tolerance->linetype, "") == 0)
         {
-                tolerance->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                tolerance->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (tolerance->layer, "") == 0)
         {
-                tolerance->layer = strdup (DXF_DEFAULT_LAYER);
+                tolerance->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -498,53 +498,53 @@ dxf_tolerance_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("TOLERANCE");
+        char *dxf_entity_name = dxf_strdup ("TOLERANCE");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (tolerance == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (tolerance->dimstyle_name, "") == 0)
         {
-                fprintf (stderr, "Error in dxf_tolerance_write () empty dimstyle name for the %s entity with id-code: %x.\n",
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR, "Error in dxf_tolerance_write () empty dimstyle name for the %s entity with id-code: %x.\n",
                         dxf_entity_name, tolerance->id_code);
-                fprintf (stderr, "\tskipping %s entity.\n",
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE, "\tskipping %s entity.\n",
                         dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (tolerance->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, tolerance->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                tolerance->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                tolerance->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (tolerance->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, tolerance->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
                 tolerance->layer = DXF_DEFAULT_LAYER;
@@ -627,16 +627,7 @@ dxf_tolerance_write
 #else
                 fprintf (fp->fp, " 92\n%d\n", tolerance->graphics_data_size);
 #endif
-                if (tolerance->binary_graphics_data != NULL)
-                {
-                        DxfBinaryGraphicsData *iter;
-                        iter = tolerance->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (iter));
-                                iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (iter);
-                        }
-                }
+                dxf_binary_graphics_data_write (fp, (DxfBinaryGraphicsData *) tolerance->binary_graphics_data);
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
@@ -674,7 +665,7 @@ dxf_tolerance_write
         fprintf (fp->fp, " 21\n%f\n", tolerance->p1->y0);
         fprintf (fp->fp, " 31\n%f\n", tolerance->p1->z0);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -703,24 +694,24 @@ dxf_tolerance_free
         /* Do some basic checks. */
         if (tolerance == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (tolerance->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (tolerance->dimstyle_name);
-        free (tolerance->linetype);
-        free (tolerance->layer);
-        free (tolerance->dictionary_owner_soft);
-        free (tolerance->dictionary_owner_hard);
-        free (tolerance);
+        dxf_free (tolerance->dimstyle_name);
+        dxf_free (tolerance->linetype);
+        dxf_free (tolerance->layer);
+        dxf_free (tolerance->dictionary_owner_soft);
+        dxf_free (tolerance->dictionary_owner_hard);
+        dxf_free (tolerance);
         tolerance = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -741,18 +732,19 @@ dxf_tolerance_free_list
                  * \c TOLERANCE entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (tolerances == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (tolerances != NULL)
         {
                 DxfTolerance *iter = (DxfTolerance *) tolerances->next;
+                tolerances->next = NULL;
                 dxf_tolerance_free (tolerances);
                 tolerances = (DxfTolerance *) iter;
         }
@@ -870,7 +862,7 @@ dxf_tolerance_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (tolerance->linetype));
+        return (dxf_strdup (tolerance->linetype));
 }
 
 
@@ -905,7 +897,7 @@ dxf_tolerance_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        tolerance->linetype = strdup (linetype);
+        tolerance->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -946,7 +938,7 @@ dxf_tolerance_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (tolerance->layer));
+        return (dxf_strdup (tolerance->layer));
 }
 
 
@@ -981,7 +973,7 @@ dxf_tolerance_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        tolerance->layer = strdup (layer);
+        tolerance->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1738,7 +1730,7 @@ dxf_tolerance_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (tolerance->dictionary_owner_soft));
+        return (dxf_strdup (tolerance->dictionary_owner_soft));
 }
 
 
@@ -1774,7 +1766,7 @@ dxf_tolerance_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        tolerance->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        tolerance->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1819,7 +1811,7 @@ dxf_tolerance_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (tolerance->material));
+        return (dxf_strdup (tolerance->material));
 }
 
 
@@ -1858,7 +1850,7 @@ dxf_tolerance_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        tolerance->material = strdup (material);
+        tolerance->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1902,7 +1894,7 @@ dxf_tolerance_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (tolerance->dictionary_owner_hard));
+        return (dxf_strdup (tolerance->dictionary_owner_hard));
 }
 
 
@@ -1938,7 +1930,7 @@ dxf_tolerance_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        tolerance->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        tolerance->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2045,7 +2037,7 @@ dxf_tolerance_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (tolerance->plot_style_name));
+        return (dxf_strdup (tolerance->plot_style_name));
 }
 
 
@@ -2083,7 +2075,7 @@ dxf_tolerance_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        tolerance->plot_style_name = strdup (plot_style_name);
+        tolerance->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2190,7 +2182,7 @@ dxf_tolerance_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (tolerance->color_name));
+        return (dxf_strdup (tolerance->color_name));
 }
 
 
@@ -2228,7 +2220,7 @@ dxf_tolerance_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        tolerance->color_name = strdup (color_name);
+        tolerance->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2335,7 +2327,7 @@ dxf_tolerance_get_dimstyle_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (tolerance->dimstyle_name));
+        return (dxf_strdup (tolerance->dimstyle_name));
 }
 
 
@@ -2373,7 +2365,7 @@ dxf_tolerance_set_dimstyle_name
                   __FUNCTION__);
                 return (NULL);
         }
-        tolerance->dimstyle_name = strdup (dimstyle_name);
+        tolerance->dimstyle_name = dxf_strdup (dimstyle_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2393,7 +2385,7 @@ dxf_tolerance_get_p0
                 /*!< a pointer to a DXF \c TOLERANCE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2432,7 +2424,7 @@ dxf_tolerance_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2471,7 +2463,7 @@ dxf_tolerance_get_x0
                 /*!< a pointer to a DXF \c TOLERANCE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2514,7 +2506,7 @@ dxf_tolerance_set_x0
                  * \c TOLERANCE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2553,7 +2545,7 @@ dxf_tolerance_get_y0
                 /*!< a pointer to a DXF \c TOLERANCE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2596,7 +2588,7 @@ dxf_tolerance_set_y0
                  * \c TOLERANCE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2635,7 +2627,7 @@ dxf_tolerance_get_z0
                 /*!< a pointer to a DXF \c TOLERANCE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2678,7 +2670,7 @@ dxf_tolerance_set_z0
                  * \c TOLERANCE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2716,7 +2708,7 @@ dxf_tolerance_get_p1
                 /*!< a pointer to a DXF \c TOLERANCE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2755,7 +2747,7 @@ dxf_tolerance_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2794,7 +2786,7 @@ dxf_tolerance_get_x1
                 /*!< a pointer to a DXF \c TOLERANCE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2837,7 +2829,7 @@ dxf_tolerance_set_x1
                  * \c TOLERANCE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2876,7 +2868,7 @@ dxf_tolerance_get_y1
                 /*!< a pointer to a DXF \c TOLERANCE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2919,7 +2911,7 @@ dxf_tolerance_set_y1
                  * \c TOLERANCE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2958,7 +2950,7 @@ dxf_tolerance_get_z1
                 /*!< a pointer to a DXF \c TOLERANCE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3001,7 +2993,7 @@ dxf_tolerance_set_z1
                  * \c TOLERANCE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3042,7 +3034,7 @@ dxf_tolerance_get_extrusion_vector_as_point
                 /*!< a pointer to a DXF \c TOLERANCE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *point = NULL;
@@ -3086,7 +3078,7 @@ dxf_tolerance_get_extr_x0
                 /*!< a pointer to a DXF \c TOLERANCE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3122,7 +3114,7 @@ dxf_tolerance_set_extr_x0
                  * DXF \c TOLERANCE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3154,7 +3146,7 @@ dxf_tolerance_get_extr_y0
                 /*!< a pointer to a DXF \c TOLERANCE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3190,7 +3182,7 @@ dxf_tolerance_set_extr_y0
                  * DXF \c TOLERANCE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3222,7 +3214,7 @@ dxf_tolerance_get_extr_z0
                 /*!< a pointer to a DXF \c TOLERANCE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3258,7 +3250,7 @@ dxf_tolerance_set_extr_z0
                  * DXF \c TOLERANCE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -64,7 +64,7 @@ dxf_trace_new ()
         size = sizeof (DxfTrace);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((trace = malloc (size)) == NULL)
+        if ((trace = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfTrace struct.\n")),
@@ -102,21 +102,21 @@ dxf_trace_init
         /* Do some basic checks. */
         if (trace == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 trace = dxf_trace_new ();
         }
         if (trace == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfTrace struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         trace->id_code = 0;
-        trace->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        trace->layer = strdup (DXF_DEFAULT_LAYER);
+        trace->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        trace->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         trace->elevation = 0.0;
         trace->thickness = 0.0;
         trace->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -127,13 +127,13 @@ dxf_trace_init
         trace->shadow_mode = 0;
         trace->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
         trace->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) trace->binary_graphics_data);
-        trace->dictionary_owner_soft = strdup ("");
-        trace->material = strdup ("");
-        trace->dictionary_owner_hard = strdup ("");
+        trace->dictionary_owner_soft = dxf_strdup ("");
+        trace->material = dxf_strdup ("");
+        trace->dictionary_owner_hard = dxf_strdup ("");
         trace->lineweight = 0;
-        trace->plot_style_name = strdup ("");
+        trace->plot_style_name = dxf_strdup ("");
         trace->color_value = 0;
-        trace->color_name = strdup ("");
+        trace->color_name = dxf_strdup ("");
         trace->transparency = 0;
         trace->p0->x0 = 0.0;
         trace->p0->y0 = 0.0;
@@ -184,16 +184,16 @@ dxf_trace_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (trace == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 trace = dxf_trace_init (trace);
@@ -204,12 +204,12 @@ dxf_trace_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -377,7 +377,7 @@ dxf_trace_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbTrace") != 0)))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -422,9 +422,8 @@ dxf_trace_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, trace->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) trace->binary_graphics_data->next);
-                        trace->binary_graphics_data = (DxfBinaryGraphicsData *) trace->binary_graphics_data->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_graphics_data_append_hex ((DxfBinaryGraphicsData *) trace->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -490,22 +489,23 @@ dxf_trace_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (trace->linetype, "") == 0)
         {
-                trace->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                trace->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (trace->layer, "") == 0)
         {
-                trace->layer = strdup (DXF_DEFAULT_LAYER);
+                trace->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -531,46 +531,46 @@ dxf_trace_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("TRACE");
+        char *dxf_entity_name = dxf_strdup ("TRACE");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (trace == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (trace->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, trace->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                trace->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                trace->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (trace->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, trace->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                trace->layer = strdup (DXF_DEFAULT_LAYER);
+                trace->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -650,16 +650,7 @@ dxf_trace_write
 #else
                 fprintf (fp->fp, " 92\n%d\n", trace->graphics_data_size);
 #endif
-                if (trace->binary_graphics_data != NULL)
-                {
-                        DxfBinaryGraphicsData *iter;
-                        iter = trace->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (iter));
-                                iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (iter);
-                        }
-                }
+                dxf_binary_graphics_data_write (fp, (DxfBinaryGraphicsData *) trace->binary_graphics_data);
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
@@ -702,7 +693,7 @@ dxf_trace_write
                 fprintf (fp->fp, "230\n%f\n", trace->extr_z0);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -731,31 +722,31 @@ dxf_trace_free
         /* Do some basic checks. */
         if (trace == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (trace->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (trace->linetype);
-        free (trace->layer);
+        dxf_free (trace->linetype);
+        dxf_free (trace->layer);
         dxf_binary_graphics_data_free_list (trace->binary_graphics_data);
-        free (trace->dictionary_owner_soft);
-        free (trace->material);
-        free (trace->dictionary_owner_hard);
-        free (trace->plot_style_name);
-        free (trace->color_name);
+        dxf_free (trace->dictionary_owner_soft);
+        dxf_free (trace->material);
+        dxf_free (trace->dictionary_owner_hard);
+        dxf_free (trace->plot_style_name);
+        dxf_free (trace->color_name);
         dxf_point_free (trace->p0);
         dxf_point_free (trace->p1);
         dxf_point_free (trace->p2);
         dxf_point_free (trace->p3);
-        free (trace);
+        dxf_free (trace);
         trace = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -776,18 +767,19 @@ dxf_trace_free_list
                  * entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (traces == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (traces != NULL)
         {
                 DxfTrace *iter = (DxfTrace *) traces->next;
+                traces->next = NULL;
                 dxf_trace_free (traces);
                 traces = (DxfTrace *) iter;
         }
@@ -905,7 +897,7 @@ dxf_trace_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (trace->linetype));
+        return (dxf_strdup (trace->linetype));
 }
 
 
@@ -940,7 +932,7 @@ dxf_trace_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        trace->linetype = strdup (linetype);
+        trace->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -981,7 +973,7 @@ dxf_trace_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (trace->layer));
+        return (dxf_strdup (trace->layer));
 }
 
 
@@ -1016,7 +1008,7 @@ dxf_trace_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        trace->layer = strdup (layer);
+        trace->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1770,7 +1762,7 @@ dxf_trace_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (trace->dictionary_owner_soft));
+        return (dxf_strdup (trace->dictionary_owner_soft));
 }
 
 
@@ -1806,7 +1798,7 @@ dxf_trace_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        trace->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        trace->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1850,7 +1842,7 @@ dxf_trace_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (trace->material));
+        return (dxf_strdup (trace->material));
 }
 
 
@@ -1888,7 +1880,7 @@ dxf_trace_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        trace->material = strdup (material);
+        trace->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1932,7 +1924,7 @@ dxf_trace_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (trace->dictionary_owner_hard));
+        return (dxf_strdup (trace->dictionary_owner_hard));
 }
 
 
@@ -1968,7 +1960,7 @@ dxf_trace_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        trace->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        trace->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2075,7 +2067,7 @@ dxf_trace_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (trace->plot_style_name));
+        return (dxf_strdup (trace->plot_style_name));
 }
 
 
@@ -2113,7 +2105,7 @@ dxf_trace_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        trace->plot_style_name = strdup (plot_style_name);
+        trace->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2220,7 +2212,7 @@ dxf_trace_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (trace->color_name));
+        return (dxf_strdup (trace->color_name));
 }
 
 
@@ -2258,7 +2250,7 @@ dxf_trace_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        trace->color_name = strdup (color_name);
+        trace->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2343,7 +2335,7 @@ dxf_trace_get_p0
                 /*!< a pointer to a DXF \c TEXT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2382,7 +2374,7 @@ dxf_trace_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2421,7 +2413,7 @@ dxf_trace_get_x0
                 /*!< a pointer to a DXF \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2464,7 +2456,7 @@ dxf_trace_set_x0
                  * \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2503,7 +2495,7 @@ dxf_trace_get_y0
                 /*!< a pointer to a DXF \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2546,7 +2538,7 @@ dxf_trace_set_y0
                  * \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2585,7 +2577,7 @@ dxf_trace_get_z0
                 /*!< a pointer to a DXF \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2628,7 +2620,7 @@ dxf_trace_set_z0
                  * \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2666,7 +2658,7 @@ dxf_trace_get_p1
                 /*!< a pointer to a DXF \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2705,7 +2697,7 @@ dxf_trace_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2744,7 +2736,7 @@ dxf_trace_get_x1
                 /*!< a pointer to a DXF \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2787,7 +2779,7 @@ dxf_trace_set_x1
                  * \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2826,7 +2818,7 @@ dxf_trace_get_y1
                 /*!< a pointer to a DXF \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2869,7 +2861,7 @@ dxf_trace_set_y1
                  * \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2908,7 +2900,7 @@ dxf_trace_get_z1
                 /*!< a pointer to a DXF \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2951,7 +2943,7 @@ dxf_trace_set_z1
                  * \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2989,7 +2981,7 @@ dxf_trace_get_p2
                 /*!< a pointer to a DXF \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3028,7 +3020,7 @@ dxf_trace_set_p2
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3067,7 +3059,7 @@ dxf_trace_get_x2
                 /*!< a pointer to a DXF \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3110,7 +3102,7 @@ dxf_trace_set_x2
                  * \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3149,7 +3141,7 @@ dxf_trace_get_y2
                 /*!< a pointer to a DXF \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3192,7 +3184,7 @@ dxf_trace_set_y2
                  * \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3231,7 +3223,7 @@ dxf_trace_get_z2
                 /*!< a pointer to a DXF \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3274,7 +3266,7 @@ dxf_trace_set_z2
                  * \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3312,7 +3304,7 @@ dxf_trace_get_p3
                 /*!< a pointer to a DXF \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3351,7 +3343,7 @@ dxf_trace_set_p3
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3390,7 +3382,7 @@ dxf_trace_get_x3
                 /*!< a pointer to a DXF \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3433,7 +3425,7 @@ dxf_trace_set_x3
                  * \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3472,7 +3464,7 @@ dxf_trace_get_y3
                 /*!< a pointer to a DXF \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3515,7 +3507,7 @@ dxf_trace_set_y3
                  * \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3554,7 +3546,7 @@ dxf_trace_get_z3
                 /*!< a pointer to a DXF \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3597,7 +3589,7 @@ dxf_trace_set_z3
                  * \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3638,7 +3630,7 @@ dxf_trace_get_extrusion_vector_as_point
                 /*!< a pointer to a DXF \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *point = NULL;
@@ -3760,7 +3752,7 @@ dxf_trace_get_extr_x0
                 /*!< a pointer to a DXF \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3796,7 +3788,7 @@ dxf_trace_set_extr_x0
                  * DXF \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3828,7 +3820,7 @@ dxf_trace_get_extr_y0
                 /*!< a pointer to a DXF \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3864,7 +3856,7 @@ dxf_trace_set_extr_y0
                  * DXF \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3896,7 +3888,7 @@ dxf_trace_get_extr_z0
                 /*!< a pointer to a DXF \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3932,7 +3924,7 @@ dxf_trace_set_extr_z0
                  * DXF \c TRACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
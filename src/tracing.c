@@ -0,0 +1,435 @@
+/*!
+ * \file tracing.c
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for the tracing of libDXF.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "global.h"
+#include "stats.h"
+
+#include <pthread.h>
+
+
+#define DXF_TRACING_MAX_DEPTH 256
+        /*!< \brief Maximum nesting of spans in a dump. */
+
+
+/*!
+ * \brief A tracing event.
+ */
+typedef struct
+dxf_tracing_event_struct
+{
+        int64_t timestamp;
+                /*!< time of the event in nanoseconds. */
+        const char *name;
+                /*!< name of the event, a string with static storage. */
+        unsigned int category;
+                /*!< category of the event. */
+        char phase;
+                /*!< \c 'B' for begin, \c 'E' for end, \c 'i' for an
+                 * instant event. */
+} DxfTracingEvent;
+
+
+/*!
+ * \brief The ring buffer of the events of a thread.
+ *
+ * Only the owning thread writes events, the ring buffers of all threads
+ * are kept in a single linked list.\n
+ * A ring buffer is released when its thread exits and taken over by the
+ * next thread starting to record, so the list only grows up to the
+ * largest number of threads recording at the same time.
+ */
+typedef struct
+dxf_tracing_ring_struct
+{
+        uint64_t head;
+                /*!< number of events written. */
+        uint64_t start;
+                /*!< number of events written before the last clear. */
+        int thread_id;
+                /*!< thread id in the dump. */
+        int in_use;
+                /*!< \c TRUE while a thread owns the ring buffer. */
+        struct dxf_tracing_ring_struct *next;
+                /*!< pointer to the ring buffer of the next thread. */
+        DxfTracingEvent events[DXF_TRACING_RING_SIZE];
+                /*!< the events. */
+} DxfTracingRing;
+
+
+static DxfTracingRing *dxf_tracing_rings = NULL;
+        /*!< \brief The ring buffers of all threads. */
+static int dxf_tracing_number_of_threads = 0;
+        /*!< \brief Number of threads with a ring buffer. */
+static unsigned int dxf_tracing_categories = DXF_TRACING_CATEGORIES;
+        /*!< \brief The categories recorded. */
+static __thread DxfTracingRing *dxf_tracing_ring = NULL;
+        /*!< \brief The ring buffer of the calling thread. */
+static pthread_key_t dxf_tracing_key;
+        /*!< \brief Key releasing the ring buffer of an exiting thread. */
+static pthread_once_t dxf_tracing_key_once = PTHREAD_ONCE_INIT;
+        /*!< \brief Creates \c dxf_tracing_key once. */
+static int dxf_tracing_key_created = FALSE;
+        /*!< \brief \c TRUE when \c dxf_tracing_key was created. */
+
+
+/*!
+ * \brief Release the ring buffer of an exiting thread, to be taken over
+ * by the next thread starting to record.
+ *
+ * The events stay in the ring buffer until then.
+ */
+static void
+dxf_tracing_release
+(
+        void *data
+                /*!< the ring buffer of the exiting thread. */
+)
+{
+        DxfTracingRing *ring = (DxfTracingRing *) data;
+
+        __atomic_store_n (&ring->in_use, FALSE, __ATOMIC_RELEASE);
+}
+
+
+/*!
+ * \brief Create the key releasing the ring buffers of exiting threads.
+ */
+static void
+dxf_tracing_create_key ()
+{
+        dxf_tracing_key_created =
+          (pthread_key_create (&dxf_tracing_key, dxf_tracing_release) == 0);
+}
+
+
+/*!
+ * \brief Take over a released ring buffer, or allocate and register a new
+ * one, for the calling thread.
+ *
+ * Ring buffers are allocated from the C library and not with the
+ * allocator hooks: they outlive the allocations of any single caller.
+ */
+static DxfTracingRing *
+dxf_tracing_register ()
+{
+        DxfTracingRing *ring = NULL;
+        int in_use;
+
+        pthread_once (&dxf_tracing_key_once, dxf_tracing_create_key);
+        if (!dxf_tracing_key_created)
+        {
+                return (NULL);
+        }
+        for (ring = __atomic_load_n (&dxf_tracing_rings, __ATOMIC_ACQUIRE);
+          ring != NULL;
+          ring = ring->next)
+        {
+                in_use = FALSE;
+                if (__atomic_compare_exchange_n (&ring->in_use, &in_use,
+                  TRUE, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+                {
+                        /* Forget the events of the previous thread. */
+                        __atomic_store_n (&ring->start,
+                          __atomic_load_n (&ring->head, __ATOMIC_ACQUIRE),
+                          __ATOMIC_RELEASE);
+                        ring->thread_id = __atomic_add_fetch
+                          (&dxf_tracing_number_of_threads, 1, __ATOMIC_SEQ_CST);
+                        break;
+                }
+        }
+        if (ring == NULL)
+        {
+                ring = calloc (1, sizeof (DxfTracingRing));
+                if (ring == NULL)
+                {
+                        return (NULL);
+                }
+                ring->in_use = TRUE;
+                ring->thread_id = __atomic_add_fetch
+                  (&dxf_tracing_number_of_threads, 1, __ATOMIC_SEQ_CST);
+                ring->next = __atomic_load_n (&dxf_tracing_rings, __ATOMIC_ACQUIRE);
+                while (!__atomic_compare_exchange_n (&dxf_tracing_rings,
+                  &ring->next, ring, 0, __ATOMIC_RELEASE, __ATOMIC_ACQUIRE))
+                {
+                }
+        }
+        if (pthread_setspecific (dxf_tracing_key, ring) != 0)
+        {
+                dxf_tracing_release (ring);
+                return (NULL);
+        }
+        dxf_tracing_ring = ring;
+        return (ring);
+}
+
+
+/*!
+ * \brief Record an event in the ring buffer of the calling thread.
+ *
+ * Use the DXF_TRACE_BEGIN, DXF_TRACE_END and DXF_TRACE_INSTANT macros,
+ * which compile to nothing for categories not compiled in.\n
+ * Recording is lock free, the oldest events of a thread are overwritten
+ * when more than \c DXF_TRACING_RING_SIZE events are recorded.
+ */
+void
+dxf_tracing_event
+(
+        unsigned int category,
+                /*!< category of the event. */
+        char phase,
+                /*!< \c 'B' for begin, \c 'E' for end, \c 'i' for an
+                 * instant event. */
+        const char *name
+                /*!< name of the event, a string with static storage. */
+)
+{
+        DxfTracingRing *ring = NULL;
+        DxfTracingEvent *event = NULL;
+        uint64_t head;
+
+        if ((__atomic_load_n (&dxf_tracing_categories, __ATOMIC_RELAXED) & category) == 0)
+        {
+                return;
+        }
+        ring = dxf_tracing_ring;
+        if ((ring == NULL) && ((ring = dxf_tracing_register ()) == NULL))
+        {
+                return;
+        }
+        head = ring->head;
+        event = &ring->events[head & (DXF_TRACING_RING_SIZE - 1)];
+        event->timestamp = dxf_stats_now ();
+        event->name = name;
+        event->category = category;
+        event->phase = phase;
+        __atomic_store_n (&ring->head, head + 1, __ATOMIC_RELEASE);
+}
+
+
+/*!
+ * \brief Select the categories of events to record.
+ *
+ * Only categories compiled in (\c DXF_TRACING_CATEGORIES) can be
+ * recorded, all of them are recorded by default.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tracing_enable
+(
+        unsigned int categories
+                /*!< the categories to record, \c 0 to stop recording. */
+)
+{
+        __atomic_store_n (&dxf_tracing_categories, categories,
+          __ATOMIC_RELAXED);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Forget the events recorded so far, of all threads.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tracing_clear ()
+{
+        DxfTracingRing *ring = NULL;
+
+        for (ring = __atomic_load_n (&dxf_tracing_rings, __ATOMIC_ACQUIRE);
+          ring != NULL;
+          ring = ring->next)
+        {
+                __atomic_store_n (&ring->start,
+                  __atomic_load_n (&ring->head, __ATOMIC_ACQUIRE),
+                  __ATOMIC_RELEASE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the name of a category for a dump.
+ */
+static const char *
+dxf_tracing_category_name
+(
+        unsigned int category
+)
+{
+        switch (category)
+        {
+                case DXF_TRACING_FUNCTION: return ("function");
+                case DXF_TRACING_FILE: return ("file");
+                case DXF_TRACING_SECTION: return ("section");
+                case DXF_TRACING_ENTITY: return ("entity");
+                default: return ("unknown");
+        }
+}
+
+
+/*!
+ * \brief Write one event of a dump.
+ */
+static void
+dxf_tracing_dump_event
+(
+        FILE *out,
+        int *first,
+        int thread_id,
+        DxfTracingEvent *event,
+        char phase
+)
+{
+        const char *c;
+
+        fprintf (out, "%s{\"name\":\"", *first ? "" : ",\n");
+        for (c = event->name; *c != '\0'; c++)
+        {
+                if ((*c == '"') || (*c == '\\'))
+                {
+                        fputc ('\\', out);
+                }
+                fputc ((*c < ' ') ? '?' : *c, out);
+        }
+        fprintf (out, "\",\"cat\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%d%s}",
+          dxf_tracing_category_name (event->category), phase,
+          event->timestamp / 1000.0, thread_id,
+          (phase == 'i') ? ",\"s\":\"t\"" : "");
+        *first = FALSE;
+}
+
+
+/*!
+ * \brief Dump the recorded events in the Chrome trace event format.
+ *
+ * The dump can be loaded in chrome://tracing or Perfetto.\n
+ * Spans of which the begin was overwritten are left out, spans left
+ * without an end (a function returning before DXF_DEBUG_END) are ended
+ * with the span around them.\n
+ * Dump when no other thread is recording, events recorded during the
+ * dump can be inconsistent.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tracing_dump
+(
+        FILE *out
+                /*!< the stream to write to. */
+)
+{
+        DxfTracingRing *ring = NULL;
+        DxfTracingEvent event;
+        DxfTracingEvent *stack[DXF_TRACING_MAX_DEPTH];
+        DxfTracingEvent ended;
+        uint64_t head;
+        uint64_t start;
+        uint64_t i;
+        int depth;
+        int first;
+        int j;
+
+        if (out == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        fprintf (out, "{\"traceEvents\":[\n");
+        first = TRUE;
+        for (ring = __atomic_load_n (&dxf_tracing_rings, __ATOMIC_ACQUIRE);
+          ring != NULL;
+          ring = ring->next)
+        {
+                head = __atomic_load_n (&ring->head, __ATOMIC_ACQUIRE);
+                start = __atomic_load_n (&ring->start, __ATOMIC_ACQUIRE);
+                if (head - start > DXF_TRACING_RING_SIZE)
+                {
+                        start = head - DXF_TRACING_RING_SIZE;
+                }
+                depth = 0;
+                for (i = start; i < head; i++)
+                {
+                        event = ring->events[i & (DXF_TRACING_RING_SIZE - 1)];
+                        if (event.phase == 'B')
+                        {
+                                if (depth < DXF_TRACING_MAX_DEPTH)
+                                {
+                                        stack[depth++] = &ring->events[i & (DXF_TRACING_RING_SIZE - 1)];
+                                        dxf_tracing_dump_event (out, &first,
+                                          ring->thread_id, &event, 'B');
+                                }
+                                continue;
+                        }
+                        if (event.phase != 'E')
+                        {
+                                dxf_tracing_dump_event (out, &first,
+                                  ring->thread_id, &event, event.phase);
+                                continue;
+                        }
+                        /* Match the end with the innermost open span of
+                         * the same name. */
+                        for (j = depth - 1;
+                          (j >= 0) && (strcmp (stack[j]->name, event.name) != 0);
+                          j--)
+                        {
+                        }
+                        if (j < 0)
+                        {
+                                continue;
+                        }
+                        while (depth > j + 1)
+                        {
+                                ended = *stack[--depth];
+                                ended.timestamp = event.timestamp;
+                                dxf_tracing_dump_event (out, &first,
+                                  ring->thread_id, &ended, 'E');
+                        }
+                        depth--;
+                        dxf_tracing_dump_event (out, &first,
+                          ring->thread_id, &event, 'E');
+                }
+        }
+        fprintf (out, "\n],\"displayTimeUnit\":\"ns\"}\n");
+        return (ferror (out) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+
+/* EOF */
@@ -0,0 +1,127 @@
+/*!
+ * \file tracing.h
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Definition of the tracing of libDXF.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_TRACING_H
+#define LIBDXF_SRC_TRACING_H
+
+
+#include <stdio.h>
+#include <stdint.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_TRACING_FUNCTION 0x01
+        /*!< \brief Category of function entry and exit events
+         * (DXF_DEBUG_BEGIN and DXF_DEBUG_END). */
+
+#define DXF_TRACING_FILE 0x02
+        /*!< \brief Category of reading and writing a file. */
+
+#define DXF_TRACING_SECTION 0x04
+        /*!< \brief Category of reading a section. */
+
+#define DXF_TRACING_ENTITY 0x08
+        /*!< \brief Category of reading an entity. */
+
+#define DXF_TRACING_ALL 0x0f
+        /*!< \brief All categories. */
+
+#ifndef DXF_TRACING_CATEGORIES
+#  if DEBUG
+#    define DXF_TRACING_CATEGORIES DXF_TRACING_ALL
+#  else
+#    define DXF_TRACING_CATEGORIES 0
+#  endif
+        /*!< \brief The categories compiled in.
+         *
+         * Events of other categories compile to nothing.\n
+         * If not already defined as a compiler directive all categories
+         * are compiled in with DEBUG enabled, none otherwise. */
+#endif
+
+#define DXF_TRACING_RING_SIZE 65536
+        /*!< \brief Number of events kept per thread, a power of two. */
+
+
+#define DXF_TRACE_BEGIN(category, name) \
+        do \
+        { \
+                if ((DXF_TRACING_CATEGORIES) & (category)) \
+                { \
+                        dxf_tracing_event ((category), 'B', (name)); \
+                } \
+        } while (0)
+        /*!< \brief Record the begin of a span \c name, \c name has to be
+         * a string with static storage. */
+
+#define DXF_TRACE_END(category, name) \
+        do \
+        { \
+                if ((DXF_TRACING_CATEGORIES) & (category)) \
+                { \
+                        dxf_tracing_event ((category), 'E', (name)); \
+                } \
+        } while (0)
+        /*!< \brief Record the end of a span \c name. */
+
+#define DXF_TRACE_INSTANT(category, name) \
+        do \
+        { \
+                if ((DXF_TRACING_CATEGORIES) & (category)) \
+                { \
+                        dxf_tracing_event ((category), 'i', (name)); \
+                } \
+        } while (0)
+        /*!< \brief Record an event \c name without a duration. */
+
+
+void dxf_tracing_event (unsigned int category, char phase, const char *name);
+int dxf_tracing_enable (unsigned int categories);
+int dxf_tracing_clear ();
+int dxf_tracing_dump (FILE *out);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_TRACING_H */
+
+
+/* EOF */
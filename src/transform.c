@@ -0,0 +1,693 @@
+/*!
+ * \file transform.c
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for libDXF coordinate transformations (4 x 4 matrices).
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "transform.h"
+
+
+/*!
+ * \brief Allocate memory for a \c DxfTransform.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfTransform *
+dxf_transform_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTransform *transform = NULL;
+        size_t size;
+
+        size = sizeof (DxfTransform);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((transform = dxf_malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                transform = NULL;
+        }
+        else
+        {
+                memset (transform, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (transform);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize a \c DxfTransform to the
+ * identity transformation.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfTransform *
+dxf_transform_init
+(
+        DxfTransform *transform
+                /*!< a pointer to a \c DxfTransform. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+        int j;
+
+        /* Do some basic checks. */
+        if (transform == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                transform = dxf_transform_new ();
+        }
+        if (transform == NULL)
+        {
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                (_("Error in %s () could not allocate memory.\n")),
+                __FUNCTION__);
+              return (NULL);
+        }
+        for (i = 0; i < 4; i++)
+        {
+                for (j = 0; j < 4; j++)
+                {
+                        transform->m[i][j] = (i == j) ? 1.0 : 0.0;
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (transform);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfTransform.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_transform_free
+(
+        DxfTransform *transform
+                /*!< a pointer to the memory occupied by the
+                 * \c DxfTransform. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (transform == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_free (transform);
+        transform = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Copy the matrix of \c source into \c transform.
+ *
+ * \return a pointer to \c transform, or \c NULL when an error occurred.
+ */
+DxfTransform *
+dxf_transform_copy
+(
+        DxfTransform *transform,
+                /*!< a pointer to the destination \c DxfTransform. */
+        DxfTransform *source
+                /*!< a pointer to the source \c DxfTransform. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((transform == NULL) || (source == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (transform->m, source->m, sizeof (transform->m));
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (transform);
+}
+
+
+/*!
+ * \brief Multiply two transformations: \f$ result = a \cdot b \f$.
+ *
+ * The resulting transformation applies \c b first and \c a last.\n
+ * \c result may be the same object as \c a or \c b.
+ *
+ * \return a pointer to \c result, or \c NULL when an error occurred.
+ */
+DxfTransform *
+dxf_transform_multiply
+(
+        DxfTransform *result,
+                /*!< a pointer to the resulting \c DxfTransform. */
+        DxfTransform *a,
+                /*!< a pointer to the left hand \c DxfTransform. */
+        DxfTransform *b
+                /*!< a pointer to the right hand \c DxfTransform. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double m[4][4];
+        int i;
+        int j;
+        int k;
+
+        /* Do some basic checks. */
+        if ((result == NULL) || (a == NULL) || (b == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        for (i = 0; i < 4; i++)
+        {
+                for (j = 0; j < 4; j++)
+                {
+                        m[i][j] = 0.0;
+                        for (k = 0; k < 4; k++)
+                        {
+                                m[i][j] += a->m[i][k] * b->m[k][j];
+                        }
+                }
+        }
+        memcpy (result->m, m, sizeof (m));
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Append a translation to a transformation.
+ *
+ * The translation is applied to points before the existing
+ * transformation.
+ *
+ * \return a pointer to \c transform, or \c NULL when an error occurred.
+ */
+DxfTransform *
+dxf_transform_translate
+(
+        DxfTransform *transform,
+                /*!< a pointer to a \c DxfTransform. */
+        double dx,
+                /*!< translation in the X-direction. */
+        double dy,
+                /*!< translation in the Y-direction. */
+        double dz
+                /*!< translation in the Z-direction. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        /* Do some basic checks. */
+        if (transform == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        for (i = 0; i < 3; i++)
+        {
+                transform->m[i][3] += transform->m[i][0] * dx
+                  + transform->m[i][1] * dy
+                  + transform->m[i][2] * dz;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (transform);
+}
+
+
+/*!
+ * \brief Append a scaling to a transformation.
+ *
+ * The scaling is applied to points before the existing transformation.
+ *
+ * \return a pointer to \c transform, or \c NULL when an error occurred.
+ */
+DxfTransform *
+dxf_transform_scale
+(
+        DxfTransform *transform,
+                /*!< a pointer to a \c DxfTransform. */
+        double sx,
+                /*!< scale factor in the X-direction. */
+        double sy,
+                /*!< scale factor in the Y-direction. */
+        double sz
+                /*!< scale factor in the Z-direction. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        /* Do some basic checks. */
+        if (transform == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        for (i = 0; i < 3; i++)
+        {
+                transform->m[i][0] *= sx;
+                transform->m[i][1] *= sy;
+                transform->m[i][2] *= sz;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (transform);
+}
+
+
+/*!
+ * \brief Append a rotation around the Z-axis to a transformation.
+ *
+ * The rotation is applied to points before the existing transformation.
+ *
+ * \return a pointer to \c transform, or \c NULL when an error occurred.
+ */
+DxfTransform *
+dxf_transform_rotate_z
+(
+        DxfTransform *transform,
+                /*!< a pointer to a \c DxfTransform. */
+        double angle
+                /*!< rotation angle in degrees, counter clockwise. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double c;
+        double s;
+        double m0;
+        double m1;
+        int i;
+
+        /* Do some basic checks. */
+        if (transform == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (angle == 0.0)
+        {
+                return (transform);
+        }
+        c = cos (angle * M_PI / 180.0);
+        s = sin (angle * M_PI / 180.0);
+        for (i = 0; i < 3; i++)
+        {
+                m0 = transform->m[i][0];
+                m1 = transform->m[i][1];
+                transform->m[i][0] = m0 * c + m1 * s;
+                transform->m[i][1] = m1 * c - m0 * s;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (transform);
+}
+
+
+/*!
+ * \brief Compute the axes of an Object Coordinate System (OCS) from an
+ * extrusion vector with the "Arbitrary Axis Algorithm".
+ *
+ * A zero length extrusion vector is treated as the world Z-axis
+ * (0.0, 0.0, 1.0), as a lot of entities are initialized that way.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_transform_ocs_axes
+(
+        double extr_x0,
+                /*!< X-value of the extrusion vector. */
+        double extr_y0,
+                /*!< Y-value of the extrusion vector. */
+        double extr_z0,
+                /*!< Z-value of the extrusion vector. */
+        double ax[3],
+                /*!< the resulting OCS X-axis (in WCS). */
+        double ay[3],
+                /*!< the resulting OCS Y-axis (in WCS). */
+        double az[3]
+                /*!< the resulting OCS Z-axis (in WCS). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double length;
+
+        /* Do some basic checks. */
+        if ((ax == NULL) || (ay == NULL) || (az == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        length = sqrt (extr_x0 * extr_x0 + extr_y0 * extr_y0 + extr_z0 * extr_z0);
+        if (length == 0.0)
+        {
+                extr_x0 = 0.0;
+                extr_y0 = 0.0;
+                extr_z0 = 1.0;
+                length = 1.0;
+        }
+        az[0] = extr_x0 / length;
+        az[1] = extr_y0 / length;
+        az[2] = extr_z0 / length;
+        if ((fabs (az[0]) < DXF_TRANSFORM_ARBITRARY_AXIS_LIMIT)
+          && (fabs (az[1]) < DXF_TRANSFORM_ARBITRARY_AXIS_LIMIT))
+        {
+                /* Ax = Wy x N. */
+                ax[0] = az[2];
+                ax[1] = 0.0;
+                ax[2] = -az[0];
+        }
+        else
+        {
+                /* Ax = Wz x N. */
+                ax[0] = -az[1];
+                ax[1] = az[0];
+                ax[2] = 0.0;
+        }
+        length = sqrt (ax[0] * ax[0] + ax[1] * ax[1] + ax[2] * ax[2]);
+        ax[0] /= length;
+        ax[1] /= length;
+        ax[2] /= length;
+        /* Ay = N x Ax. */
+        ay[0] = az[1] * ax[2] - az[2] * ax[1];
+        ay[1] = az[2] * ax[0] - az[0] * ax[2];
+        ay[2] = az[0] * ax[1] - az[1] * ax[0];
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append the Object Coordinate System (OCS) to World Coordinate
+ * System (WCS) conversion for an extrusion vector to a transformation.
+ *
+ * \return a pointer to \c transform, or \c NULL when an error occurred.
+ */
+DxfTransform *
+dxf_transform_ocs
+(
+        DxfTransform *transform,
+                /*!< a pointer to a \c DxfTransform. */
+        double extr_x0,
+                /*!< X-value of the extrusion vector. */
+        double extr_y0,
+                /*!< Y-value of the extrusion vector. */
+        double extr_z0
+                /*!< Z-value of the extrusion vector. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTransform ocs;
+        double ax[3];
+        double ay[3];
+        double az[3];
+        int i;
+
+        /* Do some basic checks. */
+        if (transform == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (((extr_x0 == 0.0) && (extr_y0 == 0.0))
+          && ((extr_z0 == 0.0) || (extr_z0 == 1.0)))
+        {
+                /* The OCS equals the WCS. */
+                return (transform);
+        }
+        dxf_transform_ocs_axes (extr_x0, extr_y0, extr_z0, ax, ay, az);
+        dxf_transform_init (&ocs);
+        for (i = 0; i < 3; i++)
+        {
+                ocs.m[i][0] = ax[i];
+                ocs.m[i][1] = ay[i];
+                ocs.m[i][2] = az[i];
+        }
+        dxf_transform_multiply (transform, transform, &ocs);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (transform);
+}
+
+
+/*!
+ * \brief Transform the coordinates of a point in place.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_transform_apply_point
+(
+        DxfTransform *transform,
+                /*!< a pointer to a \c DxfTransform. */
+        double *x,
+                /*!< X-coordinate of the point. */
+        double *y,
+                /*!< Y-coordinate of the point. */
+        double *z
+                /*!< Z-coordinate of the point. */
+)
+{
+        double x0;
+        double y0;
+        double z0;
+
+        /* Do some basic checks. */
+        if ((transform == NULL) || (x == NULL) || (y == NULL) || (z == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        x0 = *x;
+        y0 = *y;
+        z0 = *z;
+        *x = transform->m[0][0] * x0 + transform->m[0][1] * y0 + transform->m[0][2] * z0 + transform->m[0][3];
+        *y = transform->m[1][0] * x0 + transform->m[1][1] * y0 + transform->m[1][2] * z0 + transform->m[1][3];
+        *z = transform->m[2][0] * x0 + transform->m[2][1] * y0 + transform->m[2][2] * z0 + transform->m[2][3];
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Transform the components of a direction vector in place.
+ *
+ * The translation part of the transformation is not applied.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_transform_apply_vector
+(
+        DxfTransform *transform,
+                /*!< a pointer to a \c DxfTransform. */
+        double *x,
+                /*!< X-component of the vector. */
+        double *y,
+                /*!< Y-component of the vector. */
+        double *z
+                /*!< Z-component of the vector. */
+)
+{
+        double x0;
+        double y0;
+        double z0;
+
+        /* Do some basic checks. */
+        if ((transform == NULL) || (x == NULL) || (y == NULL) || (z == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        x0 = *x;
+        y0 = *y;
+        z0 = *z;
+        *x = transform->m[0][0] * x0 + transform->m[0][1] * y0 + transform->m[0][2] * z0;
+        *y = transform->m[1][0] * x0 + transform->m[1][1] * y0 + transform->m[1][2] * z0;
+        *z = transform->m[2][0] * x0 + transform->m[2][1] * y0 + transform->m[2][2] * z0;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Transform a contiguous array of points in place.
+ *
+ * The array holds \c number_of_points triplets of X-, Y- and
+ * Z-coordinates.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_transform_apply_points
+(
+        DxfTransform *transform,
+                /*!< a pointer to a \c DxfTransform. */
+        double *xyz,
+                /*!< array of point coordinates. */
+        size_t number_of_points
+                /*!< number of points in the array. */
+)
+{
+        const double (*m)[4];
+        double x0;
+        double y0;
+        double z0;
+        size_t i;
+
+        /* Do some basic checks. */
+        if ((transform == NULL) || ((xyz == NULL) && (number_of_points > 0)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        m = (const double (*)[4]) transform->m;
+        for (i = 0; i < number_of_points; i++, xyz += 3)
+        {
+                x0 = xyz[0];
+                y0 = xyz[1];
+                z0 = xyz[2];
+                xyz[0] = m[0][0] * x0 + m[0][1] * y0 + m[0][2] * z0 + m[0][3];
+                xyz[1] = m[1][0] * x0 + m[1][1] * y0 + m[1][2] * z0 + m[1][3];
+                xyz[2] = m[2][0] * x0 + m[2][1] * y0 + m[2][2] * z0 + m[2][3];
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Test if a transformation is the identity transformation.
+ *
+ * \return \c TRUE when \c transform is the identity transformation (or
+ * \c NULL), \c FALSE otherwise.
+ */
+int
+dxf_transform_is_identity
+(
+        DxfTransform *transform
+                /*!< a pointer to a \c DxfTransform. */
+)
+{
+        int i;
+        int j;
+
+        if (transform == NULL)
+        {
+                return (TRUE);
+        }
+        for (i = 0; i < 4; i++)
+        {
+                for (j = 0; j < 4; j++)
+                {
+                        if (transform->m[i][j] != ((i == j) ? 1.0 : 0.0))
+                        {
+                                return (FALSE);
+                        }
+                }
+        }
+        return (TRUE);
+}
+
+
+/* EOF */
@@ -0,0 +1,97 @@
+/*!
+ * \file transform.h
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for libDXF coordinate transformations (4 x 4 matrices).
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_TRANSFORM_H
+#define LIBDXF_SRC_TRANSFORM_H
+
+
+#include "global.h"
+#include "point.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_TRANSFORM_ARBITRARY_AXIS_LIMIT (1.0 / 64.0)
+        /*!< \brief Limit used by the "Arbitrary Axis Algorithm".
+         *
+         * If both the X- and Y-value of the extrusion vector are smaller
+         * than this value the X-axis of the Object Coordinate System
+         * (OCS) is derived from the world Y-axis, otherwise from the
+         * world Z-axis. */
+
+
+/*!
+ * \brief Definition of an affine coordinate transformation.
+ *
+ * The transformation is stored as a 4 x 4 matrix in row major order,
+ * points are column vectors:\n
+ * \f$ P' = M \cdot P \f$\n
+ * The bottom row is always (0, 0, 0, 1).
+ */
+typedef struct
+dxf_transform_struct
+{
+        double m[4][4];
+                /*!< Matrix elements, \c m[row][column]. */
+} DxfTransform;
+
+
+DxfTransform *dxf_transform_new ();
+DxfTransform *dxf_transform_init (DxfTransform *transform);
+int dxf_transform_free (DxfTransform *transform);
+DxfTransform *dxf_transform_copy (DxfTransform *transform, DxfTransform *source);
+DxfTransform *dxf_transform_multiply (DxfTransform *result, DxfTransform *a, DxfTransform *b);
+DxfTransform *dxf_transform_translate (DxfTransform *transform, double dx, double dy, double dz);
+DxfTransform *dxf_transform_scale (DxfTransform *transform, double sx, double sy, double sz);
+DxfTransform *dxf_transform_rotate_z (DxfTransform *transform, double angle);
+DxfTransform *dxf_transform_ocs (DxfTransform *transform, double extr_x0, double extr_y0, double extr_z0);
+int dxf_transform_ocs_axes (double extr_x0, double extr_y0, double extr_z0, double ax[3], double ay[3], double az[3]);
+int dxf_transform_apply_point (DxfTransform *transform, double *x, double *y, double *z);
+int dxf_transform_apply_vector (DxfTransform *transform, double *x, double *y, double *z);
+int dxf_transform_apply_points (DxfTransform *transform, double *xyz, size_t number_of_points);
+int dxf_transform_is_identity (DxfTransform *transform);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_TRANSFORM_H */
+
+
+/* EOF */
@@ -62,7 +62,7 @@ dxf_ucs_new ()
         size = sizeof (DxfUcs);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((ucs = malloc (size)) == NULL)
+        if ((ucs = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfUcs struct.\n")),
@@ -100,20 +100,20 @@ dxf_ucs_init
         /* Do some basic checks. */
         if (ucs == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 ucs = dxf_ucs_new ();
         }
         if (ucs == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfUcs struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         ucs->id_code = 0;
-        ucs->UCS_name = strdup ("");
+        ucs->UCS_name = dxf_strdup ("");
         ucs->origin = dxf_point_new ();
         ucs->origin = dxf_point_init (ucs->origin);
         ucs->origin->x0 = 0.0;
@@ -138,10 +138,10 @@ dxf_ucs_init
         ucs->orthographic_type = 0;
         ucs->other_base_UCS = 0;
         ucs->elevation = 0.0;
-        ucs->dictionary_owner_soft = strdup ("");
-        ucs->object_owner_soft = strdup ("");
-        ucs->base_UCS = strdup ("");
-        ucs->dictionary_owner_hard = strdup ("");
+        ucs->dictionary_owner_soft = dxf_strdup ("");
+        ucs->object_owner_soft = dxf_strdup ("");
+        ucs->base_UCS = dxf_strdup ("");
+        ucs->dictionary_owner_hard = dxf_strdup ("");
         ucs->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -179,16 +179,16 @@ dxf_ucs_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (ucs == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 ucs = dxf_ucs_init (ucs);
@@ -200,12 +200,12 @@ dxf_ucs_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -331,7 +331,7 @@ dxf_ucs_read
                         if ((ucs->orthographic_type < 1)
                           || (ucs->orthographic_type > 6))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad orthographic_type value in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -344,7 +344,7 @@ dxf_ucs_read
                         fscanf (fp->fp, "%d\n", &ucs->other_base_UCS);
                         if (ucs->other_base_UCS != 0)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad spare value in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -359,7 +359,7 @@ dxf_ucs_read
                         if ((strcmp (temp_string, "AcDbSymbolTableRecord") != 0)
                         && ((strcmp (temp_string, "AcDbUCSTableRecord") != 0)))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -408,13 +408,14 @@ dxf_ucs_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -440,38 +441,38 @@ dxf_ucs_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("UCS");
+        char *dxf_entity_name = dxf_strdup ("UCS");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (ucs == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((ucs->UCS_name == NULL)
           || (strcmp (ucs->UCS_name, "") == 0))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty UCS name string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, ucs->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is discarded from output.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
@@ -545,7 +546,7 @@ dxf_ucs_write
                 fprintf (fp->fp, " 33\n%f\n", ucs->orthographic_type_origin->z0);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -574,22 +575,22 @@ dxf_ucs_free
         /* Do some basic checks. */
         if (ucs == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ucs->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (ucs->UCS_name);
-        free (ucs->dictionary_owner_soft);
-        free (ucs->dictionary_owner_hard);
-        free (ucs);
+        dxf_free (ucs->UCS_name);
+        dxf_free (ucs->dictionary_owner_soft);
+        dxf_free (ucs->dictionary_owner_hard);
+        dxf_free (ucs);
         ucs = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -610,18 +611,19 @@ dxf_ucs_free_list
                  * symbol table entries. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (ucss == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (ucss != NULL)
         {
                 DxfUcs *iter = (DxfUcs *) ucss->next;
+                ucss->next = NULL;
                 dxf_ucs_free (ucss);
                 ucss = (DxfUcs *) iter;
         }
@@ -739,7 +741,7 @@ dxf_ucs_get_UCS_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ucs->UCS_name));
+        return (dxf_strdup (ucs->UCS_name));
 }
 
 
@@ -774,7 +776,7 @@ dxf_ucs_set_UCS_name
                   __FUNCTION__);
                 return (NULL);
         }
-        ucs->UCS_name = strdup (UCS_name);
+        ucs->UCS_name = dxf_strdup (UCS_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -795,7 +797,7 @@ dxf_ucs_get_origin
                 /*!< a pointer to a DXF \c UCS symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -835,7 +837,7 @@ dxf_ucs_set_origin
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -874,7 +876,7 @@ dxf_ucs_get_origin_x
                 /*!< a pointer to a DXF \c UCS symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -917,7 +919,7 @@ dxf_ucs_set_origin_x
                  * \c UCS symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -956,7 +958,7 @@ dxf_ucs_get_origin_y
                 /*!< a pointer to a DXF \c UCS symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -999,7 +1001,7 @@ dxf_ucs_set_origin_y
                  * \c UCS symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1038,7 +1040,7 @@ dxf_ucs_get_origin_z
                 /*!< a pointer to a DXF \c UCS symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1081,7 +1083,7 @@ dxf_ucs_set_origin_z
                  * \c UCS symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1120,7 +1122,7 @@ dxf_ucs_get_X_dir
                 /*!< a pointer to a DXF \c UCS symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1160,7 +1162,7 @@ dxf_ucs_set_X_dir
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1200,7 +1202,7 @@ dxf_ucs_get_X_dir_x
                 /*!< a pointer to a DXF \c UCS symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1244,7 +1246,7 @@ dxf_ucs_set_X_dir_x
                  * entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1284,7 +1286,7 @@ dxf_ucs_get_X_dir_y
                 /*!< a pointer to a DXF \c UCS symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1328,7 +1330,7 @@ dxf_ucs_set_X_dir_y
                  * entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1368,7 +1370,7 @@ dxf_ucs_get_X_dir_z
                 /*!< a pointer to a DXF \c UCS symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1412,7 +1414,7 @@ dxf_ucs_set_X_dir_z
                  * entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1451,7 +1453,7 @@ dxf_ucs_get_Y_dir
                 /*!< a pointer to a DXF \c UCS symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1491,7 +1493,7 @@ dxf_ucs_set_Y_dir
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1531,7 +1533,7 @@ dxf_ucs_get_Y_dir_x
                 /*!< a pointer to a DXF \c UCS symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1575,7 +1577,7 @@ dxf_ucs_set_Y_dir_x
                  * entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1615,7 +1617,7 @@ dxf_ucs_get_Y_dir_y
                 /*!< a pointer to a DXF \c UCS symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1659,7 +1661,7 @@ dxf_ucs_set_Y_dir_y
                  * entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1699,7 +1701,7 @@ dxf_ucs_get_Y_dir_z
                 /*!< a pointer to a DXF \c UCS symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1743,7 +1745,7 @@ dxf_ucs_set_Y_dir_z
                  * entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1783,7 +1785,7 @@ dxf_ucs_get_orthographic_type_origin
                 /*!< a pointer to a DXF \c UCS symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1823,7 +1825,7 @@ dxf_ucs_set_orthographic_type_origin
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1864,7 +1866,7 @@ dxf_ucs_get_orthographic_type_origin_x
                 /*!< a pointer to a DXF \c UCS symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1909,7 +1911,7 @@ dxf_ucs_set_orthographic_type_origin_x
                  * of a DXF \c UCS symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1950,7 +1952,7 @@ dxf_ucs_get_orthographic_type_origin_y
                 /*!< a pointer to a DXF \c UCS symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1995,7 +1997,7 @@ dxf_ucs_set_orthographic_type_origin_y
                  * of a DXF \c UCS symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2036,7 +2038,7 @@ dxf_ucs_get_orthographic_type_origin_z
                 /*!< a pointer to a DXF \c UCS symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2081,7 +2083,7 @@ dxf_ucs_set_orthographic_type_origin_z
                  * of a DXF \c UCS symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2268,7 +2270,7 @@ dxf_ucs_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ucs->dictionary_owner_soft));
+        return (dxf_strdup (ucs->dictionary_owner_soft));
 }
 
 
@@ -2304,7 +2306,7 @@ dxf_ucs_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        ucs->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        ucs->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2348,7 +2350,7 @@ dxf_ucs_get_object_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ucs->object_owner_soft));
+        return (dxf_strdup (ucs->object_owner_soft));
 }
 
 
@@ -2384,7 +2386,7 @@ dxf_ucs_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        ucs->object_owner_soft = strdup (object_owner_soft);
+        ucs->object_owner_soft = dxf_strdup (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2428,7 +2430,7 @@ dxf_ucs_get_base_UCS
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ucs->base_UCS));
+        return (dxf_strdup (ucs->base_UCS));
 }
 
 
@@ -2464,7 +2466,7 @@ dxf_ucs_set_object_base_UCS
                   __FUNCTION__);
                 return (NULL);
         }
-        ucs->base_UCS = strdup (base_UCS);
+        ucs->base_UCS = dxf_strdup (base_UCS);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2508,7 +2510,7 @@ dxf_ucs_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ucs->dictionary_owner_hard));
+        return (dxf_strdup (ucs->dictionary_owner_hard));
 }
 
 
@@ -2544,7 +2546,7 @@ dxf_ucs_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        ucs->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        ucs->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -37,6 +37,7 @@
 
 #include <stdarg.h>
 #include "util.h"
+#include "compress.h"
 
 
 /*!
@@ -56,7 +57,7 @@ dxf_char_new ()
         size = sizeof (DxfChar);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((c = malloc (size)) == NULL)
+        if ((c = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -94,19 +95,19 @@ dxf_char_init
         /* Do some basic checks. */
         if (c == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 c = dxf_char_new ();
         }
         if (c == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        c->value = strdup ("");
+        c->value = dxf_strdup ("");
         c->length = 0;
         c->next = NULL;
 #if DEBUG
@@ -128,7 +129,7 @@ dxf_char_get_value
                 /*!< a pointer to a \c DxfChar object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -142,7 +143,7 @@ dxf_char_get_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (c->value));
+        return (dxf_strdup (c->value));
 }
 
 
@@ -161,7 +162,7 @@ dxf_char_set_value
                 /*!< a pointer to a char \c value. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -179,7 +180,7 @@ dxf_char_set_value
                   __FUNCTION__);
                 return (NULL);
         }
-        c->value = strdup (value);
+        c->value = dxf_strdup (value);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -199,7 +200,7 @@ dxf_char_get_length
                 /*!< a pointer to a \c DxfChar object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -244,7 +245,7 @@ dxf_char_set_length
                 /*!< \c length. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -288,7 +289,7 @@ dxf_char_get_next
                 /*!< a pointer to a \c DxfChar object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -329,7 +330,7 @@ dxf_char_set_next
                 /*!< a pointer to a \c DxfChar object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -421,20 +422,20 @@ dxf_char_free
         /* Do some basic checks. */
         if (c == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (c->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (c->value);
-        free (c);
+        dxf_free (c->value);
+        dxf_free (c);
         c = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -455,12 +456,12 @@ dxf_char_free_list
                  * objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (chars == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -468,6 +469,7 @@ dxf_char_free_list
         while (chars != NULL)
         {
                 DxfChar *iter = (DxfChar *) chars->next;
+                chars->next = NULL;
                 dxf_char_free (chars);
                 chars = (DxfChar *) iter;
         }
@@ -495,7 +497,7 @@ dxf_double_new ()
         size = sizeof (DxfDouble);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((d = malloc (size)) == NULL)
+        if ((d = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -533,14 +535,14 @@ dxf_double_init
         /* Do some basic checks. */
         if (d == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 d = dxf_double_new ();
         }
         if (d == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
@@ -566,7 +568,7 @@ dxf_double_get_value
                 /*!< a pointer to a \c DxfDouble object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -599,7 +601,7 @@ dxf_double_set_value
                 /*!< a double \c value. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -631,7 +633,7 @@ dxf_double_get_next
                 /*!< a pointer to a \c DxfDouble object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -672,7 +674,7 @@ dxf_double_set_next
                 /*!< a pointer to a \c DxfDouble object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -764,19 +766,19 @@ dxf_double_free
         /* Do some basic checks. */
         if (d == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (d->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (d);
+        dxf_free (d);
         d = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -797,12 +799,12 @@ dxf_double_free_list
                  * objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (doubles == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -810,6 +812,7 @@ dxf_double_free_list
         while (doubles != NULL)
         {
                 DxfDouble *iter = (DxfDouble *) doubles->next;
+                doubles->next = NULL;
                 dxf_double_free (doubles);
                 doubles = (DxfDouble *) iter;
         }
@@ -837,7 +840,7 @@ dxf_int_new ()
         size = sizeof (DxfInt);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((i = malloc (size)) == NULL)
+        if ((i = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -875,14 +878,14 @@ dxf_int_init
         /* Do some basic checks. */
         if (i == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 i = dxf_int_new ();
         }
         if (i == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
@@ -908,7 +911,7 @@ dxf_int_get_value
                 /*!< a pointer to a \c DxfInt object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -941,7 +944,7 @@ dxf_int_set_value
                 /*!< an int \c value. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -973,7 +976,7 @@ dxf_int_get_next
                 /*!< a pointer to a \c DxfInt object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1014,7 +1017,7 @@ dxf_int_set_next
                 /*!< a pointer to a \c DxfInt object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1106,19 +1109,19 @@ dxf_int_free
         /* Do some basic checks. */
         if (i == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (i->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (i);
+        dxf_free (i);
         i = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -1139,12 +1142,12 @@ dxf_int_free_list
                  * objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (ints == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1152,6 +1155,7 @@ dxf_int_free_list
         while (ints != NULL)
         {
                 DxfInt *iter = (DxfInt *) ints->next;
+                ints->next = NULL;
                 dxf_int_free (ints);
                 ints = (DxfInt *) iter;
         }
@@ -1179,7 +1183,7 @@ dxf_int16_new ()
         size = sizeof (DxfInt16);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((i = malloc (size)) == NULL)
+        if ((i = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -1217,14 +1221,14 @@ dxf_int16_init
         /* Do some basic checks. */
         if (i == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 i = dxf_int16_new ();
         }
         if (i == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
@@ -1250,7 +1254,7 @@ dxf_int16_get_value
                 /*!< a pointer to a \c DxfInt16 object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1283,7 +1287,7 @@ dxf_int16_set_value
                 /*!< an int16_t \c value. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1315,7 +1319,7 @@ dxf_int16_get_next
                 /*!< a pointer to a \c DxfInt16 object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1356,7 +1360,7 @@ dxf_int16_set_next
                 /*!< a pointer to a \c DxfInt16 object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1448,19 +1452,19 @@ dxf_int16_free
         /* Do some basic checks. */
         if (i == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (i->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (i);
+        dxf_free (i);
         i = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -1481,12 +1485,12 @@ dxf_int16_free_list
                  * objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (ints == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1494,6 +1498,7 @@ dxf_int16_free_list
         while (ints != NULL)
         {
                 DxfInt16 *iter = (DxfInt16 *) ints->next;
+                ints->next = NULL;
                 dxf_int16_free (ints);
                 ints = (DxfInt16 *) iter;
         }
@@ -1521,7 +1526,7 @@ dxf_int32_new ()
         size = sizeof (DxfInt32);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((i = malloc (size)) == NULL)
+        if ((i = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -1559,14 +1564,14 @@ dxf_int32_init
         /* Do some basic checks. */
         if (i == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 i = dxf_int32_new ();
         }
         if (i == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
@@ -1592,7 +1597,7 @@ dxf_int32_get_value
                 /*!< a pointer to a \c DxfInt32 object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1625,7 +1630,7 @@ dxf_int32_set_value
                 /*!< an int32_t \c value. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1657,7 +1662,7 @@ dxf_int32_get_next
                 /*!< a pointer to a \c DxfInt32 object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1698,7 +1703,7 @@ dxf_int32_set_next
                 /*!< a pointer to a \c DxfInt32 object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1790,19 +1795,19 @@ dxf_int32_free
         /* Do some basic checks. */
         if (i == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (i->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (i);
+        dxf_free (i);
         i = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -1823,12 +1828,12 @@ dxf_int32_free_list
                  * objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (ints == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1836,6 +1841,7 @@ dxf_int32_free_list
         while (ints != NULL)
         {
                 DxfInt32 *iter = (DxfInt32 *) ints->next;
+                ints->next = NULL;
                 dxf_int32_free (ints);
                 ints = (DxfInt32 *) iter;
         }
@@ -1863,7 +1869,7 @@ dxf_int64_new ()
         size = sizeof (DxfInt64);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((i = malloc (size)) == NULL)
+        if ((i = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -1901,14 +1907,14 @@ dxf_int64_init
         /* Do some basic checks. */
         if (i == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 i = dxf_int64_new ();
         }
         if (i == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
@@ -1934,7 +1940,7 @@ dxf_int64_get_value
                 /*!< a pointer to a \c DxfInt64 object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1967,7 +1973,7 @@ dxf_int64_set_value
                 /*!< an int64_t \c value. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1999,7 +2005,7 @@ dxf_int64_get_next
                 /*!< a pointer to a \c DxfInt64 object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2040,7 +2046,7 @@ dxf_int64_set_next
                 /*!< a pointer to a \c DxfInt64 object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2329,29 +2335,60 @@ dxf_read_init
 #endif
         DxfFile * file = NULL;
         FILE *fp;
+        FILE *compressed_fp;
+        DxfCompression compression;
         if (!filename)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error: filename is not initialised (NULL pointer).\n")));
                 return (NULL);
         }
         if (strcmp (filename, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error: filename contains an empty string.\n")));
                 return (NULL);
         }
         fp = fopen (filename, "r");
         if (!fp)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error: could not open file: %s for reading (NULL pointer).\n")),
                   filename);
                 return (NULL);
         }
-        file = malloc (sizeof(DxfFile));
+        /* A gzip or zstd compressed file is decompressed while it is
+         * read. */
+        compression = dxf_compress_detect (fp);
+        if (compression != DXF_COMPRESSION_NONE)
+        {
+                compressed_fp = freopen (filename, "rb", fp);
+                fp = (compressed_fp != NULL)
+                  ? dxf_compress_open_read (compressed_fp, compression)
+                  : NULL;
+                if (!fp)
+                {
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                          (_("Error: could not decompress file: %s.\n")),
+                          filename);
+                        if (compressed_fp != NULL)
+                        {
+                                fclose (compressed_fp);
+                        }
+                        return (NULL);
+                }
+        }
+        file = dxf_malloc (sizeof(DxfFile));
+        if (file == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error: could not allocate memory.\n")));
+                fclose (fp);
+                return (NULL);
+        }
+        memset (file, 0, sizeof (DxfFile));
         file->fp = fp;
-        file->filename = strdup(filename);
+        file->filename = dxf_strdup(filename);
         file->line_number = 0;
         /*! \todo FIXME: dxf header and blocks need initialized ?
         dxf_header_init (file->dxf_header);
@@ -2383,8 +2420,8 @@ dxf_read_close
         else
         {
                 fclose (file->fp);
-                free (file->filename);
-                free (file);
+                dxf_free (file->filename);
+                dxf_free (file);
                 file = NULL;
         }
 #if DEBUG
@@ -2415,8 +2452,26 @@ dxf_read_line (char * temp_string, DxfFile *fp)
                   fp->filename, fp->line_number);
                 return (EXIT_FAILURE);
         }
-        if (ret)
+        if (ret == 0)
         {
+                /* An empty line, consume the line feed to make
+                 * progress. */
+                temp_string[0] = '\0';
+                if (fgetc (fp->fp) == '\n')
+                {
+                        fp->line_number++;
+                }
+        }
+        else if (ret > 0)
+        {
+                /* Files written on DOS and Windows end lines with a
+                 * carriage return and a line feed. */
+                size_t length = strlen (temp_string);
+
+                if ((length > 0) && (temp_string[length - 1] == '\r'))
+                {
+                        temp_string[length - 1] = '\0';
+                }
                 fp->line_number++;
         }
 #if DEBUG
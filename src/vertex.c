@@ -42,6 +42,7 @@
 
 
 #include "vertex.h"
+#include "util.h"
 
 
 /*!
@@ -61,7 +62,7 @@ dxf_vertex_new ()
         size = sizeof (DxfVertex);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((vertex = malloc (size)) == NULL)
+        if ((vertex = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfVertex struct.\n")),
@@ -98,21 +99,21 @@ dxf_vertex_init
         /* Do some basic checks. */
         if (vertex == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 vertex = dxf_vertex_new ();
         }
         if (vertex == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfVertex struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         vertex->id_code = 0;
-        vertex->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        vertex->layer = strdup (DXF_DEFAULT_LAYER);
+        vertex->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        vertex->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         vertex->elevation = 0.0;
         vertex->thickness = 0.0;
         vertex->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -123,13 +124,13 @@ dxf_vertex_init
         vertex->shadow_mode = 0;
         vertex->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
         vertex->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) vertex->binary_graphics_data);
-        vertex->dictionary_owner_soft = strdup ("");
-        vertex->material = strdup ("");
-        vertex->dictionary_owner_hard = strdup ("");
+        vertex->dictionary_owner_soft = dxf_strdup ("");
+        vertex->material = dxf_strdup ("");
+        vertex->dictionary_owner_hard = dxf_strdup ("");
         vertex->lineweight = 0;
-        vertex->plot_style_name = strdup ("");
+        vertex->plot_style_name = dxf_strdup ("");
         vertex->color_value = 0;
-        vertex->color_name = strdup ("");
+        vertex->color_name = dxf_strdup ("");
         vertex->transparency = 0;
         vertex->p0 = (DxfPoint *) dxf_point_new ();
         vertex->p0 = dxf_point_init ((DxfPoint *) vertex->p0);
@@ -176,37 +177,33 @@ dxf_vertex_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (vertex == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 vertex = dxf_vertex_init (vertex);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        memset (temp_string, 0, sizeof (temp_string));
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -221,13 +218,17 @@ dxf_vertex_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->linetype);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (vertex->linetype);
+                        vertex->linetype = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->layer);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (vertex->layer);
+                        vertex->layer = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -376,7 +377,7 @@ dxf_vertex_read
                         && (strcmp (temp_string, "AcDb2dVertex") != 0)
                         && (strcmp (temp_string, "AcDb3dPolylineVertex") != 0))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -400,30 +401,35 @@ dxf_vertex_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) vertex->binary_graphics_data->next);
-                        vertex->binary_graphics_data = (DxfBinaryGraphicsData *) vertex->binary_graphics_data->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_graphics_data_append_hex ((DxfBinaryGraphicsData *) vertex->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->dictionary_owner_soft);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (vertex->dictionary_owner_soft);
+                        vertex->dictionary_owner_soft = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "347") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->material);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (vertex->material);
+                        vertex->material = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->dictionary_owner_hard);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (vertex->dictionary_owner_hard);
+                        vertex->dictionary_owner_hard = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -437,7 +443,9 @@ dxf_vertex_read
                         /* Now follows a string containing a plot style
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->plot_style_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (vertex->plot_style_name);
+                        vertex->plot_style_name = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -450,7 +458,9 @@ dxf_vertex_read
                         /* Now follows a string containing a color
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->color_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_free (vertex->color_name);
+                        vertex->color_name = dxf_strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -468,22 +478,25 @@ dxf_vertex_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
+                        dxf_read_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (vertex->linetype, "") == 0)
         {
-                vertex->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_free (vertex->linetype);
+                vertex->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (vertex->layer, "") == 0)
         {
-                vertex->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_free (vertex->layer);
+                vertex->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -509,46 +522,46 @@ dxf_vertex_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("VERTEX");
+        char *dxf_entity_name = dxf_strdup ("VERTEX");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (vertex == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (vertex->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, vertex->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("    %s entity is reset to default linetype")),
                   dxf_entity_name);
-                vertex->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                vertex->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (vertex->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, vertex->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("    %s entity is relocated to layer 0")),
                   dxf_entity_name);
-                vertex->layer = strdup (DXF_DEFAULT_LAYER);
+                vertex->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -670,7 +683,7 @@ dxf_vertex_write
         }
         fprintf (fp->fp, " 91\n%d\n", vertex->vertex_identifier);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -698,28 +711,28 @@ dxf_vertex_free
         /* Do some basic checks. */
         if (vertex == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (vertex->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("ERROR in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (vertex->linetype);
-        free (vertex->layer);
+        dxf_free (vertex->linetype);
+        dxf_free (vertex->layer);
         dxf_binary_graphics_data_free_list (vertex->binary_graphics_data);
-        free (vertex->dictionary_owner_soft);
-        free (vertex->material);
-        free (vertex->dictionary_owner_hard);
-        free (vertex->plot_style_name);
-        free (vertex->color_name);
+        dxf_free (vertex->dictionary_owner_soft);
+        dxf_free (vertex->material);
+        dxf_free (vertex->dictionary_owner_hard);
+        dxf_free (vertex->plot_style_name);
+        dxf_free (vertex->color_name);
         dxf_point_free (vertex->p0);
-        free (vertex);
+        dxf_free (vertex);
         vertex = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -740,18 +753,19 @@ dxf_vertex_free_list
                  * \c VERTEX entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (vertices == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (vertices != NULL)
         {
                 DxfVertex *iter = (DxfVertex *) vertices->next;
+                vertices->next = NULL;
                 dxf_vertex_free (vertices);
                 vertices = (DxfVertex *) iter;
         }
@@ -869,7 +883,7 @@ dxf_vertex_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (vertex->linetype));
+        return (dxf_strdup (vertex->linetype));
 }
 
 
@@ -904,7 +918,7 @@ dxf_vertex_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        vertex->linetype = strdup (linetype);
+        vertex->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -945,7 +959,7 @@ dxf_vertex_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (vertex->layer));
+        return (dxf_strdup (vertex->layer));
 }
 
 
@@ -980,7 +994,7 @@ dxf_vertex_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        vertex->layer = strdup (layer);
+        vertex->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1742,7 +1756,7 @@ dxf_vertex_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (vertex->dictionary_owner_soft));
+        return (dxf_strdup (vertex->dictionary_owner_soft));
 }
 
 
@@ -1778,7 +1792,7 @@ dxf_vertex_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        vertex->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        vertex->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1822,7 +1836,7 @@ dxf_vertex_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (vertex->material));
+        return (dxf_strdup (vertex->material));
 }
 
 
@@ -1860,7 +1874,7 @@ dxf_vertex_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        vertex->material = strdup (material);
+        vertex->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1904,7 +1918,7 @@ dxf_vertex_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (vertex->dictionary_owner_hard));
+        return (dxf_strdup (vertex->dictionary_owner_hard));
 }
 
 
@@ -1940,7 +1954,7 @@ dxf_vertex_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        vertex->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        vertex->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2047,7 +2061,7 @@ dxf_vertex_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (vertex->plot_style_name));
+        return (dxf_strdup (vertex->plot_style_name));
 }
 
 
@@ -2085,7 +2099,7 @@ dxf_vertex_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        vertex->plot_style_name = strdup (plot_style_name);
+        vertex->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2192,7 +2206,7 @@ dxf_vertex_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (vertex->color_name));
+        return (dxf_strdup (vertex->color_name));
 }
 
 
@@ -2230,7 +2244,7 @@ dxf_vertex_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        vertex->color_name = strdup (color_name);
+        vertex->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2315,7 +2329,7 @@ dxf_vertex_get_p0
                 /*!< a pointer to a DXF \c VERTEX entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2354,7 +2368,7 @@ dxf_vertex_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2393,7 +2407,7 @@ dxf_vertex_get_x0
                 /*!< a pointer to a DXF \c VERTEX entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2436,7 +2450,7 @@ dxf_vertex_set_x0
                  * \c VERTEX entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2475,7 +2489,7 @@ dxf_vertex_get_y0
                 /*!< a pointer to a DXF \c VERTEX entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2518,7 +2532,7 @@ dxf_vertex_set_y0
                  * \c VERTEX entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2557,7 +2571,7 @@ dxf_vertex_get_z0
                 /*!< a pointer to a DXF \c VERTEX entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2600,7 +2614,7 @@ dxf_vertex_set_z0
                  * \c VERTEX entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
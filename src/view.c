@@ -62,7 +62,7 @@ dxf_view_new ()
         size = sizeof (DxfView);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((view = malloc (size)) == NULL)
+        if ((view = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfView struct.\n")),
@@ -100,20 +100,20 @@ dxf_view_init
         /* Do some basic checks. */
         if (view == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 view = dxf_view_new ();
         }
         if (view == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfView struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         view->id_code = 0;
-        view->name = strdup ("");
+        view->name = dxf_strdup ("");
         view->p0 = dxf_point_new ();
         view->p0 = dxf_point_init (view->p0);
         view->p0->x0 = 0.0;
@@ -136,8 +136,8 @@ dxf_view_init
         view->twist_angle = 0.0;
         view->flag = 0;
         view->mode = 0;
-        view->dictionary_owner_soft = strdup ("");
-        view->dictionary_owner_hard = strdup ("");
+        view->dictionary_owner_soft = dxf_strdup ("");
+        view->dictionary_owner_hard = dxf_strdup ("");
         view->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -174,16 +174,16 @@ dxf_view_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (view == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 view = dxf_view_init (view);
@@ -194,12 +194,12 @@ dxf_view_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -341,7 +341,7 @@ dxf_view_read
                         if ((strcmp (temp_string, "AcDbSymbolTableRecord") != 0)
                         && ((strcmp (temp_string, "AcDbViewTableRecord") != 0)))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -369,13 +369,14 @@ dxf_view_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -401,38 +402,38 @@ dxf_view_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("VIEW");
+        char *dxf_entity_name = dxf_strdup ("VIEW");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (view == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((view->name == NULL)
           || (strcmp (view->name, "") == 0))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty UCS name string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, view->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is discarded from output.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
@@ -488,7 +489,7 @@ dxf_view_write
         fprintf (fp->fp, " 50\n%f\n", view->twist_angle);
         fprintf (fp->fp, " 71\n%d\n", view->mode);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -516,22 +517,22 @@ dxf_view_free
         /* Do some basic checks. */
         if (view == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (view->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (view->name);
-        free (view->dictionary_owner_soft);
-        free (view->dictionary_owner_hard);
-        free (view);
+        dxf_free (view->name);
+        dxf_free (view->dictionary_owner_soft);
+        dxf_free (view->dictionary_owner_hard);
+        dxf_free (view);
         view = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -552,18 +553,19 @@ dxf_view_free_list
                  * symbol table entries. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (views == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (views != NULL)
         {
                 DxfView *iter = (DxfView *) views->next;
+                views->next = NULL;
                 dxf_view_free (views);
                 views = (DxfView *) iter;
         }
@@ -681,7 +683,7 @@ dxf_view_get_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (view->name));
+        return (dxf_strdup (view->name));
 }
 
 
@@ -716,7 +718,7 @@ dxf_view_set_name
                   __FUNCTION__);
                 return (NULL);
         }
-        view->name = strdup (name);
+        view->name = dxf_strdup (name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -737,7 +739,7 @@ dxf_view_get_p0
                 /*!< a pointer to a DXF \c VIEW symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -777,7 +779,7 @@ dxf_view_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -816,7 +818,7 @@ dxf_view_get_x0
                 /*!< a pointer to a DXF \c VIEW symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -859,7 +861,7 @@ dxf_view_set_x0
                  * \c VIEW symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -898,7 +900,7 @@ dxf_view_get_y0
                 /*!< a pointer to a DXF \c VIEW symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -941,7 +943,7 @@ dxf_view_set_y0
                  * \c VIEW symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -980,7 +982,7 @@ dxf_view_get_p1
                 /*!< a pointer to a DXF \c VIEW symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1020,7 +1022,7 @@ dxf_view_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1059,7 +1061,7 @@ dxf_view_get_x1
                 /*!< a pointer to a DXF \c VIEW symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1102,7 +1104,7 @@ dxf_view_set_x1
                  * \c x1 of a DXF \c VIEW symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1141,7 +1143,7 @@ dxf_view_get_y1
                 /*!< a pointer to a DXF \c VIEW symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1184,7 +1186,7 @@ dxf_view_set_y1
                  * \c y1 of a DXF \c VIEW symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1223,7 +1225,7 @@ dxf_view_get_z1
                 /*!< a pointer to a DXF \c VIEW symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1266,7 +1268,7 @@ dxf_view_set_z1
                  * \c z1 of a DXF \c VIEW symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1305,7 +1307,7 @@ dxf_view_get_p2
                 /*!< a pointer to a DXF \c VIEW symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1345,7 +1347,7 @@ dxf_view_set_p2
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1384,7 +1386,7 @@ dxf_view_get_x2
                 /*!< a pointer to a DXF \c VIEW symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1427,7 +1429,7 @@ dxf_view_set_x2
                  * \c VIEW symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1466,7 +1468,7 @@ dxf_view_get_y2
                 /*!< a pointer to a DXF \c VIEW symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1509,7 +1511,7 @@ dxf_view_set_y2
                  * \c VIEW symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1548,7 +1550,7 @@ dxf_view_get_z2
                 /*!< a pointer to a DXF \c VIEW symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1591,7 +1593,7 @@ dxf_view_set_z2
                  * \c VIEW symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1629,7 +1631,7 @@ dxf_view_get_height
                 /*!< a pointer to a DXF \c VIEW symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1664,7 +1666,7 @@ dxf_view_set_height
                  * entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1695,7 +1697,7 @@ dxf_view_get_width
                 /*!< a pointer to a DXF \c VIEW symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1730,7 +1732,7 @@ dxf_view_set_width
                  * entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1761,7 +1763,7 @@ dxf_view_get_lens_length
                 /*!< a pointer to a DXF \c VIEW symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1796,7 +1798,7 @@ dxf_view_set_lens_length
                  * entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1828,7 +1830,7 @@ dxf_view_get_front_plane_offset
                 /*!< a pointer to a DXF \c VIEW symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1864,7 +1866,7 @@ dxf_view_set_front_plane_offset
                  * table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1896,7 +1898,7 @@ dxf_view_get_back_plane_offset
                 /*!< a pointer to a DXF \c VIEW symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1932,7 +1934,7 @@ dxf_view_set_back_plane_offset
                  * table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1964,7 +1966,7 @@ dxf_view_get_twist_angle
                 /*!< a pointer to a DXF \c VIEW symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2000,7 +2002,7 @@ dxf_view_set_twist_angle
                  * table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2201,7 +2203,7 @@ dxf_view_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (view->dictionary_owner_soft));
+        return (dxf_strdup (view->dictionary_owner_soft));
 }
 
 
@@ -2237,7 +2239,7 @@ dxf_view_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        view->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        view->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2281,7 +2283,7 @@ dxf_view_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (view->dictionary_owner_hard));
+        return (dxf_strdup (view->dictionary_owner_hard));
 }
 
 
@@ -2317,7 +2319,7 @@ dxf_view_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        view->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        view->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -59,7 +59,7 @@ dxf_viewport_new ()
         size = sizeof (DxfViewport);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((viewport = malloc (size)) == NULL)
+        if ((viewport = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfViewport struct.\n")),
@@ -97,21 +97,21 @@ dxf_viewport_init
         /* Do some basic checks. */
         if (viewport == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 viewport = dxf_viewport_new ();
         }
         if (viewport == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfViewport struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         viewport->id_code = 0;
-        viewport->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        viewport->layer = strdup (DXF_DEFAULT_LAYER);
+        viewport->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        viewport->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         viewport->center = dxf_point_new ();
         viewport->center = dxf_point_init (viewport->center);
         viewport->center->x0 = 0.0;
@@ -127,9 +127,9 @@ dxf_viewport_init
         viewport->id = 1; /* Always 1. */
         viewport->color = DXF_COLOR_BYLAYER;
         viewport->paperspace = DXF_PAPERSPACE; /* Always on PAPERSPACE. */
-        viewport->app_name = strdup ("ACAD"); /* Always "ACAD". */
-        viewport->viewport_data = strdup ("MVIEW"); /* Always "MVIEW". */
-        viewport->window_descriptor_begin = strdup ("{"); /* Always "{". */
+        viewport->app_name = dxf_strdup ("ACAD"); /* Always "ACAD". */
+        viewport->viewport_data = dxf_strdup ("MVIEW"); /* Always "MVIEW". */
+        viewport->window_descriptor_begin = dxf_strdup ("{"); /* Always "{". */
         viewport->extended_entity_data_version = 16;
         viewport->target = dxf_point_new ();
         viewport->target = dxf_point_init (viewport->target);
@@ -172,16 +172,16 @@ dxf_viewport_init
         viewport->grid_spacing->x0 = 0.0;
         viewport->grid_spacing->y0 = 0.0;
         viewport->plot_flag = 0;
-        viewport->frozen_layer_list_begin = strdup ("{"); /* Always "{". */
+        viewport->frozen_layer_list_begin = dxf_strdup ("{"); /* Always "{". */
         viewport->frozen_layers = dxf_char_new ();
         viewport->frozen_layers = dxf_char_init (viewport->frozen_layers);
-        viewport->frozen_layers->value = strdup ("");
+        viewport->frozen_layers->value = dxf_strdup ("");
         viewport->frozen_layers->length = 0;
         viewport->frozen_layers->next = NULL;
-        viewport->frozen_layer_list_end = strdup ("}"); /* Always "}". */
-        viewport->window_descriptor_end = strdup ("}"); /* Always "}". */
-        viewport->dictionary_owner_soft = strdup ("");
-        viewport->dictionary_owner_hard = strdup ("");
+        viewport->frozen_layer_list_end = dxf_strdup ("}"); /* Always "}". */
+        viewport->window_descriptor_end = dxf_strdup ("}"); /* Always "}". */
+        viewport->dictionary_owner_soft = dxf_strdup ("");
+        viewport->dictionary_owner_hard = dxf_strdup ("");
         viewport->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -220,16 +220,16 @@ dxf_viewport_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (viewport == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 viewport = dxf_viewport_init (viewport);
@@ -240,12 +240,12 @@ dxf_viewport_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -379,10 +379,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->app_name);
                         if (strcmp (viewport->app_name, "ACAD") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string followed after group code 1001.\n")));
                                 return (NULL);
                         }
@@ -391,10 +391,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1000") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -404,10 +404,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->viewport_data);
                         if (strcmp (viewport->viewport_data, "MVIEW") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string.\n")));
                                 return (NULL);
                         }
@@ -416,10 +416,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1002") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -429,10 +429,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->window_descriptor_begin);
                         if (strcmp (viewport->window_descriptor_begin, "{") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr, "    unexpected content in string.\n");
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE, "    unexpected content in string.\n");
                                 return (NULL);
                         }
                         /* Now follows a string containing a group code. */
@@ -440,10 +440,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1070") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -456,10 +456,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1010") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -471,10 +471,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1020") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -486,10 +486,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1030") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -501,10 +501,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1010") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -516,10 +516,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1020") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -531,10 +531,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1030") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -546,10 +546,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1040") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -562,10 +562,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1040") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -578,10 +578,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1040") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -594,10 +594,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1040") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -610,10 +610,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1040") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -626,10 +626,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1040") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -642,10 +642,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1040") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -658,10 +658,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1070") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -673,10 +673,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1070") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -689,10 +689,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1070") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -705,10 +705,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1070") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -721,10 +721,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1070") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -737,10 +737,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1070") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -753,10 +753,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1070") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -769,10 +769,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1070") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -785,10 +785,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1040") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -801,10 +801,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1040") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -817,10 +817,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1040") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -833,10 +833,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1040") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -849,10 +849,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1040") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -865,10 +865,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1070") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -880,10 +880,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1002") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -893,10 +893,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->frozen_layer_list_begin);
                         if (strcmp (viewport->frozen_layer_list_begin, "{") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string.\n")));
                                 return (NULL);
                         }
@@ -933,10 +933,10 @@ dxf_viewport_read
                         {
                                 /* Either we found an empty list or we
                                  * have found an exception. */
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected end of frozen layer list found.\n")));
                                 return (NULL);
                         }
@@ -944,10 +944,10 @@ dxf_viewport_read
                          * group code value of "1002". */
                         if (strcmp (temp_string, "1002") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -957,10 +957,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->frozen_layer_list_end);
                         if (strcmp (viewport->frozen_layer_list_end, "}") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string.\n")));
                                 return (NULL);
                         }
@@ -969,10 +969,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "1002") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -982,10 +982,10 @@ dxf_viewport_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->window_descriptor_end);
                         if (strcmp (viewport->window_descriptor_end, "}") == 1)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                                   (_("\tunexpected content in string.\n")));
                                 return (NULL);
                         }
@@ -993,22 +993,23 @@ dxf_viewport_read
                 /* End of sequential ordered data fields. */
                 else 
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (viewport->linetype, "") == 0)
         {
-                viewport->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                viewport->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (viewport->layer, "") == 0)
         {
-                viewport->layer = strdup (DXF_DEFAULT_LAYER);
+                viewport->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1034,47 +1035,47 @@ dxf_viewport_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("VIEWPORT");
+        char *dxf_entity_name = dxf_strdup ("VIEWPORT");
         DxfChar *iter = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (viewport == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (viewport->linetype, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, viewport->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                viewport->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                viewport->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (viewport->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, viewport->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is relocated to default layer.\n")),
                   dxf_entity_name);
-                viewport->layer = strdup (DXF_DEFAULT_LAYER);
+                viewport->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -1201,7 +1202,7 @@ dxf_viewport_write
         fprintf (fp->fp, "1002\n%s\n", DXF_VIEWPORT_FROZEN_LAYER_LIST_END);
         fprintf (fp->fp, "1002\n%s\n", DXF_VIEWPORT_WINDOW_END);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1230,28 +1231,28 @@ dxf_viewport_free
         /* Do some basic checks. */
         if (viewport == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (viewport->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (viewport->linetype);
-        free (viewport->layer);
-        free (viewport->app_name);
-        free (viewport->viewport_data);
-        free (viewport->window_descriptor_begin);
-        free (viewport->frozen_layer_list_begin);
+        dxf_free (viewport->linetype);
+        dxf_free (viewport->layer);
+        dxf_free (viewport->app_name);
+        dxf_free (viewport->viewport_data);
+        dxf_free (viewport->window_descriptor_begin);
+        dxf_free (viewport->frozen_layer_list_begin);
         dxf_char_free_list (viewport->frozen_layers);
-        free (viewport->frozen_layer_list_end);
-        free (viewport->window_descriptor_end);
-        free (viewport);
+        dxf_free (viewport->frozen_layer_list_end);
+        dxf_free (viewport->window_descriptor_end);
+        dxf_free (viewport);
         viewport = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -1272,18 +1273,19 @@ dxf_viewport_free_list
                  * \c VIEWPORT entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (viewports == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (viewports != NULL)
         {
                 DxfViewport *iter = (DxfViewport *) viewports->next;
+                viewports->next = NULL;
                 dxf_viewport_free (viewports);
                 viewports = (DxfViewport *) iter;
         }
@@ -1401,7 +1403,7 @@ dxf_viewport_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->linetype));
+        return (dxf_strdup (viewport->linetype));
 }
 
 
@@ -1436,7 +1438,7 @@ dxf_viewport_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->linetype = strdup (linetype);
+        viewport->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1477,7 +1479,7 @@ dxf_viewport_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->layer));
+        return (dxf_strdup (viewport->layer));
 }
 
 
@@ -1512,7 +1514,7 @@ dxf_viewport_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->layer = strdup (layer);
+        viewport->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2282,7 +2284,7 @@ dxf_viewport_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->dictionary_owner_soft));
+        return (dxf_strdup (viewport->dictionary_owner_soft));
 }
 
 
@@ -2318,7 +2320,7 @@ dxf_viewport_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        viewport->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2363,7 +2365,7 @@ dxf_viewport_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->material));
+        return (dxf_strdup (viewport->material));
 }
 
 
@@ -2402,7 +2404,7 @@ dxf_viewport_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->material = strdup (material);
+        viewport->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2446,7 +2448,7 @@ dxf_viewport_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->dictionary_owner_hard));
+        return (dxf_strdup (viewport->dictionary_owner_hard));
 }
 
 
@@ -2482,7 +2484,7 @@ dxf_viewport_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        viewport->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2589,7 +2591,7 @@ dxf_viewport_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->plot_style_name));
+        return (dxf_strdup (viewport->plot_style_name));
 }
 
 
@@ -2627,7 +2629,7 @@ dxf_viewport_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->plot_style_name = strdup (plot_style_name);
+        viewport->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2734,7 +2736,7 @@ dxf_viewport_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->color_name));
+        return (dxf_strdup (viewport->color_name));
 }
 
 
@@ -2772,7 +2774,7 @@ dxf_viewport_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->color_name = strdup (color_name);
+        viewport->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2858,7 +2860,7 @@ dxf_viewport_get_center
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2897,7 +2899,7 @@ dxf_viewport_set_center
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2936,7 +2938,7 @@ dxf_viewport_get_center_x
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2979,7 +2981,7 @@ dxf_viewport_set_center_x
                  * \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3018,7 +3020,7 @@ dxf_viewport_get_center_y
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3061,7 +3063,7 @@ dxf_viewport_set_center_y
                  * \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3100,7 +3102,7 @@ dxf_viewport_get_center_z
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3143,7 +3145,7 @@ dxf_viewport_set_center_z
                  * \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3447,7 +3449,7 @@ dxf_viewport_get_app_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->app_name));
+        return (dxf_strdup (viewport->app_name));
 }
 
 
@@ -3485,7 +3487,7 @@ dxf_viewport_set_app_name
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->app_name = strdup (app_name);
+        viewport->app_name = dxf_strdup (app_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3527,7 +3529,7 @@ dxf_viewport_get_viewport_data
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->viewport_data));
+        return (dxf_strdup (viewport->viewport_data));
 }
 
 
@@ -3565,7 +3567,7 @@ dxf_viewport_set_viewport_data
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->viewport_data = strdup (viewport_data);
+        viewport->viewport_data = dxf_strdup (viewport_data);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3608,7 +3610,7 @@ dxf_viewport_get_window_descriptor_begin
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->window_descriptor_begin));
+        return (dxf_strdup (viewport->window_descriptor_begin));
 }
 
 
@@ -3647,7 +3649,7 @@ dxf_viewport_set_window_descriptor_begin
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->window_descriptor_begin = strdup (window_descriptor_begin);
+        viewport->window_descriptor_begin = dxf_strdup (window_descriptor_begin);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3730,7 +3732,7 @@ dxf_viewport_get_target
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3769,7 +3771,7 @@ dxf_viewport_set_target
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3808,7 +3810,7 @@ dxf_viewport_get_target_x
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3851,7 +3853,7 @@ dxf_viewport_set_target_x
                  * \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3890,7 +3892,7 @@ dxf_viewport_get_target_y
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3933,7 +3935,7 @@ dxf_viewport_set_target_y
                  * \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3972,7 +3974,7 @@ dxf_viewport_get_target_z
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4015,7 +4017,7 @@ dxf_viewport_set_target_z
                  * \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4054,7 +4056,7 @@ dxf_viewport_get_direction
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4094,7 +4096,7 @@ dxf_viewport_set_direction
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4133,7 +4135,7 @@ dxf_viewport_get_direction_x
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4176,7 +4178,7 @@ dxf_viewport_set_direction_x
                  * \c direction_x of a DXF \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4215,7 +4217,7 @@ dxf_viewport_get_direction_y
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4258,7 +4260,7 @@ dxf_viewport_set_direction_y
                  * \c direction_y of a DXF \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4297,7 +4299,7 @@ dxf_viewport_get_direction_z
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4340,7 +4342,7 @@ dxf_viewport_set_direction_z
                  * \c direction_z of a DXF \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4501,7 +4503,7 @@ dxf_viewport_get_view_center
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4541,7 +4543,7 @@ dxf_viewport_set_view_center
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4580,7 +4582,7 @@ dxf_viewport_get_view_center_x
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4623,7 +4625,7 @@ dxf_viewport_set_view_center_x
                  * \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4662,7 +4664,7 @@ dxf_viewport_get_view_center_y
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -4705,7 +4707,7 @@ dxf_viewport_set_view_center_y
                  * \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5478,7 +5480,7 @@ dxf_viewport_get_snap_base
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5518,7 +5520,7 @@ dxf_viewport_set_snap_base
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5557,7 +5559,7 @@ dxf_viewport_get_snap_base_x
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -5600,7 +5602,7 @@ dxf_viewport_set_snap_base_x
                  * \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5639,7 +5641,7 @@ dxf_viewport_get_snap_base_y
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -5682,7 +5684,7 @@ dxf_viewport_set_snap_base_y
                  * \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5720,7 +5722,7 @@ dxf_viewport_get_snap_spacing
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5760,7 +5762,7 @@ dxf_viewport_set_snap_spacing
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5799,7 +5801,7 @@ dxf_viewport_get_snap_spacing_x
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -5842,7 +5844,7 @@ dxf_viewport_set_snap_spacing_x
                  * \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5881,7 +5883,7 @@ dxf_viewport_get_snap_spacing_y
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -5924,7 +5926,7 @@ dxf_viewport_set_snap_spacing_y
                  * \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -5962,7 +5964,7 @@ dxf_viewport_get_grid_spacing
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6002,7 +6004,7 @@ dxf_viewport_set_grid_spacing
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6041,7 +6043,7 @@ dxf_viewport_get_grid_spacing_x
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -6084,7 +6086,7 @@ dxf_viewport_set_grid_spacing_x
                  * \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6123,7 +6125,7 @@ dxf_viewport_get_grid_spacing_y
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -6166,7 +6168,7 @@ dxf_viewport_set_grid_spacing_y
                  * \c VIEWPORT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -6288,7 +6290,7 @@ dxf_viewport_get_frozen_layer_list_begin
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->frozen_layer_list_begin));
+        return (dxf_strdup (viewport->frozen_layer_list_begin));
 }
 
 
@@ -6324,7 +6326,7 @@ dxf_viewport_set_frozen_layer_list_begin
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->frozen_layer_list_begin = strdup (frozen_layer_list_begin);
+        viewport->frozen_layer_list_begin = dxf_strdup (frozen_layer_list_begin);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -6444,7 +6446,7 @@ dxf_viewport_get_frozen_layer_list_end
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->frozen_layer_list_end));
+        return (dxf_strdup (viewport->frozen_layer_list_end));
 }
 
 
@@ -6480,7 +6482,7 @@ dxf_viewport_set_frozen_layer_list_end
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->frozen_layer_list_end = strdup (frozen_layer_list_end);
+        viewport->frozen_layer_list_end = dxf_strdup (frozen_layer_list_end);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -6523,7 +6525,7 @@ dxf_viewport_get_window_descriptor_end
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->window_descriptor_end));
+        return (dxf_strdup (viewport->window_descriptor_end));
 }
 
 
@@ -6559,7 +6561,7 @@ dxf_viewport_set_window_descriptor_end
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->window_descriptor_end = strdup (window_descriptor_end);
+        viewport->window_descriptor_end = dxf_strdup (window_descriptor_end);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -65,7 +65,7 @@ dxf_vport_new ()
         size = sizeof (DxfVPort);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((vport = malloc (size)) == NULL)
+        if ((vport = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfVPort struct.\n")),
@@ -103,20 +103,20 @@ dxf_vport_init
         /* Do some basic checks. */
         if (vport == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 vport = dxf_vport_new ();
         }
         if (vport == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfVPort struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         vport->id_code = 0;
-        vport->viewport_name = strdup ("");
+        vport->viewport_name = dxf_strdup ("");
         vport->min = dxf_point_new ();
         vport->min = dxf_point_init (vport->min);
         vport->min->x0 = 0.0;
@@ -169,8 +169,8 @@ dxf_vport_init
         vport->grid_on = 0;
         vport->snap_style = 0;
         vport->snap_isopair = 0;
-        vport->dictionary_owner_soft = strdup ("");
-        vport->dictionary_owner_hard = strdup ("");
+        vport->dictionary_owner_soft = dxf_strdup ("");
+        vport->dictionary_owner_hard = dxf_strdup ("");
         vport->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -208,72 +208,72 @@ dxf_vport_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (vport == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 vport = dxf_vport_init (vport);
         }
         if (vport->min == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 vport->min = dxf_point_init (vport->min);
         }
         if (vport->max == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 vport->max = dxf_point_init (vport->max);
         }
         if (vport->center == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 vport->center = dxf_point_init (vport->center);
         }
         if (vport->snap_base == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 vport->snap_base = dxf_point_init (vport->snap_base);
         }
         if (vport->snap_spacing == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 vport->snap_spacing = dxf_point_init (vport->snap_spacing);
         }
         if (vport->grid_spacing == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 vport->grid_spacing = dxf_point_init (vport->grid_spacing);
         }
         if (vport->direction == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 vport->direction = dxf_point_init (vport->direction);
         }
         if (vport->target == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 vport->target = dxf_point_new ();
@@ -285,12 +285,12 @@ dxf_vport_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -586,13 +586,13 @@ dxf_vport_read
         if ((strcmp (vport->viewport_name, "") == 0)
           || (vport->viewport_name == NULL))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty string in viewport name found while reading from: %s in line: %d.\n")),
                   __FUNCTION__, fp->filename, fp->line_number);
                 return (NULL);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -616,110 +616,110 @@ dxf_vport_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("VPORT");
+        char *dxf_entity_name = dxf_strdup ("VPORT");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (vport == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((vport->viewport_name == NULL)
           || (strcmp (vport->viewport_name, "") == 0))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error: empty viewport name string for the %s entity with id-code: %x\n")),
                   dxf_entity_name, vport->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("\t%s entity is discarded from output.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (vport->min == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (vport->max == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (vport->center == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (vport->snap_base == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (vport->snap_spacing == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (vport->grid_spacing == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (vport->direction == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (vport->target == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
@@ -795,7 +795,7 @@ dxf_vport_write
         fprintf (fp->fp, " 77\n%d\n", vport->snap_style);
         fprintf (fp->fp, " 78\n%d\n", vport->snap_isopair);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -824,19 +824,19 @@ dxf_vport_free
         /* Do some basic checks. */
         if (vport == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (vport->next != NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (vport->viewport_name);
+        dxf_free (vport->viewport_name);
         dxf_point_free (vport->min);
         dxf_point_free (vport->max);
         dxf_point_free (vport->center);
@@ -845,9 +845,9 @@ dxf_vport_free
         dxf_point_free (vport->grid_spacing);
         dxf_point_free (vport->direction);
         dxf_point_free (vport->target);
-        free (vport->dictionary_owner_soft);
-        free (vport->dictionary_owner_hard);
-        free (vport);
+        dxf_free (vport->dictionary_owner_soft);
+        dxf_free (vport->dictionary_owner_hard);
+        dxf_free (vport);
         vport = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -868,18 +868,19 @@ dxf_vport_free_list
                  * symbol table entries. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (vports == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (vports != NULL)
         {
                 DxfVPort *iter = (DxfVPort *) vports->next;
+                vports->next = NULL;
                 dxf_vport_free (vports);
                 vports = (DxfVPort *) iter;
         }
@@ -997,7 +998,7 @@ dxf_vport_get_viewport_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (vport->viewport_name));
+        return (dxf_strdup (vport->viewport_name));
 }
 
 
@@ -1032,7 +1033,7 @@ dxf_vport_set_viewport_name
                   __FUNCTION__);
                 return (NULL);
         }
-        vport->viewport_name = strdup (viewport_name);
+        vport->viewport_name = dxf_strdup (viewport_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1053,7 +1054,7 @@ dxf_vport_get_min
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1093,7 +1094,7 @@ dxf_vport_set_min
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1132,7 +1133,7 @@ dxf_vport_get_min_x
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1175,7 +1176,7 @@ dxf_vport_set_min_x
                  * DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1214,7 +1215,7 @@ dxf_vport_get_min_y
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1257,7 +1258,7 @@ dxf_vport_set_min_y
                  * DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1296,7 +1297,7 @@ dxf_vport_get_max
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1336,7 +1337,7 @@ dxf_vport_set_max
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1375,7 +1376,7 @@ dxf_vport_get_max_x
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1418,7 +1419,7 @@ dxf_vport_set_max_x
                  * DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1457,7 +1458,7 @@ dxf_vport_get_max_y
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1500,7 +1501,7 @@ dxf_vport_set_max_y
                  * DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1539,7 +1540,7 @@ dxf_vport_get_center
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1579,7 +1580,7 @@ dxf_vport_set_center
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1619,7 +1620,7 @@ dxf_vport_get_center_x
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1663,7 +1664,7 @@ dxf_vport_set_center_x
                  * symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1703,7 +1704,7 @@ dxf_vport_get_center_y
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1747,7 +1748,7 @@ dxf_vport_set_center_y
                  * symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1786,7 +1787,7 @@ dxf_vport_get_snap_base
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1826,7 +1827,7 @@ dxf_vport_set_snap_base
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1865,7 +1866,7 @@ dxf_vport_get_snap_base_x
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1908,7 +1909,7 @@ dxf_vport_set_snap_base_x
                  * of a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -1947,7 +1948,7 @@ dxf_vport_get_snap_base_y
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -1990,7 +1991,7 @@ dxf_vport_set_snap_base_y
                  * of a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2029,7 +2030,7 @@ dxf_vport_get_snap_spacing
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2069,7 +2070,7 @@ dxf_vport_set_snap_spacing
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2108,7 +2109,7 @@ dxf_vport_get_snap_spacing_x
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2151,7 +2152,7 @@ dxf_vport_set_snap_spacing_x
                  * of a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2190,7 +2191,7 @@ dxf_vport_get_snap_spacing_y
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2233,7 +2234,7 @@ dxf_vport_set_snap_spacing_y
                  * of a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2272,7 +2273,7 @@ dxf_vport_get_grid_spacing
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2312,7 +2313,7 @@ dxf_vport_set_grid_spacing
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2351,7 +2352,7 @@ dxf_vport_get_grid_spacing_x
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2394,7 +2395,7 @@ dxf_vport_set_grid_spacing_x
                  * of a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2433,7 +2434,7 @@ dxf_vport_get_grid_spacing_y
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2476,7 +2477,7 @@ dxf_vport_set_grid_spacing_y
                  * of a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2515,7 +2516,7 @@ dxf_vport_get_direction
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2555,7 +2556,7 @@ dxf_vport_set_direction
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2595,7 +2596,7 @@ dxf_vport_get_direction_x
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2638,7 +2639,7 @@ dxf_vport_set_direction_x
                  * \c direction_x of a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2678,7 +2679,7 @@ dxf_vport_get_direction_y
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2721,7 +2722,7 @@ dxf_vport_set_direction_y
                  * \c direction_y of a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2761,7 +2762,7 @@ dxf_vport_get_direction_z
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2804,7 +2805,7 @@ dxf_vport_set_direction_z
                  * \c direction_z of a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2843,7 +2844,7 @@ dxf_vport_get_target
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2883,7 +2884,7 @@ dxf_vport_set_target
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2922,7 +2923,7 @@ dxf_vport_get_target_x
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2965,7 +2966,7 @@ dxf_vport_set_target_x
                  * DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3004,7 +3005,7 @@ dxf_vport_get_target_y
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3047,7 +3048,7 @@ dxf_vport_set_target_y
                  * DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3086,7 +3087,7 @@ dxf_vport_get_target_z
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3129,7 +3130,7 @@ dxf_vport_set_target_z
                  * DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3168,7 +3169,7 @@ dxf_vport_get_view_height
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3204,7 +3205,7 @@ dxf_vport_set_view_height
                  * symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3236,7 +3237,7 @@ dxf_vport_get_viewport_aspect_ratio
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3272,7 +3273,7 @@ dxf_vport_set_viewport_aspect_ratio
                  * of a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3304,7 +3305,7 @@ dxf_vport_get_lens_length
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3340,7 +3341,7 @@ dxf_vport_set_lens_length
                  * symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3372,7 +3373,7 @@ dxf_vport_get_front_plane_offset
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3408,7 +3409,7 @@ dxf_vport_set_front_plane_offset
                  * DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3440,7 +3441,7 @@ dxf_vport_get_back_plane_offset
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3476,7 +3477,7 @@ dxf_vport_set_back_plane_offset
                  * DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3508,7 +3509,7 @@ dxf_vport_get_snap_rotation_angle
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3544,7 +3545,7 @@ dxf_vport_set_snap_rotation_angle
                  * DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -3576,7 +3577,7 @@ dxf_vport_get_view_twist_angle
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -3612,7 +3613,7 @@ dxf_vport_set_view_twist_angle
                  * DXF \c VPORT symbol table entry. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -4464,7 +4465,7 @@ dxf_vport_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (vport->dictionary_owner_soft));
+        return (dxf_strdup (vport->dictionary_owner_soft));
 }
 
 
@@ -4500,7 +4501,7 @@ dxf_vport_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        vport->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        vport->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4544,7 +4545,7 @@ dxf_vport_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (vport->dictionary_owner_hard));
+        return (dxf_strdup (vport->dictionary_owner_hard));
 }
 
 
@@ -4580,7 +4581,7 @@ dxf_vport_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        vport->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        vport->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
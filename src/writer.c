@@ -0,0 +1,1143 @@
+/*!
+ * \file writer.c
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for a libDXF streaming writer.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "writer.h"
+#include "endsec.h"
+#include "file.h"
+#include "section.h"
+
+
+/*!
+ * \brief Names of the sections of a DXF file, in the order in which
+ * they appear in the file.
+ */
+static const char *dxf_writer_section_names[] =
+{
+        "HEADER",
+        "CLASSES",
+        "TABLES",
+        "BLOCKS",
+        "ENTITIES",
+        "OBJECTS",
+        "THUMBNAILIMAGE"
+};
+
+
+#define DXF_WRITER_NUMBER_OF_SECTIONS \
+        (int) (sizeof (dxf_writer_section_names) / sizeof (dxf_writer_section_names[0]))
+
+
+enum dxf_writer_section
+{
+        DXF_WRITER_HEADER,
+        DXF_WRITER_CLASSES,
+        DXF_WRITER_TABLES,
+        DXF_WRITER_BLOCKS,
+        DXF_WRITER_ENTITIES,
+        DXF_WRITER_OBJECTS,
+        DXF_WRITER_THUMBNAILIMAGE
+};
+
+
+/*!
+ * \brief Allocate memory for a libDXF streaming writer.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfWriter *
+dxf_writer_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfWriter *writer = NULL;
+        size_t size;
+
+        size = sizeof (DxfWriter);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((writer = dxf_malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                writer = NULL;
+        }
+        else
+        {
+                memset (writer, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (writer);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a libDXF
+ * streaming writer.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfWriter *
+dxf_writer_init
+(
+        DxfWriter *writer
+                /*!< a pointer to a libDXF streaming writer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (writer == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                writer = dxf_writer_new ();
+        }
+        if (writer == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        writer->fp = NULL;
+        writer->close_fp = FALSE;
+        writer->section = -1;
+        writer->last_section = -1;
+        writer->in_table = FALSE;
+        writer->block = NULL;
+        writer->handseed_start = -1;
+        writer->handseed_end = -1;
+        writer->number_of_entities = 0;
+        writer->compressed_fp = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (writer);
+}
+
+
+/*!
+ * \brief Open a libDXF streaming writer on an already opened output
+ * stream.
+ *
+ * The stream is not closed by the writer.\n
+ * The \c $HANDSEED header variable can only be fixed up when the
+ * stream is seekable and opened for both reading and writing.
+ *
+ * \return a pointer to the writer, or \c NULL when an error occurred.
+ */
+DxfWriter *
+dxf_writer_open_file
+(
+        FILE *fp,
+                /*!< output stream. */
+        int acad_version_number
+                /*!< AutoCAD version number of the output. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfWriter *writer = NULL;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        writer = dxf_writer_init (dxf_writer_new ());
+        if (writer == NULL)
+        {
+                return (NULL);
+        }
+        writer->fp = dxf_malloc (sizeof (DxfFile));
+        if (writer->fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_free (writer);
+                return (NULL);
+        }
+        memset (writer->fp, 0, sizeof (DxfFile));
+        writer->fp->fp = fp;
+        writer->fp->acad_version_number = acad_version_number;
+        writer->fp->follow_strict_version_rules = FALSE;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (writer);
+}
+
+
+/*!
+ * \brief Create the file \c filename and open a libDXF streaming writer
+ * on it.
+ *
+ * The file is opened in binary mode for both reading and writing, so
+ * the \c $HANDSEED header variable can be fixed up when the writer is
+ * closed.
+ *
+ * \return a pointer to the writer, or \c NULL when an error occurred.
+ */
+DxfWriter *
+dxf_writer_open
+(
+        char *filename,
+                /*!< filename of the output file. */
+        int acad_version_number
+                /*!< AutoCAD version number of the output. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfWriter *writer = NULL;
+        FILE *fp = NULL;
+
+        /* Do some basic checks. */
+        if (filename == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        fp = fopen (filename, "w+b");
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not open file: %s for writing.\n")),
+                  __FUNCTION__, filename);
+                return (NULL);
+        }
+        writer = dxf_writer_open_file (fp, acad_version_number);
+        if (writer == NULL)
+        {
+                fclose (fp);
+                return (NULL);
+        }
+        writer->close_fp = TRUE;
+        writer->fp->filename = dxf_strdup (filename);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (writer);
+}
+
+
+/*!
+ * \brief Create the file \c filename and open a libDXF streaming writer
+ * compressing its output.
+ *
+ * The output is staged in a temporary file, so the \c $HANDSEED header
+ * variable can be fixed up, and is compressed into \c filename when the
+ * writer is closed.
+ *
+ * \return a pointer to the writer, or \c NULL when an error occurred.
+ */
+DxfWriter *
+dxf_writer_open_compressed
+(
+        char *filename,
+                /*!< filename of the output file. */
+        int acad_version_number,
+                /*!< AutoCAD version number of the output. */
+        DxfCompression compression,
+                /*!< compression format of the output file. */
+        int level
+                /*!< compression level, 0 for the default level of the
+                 * format. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfWriter *writer = NULL;
+        FILE *fp = NULL;
+        FILE *compressed_fp = NULL;
+
+        /* Do some basic checks. */
+        if (filename == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (compression == DXF_COMPRESSION_NONE)
+        {
+                return (dxf_writer_open (filename, acad_version_number));
+        }
+        fp = fopen (filename, "wb");
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not open file: %s for writing.\n")),
+                  __FUNCTION__, filename);
+                return (NULL);
+        }
+        compressed_fp = dxf_compress_open_write (fp, compression, level);
+        if (compressed_fp == NULL)
+        {
+                fclose (fp);
+                return (NULL);
+        }
+        fp = tmpfile ();
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not create a temporary file.\n")),
+                  __FUNCTION__);
+                fclose (compressed_fp);
+                return (NULL);
+        }
+        writer = dxf_writer_open_file (fp, acad_version_number);
+        if (writer == NULL)
+        {
+                fclose (fp);
+                fclose (compressed_fp);
+                return (NULL);
+        }
+        writer->close_fp = TRUE;
+        writer->compressed_fp = compressed_fp;
+        writer->fp->filename = dxf_strdup (filename);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (writer);
+}
+
+
+/*!
+ * \brief Get the DXF file pointer of a libDXF streaming writer.
+ *
+ * The file pointer can be passed to the \c dxf_*_write () functions to
+ * write data the writer has no dedicated function for, like symbol
+ * table entries.
+ *
+ * \return a pointer to the DXF file, or \c NULL when an error occurred.
+ */
+DxfFile *
+dxf_writer_get_file
+(
+        DxfWriter *writer
+                /*!< a pointer to a libDXF streaming writer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (writer == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (writer->fp);
+}
+
+
+/*!
+ * \brief Allocate a new handle from a libDXF streaming writer.
+ *
+ * \return the new handle, or -1 when an error occurred.
+ */
+int
+dxf_writer_new_handle
+(
+        DxfWriter *writer
+                /*!< a pointer to a libDXF streaming writer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((writer == NULL) || (writer->fp == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (++writer->fp->last_id_code);
+}
+
+
+/*!
+ * \brief Keep the handle counter of the writer ahead of a handle that
+ * was set by the caller, or allocate a new handle when \c id_code is 0.
+ *
+ * \return the handle to be written.
+ */
+static int
+dxf_writer_use_handle
+(
+        DxfWriter *writer,
+        int id_code
+)
+{
+        if (id_code == 0)
+        {
+                return (++writer->fp->last_id_code);
+        }
+        if (id_code > writer->fp->last_id_code)
+        {
+                writer->fp->last_id_code = id_code;
+        }
+        return (id_code);
+}
+
+
+/*!
+ * \brief Write the \c HEADER section.
+ *
+ * When \c header is \c NULL a minimal \c HEADER section with the
+ * \c $ACADVER and \c $HANDSEED variables is written.\n
+ * The \c $HANDSEED variable is written as a placeholder of
+ * \c DXF_WRITER_HANDSEED_WIDTH digits, which is replaced with the next
+ * free handle when the writer is closed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_writer_write_header
+(
+        DxfWriter *writer,
+                /*!< a pointer to a libDXF streaming writer. */
+        DxfHeader *header
+                /*!< a pointer to the DXF header, or \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char placeholder[DXF_WRITER_HANDSEED_WIDTH + 1];
+        char *acad_version = NULL;
+        char *hand_seed = NULL;
+        int result = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if ((writer == NULL) || (writer->fp == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((writer->section != -1) || (writer->last_section != -1))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the HEADER section must be the first section.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        memset (placeholder, '0', DXF_WRITER_HANDSEED_WIDTH);
+        placeholder[DXF_WRITER_HANDSEED_WIDTH] = '\0';
+        writer->handseed_start = ftell (writer->fp->fp);
+        if (header == NULL)
+        {
+                acad_version = dxf_header_acad_version_to_string
+                  (writer->fp->acad_version_number);
+                dxf_section_write (writer->fp, "HEADER");
+                fprintf (writer->fp->fp, "  9\n$ACADVER\n  1\n%s\n",
+                  (acad_version != NULL) ? acad_version : "AC1009");
+                fprintf (writer->fp->fp, "  9\n$HANDSEED\n  5\n%s\n",
+                  placeholder);
+                dxf_endsec_write (writer->fp);
+        }
+        else
+        {
+                hand_seed = header->HandSeed;
+                header->HandSeed = placeholder;
+                result = dxf_header_write (writer->fp, header);
+                header->HandSeed = hand_seed;
+        }
+        writer->handseed_end = ftell (writer->fp->fp);
+        writer->last_section = DXF_WRITER_HEADER;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Begin a section.
+ *
+ * Sections have to be written in the order of a DXF file, and each
+ * section only once.\n
+ * The \c HEADER section is written with dxf_writer_write_header ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_writer_begin_section
+(
+        DxfWriter *writer,
+                /*!< a pointer to a libDXF streaming writer. */
+        const char *section_name
+                /*!< name of the section, for example "ENTITIES". */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int section;
+
+        /* Do some basic checks. */
+        if ((writer == NULL) || (writer->fp == NULL) || (section_name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (writer->section != -1)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () section %s is still open.\n")),
+                  __FUNCTION__, dxf_writer_section_names[writer->section]);
+                return (EXIT_FAILURE);
+        }
+        for (section = DXF_WRITER_CLASSES;
+          section < DXF_WRITER_NUMBER_OF_SECTIONS;
+          section++)
+        {
+                if (strcmp (section_name, dxf_writer_section_names[section]) == 0)
+                {
+                        break;
+                }
+        }
+        if (section == DXF_WRITER_NUMBER_OF_SECTIONS)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () invalid section name %s was passed.\n")),
+                  __FUNCTION__, section_name);
+                return (EXIT_FAILURE);
+        }
+        if (section <= writer->last_section)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () section %s is out of order.\n")),
+                  __FUNCTION__, section_name);
+                return (EXIT_FAILURE);
+        }
+        dxf_section_write (writer->fp, (char *) dxf_writer_section_names[section]);
+        writer->section = section;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief End the open section.
+ *
+ * An open table or block definition is ended first.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_writer_end_section
+(
+        DxfWriter *writer
+                /*!< a pointer to a libDXF streaming writer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((writer == NULL) || (writer->fp == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (writer->section == -1)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () no section is open.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (writer->in_table)
+        {
+                dxf_writer_end_table (writer);
+        }
+        if (writer->block != NULL)
+        {
+                dxf_writer_end_block (writer);
+        }
+        dxf_endsec_write (writer->fp);
+        writer->last_section = writer->section;
+        writer->section = -1;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Begin a symbol table in the \c TABLES section.
+ *
+ * The table entries are written with the \c dxf_*_write () functions
+ * on the file pointer of the writer.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_writer_begin_table
+(
+        DxfWriter *writer,
+                /*!< a pointer to a libDXF streaming writer. */
+        const char *table_name,
+                /*!< name of the table, for example "LAYER". */
+        int max_table_entries
+                /*!< maximum number of entries in the table. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((writer == NULL) || (writer->fp == NULL) || (table_name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (writer->section != DXF_WRITER_TABLES)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a table can only be written in the TABLES section.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (writer->in_table)
+        {
+                dxf_writer_end_table (writer);
+        }
+        fprintf (writer->fp->fp, "  0\nTABLE\n  2\n%s\n", table_name);
+        if (writer->fp->acad_version_number >= AutoCAD_13)
+        {
+                fprintf (writer->fp->fp, "  5\n%x\n",
+                  dxf_writer_new_handle (writer));
+                fprintf (writer->fp->fp, "100\nAcDbSymbolTable\n");
+        }
+        fprintf (writer->fp->fp, " 70\n%d\n", max_table_entries);
+        writer->in_table = TRUE;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief End the open symbol table.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_writer_end_table
+(
+        DxfWriter *writer
+                /*!< a pointer to a libDXF streaming writer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((writer == NULL) || (writer->fp == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (!writer->in_table)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () no table is open.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        fprintf (writer->fp->fp, "  0\nENDTAB\n");
+        writer->in_table = FALSE;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Begin a block definition in the \c BLOCKS section.
+ *
+ * Only the \c BLOCK header is written, the entities of the block are
+ * written with dxf_writer_write_entity () and the block definition is
+ * ended with dxf_writer_end_block ().\n
+ * The \c entities member of \c block is not written.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_writer_begin_block
+(
+        DxfWriter *writer,
+                /*!< a pointer to a libDXF streaming writer. */
+        DxfBlock *block
+                /*!< a pointer to a DXF \c BLOCK entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((writer == NULL) || (writer->fp == NULL) || (block == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (writer->section != DXF_WRITER_BLOCKS)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a block can only be written in the BLOCKS section.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (writer->block != NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () block %s is still open.\n")),
+                  __FUNCTION__, writer->block->block_name);
+                return (EXIT_FAILURE);
+        }
+        block->id_code = dxf_writer_use_handle (writer, block->id_code);
+        if (dxf_block_write_begin (writer->fp, block) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        writer->block = block;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief End the open block definition with an \c ENDBLK marker.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_writer_end_block
+(
+        DxfWriter *writer
+                /*!< a pointer to a libDXF streaming writer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBlock *block = NULL;
+        DxfEndblk *endblk = NULL;
+        int result;
+
+        /* Do some basic checks. */
+        if ((writer == NULL) || (writer->fp == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        block = writer->block;
+        if (block == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () no block is open.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (block->endblk == NULL)
+        {
+                block->endblk = (struct DxfEndblk *) dxf_endblk_init (NULL);
+        }
+        endblk = (DxfEndblk *) block->endblk;
+        if (endblk != NULL)
+        {
+                endblk->id_code = dxf_writer_use_handle (writer, endblk->id_code);
+        }
+        result = dxf_block_write_end (writer->fp, block);
+        writer->block = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Write an entity.
+ *
+ * Entities can be written in the \c ENTITIES section, or in an open
+ * block definition in the \c BLOCKS section.\n
+ * An entity with an id-code of 0 is given a new handle, the id-code is
+ * stored in the entity.\n
+ * The entity is not retained by the writer, it can be freed or reused
+ * as soon as this function returns.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_writer_write_entity
+(
+        DxfWriter *writer,
+                /*!< a pointer to a libDXF streaming writer. */
+        DxfEntityType type,
+                /*!< type of the entity. */
+        void *entity
+                /*!< a pointer to a DXF entity of type \c type. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int id_code;
+
+        /* Do some basic checks. */
+        if ((writer == NULL) || (writer->fp == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((writer->section != DXF_WRITER_ENTITIES)
+          && ((writer->section != DXF_WRITER_BLOCKS) || (writer->block == NULL)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an entity can only be written in the ENTITIES section or in a block definition.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        id_code = dxf_entities_entity_get_id_code (type, entity);
+        if (id_code >= 0)
+        {
+                dxf_entities_entity_set_id_code (type, entity,
+                  dxf_writer_use_handle (writer, id_code));
+        }
+        if (dxf_entities_write_entity (writer->fp, type, entity) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        writer->number_of_entities++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Replace the \c $HANDSEED placeholder in the \c HEADER section
+ * with the next free handle.
+ *
+ * The \c HEADER section is read back from the output file to find the
+ * placeholder.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the output
+ * is not seekable or not readable.
+ */
+static int
+dxf_writer_fix_handseed
+(
+        DxfWriter *writer
+)
+{
+        FILE *fp = writer->fp->fp;
+        char *buffer = NULL;
+        char *value = NULL;
+        size_t size;
+        int result = EXIT_FAILURE;
+
+        if ((writer->handseed_start < 0)
+          || (writer->handseed_end <= writer->handseed_start))
+        {
+                return (EXIT_FAILURE);
+        }
+        size = (size_t) (writer->handseed_end - writer->handseed_start);
+        buffer = dxf_malloc (size + 1);
+        if (buffer == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        fflush (fp);
+        if ((fseek (fp, writer->handseed_start, SEEK_SET) == 0)
+          && (fread (buffer, 1, size, fp) == size))
+        {
+                buffer[size] = '\0';
+                value = strstr (buffer, "$HANDSEED");
+                /* Skip the variable name and the group code. */
+                if (value != NULL)
+                {
+                        value = strchr (value, '\n');
+                }
+                if (value != NULL)
+                {
+                        value = strchr (value + 1, '\n');
+                }
+                if ((value != NULL)
+                  && (fseek (fp, writer->handseed_start + (value + 1 - buffer), SEEK_SET) == 0))
+                {
+                        fprintf (fp, "%0*X", DXF_WRITER_HANDSEED_WIDTH,
+                          (unsigned int) (writer->fp->last_id_code + 1));
+                        result = EXIT_SUCCESS;
+                }
+        }
+        fseek (fp, 0, SEEK_END);
+        dxf_free (buffer);
+        return (result);
+}
+
+
+/*!
+ * \brief Copy the staged output of \c writer to its compressing stream.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_writer_compress
+(
+        DxfWriter *writer
+)
+{
+        FILE *fp = writer->fp->fp;
+        char *buffer = NULL;
+        size_t size;
+        int result = EXIT_SUCCESS;
+
+        buffer = dxf_malloc (DXF_COMPRESS_BUFFER_SIZE);
+        if (buffer == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        fflush (fp);
+        rewind (fp);
+        while ((size = fread (buffer, 1, DXF_COMPRESS_BUFFER_SIZE, fp)) > 0)
+        {
+                if (fwrite (buffer, 1, size, writer->compressed_fp) != size)
+                {
+                        result = EXIT_FAILURE;
+                        break;
+                }
+        }
+        if (ferror (fp))
+        {
+                result = EXIT_FAILURE;
+        }
+        dxf_free (buffer);
+        return (result);
+}
+
+
+/*!
+ * \brief Close a libDXF streaming writer.
+ *
+ * Open blocks, tables and sections are ended, the end of file marker is
+ * written and the \c $HANDSEED header variable is fixed up.\n
+ * The output file is closed when it was opened by dxf_writer_open ()
+ * or dxf_writer_open_compressed () and the writer is freed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_writer_close
+(
+        DxfWriter *writer
+                /*!< a pointer to a libDXF streaming writer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int result = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if ((writer == NULL) || (writer->fp == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (writer->section != -1)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () section %s was not ended.\n")),
+                  __FUNCTION__, dxf_writer_section_names[writer->section]);
+                dxf_writer_end_section (writer);
+        }
+        dxf_file_write_eof (writer->fp);
+        if ((writer->handseed_start >= 0)
+          && (dxf_writer_fix_handseed (writer) == EXIT_FAILURE))
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () could not fix up the $HANDSEED header variable.\n")),
+                  __FUNCTION__);
+        }
+        if (ferror (writer->fp->fp))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () while writing to: %s.\n")),
+                  __FUNCTION__, writer->fp->filename);
+                result = EXIT_FAILURE;
+        }
+        if ((writer->compressed_fp != NULL)
+          && (dxf_writer_compress (writer) == EXIT_FAILURE))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () while compressing to: %s.\n")),
+                  __FUNCTION__, writer->fp->filename);
+                result = EXIT_FAILURE;
+        }
+        if (dxf_writer_free (writer) == EXIT_FAILURE)
+        {
+                result = EXIT_FAILURE;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a libDXF streaming writer.
+ *
+ * Nothing more is written, use dxf_writer_close () to finish the
+ * output.\n
+ * The output file is closed when it was opened by dxf_writer_open ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_writer_free
+(
+        DxfWriter *writer
+                /*!< a pointer to a libDXF streaming writer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int result = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if (writer == NULL)
+        {
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (writer->fp != NULL)
+        {
+                if (writer->close_fp
+                  && (fclose (writer->fp->fp) != 0))
+                {
+                        result = EXIT_FAILURE;
+                }
+                else if (!writer->close_fp)
+                {
+                        fflush (writer->fp->fp);
+                }
+                dxf_free (writer->fp->filename);
+                dxf_free (writer->fp);
+        }
+        if ((writer->compressed_fp != NULL)
+          && (fclose (writer->compressed_fp) != 0))
+        {
+                result = EXIT_FAILURE;
+        }
+        dxf_free (writer);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/* EOF */
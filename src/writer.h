@@ -0,0 +1,125 @@
+/*!
+ * \file writer.h
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Prototypes for a libDXF streaming writer.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_WRITER_H
+#define LIBDXF_SRC_WRITER_H
+
+
+#include "global.h"
+#include "block.h"
+#include "entities.h"
+#include "header.h"
+#include "compress.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_WRITER_HANDSEED_WIDTH 16
+        /*!< \brief Number of hexadecimal digits reserved for the
+         * \c $HANDSEED header variable. */
+
+
+/*!
+ * \brief Definition of a libDXF streaming writer.
+ *
+ * A writer emits a DXF file section by section and entity by entity,
+ * without the need to build the lists of a \c DxfDrawing in memory
+ * first.\n
+ * The writer keeps track of the open section, table and block, assigns
+ * handles to entities without an id-code and fixes up the
+ * \c $HANDSEED header variable when the writer is closed.
+ */
+typedef struct
+dxf_writer_struct
+{
+        DxfFile *fp;
+                /*!< DXF file pointer to the output file (or device). */
+        int close_fp;
+                /*!< \c TRUE when the writer opened (and closes) the
+                 * output file. */
+        int section;
+                /*!< Index of the open section, or -1 when no section
+                 * is open. */
+        int last_section;
+                /*!< Index of the last section written, or -1. */
+        int in_table;
+                /*!< \c TRUE inside a \c TABLE of the \c TABLES
+                 * section. */
+        DxfBlock *block;
+                /*!< The open block definition, or \c NULL. */
+        long handseed_start;
+                /*!< File offset of the \c HEADER section, or -1 when
+                 * no \c HEADER section was written. */
+        long handseed_end;
+                /*!< File offset of the end of the \c HEADER
+                 * section. */
+        long number_of_entities;
+                /*!< Number of entities written. */
+        FILE *compressed_fp;
+                /*!< Compressing stream to the output file, or \c NULL
+                 * when the output is not compressed. */
+} DxfWriter;
+
+
+DxfWriter *dxf_writer_new ();
+DxfWriter *dxf_writer_init (DxfWriter *writer);
+DxfWriter *dxf_writer_open (char *filename, int acad_version_number);
+DxfWriter *dxf_writer_open_file (FILE *fp, int acad_version_number);
+DxfWriter *dxf_writer_open_compressed (char *filename, int acad_version_number, DxfCompression compression, int level);
+int dxf_writer_close (DxfWriter *writer);
+int dxf_writer_free (DxfWriter *writer);
+DxfFile *dxf_writer_get_file (DxfWriter *writer);
+int dxf_writer_new_handle (DxfWriter *writer);
+int dxf_writer_write_header (DxfWriter *writer, DxfHeader *header);
+int dxf_writer_begin_section (DxfWriter *writer, const char *section_name);
+int dxf_writer_end_section (DxfWriter *writer);
+int dxf_writer_begin_table (DxfWriter *writer, const char *table_name, int max_table_entries);
+int dxf_writer_end_table (DxfWriter *writer);
+int dxf_writer_begin_block (DxfWriter *writer, DxfBlock *block);
+int dxf_writer_end_block (DxfWriter *writer);
+int dxf_writer_write_entity (DxfWriter *writer, DxfEntityType type, void *entity);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_WRITER_H */
+
+
+/* EOF */
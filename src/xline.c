@@ -62,7 +62,7 @@ dxf_xline_new ()
         size = sizeof (DxfXLine);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((xline = malloc (size)) == NULL)
+        if ((xline = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfXLine struct.\n")),
@@ -99,21 +99,21 @@ dxf_xline_init
         /* Do some basic checks. */
         if (xline == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 xline = dxf_xline_new ();
         }
         if (xline == NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfXLine struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         xline->id_code = 0;
-        xline->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        xline->layer = strdup (DXF_DEFAULT_LAYER);
+        xline->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        xline->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         xline->elevation = 0.0;
         xline->thickness = 0.0;
         xline->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -124,13 +124,13 @@ dxf_xline_init
         xline->shadow_mode = 0;
         xline->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
         xline->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) xline->binary_graphics_data);
-        xline->dictionary_owner_soft = strdup ("");
-        xline->material = strdup ("");
-        xline->dictionary_owner_hard = strdup ("");
+        xline->dictionary_owner_soft = dxf_strdup ("");
+        xline->material = dxf_strdup ("");
+        xline->dictionary_owner_hard = dxf_strdup ("");
         xline->lineweight = 0;
-        xline->plot_style_name = strdup ("");
+        xline->plot_style_name = dxf_strdup ("");
         xline->color_value = 0;
-        xline->color_name = strdup ("");
+        xline->color_name = dxf_strdup ("");
         xline->transparency = 0;
         xline->p0 = (DxfPoint *) dxf_point_new ();
         xline->p0 = dxf_point_init ((DxfPoint *) xline->p0);
@@ -178,37 +178,37 @@ dxf_xline_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (xline == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 xline = dxf_xline_init (xline);
         }
         if (xline->p0 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 xline->p0 = dxf_point_init (xline->p0);
         }
         if (xline->p1 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 xline->p1 = dxf_point_init (xline->p1);
         }
         if (xline->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 xline->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) xline->binary_graphics_data);
@@ -219,12 +219,12 @@ dxf_xline_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -349,7 +349,7 @@ dxf_xline_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbXline") != 0)))
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -373,9 +373,8 @@ dxf_xline_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, xline->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) xline->binary_graphics_data->next);
-                        xline->binary_graphics_data = (DxfBinaryGraphicsData *) xline->binary_graphics_data->next;
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_binary_graphics_data_append_hex ((DxfBinaryGraphicsData *) xline->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -441,22 +440,23 @@ dxf_xline_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (xline->linetype, "") == 0)
         {
-                xline->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                xline->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (xline->layer, "") == 0)
         {
-                xline->layer = strdup (DXF_DEFAULT_LAYER);
+                xline->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -482,48 +482,48 @@ dxf_xline_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("XLINE");
+        char *dxf_entity_name = dxf_strdup ("XLINE");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (xline == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (xline->p0 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (xline->p1 == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (xline->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () entity contains no binary graphics data.\n")),
                   __FUNCTION__);
         }
@@ -531,23 +531,23 @@ dxf_xline_write
                 && (xline->p0->y0 == xline->p1->y0)
                 && (xline->p0->z0 == xline->p1->z0))
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () start point and end point are identical for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, xline->id_code);
                 dxf_entity_skip (dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (xline->layer, "") == 0)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, xline->id_code);
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_NOTE,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                xline->layer = strdup (DXF_DEFAULT_LAYER);
+                xline->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -628,16 +628,7 @@ dxf_xline_write
 #else
                 fprintf (fp->fp, " 92\n%d\n", xline->graphics_data_size);
 #endif
-                if (xline->binary_graphics_data != NULL)
-                {
-                        DxfBinaryGraphicsData *iter;
-                        iter = xline->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (iter));
-                                iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (iter);
-                        }
-                }
+                dxf_binary_graphics_data_write (fp, (DxfBinaryGraphicsData *) xline->binary_graphics_data);
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
@@ -665,7 +656,7 @@ dxf_xline_write
         fprintf (fp->fp, " 21\n%f\n", xline->p1->y0);
         fprintf (fp->fp, " 31\n%f\n", xline->p1->z0);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -694,29 +685,29 @@ dxf_xline_free
         /* Do some basic checks. */
         if (xline == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (xline->next != NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (xline->linetype);
-        free (xline->layer);
+        dxf_free (xline->linetype);
+        dxf_free (xline->layer);
         dxf_binary_graphics_data_free_list (xline->binary_graphics_data);
-        free (xline->dictionary_owner_soft);
-        free (xline->material);
-        free (xline->dictionary_owner_hard);
-        free (xline->plot_style_name);
-        free (xline->color_name);
+        dxf_free (xline->dictionary_owner_soft);
+        dxf_free (xline->material);
+        dxf_free (xline->dictionary_owner_hard);
+        dxf_free (xline->plot_style_name);
+        dxf_free (xline->color_name);
         dxf_point_free (xline->p0);
         dxf_point_free (xline->p1);
-        free (xline);
+        dxf_free (xline);
         xline = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -737,18 +728,19 @@ dxf_xline_free_list
                  * entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (xlines == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (xlines != NULL)
         {
                 DxfXLine *iter = (DxfXLine *) xlines->next;
+                xlines->next = NULL;
                 dxf_xline_free (xlines);
                 xlines = (DxfXLine *) iter;
         }
@@ -868,7 +860,7 @@ dxf_xline_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (xline->linetype));
+        return (dxf_strdup (xline->linetype));
 }
 
 
@@ -902,7 +894,7 @@ dxf_xline_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        xline->linetype = strdup (linetype);
+        xline->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -943,7 +935,7 @@ dxf_xline_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (xline->layer));
+        return (dxf_strdup (xline->layer));
 }
 
 
@@ -977,7 +969,7 @@ dxf_xline_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        xline->layer = strdup (layer);
+        xline->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1750,7 +1742,7 @@ dxf_xline_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (xline->dictionary_owner_soft));
+        return (dxf_strdup (xline->dictionary_owner_soft));
 }
 
 
@@ -1786,7 +1778,7 @@ dxf_xline_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        xline->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        xline->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1831,7 +1823,7 @@ dxf_xline_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (xline->material));
+        return (dxf_strdup (xline->material));
 }
 
 
@@ -1870,7 +1862,7 @@ dxf_xline_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        xline->material = strdup (material);
+        xline->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1914,7 +1906,7 @@ dxf_xline_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (xline->dictionary_owner_hard));
+        return (dxf_strdup (xline->dictionary_owner_hard));
 }
 
 
@@ -1950,7 +1942,7 @@ dxf_xline_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        xline->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        xline->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2057,7 +2049,7 @@ dxf_xline_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (xline->plot_style_name));
+        return (dxf_strdup (xline->plot_style_name));
 }
 
 
@@ -2095,7 +2087,7 @@ dxf_xline_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        xline->plot_style_name = strdup (plot_style_name);
+        xline->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2202,7 +2194,7 @@ dxf_xline_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (xline->color_name));
+        return (dxf_strdup (xline->color_name));
 }
 
 
@@ -2240,7 +2232,7 @@ dxf_xline_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        xline->color_name = strdup (color_name);
+        xline->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2325,7 +2317,7 @@ dxf_xline_get_p0
                 /*!< a pointer to a DXF \c XLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2364,7 +2356,7 @@ dxf_xline_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2403,7 +2395,7 @@ dxf_xline_get_x0
                 /*!< a pointer to a DXF \c XLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2446,7 +2438,7 @@ dxf_xline_set_x0
                  * \c XLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2485,7 +2477,7 @@ dxf_xline_get_y0
                 /*!< a pointer to a DXF \c XLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2528,7 +2520,7 @@ dxf_xline_set_y0
                  * \c xline entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2567,7 +2559,7 @@ dxf_xline_get_z0
                 /*!< a pointer to a DXF \c XLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2610,7 +2602,7 @@ dxf_xline_set_z0
                  * \c xline entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2648,7 +2640,7 @@ dxf_xline_get_p1
                 /*!< a pointer to a DXF \c XLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2687,7 +2679,7 @@ dxf_xline_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2726,7 +2718,7 @@ dxf_xline_get_x1
                 /*!< a pointer to a DXF \c XLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2769,7 +2761,7 @@ dxf_xline_set_x1
                  * \c XLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2808,7 +2800,7 @@ dxf_xline_get_y1
                 /*!< a pointer to a DXF \c XLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2851,7 +2843,7 @@ dxf_xline_set_y1
                  * \c xline entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2890,7 +2882,7 @@ dxf_xline_get_z1
                 /*!< a pointer to a DXF \c XLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
@@ -2933,7 +2925,7 @@ dxf_xline_set_z1
                  * \c xline entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -61,7 +61,7 @@ dxf_xrecord_new ()
         size = sizeof (DxfXrecord);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((xrecord = malloc (size)) == NULL)
+        if ((xrecord = dxf_malloc (size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfXrecord struct.\n")),
@@ -99,28 +99,28 @@ dxf_xrecord_init
         /* Do some basic checks. */
         if (xrecord == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 xrecord = dxf_xrecord_new ();
         }
         if (xrecord == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfXrecord struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         xrecord->id_code = 0;
-        xrecord->dictionary_owner_soft = strdup ("");
-        xrecord->dictionary_owner_hard = strdup ("");
+        xrecord->dictionary_owner_soft = dxf_strdup ("");
+        xrecord->dictionary_owner_hard = dxf_strdup ("");
         xrecord->group_code = 0;
         xrecord->I8 = 0;
         xrecord->I16 = 0;
         xrecord->I32 = 0;
         xrecord->D = 0.0;
         xrecord->F = 0.0;
-        xrecord->S = strdup ("");
+        xrecord->S = dxf_strdup ("");
         xrecord->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -157,22 +157,22 @@ dxf_xrecord_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this object.\n")),
                   __FUNCTION__);
         }
         if (xrecord == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 xrecord = dxf_xrecord_init (xrecord);
@@ -183,11 +183,11 @@ dxf_xrecord_read
         {
                 if (ferror (fp->fp))
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -207,7 +207,7 @@ dxf_xrecord_read
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
                         if (strcmp (temp_string, "AcDbXrecord") != 0)
                         {
-                                fprintf (stderr,
+                                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -299,13 +299,14 @@ dxf_xrecord_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        DXF_STATS_ADD (fp, unknown_group_codes, 1);
                 }
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -331,30 +332,30 @@ dxf_xrecord_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("XRECORD");
+        char *dxf_entity_name = dxf_strdup ("XRECORD");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (xrecord == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s object with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, xrecord->id_code);
         }
@@ -441,12 +442,12 @@ dxf_xrecord_write
         }
         else
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () unknown group code %d found in DxfXrecord struct with id-code: %x.\n")),
                   __FUNCTION__, xrecord->group_code, xrecord->id_code);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -475,22 +476,22 @@ dxf_xrecord_free
         /* Do some basic checks. */
         if (xrecord == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (xrecord->next != NULL)
         {
-              fprintf (stderr,
+              DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (xrecord->dictionary_owner_soft);
-        free (xrecord->dictionary_owner_hard);
-        free (xrecord->S);
-        free (xrecord);
+        dxf_free (xrecord->dictionary_owner_soft);
+        dxf_free (xrecord->dictionary_owner_hard);
+        dxf_free (xrecord->S);
+        dxf_free (xrecord);
         xrecord = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -511,18 +512,19 @@ dxf_xrecord_free_list
                  * \c XRECORD objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (xrecords == NULL)
         {
-                fprintf (stderr,
+                DXF_DIAGNOSTIC (DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (xrecords != NULL)
         {
                 DxfXrecord *iter = (DxfXrecord *) xrecords->next;
+                xrecords->next = NULL;
                 dxf_xrecord_free (xrecords);
                 xrecords = (DxfXrecord *) iter;
         }
@@ -645,7 +647,7 @@ dxf_xrecord_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (xrecord->dictionary_owner_soft));
+        return (dxf_strdup (xrecord->dictionary_owner_soft));
 }
 
 
@@ -681,7 +683,7 @@ dxf_xrecord_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        xrecord->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        xrecord->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -725,7 +727,7 @@ dxf_xrecord_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (xrecord->dictionary_owner_hard));
+        return (dxf_strdup (xrecord->dictionary_owner_hard));
 }
 
 
@@ -761,7 +763,7 @@ dxf_xrecord_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        xrecord->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        xrecord->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1184,7 +1186,7 @@ dxf_xrecord_get_S
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (xrecord->S));
+        return (dxf_strdup (xrecord->S));
 }
 
 
@@ -1218,7 +1220,7 @@ dxf_xrecord_set_S
                   __FUNCTION__);
                 return (NULL);
         }
-        xrecord->S = strdup (S);
+        xrecord->S = dxf_strdup (S);
 #if DEBUG
         DXF_DEBUG_END
 #endif
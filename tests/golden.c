@@ -0,0 +1,976 @@
+/*!
+ * \file golden.c
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Round trip fidelity and throughput harness over the golden files.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <time.h>
+#include <dirent.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Default directory with the golden files.
+ */
+#define GOLDEN_DEFAULT_DIR "golden"
+
+
+/*!
+ * \brief Default number of timed parse and emit runs for every file.
+ */
+#define GOLDEN_DEFAULT_REPEAT 1000
+
+
+/*!
+ * \brief Fidelity of a round trip.
+ */
+typedef enum
+golden_status
+{
+        GOLDEN_IDENTICAL,
+                /*!< The output is byte identical to the golden file. */
+        GOLDEN_EQUIVALENT,
+                /*!< Same group codes and values, the numbers are
+                 * formatted differently. */
+        GOLDEN_DIFFERENT,
+                /*!< The group codes or values differ. */
+        GOLDEN_FAILED
+                /*!< The file could not be read or written. */
+} GoldenStatus;
+
+
+/*!
+ * \brief Names of the fidelity levels, as reported.
+ */
+static const char *golden_status_names[] =
+{
+        "identical",
+        "equivalent",
+        "different",
+        "failed"
+};
+
+
+/*!
+ * \brief Reader, writer and destructor of an entity type.
+ *
+ * The reader is called with the file positioned after the entity name,
+ * it reads up to and including the \c 0 group code of the next entity.
+ */
+typedef struct
+golden_entity_struct
+{
+        const char *dxf_name;
+                /*!< Name of the entity in the DXF file. */
+        void *(*read) (DxfFile *fp);
+                /*!< Parse an entity. */
+        int (*write) (DxfFile *fp, void *entity);
+                /*!< Emit an entity. */
+        void (*free) (void *entity);
+                /*!< Free an entity. */
+} GoldenEntity;
+
+
+static void *
+golden_arc_read (DxfFile *fp)
+{
+        return (dxf_arc_read (fp, dxf_arc_init (dxf_arc_new ())));
+}
+
+
+static int
+golden_arc_write (DxfFile *fp, void *entity)
+{
+        return (dxf_arc_write (fp, (DxfArc *) entity));
+}
+
+
+static void
+golden_arc_free (void *entity)
+{
+        dxf_arc_free ((DxfArc *) entity);
+}
+
+
+static void *
+golden_circle_read (DxfFile *fp)
+{
+        return (dxf_circle_read (fp, dxf_circle_init (dxf_circle_new ())));
+}
+
+
+static int
+golden_circle_write (DxfFile *fp, void *entity)
+{
+        return (dxf_circle_write (fp, (DxfCircle *) entity));
+}
+
+
+static void
+golden_circle_free (void *entity)
+{
+        dxf_circle_free ((DxfCircle *) entity);
+}
+
+
+static void *
+golden_ellipse_read (DxfFile *fp)
+{
+        return (dxf_ellipse_read (fp, dxf_ellipse_init (dxf_ellipse_new ())));
+}
+
+
+static int
+golden_ellipse_write (DxfFile *fp, void *entity)
+{
+        return (dxf_ellipse_write (fp, (DxfEllipse *) entity));
+}
+
+
+static void
+golden_ellipse_free (void *entity)
+{
+        dxf_ellipse_free ((DxfEllipse *) entity);
+}
+
+
+static void *
+golden_helix_read (DxfFile *fp)
+{
+        return (dxf_helix_read (fp, dxf_helix_init (dxf_helix_new ())));
+}
+
+
+static int
+golden_helix_write (DxfFile *fp, void *entity)
+{
+        return (dxf_helix_write (fp, (DxfHelix *) entity));
+}
+
+
+static void
+golden_helix_free (void *entity)
+{
+        dxf_helix_free ((DxfHelix *) entity);
+}
+
+
+static void *
+golden_line_read (DxfFile *fp)
+{
+        return (dxf_line_read (fp, dxf_line_init (dxf_line_new ())));
+}
+
+
+static int
+golden_line_write (DxfFile *fp, void *entity)
+{
+        return (dxf_line_write (fp, (DxfLine *) entity));
+}
+
+
+static void
+golden_line_free (void *entity)
+{
+        dxf_line_free ((DxfLine *) entity);
+}
+
+
+static void *
+golden_lwpolyline_read (DxfFile *fp)
+{
+        return (dxf_lwpolyline_read (fp, dxf_lwpolyline_init (dxf_lwpolyline_new ())));
+}
+
+
+static int
+golden_lwpolyline_write (DxfFile *fp, void *entity)
+{
+        return (dxf_lwpolyline_write (fp, (DxfLWPolyline *) entity));
+}
+
+
+static void
+golden_lwpolyline_free (void *entity)
+{
+        dxf_lwpolyline_free ((DxfLWPolyline *) entity);
+}
+
+
+static void *
+golden_point_read (DxfFile *fp)
+{
+        return (dxf_point_read (fp, dxf_point_init (dxf_point_new ())));
+}
+
+
+static int
+golden_point_write (DxfFile *fp, void *entity)
+{
+        return (dxf_point_write (fp, (DxfPoint *) entity));
+}
+
+
+static void
+golden_point_free (void *entity)
+{
+        dxf_point_free ((DxfPoint *) entity);
+}
+
+
+/*!
+ * \brief Read a \c POLYLINE with the \c VERTEX entities and the
+ * \c SEQEND following it.
+ */
+static void *
+golden_polyline_read (DxfFile *fp)
+{
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        DxfPolyline *polyline = NULL;
+        DxfVertex *vertex = NULL;
+        DxfVertex *last = NULL;
+        DxfSeqend *seqend = NULL;
+
+        polyline = dxf_polyline_read (fp, dxf_polyline_init (dxf_polyline_new ()));
+        if (polyline == NULL)
+        {
+                return (NULL);
+        }
+        dxf_vertex_free_list (polyline->vertices);
+        polyline->vertices = NULL;
+        while (!feof (fp->fp))
+        {
+                memset (temp_string, 0, sizeof (temp_string));
+                dxf_read_line (temp_string, fp);
+                if (strcmp (temp_string, "VERTEX") == 0)
+                {
+                        vertex = dxf_vertex_read (fp, dxf_vertex_init (dxf_vertex_new ()));
+                        if (vertex == NULL)
+                        {
+                                break;
+                        }
+                        if (last == NULL)
+                        {
+                                polyline->vertices = vertex;
+                        }
+                        else
+                        {
+                                last->next = (struct DxfVertex *) vertex;
+                        }
+                        last = vertex;
+                }
+                else if (strcmp (temp_string, "SEQEND") == 0)
+                {
+                        seqend = dxf_seqend_read (fp, dxf_seqend_init (dxf_seqend_new ()));
+                        dxf_seqend_free (seqend);
+                        break;
+                }
+                else
+                {
+                        break;
+                }
+        }
+        return (polyline);
+}
+
+
+static int
+golden_polyline_write (DxfFile *fp, void *entity)
+{
+        DxfPolyline *polyline = (DxfPolyline *) entity;
+        DxfSeqend *seqend = NULL;
+        int result;
+
+        result = dxf_polyline_write (fp, polyline);
+        seqend = dxf_seqend_init (dxf_seqend_new ());
+        dxf_free (seqend->layer);
+        seqend->layer = dxf_strdup (polyline->layer);
+        dxf_free (seqend->linetype);
+        seqend->linetype = dxf_strdup (polyline->linetype);
+        seqend->color = polyline->color;
+        if (result == EXIT_SUCCESS)
+        {
+                result = dxf_seqend_write (fp, seqend);
+        }
+        dxf_seqend_free (seqend);
+        return (result);
+}
+
+
+static void
+golden_polyline_free (void *entity)
+{
+        DxfPolyline *polyline = (DxfPolyline *) entity;
+
+        dxf_vertex_free_list (polyline->vertices);
+        polyline->vertices = NULL;
+        dxf_polyline_free (polyline);
+}
+
+
+/*!
+ * \brief Entity types with golden files.
+ */
+static const GoldenEntity golden_entities[] =
+{
+        {"ARC", golden_arc_read, golden_arc_write, golden_arc_free},
+        {"CIRCLE", golden_circle_read, golden_circle_write, golden_circle_free},
+        {"ELLIPSE", golden_ellipse_read, golden_ellipse_write, golden_ellipse_free},
+        {"HELIX", golden_helix_read, golden_helix_write, golden_helix_free},
+        {"LINE", golden_line_read, golden_line_write, golden_line_free},
+        {"LWPOLYLINE", golden_lwpolyline_read, golden_lwpolyline_write, golden_lwpolyline_free},
+        {"POINT", golden_point_read, golden_point_write, golden_point_free},
+        {"POLYLINE", golden_polyline_read, golden_polyline_write, golden_polyline_free}
+};
+
+
+/*!
+ * \brief Known fidelity of the golden files which do not round trip to
+ * an equivalent file, with the reason.
+ *
+ * Every file is listed by name with all its known differences, files
+ * without an entry are expected to round trip to at least an equivalent
+ * file.\n
+ * A round trip worse than its known fidelity is a regression.
+ */
+static const struct
+{
+        const char *filename;
+        GoldenStatus status;
+        const char *reason;
+} golden_known[] =
+{
+        {"arc_R2000.dxf", GOLDEN_DIFFERENT,
+          "the owner handle (330) is written in a 102 {ACAD_REACTORS group, graphics data size (160) instead of lineweight (370)"},
+        {"arc_R2004.dxf", GOLDEN_DIFFERENT,
+          "the owner handle (330) is written in a 102 {ACAD_REACTORS group, defaults of 160, 420, 430 and 440 are written"},
+        {"arc_R2007.dxf", GOLDEN_DIFFERENT,
+          "the owner handle (330) is written in a 102 {ACAD_REACTORS group, defaults of 160, 420, 430 and 440 are written"},
+        {"arc_R2010.dxf", GOLDEN_DIFFERENT,
+          "the owner handle (330) is written in a 102 {ACAD_REACTORS group, defaults of 160, 420, 430, 440, 390 and 284 are written"},
+        {"circle_R2000.dxf", GOLDEN_DIFFERENT,
+          "the owner handle (330) is written in a 102 {ACAD_REACTORS group, graphics data size (160) instead of lineweight (370)"},
+        {"circle_R2004.dxf", GOLDEN_DIFFERENT,
+          "the owner handle (330) is written in a 102 {ACAD_REACTORS group, lineweight (370) before thickness (39), defaults of 160, 420, 430 and 440 are written"},
+        {"circle_R2007.dxf", GOLDEN_DIFFERENT,
+          "the owner handle (330) is written in a 102 {ACAD_REACTORS group, lineweight (370) before thickness (39), defaults of 160, 420, 430 and 440 are written"},
+        {"circle_R2010.dxf", GOLDEN_DIFFERENT,
+          "the owner handle (330) is written in a 102 {ACAD_REACTORS group, lineweight (370) before thickness (39), defaults of 160, 420, 430, 440, 390 and 284 are written"},
+        {"ellipse_R12.dxf", GOLDEN_FAILED,
+          "the POLYLINE start point is (20, 20), dxf_polyline_write () only writes the (0, 0) dummy point of the DXF reference"},
+        {"ellipse_R2000.dxf", GOLDEN_DIFFERENT,
+          "the owner handle (330) is written in a 102 {ACAD_REACTORS group, graphics data size (160) instead of lineweight (370), the axis ratio (40) is rounded to 6 decimals"},
+        {"ellipse_R2004.dxf", GOLDEN_DIFFERENT,
+          "the owner handle (330) is written in a 102 {ACAD_REACTORS group, defaults of 160, 420, 430 and 440 instead of lineweight (370), the axis ratio (40) is rounded to 6 decimals"},
+        {"ellipse_R2007.dxf", GOLDEN_DIFFERENT,
+          "the owner handle (330) is written in a 102 {ACAD_REACTORS group, defaults of 160, 420, 430 and 440 instead of lineweight (370), the axis ratio (40) is rounded to 6 decimals"},
+        {"ellipse_R2010.dxf", GOLDEN_DIFFERENT,
+          "the owner handle (330) is written in a 102 {ACAD_REACTORS group, defaults of 160, 420, 430, 440, 390 and 284 instead of lineweight (370), the axis ratio (40) is rounded to 6 decimals"},
+        {"helix_R2000.dxf", GOLDEN_DIFFERENT,
+          "lineweight (370) before linetype scale (48), graphics data size as 160 instead of 92, defaults of 420, 430, 440, 390 and 284 and unset 11, 12 and 13 points are written, knots, control points and tolerances are rounded to 6 decimals"},
+        {"helix_R2004.dxf", GOLDEN_DIFFERENT,
+          "lineweight (370) before linetype scale (48), graphics data size as 160 instead of 92, defaults of 420, 430, 440, 390 and 284 and unset 11, 12 and 13 points are written, knots, control points and tolerances are rounded to 6 decimals"},
+        {"helix_R2007.dxf", GOLDEN_DIFFERENT,
+          "lineweight (370) before linetype scale (48), graphics data size as 160 instead of 92, defaults of 420, 430, 440, 390 and 284 and unset 11, 12 and 13 points are written, knots, control points and tolerances are rounded to 6 decimals"},
+        {"helix_R2010.dxf", GOLDEN_DIFFERENT,
+          "lineweight (370) before linetype scale (48), defaults of 420, 430, 440, 390 and 284 and unset 11, 12 and 13 points are written, knots, control points and tolerances are rounded to 6 decimals"},
+        {"line_R2000.dxf", GOLDEN_DIFFERENT,
+          "the owner handle (330) is written in a 102 {ACAD_REACTORS group, thickness (39) is written in AcDbEntity, lineweight (370) is not written"},
+        {"line_R2004.dxf", GOLDEN_DIFFERENT,
+          "the owner handle (330) is written in a 102 {ACAD_REACTORS group, thickness (39) is written in AcDbEntity after lineweight (370), defaults of 420, 430 and 440 are written"},
+        {"line_R2007.dxf", GOLDEN_DIFFERENT,
+          "the owner handle (330) is written in a 102 {ACAD_REACTORS group, thickness (39) is written in AcDbEntity after lineweight (370), defaults of 420, 430 and 440 are written"},
+        {"line_R2010.dxf", GOLDEN_DIFFERENT,
+          "the owner handle (330) is written in a 102 {ACAD_REACTORS group, thickness (39) is written in AcDbEntity after lineweight (370), defaults of 420, 430, 440, 390 and 284 are written"},
+        {"lwpolyline_rectangle_R2000.dxf", GOLDEN_DIFFERENT,
+          "the owner handle (330) is written in a 102 {ACAD_REACTORS group, lineweight (370) is not written, zero bulges (42) are written"},
+        {"lwpolyline_rectangle_R2004.dxf", GOLDEN_DIFFERENT,
+          "the owner handle (330) is written in a 102 {ACAD_REACTORS group, lineweight (370) is not written, zero bulges (42) are written"},
+        {"lwpolyline_rectangle_R2007.dxf", GOLDEN_DIFFERENT,
+          "the owner handle (330) is written in a 102 {ACAD_REACTORS group, lineweight (370) is not written, zero bulges (42) are written"},
+        {"lwpolyline_rectangle_R2010.dxf", GOLDEN_DIFFERENT,
+          "the owner handle (330) is written in a 102 {ACAD_REACTORS group, lineweight (370) is not written, zero bulges (42) are written"},
+        {"point_R12.dxf", GOLDEN_DIFFERENT,
+          "dxf_point_write () also writes the X axis angle (50) for R12"},
+        {"point_R2000.dxf", GOLDEN_DIFFERENT,
+          "the owner handle (330) is written in a 102 {ACAD_REACTORS group, graphics data size (160) is written"},
+        {"point_R2004.dxf", GOLDEN_DIFFERENT,
+          "the owner handle (330) is written in a 102 {ACAD_REACTORS group, a zero lineweight (370) and defaults of 160, 420, 430 and 440 are written"},
+        {"point_R2007.dxf", GOLDEN_DIFFERENT,
+          "the owner handle (330) is written in a 102 {ACAD_REACTORS group, a zero lineweight (370) and defaults of 160, 420, 430 and 440 are written"},
+        {"point_R2010.dxf", GOLDEN_DIFFERENT,
+          "the owner handle (330) is written in a 102 {ACAD_REACTORS group, a zero lineweight (370) and defaults of 160, 420, 430, 440, 390 and 284 are written"},
+        {"polyline_rectangle_R12.dxf", GOLDEN_DIFFERENT,
+          "dxf_polyline_write () also writes zero polygon mesh vertex counts and smooth surface type (71 to 75), the VERTEX entities get subclass markers (100), 70 and 91 groups, the SEQEND handle is lost"}
+};
+
+
+#define GOLDEN_NUMBER_OF_ENTITIES \
+        ((int) (sizeof (golden_entities) / sizeof (golden_entities[0])))
+
+
+/*!
+ * \brief Golden file versions.
+ */
+static const struct
+{
+        const char *suffix;
+        int acad_version_number;
+} golden_versions[] =
+{
+        {"_R12.dxf", AutoCAD_12},
+        {"_R2000.dxf", AutoCAD_2000},
+        {"_R2004.dxf", AutoCAD_2004},
+        {"_R2007.dxf", AutoCAD_2007},
+        {"_R2010.dxf", AutoCAD_2010}
+};
+
+
+static double
+golden_now (void)
+{
+        struct timespec now;
+
+        clock_gettime (CLOCK_MONOTONIC, &now);
+        return ((double) now.tv_sec + (double) now.tv_nsec * 1e-9);
+}
+
+
+/*!
+ * \brief Read the contents of \c fp into a buffer.
+ *
+ * \return a pointer to the buffer, terminated with a nul character, or
+ * \c NULL when an error occurred.
+ */
+static char *
+golden_slurp
+(
+        FILE *fp,
+        long *size
+)
+{
+        char *buffer = NULL;
+
+        if ((fseek (fp, 0L, SEEK_END) != 0)
+          || ((*size = ftell (fp)) < 0)
+          || (fseek (fp, 0L, SEEK_SET) != 0))
+        {
+                return (NULL);
+        }
+        buffer = malloc ((size_t) *size + 1);
+        if ((buffer == NULL)
+          || (fread (buffer, 1, (size_t) *size, fp) != (size_t) *size))
+        {
+                free (buffer);
+                return (NULL);
+        }
+        buffer[*size] = '\0';
+        return (buffer);
+}
+
+
+/*!
+ * \brief Get the next line of \c text without leading and trailing
+ * white space, and advance \c text past it.
+ *
+ * \return \c 0 at the end of \c text.
+ */
+static int
+golden_next_line
+(
+        const char **text,
+        const char **line,
+        size_t *length
+)
+{
+        const char *end;
+
+        if ((*text)[strspn (*text, " \t\r\n")] == '\0')
+        {
+                /* Trailing empty lines are not significant. */
+                return (0);
+        }
+        end = strchr (*text, '\n');
+        if (end == NULL)
+        {
+                end = *text + strlen (*text);
+        }
+        *line = *text;
+        *text = (*end == '\n') ? end + 1 : end;
+        while ((*line < end) && ((**line == ' ') || (**line == '\t')))
+        {
+                (*line)++;
+        }
+        while ((end > *line) && ((end[-1] == ' ') || (end[-1] == '\r')))
+        {
+                end--;
+        }
+        *length = (size_t) (end - *line);
+        return (1);
+}
+
+
+/*!
+ * \brief Compare two lines as numbers when both are numbers, else as
+ * case insensitive strings.
+ */
+static int
+golden_same_value
+(
+        const char *a,
+        size_t a_length,
+        const char *b,
+        size_t b_length
+)
+{
+        char a_string[DXF_MAX_STRING_LENGTH];
+        char b_string[DXF_MAX_STRING_LENGTH];
+        char *a_end;
+        char *b_end;
+        double x;
+        double y;
+
+        /* Handles are hexadecimal, names are case insensitive. */
+        if ((a_length == b_length) && (strncasecmp (a, b, a_length) == 0))
+        {
+                return (1);
+        }
+        if ((a_length == 0) || (b_length == 0)
+          || (a_length >= sizeof (a_string)) || (b_length >= sizeof (b_string)))
+        {
+                return (0);
+        }
+        memcpy (a_string, a, a_length);
+        a_string[a_length] = '\0';
+        memcpy (b_string, b, b_length);
+        b_string[b_length] = '\0';
+        x = strtod (a_string, &a_end);
+        y = strtod (b_string, &b_end);
+        return ((*a_end == '\0') && (*b_end == '\0')
+          && (fabs (x - y) <= 1e-9 * (1.0 + fabs (x))));
+}
+
+
+/*!
+ * \brief Compare the output of a round trip with the golden file.
+ *
+ * \return the fidelity, with the 1-based number and the contents of the
+ * first differing line in \c difference.
+ */
+static GoldenStatus
+golden_compare
+(
+        const char *expected,
+        long expected_size,
+        const char *result,
+        long result_size,
+        char *difference,
+        size_t size
+)
+{
+        const char *a_line = "";
+        const char *b_line = "";
+        size_t a_length = 0;
+        size_t b_length = 0;
+        int a_more;
+        int b_more;
+        int line_number = 0;
+
+        difference[0] = '\0';
+        if ((expected_size == result_size)
+          && (memcmp (expected, result, (size_t) expected_size) == 0))
+        {
+                return (GOLDEN_IDENTICAL);
+        }
+        for (;;)
+        {
+                a_more = golden_next_line (&expected, &a_line, &a_length);
+                b_more = golden_next_line (&result, &b_line, &b_length);
+                line_number++;
+                if (!a_more && !b_more)
+                {
+                        return (GOLDEN_EQUIVALENT);
+                }
+                if ((a_more != b_more)
+                  || !golden_same_value (a_line, a_length, b_line, b_length))
+                {
+                        snprintf (difference, size,
+                          "line %d: expected \"%.*s\", got \"%.*s\"",
+                          line_number, a_more ? (int) a_length : 0, a_line,
+                          b_more ? (int) b_length : 0, b_line);
+                        return (GOLDEN_DIFFERENT);
+                }
+        }
+}
+
+
+/*!
+ * \brief Position \c fp after the entity name at the start of a golden
+ * file.
+ *
+ * \return the entity type, or \c NULL when the file does not start with
+ * an entity type with a reader and a writer.
+ */
+static const GoldenEntity *
+golden_read_start
+(
+        DxfFile *fp
+)
+{
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int i;
+
+        rewind (fp->fp);
+        fp->line_number = 0;
+        memset (temp_string, 0, sizeof (temp_string));
+        dxf_read_line (temp_string, fp);
+        if (strcmp (temp_string + strspn (temp_string, " "), "0") != 0)
+        {
+                return (NULL);
+        }
+        dxf_read_line (temp_string, fp);
+        for (i = 0; i < GOLDEN_NUMBER_OF_ENTITIES; i++)
+        {
+                if (strcmp (temp_string, golden_entities[i].dxf_name) == 0)
+                {
+                        return (&golden_entities[i]);
+                }
+        }
+        return (NULL);
+}
+
+
+/*!
+ * \brief Round trip one golden file and time \c repeat parse and emit
+ * runs.
+ */
+static GoldenStatus
+golden_run_file
+(
+        const char *directory,
+        const char *filename,
+        int acad_version_number,
+        int repeat,
+        int verbose
+)
+{
+        const GoldenEntity *entity = NULL;
+        char path[4096];
+        char difference[512];
+        DxfFile in;
+        DxfFile out;
+        void *parsed = NULL;
+        void *copy = NULL;
+        char *expected = NULL;
+        char *result = NULL;
+        long expected_size;
+        long result_size;
+        double start;
+        double parse_seconds;
+        double emit_seconds;
+        GoldenStatus status = GOLDEN_FAILED;
+        int i;
+
+        snprintf (path, sizeof (path), "%s/%s", directory, filename);
+        memset (&in, 0, sizeof (DxfFile));
+        memset (&out, 0, sizeof (DxfFile));
+        in.filename = path;
+        in.acad_version_number = acad_version_number;
+        out.filename = "(temporary file)";
+        out.acad_version_number = acad_version_number;
+        in.fp = fopen (path, "rb");
+        out.fp = tmpfile ();
+        if ((in.fp == NULL) || (out.fp == NULL))
+        {
+                goto done;
+        }
+        /* Fidelity. */
+        expected = golden_slurp (in.fp, &expected_size);
+        if ((expected == NULL)
+          || ((entity = golden_read_start (&in)) == NULL)
+          || ((parsed = entity->read (&in)) == NULL)
+          || (entity->write (&out, parsed) != EXIT_SUCCESS)
+          || (fflush (out.fp) != 0)
+          || ((result = golden_slurp (out.fp, &result_size)) == NULL))
+        {
+                goto done;
+        }
+        status = golden_compare (expected, expected_size, result,
+          result_size, difference, sizeof (difference));
+        /* Throughput. */
+        start = golden_now ();
+        for (i = 0; i < repeat; i++)
+        {
+                golden_read_start (&in);
+                copy = entity->read (&in);
+                if (copy != NULL)
+                {
+                        entity->free (copy);
+                }
+        }
+        parse_seconds = golden_now () - start;
+        start = golden_now ();
+        for (i = 0; i < repeat; i++)
+        {
+                rewind (out.fp);
+                entity->write (&out, parsed);
+        }
+        fflush (out.fp);
+        emit_seconds = golden_now () - start;
+        fprintf (stdout, "%-34s %-10s %-6d %-10s %12.3f %12.3f\n",
+          filename, entity->dxf_name, acad_version_number,
+          golden_status_names[status],
+          1e6 * parse_seconds / repeat, 1e6 * emit_seconds / repeat);
+        if ((status == GOLDEN_DIFFERENT) && verbose)
+        {
+                fprintf (stdout, "    %s\n", difference);
+        }
+done:
+        if (status == GOLDEN_FAILED)
+        {
+                fprintf (stdout, "%-34s %-10s %-6d %-10s\n", filename,
+                  (entity != NULL) ? entity->dxf_name : "?",
+                  acad_version_number, golden_status_names[status]);
+        }
+        if (parsed != NULL)
+        {
+                entity->free (parsed);
+        }
+        free (expected);
+        free (result);
+        if (in.fp != NULL)
+        {
+                fclose (in.fp);
+        }
+        if (out.fp != NULL)
+        {
+                fclose (out.fp);
+        }
+        return (status);
+}
+
+
+/*!
+ * \brief Look up the version of a golden file from its name,
+ * "<entity>[_<shape>]_R<version>.dxf".
+ *
+ * \return the AutoCAD version number, or \c 0 for other file names.
+ */
+static int
+golden_parse_filename
+(
+        const char *filename
+)
+{
+        size_t length = strlen (filename);
+        size_t suffix_length;
+        size_t i;
+
+        for (i = 0; i < sizeof (golden_versions) / sizeof (golden_versions[0]); i++)
+        {
+                suffix_length = strlen (golden_versions[i].suffix);
+                if ((length > suffix_length)
+                  && (strcmp (filename + length - suffix_length, golden_versions[i].suffix) == 0))
+                {
+                        return (golden_versions[i].acad_version_number);
+                }
+        }
+        return (0);
+}
+
+
+/*!
+ * \brief Look up the known fidelity of a golden file.
+ *
+ * \return the known fidelity, with the reason in \c reason, or
+ * \c GOLDEN_EQUIVALENT with \c NULL in \c reason.
+ */
+static GoldenStatus
+golden_known_status
+(
+        const char *filename,
+        const char **reason
+)
+{
+        size_t i;
+
+        for (i = 0; i < sizeof (golden_known) / sizeof (golden_known[0]); i++)
+        {
+                if (strcmp (golden_known[i].filename, filename) == 0)
+                {
+                        *reason = golden_known[i].reason;
+                        return (golden_known[i].status);
+                }
+        }
+        *reason = NULL;
+        return (GOLDEN_EQUIVALENT);
+}
+
+
+static int
+golden_compare_names
+(
+        const void *a,
+        const void *b
+)
+{
+        return (strcmp (*(char * const *) a, *(char * const *) b));
+}
+
+
+/*!
+ * \brief Round trip every golden file.
+ *
+ * Usage: golden [--dir DIR] [--repeat N] [--strict] [--verbose]\n
+ * Reads every golden file, writes it back and compares the output with
+ * the golden file, then reports the fidelity and the parse and emit
+ * time per entity in microseconds, per entity type and version.\n
+ * Exits with \c EXIT_FAILURE when a round trip is worse than its known
+ * fidelity in \c golden_known[], or with \c --strict when an output is
+ * not byte identical.
+ */
+int
+main
+(
+        int argc,
+        char *argv[]
+)
+{
+        const char *directory = getenv ("GOLDEN_DIR");
+        struct dirent *entry = NULL;
+        char **filenames = NULL;
+        size_t number_of_files = 0;
+        size_t i;
+        DIR *dir = NULL;
+        GoldenStatus status;
+        GoldenStatus known;
+        const char *reason = NULL;
+        int counts[GOLDEN_FAILED + 1] = {0, 0, 0, 0};
+        int regressions = 0;
+        int acad_version_number;
+        int repeat = GOLDEN_DEFAULT_REPEAT;
+        int strict = 0;
+        int verbose = 0;
+        int argi;
+
+        if (directory == NULL)
+        {
+                directory = GOLDEN_DEFAULT_DIR;
+        }
+        for (argi = 1; argi < argc; argi++)
+        {
+                if ((strcmp (argv[argi], "--dir") == 0) && (argi + 1 < argc))
+                {
+                        directory = argv[++argi];
+                }
+                else if ((strcmp (argv[argi], "--repeat") == 0) && (argi + 1 < argc))
+                {
+                        repeat = atoi (argv[++argi]);
+                }
+                else if (strcmp (argv[argi], "--strict") == 0)
+                {
+                        strict = 1;
+                }
+                else if (strcmp (argv[argi], "--verbose") == 0)
+                {
+                        verbose = 1;
+                }
+                else
+                {
+                        fprintf (stderr,
+                          "Usage: %s [--dir DIR] [--repeat N] [--strict] [--verbose]\n",
+                          argv[0]);
+                        return (EXIT_FAILURE);
+                }
+        }
+        if (repeat < 1)
+        {
+                repeat = 1;
+        }
+        dir = opendir (directory);
+        if (dir == NULL)
+        {
+                fprintf (stderr, "Error: could not open directory %s.\n",
+                  directory);
+                return (EXIT_FAILURE);
+        }
+        while ((entry = readdir (dir)) != NULL)
+        {
+                if (golden_parse_filename (entry->d_name) != 0)
+                {
+                        filenames = realloc (filenames,
+                          (number_of_files + 1) * sizeof (char *));
+                        filenames[number_of_files++] = strdup (entry->d_name);
+                }
+        }
+        closedir (dir);
+        qsort (filenames, number_of_files, sizeof (char *), golden_compare_names);
+        fprintf (stdout, "%-34s %-10s %-6s %-10s %12s %12s\n", "file",
+          "entity", "acad", "fidelity", "parse [us]", "emit [us]");
+        for (i = 0; i < number_of_files; i++)
+        {
+                acad_version_number = golden_parse_filename (filenames[i]);
+                status = golden_run_file (directory, filenames[i],
+                  acad_version_number, repeat, verbose);
+                counts[status]++;
+                known = golden_known_status (filenames[i], &reason);
+                if (status > known)
+                {
+                        fprintf (stdout, "    regression, known to be %s\n",
+                          golden_status_names[known]);
+                        regressions++;
+                }
+                else if (status < known)
+                {
+                        fprintf (stdout, "    improved, known to be %s\n",
+                          golden_status_names[known]);
+                }
+                else if ((reason != NULL) && verbose)
+                {
+                        fprintf (stdout, "    known: %s\n", reason);
+                }
+                free (filenames[i]);
+        }
+        free (filenames);
+        fprintf (stdout, "%lu files: %d identical, %d equivalent, %d different, %d failed, %d regressions.\n",
+          (unsigned long) number_of_files, counts[GOLDEN_IDENTICAL],
+          counts[GOLDEN_EQUIVALENT], counts[GOLDEN_DIFFERENT],
+          counts[GOLDEN_FAILED], regressions);
+        if ((number_of_files == 0) || (regressions > 0)
+          || (strict && (counts[GOLDEN_IDENTICAL] != (int) number_of_files)))
+        {
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/* EOF */
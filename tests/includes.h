@@ -39,6 +39,21 @@
 #include "src/dxf.h"
 
 
+#define TESTS_EXAMPLE_FILE "../../examples/qcad-example_R2000.dxf"
+        /*!< \brief DXF file read by the tests, relative to the working
+         * directory of the tests. */
+
+
+int test_point (int argc, char** argv);
+int test_geom_batch ();
+int test_drawing_write ();
+char *test_drawing_write_buffer (DxfDrawing *drawing, int number_of_threads, DxfDrawingWriteOrder order, long *size);
+int test_hex ();
+int test_parser ();
+int test_directory ();
+int test_read_ahead ();
+
+
 #endif /* LIBDXF_TESTS_INCLUDES_H */
 
 
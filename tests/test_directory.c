@@ -0,0 +1,158 @@
+/*!
+ * \file test_directory.c
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the section directory and its sidecar
+ * file.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include "includes.h"
+
+
+#define TEST_DIRECTORY_SIDECAR_FILE "test_directory" DXF_DIRECTORY_SIDECAR_SUFFIX
+        /*!< \brief Sidecar file written by the test, in the working
+         * directory. */
+
+
+/*!
+ * \brief Perform test functions for the section directory and its
+ * sidecar file.
+ *
+ * The directory of \c TESTS_EXAMPLE_FILE is written to a sidecar file
+ * and read back, every entry has to survive the round trip, and the
+ * offset of every entry has to point at the group code \c 0 line of a
+ * \c SECTION, \c TABLE or \c BLOCK marker.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_directory ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDirectory *scanned = NULL;
+        DxfDirectory *read = NULL;
+        DxfDirectoryEntry *a = NULL;
+        DxfDirectoryEntry *b = NULL;
+        DxfFile fp;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        size_t i;
+        int errors = 0;
+
+        scanned = dxf_directory_scan (TESTS_EXAMPLE_FILE);
+        if ((scanned == NULL) || (scanned->number_of_entries == 0))
+        {
+                fprintf (stderr, "Error in %s () could not scan file: %s.\n",
+                  __FUNCTION__, TESTS_EXAMPLE_FILE);
+                fprintf (stdout, "TESTS: directory failed\n");
+                return (EXIT_FAILURE);
+        }
+        if (dxf_directory_write (scanned, TEST_DIRECTORY_SIDECAR_FILE) != EXIT_SUCCESS)
+        {
+                errors++;
+        }
+        read = dxf_directory_read (TESTS_EXAMPLE_FILE, TEST_DIRECTORY_SIDECAR_FILE);
+        if ((read == NULL)
+          || (read->number_of_entries != scanned->number_of_entries)
+          || (read->file_size != scanned->file_size)
+          || (read->file_time != scanned->file_time))
+        {
+                fprintf (stderr, "Error in %s () sidecar file differs from the scan.\n",
+                  __FUNCTION__);
+                errors++;
+        }
+        for (i = 0; (read != NULL) && (errors == 0) && (i < scanned->number_of_entries); i++)
+        {
+                a = &scanned->entries[i];
+                b = &read->entries[i];
+                if ((a->kind != b->kind)
+                  || (strcmp (a->name, b->name) != 0)
+                  || (a->offset != b->offset)
+                  || (a->end != b->end)
+                  || (a->line_number != b->line_number))
+                {
+                        fprintf (stderr, "Error in %s () entry %lu (%s) differs.\n",
+                          __FUNCTION__, (unsigned long) i, a->name);
+                        errors++;
+                }
+        }
+        /* Every entry starts exactly at the group code 0 line of its
+         * marker, not at the marker itself. */
+        memset (&fp, 0, sizeof (DxfFile));
+        fp.fp = fopen (TESTS_EXAMPLE_FILE, "rb");
+        for (i = 0; (fp.fp != NULL) && (i < scanned->number_of_entries); i++)
+        {
+                a = &scanned->entries[i];
+                if (fseek (fp.fp, a->offset, SEEK_SET) != 0)
+                {
+                        errors++;
+                        break;
+                }
+                memset (temp_string, 0, sizeof (temp_string));
+                dxf_read_line (temp_string, &fp);
+                if (strcmp (temp_string + strspn (temp_string, " "), "0") != 0)
+                {
+                        fprintf (stderr, "Error in %s () entry %lu (%s) does not start at a group code 0 line.\n",
+                          __FUNCTION__, (unsigned long) i, a->name);
+                        errors++;
+                        continue;
+                }
+                dxf_read_line (temp_string, &fp);
+                if ((strcmp (temp_string, "SECTION") != 0)
+                  && (strcmp (temp_string, "TABLE") != 0)
+                  && (strcmp (temp_string, "BLOCK") != 0))
+                {
+                        fprintf (stderr, "Error in %s () entry %lu (%s) does not start at a marker.\n",
+                          __FUNCTION__, (unsigned long) i, a->name);
+                        errors++;
+                }
+        }
+        if (fp.fp != NULL)
+        {
+                fclose (fp.fp);
+        }
+        if (read != NULL)
+        {
+                dxf_directory_free (read);
+        }
+        dxf_directory_free (scanned);
+        remove (TEST_DIRECTORY_SIDECAR_FILE);
+        fprintf (stdout, "TESTS: directory %s\n", (errors == 0) ? "passed" : "failed");
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((errors == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/* EOF */
@@ -0,0 +1,213 @@
+/*!
+ * \file test_drawing_write.c
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the parallel drawing writer.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Write a drawing to memory.
+ *
+ * The drawing is written with dxf_file_write () when
+ * \c number_of_threads is 0, else with
+ * dxf_drawing_write_parallel_order ().\n
+ * Entities rejected by their writer, like the zero length \c LINE
+ * entities of \c TESTS_EXAMPLE_FILE, are left out by both writers, but
+ * only the parallel writer reports them, the output is kept whatever the
+ * writer returns.
+ *
+ * \return a pointer to the output, to be freed with dxf_free (), or
+ * \c NULL when an error occurred.
+ */
+char *
+test_drawing_write_buffer
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to the drawing. */
+        int number_of_threads,
+                /*!< number of threads, 0 for the serial writer. */
+        DxfDrawingWriteOrder order,
+                /*!< order of the entities of the parallel writer. */
+        long *size
+                /*!< the size of the output. */
+)
+{
+        DxfFile fp;
+        char *buffer = NULL;
+
+        memset (&fp, 0, sizeof (DxfFile));
+        fp.fp = tmpfile ();
+        fp.filename = "(temporary file)";
+        fp.acad_version_number = AutoCAD_2000;
+        if (fp.fp == NULL)
+        {
+                return (NULL);
+        }
+        if (number_of_threads == 0)
+        {
+                dxf_file_write (&fp, drawing);
+        }
+        else
+        {
+                dxf_drawing_write_parallel_order (drawing, &fp,
+                  number_of_threads, order);
+        }
+        if ((fflush (fp.fp) == 0)
+          && ((*size = ftell (fp.fp)) >= 0)
+          && (fseek (fp.fp, 0L, SEEK_SET) == 0))
+        {
+                buffer = dxf_malloc ((size_t) *size + 1);
+                if ((buffer != NULL)
+                  && (fread (buffer, 1, (size_t) *size, fp.fp) != (size_t) *size))
+                {
+                        dxf_free (buffer);
+                        buffer = NULL;
+                }
+        }
+        fclose (fp.fp);
+        return (buffer);
+}
+
+
+/*!
+ * \brief Compare an output with the expected output.
+ *
+ * \return \c EXIT_SUCCESS when the outputs are byte identical, or
+ * \c EXIT_FAILURE when they differ.
+ */
+static int
+test_drawing_write_compare
+(
+        const char *name,
+                /*!< name of the output in the error message. */
+        int number_of_threads,
+                /*!< number of threads of the output. */
+        char *expected,
+                /*!< the expected output. */
+        long expected_size,
+                /*!< the size of the expected output. */
+        char *result,
+                /*!< the output, or \c NULL. */
+        long result_size
+                /*!< the size of the output. */
+)
+{
+        if ((result == NULL)
+          || (result_size != expected_size)
+          || (memcmp (result, expected, (size_t) expected_size) != 0))
+        {
+                fprintf (stderr, "Error in %s () %s output of %d threads differs.\n",
+                  __FUNCTION__, name, number_of_threads);
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Perform test functions for the parallel drawing writer.
+ *
+ * \c TESTS_EXAMPLE_FILE is written with dxf_file_write () and with
+ * dxf_drawing_write_parallel_order () on 1, 2, 3 and 8 threads.\n
+ * With \c DXF_DRAWING_WRITE_ORDER_TYPE every output has to be byte
+ * identical to the serial output, with
+ * \c DXF_DRAWING_WRITE_ORDER_HANDLE to the output of a single thread.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_drawing_write ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        static const int threads[] = {1, 2, 3, 8};
+        DxfDrawing *drawing = NULL;
+        char *serial = NULL;
+        char *by_handle = NULL;
+        char *parallel = NULL;
+        long serial_size = 0;
+        long by_handle_size = 0;
+        long parallel_size = 0;
+        size_t i;
+        int errors = 0;
+
+        drawing = dxf_drawing_new ();
+        if ((drawing == NULL)
+          || (dxf_file_read_drawing (TESTS_EXAMPLE_FILE, drawing) != EXIT_SUCCESS))
+        {
+                fprintf (stderr, "Error in %s () could not read file: %s.\n",
+                  __FUNCTION__, TESTS_EXAMPLE_FILE);
+                fprintf (stdout, "TESTS: drawing_write failed\n");
+                if (drawing != NULL)
+                {
+                        dxf_drawing_free (drawing);
+                }
+                return (EXIT_FAILURE);
+        }
+        serial = test_drawing_write_buffer (drawing, 0,
+          DXF_DRAWING_WRITE_ORDER_TYPE, &serial_size);
+        by_handle = test_drawing_write_buffer (drawing, 1,
+          DXF_DRAWING_WRITE_ORDER_HANDLE, &by_handle_size);
+        if ((serial == NULL) || (by_handle == NULL))
+        {
+                errors++;
+        }
+        for (i = 0; (errors == 0) && (i < sizeof (threads) / sizeof (threads[0])); i++)
+        {
+                parallel = test_drawing_write_buffer (drawing, threads[i],
+                  DXF_DRAWING_WRITE_ORDER_TYPE, &parallel_size);
+                errors += test_drawing_write_compare ("type order",
+                  threads[i], serial, serial_size, parallel, parallel_size);
+                dxf_free (parallel);
+                parallel = test_drawing_write_buffer (drawing, threads[i],
+                  DXF_DRAWING_WRITE_ORDER_HANDLE, &parallel_size);
+                errors += test_drawing_write_compare ("handle order",
+                  threads[i], by_handle, by_handle_size, parallel,
+                  parallel_size);
+                dxf_free (parallel);
+        }
+        dxf_free (serial);
+        dxf_free (by_handle);
+        dxf_drawing_free (drawing);
+        fprintf (stdout, "TESTS: drawing_write %s\n", (errors == 0) ? "passed" : "failed");
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((errors == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/* EOF */
@@ -0,0 +1,232 @@
+/*!
+ * \file test_geom_batch.c
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the batch geometry predicates.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include "includes.h"
+
+
+#define TEST_GEOM_BATCH_NUMBER_OF_POINTS 1003
+        /*!< \brief Number of test points, not a multiple of the vector
+         * width to cover the scalar tail. */
+
+
+/*!
+ * \brief Get the next pseudo random number in [0, 1).
+ */
+static double
+test_geom_batch_random
+(
+        uint64_t *seed
+                /*!< state of the generator. */
+)
+{
+        *seed = *seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        return ((double) (*seed >> 11) / 9007199254740992.0);
+}
+
+
+/*!
+ * \brief Compare an array of batch results with the results of the
+ * same function called for one point at a time, which takes the scalar
+ * path.
+ *
+ * \return the number of differences.
+ */
+static int
+test_geom_batch_compare
+(
+        const char *name,
+                /*!< name of the predicate, as reported. */
+        const int *batch,
+                /*!< results of the batch call. */
+        const int *scalar,
+                /*!< results of the single point calls. */
+        size_t n
+                /*!< number of results. */
+)
+{
+        size_t i;
+        int differences = 0;
+
+        for (i = 0; i < n; i++)
+        {
+                if (batch[i] != scalar[i])
+                {
+                        if (differences == 0)
+                        {
+                                fprintf (stderr,
+                                  "Error in %s () point %lu: vector %d, scalar %d.\n",
+                                  name, (unsigned long) i, batch[i], scalar[i]);
+                        }
+                        differences++;
+                }
+        }
+        return (differences);
+}
+
+
+/*!
+ * \brief Perform test functions for the batch geometry predicates.
+ *
+ * Every predicate is evaluated once over all points, which takes the
+ * SSE2 or AVX2 kernels, and once per point, which takes the scalar
+ * code, the results have to be the same.\n
+ * Some of the points are exactly on the circle, the arc end points and
+ * the box edges.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_geom_batch ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        static const double arcs[][2] =
+        {
+                {10.0, 100.0},
+                {30.0, 300.0},
+                {45.0, 45.0},
+                {300.0, 30.0}
+        };
+        double x[TEST_GEOM_BATCH_NUMBER_OF_POINTS];
+        double y[TEST_GEOM_BATCH_NUMBER_OF_POINTS];
+        double x1[TEST_GEOM_BATCH_NUMBER_OF_POINTS];
+        double y1[TEST_GEOM_BATCH_NUMBER_OF_POINTS];
+        double batch_distances[TEST_GEOM_BATCH_NUMBER_OF_POINTS];
+        double scalar_distances[TEST_GEOM_BATCH_NUMBER_OF_POINTS];
+        int batch[TEST_GEOM_BATCH_NUMBER_OF_POINTS];
+        int scalar[TEST_GEOM_BATCH_NUMBER_OF_POINTS];
+        uint64_t seed = 2020;
+        size_t n = TEST_GEOM_BATCH_NUMBER_OF_POINTS;
+        size_t i;
+        size_t a;
+        int differences = 0;
+
+        for (i = 0; i < n; i++)
+        {
+                switch (i % 8)
+                {
+                        case 0:
+                                /* On the circle. */
+                                x[i] = 0.5 + 1.25;
+                                y[i] = 0.25;
+                                break;
+                        case 1:
+                                /* On a box edge. */
+                                x[i] = 1.0;
+                                y[i] = -0.5 + test_geom_batch_random (&seed);
+                                break;
+                        case 2:
+                                /* The center. */
+                                x[i] = 0.5;
+                                y[i] = 0.25;
+                                break;
+                        default:
+                                x[i] = -2.0 + 5.0 * test_geom_batch_random (&seed);
+                                y[i] = -2.0 + 5.0 * test_geom_batch_random (&seed);
+                                break;
+                }
+        }
+        for (i = 0; i < n; i++)
+        {
+                x1[i] = x[(i + 1) % n];
+                y1[i] = y[(i + 1) % n];
+        }
+        /* Point in circle. */
+        dxf_geom_batch_points_in_circle (x, y, n, 0.5, 0.25, 1.25, batch);
+        for (i = 0; i < n; i++)
+        {
+                dxf_geom_batch_points_in_circle (x + i, y + i, 1, 0.5,
+                  0.25, 1.25, scalar + i);
+        }
+        differences += test_geom_batch_compare ("dxf_geom_batch_points_in_circle",
+          batch, scalar, n);
+        /* Point on arc, up to and over 180 degrees, a full circle and
+         * an arc crossing 0 degrees. */
+        for (a = 0; a < sizeof (arcs) / sizeof (arcs[0]); a++)
+        {
+                dxf_geom_batch_points_on_arc (x, y, n, 0.5, 0.25, 1.25,
+                  arcs[a][0], arcs[a][1], 0.05, batch);
+                for (i = 0; i < n; i++)
+                {
+                        dxf_geom_batch_points_on_arc (x + i, y + i, 1, 0.5,
+                          0.25, 1.25, arcs[a][0], arcs[a][1], 0.05,
+                          scalar + i);
+                }
+                differences += test_geom_batch_compare ("dxf_geom_batch_points_on_arc",
+                  batch, scalar, n);
+        }
+        /* Point to segment distance, also a segment of zero length. */
+        for (a = 0; a < 2; a++)
+        {
+                dxf_geom_batch_points_segment_distance (x, y, n, -1.0, -1.0,
+                  (a == 0) ? 2.0 : -1.0, (a == 0) ? 1.5 : -1.0,
+                  batch_distances);
+                for (i = 0; i < n; i++)
+                {
+                        dxf_geom_batch_points_segment_distance (x + i, y + i,
+                          1, -1.0, -1.0, (a == 0) ? 2.0 : -1.0,
+                          (a == 0) ? 1.5 : -1.0, scalar_distances + i);
+                        batch[i] = (fabs (batch_distances[i] - scalar_distances[i])
+                          <= 1e-12 * (1.0 + scalar_distances[i]));
+                        scalar[i] = TRUE;
+                }
+                differences += test_geom_batch_compare ("dxf_geom_batch_points_segment_distance",
+                  batch, scalar, n);
+        }
+        /* Segment versus box. */
+        dxf_geom_batch_segments_overlap_box (x, y, x1, y1, n, -0.5, -0.5,
+          1.0, 1.0, batch);
+        for (i = 0; i < n; i++)
+        {
+                dxf_geom_batch_segments_overlap_box (x + i, y + i, x1 + i,
+                  y1 + i, 1, -0.5, -0.5, 1.0, 1.0, scalar + i);
+        }
+        differences += test_geom_batch_compare ("dxf_geom_batch_segments_overlap_box",
+          batch, scalar, n);
+        fprintf (stdout, "TESTS: geom_batch (instruction set %d) %s\n",
+          (int) dxf_geom_batch_get_isa (),
+          (differences == 0) ? "passed" : "failed");
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((differences == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/* EOF */
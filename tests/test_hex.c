@@ -0,0 +1,176 @@
+/*!
+ * \file test_hex.c
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the hexadecimal binary data codec.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <ctype.h>
+#include "includes.h"
+
+
+#define TEST_HEX_SIZE 1000
+        /*!< \brief Largest number of bytes encoded. */
+
+
+/*!
+ * \brief Perform test functions for the hexadecimal binary data codec.
+ *
+ * Bytes are encoded and decoded again for sizes around the vector
+ * widths of the SSE2 code, in upper and lower case, and in lines of
+ * at most \c DXF_HEX_LINE_BYTES bytes appended with dxf_hex_append (),
+ * invalid data has to be rejected.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_hex ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        static const size_t sizes[] =
+        {
+                0, 1, 7, 8, 9, 15, 16, 17, 31, 32, 33, 127, 128, 256,
+                TEST_HEX_SIZE
+        };
+        unsigned char bytes[TEST_HEX_SIZE];
+        unsigned char decoded[TEST_HEX_SIZE];
+        char hex[2 * TEST_HEX_SIZE + 3];
+        char line[2 * DXF_HEX_LINE_BYTES + 3];
+        unsigned char *appended = NULL;
+        size_t appended_size = 0;
+        size_t capacity = 0;
+        size_t size;
+        size_t length;
+        size_t i;
+        size_t s;
+        int errors = 0;
+
+        for (i = 0; i < TEST_HEX_SIZE; i++)
+        {
+                bytes[i] = (unsigned char) ((i * 167 + 13) & 0xff);
+        }
+        for (s = 0; s < sizeof (sizes) / sizeof (sizes[0]); s++)
+        {
+                size = sizes[s];
+                dxf_hex_encode (bytes, size, hex);
+                for (i = 0; i < 2 * size; i++)
+                {
+                        if (!isxdigit ((unsigned char) hex[i])
+                          || islower ((unsigned char) hex[i]))
+                        {
+                                fprintf (stderr, "Error in %s () size %lu: invalid character encoded.\n",
+                                  __FUNCTION__, (unsigned long) size);
+                                errors++;
+                                break;
+                        }
+                }
+                /* Upper case. */
+                if ((dxf_hex_decode (hex, 2 * size, decoded) != (long) size)
+                  || (memcmp (bytes, decoded, size) != 0))
+                {
+                        fprintf (stderr, "Error in %s () size %lu: upper case round trip failed.\n",
+                          __FUNCTION__, (unsigned long) size);
+                        errors++;
+                }
+                /* Lower case. */
+                for (i = 0; i < 2 * size; i++)
+                {
+                        hex[i] = (char) tolower ((unsigned char) hex[i]);
+                }
+                memset (decoded, 0, sizeof (decoded));
+                if ((dxf_hex_decode (hex, 2 * size, decoded) != (long) size)
+                  || (memcmp (bytes, decoded, size) != 0))
+                {
+                        fprintf (stderr, "Error in %s () size %lu: lower case round trip failed.\n",
+                          __FUNCTION__, (unsigned long) size);
+                        errors++;
+                }
+                if (size == 0)
+                {
+                        continue;
+                }
+                /* An odd number of characters, an invalid character at
+                 * the start, and one in the last byte. */
+                if (dxf_hex_decode (hex, 2 * size - 1, decoded) != -1)
+                {
+                        fprintf (stderr, "Error in %s () size %lu: odd length accepted.\n",
+                          __FUNCTION__, (unsigned long) size);
+                        errors++;
+                }
+                hex[0] = 'G';
+                if (dxf_hex_decode (hex, 2 * size, decoded) != -1)
+                {
+                        fprintf (stderr, "Error in %s () size %lu: invalid first character accepted.\n",
+                          __FUNCTION__, (unsigned long) size);
+                        errors++;
+                }
+                dxf_hex_encode (bytes, size, hex);
+                hex[2 * size - 1] = ' ';
+                if (dxf_hex_decode (hex, 2 * size, decoded) != -1)
+                {
+                        fprintf (stderr, "Error in %s () size %lu: invalid last character accepted.\n",
+                          __FUNCTION__, (unsigned long) size);
+                        errors++;
+                }
+        }
+        /* Lines of binary chunk data, as read from group 310. */
+        for (i = 0; i < TEST_HEX_SIZE; i += DXF_HEX_LINE_BYTES)
+        {
+                length = (TEST_HEX_SIZE - i < DXF_HEX_LINE_BYTES)
+                  ? TEST_HEX_SIZE - i : DXF_HEX_LINE_BYTES;
+                dxf_hex_encode (bytes + i, length, line);
+                strcpy (line + 2 * length, "\r");
+                if (dxf_hex_append (&appended, &appended_size, &capacity, line) != EXIT_SUCCESS)
+                {
+                        errors++;
+                        break;
+                }
+        }
+        if ((appended_size != TEST_HEX_SIZE)
+          || (memcmp (bytes, appended, TEST_HEX_SIZE) != 0))
+        {
+                fprintf (stderr, "Error in %s () appended lines differ.\n",
+                  __FUNCTION__);
+                errors++;
+        }
+        dxf_free (appended);
+        fprintf (stdout, "TESTS: hex %s\n", (errors == 0) ? "passed" : "failed");
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((errors == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/* EOF */
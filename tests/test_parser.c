@@ -0,0 +1,133 @@
+/*!
+ * \file test_parser.c
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the push parser.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Perform test functions for the push parser.
+ *
+ * \c TESTS_EXAMPLE_FILE is read with dxf_file_read_drawing () and fed
+ * to a push parser one byte at a time, so every group code and value is
+ * split over chunks, both drawings have to be written the same.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_parser ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDrawing *read = NULL;
+        DxfDrawing *pushed = NULL;
+        DxfParser *parser = NULL;
+        FILE *fp = NULL;
+        char *expected = NULL;
+        char *result = NULL;
+        long expected_size = 0;
+        long result_size = 0;
+        int c;
+        char byte;
+        int errors = 0;
+
+        read = dxf_drawing_new ();
+        pushed = dxf_drawing_new ();
+        fp = fopen (TESTS_EXAMPLE_FILE, "rb");
+        if ((read == NULL) || (pushed == NULL) || (fp == NULL)
+          || (dxf_file_read_drawing (TESTS_EXAMPLE_FILE, read) != EXIT_SUCCESS))
+        {
+                fprintf (stderr, "Error in %s () could not read file: %s.\n",
+                  __FUNCTION__, TESTS_EXAMPLE_FILE);
+                fprintf (stdout, "TESTS: parser failed\n");
+                if (fp != NULL)
+                {
+                        fclose (fp);
+                }
+                if (read != NULL)
+                {
+                        dxf_drawing_free (read);
+                }
+                if (pushed != NULL)
+                {
+                        dxf_drawing_free (pushed);
+                }
+                return (EXIT_FAILURE);
+        }
+        parser = dxf_parser_open (pushed);
+        if (parser == NULL)
+        {
+                errors++;
+        }
+        while ((parser != NULL) && ((c = fgetc (fp)) != EOF))
+        {
+                byte = (char) c;
+                if (dxf_parser_feed (parser, &byte, 1) != EXIT_SUCCESS)
+                {
+                        errors++;
+                        break;
+                }
+        }
+        fclose (fp);
+        if ((parser != NULL) && (dxf_parser_close (parser) != EXIT_SUCCESS))
+        {
+                errors++;
+        }
+        expected = test_drawing_write_buffer (read, 0,
+          DXF_DRAWING_WRITE_ORDER_TYPE, &expected_size);
+        result = test_drawing_write_buffer (pushed, 0,
+          DXF_DRAWING_WRITE_ORDER_TYPE, &result_size);
+        if ((expected == NULL) || (result == NULL)
+          || (expected_size != result_size)
+          || (memcmp (expected, result, (size_t) expected_size) != 0))
+        {
+                fprintf (stderr, "Error in %s () pushed drawing differs from the read drawing.\n",
+                  __FUNCTION__);
+                errors++;
+        }
+        dxf_free (expected);
+        dxf_free (result);
+        dxf_drawing_free (read);
+        dxf_drawing_free (pushed);
+        fprintf (stdout, "TESTS: parser %s\n", (errors == 0) ? "passed" : "failed");
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((errors == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/* EOF */
@@ -0,0 +1,149 @@
+/*!
+ * \file test_read_ahead.c
+ *
+ * \author Copyright (C) 2020 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the read-ahead input.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+
+#include <stdio.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Perform test functions for the read-ahead input.
+ *
+ * \c TESTS_EXAMPLE_FILE is read with dxf_file_read_drawing () and,
+ * for a few ring and buffer sizes, through a file handle with
+ * dxf_file_set_read_ahead () enabled.\n
+ * Buffers of a few bytes split every group code and value over buffers,
+ * both drawings have to be written the same.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_read_ahead ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        static const struct
+        {
+                int number_of_buffers;
+                size_t buffer_size;
+        } sizes[] =
+        {
+                {2, 1},
+                {2, 7},
+                {3, 64},
+                {8, 4096},
+                {0, 0}
+        };
+        DxfDrawing *read = NULL;
+        DxfDrawing *read_ahead = NULL;
+        DxfFile *fp = NULL;
+        char *expected = NULL;
+        char *result = NULL;
+        long expected_size = 0;
+        long result_size = 0;
+        size_t i;
+        int errors = 0;
+
+        read = dxf_drawing_new ();
+        if ((read == NULL)
+          || (dxf_file_read_drawing (TESTS_EXAMPLE_FILE, read) != EXIT_SUCCESS))
+        {
+                fprintf (stderr, "Error in %s () could not read file: %s.\n",
+                  __FUNCTION__, TESTS_EXAMPLE_FILE);
+                fprintf (stdout, "TESTS: read_ahead failed\n");
+                if (read != NULL)
+                {
+                        dxf_drawing_free (read);
+                }
+                return (EXIT_FAILURE);
+        }
+        expected = test_drawing_write_buffer (read, 0,
+          DXF_DRAWING_WRITE_ORDER_TYPE, &expected_size);
+        if (expected == NULL)
+        {
+                errors++;
+        }
+        for (i = 0; (errors == 0) && (i < sizeof (sizes) / sizeof (sizes[0])); i++)
+        {
+                read_ahead = dxf_drawing_new ();
+                fp = dxf_read_init (TESTS_EXAMPLE_FILE);
+                if ((read_ahead == NULL) || (fp == NULL)
+                  || (dxf_file_set_read_ahead (fp, sizes[i].number_of_buffers,
+                  sizes[i].buffer_size) != EXIT_SUCCESS)
+                  || (dxf_file_read_drawing_from (fp, read_ahead) != EXIT_SUCCESS))
+                {
+                        fprintf (stderr, "Error in %s () could not read file: %s with %d buffers of %lu bytes.\n",
+                          __FUNCTION__, TESTS_EXAMPLE_FILE,
+                          sizes[i].number_of_buffers,
+                          (unsigned long) sizes[i].buffer_size);
+                        errors++;
+                }
+                else
+                {
+                        result = test_drawing_write_buffer (read_ahead, 0,
+                          DXF_DRAWING_WRITE_ORDER_TYPE, &result_size);
+                        if ((result == NULL)
+                          || (expected_size != result_size)
+                          || (memcmp (expected, result, (size_t) expected_size) != 0))
+                        {
+                                fprintf (stderr, "Error in %s () drawing read with %d buffers of %lu bytes differs from the read drawing.\n",
+                                  __FUNCTION__, sizes[i].number_of_buffers,
+                                  (unsigned long) sizes[i].buffer_size);
+                                errors++;
+                        }
+                        dxf_free (result);
+                        result = NULL;
+                }
+                if (fp != NULL)
+                {
+                        dxf_read_close (fp);
+                }
+                if (read_ahead != NULL)
+                {
+                        dxf_drawing_free (read_ahead);
+                }
+        }
+        dxf_free (expected);
+        dxf_drawing_free (read);
+        fprintf (stdout, "TESTS: read_ahead %s\n", (errors == 0) ? "passed" : "failed");
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((errors == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/* EOF */
@@ -37,16 +37,28 @@
 #include "includes.h"
 
 /*!
- * \brief Reads a dxf file using libdxf form examples dir.
+ * \brief Reads a dxf file using libdxf form examples dir, then runs the
+ * behaviour tests.
  *
  * \version According to DXF R2000.
  */
 int main (void)
 {
-    if (dxf_file_read ("../../examples/qcad-example_R2000.dxf"))
+    int errors = 0;
+
+    if (dxf_file_read (TESTS_EXAMPLE_FILE))
+    {
         fprintf (stdout, "TESTS: R2000 exited with error\n");
+        errors++;
+    }
     else
         fprintf (stdout, "TESTS: R2000 exited with no error\n");
-    
-    return 1;
+    errors += (test_geom_batch () != EXIT_SUCCESS);
+    errors += (test_drawing_write () != EXIT_SUCCESS);
+    errors += (test_hex () != EXIT_SUCCESS);
+    errors += (test_parser () != EXIT_SUCCESS);
+    errors += (test_directory () != EXIT_SUCCESS);
+    errors += (test_read_ahead () != EXIT_SUCCESS);
+
+    return ((errors == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
 }